@@ -6,6 +6,9 @@
 // [Dependencies]
 #include "BenchApp.h"
 #include "BenchFog.h"
+#include "BenchPicture.h"
+#include "BenchRasterOps.h"
+#include "BenchRasterizer.h"
 
 #if defined(FOG_BENCH_CAIRO)
 #include "BenchCairo.h"
@@ -65,6 +68,27 @@ bool BenchApp::hasBenchSource(uint32_t benchType)
   }
 }
 
+void BenchApp::getProjectedQuad(Fog::PointF* dst, const Fog::RectF& rect, float angle) const
+{
+  // The viewer is at the distance of twice the rect size.
+  float hw = rect.w * 0.5f;
+  float hh = rect.h * 0.5f;
+  float cx = rect.x + hw;
+  float cy = rect.y + hh;
+
+  float d = Fog::Math::max(rect.w, rect.h) * 2.0f;
+  float dx = hw * Fog::Math::cos(angle);
+  float dz = hw * Fog::Math::sin(angle);
+
+  float s0 = d / (d + dz);
+  float s1 = d / (d - dz);
+
+  dst[0].set(cx - dx * s0, cy - hh * s0);
+  dst[1].set(cx + dx * s1, cy - hh * s1);
+  dst[2].set(cx + dx * s1, cy + hh * s1);
+  dst[3].set(cx - dx * s0, cy + hh * s0);
+}
+
 void BenchApp::runAll()
 {
   Fog::ListIterator<BenchModule*> it(modules);
@@ -102,11 +126,15 @@ void BenchApp::runModule(BenchModule* module)
       if (sprites.isEmpty() && (
           type == BENCH_TYPE_BLIT_IMAGE_I ||
           type == BENCH_TYPE_BLIT_IMAGE_F ||
-          type == BENCH_TYPE_BLIT_IMAGE_ROTATE))
+          type == BENCH_TYPE_BLIT_IMAGE_ROTATE ||
+          type == BENCH_TYPE_BLIT_IMAGE_PROJECT))
       {
         continue;
       }
 
+      if (!module->hasBenchType(type))
+        continue;
+
       params.type = type;
       params.source = hasBenchSource(type) ? 0 : BENCH_SOURCE_NONE;
 
@@ -276,7 +304,8 @@ Fog::StringW BenchApp::getBenchString(uint32_t bench) const
     "FillComplex",
     "BlitImageI",
     "BlitImageF",
-    "BlitImageRot"
+    "BlitImageRot",
+    "BlitImageProj"
   };
 
   if (bench < BENCH_TYPE_COUNT)
@@ -367,8 +396,12 @@ void BenchApp::logInfo()
     yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_SSSE3)],
     yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_SSE4_1)],
     yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_SSE4_2)]);
-  logf("Features3: AVX=%s\n",
-    yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_AVX)]);
+  logf("Features3: AVX=%s, AVX2=%s, FMA3=%s, BMI=%s, BMI2=%s\n",
+    yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_AVX)],
+    yesno[Fog::Cpu::get()->hasFeature(Fog::CPU_FEATURE_AVX2)],
+    yesno[Fog::Cpu::get()->hasFeatureExt(Fog::CPU_FEATURE_EXT_FMA3)],
+    yesno[Fog::Cpu::get()->hasFeatureExt(Fog::CPU_FEATURE_EXT_BMI)],
+    yesno[Fog::Cpu::get()->hasFeatureExt(Fog::CPU_FEATURE_EXT_BMI2)]);
   logf("CPU Count: %u\n", Fog::Cpu::get()->getNumberOfProcessors());
   logf("\n");
 }
@@ -516,6 +549,13 @@ BenchModule::~BenchModule()
 {
 }
 
+bool BenchModule::hasBenchType(uint32_t type) const
+{
+  // Projective transformations are not supported by all libraries, a module
+  // that supports them must reimplement this method.
+  return type != BENCH_TYPE_BLIT_IMAGE_PROJECT;
+}
+
 void BenchModule::prepareSprites(int size)
 {
   size_t i, count = app.sprites.getLength();
@@ -538,6 +578,11 @@ void BenchModule::freeSprites()
   sprites.clear();
 }
 
+void BenchModule::runBlitImageProject(BenchOutput& output, const BenchParams& params)
+{
+  // Called only if hasBenchType(BENCH_TYPE_BLIT_IMAGE_PROJECT) returns true.
+}
+
 // ============================================================================
 // [Main]
 // ============================================================================
@@ -581,6 +626,24 @@ int main(int argc, char* argv[])
   // Run the tests.
   app.runAll();
 
+  // Run the low-level raster-ops tests.
+  {
+    BenchRasterOps rasterOps(app);
+    rasterOps.run();
+  }
+
+  // Run the path rasterizer tests.
+  {
+    BenchRasterizer rasterizer(app);
+    rasterizer.run();
+  }
+
+  // Run the picture tests.
+  {
+    BenchPicture picture(app);
+    picture.run();
+  }
+
 #if defined(FOG_OS_WINDOWS)
   system("pause");
 #endif // FOG_OS_WINDOWS
@@ -75,7 +75,8 @@ enum BENCH_TYPE
   BENCH_TYPE_BLIT_IMAGE_I = 7,
   BENCH_TYPE_BLIT_IMAGE_F = 8,
   BENCH_TYPE_BLIT_IMAGE_ROTATE = 9,
-  BENCH_TYPE_COUNT = 10
+  BENCH_TYPE_BLIT_IMAGE_PROJECT = 10,
+  BENCH_TYPE_COUNT = 11
 };
 
 // ============================================================================
@@ -97,6 +98,10 @@ struct BenchApp
 
   bool hasBenchSource(uint32_t benchType);
 
+  //! @brief Get the quad of @a rect rotated by @a angle around its vertical
+  //! axis and projected back to the screen (used by BlitImageProj).
+  void getProjectedQuad(Fog::PointF* dst, const Fog::RectF& rect, float angle) const;
+
   void runAll();
   void runModule(BenchModule* module);
   void registerResults(BenchModule* module, const BenchParams& params, const BenchOutput& output);
@@ -198,6 +203,8 @@ struct BenchModule
   virtual Fog::StringW getModuleName() const = 0;
   virtual Fog::List<uint32_t> getSupportedPixelFormats() const = 0;
 
+  virtual bool hasBenchType(uint32_t type) const;
+
   virtual void bench(BenchOutput& output, const BenchParams& params) = 0;
   virtual void prepareSprites(int size);
   virtual void freeSprites();
@@ -215,6 +222,7 @@ struct BenchModule
   virtual void runBlitImageI(BenchOutput& output, const BenchParams& params) = 0;
   virtual void runBlitImageF(BenchOutput& output, const BenchParams& params) = 0;
   virtual void runBlitImageRotate(BenchOutput& output, const BenchParams& params) = 0;
+  virtual void runBlitImageProject(BenchOutput& output, const BenchParams& params);
 
   // --------------------------------------------------------------------------
   // [Members]
@@ -42,6 +42,11 @@ Fog::List<uint32_t> BenchFog::getSupportedPixelFormats() const
   return list;
 }
 
+bool BenchFog::hasBenchType(uint32_t type) const
+{
+  return true;
+}
+
 void BenchFog::bench(BenchOutput& output, const BenchParams& params)
 {
   if (screen.create(params.screenSize, params.format) != Fog::ERR_OK)
@@ -52,6 +57,7 @@ void BenchFog::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_IMAGE_PROJECT:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -100,6 +106,10 @@ void BenchFog::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_IMAGE_PROJECT:
+      runBlitImageProject(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -485,3 +495,38 @@ void BenchFog::runBlitImageRotate(BenchOutput& output, const BenchParams& params
       spriteIndex = 0;
   }
 }
+
+void BenchFog::runBlitImageProject(BenchOutput& output, const BenchParams& params)
+{
+  Fog::Painter p(screen, Fog::NO_FLAGS);
+  configurePainter(p, params);
+
+  float shapeSize = (float)params.shapeSize;
+  float angle = 0.0f;
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t spriteIndex = 0;
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++, angle += 0.01f)
+  {
+    Fog::PointI pt(rPts.getPointI(screenSize));
+    Fog::RectF rect((float)pt.x, (float)pt.y, shapeSize, shapeSize);
+
+    // The angle is kept in [-1.2, 1.2] so the quad never degenerates.
+    Fog::PointF quad[4];
+    app.getProjectedQuad(quad, rect, Fog::Math::sin(angle) * 1.2f);
+
+    p.setTransform(Fog::TransformF::fromQuadToQuad(quad[0], quad[1], quad[2], quad[3], rect));
+    p.blitImage(pt, sprites[spriteIndex]);
+
+    if (++spriteIndex >= spritesLength)
+      spriteIndex = 0;
+  }
+}
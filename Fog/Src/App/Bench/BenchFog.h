@@ -25,6 +25,7 @@ struct BenchFog : public BenchModule
 
   virtual Fog::StringW getModuleName() const;
   virtual Fog::List<uint32_t> getSupportedPixelFormats() const;
+  virtual bool hasBenchType(uint32_t type) const;
 
   virtual void bench(BenchOutput& output, const BenchParams& params);
 
@@ -52,6 +53,7 @@ struct BenchFog : public BenchModule
   virtual void runBlitImageI(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageF(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageRotate(BenchOutput& output, const BenchParams& params);
+  virtual void runBlitImageProject(BenchOutput& output, const BenchParams& params);
 
   // --------------------------------------------------------------------------
   // [Members]
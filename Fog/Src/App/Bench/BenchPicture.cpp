@@ -0,0 +1,118 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include "BenchPicture.h"
+
+// ============================================================================
+// [BenchPicture - Helpers]
+// ============================================================================
+
+static const struct BenchPictureCase
+{
+  const char* name;
+  uint32_t op;
+  float opacity;
+} benchPictureCases[] =
+{
+  { "SrcOver"     , Fog::COMPOSITE_SRC_OVER, 1.0f },
+  { "SrcOver 0.5" , Fog::COMPOSITE_SRC_OVER, 0.5f },
+  { "SrcAtop"     , Fog::COMPOSITE_SRC_ATOP, 1.0f },
+  { "Xor 0.5"     , Fog::COMPOSITE_XOR     , 0.5f }
+};
+
+// ============================================================================
+// [BenchPicture - Construction / Destruction]
+// ============================================================================
+
+BenchPicture::BenchPicture(BenchApp& app) :
+  app(app),
+  screenSize(600, 600)
+{
+}
+
+BenchPicture::~BenchPicture()
+{
+}
+
+// ============================================================================
+// [BenchPicture - Run]
+// ============================================================================
+
+void BenchPicture::run()
+{
+  if (imageBox.create(screenSize, Fog::IMAGE_FORMAT_PRGB32) != Fog::ERR_OK ||
+      imageRegion.create(screenSize, Fog::IMAGE_FORMAT_PRGB32) != Fog::ERR_OK)
+  {
+    app.logf("Picture: Out of memory\n\n");
+    return;
+  }
+
+  // Record overlapping shapes, so painting each shape with the opacity is
+  // not the same as painting the whole picture with the opacity.
+  Fog::Picture picture;
+  {
+    Fog::Painter p(imageBox, Fog::NO_FLAGS);
+    p.beginPicture();
+    p.setSource(Fog::Argb32(0xFFFF0000));
+    p.fillRect(Fog::RectI(100, 100, 200, 200));
+    p.setSource(Fog::Argb32(0xC00000FF));
+    p.fillCircle(Fog::CircleF(300.0f, 300.0f, 120.0f));
+    p.endPicture(picture);
+    p.end();
+  }
+
+  // The box contains the whole picture, the region too, but it's not a box.
+  Fog::Region boxRegion(Fog::BoxI(0, 0, screenSize.w, screenSize.h));
+  Fog::Region lRegion(Fog::BoxI(0, 0, screenSize.w, 450));
+  lRegion.union_(Fog::BoxI(0, 450, 450, screenSize.h));
+
+  app.logf("Picture - PaintPicture (box vs. region clip)\n");
+  app.logf("Operator    |MaxDiff|Result\n");
+
+  for (size_t c = 0; c < FOG_ARRAY_SIZE(benchPictureCases); c++)
+  {
+    const BenchPictureCase& pc = benchPictureCases[c];
+
+    paintPicture(imageBox, picture, boxRegion, pc.op, pc.opacity);
+    paintPicture(imageRegion, picture, lRegion, pc.op, pc.opacity);
+
+    int maxDiff = 0;
+    const uint8_t* pBox = imageBox.getFirst();
+    const uint8_t* pRegion = imageRegion.getFirst();
+
+    for (int y = 0; y < screenSize.h; y++, pBox += imageBox.getStride(), pRegion += imageRegion.getStride())
+    {
+      for (int x = 0; x < screenSize.w * 4; x++)
+      {
+        int d = (int)pBox[x] - (int)pRegion[x];
+        if (d < 0) d = -d;
+        if (d > maxDiff) maxDiff = d;
+      }
+    }
+
+    app.logf("%-12s|%7d|%s\n", pc.name, maxDiff, maxDiff == 0 ? "Ok" : "Failed");
+  }
+
+  app.logf("\n");
+}
+
+void BenchPicture::paintPicture(Fog::Image& image, const Fog::Picture& picture,
+  const Fog::Region& region, uint32_t op, float opacity)
+{
+  // Semi-transparent background, so the compositing operator matters.
+  Fog::Painter p(image, Fog::NO_FLAGS);
+  p.setCompositingOperator(Fog::COMPOSITE_SRC);
+  p.setSource(Fog::Argb32(0x8000C000));
+  p.fillAll();
+
+  // The meta region is used, because it's the only region clip supported by
+  // the raster paint engine. A region of one box is clipped as a box.
+  p.setMetaParams(region, Fog::PointI(0, 0));
+  p.setCompositingOperator(op);
+  p.setOpacity(opacity);
+  p.paintPicture(picture);
+  p.end();
+}
@@ -0,0 +1,53 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_BENCHPICTURE_H
+#define _FOG_BENCHPICTURE_H
+
+// [Dependencies]
+#include "BenchApp.h"
+
+// ============================================================================
+// [BenchPicture]
+// ============================================================================
+
+//! @brief Picture replay test.
+//!
+//! Paints the same picture clipped by a box and by a region, both containing
+//! the whole picture, under various compositing operators and opacities. The
+//! box clip can replay the picture directly while the region clip always
+//! composites it as a layer, so both outputs must be the same.
+struct BenchPicture
+{
+  BenchPicture(BenchApp& app);
+  ~BenchPicture();
+
+  // --------------------------------------------------------------------------
+  // [Run]
+  // --------------------------------------------------------------------------
+
+  void run();
+
+  //! @brief Paint @a picture into @a image clipped by @a region (used as the
+  //! meta region) using the compositing operator @a op and @a opacity.
+  void paintPicture(Fog::Image& image, const Fog::Picture& picture,
+    const Fog::Region& region, uint32_t op, float opacity);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  BenchApp& app;
+
+  //! @brief Size of images used to paint into.
+  Fog::SizeI screenSize;
+
+  Fog::Image imageBox;
+  Fog::Image imageRegion;
+};
+
+// [Guard]
+#endif // _FOG_BENCHPICTURE_H
@@ -43,6 +43,11 @@ Fog::List<uint32_t> BenchQt4::getSupportedPixelFormats() const
   return list;
 }
 
+bool BenchQt4::hasBenchType(uint32_t type) const
+{
+  return true;
+}
+
 static uint32_t BenchQt4_getQtFormat(uint32_t format)
 {
   switch (format)
@@ -66,6 +71,7 @@ void BenchQt4::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_IMAGE_PROJECT:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -123,6 +129,10 @@ void BenchQt4::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_IMAGE_PROJECT:
+      runBlitImageProject(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -535,5 +545,50 @@ void BenchQt4::runBlitImageRotate(BenchOutput& output, const BenchParams& params
   }
 }
 
+void BenchQt4::runBlitImageProject(BenchOutput& output, const BenchParams& params)
+{
+  QPainter p(screenQt);
+  configurePainter(p, params);
+
+  float shapeSize = (float)params.shapeSize;
+  float angle = 0.0f;
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t spriteIndex = 0;
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++, angle += 0.01f)
+  {
+    Fog::PointI pt(rPts.getPointI(screenSize));
+    Fog::RectF rect((float)pt.x, (float)pt.y, shapeSize, shapeSize);
+
+    // The angle is kept in [-1.2, 1.2] so the quad never degenerates.
+    Fog::PointF quad[4];
+    app.getProjectedQuad(quad, rect, Fog::Math::sin(angle) * 1.2f);
+
+    QPolygonF src(QRectF(rect.x, rect.y, rect.w, rect.h));
+    QPolygonF dst;
+
+    src.pop_back();
+    for (int j = 0; j < 4; j++)
+      dst.append(QPointF(quad[j].x, quad[j].y));
+
+    QTransform transform;
+    QTransform::quadToQuad(src, dst, transform);
+
+    p.setTransform(transform, false);
+    p.drawImage(QPoint(pt.x, pt.y), *spritesQt[spriteIndex]);
+
+    if (++spriteIndex >= spritesLength)
+      spriteIndex = 0;
+  }
+}
+
 // [Guard]
 #endif // FOG_BENCH_QT4
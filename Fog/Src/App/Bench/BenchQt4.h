@@ -29,6 +29,7 @@ struct BenchQt4 : public BenchModule
 
   virtual Fog::StringW getModuleName() const;
   virtual Fog::List<uint32_t> getSupportedPixelFormats() const;
+  virtual bool hasBenchType(uint32_t type) const;
 
   virtual void bench(BenchOutput& output, const BenchParams& params);
 
@@ -58,6 +59,7 @@ struct BenchQt4 : public BenchModule
   virtual void runBlitImageI(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageF(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageRotate(BenchOutput& output, const BenchParams& params);
+  virtual void runBlitImageProject(BenchOutput& output, const BenchParams& params);
 
   // --------------------------------------------------------------------------
   // [Members]
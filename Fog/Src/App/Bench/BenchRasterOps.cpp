@@ -0,0 +1,338 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include "BenchRasterOps.h"
+
+// The generic C implementation is header-only, so the benchmark can
+// instantiate it directly and compare it with functions in the raster API.
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/CompositeExt_p.h>
+
+// ============================================================================
+// [BenchRasterOps - Helpers]
+// ============================================================================
+
+typedef void (FOG_FASTCALL *BenchVBlitLineFunc)(
+  uint8_t* dst, const uint8_t* src, int w, const Fog::RasterClosure* closure);
+
+typedef void (FOG_FASTCALL *BenchCBlitLineFunc)(
+  uint8_t* dst, const Fog::RasterSolid* src, int w, const Fog::RasterClosure* closure);
+
+enum BENCH_RASTER_CASE
+{
+  BENCH_RASTER_CASE_PRGB32_VBLIT_PRGB32 = 0,
+  BENCH_RASTER_CASE_PRGB32_VBLIT_XRGB32 = 1,
+  BENCH_RASTER_CASE_PRGB32_VBLIT_RGB24 = 2,
+  BENCH_RASTER_CASE_PRGB32_VBLIT_A8 = 3,
+  BENCH_RASTER_CASE_XRGB32_VBLIT_PRGB32 = 4,
+  BENCH_RASTER_CASE_XRGB32_VBLIT_XRGB32 = 5,
+  BENCH_RASTER_CASE_XRGB32_VBLIT_RGB24 = 6,
+  BENCH_RASTER_CASE_PRGB32_CBLIT_PRGB32 = 7,
+  BENCH_RASTER_CASE_XRGB32_CBLIT_XRGB32 = 8,
+
+  BENCH_RASTER_CASE_VBLIT_COUNT = 7,
+  BENCH_RASTER_CASE_COUNT = 9
+};
+
+struct BenchRasterCase
+{
+  const char* name;
+  uint32_t dstFormat;
+  uint32_t srcFormat;
+  uint32_t id;
+};
+
+static const BenchRasterCase benchRasterCases[BENCH_RASTER_CASE_COUNT] =
+{
+  { "P<-P"    , Fog::IMAGE_FORMAT_PRGB32, Fog::IMAGE_FORMAT_PRGB32, Fog::RASTER_VBLIT_PRGB32_AND_PRGB32 },
+  { "P<-X"    , Fog::IMAGE_FORMAT_PRGB32, Fog::IMAGE_FORMAT_XRGB32, Fog::RASTER_VBLIT_PRGB32_AND_XRGB32 },
+  { "P<-RGB"  , Fog::IMAGE_FORMAT_PRGB32, Fog::IMAGE_FORMAT_RGB24 , Fog::RASTER_VBLIT_PRGB32_AND_RGB24  },
+  { "P<-A8"   , Fog::IMAGE_FORMAT_PRGB32, Fog::IMAGE_FORMAT_A8    , Fog::RASTER_VBLIT_PRGB32_AND_A8     },
+  { "X<-P"    , Fog::IMAGE_FORMAT_XRGB32, Fog::IMAGE_FORMAT_PRGB32, Fog::RASTER_VBLIT_XRGB32_AND_PRGB32 },
+  { "X<-X"    , Fog::IMAGE_FORMAT_XRGB32, Fog::IMAGE_FORMAT_XRGB32, Fog::RASTER_VBLIT_XRGB32_AND_XRGB32 },
+  { "X<-RGB"  , Fog::IMAGE_FORMAT_XRGB32, Fog::IMAGE_FORMAT_RGB24 , Fog::RASTER_VBLIT_XRGB32_AND_RGB24  },
+  { "P<-Solid", Fog::IMAGE_FORMAT_PRGB32, Fog::IMAGE_FORMAT_PRGB32, Fog::RASTER_CBLIT_PRGB              },
+  { "X<-Solid", Fog::IMAGE_FORMAT_XRGB32, Fog::IMAGE_FORMAT_XRGB32, Fog::RASTER_CBLIT_XRGB              }
+};
+
+struct BenchCompositeExtOp
+{
+  const char* name;
+  uint32_t op;
+
+  BenchVBlitLineFunc vblit[BENCH_RASTER_CASE_VBLIT_COUNT];
+  BenchCBlitLineFunc cblit[2];
+};
+
+#define BENCH_COMPOSITE_EXT_OP(_Id_, _Name_) \
+  { \
+    #_Name_, Fog::RASTER_COMPOSITE_EXT_##_Id_, \
+    { \
+      Fog::RasterOps_C::Composite##_Name_::prgb32_vblit_prgb32_line, \
+      Fog::RasterOps_C::Composite##_Name_::prgb32_vblit_xrgb32_line, \
+      Fog::RasterOps_C::Composite##_Name_::prgb32_vblit_rgb24_line, \
+      Fog::RasterOps_C::Composite##_Name_::prgb32_vblit_a8_line, \
+      Fog::RasterOps_C::Composite##_Name_::xrgb32_vblit_prgb32_line, \
+      Fog::RasterOps_C::Composite##_Name_::xrgb32_vblit_xrgb32_line, \
+      Fog::RasterOps_C::Composite##_Name_::xrgb32_vblit_rgb24_line \
+    }, \
+    { \
+      Fog::RasterOps_C::Composite##_Name_::prgb32_cblit_prgb32_line, \
+      Fog::RasterOps_C::Composite##_Name_::xrgb32_cblit_xrgb32_line \
+    } \
+  }
+
+static const BenchCompositeExtOp benchCompositeExtOps[] =
+{
+  BENCH_COMPOSITE_EXT_OP(PLUS       , Plus      ),
+  BENCH_COMPOSITE_EXT_OP(MINUS      , Minus     ),
+  BENCH_COMPOSITE_EXT_OP(MULTIPLY   , Multiply  ),
+  BENCH_COMPOSITE_EXT_OP(SCREEN     , Screen    ),
+  BENCH_COMPOSITE_EXT_OP(OVERLAY    , Overlay   ),
+  BENCH_COMPOSITE_EXT_OP(DARKEN     , Darken    ),
+  BENCH_COMPOSITE_EXT_OP(LIGHTEN    , Lighten   ),
+  BENCH_COMPOSITE_EXT_OP(COLOR_DODGE, ColorDodge),
+  BENCH_COMPOSITE_EXT_OP(COLOR_BURN , ColorBurn ),
+  BENCH_COMPOSITE_EXT_OP(HARD_LIGHT , HardLight ),
+  BENCH_COMPOSITE_EXT_OP(SOFT_LIGHT , SoftLight ),
+  BENCH_COMPOSITE_EXT_OP(DIFFERENCE , Difference),
+  BENCH_COMPOSITE_EXT_OP(EXCLUSION  , Exclusion )
+};
+
+#undef BENCH_COMPOSITE_EXT_OP
+
+static uint32_t benchMakePRGB32(uint32_t r)
+{
+  uint32_t a = r >> 24;
+  uint32_t c = r & 0x00FFFFFF;
+
+  // Make some pixels fully opaque / transparent, they are special-cased by
+  // most of the compositing operators.
+  if ((c & 0x7) == 0) a = 0xFF;
+  if ((c & 0x7) == 1) a = 0x00;
+
+  return (a << 24) |
+         (((((c >> 16) & 0xFF) * a) / 255) << 16) |
+         (((((c >>  8) & 0xFF) * a) / 255) <<  8) |
+         (((((c      ) & 0xFF) * a) / 255)      );
+}
+
+// ============================================================================
+// [BenchRasterOps - Construction / Destruction]
+// ============================================================================
+
+BenchRasterOps::BenchRasterOps(BenchApp& app) :
+  app(app),
+  width(1024),
+  lines(256),
+  dstOrig(NULL),
+  dstC(NULL),
+  dstOpt(NULL),
+  src(NULL)
+{
+}
+
+BenchRasterOps::~BenchRasterOps()
+{
+  freeData();
+}
+
+// ============================================================================
+// [BenchRasterOps - Run]
+// ============================================================================
+
+void BenchRasterOps::run()
+{
+  prepareData();
+
+  if (dstOrig == NULL)
+  {
+    app.logf("RasterOps: Out of memory\n\n");
+    return;
+  }
+
+  runCompositeExt();
+  freeData();
+}
+
+void BenchRasterOps::runCompositeExt()
+{
+  size_t stride = (size_t)width * 4;
+  size_t bufferSize = stride * (size_t)lines;
+
+  // Keep the number of processed pixels close to the quantity used by the
+  // painter tests (quantity of 128x128 shapes).
+  uint32_t rounds = Fog::Math::max<uint32_t>(
+    (uint32_t)(((uint64_t)app.quantity * 128 * 128) / ((uint64_t)width * lines) / 16), 1);
+
+  Fog::RasterClosure closure;
+  Fog::MemOps::zero(&closure, sizeof(closure));
+
+  Fog::RasterSolid solid;
+
+  app.logf("RasterOps - CompositeExt (C vs. optimized, %dx%d, %u rounds)\n", width, lines, rounds);
+  app.logf("Operator   ");
+  for (uint32_t c = 0; c < BENCH_RASTER_CASE_COUNT; c++)
+    app.logf("|%9s", benchRasterCases[c].name);
+  app.logf("| C [ms]| Opt[ms]|MaxDiff\n");
+
+  Fog::TimeDelta totalC(0);
+  Fog::TimeDelta totalOpt(0);
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(benchCompositeExtOps); i++)
+  {
+    const BenchCompositeExtOp& op = benchCompositeExtOps[i];
+
+    Fog::TimeDelta opC(0);
+    Fog::TimeDelta opOpt(0);
+    int maxDiff = 0;
+
+    app.logf("%-11s", op.name);
+
+    for (uint32_t c = 0; c < BENCH_RASTER_CASE_COUNT; c++)
+    {
+      const BenchRasterCase& rc = benchRasterCases[c];
+      const Fog::RasterCompositeExtFuncs& funcs = Fog::_api_raster.compositeExt[rc.dstFormat][op.op];
+
+      BenchVBlitLineFunc vblitC = NULL;
+      BenchVBlitLineFunc vblitOpt = NULL;
+      BenchCBlitLineFunc cblitC = NULL;
+      BenchCBlitLineFunc cblitOpt = NULL;
+
+      if (c < BENCH_RASTER_CASE_VBLIT_COUNT)
+      {
+        vblitC = op.vblit[c];
+        vblitOpt = funcs.vblit_line[rc.id];
+      }
+      else
+      {
+        cblitC = op.cblit[c - BENCH_RASTER_CASE_VBLIT_COUNT];
+        cblitOpt = funcs.cblit_line[rc.id];
+      }
+
+      Fog::TimeDelta tC(0);
+      Fog::TimeDelta tOpt(0);
+
+      for (uint32_t r = 0; r < rounds; r++)
+      {
+        Fog::MemOps::copy(dstC, dstOrig, bufferSize);
+        Fog::MemOps::copy(dstOpt, dstOrig, bufferSize);
+
+        if (rc.dstFormat == Fog::IMAGE_FORMAT_XRGB32)
+        {
+          for (size_t p = 0; p < bufferSize; p += 4)
+          {
+            dstC[p + 3] = 0xFF;
+            dstOpt[p + 3] = 0xFF;
+          }
+        }
+
+        solid.prgb32.u32 = benchMakePRGB32(app.randomData[r % app.randomSize]);
+        if (rc.id == Fog::RASTER_CBLIT_XRGB)
+          solid.prgb32.u32 |= 0xFF000000;
+
+        Fog::Time start(Fog::Time::now());
+        for (int y = 0; y < lines; y++)
+        {
+          uint8_t* dp = dstC + (size_t)y * stride;
+          const uint8_t* sp = src + (size_t)y * stride;
+
+          if (vblitC) vblitC(dp, sp, width, &closure); else cblitC(dp, &solid, width, &closure);
+        }
+        tC += Fog::Time::now() - start;
+
+        start = Fog::Time::now();
+        for (int y = 0; y < lines; y++)
+        {
+          uint8_t* dp = dstOpt + (size_t)y * stride;
+          const uint8_t* sp = src + (size_t)y * stride;
+
+          if (vblitOpt) vblitOpt(dp, sp, width, &closure); else cblitOpt(dp, &solid, width, &closure);
+        }
+        tOpt += Fog::Time::now() - start;
+
+        // Alpha of XRGB32 destination is undefined.
+        for (size_t p = 0; p < bufferSize; p++)
+        {
+          if (rc.dstFormat == Fog::IMAGE_FORMAT_XRGB32 && (p & 3) == 3)
+            continue;
+
+          int d = (int)dstC[p] - (int)dstOpt[p];
+          if (d < 0) d = -d;
+          if (d > maxDiff) maxDiff = d;
+        }
+      }
+
+      // Speedup of the optimized version, in percents.
+      uint32_t ratio = tOpt.getMicroseconds() > 0
+        ? (uint32_t)((tC.getMicroseconds() * 100) / tOpt.getMicroseconds())
+        : 0;
+      app.logf("|%5u.%02ux", ratio / 100, ratio % 100);
+
+      opC += tC;
+      opOpt += tOpt;
+    }
+
+    app.logf("|%7u|%8u|%7d\n",
+      (uint)opC.getMilliseconds(),
+      (uint)opOpt.getMilliseconds(), maxDiff);
+
+    totalC += opC;
+    totalOpt += opOpt;
+  }
+
+  app.logf("Total      ");
+  for (uint32_t c = 0; c < BENCH_RASTER_CASE_COUNT; c++)
+    app.logf("|%9s", "");
+  app.logf("|%7u|%8u|\n\n",
+    (uint)totalC.getMilliseconds(),
+    (uint)totalOpt.getMilliseconds());
+}
+
+// ============================================================================
+// [BenchRasterOps - Data]
+// ============================================================================
+
+void BenchRasterOps::prepareData()
+{
+  size_t bufferSize = (size_t)width * (size_t)lines * 4;
+
+  dstOrig = reinterpret_cast<uint8_t*>(Fog::MemMgr::alloc(bufferSize));
+  dstC    = reinterpret_cast<uint8_t*>(Fog::MemMgr::alloc(bufferSize));
+  dstOpt  = reinterpret_cast<uint8_t*>(Fog::MemMgr::alloc(bufferSize));
+  src     = reinterpret_cast<uint8_t*>(Fog::MemMgr::alloc(bufferSize));
+
+  if (dstOrig == NULL || dstC == NULL || dstOpt == NULL || src == NULL)
+  {
+    freeData();
+    return;
+  }
+
+  // Source data are used by all source formats (RGB24 and A8 read only part
+  // of the line), the pixels are valid PRGB32 so the PRGB32 source is fine.
+  uint32_t* dp = reinterpret_cast<uint32_t*>(dstOrig);
+  uint32_t* sp = reinterpret_cast<uint32_t*>(src);
+
+  size_t count = bufferSize / 4;
+  size_t rnd = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    dp[i] = benchMakePRGB32(app.randomData[rnd]);
+    if (++rnd == app.randomSize) rnd = 0;
+
+    sp[i] = benchMakePRGB32(app.randomData[rnd]);
+    if (++rnd == app.randomSize) rnd = 0;
+  }
+}
+
+void BenchRasterOps::freeData()
+{
+  if (dstOrig) { Fog::MemMgr::free(dstOrig); dstOrig = NULL; }
+  if (dstC   ) { Fog::MemMgr::free(dstC   ); dstC    = NULL; }
+  if (dstOpt ) { Fog::MemMgr::free(dstOpt ); dstOpt  = NULL; }
+  if (src    ) { Fog::MemMgr::free(src    ); src     = NULL; }
+}
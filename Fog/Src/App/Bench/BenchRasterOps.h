@@ -0,0 +1,60 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_BENCHRASTEROPS_H
+#define _FOG_BENCHRASTEROPS_H
+
+// [Dependencies]
+#include "BenchApp.h"
+
+// ============================================================================
+// [BenchRasterOps]
+// ============================================================================
+
+//! @brief Low-level raster-ops benchmark.
+//!
+//! Compares the optimized compositing functions registered in the raster API
+//! (SSE2 when available) against the generic C implementation. Both versions
+//! are run on the same data and the maximum difference is reported together
+//! with the timing, so a wrong kernel is as visible as a slow one.
+struct BenchRasterOps
+{
+  BenchRasterOps(BenchApp& app);
+  ~BenchRasterOps();
+
+  // --------------------------------------------------------------------------
+  // [Run]
+  // --------------------------------------------------------------------------
+
+  void run();
+  void runCompositeExt();
+
+  // --------------------------------------------------------------------------
+  // [Data]
+  // --------------------------------------------------------------------------
+
+  void prepareData();
+  void freeData();
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  BenchApp& app;
+
+  //! @brief Line width in pixels.
+  int width;
+  //! @brief Count of lines processed per test.
+  int lines;
+
+  uint8_t* dstOrig;
+  uint8_t* dstC;
+  uint8_t* dstOpt;
+  uint8_t* src;
+};
+
+// [Guard]
+#endif // _FOG_BENCHRASTEROPS_H
@@ -0,0 +1,200 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include "BenchRasterizer.h"
+
+// ============================================================================
+// [BenchRasterizer - Helpers]
+// ============================================================================
+
+static const int benchRasterizerSizes[] = { 32, 64, 128, 256, 512 };
+static const uint32_t benchRasterizerVertices[] = { 8, 16, 32, 64, 128, 256, 512 };
+
+enum { BENCH_RASTERIZER_MAX_VERTICES = 512 };
+
+// Lines of both majors and directions, the steep down-left line is the case where the y-major
+// hairline segment has x0 greater than x1.
+static const struct BenchRasterizerLine
+{
+  const char* name;
+  float x0, y0, x1, y1;
+} benchRasterizerLines[] =
+{
+  { "Right"           , 100.5f, 300.5f, 500.5f, 350.5f },
+  { "Left"            , 500.5f, 300.5f, 100.5f, 350.5f },
+  { "Steep down-right", 300.5f, 100.5f, 350.5f, 500.5f },
+  { "Steep down-left" , 350.5f, 100.5f, 300.5f, 500.5f },
+  { "Steep up-right"  , 300.5f, 500.5f, 350.5f, 100.5f },
+  { "Steep up-left"   , 350.5f, 500.5f, 300.5f, 100.5f }
+};
+
+// ============================================================================
+// [BenchRasterizer - Construction / Destruction]
+// ============================================================================
+
+BenchRasterizer::BenchRasterizer(BenchApp& app) :
+  app(app),
+  screenSize(600, 600)
+{
+}
+
+BenchRasterizer::~BenchRasterizer()
+{
+}
+
+// ============================================================================
+// [BenchRasterizer - Run]
+// ============================================================================
+
+void BenchRasterizer::run()
+{
+  if (imageCell.create(screenSize, Fog::IMAGE_FORMAT_PRGB32) != Fog::ERR_OK ||
+      imageDense.create(screenSize, Fog::IMAGE_FORMAT_PRGB32) != Fog::ERR_OK)
+  {
+    app.logf("Rasterizer: Out of memory\n\n");
+    return;
+  }
+
+  app.logf("Rasterizer - FillPolygon (cell vs. dense, time in [ms])\n");
+  app.logf("Size|Vertices");
+  for (size_t v = 0; v < FOG_ARRAY_SIZE(benchRasterizerVertices); v++)
+    app.logf("|%11u", benchRasterizerVertices[v]);
+  app.logf("|Crossover|MaxDiff\n");
+
+  for (size_t s = 0; s < FOG_ARRAY_SIZE(benchRasterizerSizes); s++)
+  {
+    int size = benchRasterizerSizes[s];
+    uint32_t crossover = 0;
+    int maxDiff = 0;
+
+    app.logf("%4d|        ", size);
+
+    for (size_t v = 0; v < FOG_ARRAY_SIZE(benchRasterizerVertices); v++)
+    {
+      uint32_t vertices = benchRasterizerVertices[v];
+
+      // Keep the count of processed vertices and pixels close to the quantity
+      // used by the painter tests (quantity of 128x128 shapes of 10 vertices).
+      uint64_t work = (uint64_t)app.quantity * 10 * 128 * 128;
+      uint32_t count = (uint32_t)Fog::Math::max<uint64_t>(
+        work / ((uint64_t)vertices * (uint64_t)size * (uint64_t)size / 8 + 1) / 4, 16);
+
+      Fog::TimeDelta tCell = fillPolygons(imageCell, Fog::PATH_RASTERIZER_CELL, size, vertices, count);
+      Fog::TimeDelta tDense = fillPolygons(imageDense, Fog::PATH_RASTERIZER_DENSE, size, vertices, count);
+
+      app.logf("|%5u/%5u",
+        (uint)tCell.getMilliseconds(),
+        (uint)tDense.getMilliseconds());
+
+      if (crossover == 0 && tDense < tCell)
+        crossover = vertices;
+
+      // Both rasterizers calculate the same coverage, only rounding may differ.
+      const uint8_t* pCell = imageCell.getFirst();
+      const uint8_t* pDense = imageDense.getFirst();
+
+      for (int y = 0; y < screenSize.h; y++, pCell += imageCell.getStride(), pDense += imageDense.getStride())
+      {
+        for (int x = 0; x < screenSize.w * 4; x++)
+        {
+          int d = (int)pCell[x] - (int)pDense[x];
+          if (d < 0) d = -d;
+          if (d > maxDiff) maxDiff = d;
+        }
+      }
+    }
+
+    if (crossover != 0)
+      app.logf("|%9u|%7d\n", crossover, maxDiff);
+    else
+      app.logf("|%9s|%7d\n", "none", maxDiff);
+  }
+
+  app.logf("\n");
+
+  app.logf("Rasterizer - DrawLine (stroked vs. hairline, coverage in [px])\n");
+  app.logf("Direction       |Stroked|Hairline|Result\n");
+
+  for (size_t l = 0; l < FOG_ARRAY_SIZE(benchRasterizerLines); l++)
+  {
+    const BenchRasterizerLine& line = benchRasterizerLines[l];
+    Fog::LineF lineF(line.x0, line.y0, line.x1, line.y1);
+
+    // Both lines have the same length and width, so the coverage must match
+    // except of the caps which are ignored by the hairline renderer.
+    uint32_t stroked = drawLine(imageCell, false, lineF);
+    uint32_t hairline = drawLine(imageDense, true, lineF);
+
+    bool ok = hairline * 10 >= stroked * 9 && hairline * 10 <= stroked * 11;
+    app.logf("%-16s|%7u|%8u|%s\n", line.name, stroked, hairline, ok ? "Ok" : "Failed");
+  }
+
+  app.logf("\n");
+}
+
+Fog::TimeDelta BenchRasterizer::fillPolygons(Fog::Image& image, uint32_t rasterizer,
+  int size, uint32_t vertices, uint32_t count)
+{
+  Fog::PointF points[BENCH_RASTERIZER_MAX_VERTICES];
+  FOG_ASSERT(vertices <= FOG_ARRAY_SIZE(points));
+
+  // The same sequence of random numbers is used by both rasterizers.
+  BenchRandom rPts(app);
+  BenchRandom rArgb(app);
+
+  Fog::SizeI polyScreen(screenSize.w - size, screenSize.h - size);
+  float polySize = (float)size;
+
+  Fog::Painter p(image, Fog::NO_FLAGS);
+  p.setSource(Fog::Argb32(0xFF000000));
+  p.fillAll();
+  p.setPathRasterizerHint(rasterizer);
+  p.flush(Fog::PAINTER_FLUSH_SYNC);
+
+  Fog::Time start(Fog::Time::now());
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    Fog::PointF base(rPts.getPointF(polyScreen));
+
+    for (uint32_t j = 0; j < vertices; j++)
+    {
+      float x = rPts.getFloat(base.x, base.x + polySize);
+      float y = rPts.getFloat(base.y, base.y + polySize);
+      points[j].set(x, y);
+    }
+
+    p.setSource(rArgb.getArgb32());
+    p.fillPolygon(points, vertices);
+  }
+
+  p.end();
+  return Fog::Time::now() - start;
+}
+
+uint32_t BenchRasterizer::drawLine(Fog::Image& image, bool fastLine, const Fog::LineF& line)
+{
+  Fog::Painter p(image, Fog::NO_FLAGS);
+  p.setSource(Fog::Argb32(0xFF000000));
+  p.fillAll();
+  p.setFastLineHint(fastLine);
+  p.setLineWidth(1.0f);
+  p.setSource(Fog::Argb32(0xFFFFFFFF));
+  p.drawLine(line);
+  p.end();
+
+  // Sum of the blue component of all pixels scaled to pixel units.
+  uint32_t coverage = 0;
+  const uint8_t* pixels = image.getFirst();
+
+  for (int y = 0; y < screenSize.h; y++, pixels += image.getStride())
+  {
+    for (int x = 0; x < screenSize.w; x++)
+      coverage += pixels[x * 4 + Fog::PIXEL_ARGB32_POS_B];
+  }
+
+  return (coverage + 127) / 255;
+}
@@ -0,0 +1,61 @@
+// [Fog-Bench]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_BENCHRASTERIZER_H
+#define _FOG_BENCHRASTERIZER_H
+
+// [Dependencies]
+#include "BenchApp.h"
+
+// ============================================================================
+// [BenchRasterizer]
+// ============================================================================
+
+//! @brief Path rasterizer benchmark.
+//!
+//! Fills random polygons of various sizes and vertex counts using the cell
+//! and the dense path rasterizer (forced by @c Fog::PATH_RASTERIZER hint) and
+//! reports the vertex count where the dense rasterizer becomes faster, which
+//! is used to tune the RASTER_DENSE_* thresholds. Both outputs are compared,
+//! so a wrong rasterizer is as visible as a slow one.
+//!
+//! Lines in all directions are drawn also by the stroker and by the hairline
+//! renderer (@c fastLine hint) to check that no direction is clipped.
+struct BenchRasterizer
+{
+  BenchRasterizer(BenchApp& app);
+  ~BenchRasterizer();
+
+  // --------------------------------------------------------------------------
+  // [Run]
+  // --------------------------------------------------------------------------
+
+  void run();
+
+  //! @brief Fill @a count polygons of @a vertices vertices and @a size size
+  //! into @a image using the @a rasterizer hint, returns the time spent.
+  Fog::TimeDelta fillPolygons(Fog::Image& image, uint32_t rasterizer,
+    int size, uint32_t vertices, uint32_t count);
+
+  //! @brief Draw a one pixel wide @a line into @a image, using the hairline
+  //! renderer if @a fastLine is true, returns the covered area in pixels.
+  uint32_t drawLine(Fog::Image& image, bool fastLine, const Fog::LineF& line);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  BenchApp& app;
+
+  //! @brief Size of images used to paint into.
+  Fog::SizeI screenSize;
+
+  Fog::Image imageCell;
+  Fog::Image imageDense;
+};
+
+// [Guard]
+#endif // _FOG_BENCHRASTERIZER_H
@@ -0,0 +1,582 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_CORE_ACC_ACCAVX2_H
+#define _FOG_CORE_ACC_ACCAVX2_H
+
+// [Dependencies]
+#include <Fog/Core/C++/Base.h>
+#include <Fog/Core/C++/IntrinAvx2.h>
+
+#include <Fog/Core/Acc/AccSse2.h>
+#include <Fog/Core/Math/Constants.h>
+#include <Fog/Core/Math/Math.h>
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Constants]
+// ============================================================================
+
+FOG_YMM_DECLARE_CONST_PI16_SET(m256i_0080, 0x0080);
+FOG_YMM_DECLARE_CONST_PI16_SET(m256i_0081, 0x0081);
+FOG_YMM_DECLARE_CONST_PI16_SET(m256i_00FF, 0x00FF);
+FOG_YMM_DECLARE_CONST_PI16_SET(m256i_0100, 0x0100);
+FOG_YMM_DECLARE_CONST_PI16_SET(m256i_0101, 0x0101);
+
+FOG_YMM_DECLARE_CONST_PI32_VAR(m256i_76543210, 7, 6, 5, 4, 3, 2, 1, 0);
+
+namespace Fog {
+namespace Acc {
+
+//! @addtogroup Fog_Core_Acc_Avx2
+//! @{
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Load]
+// ============================================================================
+
+template<typename SrcT>
+static FOG_INLINE void m256iLoad32a(__m256i& dst0, const SrcT* srcp)
+{
+  dst0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(srcp));
+}
+
+template<typename SrcT>
+static FOG_INLINE void m256iLoad32u(__m256i& dst0, const SrcT* srcp)
+{
+  dst0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcp));
+}
+
+//! @brief Load DWORDs selected by @a msk0 (the MSB of each DWORD), the others
+//! are zeroed. Masked-out DWORDs are never touched so it's safe to use it at
+//! the end of a scanline.
+template<typename SrcT>
+static FOG_INLINE void m256iLoadMaskPI32(__m256i& dst0, const SrcT* srcp, const __m256i& msk0)
+{
+  dst0 = _mm256_maskload_epi32(reinterpret_cast<const int*>(srcp), msk0);
+}
+
+//! @brief Load 8 bytes and zero-extend them to 8 DWORDs.
+template<typename SrcT>
+static FOG_INLINE void m256iLoad8ExtendPI32FromPI8(__m256i& dst0, const SrcT* srcp)
+{
+  dst0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(srcp)));
+}
+
+//! @brief Load 8 WORDs and zero-extend them to 8 DWORDs.
+template<typename SrcT>
+static FOG_INLINE void m256iLoad16ExtendPI32FromPI16(__m256i& dst0, const SrcT* srcp)
+{
+  dst0 = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(srcp)));
+}
+
+//! @brief Load @a count (0-8) bytes and zero-extend them to 8 DWORDs, the
+//! bytes after @a count are never read.
+template<typename SrcT>
+static FOG_INLINE void m256iLoad8ExtendPI32FromPI8Partial(__m256i& dst0, const SrcT* srcp, int count)
+{
+  FOG_ALIGNED_VAR(uint8_t, buf[8], 8) = { 0 };
+  ::memcpy(buf, srcp, (size_t)(uint)count);
+  m256iLoad8ExtendPI32FromPI8(dst0, buf);
+}
+
+//! @brief Load @a count (0-8) WORDs and zero-extend them to 8 DWORDs, the
+//! WORDs after @a count are never read.
+template<typename SrcT>
+static FOG_INLINE void m256iLoad16ExtendPI32FromPI16Partial(__m256i& dst0, const SrcT* srcp, int count)
+{
+  FOG_ALIGNED_VAR(uint16_t, buf[8], 16) = { 0 };
+  ::memcpy(buf, srcp, (size_t)(uint)count * 2);
+  m256iLoad16ExtendPI32FromPI16(dst0, buf);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Store]
+// ============================================================================
+
+template<typename DstT>
+static FOG_INLINE void m256iStore32a(DstT* dstp, const __m256i& x0)
+{
+  _mm256_store_si256(reinterpret_cast<__m256i*>(dstp), x0);
+}
+
+template<typename DstT>
+static FOG_INLINE void m256iStore32u(DstT* dstp, const __m256i& x0)
+{
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dstp), x0);
+}
+
+//! @brief Store DWORDs selected by @a msk0 (the MSB of each DWORD).
+template<typename DstT>
+static FOG_INLINE void m256iStoreMaskPI32(DstT* dstp, const __m256i& x0, const __m256i& msk0)
+{
+  _mm256_maskstore_epi32(reinterpret_cast<int*>(dstp), msk0, x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Mask]
+// ============================================================================
+
+//! @brief Create a DWORD mask where the first @a count DWORDs are set.
+static FOG_INLINE void m256iMaskFromCountPI32(__m256i& dst0, int count)
+{
+  dst0 = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), FOG_YMM_GET_CONST_PI(m256i_76543210));
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Cast]
+// ============================================================================
+
+static FOG_INLINE void m256iFromM128i(__m256i& dst0, const __m128i& lo, const __m128i& hi)
+{
+  dst0 = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static FOG_INLINE void m128iFromM256iLo(__m128i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_castsi256_si128(x0);
+}
+
+static FOG_INLINE void m128iFromM256iHi(__m128i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_extracti128_si256(x0, 1);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Expand]
+// ============================================================================
+
+static FOG_INLINE void m256iExpandPI16FromSI16(__m256i& dst0, int x0)
+{
+  dst0 = _mm256_set1_epi16((short)x0);
+}
+
+static FOG_INLINE void m256iExpandPI32FromSI32(__m256i& dst0, int x0)
+{
+  dst0 = _mm256_set1_epi32(x0);
+}
+
+static FOG_INLINE void m256iExpandPI32FromSI32(__m256i& dst0, const __m128i& x0)
+{
+  dst0 = _mm256_broadcastd_epi32(x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Unpack]
+// ============================================================================
+
+// NOTE: All unpack/pack instructions work within each 128-bit lane. The pair
+// UnpackLo/UnpackHi followed by Pack keeps the pixel order.
+
+static FOG_INLINE void m256iUnpackPI16FromPI8Lo(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_unpacklo_epi8(x0, _mm256_setzero_si256());
+}
+
+static FOG_INLINE void m256iUnpackPI16FromPI8Hi(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_unpackhi_epi8(x0, _mm256_setzero_si256());
+}
+
+static FOG_INLINE void m256iUnpackPI16FromPI8Lo(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_unpacklo_epi8(x0, y0);
+}
+
+static FOG_INLINE void m256iUnpackPI16FromPI8Hi(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_unpackhi_epi8(x0, y0);
+}
+
+static FOG_INLINE void m256iUnpackPI32FromPI16Lo(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_unpacklo_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iUnpackPI32FromPI16Hi(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_unpackhi_epi16(x0, y0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Pack]
+// ============================================================================
+
+static FOG_INLINE void m256iPackPU8FromPU16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_packus_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iPackPI16FromPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_packs_epi32(x0, y0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Shuffle]
+// ============================================================================
+
+//! @brief Byte shuffle within 128-bit lanes (PSHUFB).
+static FOG_INLINE void m256iShufflePI8(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_shuffle_epi8(x0, y0);
+}
+
+template<int Z, int Y, int X, int W>
+static FOG_INLINE void m256iShufflePI16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_shufflelo_epi16(x0, _MM_SHUFFLE(Z, Y, X, W));
+  dst0 = _mm256_shufflehi_epi16(dst0, _MM_SHUFFLE(Z, Y, X, W));
+}
+
+template<int Z, int Y, int X, int W>
+static FOG_INLINE void m256iShufflePI32(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_shuffle_epi32(x0, _MM_SHUFFLE(Z, Y, X, W));
+}
+
+//! @brief Full-width DWORD permutation (VPERMD).
+static FOG_INLINE void m256iPermutePI32(__m256i& dst0, const __m256i& x0, const __m256i& idx)
+{
+  dst0 = _mm256_permutevar8x32_epi32(x0, idx);
+}
+
+//! @brief Full-width QWORD permutation (VPERMQ).
+template<int Z, int Y, int X, int W>
+static FOG_INLINE void m256iPermutePI64(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_permute4x64_epi64(x0, _MM_SHUFFLE(Z, Y, X, W));
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Gather]
+// ============================================================================
+
+//! @brief Gather 8 DWORDs from @a base indexed by DWORDs in @a idx.
+static FOG_INLINE void m256iGatherPI32(__m256i& dst0, const uint32_t* base, const __m256i& idx)
+{
+  dst0 = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 4);
+}
+
+//! @brief Gather 8 DWORDs from @a base + byte offsets in @a idx.
+static FOG_INLINE void m256iGatherPI32Bytes(__m256i& dst0, const uint8_t* base, const __m256i& idx)
+{
+  dst0 = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 1);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Add / Sub]
+// ============================================================================
+
+static FOG_INLINE void m256iAddPI8(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_add_epi8(x0, y0);
+}
+
+static FOG_INLINE void m256iAddPI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_add_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iAddPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_add_epi32(x0, y0);
+}
+
+static FOG_INLINE void m256iSubPI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_sub_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iSubPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_sub_epi32(x0, y0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Mul]
+// ============================================================================
+
+static FOG_INLINE void m256iMulLoPI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_mullo_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iMulHiPU16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_mulhi_epu16(x0, y0);
+}
+
+static FOG_INLINE void m256iMulLoPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_mullo_epi32(x0, y0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Min / Max]
+// ============================================================================
+
+static FOG_INLINE void m256iMinPI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_min_epi16(x0, y0);
+}
+
+static FOG_INLINE void m256iMinPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_min_epi32(x0, y0);
+}
+
+static FOG_INLINE void m256iMaxPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_max_epi32(x0, y0);
+}
+
+static FOG_INLINE void m256iMaxPU32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_max_epu32(x0, y0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Abs]
+// ============================================================================
+
+static FOG_INLINE void m256iAbsPI32(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_abs_epi32(x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - BitOps]
+// ============================================================================
+
+static FOG_INLINE void m256iZero(__m256i& dst0)
+{
+  dst0 = _mm256_setzero_si256();
+}
+
+static FOG_INLINE void m256iFill(__m256i& dst0)
+{
+  dst0 = _mm256_set1_epi32(-1);
+}
+
+static FOG_INLINE void m256iAnd(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_and_si256(x0, y0);
+}
+
+//! @brief dst0 = ~x0 & y0.
+static FOG_INLINE void m256iAndNot(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_andnot_si256(x0, y0);
+}
+
+static FOG_INLINE void m256iOr(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_or_si256(x0, y0);
+}
+
+static FOG_INLINE void m256iXor(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_xor_si256(x0, y0);
+}
+
+//! @brief Select bytes from @a y0 where the MSB of @a msk0 byte is set,
+//! otherwise from @a x0.
+static FOG_INLINE void m256iBlendPI8(__m256i& dst0, const __m256i& x0, const __m256i& y0, const __m256i& msk0)
+{
+  dst0 = _mm256_blendv_epi8(x0, y0, msk0);
+}
+
+//! @brief Get whether all bits in @a x0 are zero.
+static FOG_INLINE bool m256iIsZero(const __m256i& x0)
+{
+  return _mm256_testz_si256(x0, x0) != 0;
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - LShift / RShift]
+// ============================================================================
+
+template<int COUNT>
+static FOG_INLINE void m256iLShiftPU16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_slli_epi16(x0, COUNT);
+}
+
+template<int COUNT>
+static FOG_INLINE void m256iRShiftPU16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_srli_epi16(x0, COUNT);
+}
+
+template<int COUNT>
+static FOG_INLINE void m256iLShiftPU32(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_slli_epi32(x0, COUNT);
+}
+
+template<int COUNT>
+static FOG_INLINE void m256iRShiftPU32(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_srli_epi32(x0, COUNT);
+}
+
+template<int COUNT>
+static FOG_INLINE void m256iRShiftPI32(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_srai_epi32(x0, COUNT);
+}
+
+//! @brief Shift each 128-bit lane left by @a COUNT_BITS (must be divisible
+//! by 8).
+template<int COUNT_BITS>
+static FOG_INLINE void m256iLShiftSU128(__m256i& dst0, const __m256i& x0)
+{
+  char COUNT_BITS_Must_Be_Divisible_By_8[COUNT_BITS % 8 == 0 ? 1 : -1];
+  dst0 = _mm256_slli_si256(x0, COUNT_BITS >> 3);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Compare]
+// ============================================================================
+
+static FOG_INLINE void m256iCmpEqPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_cmpeq_epi32(x0, y0);
+}
+
+static FOG_INLINE void m256iCmpGtPI32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_cmpgt_epi32(x0, y0);
+}
+
+//! @brief dst0 = x0 >= y0 (unsigned DWORDs).
+static FOG_INLINE void m256iCmpGePU32(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_cmpeq_epi32(_mm256_max_epu32(x0, y0), x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - MoveMask]
+// ============================================================================
+
+static FOG_INLINE void m256iMoveMaskPI8(uint32_t& dst0, const __m256i& x0)
+{
+  dst0 = (uint32_t)_mm256_movemask_epi8(x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Negate255/256]
+// ============================================================================
+
+static FOG_INLINE void m256iNegate255PI16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_xor_si256(x0, FOG_YMM_GET_CONST_PI(m256i_00FF));
+}
+
+static FOG_INLINE void m256iNegate256PI16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_sub_epi16(FOG_YMM_GET_CONST_PI(m256i_0100), x0);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Cvt256From255]
+// ============================================================================
+
+static FOG_INLINE void m256iCvt256From255PI16(__m256i& dst0, const __m256i& x0)
+{
+  dst0 = _mm256_mullo_epi16(x0, FOG_YMM_GET_CONST_PI(m256i_0081));
+  dst0 = _mm256_srli_epi16(dst0, 7);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - MulDiv255/256]
+// ============================================================================
+
+static FOG_INLINE void m256iMulDiv255PI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_mullo_epi16(x0, y0);
+  dst0 = _mm256_adds_epu16(dst0, FOG_YMM_GET_CONST_PI(m256i_0080));
+  dst0 = _mm256_mulhi_epu16(dst0, FOG_YMM_GET_CONST_PI(m256i_0101));
+}
+
+static FOG_INLINE void m256iMulDiv255PI16_2x(
+  __m256i& dst0, const __m256i& x0, const __m256i& y0,
+  __m256i& dst1, const __m256i& x1, const __m256i& y1)
+{
+  dst0 = _mm256_mullo_epi16(x0, y0);
+  dst1 = _mm256_mullo_epi16(x1, y1);
+
+  dst0 = _mm256_adds_epu16(dst0, FOG_YMM_GET_CONST_PI(m256i_0080));
+  dst1 = _mm256_adds_epu16(dst1, FOG_YMM_GET_CONST_PI(m256i_0080));
+
+  dst0 = _mm256_mulhi_epu16(dst0, FOG_YMM_GET_CONST_PI(m256i_0101));
+  dst1 = _mm256_mulhi_epu16(dst1, FOG_YMM_GET_CONST_PI(m256i_0101));
+}
+
+static FOG_INLINE void m256iMulDiv256PI16(__m256i& dst0, const __m256i& x0, const __m256i& y0)
+{
+  dst0 = _mm256_mullo_epi16(x0, y0);
+  dst0 = _mm256_srli_epi16(dst0, 8);
+}
+
+static FOG_INLINE void m256iMulDiv256PI16_2x(
+  __m256i& dst0, const __m256i& x0, const __m256i& y0,
+  __m256i& dst1, const __m256i& x1, const __m256i& y1)
+{
+  dst0 = _mm256_mullo_epi16(x0, y0);
+  dst1 = _mm256_mullo_epi16(x1, y1);
+
+  dst0 = _mm256_srli_epi16(dst0, 8);
+  dst1 = _mm256_srli_epi16(dst1, 8);
+}
+
+// ============================================================================
+// [Fog::Acc - AVX2 - Double]
+// ============================================================================
+
+static FOG_INLINE void m256dAdd(__m256d& dst0, const __m256d& x0, const __m256d& y0)
+{
+  dst0 = _mm256_add_pd(x0, y0);
+}
+
+static FOG_INLINE void m256dMul(__m256d& dst0, const __m256d& x0, const __m256d& y0)
+{
+  dst0 = _mm256_mul_pd(x0, y0);
+}
+
+static FOG_INLINE void m256dSqrt(__m256d& dst0, const __m256d& x0)
+{
+  dst0 = _mm256_sqrt_pd(x0);
+}
+
+static FOG_INLINE void m256dAbs(__m256d& dst0, const __m256d& x0)
+{
+  dst0 = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x0);
+}
+
+static FOG_INLINE void m256dMin(__m256d& dst0, const __m256d& x0, const __m256d& y0)
+{
+  dst0 = _mm256_min_pd(x0, y0);
+}
+
+static FOG_INLINE void m256dMax(__m256d& dst0, const __m256d& x0, const __m256d& y0)
+{
+  dst0 = _mm256_max_pd(x0, y0);
+}
+
+//! @brief Convert two 4x double vectors to 8x int32 (truncation, like C cast).
+static FOG_INLINE void m256iCvttPI32FromPD_2x(__m256i& dst0, const __m256d& x0, const __m256d& x1)
+{
+  m256iFromM128i(dst0, _mm256_cvttpd_epi32(x0), _mm256_cvttpd_epi32(x1));
+}
+
+//! @}
+
+} // Acc namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_CORE_ACC_ACCAVX2_H
@@ -23,6 +23,10 @@
 //! @brief Whether to build Fog/UI-X11 module.
 #cmakedefine FOG_BUILD_UI_X11_MODULE
 
+//! @brief Whether to build the render-time profiler of the raster paint-engine
+//! (see @c PAINTER_PARAMETER_PROFILER_I).
+#cmakedefine FOG_BUILD_PROFILER
+
 // ============================================================================
 // [FOG_DEBUG]
 // ============================================================================
@@ -70,6 +74,9 @@
 //! @brief Enable support for x86/x64 SSSE3 instructions.
 #cmakedefine FOG_OPTIMIZE_SSSE3
 
+//! @brief Enable support for x86/x64 AVX2 instructions.
+#cmakedefine FOG_OPTIMIZE_AVX2
+
 //! @brief Enable support for ARM Neon instructions.
 #cmakedefine FOG_OPTIMIZE_NEON
 
@@ -124,6 +131,12 @@
 //! font support.
 #cmakedefine FOG_FONT_FREETYPE
 
+//! @brief Whether to build Unix font support.
+//!
+//! This is default when using Linux/BSD. TrueType/OpenType files are located
+//! in the standard font directories and decoded without FreeType.
+#cmakedefine FOG_FONT_UNIX
+
 // ============================================================================
 // [FOG_INSTALL]
 // ============================================================================
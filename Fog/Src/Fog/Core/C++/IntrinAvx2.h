@@ -0,0 +1,233 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_CORE_CPP_INTRINAVX2_H
+#define _FOG_CORE_CPP_INTRINAVX2_H
+
+// [Dependencies]
+#include <Fog/Core/C++/Base.h>
+#include <Fog/Core/C++/IntrinSsse3.h>
+
+#include <immintrin.h>
+
+//! @addtogroup Fog_Core_Cpp_Intrin
+//! @{
+
+// ============================================================================
+// [__m256f]
+// ============================================================================
+
+//! @brief 256-bit AVX float register.
+//!
+//! Matches the @c __m128f naming, see @c IntrinSse.h.
+typedef __m256 __m256f;
+
+// ============================================================================
+// [FOG_YMM_DECLARE_CONST]
+// ============================================================================
+
+// Constants are declared the same way as XMM constants (the first argument
+// is the most significant element). The PI8_VAR variant takes 16 bytes and
+// repeats them in both 128-bit lanes, because all AVX2 byte shuffles work
+// within the lane.
+
+#define FOG_YMM_DECLARE_CONST_PI8_VAR(name, val0, val1, val2, val3, val4, val5, val6, val7, val8, val9, val10, val11, val12, val13, val14, val15) \
+  FOG_ALIGNED_VAR(static const uint8_t, _ymm_const_##name[32], 32) = \
+  { \
+    (uint8_t)(val15), \
+    (uint8_t)(val14), \
+    (uint8_t)(val13), \
+    (uint8_t)(val12), \
+    (uint8_t)(val11), \
+    (uint8_t)(val10), \
+    (uint8_t)(val9), \
+    (uint8_t)(val8), \
+    (uint8_t)(val7), \
+    (uint8_t)(val6), \
+    (uint8_t)(val5), \
+    (uint8_t)(val4), \
+    (uint8_t)(val3), \
+    (uint8_t)(val2), \
+    (uint8_t)(val1), \
+    (uint8_t)(val0), \
+    (uint8_t)(val15), \
+    (uint8_t)(val14), \
+    (uint8_t)(val13), \
+    (uint8_t)(val12), \
+    (uint8_t)(val11), \
+    (uint8_t)(val10), \
+    (uint8_t)(val9), \
+    (uint8_t)(val8), \
+    (uint8_t)(val7), \
+    (uint8_t)(val6), \
+    (uint8_t)(val5), \
+    (uint8_t)(val4), \
+    (uint8_t)(val3), \
+    (uint8_t)(val2), \
+    (uint8_t)(val1), \
+    (uint8_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PI8_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const uint8_t, _ymm_const_##name[32], 32) = \
+  { \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0), \
+    (uint8_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PI16_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const uint16_t, _ymm_const_##name[16], 32) = \
+  { \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0), \
+    (uint16_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PI32_VAR(name, val0, val1, val2, val3, val4, val5, val6, val7) \
+  FOG_ALIGNED_VAR(static const uint32_t, _ymm_const_##name[8], 32) = \
+  { \
+    (uint32_t)(val7), \
+    (uint32_t)(val6), \
+    (uint32_t)(val5), \
+    (uint32_t)(val4), \
+    (uint32_t)(val3), \
+    (uint32_t)(val2), \
+    (uint32_t)(val1), \
+    (uint32_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PI32_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const uint32_t, _ymm_const_##name[8], 32) = \
+  { \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0), \
+    (uint32_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PI64_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const uint64_t, _ymm_const_##name[4], 32) = \
+  { \
+    (uint64_t)(val0), \
+    (uint64_t)(val0), \
+    (uint64_t)(val0), \
+    (uint64_t)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PS_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const float, _ymm_const_##name[8], 32) = \
+  { \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0), \
+    (float)(val0)  \
+  }
+
+#define FOG_YMM_DECLARE_CONST_PD_SET(name, val0) \
+  FOG_ALIGNED_VAR(static const double, _ymm_const_##name[4], 32) = \
+  { \
+    (double)(val0), \
+    (double)(val0), \
+    (double)(val0), \
+    (double)(val0)  \
+  }
+
+// ============================================================================
+// [FOG_YMM_GET_CONST]
+// ============================================================================
+
+#define FOG_YMM_GET_CONST_PS(name) (*(const __m256  *)_ymm_const_##name)
+#define FOG_YMM_GET_CONST_PD(name) (*(const __m256d *)_ymm_const_##name)
+#define FOG_YMM_GET_CONST_PI(name) (*(const __m256i *)_ymm_const_##name)
+
+//! @}
+
+namespace Fog {
+
+//! @addtogroup Fog_Core_Cpp_Intrin
+//! @{
+
+// ============================================================================
+// [Fog::ymm_t]
+// ============================================================================
+
+//! @brief YMM register.
+union FOG_ALIGNED_TYPE(ymm_t, 32)
+{
+  __m256i  m256i;
+  __m256f  m256f;
+  __m256d  m256d;
+  __m128i  m128i[2];
+
+  uint64_t uq[4];
+  int64_t  sq[4];
+  uint32_t ud[8];
+  int32_t  sd[8];
+  uint16_t uw[16];
+  int16_t  sw[16];
+  uint8_t  ub[32];
+  int8_t   sb[32];
+  float    f[8];
+  double   d[4];
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_CORE_CPP_INTRINAVX2_H
@@ -221,6 +221,10 @@
 // [Fog::Core::C++ - CPU Architecture hardcoding]
 // ============================================================================
 
+#if defined(FOG_HARDCODE_AVX2) && !defined(FOG_HARDCODE_SSSE3)
+# define FOG_HARDCODE_SSSE3
+#endif 
+
 #if defined(FOG_HARDCODE_SSSE3) && !defined(FOG_HARDCODE_SSE3)
 # define FOG_HARDCODE_SSE3
 #endif 
@@ -2022,6 +2022,7 @@ struct FOG_NO_EXPORT Api
 
   FOG_CAPI_METHOD(uint32_t, image_getAlphaDistribution)(const Image* self);
   FOG_CAPI_METHOD(void, image_modified)(Image* self);
+  FOG_CAPI_METHOD(err_t, image_getMipLevel)(const Image* self, Image* dst, uint32_t level);
 
   FOG_CAPI_METHOD(void, image_reset)(Image* self);
 
@@ -2120,6 +2121,21 @@ struct FOG_NO_EXPORT Api
 
   ImageConverter* imageconverter_oNull;
 
+  // --------------------------------------------------------------------------
+  // [G2d/Imaging - ImageResizer]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_CTOR(imageresizer_ctor)(ImageResizer* self);
+  FOG_CAPI_DTOR(imageresizer_dtor)(ImageResizer* self);
+
+  FOG_CAPI_METHOD(void, imageresizer_reset)(ImageResizer* self);
+  FOG_CAPI_METHOD(err_t, imageresizer_setResizeFunc)(ImageResizer* self, uint32_t resizeFunc, const Hash<StringW, Var>* params);
+  FOG_CAPI_METHOD(err_t, imageresizer_setCustomFunc)(ImageResizer* self, const MathFunctionF* resizeFunc, float radius);
+  FOG_CAPI_METHOD(err_t, imageresizer_setMode)(ImageResizer* self, uint32_t mode);
+  FOG_CAPI_METHOD(err_t, imageresizer_setMaxThreads)(ImageResizer* self, uint32_t maxThreads);
+  FOG_CAPI_METHOD(void, imageresizer_clearCache)(ImageResizer* self);
+  FOG_CAPI_METHOD(err_t, imageresizer_resize)(ImageResizer* self, Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment);
+
   // --------------------------------------------------------------------------
   // [G2d/Imaging - ImageFilter]
   // --------------------------------------------------------------------------
@@ -2394,6 +2410,19 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, painter_switchToIBits)(Painter* self, const ImageBits* imageBits, const RectI* rect);
   FOG_CAPI_STATIC(PaintEngine*, painter_getNullEngine)();
 
+  // --------------------------------------------------------------------------
+  // [G2d/Painting - Picture]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_CTOR(picture_ctor)(Picture* self);
+  FOG_CAPI_CTOR(picture_ctorCopy)(Picture* self, const Picture* other);
+  FOG_CAPI_DTOR(picture_dtor)(Picture* self);
+
+  FOG_CAPI_METHOD(void, picture_reset)(Picture* self);
+  FOG_CAPI_METHOD(err_t, picture_copy)(Picture* self, const Picture* other);
+
+  FOG_CAPI_STATIC(void, picture_dFree)(PictureData* d);
+
   // --------------------------------------------------------------------------
   // [G2d/Source - Color]
   // --------------------------------------------------------------------------
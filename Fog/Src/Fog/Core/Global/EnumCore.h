@@ -1232,7 +1232,9 @@ enum CPU_FEATURE
   CPU_FEATURE_SSE4_1 = 1U << 19,
   //! @brief Cpu has SSE4.2.
   CPU_FEATURE_SSE4_2 = 1U << 20,
-  //! @brief Cpu has AVX.
+  //! @brief Cpu has AVX2 (and the OS saves YMM registers).
+  CPU_FEATURE_AVX2 = 1U << 21,
+  //! @brief Cpu has AVX (and the OS saves YMM registers).
   CPU_FEATURE_AVX = 1U << 22,
   //! @brief Cpu has Misaligned SSE (MSSE).
   CPU_FEATURE_MSSE = 1U << 23,
@@ -1254,6 +1256,25 @@ enum CPU_FEATURE
   CPU_FEATURE_64_BIT = 1U << 31
 };
 
+// ============================================================================
+// [Fog::CPU_FEATURE_EXT]
+// ============================================================================
+
+//! @brief CPU features which didn't fit into @c CPU_FEATURE.
+enum CPU_FEATURE_EXT
+{
+  //! @brief Cpu supports BMI instructions (ANDN, BEXTR, BLSI, TZCNT, ...).
+  CPU_FEATURE_EXT_BMI = 1U << 0,
+  //! @brief Cpu supports BMI2 instructions (BZHI, PDEP, PEXT, SHLX, ...).
+  CPU_FEATURE_EXT_BMI2 = 1U << 1,
+  //! @brief Cpu supports FMA3 instructions.
+  CPU_FEATURE_EXT_FMA3 = 1U << 2,
+  //! @brief Cpu supports F16C (half-float conversion) instructions.
+  CPU_FEATURE_EXT_F16C = 1U << 3,
+  //! @brief Cpu supports XSAVE/XRSTOR and the OS enabled them (OSXSAVE).
+  CPU_FEATURE_EXT_OSXSAVE = 1U << 4
+};
+
 // ============================================================================
 // [Fog::CPU_TICKS_PRECISION]
 // ============================================================================
@@ -2109,14 +2130,17 @@ enum STR
   STR_color,
   STR_comp_op,
   STR_compression,
+  STR_cropRect,
   STR_cursor,
   STR_cx,
   STR_cy,
   STR_d,
   STR_defs,
+  STR_delay,
   STR_depth,
   STR_direction,
   STR_display,
+  STR_dither,
   STR_dx,
   STR_dy,
   STR_ellipse,
@@ -2158,6 +2182,7 @@ enum STR
   STR_lighting_color,
   STR_line,
   STR_linearGradient,
+  STR_loopCount,
   STR_marker,
   STR_marker_end,
   STR_marker_mid,
@@ -2190,6 +2215,7 @@ enum STR
   STR_rotate,
   STR_rx,
   STR_ry,
+  STR_scaleDenom,
   STR_shape_rendering,
   STR_skipFileHeader,
   STR_solidColor,
@@ -2209,6 +2235,7 @@ enum STR
   STR_style,
   STR_svg,
   STR_symbol,
+  STR_targetSize,
   STR_text,
   STR_text_decoration,
   STR_text_rendering,
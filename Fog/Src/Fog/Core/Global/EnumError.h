@@ -410,6 +410,9 @@ enum ERR_CODE
 
   ERR_IMAGE_TERMINATED,
   ERR_IMAGE_TRUNCATED,
+  //! @brief More data is needed to continue decoding (returned by
+  //! @c ImageDecoder::feed()).
+  ERR_IMAGE_NEED_MORE_DATA,
 
   ERR_IMAGE_MIME_NOT_MATCH,
 
@@ -535,6 +538,22 @@ enum ERR_CODE
   //! @brief TrueType/OpenType 'maxp' header version is not supported or wrong.
   ERR_FONT_MAXP_HEADER_WRONG_VERSION,
 
+  //! @brief TrueType/OpenType 'loca' table is wrong (corrupted/malformed).
+  ERR_FONT_LOCA_HEADER_WRONG_DATA,
+
+  //! @brief TrueType/OpenType 'glyf' table is wrong or its dependencies
+  //! ('head', 'maxp', 'loca') are missing.
+  ERR_FONT_GLYF_HEADER_WRONG_DATA,
+  //! @brief TrueType/OpenType 'glyf' glyph data are wrong (corrupted/malformed).
+  ERR_FONT_GLYF_GLYPH_WRONG_DATA,
+
+  //! @brief TrueType/OpenType 'CFF ' header is wrong (corrupted/malformed).
+  ERR_FONT_CFF_HEADER_WRONG_DATA,
+  //! @brief TrueType/OpenType 'CFF ' header's version is wrong or not supported.
+  ERR_FONT_CFF_HEADER_WRONG_VERSION,
+  //! @brief TrueType/OpenType 'CFF ' charstring is wrong (corrupted/malformed).
+  ERR_FONT_CFF_CHARSTRING_WRONG_DATA,
+
   //! @brief TrueType/OpenType 'cmap' table format is not loaded.
   //!
   //! @note This is generic error which means that font doesn't have a cmap
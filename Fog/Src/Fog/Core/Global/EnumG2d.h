@@ -640,7 +640,11 @@ enum COMPOSITE_OP
 enum DITHER_TYPE
 {
   DITHER_TYPE_NONE = 0,
-  DITHER_TYPE_PATTERN = 1
+  DITHER_TYPE_PATTERN = 1,
+  //! @brief Floyd-Steinberg error diffusion.
+  DITHER_TYPE_DIFFUSION = 2,
+
+  DITHER_TYPE_COUNT = 3
 };
 
 // ============================================================================
@@ -1091,7 +1095,9 @@ enum FONT_ENGINE
   //! @brief Mac font engine.
   FONT_ENGINE_MAC = 2,
   //! @brief Freetype font engine.
-  FONT_ENGINE_FREETYPE = 3
+  FONT_ENGINE_FREETYPE = 3,
+  //! @brief Unix font engine (native TrueType/OpenType loader).
+  FONT_ENGINE_UNIX = 4
 };
 
 // ============================================================================
@@ -1709,6 +1715,24 @@ enum IMAGE_CODEC
   IMAGE_CODEC_BOTH = 0x3
 };
 
+// ============================================================================
+// [Fog::IMAGE_DISPOSAL]
+// ============================================================================
+
+//! @brief What to do with the area of a frame before the next frame of an
+//! animation is drawn (see @c ImageFrameInfo).
+enum IMAGE_DISPOSAL
+{
+  //! @brief Leave the frame in place.
+  IMAGE_DISPOSAL_NONE = 0,
+  //! @brief Clear the frame area to transparent.
+  IMAGE_DISPOSAL_BACKGROUND = 1,
+  //! @brief Restore the frame area to the content before the frame was drawn.
+  IMAGE_DISPOSAL_PREVIOUS = 2,
+
+  IMAGE_DISPOSAL_COUNT = 3
+};
+
 // ============================================================================
 // [Fog::IMAGE_FD_FLAGS]
 // ============================================================================
@@ -1946,6 +1970,31 @@ enum IMAGE_RESIZE
   IMAGE_RESIZE_COUNT = 13
 };
 
+// ============================================================================
+// [Fog::IMAGE_RESIZE_MODE]
+// ============================================================================
+
+//! @brief How the two passes of the separable resize are scheduled, see
+//! @c ImageResizer::setMode().
+enum IMAGE_RESIZE_MODE
+{
+  //! @brief Use @c IMAGE_RESIZE_MODE_STRIPS for large images, otherwise
+  //! @c IMAGE_RESIZE_MODE_TWO_PASS.
+  IMAGE_RESIZE_MODE_AUTO = 0,
+
+  //! @brief Horizontal pass of the whole source image into a temporary image,
+  //! then vertical pass of the whole destination image.
+  IMAGE_RESIZE_MODE_TWO_PASS = 1,
+
+  //! @brief Destination is processed in strips, the horizontal pass produces
+  //! only rows needed by the strip into a small (cache-friendly) buffer, which
+  //! is consumed by the vertical pass immediately.
+  IMAGE_RESIZE_MODE_STRIPS = 2,
+
+  //! @brief Count of resize modes.
+  IMAGE_RESIZE_MODE_COUNT = 3
+};
+
 // ============================================================================
 // [Fog::IMAGE_ROTATE_MODE]
 // ============================================================================
@@ -2324,12 +2373,37 @@ enum PAINTER_PARAMETER
   PAINTER_PARAMETER_FILTER_SCALE_F = 34,
   PAINTER_PARAMETER_FILTER_SCALE_D = 35,
 
+  // --------------------------------------------------------------------------
+  // [Profiler]
+  // --------------------------------------------------------------------------
+
+  //! @brief Whether the render-time profiler is enabled.
+  //!
+  //! @note The profiler is only available if Fog-Framework was compiled with
+  //! @c FOG_BUILD_PROFILER, otherwise @c ERR_RT_NOT_IMPLEMENTED is returned.
+  PAINTER_PARAMETER_PROFILER_I = 36,
+
+  //! @brief The collected profile (@c PaintProfile), read-only.
+  PAINTER_PARAMETER_PROFILE = 37,
+
+  //! @brief The collected trace events as Chrome-trace JSON (@c StringA),
+  //! read-only.
+  PAINTER_PARAMETER_PROFILE_TRACE = 38,
+
+  // --------------------------------------------------------------------------
+  // [Paint Hints - Rasterizer]
+  // --------------------------------------------------------------------------
+
+  //! @brief Path rasterizer used to fill anti-aliased paths, see
+  //! @c PATH_RASTERIZER.
+  PAINTER_PARAMETER_PATH_RASTERIZER_I = 39,
+
   // --------------------------------------------------------------------------
   // [...]
   // --------------------------------------------------------------------------
 
   //! @brief Count of painter parameters.
-  PAINTER_PARAMETER_COUNT = 36
+  PAINTER_PARAMETER_COUNT = 40
 };
 
 // ============================================================================
@@ -2476,6 +2550,32 @@ enum PATH_FLATTEN
   PATH_FLATTEN_COUNT = 3
 };
 
+// ============================================================================
+// [Fog::PATH_RASTERIZER]
+// ============================================================================
+
+//! @brief Path rasterizer hint.
+enum PATH_RASTERIZER
+{
+  //! @brief Select the rasterizer by the complexity of the path (default).
+  //!
+  //! Paths having many vertices in a small area are filled by the dense
+  //! rasterizer, other paths by the cell rasterizer.
+  PATH_RASTERIZER_AUTO = 0,
+
+  //! @brief Always use the cell (sorted cell-list) rasterizer.
+  PATH_RASTERIZER_CELL = 1,
+
+  //! @brief Always use the dense (accumulation buffer) rasterizer.
+  PATH_RASTERIZER_DENSE = 2,
+
+  //! @brief Default path rasterizer hint.
+  PATH_RASTERIZER_DEFAULT = PATH_RASTERIZER_AUTO,
+
+  //! @brief Count of path rasterizer hints.
+  PATH_RASTERIZER_COUNT = 3
+};
+
 // ============================================================================
 // [Fog::PATTERN_TYPE]
 // ============================================================================
@@ -112,6 +112,7 @@ FOG_CAPI_DECLARE void _fog_init(void)
   Application_init();
 
   // [G2d/Tools]
+  ColorQuantizer_init();
   Dpi_init();
   Matrix_init();
   Region_init();
@@ -197,6 +198,12 @@ FOG_CAPI_DECLARE void _fog_fini(void)
   if (--_fog_init_counter != 0)
     return;
 
+  // [G2d/Painting]
+  //
+  // The glyph cache references font faces, it must be released before the
+  // font engine is destroyed.
+  Painter_fini();
+
   // [G2d/Text]
   Font_fini();
 
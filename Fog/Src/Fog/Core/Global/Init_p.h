@@ -177,6 +177,7 @@ FOG_NO_EXPORT void WinUtil_G2d_fini(void);
 
 // [Fog/G2d/Painting]
 FOG_NO_EXPORT void Painter_init(void);
+FOG_NO_EXPORT void Painter_fini(void);
 FOG_NO_EXPORT void PaintDeviceInfo_init(void);
 FOG_NO_EXPORT void RasterOps_init(void);
 FOG_NO_EXPORT void Rasterizer_init(void);
@@ -188,6 +189,7 @@ FOG_NO_EXPORT void Gradient_init(void);
 FOG_NO_EXPORT void Pattern_init(void);
 
 // [Fog/G2d/Tools]
+FOG_NO_EXPORT void ColorQuantizer_init(void);
 FOG_NO_EXPORT void Dpi_init(void);
 FOG_NO_EXPORT void Matrix_init(void);
 FOG_NO_EXPORT void Region_init(void);
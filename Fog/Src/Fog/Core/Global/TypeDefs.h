@@ -236,6 +236,8 @@ struct ImageFilterScaleD;
 struct ImageFormatDescription;
 struct ImagePalette;
 struct ImagePaletteData;
+struct ImageResizer;
+struct ImageResizerData;
 struct ImageVTable;
 
 // Fog/G2d/Imaging/Filters.
@@ -265,6 +267,8 @@ struct PaintDeviceInfo;
 struct PaintEngine;
 struct PaintParamsF;
 struct PaintParamsD;
+struct Picture;
+struct PictureData;
 
 // Fog/G2d/Source.
 struct AcmykF;
@@ -451,6 +455,9 @@ typedef void (FOG_CDECL* FeCompositingFunctionPrgb64Func)(
 typedef err_t (FOG_CDECL *CSSStyleHandlerFunc)(
   void* ctx, const StringW* name, const StringW* value);
 
+typedef void (FOG_CDECL *ImageDecoderFeedFunc)(
+  ImageDecoder* decoder, const RectI* rect, void* data);
+
 // ============================================================================
 // [TypeDefs - Functions - Fog/UI]
 // ============================================================================
@@ -28,7 +28,7 @@ namespace MemOps {
 
 // [Fog::BSwap - GNU Intrinsics]
 #if defined(FOG_CC_GNU) && FOG_CC_GNU_VERSION_GE(4, 3, 0)
-static FOG_INLINE uint16_t bswap16(uint16_t x) { return (x << 8) || (x >> 8); }
+static FOG_INLINE uint16_t bswap16(uint16_t x) { return (uint16_t)((x << 8) | (x >> 8)); }
 static FOG_INLINE uint32_t bswap32(uint32_t x) { return __builtin_bswap32(x); }
 static FOG_INLINE uint64_t bswap64(uint64_t x) { return __builtin_bswap64(x); }
 #define _FOG_HAS_BSWAP64
@@ -323,9 +323,16 @@ static err_t FOG_CDECL DirIterator_open(DirIterator* self, const StringW* path,
   }
 
   d->skipParent = skipParent;
+  err_t err;
 
-  FOG_RETURN_ON_ERROR(FilePath::toAbsolute(d->pathAbs, *path));
-  FOG_RETURN_ON_ERROR(TextCodec::local8().encode(d->pathCache, d->pathAbs));
+  if (FOG_IS_ERROR(err = FilePath::toAbsolute(d->pathAbs, *path)) ||
+      FOG_IS_ERROR(err = TextCodec::local8().encode(d->pathCache, d->pathAbs)))
+  {
+    PosixDirIterator_dFree(d);
+
+    self->_d = &DirIterator_dEmpty;
+    return err;
+  }
 
   errno = 0;
   if ((d->handle = (void*)::opendir(d->pathCache->getData())) != NULL)
@@ -349,11 +356,17 @@ static err_t FOG_CDECL DirIterator_open(DirIterator* self, const StringW* path,
     }
 
     d->pathCacheBaseLength = d->pathCache->getLength();
+
+    self->_d = d;
     return ERR_OK;
   }
   else
   {
-    return errno;
+    err = errno;
+    PosixDirIterator_dFree(d);
+
+    self->_d = &DirIterator_dEmpty;
+    return err;
   }
 }
 
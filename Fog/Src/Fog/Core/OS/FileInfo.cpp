@@ -387,6 +387,7 @@ static FileInfoData* FOG_CDECL FileInfo_dCreate(const StringW* fileName)
   // d->vType = VAR_TYPE_FILE_INFO;
 
   d->fileFlags = NO_FLAGS;
+  d->filePath.init();
   d->fileName.initCustom1(*fileName);
   d->size = 0;
 
@@ -395,6 +396,7 @@ static FileInfoData* FOG_CDECL FileInfo_dCreate(const StringW* fileName)
 
 static void FOG_CDECL FileInfo_dFree(FileInfoData* d)
 {
+  d->filePath.destroy();
   d->fileName.destroy();
   MemMgr::free(d);
 }
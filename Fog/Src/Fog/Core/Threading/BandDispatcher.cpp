@@ -0,0 +1,130 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Kernel/EventLoop.h>
+#include <Fog/Core/Kernel/Task.h>
+#include <Fog/Core/Threading/BandDispatcher_p.h>
+#include <Fog/Core/Threading/ThreadPool.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::BandDispatcherTask]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Task posted to the pooled thread to process one band.
+//!
+//! The task is destroyed by the event-loop after it finished, so nothing owned
+//! by the dispatcher is touched after the band reported that it's done.
+struct FOG_NO_EXPORT BandDispatcherTask : public Task
+{
+  BandDispatcherTask(BandDispatcher* dispatcher, BandDispatcherFunc func, void* data, uint id) :
+    dispatcher(dispatcher),
+    func(func),
+    data(data),
+    id(id)
+  {
+    setDestroyOnFinish(true);
+  }
+
+  virtual ~BandDispatcherTask()
+  {
+  }
+
+  virtual void run()
+  {
+    func(data, id);
+    dispatcher->_finished();
+  }
+
+  BandDispatcher* dispatcher;
+  BandDispatcherFunc func;
+  void* data;
+  uint id;
+};
+
+// ============================================================================
+// [Fog::BandDispatcher - Construction / Destruction]
+// ============================================================================
+
+BandDispatcher::BandDispatcher() :
+  finishedCondition(&lock),
+  numBands(0),
+  numFinished(0)
+{
+}
+
+BandDispatcher::~BandDispatcher()
+{
+}
+
+// ============================================================================
+// [Fog::BandDispatcher - Run]
+// ============================================================================
+
+void BandDispatcher::run(Thread** threads, uint numBands, BandDispatcherFunc func, void* data)
+{
+  FOG_ASSERT(numBands >= 1);
+
+  this->numBands = numBands;
+  numFinished = 0;
+
+  uint i;
+  for (i = 1; i < numBands; i++)
+  {
+    BandDispatcherTask* task = fog_new BandDispatcherTask(this, func, data, i);
+
+    if (FOG_IS_NULL(task) || threads[i - 1]->getEventLoop().postTask(task) != ERR_OK)
+    {
+      // Run in the calling thread in case that the task can't be posted.
+      if (task != NULL)
+        fog_delete(task);
+
+      func(data, i);
+
+      AutoLock locked(lock);
+      numFinished++;
+    }
+  }
+
+  // The calling thread processes the first band.
+  func(data, 0);
+
+  AutoLock locked(lock);
+  numFinished++;
+
+  while (numFinished != numBands)
+    finishedCondition.wait();
+}
+
+void BandDispatcher::_finished()
+{
+  AutoLock locked(lock);
+  if (++numFinished == numBands)
+    finishedCondition.signal();
+}
+
+// ============================================================================
+// [Fog::BandDispatcher - Statics]
+// ============================================================================
+
+uint BandDispatcher::getThreads(Thread** threads, uint count)
+{
+  // Get as many threads as possible.
+  while (count != 0 && ThreadPool::get()->getThreads(threads, count) != ERR_OK)
+    count--;
+
+  return count;
+}
+
+} // Fog namespace
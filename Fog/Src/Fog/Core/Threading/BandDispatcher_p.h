@@ -0,0 +1,104 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_CORE_THREADING_BANDDISPATCHER_P_H
+#define _FOG_CORE_THREADING_BANDDISPATCHER_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/Core/Threading/Thread.h>
+#include <Fog/Core/Threading/ThreadCondition.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_Core_Threading
+//! @{
+
+// ============================================================================
+// [Fog::BandDispatcherFunc]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Function called by @c BandDispatcher to process the band @a id.
+typedef void (FOG_CDECL *BandDispatcherFunc)(void* data, uint id);
+
+// ============================================================================
+// [Fog::BandDispatcher]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Band dispatcher, runs a function for each band using pooled threads.
+//!
+//! The work is split into bands, band zero is processed by the calling thread
+//! and each other band by one pooled thread, @c run() waits until all bands
+//! finished. The band is processed by the calling thread also if the task
+//! can't be posted to the pooled thread. The dispatcher doesn't own threads,
+//! they are acquired by @c getThreads() and released by the caller.
+struct FOG_NO_EXPORT BandDispatcher
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  BandDispatcher();
+  ~BandDispatcher();
+
+  // --------------------------------------------------------------------------
+  // [Run]
+  // --------------------------------------------------------------------------
+
+  //! @brief Run @a func for @a numBands bands and wait for them, @a threads
+  //! must contain at least @a numBands - 1 threads.
+  void run(Thread** threads, uint numBands, BandDispatcherFunc func, void* data);
+
+  //! @brief Called by the task when the band finished.
+  void _finished();
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get at most @a count pooled threads, returns the count acquired.
+  static uint getThreads(Thread** threads, uint count);
+
+  //! @brief Get rows [@a y0, @a y1) of the band @a id when @a h rows are split
+  //! into @a numBands bands (the last bands can be empty).
+  static FOG_INLINE void getBand(int h, uint numBands, uint id, int& y0, int& y1)
+  {
+    int bandHeight = (h + int(numBands) - 1) / int(numBands);
+
+    y0 = Math::min<int>(int(id) * bandHeight, h);
+    y1 = Math::min<int>(y0 + bandHeight, h);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Lock, used to protect @c numFinished.
+  Lock lock;
+  //! @brief Condition, signaled when all bands finished.
+  ThreadCondition finishedCondition;
+
+  //! @brief Count of bands of the current run.
+  uint numBands;
+  //! @brief Count of bands which finished.
+  uint numFinished;
+
+private:
+  FOG_NO_COPY(BandDispatcher)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_CORE_THREADING_BANDDISPATCHER_P_H
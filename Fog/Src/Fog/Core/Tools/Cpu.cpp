@@ -72,18 +72,27 @@ union FOG_NO_EXPORT CpuId
 };
 
 #if defined(FOG_CC_MSC)
-static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
+static void FOG_CDECL Cpu_cpuid(uint32_t in, uint32_t sub, CpuId* out)
 {
-#if _MSC_VER >= 1400
+#if _MSC_VER >= 1500
   // Done by intrinsics.
-  __cpuid(reinterpret_cast<int*>(out->i), in);
+  __cpuidex(reinterpret_cast<int*>(out->i), in, sub);
+#elif _MSC_VER >= 1400
+  // Done by intrinsics, but there is no way to specify the sub-leaf, only the
+  // leafs which don't use it can be queried.
+  if (sub == 0)
+    __cpuid(reinterpret_cast<int*>(out->i), in);
+  else
+    memset(out, 0, sizeof(CpuId));
 #else // _MSC_VER < 1400
   uint32_t cpuid_in = in;
+  uint32_t cpuid_sub = sub;
   uint32_t* cpuid_out = out->i;
 
   __asm
   {
     mov     eax, cpuid_in
+    mov     ecx, cpuid_sub
     mov     edi, cpuid_out
     cpuid
     mov     dword ptr[edi +  0], eax
@@ -93,26 +102,50 @@ static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
   }
 #endif // _MSC_VER < 1400
 }
+
+// Returns the XCR0 register, the caller has to check for OSXSAVE first.
+static uint64_t FOG_CDECL Cpu_xgetbv(void)
+{
+#if _MSC_VER >= 1600
+  return _xgetbv(0);
+#else
+  // Not supported by the compiler, report no OS support for extended state.
+  return 0;
+#endif // _MSC_VER
+}
 #endif // FOG_CC_MSC
 
 #if defined(FOG_CC_GNU) || defined(FOG_CC_CLANG)
-static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
+static void FOG_CDECL Cpu_cpuid(uint32_t in, uint32_t sub, CpuId* out)
 {
 // When using GCC inline assembly it's needed to preserve EBX or RBX register.
 #if defined(FOG_ARCH_X86)
-#define _Cpuid(a, b, c, d, inp) \
+#define _Cpuid(a, b, c, d, inp, sub) \
   asm("mov %%ebx, %%edi\n"    \
       "cpuid\n"               \
       "xchg %%edi, %%ebx\n"   \
-      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "c" (sub))
 #else
-#define _Cpuid(a, b, c, d, inp) \
+#define _Cpuid(a, b, c, d, inp, sub) \
   asm("mov %%rbx, %%rdi\n"    \
       "cpuid\n"               \
       "xchg %%rdi, %%rbx\n"   \
-      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "c" (sub))
 #endif
-  _Cpuid(out->eax, out->ebx, out->ecx, out->edx, in);
+  _Cpuid(out->eax, out->ebx, out->ecx, out->edx, in, sub);
+}
+
+// Returns the XCR0 register, the caller has to check for OSXSAVE first.
+static uint64_t FOG_CDECL Cpu_xgetbv(void)
+{
+  uint32_t lo;
+  uint32_t hi;
+
+  // XGETBV is emitted as bytes so it's not needed to enable AVX or XSAVE
+  // in the compiler for this translation unit.
+  asm(".byte 0x0F, 0x01, 0xD0\n"
+      : "=a" (lo), "=d" (hi) : "c" (0));
+  return (uint64_t(hi) << 32) | lo;
 }
 #endif // FOG_CC_GNU
 
@@ -194,6 +227,7 @@ _Skip:
 static void Cpu_detect(Cpu* cpu)
 {
   uint32_t features = NO_FLAGS;
+  uint32_t featuresExt = NO_FLAGS;
 
   // Reset.
   memset(cpu, 0, sizeof(Cpu));
@@ -203,10 +237,12 @@ static void Cpu_detect(Cpu* cpu)
 
 #if defined(FOG_ARCH_X86) || defined(FOG_ARCH_X86_64)
   uint32_t a;
+  uint32_t maxId;
   CpuId out;
 
-  // Get vendor string.
-  Cpu_cpuid(0, &out);
+  // Get vendor string and the highest standard leaf.
+  Cpu_cpuid(0, 0, &out);
+  maxId = out.eax;
 
   reinterpret_cast<uint32_t*>(cpu->_vendor)[0] = out.ebx;
   reinterpret_cast<uint32_t*>(cpu->_vendor)[1] = out.edx;
@@ -222,7 +258,7 @@ static void Cpu_detect(Cpu* cpu)
   }
 
   // Get feature flags in ECX/EDX, and family/model in EAX.
-  Cpu_cpuid(1, &out);
+  Cpu_cpuid(1, 0, &out);
 
   // Family and model fields.
   cpu->_family   = (out.eax >> 8) & 0x0F;
@@ -245,7 +281,9 @@ static void Cpu_detect(Cpu* cpu)
   if (out.ecx & 0x00100000U) features |= CPU_FEATURE_SSE4_2;
   if (out.ecx & 0x00400000U) features |= CPU_FEATURE_MOVBE;
   if (out.ecx & 0x00800000U) features |= CPU_FEATURE_POPCNT;
-  if (out.ecx & 0x10000000U) features |= CPU_FEATURE_AVX;
+  if (out.ecx & 0x00001000U) featuresExt |= CPU_FEATURE_EXT_FMA3;
+  if (out.ecx & 0x20000000U) featuresExt |= CPU_FEATURE_EXT_F16C;
+  if (out.ecx & 0x08000000U) featuresExt |= CPU_FEATURE_EXT_OSXSAVE;
 
   if (out.edx & 0x00000010U) features |= CPU_FEATURE_RDTSC;
   if (out.edx & 0x00000100U) features |= CPU_FEATURE_CMPXCHG8B;
@@ -256,6 +294,21 @@ static void Cpu_detect(Cpu* cpu)
   if (out.edx & 0x04000000U) features |= CPU_FEATURE_SSE | CPU_FEATURE_SSE2;
   if (out.edx & 0x10000000U) features |= CPU_FEATURE_MULTITHREADING;
 
+  // AVX, AVX2 and FMA3 can only be used when the OS saves both XMM and YMM
+  // registers on context switch (XCR0 bits 1 and 2).
+  bool ymmSupport = false;
+  if ((featuresExt & CPU_FEATURE_EXT_OSXSAVE) != 0)
+    ymmSupport = (Cpu_xgetbv() & 0x6) == 0x6;
+
+  if (ymmSupport)
+  {
+    if (out.ecx & 0x10000000U) features |= CPU_FEATURE_AVX;
+  }
+  else
+  {
+    featuresExt &= ~(CPU_FEATURE_EXT_FMA3 | CPU_FEATURE_EXT_F16C);
+  }
+
   if (cpu->_vendorId == CPU_VENDOR_AMD && (out.edx & 0x10000000U))
   {
     // AMD sets Multithreading to ON if it has more CPU cores.
@@ -271,15 +324,27 @@ static void Cpu_detect(Cpu* cpu)
     cpu->_bugs |= CPU_BUG_AMD_LOCK_MB;
   }
 
+  // Structured extended feature flags (leaf 7, sub-leaf 0).
+  if (maxId >= 7)
+  {
+    Cpu_cpuid(7, 0, &out);
+
+    if (out.ebx & 0x00000008U) featuresExt |= CPU_FEATURE_EXT_BMI;
+    if (out.ebx & 0x00000100U) featuresExt |= CPU_FEATURE_EXT_BMI2;
+
+    if ((out.ebx & 0x00000020U) && (features & CPU_FEATURE_AVX))
+      features |= CPU_FEATURE_AVX2;
+  }
+
   // Calling cpuid with 0x80000000 as the in argument gets the number of valid
   // extended IDs.
-  Cpu_cpuid(0x80000000, &out);
+  Cpu_cpuid(0x80000000, 0, &out);
   uint32_t exIds = Math::min(out.eax, 0x80000004);
   uint32_t* brand = reinterpret_cast<uint32_t*>(cpu->_brand);
 
   for (a = 0x80000001; a <= exIds; a++)
   {
-    Cpu_cpuid(a, &out);
+    Cpu_cpuid(a, 0, &out);
 
     switch (a)
     {
@@ -321,6 +386,7 @@ static void Cpu_detect(Cpu* cpu)
 #endif // FOG_ARCH_ARM
 
   cpu->_features = features;
+  cpu->_featuresExt = featuresExt;
 }
 
 // ============================================================================
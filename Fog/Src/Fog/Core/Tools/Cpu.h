@@ -63,6 +63,10 @@ struct FOG_NO_EXPORT Cpu
   FOG_INLINE bool hasFeature(uint32_t feature) const { return (_features & feature) != 0; }
   FOG_INLINE bool hasFeatures(uint32_t features) const { return (_features & features) == features; }
 
+  FOG_INLINE uint32_t getFeaturesExt() const { return _featuresExt; }
+  FOG_INLINE bool hasFeatureExt(uint32_t feature) const { return (_featuresExt & feature) != 0; }
+  FOG_INLINE bool hasFeaturesExt(uint32_t features) const { return (_featuresExt & features) == features; }
+
   FOG_INLINE uint32_t getBugs() const { return _bugs; }
   FOG_INLINE bool hasBug(uint32_t bug) const { return (_bugs & bug) != 0; }
 
@@ -97,6 +101,8 @@ struct FOG_NO_EXPORT Cpu
   uint32_t _numberOfProcessors;
   //! @brief Cpu features bitfield, see @c CPU_FEATURE).
   uint32_t _features;
+  //! @brief Cpu extended features bitfield, see @c CPU_FEATURE_EXT).
+  uint32_t _featuresExt;
   //! @brief Cpu bugs bitfield, see @c CPU_BUG).
   uint32_t _bugs;
 };
@@ -227,6 +233,28 @@ struct FOG_NO_EXPORT Cpu
 #define FOG_CPU_USE_INITIALIZER_SSSE3(_Initializer_)
 #endif // FOG_OPTIMIZE_SSSE3
 
+// ============================================================================
+// [FOG_CPU - AVX2]
+// ============================================================================
+
+#if defined(FOG_OPTIMIZE_AVX2)
+#define FOG_CPU_DECLARE_INITIALIZER_AVX2(_Initializer_) \
+  FOG_NO_EXPORT void _Initializer_;
+
+#if defined(FOG_HARDCODE_AVX2)
+#define FOG_CPU_USE_INITIALIZER_AVX2(_Initializer_) \
+  _Initializer_;
+#else
+#define FOG_CPU_USE_INITIALIZER_AVX2(_Initializer_) \
+  if (::Fog::Cpu::get()->hasFeature(::Fog::CPU_FEATURE_AVX2) && \
+      ::Fog::Cpu::get()->hasFeatureExt(::Fog::CPU_FEATURE_EXT_BMI2)) _Initializer_;
+#endif // FOG_HARDCODE_AVX2
+
+#else
+#define FOG_CPU_DECLARE_INITIALIZER_AVX2(_Initializer_)
+#define FOG_CPU_USE_INITIALIZER_AVX2(_Initializer_)
+#endif // FOG_OPTIMIZE_AVX2
+
 //! @}
 
 } // Fog namespace
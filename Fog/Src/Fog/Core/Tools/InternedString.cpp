@@ -806,14 +806,17 @@ static const char InternedStringCacheW_data[] =
   "color\0"
   "comp-op\0"
   "compression\0"
+  "cropRect\0"
   "cursor\0"
   "cx\0"
   "cy\0"
   "d\0"
   "defs\0"
+  "delay\0"
   "depth\0"
   "direction\0"
   "display\0"
+  "dither\0"
   "dx\0"
   "dy\0"
   "ellipse\0"
@@ -855,6 +858,7 @@ static const char InternedStringCacheW_data[] =
   "lighting-color\0"
   "line\0"
   "linearGradient\0"
+  "loopCount\0"
   "marker\0"
   "marker_end\0"
   "marker_mid\0"
@@ -887,6 +891,7 @@ static const char InternedStringCacheW_data[] =
   "rotate\0"
   "rx\0"
   "ry\0"
+  "scaleDenom\0"
   "shape-rendering\0"
   "skipFileHeader\0"
   "solidColor\0"
@@ -906,6 +911,7 @@ static const char InternedStringCacheW_data[] =
   "style\0"
   "svg\0"
   "symbol\0"
+  "targetSize\0"
   "text\0"
   "text-decoration\0"
   "text-rendering\0"
@@ -9,6 +9,8 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/Tools/Char.h>
 #include <Fog/Core/Tools/Hash.h>
 #include <Fog/Core/Tools/List.h>
@@ -326,6 +328,784 @@ static void XmlSaxParser_detectEncoding(TextCodec& tc, const void* mem, size_t s
   }
 }
 
+// ============================================================================
+// [Fog::XmlSaxReader - Constants]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief @ref XmlSaxReader constants.
+enum XML_SAX_READER
+{
+  //! @brief Size of a chunk read from the stream.
+  //!
+  //! The buffer grows only if a single construct (tag, comment, text, ...)
+  //! doesn't fit into it.
+  XML_SAX_READER_CHUNK_SIZE = 65536,
+
+  //! @brief Length of the longest markup prefix ("<!DOCTYPE" followed by
+  //! whitespace).
+  XML_SAX_READER_PREFIX_SIZE = 10
+};
+
+//! @internal
+//!
+//! @brief @ref XmlSaxReader construct, determines how its end is found.
+enum XML_SAX_READER_CONSTRUCT
+{
+  //! @brief Start tag, terminated by '>' outside of quotes.
+  XML_SAX_READER_CONSTRUCT_TAG = 0,
+  //! @brief End tag, terminated by '>'.
+  XML_SAX_READER_CONSTRUCT_CLOSE,
+  //! @brief DOCTYPE, terminated by '>' outside of quotes and brackets.
+  XML_SAX_READER_CONSTRUCT_DOCTYPE,
+  //! @brief Processing instruction, terminated by "?>".
+  XML_SAX_READER_CONSTRUCT_PI,
+  //! @brief Comment, terminated by "-->".
+  XML_SAX_READER_CONSTRUCT_COMMENT,
+  //! @brief CDATA section, terminated by "]]>".
+  XML_SAX_READER_CONSTRUCT_CDATA
+};
+
+// ============================================================================
+// [Fog::XmlSaxReader - Helpers]
+// ============================================================================
+
+static FOG_INLINE bool XmlUtil_isSpace8(uint8_t c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// All non-ASCII characters are considered as name characters, see
+// XmlUtil_isNameStartChar() and XmlUtil_isNameChar() for the rules.
+static FOG_INLINE bool XmlUtil_isNameStartChar8(uint8_t c)
+{
+  return (uint8_t)((c | 0x20) - 'a') < 26 ||
+         c == ':' ||
+         c == '_' ||
+         c >= 0x80;
+}
+
+static FOG_INLINE bool XmlUtil_isNameChar8(uint8_t c)
+{
+  return XmlUtil_isNameStartChar8(c) ||
+         (uint8_t)(c - '0') < 10 ||
+         c == '-' ||
+         c == '.' ;
+}
+
+static FOG_INLINE const uint8_t* XmlUtil_skipSpace8(const uint8_t* p, const uint8_t* end)
+{
+  while (p != end && XmlUtil_isSpace8(p[0]))
+    p++;
+  return p;
+}
+
+static FOG_INLINE const uint8_t* XmlUtil_skipName8(const uint8_t* p, const uint8_t* end)
+{
+  while (p != end && XmlUtil_isNameChar8(p[0]))
+    p++;
+  return p;
+}
+
+static FOG_INLINE const uint8_t* XmlUtil_find8(const uint8_t* p, const uint8_t* end, uint8_t c)
+{
+  size_t i = StringUtil::indexOf(reinterpret_cast<const char*>(p), (size_t)(end - p), (char)c);
+  return (i != INVALID_INDEX) ? p + i : NULL;
+}
+
+static FOG_INLINE bool XmlUtil_isWhiteSpace8(const uint8_t* p, const uint8_t* end)
+{
+  return XmlUtil_skipSpace8(p, end) == end;
+}
+
+// ============================================================================
+// [Fog::XmlSaxReader]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Incremental XML-SAX tokenizer of UTF-8 input.
+//!
+//! The reader works directly on UTF-8 bytes, only names, attribute values
+//! and text passed to @ref XmlSaxHandler are converted to UTF-16 (using
+//! strings which are reused by all events). The input is either a memory
+//! block (no copy is made) or a stream, which is read by chunks into a buffer
+//! which holds only the construct being parsed (so the memory used doesn't
+//! depend on the document size).
+struct FOG_NO_EXPORT XmlSaxReader
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  XmlSaxReader(XmlSaxHandler* handler);
+  ~XmlSaxReader();
+
+  // --------------------------------------------------------------------------
+  // [Init]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the reader to parse the memory block @a mem.
+  void initMemory(const void* mem, size_t size);
+
+  //! @brief Initialize the reader to parse @a stream, reading the first chunk.
+  err_t initStream(Stream* stream);
+
+  // --------------------------------------------------------------------------
+  // [Fetch]
+  // --------------------------------------------------------------------------
+
+  //! @brief Fetch more data from the stream, keeping all data from @a mark.
+  //!
+  //! Both @a mark and @a p are updated to point to the same data after the
+  //! buffer was compacted or reallocated. Returns @c false at the end of the
+  //! input or if an error occurred (stored in @c err).
+  bool fetch(const uint8_t*& mark, const uint8_t*& p);
+
+  //! @brief Find the end of @a construct starting at @a mark, @a p is set
+  //! to point after the construct.
+  bool findEnd(const uint8_t*& mark, const uint8_t*& p, uint32_t construct, size_t prefixLength);
+
+  // --------------------------------------------------------------------------
+  // [Parse]
+  // --------------------------------------------------------------------------
+
+  err_t parse();
+
+  err_t parseText(const uint8_t* p, const uint8_t* end);
+  err_t parseTag(const uint8_t* p, const uint8_t* end);
+  err_t parseClose(const uint8_t* p, const uint8_t* end);
+  err_t parseAttributes(const uint8_t* p, const uint8_t* end);
+  err_t parseDOCTYPE(const uint8_t* p, const uint8_t* end);
+  err_t parsePI(const uint8_t* p, const uint8_t* end);
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE err_t setString(StringW& dst, const uint8_t* p, const uint8_t* end)
+  {
+    return dst.setUtf8(reinterpret_cast<const char*>(p), (size_t)(end - p));
+  }
+
+  static FOG_INLINE StubW toStub(const StringW& str)
+  {
+    return StubW(str.getData(), str.getLength());
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief SAX handler.
+  XmlSaxHandler* handler;
+  //! @brief Stream or @c NULL if parsing memory.
+  Stream* stream;
+
+  //! @brief Buffer (only used if parsing stream).
+  uint8_t* buffer;
+  //! @brief Buffer capacity.
+  size_t capacity;
+
+  //! @brief Start of data.
+  const uint8_t* data;
+  //! @brief End of data.
+  const uint8_t* end;
+
+  //! @brief Whether the end of the stream was reached.
+  bool eof;
+  //! @brief Current depth.
+  uint depth;
+  //! @brief Error, which happened during @c fetch().
+  err_t err;
+
+  //! @brief Location (not used at this time).
+  XmlSaxLocation location;
+
+  //! @brief Current tag name.
+  StringW tagName;
+  //! @brief Current attribute name or processing instruction target.
+  StringW attrName;
+  //! @brief Current attribute value or text.
+  StringW value;
+
+private:
+  FOG_NO_COPY(XmlSaxReader)
+};
+
+// ============================================================================
+// [Fog::XmlSaxReader - Construction / Destruction]
+// ============================================================================
+
+XmlSaxReader::XmlSaxReader(XmlSaxHandler* handler) :
+  handler(handler),
+  stream(NULL),
+  buffer(NULL),
+  capacity(0),
+  data(NULL),
+  end(NULL),
+  eof(true),
+  depth(0),
+  err(ERR_OK),
+  location(0, 0)
+{
+}
+
+XmlSaxReader::~XmlSaxReader()
+{
+  if (buffer != NULL)
+    MemMgr::free(buffer);
+}
+
+// ============================================================================
+// [Fog::XmlSaxReader - Init]
+// ============================================================================
+
+void XmlSaxReader::initMemory(const void* mem, size_t size)
+{
+  data = reinterpret_cast<const uint8_t*>(mem);
+  end = data + size;
+  eof = true;
+}
+
+err_t XmlSaxReader::initStream(Stream* stream)
+{
+  buffer = reinterpret_cast<uint8_t*>(MemMgr::alloc(XML_SAX_READER_CHUNK_SIZE));
+  if (FOG_IS_NULL(buffer))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  this->stream = stream;
+  capacity = XML_SAX_READER_CHUNK_SIZE;
+
+  data = buffer;
+  end = buffer;
+  eof = false;
+
+  // Fill the whole chunk so the encoding can be detected.
+  const uint8_t* mark = data;
+  const uint8_t* p = data;
+
+  while (end != buffer + capacity && fetch(mark, p))
+    continue;
+
+  return err;
+}
+
+// ============================================================================
+// [Fog::XmlSaxReader - Fetch]
+// ============================================================================
+
+bool XmlSaxReader::fetch(const uint8_t*& mark, const uint8_t*& p)
+{
+  if (eof)
+    return false;
+
+  size_t keep = (size_t)(end - mark);
+  size_t pos = (size_t)(p - mark);
+
+  // Compact the buffer, keeping only the construct being parsed.
+  if (mark != buffer && keep != 0)
+    MemOps::move(buffer, mark, keep);
+
+  // Grow if the construct doesn't fit into the buffer.
+  if (keep == capacity)
+  {
+    size_t newCapacity = capacity * 2;
+    uint8_t* newBuffer = reinterpret_cast<uint8_t*>(MemMgr::realloc(buffer, newCapacity));
+
+    if (FOG_IS_NULL(newBuffer))
+    {
+      err = ERR_RT_OUT_OF_MEMORY;
+      return false;
+    }
+
+    buffer = newBuffer;
+    capacity = newCapacity;
+  }
+
+  size_t n = stream->read(buffer + keep, capacity - keep);
+
+  data = buffer;
+  end = buffer + keep + n;
+
+  mark = buffer;
+  p = buffer + pos;
+
+  if (n == 0)
+  {
+    eof = true;
+    return false;
+  }
+
+  return true;
+}
+
+bool XmlSaxReader::findEnd(const uint8_t*& mark, const uint8_t*& p, uint32_t construct, size_t prefixLength)
+{
+  uint8_t quote = 0;
+  uint bracket = 0;
+
+  for (;;)
+  {
+    const uint8_t* e = end;
+
+    switch (construct)
+    {
+      case XML_SAX_READER_CONSTRUCT_TAG:
+      case XML_SAX_READER_CONSTRUCT_DOCTYPE:
+      {
+        while (p != e)
+        {
+          uint8_t c = *p++;
+
+          if (quote != 0)
+          {
+            if (c == quote)
+              quote = 0;
+            continue;
+          }
+
+          if (c == '\"' || c == '\'')
+          {
+            quote = c;
+            continue;
+          }
+
+          if (construct == XML_SAX_READER_CONSTRUCT_DOCTYPE)
+          {
+            if (c == '[')
+              bracket++;
+            else if (c == ']' && bracket > 0)
+              bracket--;
+          }
+
+          if (c == '>' && bracket == 0)
+            return true;
+        }
+        break;
+      }
+
+      case XML_SAX_READER_CONSTRUCT_CLOSE:
+      {
+        const uint8_t* q = XmlUtil_find8(p, e, '>');
+
+        if (q != NULL)
+        {
+          p = q + 1;
+          return true;
+        }
+
+        p = e;
+        break;
+      }
+
+      default:
+      {
+        // Terminated by "?>", "-->" or "]]>", the terminator can't overlap
+        // the prefix ("<?", "<!--" or "<![CDATA[").
+        uint8_t c0;
+        size_t seqLength;
+
+        if (construct == XML_SAX_READER_CONSTRUCT_PI)
+        {
+          c0 = '?';
+          seqLength = 2;
+        }
+        else
+        {
+          c0 = (construct == XML_SAX_READER_CONSTRUCT_COMMENT) ? '-' : ']';
+          seqLength = 3;
+        }
+
+        for (;;)
+        {
+          const uint8_t* q = XmlUtil_find8(p, e, '>');
+
+          if (q == NULL)
+          {
+            p = e;
+            break;
+          }
+
+          p = q + 1;
+
+          if ((size_t)(q - mark) >= prefixLength + seqLength - 1 &&
+              q[-1] == c0 &&
+              (seqLength == 2 || q[-2] == c0))
+          {
+            return true;
+          }
+        }
+        break;
+      }
+    }
+
+    if (!fetch(mark, p))
+      return false;
+  }
+}
+
+// ============================================================================
+// [Fog::XmlSaxReader - Parse]
+// ============================================================================
+
+err_t XmlSaxReader::parse()
+{
+  const uint8_t* p = data;
+
+  // Skip UTF-8 BOM.
+  if ((size_t)(end - p) >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+    p += 3;
+
+  handler->onStartDocument();
+
+  for (;;)
+  {
+    const uint8_t* mark = p;
+
+    if (p == end && !fetch(mark, p))
+    {
+      if (err != ERR_OK)
+        goto _End;
+      break;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Text]
+    // ------------------------------------------------------------------------
+
+    if (p[0] != '<')
+    {
+      for (;;)
+      {
+        const uint8_t* q = XmlUtil_find8(p, end, '<');
+
+        if (q != NULL)
+        {
+          p = q;
+          break;
+        }
+
+        p = end;
+        if (!fetch(mark, p))
+          break;
+      }
+
+      if (err != ERR_OK)
+        goto _End;
+
+      err = parseText(mark, p);
+      if (FOG_IS_ERROR(err))
+        goto _End;
+
+      continue;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Markup]
+    // ------------------------------------------------------------------------
+
+    while ((size_t)(end - p) < XML_SAX_READER_PREFIX_SIZE && fetch(mark, p))
+      continue;
+
+    if (err != ERR_OK)
+      goto _End;
+
+    {
+      size_t remain = (size_t)(end - p);
+
+      uint32_t construct;
+      size_t prefixLength;
+      err_t unclosedError;
+
+      if (remain >= 2 && p[1] == '/')
+      {
+        construct = XML_SAX_READER_CONSTRUCT_CLOSE;
+        prefixLength = 2;
+        unclosedError = ERR_XML_SAX_SYNTAX;
+      }
+      else if (remain >= 2 && p[1] == '?')
+      {
+        construct = XML_SAX_READER_CONSTRUCT_PI;
+        prefixLength = 2;
+        unclosedError = ERR_XML_SAX_UNCLOSED_PI;
+      }
+      else if (remain >= 2 && p[1] == '!')
+      {
+        if (remain >= 4 && p[2] == '-' && p[3] == '-')
+        {
+          construct = XML_SAX_READER_CONSTRUCT_COMMENT;
+          prefixLength = 4;
+          unclosedError = ERR_XML_SAX_UNCLOSED_COMMENT;
+        }
+        else if (remain >= 10 && StringUtil::eq(reinterpret_cast<const char*>(p) + 2, "DOCTYPE", 7, CASE_SENSITIVE) && XmlUtil_isSpace8(p[9]))
+        {
+          construct = XML_SAX_READER_CONSTRUCT_DOCTYPE;
+          prefixLength = 9;
+          unclosedError = ERR_XML_SAX_UNCLOSED_DOCTYPE;
+        }
+        else if (remain >= 9 && StringUtil::eq(reinterpret_cast<const char*>(p) + 2, "[CDATA[", 7, CASE_SENSITIVE))
+        {
+          construct = XML_SAX_READER_CONSTRUCT_CDATA;
+          prefixLength = 9;
+          unclosedError = ERR_XML_SAX_UNCLOSED_CDATA;
+        }
+        else
+        {
+          err = ERR_XML_SAX_SYNTAX;
+          goto _End;
+        }
+      }
+      else
+      {
+        construct = XML_SAX_READER_CONSTRUCT_TAG;
+        prefixLength = 1;
+        unclosedError = ERR_XML_SAX_SYNTAX;
+      }
+
+      p += prefixLength;
+      if (!findEnd(mark, p, construct, prefixLength))
+      {
+        if (err == ERR_OK)
+          err = unclosedError;
+        goto _End;
+      }
+
+      switch (construct)
+      {
+        case XML_SAX_READER_CONSTRUCT_TAG:
+          err = parseTag(mark + 1, p - 1);
+          break;
+
+        case XML_SAX_READER_CONSTRUCT_CLOSE:
+          err = parseClose(mark + 2, p - 1);
+          break;
+
+        case XML_SAX_READER_CONSTRUCT_DOCTYPE:
+          err = parseDOCTYPE(mark + 9, p - 1);
+          break;
+
+        case XML_SAX_READER_CONSTRUCT_PI:
+          err = parsePI(mark + 2, p - 2);
+          break;
+
+        case XML_SAX_READER_CONSTRUCT_COMMENT:
+          err = setString(value, mark + 4, p - 3);
+          if (FOG_IS_ERROR(err))
+            break;
+          err = handler->onComment(toStub(value));
+          break;
+
+        case XML_SAX_READER_CONSTRUCT_CDATA:
+          err = setString(value, mark + 9, p - 3);
+          if (FOG_IS_ERROR(err))
+            break;
+          err = handler->onCDATASection(toStub(value));
+          break;
+      }
+
+      if (FOG_IS_ERROR(err))
+        goto _End;
+    }
+  }
+
+  if (depth > 0)
+    err = ERR_XML_SAX_SYNTAX;
+
+_End:
+  handler->onEndDocument();
+  return err;
+}
+
+err_t XmlSaxReader::parseText(const uint8_t* p, const uint8_t* end)
+{
+  FOG_RETURN_ON_ERROR(setString(value, p, end));
+
+  if (XmlUtil_isWhiteSpace8(p, end))
+    return handler->onIgnorableWhitespace(toStub(value));
+  else
+    return handler->onCharacterData(toStub(value));
+}
+
+err_t XmlSaxReader::parseTag(const uint8_t* p, const uint8_t* end)
+{
+  p = XmlUtil_skipSpace8(p, end);
+
+  if (p == end || !XmlUtil_isNameStartChar8(p[0]))
+    return ERR_XML_SAX_SYNTAX;
+
+  const uint8_t* nameStart = p;
+  p = XmlUtil_skipName8(p, end);
+
+  bool isSelfClosing = (end != p && end[-1] == '/');
+  if (isSelfClosing)
+    end--;
+
+  FOG_RETURN_ON_ERROR(setString(tagName, nameStart, p));
+  FOG_RETURN_ON_ERROR(handler->onStartElement(toStub(tagName)));
+  depth++;
+
+  // Attributes must be separated from the tag name by whitespace.
+  if (p != end && !XmlUtil_isSpace8(p[0]))
+    return ERR_XML_SAX_SYNTAX;
+
+  FOG_RETURN_ON_ERROR(parseAttributes(p, end));
+
+  if (isSelfClosing)
+  {
+    depth--;
+    FOG_RETURN_ON_ERROR(handler->onEndElement(toStub(tagName)));
+  }
+
+  return ERR_OK;
+}
+
+err_t XmlSaxReader::parseClose(const uint8_t* p, const uint8_t* end)
+{
+  if (p == end || !XmlUtil_isNameStartChar8(p[0]))
+    return ERR_XML_SAX_SYNTAX;
+
+  const uint8_t* nameStart = p;
+  p = XmlUtil_skipName8(p, end);
+
+  if (!XmlUtil_isWhiteSpace8(p, end))
+    return ERR_XML_SAX_SYNTAX;
+
+  if (depth == 0)
+    return ERR_XML_SAX_UNMATCHED_CLOSING_TAG;
+
+  depth--;
+
+  FOG_RETURN_ON_ERROR(setString(tagName, nameStart, p));
+  return handler->onEndElement(toStub(tagName));
+}
+
+err_t XmlSaxReader::parseAttributes(const uint8_t* p, const uint8_t* end)
+{
+  for (;;)
+  {
+    p = XmlUtil_skipSpace8(p, end);
+    if (p == end)
+      return ERR_OK;
+
+    // Parse 'Name'.
+    if (!XmlUtil_isNameStartChar8(p[0]))
+      return ERR_XML_SAX_SYNTAX;
+
+    const uint8_t* nameStart = p;
+    const uint8_t* nameEnd = XmlUtil_skipName8(p, end);
+
+    // Parse 'Eq'.
+    p = XmlUtil_skipSpace8(nameEnd, end);
+    if (p == end || p[0] != '=')
+      return ERR_XML_SAX_SYNTAX;
+
+    p = XmlUtil_skipSpace8(p + 1, end);
+    if (p == end || (p[0] != '\"' && p[0] != '\''))
+      return ERR_XML_SAX_SYNTAX;
+
+    // Parse 'AttValue'.
+    const uint8_t* valueStart = p + 1;
+    const uint8_t* valueEnd = XmlUtil_find8(valueStart, end, p[0]);
+
+    if (valueEnd == NULL)
+      return ERR_XML_SAX_SYNTAX;
+
+    p = valueEnd + 1;
+
+    FOG_RETURN_ON_ERROR(setString(attrName, nameStart, nameEnd));
+    FOG_RETURN_ON_ERROR(setString(value, valueStart, valueEnd));
+
+    err_t e = handler->onAttribute(toStub(attrName), toStub(value));
+    if (FOG_IS_ERROR(e))
+      FOG_RETURN_ON_ERROR(handler->onError(location, e));
+  }
+}
+
+err_t XmlSaxReader::parseDOCTYPE(const uint8_t* p, const uint8_t* end)
+{
+  List<StringW> doctype;
+
+  for (;;)
+  {
+    p = XmlUtil_skipSpace8(p, end);
+    if (p == end)
+      break;
+
+    size_t length = doctype.getLength();
+
+    if (length < 2 && XmlUtil_isNameStartChar8(p[0]))
+    {
+      const uint8_t* nameStart = p;
+      p = XmlUtil_skipName8(p, end);
+
+      FOG_RETURN_ON_ERROR(setString(value, nameStart, p));
+      FOG_RETURN_ON_ERROR(doctype.append(value));
+    }
+    else if (length >= 2 && length < 4 && (p[0] == '\"' || p[0] == '\''))
+    {
+      const uint8_t* valueStart = p + 1;
+      const uint8_t* valueEnd = XmlUtil_find8(valueStart, end, p[0]);
+
+      if (valueEnd == NULL)
+        return ERR_XML_SAX_SYNTAX;
+
+      p = valueEnd + 1;
+
+      FOG_RETURN_ON_ERROR(setString(value, valueStart, valueEnd));
+      FOG_RETURN_ON_ERROR(doctype.append(value));
+    }
+    else if (p[0] == '[')
+    {
+      // The internal subset is not supported, skip it.
+      const uint8_t* q = XmlUtil_find8(p, end, ']');
+
+      if (q == NULL)
+        return ERR_XML_SAX_SYNTAX;
+
+      p = q + 1;
+    }
+    else
+    {
+      return ERR_XML_SAX_SYNTAX;
+    }
+  }
+
+  return handler->onDOCTYPE(doctype);
+}
+
+err_t XmlSaxReader::parsePI(const uint8_t* p, const uint8_t* end)
+{
+  const uint8_t* targetStart = p;
+  const uint8_t* targetEnd = p;
+
+  // Parse 'Target', we support also "no-target", like <? ... ?>.
+  if (p != end && XmlUtil_isNameStartChar8(p[0]))
+  {
+    targetEnd = XmlUtil_skipName8(p, end);
+    p = targetEnd;
+  }
+
+  // Parse 'S'.
+  if (p != end && !XmlUtil_isSpace8(p[0]))
+    return ERR_XML_SAX_SYNTAX;
+
+  p = XmlUtil_skipSpace8(p, end);
+
+  // Special case '<?xml...', the content is reported as attributes.
+  if ((size_t)(targetEnd - targetStart) == 3 &&
+      StringUtil::eq(reinterpret_cast<const char*>(targetStart), "xml", 3, CASE_INSENSITIVE))
+  {
+    return parseAttributes(p, end);
+  }
+
+  FOG_RETURN_ON_ERROR(setString(attrName, targetStart, targetEnd));
+  FOG_RETURN_ON_ERROR(setString(value, p, end));
+
+  return handler->onProcessingInstruction(toStub(attrName), toStub(value));
+}
+
 // ============================================================================
 // [Fog::XmlSaxParser - Construction / Destruction]
 // ============================================================================
@@ -343,6 +1123,17 @@ XmlSaxParser::~XmlSaxParser()
 // [Fog::XmlSaxParser - Parse]
 // ============================================================================
 
+static err_t XmlSaxParser_parseEncoded(XmlSaxParser* self, const TextCodec& textCodec, const void* mem, size_t size)
+{
+  StringW buffer;
+  err_t err = textCodec.decode(buffer, StubA(reinterpret_cast<const char*>(mem), size));
+
+  if (FOG_IS_ERROR(err))
+    return err;
+
+  return self->parseString(StubW(buffer.getData(), buffer.getLength()));
+}
+
 err_t XmlSaxParser::parseFile(const StringW& fileName)
 {
   Stream stream;
@@ -356,23 +1147,46 @@ err_t XmlSaxParser::parseFile(const StringW& fileName)
 
 err_t XmlSaxParser::parseStream(Stream& stream)
 {
+  XmlSaxReader reader(_handler);
+  FOG_RETURN_ON_ERROR(reader.initStream(&stream));
+
+  size_t size = (size_t)(reader.end - reader.data);
+  if (size == 0)
+    return ERR_XML_SAX_NO_DOCUMENT;
+
+  TextCodec textCodec = TextCodec::utf8();
+  XmlSaxParser_detectEncoding(textCodec, reader.data, size);
+
+  if (textCodec.getCode() == TEXT_ENCODING_UTF8)
+    return reader.parse();
+
+  // Other encodings are decoded to UTF-16 first, so the whole stream is read.
   StringA buffer;
-  stream.readAll(buffer);
-  return parseMemory(reinterpret_cast<const void*>(buffer.getData()), buffer.getLength());
+  StringA rest;
+
+  FOG_RETURN_ON_ERROR(buffer.set(StubA(reinterpret_cast<const char*>(reader.data), size)));
+  stream.readAll(rest);
+  FOG_RETURN_ON_ERROR(buffer.append(rest));
+
+  return XmlSaxParser_parseEncoded(this, textCodec, buffer.getData(), buffer.getLength());
 }
 
 err_t XmlSaxParser::parseMemory(const void* mem, size_t size)
 {
+  if (size == 0)
+    return ERR_XML_SAX_NO_DOCUMENT;
+
   TextCodec textCodec = TextCodec::utf8();
   XmlSaxParser_detectEncoding(textCodec, mem, size);
 
-  StringW buffer;
-  err_t err = textCodec.decode(buffer, StubA(reinterpret_cast<const char*>(mem), size));
-
-  if (FOG_IS_ERROR(err))
-    return err;
+  if (textCodec.getCode() == TEXT_ENCODING_UTF8)
+  {
+    XmlSaxReader reader(_handler);
+    reader.initMemory(mem, size);
+    return reader.parse();
+  }
 
-  return parseString(StubW(buffer.getData(), buffer.getLength()));
+  return XmlSaxParser_parseEncoded(this, textCodec, mem, size);
 }
 
 err_t XmlSaxParser::parseString(const StringW& str)
@@ -136,8 +136,21 @@ struct FOG_API XmlSaxParser
   // [Parse]
   // --------------------------------------------------------------------------
 
+  //! @brief Parse file @a fileName, see @ref parseStream().
   err_t parseFile(const StringW& fileName);
+
+  //! @brief Parse @a stream.
+  //!
+  //! UTF-8 documents are read by chunks and tokenized incrementally, only
+  //! names, values and text passed to the handler are converted to UTF-16,
+  //! so the memory used depends on the largest construct, not on the document
+  //! size. Documents in other encodings are read and decoded at once.
   err_t parseStream(Stream& stream);
+
+  //! @brief Parse memory block @a mem of @a size bytes.
+  //!
+  //! UTF-8 documents are tokenized in-place (this is also the preferred way
+  //! to parse a @c FileMapping).
   err_t parseMemory(const void* mem, size_t size);
   err_t parseString(const StringW& str);
   err_t parseString(const StubW& str);
@@ -90,6 +90,7 @@
 #include <Fog/G2d/Imaging/ImageFilterScale.h>
 #include <Fog/G2d/Imaging/ImageFormatDescription.h>
 #include <Fog/G2d/Imaging/ImagePalette.h>
+#include <Fog/G2d/Imaging/ImageResizer.h>
 #include <Fog/G2d/Imaging/Filters/FeBase.h>
 #include <Fog/G2d/Imaging/Filters/FeBlur.h>
 #include <Fog/G2d/Imaging/Filters/FeBorder.h>
@@ -130,6 +131,7 @@
 #include <Fog/G2d/Painting/PaintParams.h>
 #include <Fog/G2d/Painting/PaintUtil.h>
 #include <Fog/G2d/Painting/Painter.h>
+#include <Fog/G2d/Painting/Picture.h>
 
 // ============================================================================
 // [Fog/G2d/Shader]
@@ -0,0 +1,166 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_ACC_ACCAVX2_H
+#define _FOG_G2D_ACC_ACCAVX2_H
+
+// [Dependencies]
+#include <Fog/Core/Acc/AccAvx2.h>
+
+namespace Fog {
+namespace Acc {
+
+//! @addtogroup Fog_G2d_Acc_Avx2
+//! @{
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - IsAlpha]
+// ============================================================================
+
+//! @brief Get whether all 8 PRGB32 pixels in @a x0 have alpha set to 0xFF.
+static FOG_INLINE bool m256iPRGB32IsAlphaFF(const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI32_SET(FF000000, 0xFF000000);
+  return _mm256_testc_si256(x0, FOG_YMM_GET_CONST_PI(FF000000)) != 0;
+}
+
+//! @brief Get whether all 8 PRGB32 pixels in @a x0 are fully transparent.
+static FOG_INLINE bool m256iPRGB32IsAlpha00(const __m256i& x0)
+{
+  return _mm256_testz_si256(x0, x0) != 0;
+}
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - UnpackAlpha]
+// ============================================================================
+
+//! @brief Unpack the alpha of 8 ARGB32 pixels into two vectors of 16-bit
+//! words (pixels 0-1, 4-5 in @a dst0 and 2-3, 6-7 in @a dst1), matching
+//! m256iUnpackPI16FromPI8Lo/Hi.
+static FOG_INLINE void m256iUnpackAlphaPI16FromARGB32_PI8(__m256i& dst0, __m256i& dst1, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp0,
+    0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07,
+    0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03);
+
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp1,
+    0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x0B, 0x80, 0x0B,
+    0x80, 0x0B, 0x80, 0x0B);
+
+  m256iShufflePI8(dst0, x0, FOG_YMM_GET_CONST_PI(Tmp0));
+  m256iShufflePI8(dst1, x0, FOG_YMM_GET_CONST_PI(Tmp1));
+}
+
+//! @brief Like @ref m256iUnpackAlphaPI16FromARGB32_PI8, but returns the
+//! negated (255 - alpha) values.
+static FOG_INLINE void m256iUnpackNegAlphaPI16FromARGB32_PI8(__m256i& dst0, __m256i& dst1, const __m256i& x0)
+{
+  __m256i t0;
+
+  m256iFill(t0);
+  m256iXor(t0, t0, x0);
+  m256iUnpackAlphaPI16FromARGB32_PI8(dst0, dst1, t0);
+}
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - UnpackMask]
+// ============================================================================
+
+//! @brief Expand 8 mask values stored in DWORDs into 16-bit words laid out
+//! the same way as m256iUnpackPI16FromPI8Lo/Hi pixels.
+static FOG_INLINE void m256iUnpackMaskPI16FromPI32(__m256i& dst0, __m256i& dst1, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp0,
+    0x05, 0x04, 0x05, 0x04,
+    0x05, 0x04, 0x05, 0x04,
+    0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00);
+
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp1,
+    0x0D, 0x0C, 0x0D, 0x0C,
+    0x0D, 0x0C, 0x0D, 0x0C,
+    0x09, 0x08, 0x09, 0x08,
+    0x09, 0x08, 0x09, 0x08);
+
+  m256iShufflePI8(dst0, x0, FOG_YMM_GET_CONST_PI(Tmp0));
+  m256iShufflePI8(dst1, x0, FOG_YMM_GET_CONST_PI(Tmp1));
+}
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - FillAlpha]
+// ============================================================================
+
+static FOG_INLINE void m256iFillPBB3(__m256i& dst0, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI32_SET(FF000000, 0xFF000000);
+  m256iOr(dst0, x0, FOG_YMM_GET_CONST_PI(FF000000));
+}
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - Premultiply]
+// ============================================================================
+
+//! @brief Premultiply 8 ARGB32 pixels (exact, the same as the C version).
+static FOG_INLINE void m256iPRGB32FromARGB32(__m256i& dst0, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI8_VAR(AlphaOr,
+    0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00);
+
+  __m256i a0, a1;
+  __m256i p0, p1;
+
+  m256iUnpackAlphaPI16FromARGB32_PI8(a0, a1, x0);
+  m256iUnpackPI16FromPI8Lo(p0, x0);
+  m256iUnpackPI16FromPI8Hi(p1, x0);
+
+  // Multiply alpha by 0xFF (keeps it unchanged after MulDiv255).
+  m256iOr(p0, p0, FOG_YMM_GET_CONST_PI(AlphaOr));
+  m256iOr(p1, p1, FOG_YMM_GET_CONST_PI(AlphaOr));
+  m256iMulDiv255PI16_2x(p0, p0, a0, p1, p1, a1);
+
+  m256iPackPU8FromPU16(dst0, p0, p1);
+}
+
+// ============================================================================
+// [Fog::Acc::AVX2 - Raster - BSwap]
+// ============================================================================
+
+static FOG_INLINE void m256iBSwapPI32(__m256i& dst0, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp,
+    0x0C, 0x0D, 0x0E, 0x0F,
+    0x08, 0x09, 0x0A, 0x0B,
+    0x04, 0x05, 0x06, 0x07,
+    0x00, 0x01, 0x02, 0x03);
+
+  m256iShufflePI8(dst0, x0, FOG_YMM_GET_CONST_PI(Tmp));
+}
+
+static FOG_INLINE void m256iBSwapPI16(__m256i& dst0, const __m256i& x0)
+{
+  FOG_YMM_DECLARE_CONST_PI8_VAR(Tmp,
+    0x0E, 0x0F, 0x0C, 0x0D,
+    0x0A, 0x0B, 0x08, 0x09,
+    0x06, 0x07, 0x04, 0x05,
+    0x02, 0x03, 0x00, 0x01);
+
+  m256iShufflePI8(dst0, x0, FOG_YMM_GET_CONST_PI(Tmp));
+}
+
+//! @}
+
+} // Acc namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_ACC_ACCAVX2_H
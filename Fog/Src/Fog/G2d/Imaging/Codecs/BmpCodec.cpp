@@ -48,6 +48,12 @@ static bool _BmpCheckDepth(uint32_t depth)
          depth == 32 ;
 }
 
+static FOG_INLINE uint32_t _BmpReadU32(const uint8_t* p)
+{
+  return ((uint32_t)p[0]      ) | ((uint32_t)p[1] <<  8) |
+         ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
 static void _BmpSwapFileHeader(BmpFileHeader* h)
 {
 #if FOG_BYTE_ORDER == FOG_BIG_ENDIAN
@@ -473,10 +479,7 @@ err_t BmpDecoder::readImage(Image& image)
   uint32_t y = 0;
   uint32_t i;
 
-  MemBufferTmp<512> rawBufferStorage;
   MemBufferTmp<512> rleBufferStorage;
-
-  uint8_t* buffer = reinterpret_cast<uint8_t*>(rawBufferStorage.alloc(bmpStride));
   uint8_t* rleBuffer = NULL;
 
   // First skip bytes if needed.
@@ -491,6 +494,16 @@ err_t BmpDecoder::readImage(Image& image)
   if (FOG_IS_ERROR(err))
     goto _End;
 
+  // --------------------------------------------------------------------------
+  // [Read - Raw]
+  // --------------------------------------------------------------------------
+
+  if (!_isRle())
+  {
+    err = _readRows(image, 0, (uint32_t)_size.h);
+    goto _End;
+  }
+
   pixelsBegin = image.getFirstX();
   stride = image.getStride();
 
@@ -502,57 +515,11 @@ err_t BmpDecoder::readImage(Image& image)
 
   pixelsCur = pixelsBegin;
 
-  // --------------------------------------------------------------------------
-  // [Read - 1 Bit]
-  // --------------------------------------------------------------------------
-
-  if (_depth == 1)
-  {
-    FOG_ASSERT(_format == IMAGE_FORMAT_I8);
-
-    if (bmpCompression == BMP_BI_RGB)
-    {
-      uint8_t* bufferCur;
-      uint32_t b;
-
-      for (y = 0; y != (uint)_size.h; y++)
-      {
-        if (_stream.read(buffer, bmpStride) != bmpStride) goto _Truncated;
-        bufferCur = buffer;
-        pixelsCur = pixelsBegin + (ssize_t)y * stride;
-
-        for (i = _size.w; i >= 8; i -= 8, pixelsCur += 8, bufferCur++)
-        {
-          b = (uint32_t)(*bufferCur);
-          ((uint8_t *)pixelsCur)[0] = (uint8_t)((b >> 7) & 1);
-          ((uint8_t *)pixelsCur)[1] = (uint8_t)((b >> 6) & 1);
-          ((uint8_t *)pixelsCur)[2] = (uint8_t)((b >> 5) & 1);
-          ((uint8_t *)pixelsCur)[3] = (uint8_t)((b >> 4) & 1);
-          ((uint8_t *)pixelsCur)[4] = (uint8_t)((b >> 3) & 1);
-          ((uint8_t *)pixelsCur)[5] = (uint8_t)((b >> 2) & 1);
-          ((uint8_t *)pixelsCur)[6] = (uint8_t)((b >> 1) & 1);
-          ((uint8_t *)pixelsCur)[7] = (uint8_t)((b     ) & 1);
-        }
-
-        if (i)
-        {
-          b = (uint32_t)(*bufferCur);
-          for (; i; i--, pixelsCur += 1, b <<= 1)
-          {
-            ((uint8_t *)pixelsCur)[0] = (uint8_t)((b >> 7) & 1);
-          }
-        }
-
-        if ((y & 15) == 0) { updateProgress(y, _size.h); }
-      }
-    }
-  }
-
   // --------------------------------------------------------------------------
   // [Read - 4 Bits RLE]
   // --------------------------------------------------------------------------
 
-  else if (_depth == 4 && bmpCompression == BMP_BI_RLE4)
+  if (_depth == 4)
   {
     uint8_t* rleCur;
     uint8_t* rleEnd;
@@ -657,44 +624,11 @@ _Rle4Start:
     }
   }
 
-  // --------------------------------------------------------------------------
-  // [Read - 4 Bits RAW]
-  // --------------------------------------------------------------------------
-
-  else if (_depth == 4)
-  {
-    FOG_ASSERT(_format == IMAGE_FORMAT_I8);
-
-    uint8_t* bufferCur;
-    uint8_t b;
-
-    for (y = 0; y != (uint)_size.h; y++)
-    {
-      if (_stream.read(buffer, bmpStride) != bmpStride)
-        goto _Truncated;
-
-      bufferCur = buffer;
-      pixelsCur = pixelsBegin + (ssize_t)y * stride;
-
-      for (x = 0; x + 2 <= (uint32_t)_size.w; x += 2)
-      {
-        b = *bufferCur++;
-        *pixelsCur++ = b >> 4;
-        *pixelsCur++ = b & 0xF;
-      }
-      if (x < (uint32_t)_size.w)
-      {
-        *pixelsCur = *bufferCur >> 4;
-      }
-      if ((y & 15) == 0) updateProgress(y, _size.h);
-    }
-  }
-
   // --------------------------------------------------------------------------
   // [Read - 8 Bits RLE]
   // --------------------------------------------------------------------------
 
-  else if (_depth == 8 && bmpCompression == BMP_BI_RLE8)
+  else
   {
     uint8_t* rleCur;
     uint8_t* rleEnd;
@@ -783,15 +717,145 @@ _Rle8Start:
     updateProgress(y, _size.h);
   }
 
+  goto _End;
+
+_Truncated:
+  err = ERR_IMAGE_TRUNCATED;
+  goto _End;
+
+_RleError:
+  err = ERR_IMAGE_MALFORMED_RLE;
+  goto _End;
+
+_OutOfMemory:
+  err = ERR_RT_OUT_OF_MEMORY;
+  goto _End;
+
+_End:
+  image._modified();
+  // Apply palette if needed.
+  if (_depth <= 8 && !image.isEmpty()) image.setPalette(_palette);
+
+  if (err == ERR_OK) updateProgress(1.0f);
+  return (_readerResult = err);
+}
+
+// ============================================================================
+// [Fog::BmpDecoder - ReadRows]
+// ============================================================================
+
+err_t BmpDecoder::_readRows(Image& image, uint32_t y, uint32_t count)
+{
+  // Buffer pointers.
+  uint8_t* pixelsBegin = image.getFirstX();
+  uint8_t* pixelsCur;
+  ssize_t stride = image.getStride();
+
+  // Reader variables.
+  uint32_t yEnd = y + count;
+  uint32_t x;
+  uint32_t i;
+
+  MemBufferTmp<512> rawBufferStorage;
+  uint8_t* buffer = reinterpret_cast<uint8_t*>(rawBufferStorage.alloc(bmpStride));
+
+  if (FOG_IS_NULL(buffer))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  if (!bmpReversed)
+  {
+    pixelsBegin += (_size.h - 1) * stride;
+    stride = -stride;
+  }
+
   // --------------------------------------------------------------------------
-  // [Read - 8 Bits RAW]
+  // [Read - 1 Bit]
+  // --------------------------------------------------------------------------
+
+  if (_depth == 1)
+  {
+    FOG_ASSERT(_format == IMAGE_FORMAT_I8);
+
+    if (bmpCompression == BMP_BI_RGB)
+    {
+      uint8_t* bufferCur;
+      uint32_t b;
+
+      for (; y != yEnd; y++)
+      {
+        if (_stream.read(buffer, bmpStride) != bmpStride) goto _Truncated;
+        bufferCur = buffer;
+        pixelsCur = pixelsBegin + (ssize_t)y * stride;
+
+        for (i = _size.w; i >= 8; i -= 8, pixelsCur += 8, bufferCur++)
+        {
+          b = (uint32_t)(*bufferCur);
+          ((uint8_t *)pixelsCur)[0] = (uint8_t)((b >> 7) & 1);
+          ((uint8_t *)pixelsCur)[1] = (uint8_t)((b >> 6) & 1);
+          ((uint8_t *)pixelsCur)[2] = (uint8_t)((b >> 5) & 1);
+          ((uint8_t *)pixelsCur)[3] = (uint8_t)((b >> 4) & 1);
+          ((uint8_t *)pixelsCur)[4] = (uint8_t)((b >> 3) & 1);
+          ((uint8_t *)pixelsCur)[5] = (uint8_t)((b >> 2) & 1);
+          ((uint8_t *)pixelsCur)[6] = (uint8_t)((b >> 1) & 1);
+          ((uint8_t *)pixelsCur)[7] = (uint8_t)((b     ) & 1);
+        }
+
+        if (i)
+        {
+          b = (uint32_t)(*bufferCur);
+          for (; i; i--, pixelsCur += 1, b <<= 1)
+          {
+            ((uint8_t *)pixelsCur)[0] = (uint8_t)((b >> 7) & 1);
+          }
+        }
+
+        if ((y & 15) == 0) { updateProgress(y, _size.h); }
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Read - 4 Bits]
+  // --------------------------------------------------------------------------
+
+  else if (_depth == 4)
+  {
+    FOG_ASSERT(_format == IMAGE_FORMAT_I8);
+
+    uint8_t* bufferCur;
+    uint8_t b;
+
+    for (; y != yEnd; y++)
+    {
+      if (_stream.read(buffer, bmpStride) != bmpStride)
+        goto _Truncated;
+
+      bufferCur = buffer;
+      pixelsCur = pixelsBegin + (ssize_t)y * stride;
+
+      for (x = 0; x + 2 <= (uint32_t)_size.w; x += 2)
+      {
+        b = *bufferCur++;
+        *pixelsCur++ = b >> 4;
+        *pixelsCur++ = b & 0xF;
+      }
+      if (x < (uint32_t)_size.w)
+      {
+        *pixelsCur = *bufferCur >> 4;
+      }
+      if ((y & 15) == 0) updateProgress(y, _size.h);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Read - 8 Bits]
   // --------------------------------------------------------------------------
 
   else if (_depth == 8)
   {
-    for (y = 0; y < (uint32_t)_size.h; y++)
+    for (; y != yEnd; y++)
     {
-      pixelsCur = pixelsBegin + (_size.h - y - 1) * stride;
+      pixelsCur = pixelsBegin + (ssize_t)y * stride;
 
       if (_stream.read(pixelsCur, bmpStride) != bmpStride)
         goto _Truncated;
@@ -809,16 +873,18 @@ _Rle8Start:
   {
     ImageConverter converter;
 
-    err = converter.create(ImageFormatDescription::getByFormat(_format), bmpFormat);
+    err_t err = converter.create(ImageFormatDescription::getByFormat(_format), bmpFormat);
     if (FOG_IS_ERROR(err))
-      goto _End;
+      return err;
+
+    pixelsCur = pixelsBegin + (ssize_t)y * stride;
 
     if (converter.isCopy())
     {
       size_t readBytes = _size.w * (_depth >> 3);
       size_t zeroBytes = bmpStride - readBytes;
 
-      for (y = 0; y < (uint32_t)_size.h; y++, pixelsCur += stride)
+      for (; y != yEnd; y++, pixelsCur += stride)
       {
         if (_stream.read(pixelsCur, readBytes) != readBytes)
           goto _Truncated;
@@ -831,8 +897,8 @@ _Rle8Start:
     }
     else
     {
-      PointI ditherOrigin(0, 0);
-      for (y = 0; y < (uint32_t)_size.h; y++, pixelsCur += stride, ditherOrigin.y++)
+      PointI ditherOrigin(0, (int)y);
+      for (; y != yEnd; y++, pixelsCur += stride, ditherOrigin.y++)
       {
         if (_stream.read(buffer, bmpStride) != bmpStride)
           goto _Truncated;
@@ -842,27 +908,114 @@ _Rle8Start:
       }
     }
   }
-  goto _End;
+
+  return ERR_OK;
 
 _Truncated:
-  err = ERR_IMAGE_TRUNCATED;
-  goto _End;
+  return ERR_IMAGE_TRUNCATED;
+}
 
-_RleError:
-  err = ERR_IMAGE_MALFORMED_RLE;
-  goto _End;
+// ============================================================================
+// [Fog::BmpDecoder - Feed]
+// ============================================================================
 
-_OutOfMemory:
-  err = ERR_RT_OUT_OF_MEMORY;
-  goto _End;
+err_t BmpDecoder::_feed(bool end)
+{
+  // The BMP embedded in ICO has no file header, so it's not possible to know
+  // where the pixels start. The ICO decoder gets the whole entry anyway.
+  if (_skipFileHeader)
+    return Base::_feed(end);
 
-_End:
-  image._modified();
-  // Apply palette if needed.
-  if (_depth <= 8 && !image.isEmpty()) image.setPalette(_palette);
+  size_t available = _getFeedAvailable();
 
-  if (err == ERR_OK) updateProgress(1.0f);
-  return (_readerResult = err);
+  // --------------------------------------------------------------------------
+  // [Header]
+  // --------------------------------------------------------------------------
+
+  if (!isHeaderDone())
+  {
+    // The file header contains the offset of the pixels, the header, palette
+    // and bitfields are all before it.
+    size_t required = sizeof(BmpFileHeader) + 4;
+
+    if (available >= sizeof(BmpFileHeader) + 20)
+    {
+      StringA buffer = _stream.getBuffer();
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
+
+      uint32_t imageOffset = _BmpReadU32(data + 10);
+      uint32_t headerSize = _BmpReadU32(data + 14);
+      uint32_t compression = _BmpReadU32(data + 30);
+
+      required = (size_t)sizeof(BmpFileHeader) + headerSize;
+      if (headerSize == BMP_HEADER_SIZE_WIN_V3 && compression == BMP_BI_BITFIELDS)
+        required += 12;
+      required = Math::max<size_t>(required, imageOffset);
+    }
+
+    if (available < required && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    FOG_RETURN_ON_ERROR(readHeader());
+    available = _getFeedAvailable();
+  }
+
+  // --------------------------------------------------------------------------
+  // [RLE]
+  // --------------------------------------------------------------------------
+
+  // RLE can move the position anywhere in the image, it's decoded at once.
+  if (_isRle())
+  {
+    if (available < (size_t)bmpSkipBytes + bmpImageSize && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    err_t err = readImage(_feedImage);
+    if (err == ERR_OK)
+      _feedRows(0, _size.h);
+    return err;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Raw]
+  // --------------------------------------------------------------------------
+
+  if (_feedImage.isEmpty())
+  {
+    if (available < bmpSkipBytes)
+      return end ? (err_t)ERR_IMAGE_TRUNCATED : (err_t)ERR_IMAGE_NEED_MORE_DATA;
+
+    _stream.seek(bmpSkipBytes, STREAM_SEEK_CUR);
+    available -= bmpSkipBytes;
+
+    FOG_RETURN_ON_ERROR(_feedImage.create(_size, _format));
+    if (_depth <= 8) _feedImage.setPalette(_palette);
+
+    bmpFeedRow = 0;
+  }
+
+  uint32_t count = Math::min<uint32_t>((uint32_t)(available / bmpStride), (uint32_t)_size.h - bmpFeedRow);
+  if (count > 0)
+  {
+    FOG_RETURN_ON_ERROR(_readRows(_feedImage, bmpFeedRow, count));
+    _feedImage._modified();
+
+    // Rows are stored from bottom to top, unless the image is reversed.
+    if (bmpReversed)
+      _feedRows((int)bmpFeedRow, (int)count);
+    else
+      _feedRows(_size.h - (int)(bmpFeedRow + count), (int)count);
+
+    bmpFeedRow += count;
+  }
+
+  if (bmpFeedRow == (uint32_t)_size.h)
+  {
+    updateProgress(1.0f);
+    return ERR_OK;
+  }
+
+  return end ? (err_t)ERR_IMAGE_TRUNCATED : (err_t)ERR_IMAGE_NEED_MORE_DATA;
 }
 
 err_t BmpDecoder::_getProperty(const InternedStringW& name, Var& dst) const
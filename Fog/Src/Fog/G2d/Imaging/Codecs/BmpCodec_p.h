@@ -266,6 +266,12 @@ struct FOG_NO_EXPORT BmpDecoder : public ImageDecoder
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
 
+  // --------------------------------------------------------------------------
+  // [Feed]
+  // --------------------------------------------------------------------------
+
+  virtual err_t _feed(bool end);
+
   // --------------------------------------------------------------------------
   // [Properties]
   // --------------------------------------------------------------------------
@@ -277,6 +283,16 @@ struct FOG_NO_EXPORT BmpDecoder : public ImageDecoder
   // [Helpers]
   // --------------------------------------------------------------------------
 
+  //! @brief Get whether the bitmap is RLE compressed (decoded at once).
+  FOG_INLINE bool _isRle() const
+  {
+    return (_depth == 4 && bmpCompression == BMP_BI_RLE4) ||
+           (_depth == 8 && bmpCompression == BMP_BI_RLE8);
+  }
+
+  //! @brief Read @a count uncompressed rows starting at row @a y (file order).
+  err_t _readRows(Image& image, uint32_t y, uint32_t count);
+
   // Clear everything.
   FOG_INLINE void zeroall()
   {
@@ -301,6 +317,8 @@ struct FOG_NO_EXPORT BmpDecoder : public ImageDecoder
   // How many bytes to skip to get the bitmap data.
   uint32_t bmpSkipBytes;
   uint32_t bmpReversed;
+  // Count of rows already decoded in feed mode.
+  uint32_t bmpFeedRow;
 
   //! @brief Used by the IcoDecoder to skip uninteresing part
   int _skipFileHeader;
@@ -15,6 +15,7 @@
 // [Dependencies]
 #include <Fog/Core/Global/Init_p.h>
 #include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/Tools/InternedString.h>
 #include <Fog/Core/Tools/Stream.h>
@@ -25,6 +26,7 @@
 #include <Fog/G2d/Imaging/ImageConverter.h>
 #include <Fog/G2d/Imaging/ImageDecoder.h>
 #include <Fog/G2d/Imaging/ImageEncoder.h>
+#include <Fog/G2d/Tools/ColorQuantizer_p.h>
 
 #include <string.h>
 
@@ -1821,6 +1823,13 @@ static int EGifPutImageDesc(GifFileType * GifFile,
   GifFile->Image.Height = Height;
   GifFile->Image.Interlace = Interlace;
 
+  // Local color map of the previous image (when writing more frames).
+  if (GifFile->Image.ColorMap)
+  {
+    FreeMapObject(GifFile->Image.ColorMap);
+    GifFile->Image.ColorMap = NULL;
+  }
+
   if (ColorMap)
   {
     GifFile->Image.ColorMap = MakeMapObject(ColorMap->ColorCount,
@@ -2576,6 +2585,35 @@ namespace Fog {
 // [Fog::GifDecoder]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Frame of an animated GIF, found by @c GifDecoder::_scanFrames().
+struct GifFrame
+{
+  //! @brief Stream offset of the image descriptor.
+  int64_t offset;
+  //! @brief Frame rectangle (not clipped to the canvas).
+  int x, y, w, h;
+  //! @brief Delay in milliseconds.
+  uint32_t delay;
+  //! @brief Disposal, see @c IMAGE_DISPOSAL.
+  uint32_t disposal;
+  //! @brief Transparent color index or -1.
+  int transparent;
+  //! @brief Whether the frame doesn't depend on the previous frames (it's
+  //! opaque, covers the whole canvas and isn't restored).
+  bool keyframe;
+};
+
+//! @internal
+enum GIF_KEYFRAME
+{
+  //! @brief Canvas is cached every GIF_KEYFRAME_INTERVAL frames.
+  GIF_KEYFRAME_INTERVAL = 16,
+  //! @brief Maximum count of cached canvases.
+  GIF_KEYFRAME_CACHE = 8
+};
+
 struct FOG_NO_EXPORT GifDecoder : public ImageDecoder
 {
   FOG_DECLARE_OBJECT(GifDecoder, ImageDecoder)
@@ -2587,17 +2625,64 @@ struct FOG_NO_EXPORT GifDecoder : public ImageDecoder
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
 
+  virtual err_t readFramesCount(uint32_t* count);
+  virtual err_t readFrameInfo(uint32_t index, ImageFrameInfo& info);
+  virtual err_t seekFrame(uint32_t index);
+  virtual err_t readFrame(RectI* dirty);
+
+  virtual err_t _feed(bool end);
+
 private:
   GifFileType* _context;
 
+  // Frames found so far.
+  GifFrame* _frames;
+  uint32_t _framesFound;
+  uint32_t _framesCapacity;
+  // Stream offset of the first record not scanned yet.
+  int64_t _scanOffset;
+  bool _scanDone;
+
+  // Disposal of the last composited frame.
+  uint32_t _disposal;
+  RectI _disposalRect;
+  Image _disposalBackup;
+
+  // Canvas before drawing frame _keyframeIndex[i].
+  Image _keyframeImage[GIF_KEYFRAME_CACHE];
+  uint32_t _keyframeIndex[GIF_KEYFRAME_CACHE];
+
+  // Feed mode state.
+  GifPixelType* _feedLine;
+  int _feedTransparent;
+  int _feedPass;
+  int _feedRow;
+
   bool openGif();
   void closeGif();
+
+  err_t _scanFrames(uint32_t until);
+  err_t _addFrame(const GifFrame& frame);
+  err_t _drawFrame(const GifFrame& frame, RectI& dirty);
 };
 
 // ============================================================================
 // [Fog::GifEncoder]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief GIF89a encoder.
+//!
+//! Each call to @c writeImage() adds a frame. If the @c framesCount property
+//! is zero (default) the first frame also finishes the file, otherwise the
+//! file is finished when @c framesCount frames were written or when the stream
+//! is detached.
+//!
+//! Only the rectangle which changed since the previous frame is written, the
+//! unchanged pixels inside are written as transparent. The frame is kept until
+//! the next one is known, because a frame which needs to clear some pixels to
+//! transparent is only possible if the previous frame was disposed.
 struct FOG_NO_EXPORT GifEncoder : public ImageEncoder
 {
   FOG_DECLARE_OBJECT(GifEncoder, ImageEncoder)
@@ -2605,7 +2690,43 @@ struct FOG_NO_EXPORT GifEncoder : public ImageEncoder
   GifEncoder(ImageCodecProvider* provider);
   virtual ~GifEncoder();
 
+  virtual err_t _getProperty(const InternedStringW& name, Var& dst) const;
+  virtual err_t _setProperty(const InternedStringW& name, const Var& src);
+
   virtual err_t writeImage(const Image& image);
+
+protected:
+  virtual void reset();
+  virtual void finalize();
+
+private:
+  GifFileType* _context;
+
+  // Properties.
+  uint32_t _delay;
+  uint32_t _loopCount;
+  uint32_t _dither;
+
+  // Frames passed to writeImage().
+  uint32_t _framesWritten;
+  bool _animated;
+
+  // Normalized ARGB32 pixels (transparent pixels are zero) of the canvas before
+  // the pending frame is drawn, of the pending frame and of the new frame.
+  uint32_t* _canvas;
+  uint32_t* _pending;
+  uint32_t* _frame;
+
+  RectI _pendingRect;
+  uint32_t _pendingDelay;
+  bool _hasPending;
+
+  ColorQuantizer _quantizer;
+
+  err_t _writeHeader();
+  err_t _writePending(uint32_t disposal);
+  err_t _finish();
+  void closeGif();
 };
 
 // ============================================================================
@@ -2628,7 +2749,7 @@ GifCodecProvider::GifCodecProvider()
   _name = FOG_S(GIF);
 
   // Supported codecs.
-  _codecType = IMAGE_CODEC_DECODER;
+  _codecType = IMAGE_CODEC_DECODER | IMAGE_CODEC_ENCODER;
 
   // Supported streams.
   _streamType = IMAGE_STREAM_GIF;
@@ -2650,8 +2771,7 @@ uint32_t GifCodecProvider::checkSignature(const void* mem, size_t length) const
   if (memcmp(m, "GIF", 3) != 0) return 0;
 
   if (length < 6) return 75;
-  if (memcmp(m + 3, "87a", 3) != 0) return 0;
-  if (memcmp(m + 3, "89a", 3) != 0) return 0;
+  if (memcmp(m + 3, "87a", 3) != 0 && memcmp(m + 3, "89a", 3) != 0) return 0;
 
   return 90;
 }
@@ -2666,7 +2786,8 @@ err_t GifCodecProvider::createCodec(uint32_t codecType, ImageCodec** codec) cons
       c = fog_new GifDecoder(const_cast<GifCodecProvider*>(this));
       break;
     case IMAGE_CODEC_ENCODER:
-      return ERR_IMAGE_NO_ENCODER;
+      c = fog_new GifEncoder(const_cast<GifCodecProvider*>(this));
+      break;
     default:
       return ERR_RT_INVALID_ARGUMENT;
   }
@@ -2677,14 +2798,117 @@ err_t GifCodecProvider::createCodec(uint32_t codecType, ImageCodec** codec) cons
   return ERR_OK;
 }
 
+// ============================================================================
+// [Fog::GifDecoder - Helpers]
+// ============================================================================
+
+static const int _GifInterlaceOffset[] = { 0, 4, 2, 1 };
+static const int _GifInterlaceJump[] = { 8, 8, 4, 2 };
+
+// Convert one row of color indexes to XRGB32/PRGB32 pixels, the transparent
+// color index is converted to a fully transparent pixel.
+static void _GifConvertRow(uint32_t* dst, const GifPixelType* src, int w, const ColorMapObject* cmap, int transp)
+{
+  int count = cmap ? cmap->ColorCount : 0;
+
+  for (int x = 0; x < w; x++)
+  {
+    int index = src[x];
+
+    if (index == transp)
+    {
+      dst[x] = 0;
+    }
+    else if (index < count)
+    {
+      const GifColorType& c = cmap->Colors[index];
+      dst[x] = 0xFF000000 | ((uint32_t)c.Red << 16) | ((uint32_t)c.Green << 8) | (uint32_t)c.Blue;
+    }
+    else
+    {
+      dst[x] = 0xFF000000;
+    }
+  }
+}
+
+// Composite one row of color indexes to PRGB32 pixels, the transparent color
+// index keeps the destination pixel.
+static void _GifCompositeRow(uint32_t* dst, const GifPixelType* src, int w, const ColorMapObject* cmap, int transp)
+{
+  int count = cmap ? cmap->ColorCount : 0;
+
+  for (int x = 0; x < w; x++)
+  {
+    int index = src[x];
+
+    if (index == transp)
+      continue;
+
+    if (index < count)
+    {
+      const GifColorType& c = cmap->Colors[index];
+      dst[x] = 0xFF000000 | ((uint32_t)c.Red << 16) | ((uint32_t)c.Green << 8) | (uint32_t)c.Blue;
+    }
+    else
+    {
+      dst[x] = 0xFF000000;
+    }
+  }
+}
+
+// Skip the chain of data sub-blocks in the stream.
+static bool _GifSkipBlocks(Stream& stream)
+{
+  for (;;)
+  {
+    uint8_t blockSize;
+    if (stream.read(&blockSize, 1) != 1) return false;
+    if (blockSize == 0) return true;
+    if (stream.seek(blockSize, STREAM_SEEK_CUR) == -1) return false;
+  }
+}
+
+// Walk the chain of data sub-blocks in [data, data + size). Returns true and
+// stores the chain size (including the terminator) to 'chainSize' if the
+// chain is complete.
+static bool _GifScanBlocks(const uint8_t* data, size_t size, size_t* chainSize)
+{
+  size_t i = 0;
+
+  while (i < size)
+  {
+    size_t blockSize = data[i];
+    if (blockSize == 0)
+    {
+      *chainSize = i + 1;
+      return true;
+    }
+    i += blockSize + 1;
+  }
+
+  return false;
+}
+
 // ============================================================================
 // [Fog::GifDecoder]
 // ============================================================================
 
 GifDecoder::GifDecoder(ImageCodecProvider* provider) :
   ImageDecoder(provider),
-  _context(NULL)
-{
+  _context(NULL),
+  _frames(NULL),
+  _framesFound(0),
+  _framesCapacity(0),
+  _scanOffset(0),
+  _scanDone(false),
+  _disposal(IMAGE_DISPOSAL_NONE),
+  _feedLine(NULL),
+  _feedTransparent(-1),
+  _feedPass(0),
+  _feedRow(0)
+{
+  for (uint32_t i = 0; i < GIF_KEYFRAME_CACHE; i++)
+    _keyframeIndex[i] = 0xFFFFFFFF;
 }
 
 GifDecoder::~GifDecoder()
@@ -2709,6 +2933,30 @@ void GifDecoder::closeGif()
 {
   if (_context) DGifCloseFile(_context);
   _context = NULL;
+
+  if (_feedLine) Fog::MemMgr::free(_feedLine);
+  _feedLine = NULL;
+
+  _feedTransparent = -1;
+  _feedPass = 0;
+  _feedRow = 0;
+
+  if (_frames) Fog::MemMgr::free(_frames);
+  _frames = NULL;
+  _framesFound = 0;
+  _framesCapacity = 0;
+  _scanOffset = 0;
+  _scanDone = false;
+
+  _disposal = IMAGE_DISPOSAL_NONE;
+  _disposalRect.reset();
+  _disposalBackup.reset();
+
+  for (uint32_t i = 0; i < GIF_KEYFRAME_CACHE; i++)
+  {
+    _keyframeImage[i].reset();
+    _keyframeIndex[i] = 0xFFFFFFFF;
+  }
 }
 
 err_t GifDecoder::readHeader()
@@ -2730,154 +2978,1063 @@ err_t GifDecoder::readHeader()
 
   _format = IMAGE_FORMAT_I8;
 
+  // Frames are scanned on demand, starting after the header.
+  _scanOffset = _stream.tell();
+
   // Success.
   return (_headerResult = ERR_OK);
 }
 
 err_t GifDecoder::readImage(Image& image)
 {
-  // read gif header
-  if (readHeader() != ERR_OK) return getHeaderResult();
+  // Each call returns the next composited frame.
+  FOG_RETURN_ON_ERROR(readFrame(NULL));
 
-  uint32_t *ptr;
-  GifRowType *rows = NULL;
-  GifRecordType rec;
-  ColorMapObject *cmap;
-  int i, j, done = 0, bg, r, g, b, w = 0, h = 0;
-  int intoffset[] = { 0, 4, 2, 1 };
-  int intjump[] = { 8, 8, 4, 2 };
-  int transp = -1;
-  err_t error = ERR_OK;
-  uint32_t format = IMAGE_FORMAT_XRGB32;
+  image = _frameCanvas;
+  return ERR_OK;
+}
 
-  do {
-    if (DGifGetRecordType(_context, &rec) == GIF_ERROR)
+// ============================================================================
+// [Fog::GifDecoder - Frames]
+// ============================================================================
+
+err_t GifDecoder::readFramesCount(uint32_t* count)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+  FOG_RETURN_ON_ERROR(_scanFrames(0xFFFFFFFF));
+
+  *count = _framesFound;
+  return ERR_OK;
+}
+
+err_t GifDecoder::readFrameInfo(uint32_t index, ImageFrameInfo& info)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+  FOG_RETURN_ON_ERROR(_scanFrames(index));
+
+  if (index >= _framesFound)
+    return ERR_IMAGE_NO_FRAMES;
+
+  const GifFrame& frame = _frames[index];
+
+  info.rect.setRect(frame.x, frame.y, frame.w, frame.h);
+  info.delay = frame.delay;
+  info.disposal = frame.disposal;
+  return ERR_OK;
+}
+
+err_t GifDecoder::seekFrame(uint32_t index)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+  FOG_RETURN_ON_ERROR(_scanFrames(index));
+
+  if (index >= _framesFound)
+    return ERR_IMAGE_NO_FRAMES;
+
+  if (index == _actualFrame && !_frameCanvas.isEmpty())
+    return ERR_OK;
+
+  // Find the nearest frame before 'index' to start compositing from. It's
+  // the current frame, a frame which doesn't depend on the previous ones, or
+  // a frame with the cached canvas.
+  uint32_t start = 0;
+  int cached = -1;
+
+  if (_actualFrame <= index && !_frameCanvas.isEmpty())
+    start = _actualFrame;
+
+  for (uint32_t i = index; i > start; i--)
+  {
+    if (_frames[i].keyframe)
+    {
+      start = i;
+      break;
+    }
+
+    uint32_t slot = (i / GIF_KEYFRAME_INTERVAL) % GIF_KEYFRAME_CACHE;
+    if (_keyframeIndex[slot] == i)
+    {
+      start = i;
+      cached = (int)slot;
+      break;
+    }
+  }
+
+  if (start != _actualFrame || _frameCanvas.isEmpty())
+  {
+    if (cached >= 0)
+    {
+      _frameCanvas = _keyframeImage[cached];
+    }
+    else
+    {
+      if (_frameCanvas.isEmpty())
+        FOG_RETURN_ON_ERROR(_frameCanvas.create(_size, IMAGE_FORMAT_PRGB32));
+
+      // The canvas of the first frame is transparent, keyframes overwrite it.
+      if (start == 0)
+        _frameCanvas.clear(Argb32(0x00000000));
+    }
+
+    _disposal = IMAGE_DISPOSAL_NONE;
+    _disposalRect.reset();
+    _actualFrame = start;
+  }
+
+  while (_actualFrame < index)
+    FOG_RETURN_ON_ERROR(readFrame(NULL));
+
+  return ERR_OK;
+}
+
+err_t GifDecoder::readFrame(RectI* dirty)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+  FOG_RETURN_ON_ERROR(_scanFrames(_actualFrame));
+
+  if (_actualFrame >= _framesFound)
+    return ERR_IMAGE_NO_FRAMES;
+
+  if (_frameCanvas.isEmpty())
+  {
+    // The canvas is created by seekFrame() if the first frame is skipped.
+    if (_actualFrame != 0)
     {
-      // ERROR...
-      rec = TERMINATE_RECORD_TYPE;
+      FOG_RETURN_ON_ERROR(seekFrame(_actualFrame));
+      return readFrame(dirty);
     }
-    if ((rec == IMAGE_DESC_RECORD_TYPE) && (!done))
+
+    FOG_RETURN_ON_ERROR(_frameCanvas.create(_size, IMAGE_FORMAT_PRGB32));
+    _frameCanvas.clear(Argb32(0x00000000));
+  }
+
+  RectI dirtyRect(0, 0, 0, 0);
+
+  // Dispose the previous frame.
+  if (_disposalRect.isValid())
+  {
+    if (_disposal == IMAGE_DISPOSAL_BACKGROUND)
+      _frameCanvas.fillRect(_disposalRect, Argb32(0x00000000), COMPOSITE_SRC);
+    else if (_disposal == IMAGE_DISPOSAL_PREVIOUS && !_disposalBackup.isEmpty())
+      _frameCanvas.blitImage(_disposalRect.getPosition(), _disposalBackup, COMPOSITE_SRC);
+
+    if (_disposal != IMAGE_DISPOSAL_NONE)
+      dirtyRect = _disposalRect;
+  }
+
+  // Cache the canvas, it's copied when it's modified by the next frame.
+  if (_actualFrame != 0 && (_actualFrame % GIF_KEYFRAME_INTERVAL) == 0 && !_frames[_actualFrame].keyframe)
+  {
+    uint32_t slot = (_actualFrame / GIF_KEYFRAME_INTERVAL) % GIF_KEYFRAME_CACHE;
+
+    _keyframeImage[slot] = _frameCanvas;
+    _keyframeIndex[slot] = _actualFrame;
+  }
+
+  FOG_RETURN_ON_ERROR(_frameCanvas.detach());
+
+  err_t err = _drawFrame(_frames[_actualFrame], dirtyRect);
+  _frameCanvas._modified();
+
+  _actualFrame++;
+
+  if (dirty) *dirty = dirtyRect;
+  return err;
+}
+
+err_t GifDecoder::_scanFrames(uint32_t until)
+{
+  if (_scanDone || _framesFound > until)
+    return ERR_OK;
+
+  int64_t position = _stream.tell();
+  if (_stream.seek(_scanOffset, STREAM_SEEK_SET) == -1)
+    return ERR_IO_CANT_SEEK;
+
+  err_t err = ERR_OK;
+
+  // The graphic control extension applies to the next image.
+  GifFrame frame;
+  frame.delay = 0;
+  frame.disposal = IMAGE_DISPOSAL_NONE;
+  frame.transparent = -1;
+
+  while (_framesFound <= until)
+  {
+    uint8_t buf[9];
+    int64_t offset = _stream.tell();
+
+    // A truncated or malformed stream ends the animation.
+    if (_stream.read(buf, 1) != 1)
+    {
+      _scanDone = true;
+      break;
+    }
+
+    if (buf[0] == ',')
     {
-      if (DGifGetImageDesc(_context) == GIF_ERROR)
+      if (_stream.read(buf, 9) != 9)
       {
-        // ERROR...
-        rec = TERMINATE_RECORD_TYPE;
+        _scanDone = true;
+        break;
       }
-      w = _context->Image.Width;
-      h = _context->Image.Height;
-      rows = (GifRowType*)Fog::MemMgr::calloc(h * sizeof(GifRowType *));
-      if (!rows)
+
+      // Skip the local color map and the LZW minimum code size.
+      int64_t skip = 1;
+      if (buf[8] & 0x80) skip += (int64_t)3 << ((buf[8] & 0x07) + 1);
+
+      if (_stream.seek(skip, STREAM_SEEK_CUR) == -1 || !_GifSkipBlocks(_stream))
       {
-        error = ERR_RT_OUT_OF_MEMORY;
-        goto _End;
+        _scanDone = true;
+        break;
       }
-      for (i = 0; i < h; i++)
+
+      frame.offset = offset;
+      frame.x = (int)buf[0] | ((int)buf[1] << 8);
+      frame.y = (int)buf[2] | ((int)buf[3] << 8);
+      frame.w = (int)buf[4] | ((int)buf[5] << 8);
+      frame.h = (int)buf[6] | ((int)buf[7] << 8);
+      frame.keyframe =
+        frame.x <= 0 && frame.x + frame.w >= _size.w &&
+        frame.y <= 0 && frame.y + frame.h >= _size.h &&
+        frame.transparent < 0 && frame.disposal != IMAGE_DISPOSAL_PREVIOUS;
+
+      if ((err = _addFrame(frame)) != ERR_OK)
+        break;
+
+      frame.delay = 0;
+      frame.disposal = IMAGE_DISPOSAL_NONE;
+      frame.transparent = -1;
+    }
+    else if (buf[0] == '!')
+    {
+      if (_stream.read(buf, 1) != 1)
       {
-        rows[i] = (GifRowType)Fog::MemMgr::alloc(w * sizeof(GifPixelType));
-        if (!rows[i])
-        {
-          error = ERR_RT_OUT_OF_MEMORY;
-          goto _End;
-        }
+        _scanDone = true;
+        break;
       }
-      if (_context->Image.Interlace)
+
+      // Graphic control extension, the first sub-block has 4 bytes.
+      if (buf[0] == 0xF9)
       {
-        for (i = 0; i < 4; i++)
+        if (_stream.read(buf, 5) != 5)
         {
-          for (j = intoffset[i]; j < h; j += intjump[i])
-          {
-            DGifGetLine(_context, rows[j], w);
-          }
+          _scanDone = true;
+          break;
         }
-      }
-      else
-      {
-        for (i = 0; i < h; i++)
+
+        if (buf[0] >= 4)
         {
-          DGifGetLine(_context, rows[i], w);
+          uint32_t method = (buf[1] >> 2) & 0x7;
+
+          frame.disposal = method == 2 ? IMAGE_DISPOSAL_BACKGROUND :
+                           method == 3 ? IMAGE_DISPOSAL_PREVIOUS   : IMAGE_DISPOSAL_NONE;
+          frame.delay = ((uint32_t)buf[2] | ((uint32_t)buf[3] << 8)) * 10;
+          frame.transparent = (buf[1] & 1) ? (int)buf[4] : -1;
         }
-      }
-      done = 1;
-    }
-    else if (rec == EXTENSION_RECORD_TYPE)
-    {
-      int ext_code;
-      uint8_t* ext = NULL;
 
-      DGifGetExtension(_context, &ext_code, &ext);
-      while (ext)
-      {
-        if ((ext_code == 0xf9) && (ext[1] & 1) && (transp < 0))
+        if (_stream.seek((int64_t)buf[0] - 4, STREAM_SEEK_CUR) == -1)
         {
-          transp = (int)ext[4];
+          _scanDone = true;
+          break;
         }
-        ext = NULL;
-        DGifGetExtensionNext(_context, &ext);
       }
+
+      if (!_GifSkipBlocks(_stream))
+      {
+        _scanDone = true;
+        break;
+      }
+    }
+    else
+    {
+      // Trailer (';') or unknown record.
+      _scanDone = true;
+      break;
+    }
+  }
+
+  _scanOffset = _stream.tell();
+  _stream.seek(position, STREAM_SEEK_SET);
+
+  if (_scanDone) _framesCount = _framesFound;
+  return err;
+}
+
+err_t GifDecoder::_addFrame(const GifFrame& frame)
+{
+  if (_framesFound == _framesCapacity)
+  {
+    uint32_t capacity = _framesCapacity ? _framesCapacity * 2 : 16;
+    GifFrame* frames = (GifFrame*)Fog::MemMgr::realloc(_frames, capacity * sizeof(GifFrame));
+
+    if (FOG_IS_NULL(frames))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    _frames = frames;
+    _framesCapacity = capacity;
+  }
+
+  _frames[_framesFound++] = frame;
+  return ERR_OK;
+}
+
+err_t GifDecoder::_drawFrame(const GifFrame& frame, RectI& dirty)
+{
+  GifRecordType rec;
+
+  RectI rect(frame.x, frame.y, frame.w, frame.h);
+  RectI visible;
+  RectI::intersect(visible, rect, RectI(0, 0, _size.w, _size.h));
+
+  // Remember how to dispose this frame.
+  _disposal = frame.disposal;
+  _disposalRect.reset();
+
+  if (visible.isValid())
+  {
+    _disposalRect = visible;
+
+    if (frame.disposal == IMAGE_DISPOSAL_PREVIOUS)
+    {
+      FOG_RETURN_ON_ERROR(_disposalBackup.create(visible.getSize(), IMAGE_FORMAT_PRGB32));
+      _disposalBackup.blitImage(PointI(0, 0), _frameCanvas, visible, COMPOSITE_SRC);
     }
-  } while (rec != TERMINATE_RECORD_TYPE && !done);
 
-  if (transp >= 0) format = IMAGE_FORMAT_PRGB32;
-  if ((error = image.create(SizeI(w, h), format))) goto _End;
+    if (dirty.isValid())
+      RectI::unite(dirty, dirty, visible);
+    else
+      dirty = visible;
+  }
+
+  if (_stream.seek(frame.offset, STREAM_SEEK_SET) == -1)
+    return ERR_IO_CANT_SEEK;
+
+  if (DGifGetRecordType(_context, &rec) == GIF_ERROR || rec != IMAGE_DESC_RECORD_TYPE ||
+      DGifGetImageDesc(_context) == GIF_ERROR)
+  {
+    return ERR_IMAGE_MALFORMED_STRUCTURE;
+  }
+
+  // Don't accumulate the image descriptors of all decoded frames.
+  FreeLastSavedImage(_context);
 
-  bg = _context->SBackGroundColor;
-  cmap = (_context->Image.ColorMap ? _context->Image.ColorMap : _context->SColorMap);
+  int w = _context->Image.Width;
+  int h = _context->Image.Height;
+  if (w <= 0 || h <= 0) return ERR_OK;
 
-  ptr = (uint32_t*)image.getFirstX();
-  for (i = 0; i < h; i++)
+  MemBufferTmp<1024> lineStorage;
+  GifPixelType* line = reinterpret_cast<GifPixelType*>(lineStorage.alloc(w * sizeof(GifPixelType)));
+  if (FOG_IS_NULL(line)) return ERR_RT_OUT_OF_MEMORY;
+
+  const ColorMapObject* cmap = _context->Image.ColorMap ? _context->Image.ColorMap : _context->SColorMap;
+
+  // Part of the row inside the canvas.
+  int xOffset = visible.x - frame.x;
+  int xCount = visible.w;
+
+  int passesCount = _context->Image.Interlace ? 4 : 1;
+  for (int pass = 0; pass < passesCount; pass++)
   {
-    for (j = 0; j < w; j++)
+    int y0 = _context->Image.Interlace ? _GifInterlaceOffset[pass] : 0;
+    int dy = _context->Image.Interlace ? _GifInterlaceJump[pass] : 1;
+
+    for (int y = y0; y < h; y += dy)
     {
-      if (rows[i][j] == transp)
+      if (DGifGetLine(_context, line, w) == GIF_ERROR)
+        return ERR_IMAGE_TRUNCATED;
+
+      int cy = frame.y + y;
+      if (xCount <= 0 || cy < visible.y || cy >= visible.y + visible.h)
+        continue;
+
+      uint32_t* dst = reinterpret_cast<uint32_t*>(_frameCanvas.getScanlineX(cy)) + visible.x;
+      _GifCompositeRow(dst, line + xOffset, xCount, cmap, frame.transparent);
+    }
+  }
+
+  return ERR_OK;
+}
+
+err_t GifDecoder::_feed(bool end)
+{
+  err_t incomplete = end ? (err_t)ERR_IMAGE_TRUNCATED : (err_t)ERR_IMAGE_NEED_MORE_DATA;
+
+  size_t available = _getFeedAvailable();
+  StringA buffer = _stream.getBuffer();
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
+
+  // --------------------------------------------------------------------------
+  // [Header]
+  // --------------------------------------------------------------------------
+
+  if (!isHeaderDone())
+  {
+    // Signature, logical screen descriptor and global color map.
+    size_t required = 13;
+    if (available >= 13 && (data[10] & 0x80)) required += (size_t)3 << ((data[10] & 0x07) + 1);
+
+    if (available < required) return incomplete;
+    FOG_RETURN_ON_ERROR(readHeader());
+
+    available = _getFeedAvailable();
+    data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Records]
+  // --------------------------------------------------------------------------
+
+  // giflib can't resume a partially read block, so each record is passed to it
+  // only if it's completely available.
+  while (_feedImage.isEmpty())
+  {
+    GifRecordType rec;
+    if (available < 1) return incomplete;
+
+    switch (data[0])
+    {
+      case ',':
       {
-        //r = cmap->Colors[bg].Red;
-        //g = cmap->Colors[bg].Green;
-        //b = cmap->Colors[bg].Blue;
-        //*ptr++ = 0x00FFFFFF & ((r << 16) | (g << 8) | b);
-        *ptr++ = 0;
+        // Image descriptor, local color map and LZW minimum code size.
+        size_t required = 11;
+        if (available >= 10 && (data[9] & 0x80)) required += (size_t)3 << ((data[9] & 0x07) + 1);
+        if (available < required) return incomplete;
+
+        if (DGifGetRecordType(_context, &rec) == GIF_ERROR ||
+            DGifGetImageDesc(_context) == GIF_ERROR)
+        {
+          return ERR_IMAGE_MALFORMED_STRUCTURE;
+        }
+
+        int w = _context->Image.Width;
+        int h = _context->Image.Height;
+        if (w <= 0 || h <= 0) return ERR_IMAGE_INVALID_SIZE;
+
+        _feedLine = (GifPixelType*)Fog::MemMgr::alloc(w * sizeof(GifPixelType));
+        if (FOG_IS_NULL(_feedLine)) return ERR_RT_OUT_OF_MEMORY;
+
+        FOG_RETURN_ON_ERROR(_feedImage.create(SizeI(w, h),
+          _feedTransparent >= 0 ? IMAGE_FORMAT_PRGB32 : IMAGE_FORMAT_XRGB32));
+        _feedImage.clear(Argb32(_feedTransparent >= 0 ? 0x00000000 : 0xFF000000));
+
+        _feedPass = 0;
+        _feedRow = 0;
+        break;
       }
-      else
+
+      case '!':
       {
-        r = cmap->Colors[rows[i][j]].Red;
-        g = cmap->Colors[rows[i][j]].Green;
-        b = cmap->Colors[rows[i][j]].Blue;
-        *ptr++ = (0xFF000000) | (r << 16) | (g << 8) | b;
+        size_t chainSize;
+        if (available < 2 || !_GifScanBlocks(data + 2, available - 2, &chainSize)) return incomplete;
+
+        int extCode;
+        uint8_t* ext = NULL;
+
+        if (DGifGetRecordType(_context, &rec) == GIF_ERROR ||
+            DGifGetExtension(_context, &extCode, &ext) == GIF_ERROR)
+        {
+          return ERR_IMAGE_MALFORMED_STRUCTURE;
+        }
+
+        while (ext)
+        {
+          if ((extCode == 0xF9) && (ext[1] & 1) && (_feedTransparent < 0))
+          {
+            _feedTransparent = (int)ext[4];
+          }
+
+          ext = NULL;
+          if (DGifGetExtensionNext(_context, &ext) == GIF_ERROR)
+            return ERR_IMAGE_MALFORMED_STRUCTURE;
+        }
+
+        available = _getFeedAvailable();
+        data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
+        break;
       }
+
+      case ';':
+        return ERR_IMAGE_NO_FRAMES;
+
+      default:
+        return ERR_IMAGE_MALFORMED_STRUCTURE;
     }
   }
 
-_End:
-  if (rows)
+  // --------------------------------------------------------------------------
+  // [Rows]
+  // --------------------------------------------------------------------------
+
+  int w = _feedImage.getWidth();
+  int h = _feedImage.getHeight();
+  bool interlace = _context->Image.Interlace != 0;
+
+  const ColorMapObject* cmap = _context->Image.ColorMap ? _context->Image.ColorMap : _context->SColorMap;
+
+  // One row never needs more than 2.25 bytes per pixel of LZW codes (a clear
+  // code between every pixel). The decoder also buffers one whole sub-block.
+  size_t required = (size_t)w * 3 + (size_t)w * 3 / 255 + 258;
+  bool complete = false;
+
+  while (_feedPass < 4)
   {
-    for (i = 0; i < h; i++)
+    // The last row also consumes the rest of the sub-block chain.
+    bool last = _context->PixelCount <= (unsigned long)w;
+
+    if (!complete && (last || available < required))
     {
-      if (rows[i]) Fog::MemMgr::free(rows[i]);
+      size_t chainSize;
+      if (!_GifScanBlocks(data, available, &chainSize)) return incomplete;
+      complete = true;
     }
-    Fog::MemMgr::free(rows);
+
+    if (DGifGetLine(_context, _feedLine, w) == GIF_ERROR)
+      return ERR_IMAGE_MALFORMED_STRUCTURE;
+
+    _GifConvertRow(reinterpret_cast<uint32_t*>(_feedImage.getScanlineX(_feedRow)), _feedLine, w, cmap, _feedTransparent);
+    _feedImage._modified();
+    _feedRows(_feedRow, 1);
+
+    if (interlace)
+    {
+      _feedRow += _GifInterlaceJump[_feedPass];
+      while (_feedRow >= h && ++_feedPass < 4)
+        _feedRow = _GifInterlaceOffset[_feedPass];
+    }
+    else if (++_feedRow >= h)
+    {
+      _feedPass = 4;
+    }
+
+    if ((_feedRow & 15) == 0) updateProgress((uint32_t)_feedRow, (uint32_t)h);
+
+    available = _getFeedAvailable();
+    data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
   }
 
-  image._modified();
-  return error;
+  updateProgress(1.0f);
+  return ERR_OK;
 }
 
 // ============================================================================
 // [Fog::GifEncoder]
 // ============================================================================
 
-// TODO
 GifEncoder::GifEncoder(ImageCodecProvider* provider) :
-  ImageEncoder(provider)
+  ImageEncoder(provider),
+  _context(NULL),
+  _delay(100),
+  _loopCount(0),
+  _dither(DITHER_TYPE_NONE),
+  _framesWritten(0),
+  _animated(false),
+  _canvas(NULL),
+  _pending(NULL),
+  _frame(NULL),
+  _pendingDelay(0),
+  _hasPending(false)
 {
 }
 
 GifEncoder::~GifEncoder()
 {
+  finalize();
+}
+
+// ============================================================================
+// [Fog::GifEncoder - Helpers]
+// ============================================================================
+
+static err_t _GifEncoderError()
+{
+  return _GifError == E_GIF_ERR_NOT_ENOUGH_MEM ? (err_t)ERR_RT_OUT_OF_MEMORY : (err_t)ERR_IO_CANT_WRITE;
 }
 
+// Release the encoder context without writing the trailer.
+static void _GifFreeEncoder(GifFileType* gif)
+{
+  if (gif->Image.ColorMap) FreeMapObject(gif->Image.ColorMap);
+  if (gif->SColorMap) FreeMapObject(gif->SColorMap);
+  if (gif->HashTable) Fog::MemMgr::free(gif->HashTable);
+
+  Fog::MemMgr::free(gif);
+}
+
+// Alpha is thresholded at 50%, transparent pixels become zero so they compare
+// equal regardless of their color.
+static void _GifNormalizeRow(uint32_t* row, int w)
+{
+  for (int x = 0; x < w; x++)
+  {
+    uint32_t c = row[x];
+    row[x] = (c >= 0x80000000) ? (c | 0xFF000000) : 0;
+  }
+}
+
+// Bounding box of pixels which differ in a and b.
+static bool _GifDiffRect(RectI& dst, const uint32_t* a, const uint32_t* b, int w, int h)
+{
+  int x0 = w;
+  int x1 = -1;
+  int y0 = -1;
+  int y1 = -1;
+
+  for (int y = 0; y < h; y++, a += w, b += w)
+  {
+    int l = 0;
+    while (l < w && a[l] == b[l]) l++;
+    if (l == w) continue;
+
+    int r = w - 1;
+    while (a[r] == b[r]) r--;
+
+    if (y0 == -1) y0 = y;
+    y1 = y;
+
+    if (l < x0) x0 = l;
+    if (r > x1) x1 = r;
+  }
+
+  if (y0 == -1)
+    return false;
+
+  dst.setRect(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+  return true;
+}
+
+// Bounding box of pixels which are opaque in a and transparent in b.
+static bool _GifClearRect(RectI& dst, const uint32_t* a, const uint32_t* b, int w, int h)
+{
+  int x0 = w;
+  int x1 = -1;
+  int y0 = -1;
+  int y1 = -1;
+
+  for (int y = 0; y < h; y++, a += w, b += w)
+  {
+    for (int x = 0; x < w; x++)
+    {
+      if (a[x] != 0 && b[x] == 0)
+      {
+        if (y0 == -1) y0 = y;
+        y1 = y;
+
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+      }
+    }
+  }
+
+  if (y0 == -1)
+    return false;
+
+  dst.setRect(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+  return true;
+}
+
+// Copy the frame row, pixels equal to the canvas are replaced by zero (they
+// are written as transparent). Returns whether any pixel was replaced.
+static bool _GifPrepareRow(uint32_t* dst, const uint32_t* frame, const uint32_t* canvas, int w)
+{
+  bool skipped = false;
+
+  for (int x = 0; x < w; x++)
+  {
+    uint32_t c = frame[x];
+    if (c == canvas[x])
+    {
+      c = 0;
+      skipped = true;
+    }
+    dst[x] = c;
+  }
+
+  return skipped;
+}
+
+static const char _GifNetscapeId[] = "NETSCAPE2.0";
+
+// ============================================================================
+// [Fog::GifEncoder - Reset / Finalize]
+// ============================================================================
+
+void GifEncoder::reset()
+{
+  closeGif();
+  ImageEncoder::reset();
+
+  _delay = 100;
+  _loopCount = 0;
+  _dither = DITHER_TYPE_NONE;
+}
+
+void GifEncoder::finalize()
+{
+  if (!_writerDone && _framesWritten != 0)
+    _finish();
+
+  closeGif();
+  ImageEncoder::finalize();
+}
+
+void GifEncoder::closeGif()
+{
+  if (_context) _GifFreeEncoder(_context);
+  _context = NULL;
+
+  if (_canvas) Fog::MemMgr::free(_canvas);
+  if (_pending) Fog::MemMgr::free(_pending);
+  if (_frame) Fog::MemMgr::free(_frame);
+
+  _canvas = NULL;
+  _pending = NULL;
+  _frame = NULL;
+
+  _framesWritten = 0;
+  _animated = false;
+
+  _pendingRect.reset();
+  _pendingDelay = 0;
+  _hasPending = false;
+}
+
+// ============================================================================
+// [Fog::GifEncoder - WriteImage]
+// ============================================================================
+
 err_t GifEncoder::writeImage(const Image& image)
 {
-  // TODO
-  return 0;
+  int w = image.getWidth();
+  int h = image.getHeight();
+
+  if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF)
+    return ERR_IMAGE_INVALID_SIZE;
+
+  if (_writerDone)
+    return ERR_RT_INVALID_STATE;
+
+  size_t size = (size_t)(uint)w * (size_t)(uint)h * sizeof(uint32_t);
+
+  if (_framesWritten == 0)
+  {
+    _canvas = reinterpret_cast<uint32_t*>(Fog::MemMgr::alloc(size));
+    _pending = reinterpret_cast<uint32_t*>(Fog::MemMgr::alloc(size));
+    _frame = reinterpret_cast<uint32_t*>(Fog::MemMgr::alloc(size));
+
+    if (FOG_IS_NULL(_canvas) || FOG_IS_NULL(_pending) || FOG_IS_NULL(_frame))
+    {
+      closeGif();
+      return ERR_RT_OUT_OF_MEMORY;
+    }
+
+    // The canvas is transparent before the first frame is drawn.
+    MemOps::zero(_canvas, size);
+
+    _size.set(w, h);
+    _depth = 8;
+    _planes = 1;
+    _format = IMAGE_FORMAT_I8;
+  }
+  else if (w != _size.w || h != _size.h)
+  {
+    return ERR_IMAGE_INVALID_SIZE;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Convert]
+  // --------------------------------------------------------------------------
+
+  uint32_t* frame = _hasPending ? _frame : _pending;
+
+  {
+    ImageConverter converter;
+    FOG_RETURN_ON_ERROR(converter.create(
+      ImageFormatDescription::fromArgb(32, IMAGE_FD_NONE,
+        PIXEL_ARGB32_MASK_A,
+        PIXEL_ARGB32_MASK_R,
+        PIXEL_ARGB32_MASK_G,
+        PIXEL_ARGB32_MASK_B),
+      ImageFormatDescription::getByFormat(image.getFormat()),
+      0, NULL, &image.getPalette()));
+
+    ImageConverterClosure closure;
+    converter.setupClosure(&closure);
+    ImageConverterBlitLineFunc blit = converter.getBlitFn();
+
+    const uint8_t* pixels = image.getFirst();
+    ssize_t stride = image.getStride();
+
+    for (int y = 0; y < h; y++, pixels += stride)
+    {
+      uint32_t* row = frame + (size_t)(uint)y * (uint)w;
+
+      blit(reinterpret_cast<uint8_t*>(row), pixels, w, &closure);
+      _GifNormalizeRow(row, w);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Frame]
+  // --------------------------------------------------------------------------
+
+  if (!_hasPending)
+  {
+    _pendingRect.setRect(0, 0, w, h);
+    _hasPending = true;
+  }
+  else
+  {
+    // The canvas after the pending frame is drawn is equal to the pending
+    // frame. If the new frame is transparent where the pending one is opaque
+    // the pending frame has to be disposed to the background, its rectangle
+    // is extended to cover all such pixels.
+    uint32_t disposal = IMAGE_DISPOSAL_NONE;
+    RectI clearRect;
+
+    if (_GifClearRect(clearRect, _pending, _frame, w, h))
+    {
+      disposal = IMAGE_DISPOSAL_BACKGROUND;
+      RectI::unite(_pendingRect, _pendingRect, clearRect);
+    }
+
+    _animated = true;
+    FOG_RETURN_ON_ERROR(_writePending(disposal));
+
+    MemOps::copy(_canvas, _pending, size);
+    if (disposal == IMAGE_DISPOSAL_BACKGROUND)
+    {
+      for (int y = _pendingRect.y; y < _pendingRect.y + _pendingRect.h; y++)
+        MemOps::zero(_canvas + (size_t)(uint)y * (uint)w + _pendingRect.x, (size_t)(uint)_pendingRect.w * sizeof(uint32_t));
+    }
+
+    // Identical frames still need at least one pixel to carry the delay.
+    RectI rect;
+    if (!_GifDiffRect(rect, _canvas, _frame, w, h))
+      rect.setRect(0, 0, 1, 1);
+
+    MemOps::xchg_t<uint32_t*>(&_pending, &_frame);
+    _pendingRect = rect;
+  }
+
+  _pendingDelay = _delay;
+  _framesWritten++;
+
+  if (_framesWritten >= _framesCount)
+    return _finish();
+  else
+    return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::GifEncoder - Write]
+// ============================================================================
+
+err_t GifEncoder::_writeHeader()
+{
+  _context = EGifOpen(&_stream);
+  if (FOG_IS_NULL(_context))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  EGifSetGifVersion("89a");
+
+  // There is no global color map, each frame has a local one.
+  if (EGifPutScreenDesc(_context, _size.w, _size.h, 8, 0, NULL) == GIF_ERROR)
+    return _GifEncoderError();
+
+  if (_animated || _framesCount > 1)
+  {
+    uint8_t loop[3];
+    loop[0] = 1;
+    loop[1] = (uint8_t)(_loopCount & 0xFF);
+    loop[2] = (uint8_t)(_loopCount >> 8);
+
+    if (EGifPutExtensionFirst(_context, APPLICATION_EXT_FUNC_CODE, 11, _GifNetscapeId) == GIF_ERROR ||
+        EGifPutExtensionLast(_context, APPLICATION_EXT_FUNC_CODE, 3, loop) == GIF_ERROR)
+    {
+      return _GifEncoderError();
+    }
+  }
+
+  if (!_comment.isEmpty())
+  {
+    if (EGifPutComment(_context, _comment.getData()) == GIF_ERROR)
+      return _GifEncoderError();
+  }
+
+  _headerDone = true;
+  return ERR_OK;
+}
+
+err_t GifEncoder::_writePending(uint32_t disposal)
+{
+  if (!_headerDone)
+    FOG_RETURN_ON_ERROR(_writeHeader());
+
+  const RectI& r = _pendingRect;
+  uint w = (uint)_size.w;
+
+  MemBufferTmp<2048> rowStorage;
+  uint32_t* row = reinterpret_cast<uint32_t*>(rowStorage.alloc((size_t)(uint)r.w * (sizeof(uint32_t) + sizeof(GifPixelType))));
+
+  if (FOG_IS_NULL(row))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  GifPixelType* line = reinterpret_cast<GifPixelType*>(row + r.w);
+  int y;
+
+  // --------------------------------------------------------------------------
+  // [Palette]
+  // --------------------------------------------------------------------------
+
+  bool hasTransparent = false;
+  _quantizer.reset();
+
+  for (y = r.y; y < r.y + r.h; y++)
+  {
+    size_t offset = (size_t)(uint)y * w + (uint)r.x;
+
+    hasTransparent |= _GifPrepareRow(row, _pending + offset, _canvas + offset, r.w);
+    FOG_RETURN_ON_ERROR(_quantizer.addRow(row, (uint32_t)r.w));
+  }
+
+  FOG_RETURN_ON_ERROR(_quantizer.buildPalette(hasTransparent ? 255 : 256));
+
+  uint32_t count = _quantizer.getLength();
+  uint32_t transparent = count;
+
+  int tableSize = 2;
+  while ((uint32_t)tableSize < count + (uint32_t)hasTransparent)
+    tableSize <<= 1;
+
+  ColorMapObject* cmap = MakeMapObject(tableSize, NULL);
+  if (FOG_IS_NULL(cmap))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  const Argb32* pal = _quantizer.getPalette();
+  for (uint32_t i = 0; i < count; i++)
+  {
+    cmap->Colors[i].Red   = (uint8_t)pal[i].getRed();
+    cmap->Colors[i].Green = (uint8_t)pal[i].getGreen();
+    cmap->Colors[i].Blue  = (uint8_t)pal[i].getBlue();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Graphic Control Extension]
+  // --------------------------------------------------------------------------
+
+  if (_animated || hasTransparent)
+  {
+    uint32_t delay = Math::min<uint32_t>((_pendingDelay + 5) / 10, 0xFFFF);
+    uint32_t method = (disposal == IMAGE_DISPOSAL_BACKGROUND) ? 2 : (_animated ? 1 : 0);
+
+    uint8_t gce[4];
+    gce[0] = (uint8_t)((method << 2) | (hasTransparent ? 1 : 0));
+    gce[1] = (uint8_t)(delay & 0xFF);
+    gce[2] = (uint8_t)(delay >> 8);
+    gce[3] = (uint8_t)(hasTransparent ? transparent : 0);
+
+    if (EGifPutExtension(_context, GRAPHICS_EXT_FUNC_CODE, 4, gce) == GIF_ERROR)
+    {
+      FreeMapObject(cmap);
+      return _GifEncoderError();
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Image]
+  // --------------------------------------------------------------------------
+
+  int result = EGifPutImageDesc(_context, r.x, r.y, r.w, r.h, false, cmap);
+  FreeMapObject(cmap);
+
+  if (result == GIF_ERROR)
+    return _GifEncoderError();
+
+  FOG_RETURN_ON_ERROR(_quantizer.beginMap((uint32_t)r.w, _dither));
+
+  for (y = r.y; y < r.y + r.h; y++)
+  {
+    size_t offset = (size_t)(uint)y * w + (uint)r.x;
+
+    _GifPrepareRow(row, _pending + offset, _canvas + offset, r.w);
+    _quantizer.mapRow(line, row, r.x, y, (uint32_t)r.w, transparent);
+
+    if (EGifPutLine(_context, line, r.w) == GIF_ERROR)
+      return _GifEncoderError();
+
+    if ((y & 15) == 0)
+      updateProgress((uint32_t)(y - r.y), (uint32_t)r.h);
+  }
+
+  return ERR_OK;
+}
+
+err_t GifEncoder::_finish()
+{
+  err_t err = ERR_OK;
+
+  if (_hasPending)
+  {
+    err = _writePending(IMAGE_DISPOSAL_NONE);
+    _hasPending = false;
+  }
+
+  if (_context)
+  {
+    if (err == ERR_OK)
+    {
+      // Writes the trailer and releases the context.
+      if (EGifCloseFile(_context) == GIF_ERROR)
+        err = _GifEncoderError();
+      else
+        _context = NULL;
+    }
+  }
+
+  _writerDone = true;
+  closeGif();
+  return err;
+}
+
+// ============================================================================
+// [Fog::GifEncoder - Properties]
+// ============================================================================
+
+err_t GifEncoder::_getProperty(const InternedStringW& name, Var& dst) const
+{
+  if (name == FOG_S(delay))
+    return dst.setInt(_delay);
+
+  if (name == FOG_S(loopCount))
+    return dst.setInt(_loopCount);
+
+  if (name == FOG_S(dither))
+    return dst.setInt(_dither);
+
+  return Base::_getProperty(name, dst);
+}
+
+err_t GifEncoder::_setProperty(const InternedStringW& name, const Var& src)
+{
+  if (name == FOG_S(delay))
+    return src.getInt(_delay, 0, 655350);
+
+  if (name == FOG_S(loopCount))
+    return src.getInt(_loopCount, 0, 65535);
+
+  if (name == FOG_S(dither))
+    return src.getInt(_dither, 0, DITHER_TYPE_COUNT - 1);
+
+  // The count of frames to write, zero means a single image.
+  if (name == FOG_S(framesCount))
+  {
+    if (_framesWritten != 0)
+      return ERR_RT_INVALID_STATE;
+    return src.getInt(_framesCount, 0, 65535);
+  }
+
+  return Base::_setProperty(name, src);
 }
 
 } // Fog namespace
@@ -118,6 +118,9 @@ IcoDecoder::IcoDecoder(ImageCodecProvider* provider) :
   ImageDecoder(provider)
 {
   _framesInfo = NULL;
+
+  // Entries are addressed by absolute offsets, the fed data must be kept.
+  _feedKeepAll = true;
 }
 
 IcoDecoder::~IcoDecoder()
@@ -292,6 +295,47 @@ _End:
   return err;
 }
 
+// ============================================================================
+// [IcoDecoder::_feed]
+// ============================================================================
+
+err_t IcoDecoder::_feed(bool end)
+{
+  if (!isHeaderDone())
+  {
+    size_t available = _getFeedAvailable();
+    size_t required = sizeof(IcoHeader);
+
+    if (available >= sizeof(IcoHeader))
+    {
+      StringA buffer = _stream.getBuffer();
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.getData()) + (size_t)_stream.tell();
+
+      uint32_t count = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+      required += count * sizeof(IcoEntry);
+    }
+
+    if (available < required && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    FOG_RETURN_ON_ERROR(readHeader());
+  }
+
+  if (_actualFrame == _framesCount || !_framesInfo) return ERR_IMAGE_NO_FRAMES;
+
+  // The embedded PNG/BMP is decoded at once when the whole entry is available.
+  IcoEntry* entry = _framesInfo + _actualFrame;
+  uint64_t available = (uint64_t)_stream.tell() + _getFeedAvailable();
+
+  if (available < (uint64_t)entry->offset + entry->size && !end)
+    return ERR_IMAGE_NEED_MORE_DATA;
+
+  err_t err = readImage(_feedImage);
+  if (err == ERR_OK) _feedRows(0, _feedImage.getHeight());
+
+  return err;
+}
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
@@ -108,6 +108,12 @@ struct FOG_NO_EXPORT IcoDecoder : public ImageDecoder
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
 
+  // --------------------------------------------------------------------------
+  // [Feed]
+  // --------------------------------------------------------------------------
+
+  virtual err_t _feed(bool end);
+
 protected:
   // For determining offset/size of "frames" LE numbers are already converted
   // to BE numbers on BE systems.
@@ -15,12 +15,15 @@
 // [Dependencies]
 #include <Fog/Core/Global/Init_p.h>
 #include <Fog/Core/Memory/MemBufferTmp_p.h>
+#include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/OS/Library.h>
 #include <Fog/Core/Tools/InternedString.h>
 #include <Fog/Core/Tools/Logger.h>
 #include <Fog/Core/Tools/Stream.h>
 #include <Fog/Core/Tools/String.h>
 #include <Fog/Core/Tools/Var.h>
+#include <Fog/G2d/Geometry/Rect.h>
+#include <Fog/G2d/Geometry/Size.h>
 #include <Fog/G2d/Imaging/Codecs/JpegCodec_p.h>
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageConverter.h>
@@ -42,13 +45,24 @@ FOG_IMPLEMENT_OBJECT(Fog::JpegEncoder)
 # define FOG_JPEG_RGB24_BMASK 0x000000FF
 #endif // FOG_BYTE_ORDER
 
+#if defined(JCS_EXTENSIONS)
+# if FOG_BYTE_ORDER == FOG_LITTLE_ENDIAN
+#  define FOG_JPEG_XRGB32_COLOR_SPACE JCS_EXT_BGRX
+# else
+#  define FOG_JPEG_XRGB32_COLOR_SPACE JCS_EXT_XRGB
+# endif // FOG_BYTE_ORDER
+#endif // JCS_EXTENSIONS
+
 namespace Fog {
 
 // ===========================================================================
 // [Fog::JpegLibrary]
 // ===========================================================================
 
-JpegLibrary::JpegLibrary() : err(0xFFFFFFFF)
+JpegLibrary::JpegLibrary() :
+  skip_scanlines(NULL),
+  crop_scanline(NULL),
+  err(0xFFFFFFFF)
 {
 }
 
@@ -104,12 +118,27 @@ err_t JpegLibrary::init()
     return ERR_IMAGE_LIBJPEG_NOT_LOADED;
   }
 
+  // Optional, used by JpegDecoder to decode only the region of interest.
+  skip_scanlines = (JDIMENSION (FOG_CDECL *)(jpeg_decompress_struct*, JDIMENSION))
+    dll.getSymbol("jpeg_skip_scanlines");
+  crop_scanline = (void (FOG_CDECL *)(jpeg_decompress_struct*, JDIMENSION*, JDIMENSION*))
+    dll.getSymbol("jpeg_crop_scanline");
+
+  // Both are needed, a partial libjpeg-turbo API is not expected.
+  if (skip_scanlines == NULL || crop_scanline == NULL)
+  {
+    skip_scanlines = NULL;
+    crop_scanline = NULL;
+  }
+
   return ERR_OK;
 }
 
 void JpegLibrary::close()
 {
   dll.close();
+  skip_scanlines = NULL;
+  crop_scanline = NULL;
   err = 0xFFFFFFFF;
 }
 
@@ -185,7 +214,10 @@ err_t JpegCodecProvider::createCodec(uint32_t codecType, ImageCodec** codec) con
 // ===========================================================================
 
 JpegDecoder::JpegDecoder(ImageCodecProvider* provider) :
-  ImageDecoder(provider)
+  ImageDecoder(provider),
+  _scaleDenom(1),
+  _targetSize(0, 0),
+  _cropRect(0, 0, 0, 0)
 {
 }
 
@@ -296,6 +328,10 @@ static void FOG_CDECL MyJpegMessage(j_common_ptr cinfo)
 void JpegDecoder::reset()
 {
   ImageDecoder::reset();
+
+  _scaleDenom = 1;
+  _targetSize.reset();
+  _cropRect.reset();
 }
 
 // ===========================================================================
@@ -340,11 +376,23 @@ err_t JpegDecoder::readHeader()
   srcmgr.stream = &_stream;
 
   jpeg.read_header(&cinfo, true);
+
+  // Report the size of the image which will be decoded by readImage().
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = _getScaleDenom(SizeI((int)cinfo.image_width, (int)cinfo.image_height));
   jpeg.calc_output_dimensions(&cinfo);
 
   _headerDone = true;
-  _size.w = cinfo.output_width;
-  _size.h = cinfo.output_height;
+
+  {
+    RectI crop(UNINITIALIZED);
+    if (!_getCropRect(crop, SizeI((int)cinfo.output_width, (int)cinfo.output_height)))
+    {
+      err = ERR_IMAGE_INVALID_SIZE;
+      goto _Fail;
+    }
+    _size = crop.getSize();
+  }
   _planes = 1;
   _actualFrame = 0;
   _framesCount = 1;
@@ -355,7 +403,7 @@ err_t JpegDecoder::readHeader()
       _depth = 8;
       break;
     default:
-      _depth = 24;
+      _depth = 32;
       break;
   }
 
@@ -387,8 +435,19 @@ err_t JpegDecoder::readImage(Image& image)
   MyJpegErrorMgr jerr;
   JSAMPROW rowptr[1];
 
-  uint32_t format = IMAGE_FORMAT_RGB24;
-  int bpp = 3;
+  uint32_t format = IMAGE_FORMAT_XRGB32;
+  RectI crop(UNINITIALIZED);
+
+  // Bytes per pixel of the scanline produced by libjpeg, can differ from the
+  // bytes per pixel of the image if the RGB24 data has to be expanded.
+  int decodedBpp = 3;
+  // Count of pixels decoded on the left side of the crop rectangle.
+  int decodedShift = 0;
+
+  uint8_t* pixels;
+  ssize_t stride;
+  uint8_t* rowBuffer = NULL;
+  MemBufferTmp<2048> rowBufferStorage;
 
   // Create a decompression structure and load the header.
   cinfo.err = jpeg.std_error(&jerr.errmgr);
@@ -415,10 +474,46 @@ err_t JpegDecoder::readImage(Image& image)
   srcmgr.stream = &_stream;
 
   jpeg.read_header(&cinfo, true);
+
+  // Set 8 or 32-bit output. The output color space must be set before the
+  // decompression is started, libjpeg fails if it can't convert the color.
+  if (cinfo.out_color_space == JCS_GRAYSCALE)
+  {
+    format = IMAGE_FORMAT_I8;
+    decodedBpp = 1;
+  }
+  else
+  {
+#if defined(JCS_EXTENSIONS)
+    // The optional symbols are only exported by libjpeg-turbo, which can write
+    // XRGB32 pixels directly.
+    if (jpeg.crop_scanline != NULL)
+    {
+      cinfo.out_color_space = FOG_JPEG_XRGB32_COLOR_SPACE;
+      decodedBpp = 4;
+    }
+    else
+#endif // JCS_EXTENSIONS
+    {
+      cinfo.out_color_space = JCS_RGB;
+    }
+    cinfo.quantize_colors = false;
+  }
+
+  // Use the IDCT scaling, it's much faster than decoding at full resolution
+  // and scaling the image afterwards.
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = _getScaleDenom(SizeI((int)cinfo.image_width, (int)cinfo.image_height));
+
   jpeg.calc_output_dimensions(&cinfo);
 
-  _size.w = cinfo.output_width;
-  _size.h = cinfo.output_height;
+  if (!_getCropRect(crop, SizeI((int)cinfo.output_width, (int)cinfo.output_height)))
+  {
+    err = ERR_IMAGE_INVALID_SIZE;
+    goto _End;
+  }
+
+  _size = crop.getSize();
   _planes = 1;
   _actualFrame = 0;
   _framesCount = 1;
@@ -432,90 +527,223 @@ err_t JpegDecoder::readImage(Image& image)
 
   jpeg.start_decompress(&cinfo);
 
-  // Set 8 or 24-bit output.
-  if (cinfo.out_color_space == JCS_GRAYSCALE)
+  if (cinfo.output_components != decodedBpp)
   {
-    if (cinfo.output_components != 1)
-    {
-      err = ERR_IMAGEIO_UNSUPPORTED_FORMAT;
-      goto _End;
-    }
+    err = ERR_IMAGEIO_UNSUPPORTED_FORMAT;
+    goto _End;
+  }
 
-    format = IMAGE_FORMAT_I8;
-    bpp = 1;
+  // Restrict the decoding to the crop rectangle. libjpeg-turbo can decode only
+  // the iMCU columns intersecting the rectangle, it extends the requested
+  // offset and width to the iMCU boundary.
+  decodedShift = crop.x;
+  if ((uint)crop.w != cinfo.output_width && jpeg.crop_scanline != NULL)
+  {
+    JDIMENSION xOffset = (JDIMENSION)crop.x;
+    JDIMENSION xWidth = (JDIMENSION)crop.w;
+
+    jpeg.crop_scanline(&cinfo, &xOffset, &xWidth);
+    decodedShift = crop.x - (int)xOffset;
   }
-  else if (cinfo.out_color_space == JCS_RGB)
+
+  // The scanline is decoded directly into the image, only the cropped image
+  // needs a temporary buffer, because libjpeg writes more pixels than stored.
+  if ((uint)crop.w != cinfo.output_width)
   {
-    if (cinfo.output_components != 3)
+    rowBuffer = reinterpret_cast<uint8_t*>(
+      rowBufferStorage.alloc((size_t)cinfo.output_width * (uint)decodedBpp));
+
+    if (FOG_IS_NULL(rowBuffer))
     {
-      err = ERR_IMAGEIO_UNSUPPORTED_FORMAT;
+      err = ERR_RT_OUT_OF_MEMORY;
       goto _End;
     }
   }
-  else
+
+  if (crop.y > 0)
   {
-    cinfo.out_color_space = JCS_RGB;
-    cinfo.quantize_colors = false;
+    if (jpeg.skip_scanlines != NULL)
+    {
+      jpeg.skip_scanlines(&cinfo, (JDIMENSION)crop.y);
+    }
+    else
+    {
+      if (rowBuffer == NULL)
+      {
+        rowBuffer = reinterpret_cast<uint8_t*>(
+          rowBufferStorage.alloc((size_t)cinfo.output_width * (uint)decodedBpp));
+
+        if (FOG_IS_NULL(rowBuffer))
+        {
+          err = ERR_RT_OUT_OF_MEMORY;
+          goto _End;
+        }
+      }
+
+      while (cinfo.output_scanline < (JDIMENSION)crop.y)
+      {
+        rowptr[0] = (JSAMPROW)rowBuffer;
+        jpeg.read_scanlines(&cinfo, rowptr, (JDIMENSION)1);
+      }
+    }
   }
 
   // Create the image.
   if (FOG_IS_ERROR(err = image.create(_size, format))) goto _End;
 
   if (format == IMAGE_FORMAT_I8)
-  {
     image.setPalette(ImagePalette::fromGreyscale(256));
 
-    uint8_t* pixels = image.getFirstX();
-    ssize_t stride = image.getStride();
+  pixels = image.getFirstX();
+  stride = image.getStride();
 
-    while (cinfo.output_scanline < cinfo.output_height)
+  for (int y = 0; y < crop.h; y++)
+  {
+    uint8_t* dstRow = pixels + (ssize_t)y * stride;
+    const uint8_t* srcRow;
+
+    if (rowBuffer != NULL)
+      rowptr[0] = (JSAMPROW)rowBuffer;
+    else if (decodedBpp == 3)
+      // RGB24 scanline is decoded into the right part of XRGB32 scanline and
+      // expanded in place, from left to right.
+      rowptr[0] = (JSAMPROW)(dstRow + crop.w);
+    else
+      rowptr[0] = (JSAMPROW)dstRow;
+
+    jpeg.read_scanlines(&cinfo, rowptr, (JDIMENSION)1);
+    srcRow = (const uint8_t*)rowptr[0] + (ssize_t)decodedShift * decodedBpp;
+
+    if (decodedBpp == 3)
     {
-      rowptr[0] = (JSAMPROW)(pixels + (ssize_t)cinfo.output_scanline * stride);
-      jpeg.read_scanlines(&cinfo, rowptr, (JDIMENSION)1);
-
-      if ((cinfo.output_scanline & 15) == 0)
-        updateProgress(cinfo.output_scanline, cinfo.output_height);
+      uint32_t* dst32 = reinterpret_cast<uint32_t*>(dstRow);
+
+      for (int x = 0; x < crop.w; x++, srcRow += 3)
+      {
+        dst32[x] = 0xFF000000U                 |
+                   ((uint32_t)srcRow[0] << 16) |
+                   ((uint32_t)srcRow[1] <<  8) |
+                   ((uint32_t)srcRow[2]      ) ;
+      }
     }
+    else if (srcRow != dstRow)
+    {
+      MemOps::copy(dstRow, srcRow, (size_t)crop.w * decodedBpp);
+    }
+
+    if ((y & 15) == 0)
+      updateProgress(y, crop.h);
   }
-  else
+
+  // The rest of scanlines is not needed if the image was cropped,
+  // destroy_decompress() aborts the decompression in such case.
+  if (cinfo.output_scanline == cinfo.output_height)
+    jpeg.finish_decompress(&cinfo);
+
+_End:
+  jpeg.destroy_decompress(&cinfo);
+  image._modified();
+
+  return err;
+}
+
+// ===========================================================================
+// [Fog::JpegDecoder - Properties]
+// ===========================================================================
+
+err_t JpegDecoder::_getProperty(const InternedStringW& name, Var& dst) const
+{
+  if (name == FOG_S(scaleDenom))
+    return dst.setInt(_scaleDenom);
+
+  if (name == FOG_S(targetSize))
+    return fog_api.var_setType(&dst, VAR_TYPE_SIZE_I, &_targetSize);
+
+  if (name == FOG_S(cropRect))
+    return fog_api.var_setType(&dst, VAR_TYPE_RECT_I, &_cropRect);
+
+  return Base::_getProperty(name, dst);
+}
+
+err_t JpegDecoder::_setProperty(const InternedStringW& name, const Var& src)
+{
+  if (name == FOG_S(scaleDenom))
   {
-    ImageConverter converter;
-    err = converter.create(
-      ImageFormatDescription::getByFormat(format),
-      ImageFormatDescription::fromArgb(24, IMAGE_FD_NONE, 0,
-        FOG_JPEG_RGB24_RMASK,
-        FOG_JPEG_RGB24_GMASK,
-        FOG_JPEG_RGB24_BMASK));
-    if (FOG_IS_ERROR(err)) goto _End;
+    uint32_t denom;
+    FOG_RETURN_ON_ERROR(src.getInt(denom, 1, 8));
 
-    ImageConverterClosure closure;
-    converter.setupClosure(&closure, PointI(0, 0));
+    // libjpeg supports only 1/1, 1/2, 1/4 and 1/8 scaling.
+    if ((denom & (denom - 1)) != 0)
+      return ERR_RT_INVALID_ARGUMENT;
 
-    uint8_t* pixels = image.getFirstX();
-    ssize_t stride = image.getStride();
+    _scaleDenom = denom;
+    return ERR_OK;
+  }
 
-    while (cinfo.output_scanline < cinfo.output_height)
-    {
-      rowptr[0] = (JSAMPROW)(pixels + (ssize_t)cinfo.output_scanline * stride);
-      jpeg.read_scanlines(&cinfo, rowptr, (JDIMENSION)1);
+  if (name == FOG_S(targetSize))
+  {
+    SizeI size(UNINITIALIZED);
+    FOG_RETURN_ON_ERROR(fog_api.var_getType(&src, VAR_TYPE_SIZE_I, &size));
 
-      if (!converter.isCopy())
-        converter.getBlitFn()((uint8_t*)rowptr[0], (uint8_t*)rowptr[0], _size.w, &closure);
+    if (size.w < 0 || size.h < 0)
+      return ERR_RT_INVALID_ARGUMENT;
+
+    _targetSize = size;
+    return ERR_OK;
+  }
+
+  if (name == FOG_S(cropRect))
+  {
+    RectI rect(UNINITIALIZED);
+    FOG_RETURN_ON_ERROR(fog_api.var_getType(&src, VAR_TYPE_RECT_I, &rect));
+
+    if (rect.x < 0 || rect.y < 0 || rect.w < 0 || rect.h < 0)
+      return ERR_RT_INVALID_ARGUMENT;
 
-      if ((cinfo.output_scanline & 15) == 0)
-        updateProgress(cinfo.output_scanline, cinfo.output_height);
+    _cropRect = rect;
+    return ERR_OK;
+  }
+
+  return Base::_setProperty(name, src);
+}
+
+// ===========================================================================
+// [Fog::JpegDecoder - Helpers]
+// ===========================================================================
 
-      closure.ditherOrigin.y++;
+uint32_t JpegDecoder::_getScaleDenom(const SizeI& size) const
+{
+  uint32_t denom = _scaleDenom;
+
+  if (_targetSize.w > 0 || _targetSize.h > 0)
+  {
+    // Libjpeg rounds the scaled size up, the same is done here.
+    while (denom < 8)
+    {
+      uint32_t next = denom * 2;
+      int w = (int)(((uint)size.w + next - 1) / next);
+      int h = (int)(((uint)size.h + next - 1) / next);
+
+      if (w < _targetSize.w || h < _targetSize.h)
+        break;
+      denom = next;
     }
   }
 
-  jpeg.finish_decompress(&cinfo);
+  return denom;
+}
 
-_End:
-  jpeg.destroy_decompress(&cinfo);
-  image._modified();
+bool JpegDecoder::_getCropRect(RectI& dst, const SizeI& size) const
+{
+  RectI bounds(0, 0, size.w, size.h);
 
-  return err;
+  if (_cropRect.w == 0 || _cropRect.h == 0)
+  {
+    dst = bounds;
+    return bounds.isValid();
+  }
+
+  return RectI::intersect(dst, _cropRect, bounds);
 }
 
 // ===========================================================================
@@ -14,6 +14,8 @@
 #include <Fog/Core/Global/Global.h>
 #include <Fog/Core/OS/Library.h>
 #include <Fog/Core/Tools/String.h>
+#include <Fog/G2d/Geometry/Rect.h>
+#include <Fog/G2d/Geometry/Size.h>
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageCodec.h>
 #include <Fog/G2d/Imaging/ImageCodecProvider.h>
@@ -67,6 +69,11 @@ struct FOG_NO_EXPORT JpegLibrary
     void* addr[NUM_SYMBOLS];
   };
 
+  // Optional symbols, available in libjpeg-turbo 1.5 and later. If they are
+  // found then the library also supports JCS_EXTENSIONS color spaces.
+  JDIMENSION (FOG_CDECL *skip_scanlines)(jpeg_decompress_struct*, JDIMENSION);
+  void (FOG_CDECL *crop_scanline)(jpeg_decompress_struct*, JDIMENSION*, JDIMENSION*);
+
   Library dll;
   volatile err_t err;
 
@@ -125,6 +132,41 @@ struct FOG_NO_EXPORT JpegDecoder : public ImageDecoder
   virtual void reset();
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
+
+  // --------------------------------------------------------------------------
+  // [Properties]
+  // --------------------------------------------------------------------------
+
+  virtual err_t _getProperty(const InternedStringW& name, Var& dst) const;
+  virtual err_t _setProperty(const InternedStringW& name, const Var& src);
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the IDCT scale denominator (1, 2, 4 or 8) to use for an image
+  //! of @a size, based on @c _scaleDenom and @c _targetSize.
+  uint32_t _getScaleDenom(const SizeI& size) const;
+
+  //! @brief Get the decoded area of the image of (already scaled) @a size.
+  //!
+  //! Returns @c false if the crop rectangle doesn't intersect the image.
+  bool _getCropRect(RectI& dst, const SizeI& size) const;
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+protected:
+  //! @brief Requested IDCT scale denominator ("scaleDenom" property).
+  uint32_t _scaleDenom;
+  //! @brief Requested minimal size of the decoded image ("targetSize"
+  //! property), the largest IDCT scaling which keeps the image at least as
+  //! large is used. Zero size means no request.
+  SizeI _targetSize;
+  //! @brief Region of interest in the scaled image coordinates ("cropRect"
+  //! property). Empty rectangle means the whole image.
+  RectI _cropRect;
 };
 
 // ============================================================================
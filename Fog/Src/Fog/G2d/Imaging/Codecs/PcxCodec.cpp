@@ -466,31 +466,128 @@ err_t PcxDecoder::readImage(Image& image)
   if (isReaderDone()) return (_readerResult = ERR_IMAGE_NO_FRAMES);
 
   // Error code.
-  uint32_t err = ERR_OK;
+  err_t err = ERR_OK;
 
   // Source.
   StringA dataArray;
   const uint8_t* dataCur;
   const uint8_t* dataEnd;
 
-  // Destination.
-  uint8_t* pixels;
-  ssize_t stride;
+  // Rows decoded.
+  uint32_t y = 0;
 
-  // Temporary plane data.
-  MemBufferTmp<1024> temporary;
-  uint8_t* mem;
+  _readComment();
 
-  // Bytes per line.
-  uint32_t bytesPerLine = _pcxFileHeader.bytesPerLine;
+  _stream.readAll(dataArray);
+  dataCur = (const uint8_t*)dataArray.getData();
+  dataEnd = dataCur + dataArray.getLength();
 
-  // Loop variables.
-  uint x, y;
+  if ((err = image.create(_size, _format))) goto _End;
+  if ((err = _readRows(image, &dataCur, dataEnd, &y))) goto _End;
+
+  if (_depth <= 8)
+  {
+    if ((err = _readPalette(dataCur, dataEnd))) goto _End;
 
-  // Secondary palette.
-  bool infoSecPalette = false;
-  uint infoSecPaletteColors = 0;
+    // Apply palette if needed.
+    image.setPalette(_palette);
+  }
+
+_End:
+  image._modified();
 
+  if (err == ERR_OK) updateProgress(1.0);
+  return err;
+}
+
+// ============================================================================
+// [Fog::PcxDecoder - Feed]
+// ============================================================================
+
+err_t PcxDecoder::_feed(bool end)
+{
+  if (!isHeaderDone())
+  {
+    if (_getFeedAvailable() < sizeof(PcxHeader) && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    FOG_RETURN_ON_ERROR(readHeader());
+  }
+
+  err_t err = ERR_OK;
+
+  StringA dataArray = _stream.getBuffer();
+  const uint8_t* dataBegin = (const uint8_t*)dataArray.getData() + (size_t)_stream.tell();
+  const uint8_t* dataCur = dataBegin;
+  const uint8_t* dataEnd = dataBegin + _getFeedAvailable();
+
+  if (_feedImage.isEmpty())
+  {
+    _readComment();
+    FOG_RETURN_ON_ERROR(_feedImage.create(_size, _format));
+
+    // The palette of 1-bit and 4-bit images is stored in the header so it can
+    // be applied before any row is decoded.
+    if (_depth < 8)
+    {
+      FOG_RETURN_ON_ERROR(_readPalette(dataCur, dataEnd));
+      _feedImage.setPalette(_palette);
+    }
+
+    _pcxFeedRow = 0;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Rows]
+  // --------------------------------------------------------------------------
+
+  if (_pcxFeedRow < (uint32_t)_size.h)
+  {
+    uint32_t y = _pcxFeedRow;
+
+    err = _readRows(_feedImage, &dataCur, dataEnd, &_pcxFeedRow);
+    _stream.seek((int64_t)(dataCur - dataBegin), STREAM_SEEK_CUR);
+
+    if (_pcxFeedRow != y)
+    {
+      _feedImage._modified();
+      _feedRows((int)y, (int)(_pcxFeedRow - y));
+    }
+
+    if (err == ERR_IMAGE_TRUNCATED && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    if (FOG_IS_ERROR(err))
+      return err;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Palette]
+  // --------------------------------------------------------------------------
+
+  // The 256 color palette follows the pixels (0x0C marker and 768 bytes).
+  if (_depth == 8)
+  {
+    if ((size_t)(dataEnd - dataCur) < 769 && !end)
+      return ERR_IMAGE_NEED_MORE_DATA;
+
+    FOG_RETURN_ON_ERROR(_readPalette(dataCur, dataEnd));
+    _feedImage.setPalette(_palette);
+
+    // All rows were reported using the default palette.
+    _feedRows(0, _size.h);
+  }
+
+  updateProgress(1.0f);
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::PcxDecoder - Helpers]
+// ============================================================================
+
+void PcxDecoder::_readComment()
+{
   // Image text.
   if (_pcxFileHeader.unused[0])
   {
@@ -501,15 +598,31 @@ err_t PcxDecoder::readImage(Image& image)
   {
     _comment.reset();
   }
+}
 
-  _stream.readAll(dataArray);
-  dataCur = (const uint8_t*)dataArray.getData();
-  dataEnd = dataCur + dataArray.getLength();
+err_t PcxDecoder::_readRows(Image& image, const uint8_t** src, const uint8_t* dataEnd, uint32_t* yPtr)
+{
+  // Error code.
+  err_t err = ERR_OK;
 
-  if ((err = image.create(_size, _format))) goto _End;
+  // Source.
+  const uint8_t* dataCur = *src;
+  const uint8_t* dataRow = dataCur;
+
+  // Destination.
+  uint32_t y = *yPtr;
+  ssize_t stride = image.getStride();
+  uint8_t* pixels = image.getScanlineX(0) + (ssize_t)y * stride;
+
+  // Temporary plane data.
+  MemBufferTmp<1024> temporary;
+  uint8_t* mem;
 
-  pixels = image.getScanlineX(0);
-  stride = image.getStride();
+  // Bytes per line.
+  uint32_t bytesPerLine = _pcxFileHeader.bytesPerLine;
+
+  // Loop variables.
+  uint x;
 
   // --------------------------------------------------------------------------
   // [Read - 1 Bit, 1-4 Planes]
@@ -526,13 +639,16 @@ err_t PcxDecoder::readImage(Image& image)
       goto _End;
     }
 
-    for (y = 0; y != (uint32_t)_size.h; y++, pixels += stride)
+    for (; y != (uint32_t)_size.h; y++, pixels += stride)
     {
+      dataRow = dataCur;
+      MemOps::zero(pixels, (uint32_t)_size.w);
+
       // Expand planes to 8 BPP.
       for (plane = 0; plane != _planes; plane++)
       {
         mem = (uint8_t*)temporary.getMem();
-        if ((err = _PcxDecodeScanline(mem, &dataCur, dataEnd, bytesPerLine, 0, 1)) != ERR_OK) goto _End;
+        if ((err = _PcxDecodeScanline(mem, &dataCur, dataEnd, bytesPerLine, 0, 1)) != ERR_OK) goto _Fail;
 
         for (x = 0; x != (uint32_t)_size.w; x++)
         {
@@ -560,10 +676,12 @@ err_t PcxDecoder::readImage(Image& image)
       goto _End;
     }
 
-    for (y = 0; y != (uint32_t)_size.h; y++, pixels += stride)
+    for (; y != (uint32_t)_size.h; y++, pixels += stride)
     {
+      dataRow = dataCur;
+
       mem = (uint8_t*)temporary.getMem();
-      if ((err = _PcxDecodeScanline(mem, &dataCur, dataEnd, bytesPerLine, 0, 1)) != ERR_OK) goto _End;
+      if ((err = _PcxDecodeScanline(mem, &dataCur, dataEnd, bytesPerLine, 0, 1)) != ERR_OK) goto _Fail;
 
       for (x = 0; x != (uint32_t)_size.w; x++)
       {
@@ -614,104 +732,99 @@ err_t PcxDecoder::readImage(Image& image)
         FOG_ASSERT_NOT_REACHED();
     }
 
-    for (y = 0; y != (uint32_t)_size.h; y++, pixels += stride)
+    for (; y != (uint32_t)_size.h; y++, pixels += stride)
     {
+      dataRow = dataCur;
+
       for (plane = 0; plane < planeMax; plane++)
       {
-        if ((err = _PcxDecodeScanline(pixels + pos[plane], &dataCur, dataEnd, (uint32_t)_size.w, ignore, increment)) != ERR_OK) goto _End;
+        if ((err = _PcxDecodeScanline(pixels + pos[plane], &dataCur, dataEnd, (uint32_t)_size.w, ignore, increment)) != ERR_OK) goto _Fail;
       }
       if (planeMax == 4) _api_raster.convert.prgb32_from_argb32(pixels, pixels, _size.w, NULL);
       if ((y & 15) == 0) updateProgress(y, (uint32_t)_size.h);
     }
   }
+  goto _End;
 
-  // --------------------------------------------------------------------------
-  // [Read - Palette]
-  // --------------------------------------------------------------------------
+_Fail:
+  // Don't consume the incomplete row, it's decoded again when more data is
+  // available (feed mode).
+  dataCur = dataRow;
 
-  if (_depth <= 8)
-  {
-    uint32_t palData[256];
-    uint32_t palLength = 1 << (_depth * _planes);
+_End:
+  *src = dataCur;
+  *yPtr = y;
+  return err;
+}
 
-    bool palRead = true;
+err_t PcxDecoder::_readPalette(const uint8_t* dataCur, const uint8_t* dataEnd)
+{
+  uint32_t palData[256];
+  uint32_t palLength = 1 << (_depth * _planes);
 
-    // Setup basic palette settings.
-    MemOps::zero(palData, 256 * sizeof(uint32_t));
+  bool palRead = true;
+  uint x;
 
-    if (_depth == 1 && _planes == 1)
-    {
-      _PcxFillMonoPalette(palData);
-      if (_pcxFileHeader.version == 2) palRead = false;
-    }
-    else
-    {
-      _PcxFillEgaPalette(palData);
-    }
+  // Setup basic palette settings.
+  MemOps::zero(palData, 256 * sizeof(uint32_t));
 
-    // 256 color palette.
-    if (_depth == 8)
-    {
-      // Find 0x0C marker.
-      while (dataCur != dataEnd)
-      {
-        if (*dataCur++ == 0x0C)
-        {
-          infoSecPalette = true;
-          break;
-        }
-      }
+  if (_depth == 1 && _planes == 1)
+  {
+    _PcxFillMonoPalette(palData);
+    if (_pcxFileHeader.version == 2) palRead = false;
+  }
+  else
+  {
+    _PcxFillEgaPalette(palData);
+  }
 
-      if (dataCur == dataEnd)
-      {
-        // Marker not found, so use greyscale?
-        // if (_pcxFileHeader.paletteInfo == 2)
-        // {
-        _PcxFillGreyPalette(palData);
-        palRead = false;
-        // }
-      }
-      else
-      {
-        size_t n = (size_t)(dataEnd - dataCur) / 3;
-        if (n < palLength) palLength = (uint)n;
-      }
-      infoSecPaletteColors = palLength;
+  // 256 color palette.
+  if (_depth == 8)
+  {
+    // Find 0x0C marker.
+    while (dataCur != dataEnd)
+    {
+      if (*dataCur++ == 0x0C)
+        break;
     }
-    else if (_pcxFileHeader.version != 3)
+
+    if (dataCur == dataEnd)
     {
-      dataCur = _pcxFileHeader.colorMap;
-      if (palLength > 16)
-      {
-        err = ERR_IMAGEIO_UNSUPPORTED_FORMAT;
-        goto _End;
-      }
+      // Marker not found, so use greyscale?
+      // if (_pcxFileHeader.paletteInfo == 2)
+      // {
+      _PcxFillGreyPalette(palData);
+      palRead = false;
+      // }
     }
     else
     {
-      palRead = false;
+      size_t n = (size_t)(dataEnd - dataCur) / 3;
+      if (n < palLength) palLength = (uint)n;
     }
+  }
+  else if (_pcxFileHeader.version != 3)
+  {
+    dataCur = _pcxFileHeader.colorMap;
+    if (palLength > 16)
+      return ERR_IMAGEIO_UNSUPPORTED_FORMAT;
+  }
+  else
+  {
+    palRead = false;
+  }
 
-    // Read primary or secondary palette (from PCX header or end of file)
-    if (palRead)
+  // Read primary or secondary palette (from PCX header or end of file)
+  if (palRead)
+  {
+    for (x = 0; x < palLength; x++, dataCur += 3)
     {
-      for (x = 0; x < palLength; x++, dataCur += 3)
-      {
-        palData[x] = Argb32(0xFF, dataCur[0], dataCur[1], dataCur[2]);
-      }
+      palData[x] = Argb32(0xFF, dataCur[0], dataCur[1], dataCur[2]);
     }
-
-    _palette.setData(Range(0, 256), reinterpret_cast<Argb32*>(palData));
   }
 
-  // apply palette if needed
-  if (_depth <= 8) image.setPalette(_palette);
-
-_End:
-  image._modified();
-
-  if (err == ERR_OK) updateProgress(1.0);
-  return err;
+  _palette.setData(Range(0, 256), reinterpret_cast<Argb32*>(palData));
+  return ERR_OK;
 }
 
 // ============================================================================
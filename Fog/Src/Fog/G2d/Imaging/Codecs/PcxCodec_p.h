@@ -98,6 +98,12 @@ struct FOG_NO_EXPORT PcxDecoder : public ImageDecoder
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
 
+  // --------------------------------------------------------------------------
+  // [Feed]
+  // --------------------------------------------------------------------------
+
+  virtual err_t _feed(bool end);
+
   // --------------------------------------------------------------------------
   // [Accessors]
   // --------------------------------------------------------------------------
@@ -108,14 +114,27 @@ struct FOG_NO_EXPORT PcxDecoder : public ImageDecoder
   // [Helpers]
   // --------------------------------------------------------------------------
 
+  void _readComment();
+
+  //! @brief Decode rows starting at @a *y, advancing @a src and @a y only
+  //! past complete rows.
+  err_t _readRows(Image& image, const uint8_t** src, const uint8_t* dataEnd, uint32_t* y);
+  err_t _readPalette(const uint8_t* dataCur, const uint8_t* dataEnd);
+
   // Clear everything.
-  FOG_INLINE void zeroall() { MemOps::zero(&_pcxFileHeader, sizeof(_pcxFileHeader)); }
+  FOG_INLINE void zeroall()
+  {
+    MemOps::zero(&_pcxFileHeader, sizeof(_pcxFileHeader));
+    _pcxFeedRow = 0;
+  }
 
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
 
   PcxHeader _pcxFileHeader;
+  //! @brief Count of rows already decoded in feed mode.
+  uint32_t _pcxFeedRow;
 };
 
 // ============================================================================
@@ -126,6 +126,28 @@ err_t PngLibrary::init()
     return ERR_IMAGE_LIBPNG_NOT_LOADED;
   }
 
+  // Optional, used by PngDecoder to decode data as they arrive.
+  set_progressive_read_fn = (void (FOG_CDECL *)(png_structp, png_voidp, png_progressive_info_ptr, png_progressive_row_ptr, png_progressive_end_ptr))
+    dll.getSymbol("png_set_progressive_read_fn");
+  process_data = (void (FOG_CDECL *)(png_structp, png_infop, png_bytep, png_size_t))
+    dll.getSymbol("png_process_data");
+  progressive_combine_row = (void (FOG_CDECL *)(png_structp, png_bytep, png_bytep))
+    dll.getSymbol("png_progressive_combine_row");
+  get_progressive_ptr = (png_voidp (FOG_CDECL *)(png_structp))
+    dll.getSymbol("png_get_progressive_ptr");
+  start_read_image = (void (FOG_CDECL *)(png_structp))
+    dll.getSymbol("png_start_read_image");
+
+  if (set_progressive_read_fn == NULL || process_data == NULL || progressive_combine_row == NULL ||
+      get_progressive_ptr == NULL || start_read_image == NULL)
+  {
+    set_progressive_read_fn = NULL;
+    process_data = NULL;
+    progressive_combine_row = NULL;
+    get_progressive_ptr = NULL;
+    start_read_image = NULL;
+  }
+
   return ERR_OK;
 }
 
@@ -234,6 +256,27 @@ static void png_user_flush_data(png_structp png_ptr)
 {
 }
 
+static void png_feed_info(png_structp png_ptr, png_infop info_ptr)
+{
+  PngDecoder* decoder = reinterpret_cast<PngDecoder*>(
+    pngProvider->_pngLibrary.get_progressive_ptr(png_ptr));
+  decoder->_onPngInfo();
+}
+
+static void png_feed_row(png_structp png_ptr, png_bytep row, png_uint_32 y, int pass)
+{
+  PngDecoder* decoder = reinterpret_cast<PngDecoder*>(
+    pngProvider->_pngLibrary.get_progressive_ptr(png_ptr));
+  decoder->_onPngRow(row, y, pass);
+}
+
+static void png_feed_end(png_structp png_ptr, png_infop info_ptr)
+{
+  PngDecoder* decoder = reinterpret_cast<PngDecoder*>(
+    pngProvider->_pngLibrary.get_progressive_ptr(png_ptr));
+  decoder->_onPngEnd();
+}
+
 // ============================================================================
 // [Fog::PngDecoder - Construction / Destruction]
 // ============================================================================
@@ -241,7 +284,11 @@ static void png_user_flush_data(png_structp png_ptr)
 PngDecoder::PngDecoder(ImageCodecProvider* provider) :
   ImageDecoder(provider),
   _png_ptr(NULL),
-  _info_ptr(NULL)
+  _info_ptr(NULL),
+  _pngPassesCount(0),
+  _pngFeedDone(false),
+  _pngFeedResult(ERR_OK),
+  _pngFeedBuffer(NULL)
 {
 }
 
@@ -258,6 +305,14 @@ void PngDecoder::reset()
 {
   _deletePngStream();
   ImageDecoder::reset();
+
+  if (_pngFeedBuffer) MemMgr::free(_pngFeedBuffer);
+
+  _pngPassesCount = 0;
+  _pngFeedDone = false;
+  _pngFeedResult = ERR_OK;
+  _pngFeedBuffer = NULL;
+  _pngConverter.reset();
 }
 
 // ============================================================================
@@ -276,8 +331,6 @@ err_t PngDecoder::readHeader()
   // Mark header as done.
   _headerDone = true;
 
-  png_uint_32 w32, h32;
-
   if ((_headerResult = _createPngStream()) != ERR_OK)
   {
     return _headerResult;
@@ -289,6 +342,16 @@ err_t PngDecoder::readHeader()
   }
 
   png.read_info(_png_ptr, _info_ptr);
+  return (_headerResult = _readIHDR());
+}
+
+err_t PngDecoder::_readIHDR()
+{
+  // Png library pointer.
+  PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
+
+  png_uint_32 w32, h32;
+
   png.get_IHDR(_png_ptr, _info_ptr,
     (png_uint_32 *)(&w32),
     (png_uint_32 *)(&h32),
@@ -304,7 +367,7 @@ err_t PngDecoder::readHeader()
   // Check whether the image size is valid.
   if (!checkImageSize())
   {
-    return (_headerResult = ERR_IMAGE_INVALID_SIZE);
+    return ERR_IMAGE_INVALID_SIZE;
   }
 
   // Png contains only one image.
@@ -319,40 +382,18 @@ err_t PngDecoder::readHeader()
     _format = IMAGE_FORMAT_XRGB32;
 
   // Success.
-  return (_headerResult = ERR_OK);
+  return ERR_OK;
 }
 
-// ============================================================================
-// [Fog::PngDecoder - ReadImage]
-// ============================================================================
-
-err_t PngDecoder::readImage(Image& image)
+void PngDecoder::_setupTransforms()
 {
   // Png library pointer.
   PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
-  FOG_ASSERT(png.err == ERR_OK);
-
-  // Read png header.
-  if (readHeader() != ERR_OK) return _headerResult;
-
-  // Don't read image more than once.
-  if (isReaderDone()) return (_readerResult = ERR_IMAGE_NO_FRAMES);
-
-  // Error code (default is success).
-  uint32_t err = ERR_OK;
-
-  // Image converter (to convert non-premultiplied to premultiplied).
-  ImageConverter converter;
 
   // Variables.
   bool hasAlpha = false;
   bool hasGrey = false;
 
-  if (setjmp(*png.set_longjmp_fn((png_structp)_png_ptr, longjmp, sizeof(jmp_buf))))
-  {
-    return ERR_IMAGE_LIBPNG_ERROR;
-  }
-
   // Change the order of packed pixels to least significant bit first.
   png.set_packswap(_png_ptr);
 
@@ -389,17 +430,51 @@ err_t PngDecoder::readImage(Image& image)
       if (png.get_bit_depth(_png_ptr, _info_ptr) < 8) png.set_expand_gray_1_2_4_to_8(_png_ptr);
     }
   }
+}
 
-  if ((err = image.create(_size, _format))) goto _End;
+err_t PngDecoder::_setupConverter(ImageConverter& converter)
+{
+  // Convert non-premultiplied to premultiplied.
+  if (_format != IMAGE_FORMAT_PRGB32)
+    return ERR_OK;
+
+  return converter.create(
+    ImageFormatDescription::getByFormat(_format),
+    ImageFormatDescription::fromArgb(32, IMAGE_FD_NONE, PIXEL_ARGB32_MASK_A, PIXEL_ARGB32_MASK_R, PIXEL_ARGB32_MASK_G, PIXEL_ARGB32_MASK_B));
+}
+
+// ============================================================================
+// [Fog::PngDecoder - ReadImage]
+// ============================================================================
+
+err_t PngDecoder::readImage(Image& image)
+{
+  // Png library pointer.
+  PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
+  FOG_ASSERT(png.err == ERR_OK);
+
+  // Read png header.
+  if (readHeader() != ERR_OK) return _headerResult;
 
-  if (_format == IMAGE_FORMAT_PRGB32)
+  // Don't read image more than once.
+  if (isReaderDone()) return (_readerResult = ERR_IMAGE_NO_FRAMES);
+
+  // Error code (default is success).
+  uint32_t err = ERR_OK;
+
+  // Image converter (to convert non-premultiplied to premultiplied).
+  ImageConverter converter;
+
+  if (setjmp(*png.set_longjmp_fn((png_structp)_png_ptr, longjmp, sizeof(jmp_buf))))
   {
-    err = converter.create(
-      ImageFormatDescription::getByFormat(_format),
-      ImageFormatDescription::fromArgb(32, IMAGE_FD_NONE, PIXEL_ARGB32_MASK_A, PIXEL_ARGB32_MASK_R, PIXEL_ARGB32_MASK_G, PIXEL_ARGB32_MASK_B));
-    if (FOG_IS_ERROR(err)) goto _End;
+    return ERR_IMAGE_LIBPNG_ERROR;
   }
 
+  _setupTransforms();
+
+  if ((err = image.create(_size, _format))) goto _End;
+  if ((err = _setupConverter(converter))) goto _End;
+
   {
     int passesCount = png.set_interlace_handling(_png_ptr);
 
@@ -433,6 +508,126 @@ _End:
   return err;
 }
 
+// ============================================================================
+// [Fog::PngDecoder - Feed]
+// ============================================================================
+
+err_t PngDecoder::_feed(bool end)
+{
+  // Png library pointer.
+  PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
+  FOG_ASSERT(png.err == ERR_OK);
+
+  // Without the progressive reader the image is decoded at once.
+  if (png.process_data == NULL)
+    return Base::_feed(end);
+
+  if (_png_ptr == NULL)
+  {
+    FOG_RETURN_ON_ERROR(_createPngStream());
+    png.set_progressive_read_fn(_png_ptr, this, png_feed_info, png_feed_row, png_feed_end);
+  }
+
+  size_t available = _getFeedAvailable();
+
+  if (available > 0 && !_pngFeedDone)
+  {
+    StringA buffer = _stream.getBuffer();
+    png_bytep data = (png_bytep)buffer.getData() + (size_t)_stream.tell();
+
+    // libpng keeps the data it can't process yet in its own buffer.
+    _stream.seek((int64_t)available, STREAM_SEEK_CUR);
+
+    if (setjmp(*png.set_longjmp_fn(_png_ptr, longjmp, sizeof(jmp_buf))))
+    {
+      return FOG_IS_ERROR(_pngFeedResult) ? _pngFeedResult : (err_t)ERR_IMAGE_LIBPNG_ERROR;
+    }
+
+    png.process_data(_png_ptr, _info_ptr, data, available);
+  }
+
+  if (_pngFeedDone)
+  {
+    updateProgress(1.0f);
+    return ERR_OK;
+  }
+
+  return end ? (err_t)ERR_IMAGE_TRUNCATED : (err_t)ERR_IMAGE_NEED_MORE_DATA;
+}
+
+void PngDecoder::_onPngInfo()
+{
+  // Png library pointer.
+  PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
+
+  _headerDone = true;
+  _headerResult = _readIHDR();
+
+  if (FOG_IS_ERROR(_headerResult))
+  {
+    _pngFeedResult = _headerResult;
+    png.error(_png_ptr, "Invalid Header");
+  }
+
+  _setupTransforms();
+  _pngPassesCount = png.set_interlace_handling(_png_ptr);
+  png.start_read_image(_png_ptr);
+
+  _pngFeedResult = _feedImage.create(_size, _format);
+  if (_pngFeedResult == ERR_OK)
+    _pngFeedResult = _setupConverter(_pngConverter);
+
+  // Interlaced passes are combined with the previous ones, which must be kept
+  // non-premultiplied.
+  if (_pngFeedResult == ERR_OK && _pngPassesCount > 1 && _pngConverter.isValid())
+  {
+    _pngFeedBuffer = reinterpret_cast<uint8_t*>(MemMgr::calloc((size_t)_size.w * (size_t)_size.h * 4));
+    if (FOG_IS_NULL(_pngFeedBuffer)) _pngFeedResult = ERR_RT_OUT_OF_MEMORY;
+  }
+
+  if (FOG_IS_ERROR(_pngFeedResult))
+    png.error(_png_ptr, "Out of Memory");
+
+  // Pixels not decoded yet are transparent (or black).
+  _feedImage.clear(Argb32(_format == IMAGE_FORMAT_PRGB32 ? 0x00000000 : 0xFF000000));
+}
+
+void PngDecoder::_onPngRow(png_bytep row, png_uint_32 y, int pass)
+{
+  // Png library pointer.
+  PngLibrary& png = reinterpret_cast<PngCodecProvider*>(_provider)->_pngLibrary;
+
+  // The row is not changed by this pass.
+  if (row == NULL || y >= (png_uint_32)_size.h)
+    return;
+
+  uint8_t* dstPixels = _feedImage.getScanlineX((int)y);
+
+  if (_pngFeedBuffer)
+  {
+    uint8_t* rawPixels = _pngFeedBuffer + (size_t)y * (size_t)_size.w * 4;
+
+    png.progressive_combine_row(_png_ptr, rawPixels, row);
+    _pngConverter.blitLine(dstPixels, rawPixels, _size.w);
+  }
+  else
+  {
+    png.progressive_combine_row(_png_ptr, dstPixels, row);
+    if (_pngConverter.isValid()) _pngConverter.blitLine(dstPixels, dstPixels, _size.w);
+  }
+
+  _feedImage._modified();
+  _feedRows((int)y, 1);
+
+  uint32_t yi = (uint32_t)pass * (uint32_t)_size.h + y;
+  if ((yi & 15) == 0) updateProgress(yi, (uint32_t)(_pngPassesCount * _size.h));
+}
+
+void PngDecoder::_onPngEnd()
+{
+  _pngFeedDone = true;
+}
+
 uint32_t PngDecoder::_createPngStream()
 {
   // Already created?
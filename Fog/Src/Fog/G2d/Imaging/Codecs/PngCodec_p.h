@@ -17,6 +17,7 @@
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageCodec.h>
 #include <Fog/G2d/Imaging/ImageCodecProvider.h>
+#include <Fog/G2d/Imaging/ImageConverter.h>
 #include <Fog/G2d/Imaging/ImageDecoder.h>
 #include <Fog/G2d/Imaging/ImageEncoder.h>
 
@@ -94,6 +95,14 @@ struct FOG_NO_EXPORT PngLibrary
     void* addr[NUM_SYMBOLS];
   };
 
+  // Optional symbols of the progressive reader, used by PngDecoder in feed
+  // mode. They are all set or all NULL.
+  void (FOG_CDECL *set_progressive_read_fn)(png_structp png_ptr, png_voidp progressive_ptr, png_progressive_info_ptr info_fn, png_progressive_row_ptr row_fn, png_progressive_end_ptr end_fn);
+  void (FOG_CDECL *process_data)(png_structp png_ptr, png_infop info_ptr, png_bytep buffer, png_size_t buffer_size);
+  void (FOG_CDECL *progressive_combine_row)(png_structp png_ptr, png_bytep old_row, png_bytep new_row);
+  png_voidp (FOG_CDECL *get_progressive_ptr)(png_structp png_ptr);
+  void (FOG_CDECL *start_read_image)(png_structp png_ptr);
+
   Library dll;
   err_t err;
 
@@ -153,6 +162,17 @@ struct FOG_NO_EXPORT PngDecoder : public ImageDecoder
   virtual err_t readHeader();
   virtual err_t readImage(Image& image);
 
+  // --------------------------------------------------------------------------
+  // [Feed]
+  // --------------------------------------------------------------------------
+
+  virtual err_t _feed(bool end);
+
+  // Progressive reader callbacks.
+  void _onPngInfo();
+  void _onPngRow(png_bytep row, png_uint_32 y, int pass);
+  void _onPngEnd();
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -163,8 +183,20 @@ struct FOG_NO_EXPORT PngDecoder : public ImageDecoder
   int _png_color_type;
   int _png_interlace_type;
 
+  // Feed mode.
+  int _pngPassesCount;
+  bool _pngFeedDone;
+  err_t _pngFeedResult;
+  //! @brief Non-premultiplied rows of interlaced PRGB32 image (feed mode).
+  uint8_t* _pngFeedBuffer;
+  ImageConverter _pngConverter;
+
   uint32_t _createPngStream();
   void _deletePngStream();
+
+  err_t _readIHDR();
+  void _setupTransforms();
+  err_t _setupConverter(ImageConverter& converter);
 };
 
 // ============================================================================
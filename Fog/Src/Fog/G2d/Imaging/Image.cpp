@@ -41,7 +41,7 @@
 #include <Fog/G2d/Painting/RasterStructs_p.h>
 #include <Fog/G2d/Painting/RasterUtil_p.h>
 #include <Fog/G2d/Tools/ColorAnalyzer_p.h>
-#include <Fog/G2d/Tools/Reduce_p.h>
+#include <Fog/G2d/Tools/ColorQuantizer_p.h>
 
 namespace Fog {
 
@@ -102,6 +102,7 @@ static err_t FOG_CDECL Image_Buffer_create(ImageData** pd, const SizeI* size, ui
   d->stride = stride;
   d->data = (uint8_t*)( ((size_t)d + sizeof(ImageData) + 15) & ~(size_t)15 );
   d->first = d->data;
+  d->mipmap = NULL;
   d->palette.init();
 
   *pd = d;
@@ -256,6 +257,7 @@ static err_t FOG_CDECL Image_create(Image* self, const SizeI* size, uint32_t for
 
     if (oldSize == newSize)
     {
+      d->resetMipmap();
       d->size = *size;
       d->format = format;
       d->colorKey = IMAGE_COLOR_KEY_NONE;
@@ -306,6 +308,7 @@ static err_t FOG_CDECL Image_adopt(Image* self, const ImageBits* imageBits, uint
       (d->vType & (VAR_FLAG_STATIC | VAR_FLAG_READ_ONLY)) == 0)
   {
     d->vType &= ~VAR_FLAG_READ_ONLY;
+    d->resetMipmap();
   }
   else
   {
@@ -330,6 +333,7 @@ static err_t FOG_CDECL Image_adopt(Image* self, const ImageBits* imageBits, uint
     d->bytesPerPixel = desc.getBytesPerPixel();
     FOG_PADDING_ZERO_64(d->padding);
 
+    d->mipmap = NULL;
     d->palette.init();
     atomicPtrXchg(&self->_d, d)->release();
   }
@@ -395,7 +399,67 @@ static uint32_t FOG_CDECL Image_getAlphaDistribution(const Image* self)
 
 static void FOG_CDECL Image_modified(Image* self)
 {
-  // TODO:
+  self->_d->resetMipmap();
+}
+
+// ============================================================================
+// [Fog::Image - MipLevel]
+// ============================================================================
+
+static err_t FOG_CDECL Image_getMipLevel(const Image* self, Image* dst, uint32_t level)
+{
+  ImageData* d = self->_d;
+
+  for (; level != 0; level--)
+  {
+    ImageData* next = (ImageData*)AtomicCore<void*>::get((void**)&d->mipmap);
+
+    if (next == NULL)
+    {
+      // The smallest level is reached.
+      if (d->size.w <= 1 && d->size.h <= 1)
+        break;
+
+      switch (d->format)
+      {
+        case IMAGE_FORMAT_PRGB32:
+        case IMAGE_FORMAT_XRGB32:
+        case IMAGE_FORMAT_RGB24:
+        case IMAGE_FORMAT_A8:
+          break;
+
+        default:
+          return ERR_IMAGE_INVALID_FORMAT;
+      }
+
+      // The pixels can change while the image is being painted, it's not
+      // possible to cache anything.
+      if (d->locked)
+        return ERR_RT_BUSY;
+
+      Image src(d->addRef());
+      Image tmp;
+
+      SizeI size((d->size.w + 1) >> 1, (d->size.h + 1) >> 1);
+      FOG_RETURN_ON_ERROR(
+        fog_api.image_resize(&tmp, &size, &src, NULL, IMAGE_RESIZE_BILINEAR, NULL)
+      );
+
+      // The level can be created by more threads at the same time, only the
+      // first one is stored, the others are discarded.
+      next = tmp._d;
+      if (AtomicCore<void*>::cmpXchg((void**)&d->mipmap, NULL, (void*)next))
+        next->addRef();
+      else
+        next = (ImageData*)AtomicCore<void*>::get((void**)&d->mipmap);
+    }
+
+    d = next;
+  }
+
+  if (dst->_d != d)
+    atomicPtrXchg(&dst->_d, d->addRef())->release();
+  return ERR_OK;
 }
 
 // ============================================================================
@@ -666,84 +730,42 @@ static err_t FOG_CDECL Image_convertTo8BitDepth(Image* self)
   FOG_RETURN_ON_ERROR(Image_convertTo8BPC(self));
   d = self->_d;
 
+  // A16 is converted to A8 by Image_convertTo8BPC().
+  if (d->format == IMAGE_FORMAT_A8)
+    return ERR_OK;
+
   ImageData* newd;
   FOG_RETURN_ON_ERROR(fog_api.image_vTable[IMAGE_TYPE_BUFFER]->create(&newd, &d->size, IMAGE_FORMAT_I8));
 
-  ssize_t dStride = newd->stride;
-  uint8_t* dPtr = newd->first;
-
-  ssize_t sStride = d->stride;
-  const uint8_t* sPtr = d->first;
-
   int w = d->size.w;
   int h = d->size.h;
 
-  int x;
-  int y;
+  // The image is reduced to its exact colors if there is at most 256 of them,
+  // otherwise the palette is created by Wu's quantizer and the pixels are
+  // mapped using the pattern dither, which doesn't depend on neighbours so the
+  // rows can be mapped in parallel.
+  ColorQuantizer quantizer;
+  err_t err;
 
-  err_t err = ERR_OK;
-  Reduce reduce;
-
-  if (reduce.analyze(*self, true))
-  {
-    err = newd->palette->setData(reduce.getPalette());
-    if (FOG_IS_ERROR(err))
-      goto _Fail;
-
-    dStride -= w * 1;
-    sStride -= w * d->bytesPerPixel;
-    uint32_t mask = reduce.getMask();
-
-    for (y = 0; y < h; y++, dPtr += dStride, sPtr += sStride)
-    {
-      switch (d->format)
-      {
-        case IMAGE_FORMAT_PRGB32:
-        case IMAGE_FORMAT_XRGB32:
-          for (x = 0; x < w; x++, dPtr += 1, sPtr += 4)
-          {
-            uint32_t pix0p;
-
-            Acc::p32Load4a(pix0p, sPtr);
-            Acc::p32And(pix0p, pix0p, mask);
-            dPtr[0] = reduce.traslate(pix0p);
-          }
-          break;
-
-        case IMAGE_FORMAT_RGB24:
-          for (x = 0; x < w; x++, dPtr += 1, sPtr += 3)
-          {
-            uint32_t pix0p;
-
-            Acc::p32Load3b(pix0p, sPtr);
-            Acc::p32And(pix0p, pix0p, mask);
-            dPtr[0] = reduce.traslate(pix0p);
-          }
-          break;
+  err = quantizer.addImage(d->first, d->stride, d->format, w, h);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
 
-        default:
-          FOG_ASSERT_NOT_REACHED();
-      }
-    }
-  }
-  else
-  {
-    ImagePalette palette = ImagePalette::fromColorCube(6, 6, 6);
-    FOG_RETURN_ON_ERROR(newd->palette->setData(palette));
+  err = quantizer.buildPalette(256);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
 
-    ImageDither8Params params;
-    params.rCount = 6;
-    params.gCount = 6;
-    params.bCount = 6;
-    params.transposeTable = NULL;
-    params.transposeTableLength = 0;
+  err = newd->palette->setData(Range(0, quantizer.getLength()), quantizer.getPalette());
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
 
-    ImageConverter converter;
-    FOG_RETURN_ON_ERROR(converter.createDithered8(params,
-      ImageFormatDescription::getByFormat(d->format), NULL, NULL));
+  err = quantizer.beginMap((uint32_t)w, DITHER_TYPE_PATTERN);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
 
-    converter.blitRect(dPtr, dStride, sPtr, sStride, w, h, PointI(0, 0));
-  }
+  err = quantizer.mapImage(newd->first, newd->stride, d->first, d->stride, d->format, w, h);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
 
   atomicPtrXchg(&self->_d, newd)->release();
   newd->updatePalette(Range(0, 256));
@@ -2648,6 +2670,8 @@ static void FOG_CDECL Image_dRelease(ImageData* d)
       Application::terminate(-1);
     }
 
+    if (d->mipmap != NULL)
+      d->mipmap->release();
     d->destroy();
   }
 }
@@ -2671,6 +2695,7 @@ FOG_NO_EXPORT void Image_init(void)
 
   fog_api.image_getAlphaDistribution = Image_getAlphaDistribution;
   fog_api.image_modified = Image_modified;
+  fog_api.image_getMipLevel = Image_getMipLevel;
 
   fog_api.image_reset = Image_reset;
   fog_api.image_create = Image_create;
@@ -2740,6 +2765,7 @@ FOG_NO_EXPORT void Image_init(void)
   d->adopted = 0;
   d->colorKey = IMAGE_COLOR_KEY_NONE;
   d->bytesPerPixel = 0;
+  d->mipmap = NULL;
   d->palette.initCustom1(fog_api.imagepalette_oEmpty->_d);
 
   fog_api.image_oEmpty = Image_oEmpty.initCustom1(d);
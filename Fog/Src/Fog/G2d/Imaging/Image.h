@@ -87,6 +87,15 @@ struct FOG_NO_EXPORT ImageData
     return (reference.get() + ((vType & VAR_FLAG_READ_ONLY) != 0)) == 1;
   }
 
+  //! @brief Discard the cached mip levels, must be called when the image
+  //! pixels are going to be changed.
+  FOG_INLINE void resetMipmap()
+  {
+    ImageData* m = atomicPtrXchg(&mipmap, (ImageData*)NULL);
+    if (m != NULL)
+      m->release();
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -164,6 +173,13 @@ struct FOG_NO_EXPORT ImageData
   //! last scanline and @c stride is negative.
   uint8_t* first;
 
+  //! @brief The next level of the mip pyramid (the image scaled down to the
+  //! half), or @c NULL if not created yet.
+  //!
+  //! Created on demand by @c Image::getMipLevel() and discarded when the image
+  //! is modified (see @c Image::_modified()).
+  ImageData* mipmap;
+
   //! @brief Image palette (used only by 8-bit indexed images).
   Static<ImagePalette> palette;
 };
@@ -359,6 +375,25 @@ struct FOG_NO_EXPORT Image
     return fog_api.image_modified(this);
   }
 
+  // --------------------------------------------------------------------------
+  // [MipLevel]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the mip level @a level of the image into @a dst.
+  //!
+  //! The level 0 is the image itself, each next level is the previous level
+  //! scaled down to the half (the size is rounded up). The levels are created
+  //! on demand and cached by the image data until the image is modified. If
+  //! the image is smaller than requested level then the smallest level is
+  //! returned.
+  //!
+  //! @note Only @c IMAGE_FORMAT_PRGB32, @c IMAGE_FORMAT_XRGB32,
+  //! @c IMAGE_FORMAT_RGB24 and @c IMAGE_FORMAT_A8 formats are supported.
+  FOG_INLINE err_t getMipLevel(Image& dst, uint32_t level) const
+  {
+    return fog_api.image_getMipLevel(this, &dst, level);
+  }
+
   // --------------------------------------------------------------------------
   // [Create / Adopt]
   // --------------------------------------------------------------------------
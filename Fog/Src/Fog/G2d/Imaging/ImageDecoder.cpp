@@ -25,8 +25,12 @@ ImageDecoder::ImageDecoder(ImageCodecProvider* provider) :
   ImageCodec(provider),
   _headerDone(false),
   _readerDone(false),
+  _feedMode(false),
+  _feedKeepAll(false),
   _headerResult(ERR_OK),
-  _readerResult(ERR_OK)
+  _readerResult(ERR_OK),
+  _feedFunc(NULL),
+  _feedData(NULL)
 {
   _codecType = IMAGE_CODEC_DECODER;
 }
@@ -48,6 +52,165 @@ void ImageDecoder::reset()
 
   _headerResult = ERR_OK;
   _readerResult = ERR_OK;
+
+  _feedMode = false;
+  _feedImage.reset();
+
+  _frameCanvas.reset();
+}
+
+// ============================================================================
+// [Fog::ImageDecoder - Frames]
+// ============================================================================
+
+err_t ImageDecoder::readFramesCount(uint32_t* count)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+
+  *count = _framesCount;
+  return ERR_OK;
+}
+
+err_t ImageDecoder::readFrameInfo(uint32_t index, ImageFrameInfo& info)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+
+  if (index >= _framesCount)
+    return ERR_IMAGE_NO_FRAMES;
+
+  // Frames of non-animated images cover the whole image.
+  info.rect.setRect(0, 0, _size.w, _size.h);
+  info.delay = 0;
+  info.disposal = IMAGE_DISPOSAL_NONE;
+  return ERR_OK;
+}
+
+err_t ImageDecoder::seekFrame(uint32_t index)
+{
+  FOG_RETURN_ON_ERROR(readHeader());
+
+  if (index >= _framesCount)
+    return ERR_IMAGE_NO_FRAMES;
+
+  // Only sequential reading is supported by default.
+  if (index == _actualFrame && !_readerDone)
+    return ERR_OK;
+
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+err_t ImageDecoder::readFrame(RectI* dirty)
+{
+  Image image;
+
+  FOG_RETURN_ON_ERROR(readImage(image));
+  FOG_RETURN_ON_ERROR(image.convert(IMAGE_FORMAT_PRGB32));
+
+  _frameCanvas = image;
+
+  if (dirty)
+    dirty->setRect(0, 0, image.getWidth(), image.getHeight());
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ImageDecoder - Feed]
+// ============================================================================
+
+err_t ImageDecoder::feed(const void* data, size_t size)
+{
+  if (!_feedMode)
+  {
+    // The decoder is already used by readHeader() / readImage().
+    if (_stream.isOpen())
+      return ERR_RT_INVALID_STATE;
+
+    FOG_RETURN_ON_ERROR(_stream.openBuffer());
+    _attachedOffset = 0;
+    _feedMode = true;
+  }
+
+  if (_readerDone)
+    return _readerResult;
+
+  if (size != 0)
+  {
+    // Append the data, the stream stays positioned at the first byte which
+    // wasn't consumed by the decoder.
+    int64_t position = _stream.tell();
+
+    _stream.seek(0, STREAM_SEEK_END);
+    size_t written = _stream.write(data, size);
+    _stream.seek(position, STREAM_SEEK_SET);
+
+    if (written != size)
+      return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  err_t err = _feed(false);
+  if (err != ERR_IMAGE_NEED_MORE_DATA)
+  {
+    _readerDone = true;
+    _readerResult = err;
+    return err;
+  }
+
+  // Release the consumed data, the unconsumed data are moved to the beginning
+  // of the buffer.
+  int64_t consumed = _stream.tell();
+  if (consumed > 0 && !_feedKeepAll)
+  {
+    StringA buffer = _stream.getBuffer();
+
+    FOG_RETURN_ON_ERROR(buffer.remove(Range(0, (size_t)consumed)));
+    FOG_RETURN_ON_ERROR(_stream.openBuffer(buffer));
+  }
+
+  return err;
+}
+
+err_t ImageDecoder::feedEnd()
+{
+  if (!_feedMode)
+    return ERR_RT_INVALID_STATE;
+
+  if (_readerDone)
+    return _readerResult;
+
+  err_t err = _feed(true);
+  if (err == ERR_IMAGE_NEED_MORE_DATA)
+    err = ERR_IMAGE_TRUNCATED;
+
+  _readerDone = true;
+  _readerResult = err;
+  return err;
+}
+
+err_t ImageDecoder::_feed(bool end)
+{
+  if (!end)
+    return ERR_IMAGE_NEED_MORE_DATA;
+
+  // All data are available, decode them the blocking way.
+  err_t err = readImage(_feedImage);
+  if (err == ERR_OK)
+    _feedRows(0, _feedImage.getHeight());
+  return err;
+}
+
+size_t ImageDecoder::_getFeedAvailable() const
+{
+  int64_t size;
+  if (const_cast<Stream&>(_stream).getSize(&size) != ERR_OK)
+    return 0;
+
+  return (size_t)(size - _stream.tell());
+}
+
+void ImageDecoder::_feedRect(const RectI& rect)
+{
+  if (_feedFunc != NULL && rect.isValid())
+    _feedFunc(this, &rect, _feedData);
 }
 
 } // Fog namespace
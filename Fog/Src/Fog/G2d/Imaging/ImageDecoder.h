@@ -9,6 +9,8 @@
 
 // [Dependencies]
 #include <Fog/Core/Global/Global.h>
+#include <Fog/G2d/Geometry/Rect.h>
+#include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageCodec.h>
 
 namespace Fog {
@@ -16,11 +18,46 @@ namespace Fog {
 //! @addtogroup Fog_G2d_Imaging
 //! @{
 
+// ============================================================================
+// [Fog::ImageFrameInfo]
+// ============================================================================
+
+//! @brief Information about a frame of an animated image.
+struct ImageFrameInfo
+{
+  FOG_INLINE void reset()
+  {
+    rect.reset();
+    delay = 0;
+    disposal = IMAGE_DISPOSAL_NONE;
+  }
+
+  //! @brief Frame rectangle, relative to the canvas.
+  RectI rect;
+  //! @brief Frame delay in milliseconds.
+  uint32_t delay;
+  //! @brief Frame disposal (see @c IMAGE_DISPOSAL).
+  uint32_t disposal;
+};
+
 // ============================================================================
 // [Fog::ImageDecoder]
 // ============================================================================
 
 //! @brief Image decoder.
+//!
+//! The decoder can be used in two ways:
+//!
+//!   - Blocking, using @c readHeader() and @c readImage() to read the image
+//!     from the attached stream.
+//!
+//!   - Push-style, using @c feed() to pass the data as they arrive (for
+//!     example from a socket). The decoded image is available through
+//!     @c getFeedImage() as soon as the header is known, and the handler set
+//!     by @c setFeedHandler() is called each time some rows were decoded.
+//!
+//! Animations are read frame by frame using @c readFrame(), which composites
+//! the next frame into the canvas returned by @c getFrameCanvas().
 struct FOG_API ImageDecoder : public ImageCodec
 {
   FOG_DECLARE_OBJECT(ImageDecoder, ImageCodec)
@@ -41,6 +78,8 @@ struct FOG_API ImageDecoder : public ImageCodec
   FOG_INLINE uint32_t getHeaderResult() const { return _headerResult; }
   FOG_INLINE uint32_t getReaderResult() const { return _readerResult; }
 
+  FOG_INLINE bool isFeedMode() const { return _feedMode; }
+
   // --------------------------------------------------------------------------
   // [Virtuals]
   // --------------------------------------------------------------------------
@@ -48,6 +87,61 @@ struct FOG_API ImageDecoder : public ImageCodec
   virtual err_t readHeader() = 0;
   virtual err_t readImage(Image& image) = 0;
 
+  // --------------------------------------------------------------------------
+  // [Frames]
+  // --------------------------------------------------------------------------
+
+  //! @brief Read the count of frames, scanning the stream if needed.
+  virtual err_t readFramesCount(uint32_t* count);
+
+  //! @brief Read information about the frame @a index.
+  virtual err_t readFrameInfo(uint32_t index, ImageFrameInfo& info);
+
+  //! @brief Seek to the frame @a index, which is composited by the next
+  //! @c readFrame() call.
+  virtual err_t seekFrame(uint32_t index);
+
+  //! @brief Composite the next frame into the frame canvas.
+  //!
+  //! The canvas is a @c IMAGE_FORMAT_PRGB32 image of the animation size,
+  //! which is reused by all frames. Only the area stored to @a dirty (if not
+  //! @c NULL) is changed by the call.
+  virtual err_t readFrame(RectI* dirty);
+
+  //! @brief Get the canvas containing the frame read by @c readFrame().
+  FOG_INLINE const Image& getFrameCanvas() const { return _frameCanvas; }
+
+  // --------------------------------------------------------------------------
+  // [Feed]
+  // --------------------------------------------------------------------------
+
+  //! @brief Push @a size bytes of the image data to the decoder.
+  //!
+  //! Returns @c ERR_OK if the image is complete, @c ERR_IMAGE_NEED_MORE_DATA
+  //! if more data is needed, or an error code. The stream must not be
+  //! attached when the decoder is used this way.
+  err_t feed(const void* data, size_t size);
+
+  //! @brief Tell the decoder that no more data will be pushed by @c feed().
+  //!
+  //! Returns @c ERR_OK if the image is complete, otherwise an error code
+  //! (@c ERR_IMAGE_TRUNCATED if the data ended too early).
+  err_t feedEnd();
+
+  //! @brief Get the image decoded by @c feed().
+  //!
+  //! The image is created once the header is decoded, the rows which weren't
+  //! decoded yet are undefined.
+  FOG_INLINE const Image& getFeedImage() const { return _feedImage; }
+
+  //! @brief Set the function called by @c feed() when a rectangle of the
+  //! feed image was decoded.
+  FOG_INLINE void setFeedHandler(ImageDecoderFeedFunc func, void* data)
+  {
+    _feedFunc = func;
+    _feedData = data;
+  }
+
   // --------------------------------------------------------------------------
   // [Internal]
   // --------------------------------------------------------------------------
@@ -55,6 +149,33 @@ struct FOG_API ImageDecoder : public ImageCodec
 protected:
   virtual void reset();
 
+  //! @brief Decode the data pushed by @c feed(), @a end is @c true if no more
+  //! data will come.
+  //!
+  //! The data are stored in the memory stream (@c _stream), which is positioned
+  //! at the first byte not consumed yet. The bytes before the position are
+  //! released after each call and the stream is rebased to zero, so the
+  //! decoder can't seek back to them (unless @c _feedKeepAll is set).
+  //!
+  //! The default implementation waits for all data and then calls
+  //! @c readImage(), the position stays at the beginning so the whole input is
+  //! buffered. This is used by decoders without incremental decoding (BMP
+  //! embedded in ICO and PNG without the progressive reader). The ICO decoder
+  //! sets @c _feedKeepAll, because the entries are addressed by offsets from
+  //! the beginning of the file.
+  virtual err_t _feed(bool end);
+
+  //! @brief Get the count of bytes available in the stream in feed mode.
+  size_t _getFeedAvailable() const;
+
+  //! @brief Called by the decoder when a rectangle of the feed image was
+  //! decoded.
+  void _feedRect(const RectI& rect);
+
+  //! @brief Called by the decoder when rows @a y to @a y + @a h of the feed
+  //! image were decoded.
+  FOG_INLINE void _feedRows(int y, int h) { _feedRect(RectI(0, y, _feedImage.getWidth(), h)); }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -64,10 +185,24 @@ protected:
   uint32_t _headerDone : 1;
   //! @brief @c true if image was read.
   uint32_t _readerDone : 1;
+  //! @brief @c true if the decoder is used through @c feed().
+  uint32_t _feedMode : 1;
+  //! @brief @c true if the data consumed by @c _feed() can't be released.
+  uint32_t _feedKeepAll : 1;
   //! @brief Header decoder result code (returned by @c readHeader()).
   uint32_t _headerResult;
   //! @brief Image decoder result code (returned by @c readImage()).
   uint32_t _readerResult;
+
+  //! @brief Image decoded by @c feed().
+  Image _feedImage;
+  //! @brief Feed handler.
+  ImageDecoderFeedFunc _feedFunc;
+  //! @brief Feed handler data.
+  void* _feedData;
+
+  //! @brief Canvas of composited frames (see @c readFrame()).
+  Image _frameCanvas;
 };
 
 //! @}
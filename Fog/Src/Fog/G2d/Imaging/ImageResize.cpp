@@ -16,12 +16,14 @@
 #include <Fog/Core/Math/Math.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
+#include <Fog/Core/Threading/ThreadPool.h>
 #include <Fog/Core/Tools/Cpu.h>
 #include <Fog/Core/Tools/Hash.h>
 #include <Fog/Core/Tools/String.h>
 #include <Fog/Core/Tools/Var.h>
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageResize_p.h>
+#include <Fog/G2d/Imaging/ImageResizer.h>
 
 namespace Fog {
 
@@ -436,107 +438,61 @@ struct FOG_NO_EXPORT ImageResize_BlackmanFunction : public MathFunctionF
 };
 
 // ============================================================================
-// [Fog::ImageResize - Context - Init / Destroy]
+// [Fog::ImageResize - Weights - Init / Destroy]
 // ============================================================================
 
-static err_t FOG_CDECL ImageResizeContext_init(ImageResizeContext* ctx,
-  uint8_t* dData, size_t dStride, int dw, int dh,
-  uint8_t* sData, size_t sStride, int sw, int sh,
-  uint32_t format,
-  const MathFunctionF* func, float radius)
+static err_t FOG_CDECL ImageResizeWeights_init(ImageResizeWeights* weights,
+  int sSize, int dSize, uint32_t precision, const MathFunctionF* func, float radius)
 {
-  uint32_t tmpBpp = ImageFormatDescription::getByFormat(format).getBytesPerPixel();
+  weights->sSize = sSize;
+  weights->dSize = dSize;
+  weights->precision = precision;
 
-  if (format == IMAGE_FORMAT_I8)
-    tmpBpp = 4;
-
-  ctx->dData = dData;
-  ctx->sData = sData;
-
-  ctx->dStride = dStride;
-  ctx->sStride = sStride;
-  ctx->tStride = (size_t)(dw * tmpBpp + 15) & ~(size_t)15;
-
-  ctx->dSize[0] = (uint)dw;
-  ctx->dSize[1] = (uint)dh;
-
-  ctx->sSize[0] = (uint)sw;
-  ctx->sSize[1] = (uint)sh;
-
-  ctx->scale[0] = float(dw) / float(sw);
-  ctx->scale[1] = float(dh) / float(sh);
-
-  ctx->factor[0] = 1.0f;
-  ctx->factor[1] = 1.0f;
-
-  ctx->radius[0] = radius;
-  ctx->radius[1] = radius;
-
-  if (ctx->scale[0] < 1.0f) { ctx->factor[0] = ctx->scale[0]; ctx->radius[0] = radius / ctx->scale[0]; }
-  if (ctx->scale[1] < 1.0f) { ctx->factor[1] = ctx->scale[1]; ctx->radius[1] = radius / ctx->scale[1]; }
-
-  ctx->kernelSize[0] = (int)(1.0f + 2.0f * ctx->radius[0]);
-  ctx->kernelSize[1] = (int)(1.0f + 2.0f * ctx->radius[1]);
-
-  ctx->isBound[0] = false;
-  ctx->isBound[1] = false;
-
-  ctx->func = func;
+  weights->scale = float(dSize) / float(sSize);
+  weights->factor = 1.0f;
+  weights->radius = radius;
 
+  if (weights->scale < 1.0f)
   {
-    size_t hWeightSize = dw * ctx->kernelSize[0] * sizeof(int32_t);
-    size_t vWeightSize = dh * ctx->kernelSize[1] * sizeof(int32_t);
-
-    size_t hRecordSize = dw * sizeof(ImageResizeRecord);
-    size_t vRecordSize = dh * sizeof(ImageResizeRecord);
-
-    // Allocate the maximum possible space needed.
-    ctx->weightList = reinterpret_cast<int32_t          *>(MemMgr::alloc(Math::max(hWeightSize, vWeightSize)));
-    ctx->recordList = reinterpret_cast<ImageResizeRecord*>(MemMgr::alloc(Math::max(hRecordSize, vRecordSize)));
-    ctx->tData      = reinterpret_cast<uint8_t          *>(MemMgr::alloc(sh * ctx->tStride));
-
-    if (ctx->weightList == NULL || ctx->recordList == NULL || ctx->tData == NULL)
-    {
-      ImageResize_api.destroy(ctx);
-      return ERR_RT_OUT_OF_MEMORY;
-    }
+    weights->factor = weights->scale;
+    weights->radius = radius / weights->scale;
   }
 
-  return ERR_OK;
-}
+  weights->kernelSize = (int)(1.0f + 2.0f * weights->radius);
+  weights->isBound = false;
+  weights->stamp = 0;
 
-static void FOG_CDECL ImageResizeContext_destroy(ImageResizeContext* ctx)
-{
-  if (ctx->tData     ) MemMgr::free(ctx->tData     );
-  if (ctx->recordList) MemMgr::free(ctx->recordList);
-  if (ctx->weightList) MemMgr::free(ctx->weightList);
-}
+  weights->weightList = reinterpret_cast<int32_t          *>(MemMgr::alloc((size_t)dSize * weights->kernelSize * sizeof(int32_t)));
+  weights->recordList = reinterpret_cast<ImageResizeRecord*>(MemMgr::alloc((size_t)dSize * sizeof(ImageResizeRecord)));
 
-// ============================================================================
-// [Fog::ImageResize - Context - Calc Weights]
-// ============================================================================
+  if (weights->weightList == NULL || weights->recordList == NULL)
+  {
+    ImageResize_api.destroyWeights(weights);
+    return ERR_RT_OUT_OF_MEMORY;
+  }
 
-static void FOG_CDECL ImageResizeContext_doWeights(ImageResizeContext* ctx, uint dir)
-{
-  int32_t* weightList = ctx->weightList;
-  ImageResizeRecord* recordList = ctx->recordList;
+  int32_t* weightList = weights->weightList;
+  ImageResizeRecord* recordList = weights->recordList;
 
-  uint dSize = ctx->dSize[dir];
-  uint sSizeM1 = ctx->sSize[dir] - 1;
+  uint sSizeM1 = (uint)sSize - 1;
   uint isSubtracted = 0;
 
-  float radius = ctx->radius[dir];
-  float radius2 = radius * 2;
+  float radius2 = weights->radius * 2;
+  float factor = weights->factor;
 
-  float factor = ctx->factor[dir];
-  const MathFunctionF* func = ctx->func;
+  // Weights are in 8.8 fixed point for 8-bit formats and in 16.16 fixed point
+  // for 16-bit formats.
+  int32_t wOne = (precision == IMAGE_PRECISION_WORD) ? 0x10000 : 0x100;
+  uint wShift = (precision == IMAGE_PRECISION_WORD) ? 0 : 8;
 
-  for (uint i = 0; i < dSize; i++)
+  radius = weights->radius;
+
+  for (uint i = 0; i < (uint)dSize; i++)
   {
     float* wData = reinterpret_cast<float*>(weightList);
     float wSum = 0.0f;
 
-    float center = ((float)(int)i + 0.5f) / ctx->scale[dir] - 0.5f;
+    float center = ((float)(int)i + 0.5f) / weights->scale - 0.5f;
     int left = (int)(center - radius);
     int right = (int)(left + radius2) + 1;
 
@@ -610,7 +566,7 @@ static void FOG_CDECL ImageResizeContext_doWeights(ImageResizeContext* ctx, uint
 
       for (k = 0; k < wCount; k++)
       {
-        int32_t w = (int32_t)(wData[k] * 65536.0f / wSum) >> 8;
+        int32_t w = (int32_t)(wData[k] * 65536.0f / wSum) >> wShift;
         weightList[k] = w;
         iSum += w;
 
@@ -623,9 +579,9 @@ static void FOG_CDECL ImageResizeContext_doWeights(ImageResizeContext* ctx, uint
 
       // Normalize weights, adding/subtracting the normalization value into
       // the strongest one.
-      if (iSum != 0x100)
+      if (iSum != wOne)
       {
-        weightList[kMax] += (int32_t)0x100 - iSum;
+        weightList[kMax] += wOne - iSum;
       }
 
       // Remove all zero weights from the end of the weight array.
@@ -664,10 +620,20 @@ static void FOG_CDECL ImageResizeContext_doWeights(ImageResizeContext* ctx, uint
       recordList[i].count = 0;
     }
 
-    weightList += ctx->kernelSize[dir];
+    weightList += weights->kernelSize;
   }
 
-  ctx->isBound[dir] = !isSubtracted;
+  weights->isBound = !isSubtracted;
+  return ERR_OK;
+}
+
+static void FOG_CDECL ImageResizeWeights_destroy(ImageResizeWeights* weights)
+{
+  if (weights->recordList) MemMgr::free(weights->recordList);
+  if (weights->weightList) MemMgr::free(weights->weightList);
+
+  weights->recordList = NULL;
+  weights->weightList = NULL;
 }
 
 // ============================================================================
@@ -691,8 +657,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB32(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -732,8 +698,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB32(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -800,8 +766,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_XRGB32(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -841,8 +807,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_XRGB32(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -906,8 +872,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_RGB24(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -950,8 +916,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_RGB24(ImageResizeContext*
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -1013,8 +979,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_A8(ImageResizeContext* ctx
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -1052,8 +1018,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_A8(ImageResizeContext* ctx
   {
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -1095,7 +1061,7 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_A8(ImageResizeContext* ctx
 
 static void FOG_CDECL ImageResizeContext_doVertical_PRGB32(ImageResizeContext* ctx)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0];
   uint dh = ctx->dSize[1];
@@ -1105,8 +1071,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_PRGB32(ImageResizeContext* c
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1204,7 +1170,7 @@ static void FOG_CDECL ImageResizeContext_doVertical_PRGB32(ImageResizeContext* c
 
 static void FOG_CDECL ImageResizeContext_doVertical_XRGB32(ImageResizeContext* ctx)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0];
   uint dh = ctx->dSize[1];
@@ -1214,8 +1180,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_XRGB32(ImageResizeContext* c
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1310,7 +1276,7 @@ static void FOG_CDECL ImageResizeContext_doVertical_XRGB32(ImageResizeContext* c
 
 static void FOG_CDECL ImageResizeContext_doVertical_Bytes(ImageResizeContext* ctx, uint wScale)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0] * wScale;
   uint dh = ctx->dSize[1];
@@ -1320,8 +1286,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_Bytes(ImageResizeContext* ct
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1508,139 +1474,803 @@ static void FOG_CDECL ImageResizeContext_doVertical_A8(ImageResizeContext* ctx)
 }
 
 // ============================================================================
-// [Fog::ImageResize - Resize]
+// [Fog::ImageResize - Context - DoHorizontal - PRGB64, RGB48, A16]
 // ============================================================================
 
-static err_t FOG_CDECL ImageResize_resize(Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment, uint32_t resizeFunc, const Hash<StringW, Var>* params)
+//! @internal
+//!
+//! @brief Horizontal pass of 16-bit formats (@a wScale words per pixel).
+//!
+//! Weights are in 16.16 fixed point. If all weights are positive the sum of
+//! 16-bit values multiplied by weights can't exceed 32 bits, otherwise 64-bit
+//! accumulators are used and the result is saturated. If @a aIndex is less
+//! than @a wScale then the pixel is premultiplied and the color components
+//! are also saturated to alpha (at @a aIndex).
+static FOG_INLINE void ImageResizeContext_doHorizontal_Words(ImageResizeContext* ctx, uint wScale, uint aIndex)
 {
-  switch (resizeFunc)
+  uint kernelSize = ctx->kernelSize[0];
+
+  uint dw = ctx->dSize[0];
+  uint sh = ctx->sSize[1];
+
+  uint8_t* sData = ctx->sData;
+  uint8_t* tData = ctx->tData;
+
+  ssize_t sStride = ctx->sStride;
+  ssize_t tStride = ctx->tStride;
+
+  if (ctx->isBound[0] == 1)
   {
-    case IMAGE_RESIZE_NEAREST:
+    for (uint y = 0; y < sh; y++)
     {
-      ImageResize_NearestFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 1.0f);
-    }
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
-    case IMAGE_RESIZE_BILINEAR:
+      uint16_t* tp = reinterpret_cast<uint16_t*>(tData);
+
+      for (uint x = 0; x < dw; x++)
+      {
+        const uint16_t* sp = reinterpret_cast<const uint16_t*>(sData) + recordList->pos * wScale;
+        const int32_t* wp = weightList;
+
+        uint32_t c[4] = { 0x8000, 0x8000, 0x8000, 0x8000 };
+
+        for (uint j = recordList->count; j; j--)
+        {
+          uint32_t w0 = (uint32_t)wp[0];
+
+          for (uint k = 0; k < wScale; k++)
+            c[k] += (uint32_t)sp[k] * w0;
+
+          sp += wScale;
+          wp += 1;
+        }
+
+        for (uint k = 0; k < wScale; k++)
+          tp[k] = (uint16_t)(c[k] >> 16);
+
+        recordList += 1;
+        weightList += kernelSize;
+
+        tp += wScale;
+      }
+
+      sData += sStride;
+      tData += tStride;
+    }
+  }
+  else
+  {
+    for (uint y = 0; y < sh; y++)
     {
-      ImageResize_BilinearFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 1.0f);
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
+
+      uint16_t* tp = reinterpret_cast<uint16_t*>(tData);
+
+      for (uint x = 0; x < dw; x++)
+      {
+        const uint16_t* sp = reinterpret_cast<const uint16_t*>(sData) + recordList->pos * wScale;
+        const int32_t* wp = weightList;
+
+        int64_t c[4] = { 0x8000, 0x8000, 0x8000, 0x8000 };
+
+        for (uint j = recordList->count; j; j--)
+        {
+          int64_t w0 = wp[0];
+
+          for (uint k = 0; k < wScale; k++)
+            c[k] += (int64_t)sp[k] * w0;
+
+          sp += wScale;
+          wp += 1;
+        }
+
+        int32_t cMax = 0xFFFF;
+        if (aIndex < wScale)
+        {
+          cMax = (int32_t)Math::bound<int64_t>(c[aIndex] >> 16, 0, 0xFFFF);
+          tp[aIndex] = (uint16_t)cMax;
+        }
+
+        for (uint k = 0; k < wScale; k++)
+        {
+          if (k != aIndex)
+            tp[k] = (uint16_t)Math::bound<int64_t>(c[k] >> 16, 0, cMax);
+        }
+
+        recordList += 1;
+        weightList += kernelSize;
+
+        tp += wScale;
+      }
+
+      sData += sStride;
+      tData += tStride;
     }
+  }
+}
 
-    case IMAGE_RESIZE_BICUBIC:
+static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB64(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doHorizontal_Words(ctx, 4, PIXEL_ARGB64_WORD_A);
+}
+
+static void FOG_CDECL ImageResizeContext_doHorizontal_RGB48(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doHorizontal_Words(ctx, 3, 3);
+}
+
+static void FOG_CDECL ImageResizeContext_doHorizontal_A16(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doHorizontal_Words(ctx, 1, 1);
+}
+
+// ============================================================================
+// [Fog::ImageResize - Context - DoVertical - PRGB64, RGB48, A16]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Vertical pass of 16-bit formats, see
+//! @c ImageResizeContext_doHorizontal_Words().
+static FOG_INLINE void ImageResizeContext_doVertical_Words(ImageResizeContext* ctx, uint wScale, uint aIndex)
+{
+  uint kernelSize = ctx->kernelSize[1];
+
+  uint dw = ctx->dSize[0];
+  uint dh = ctx->dSize[1];
+
+  uint8_t* dData = ctx->dData;
+
+  ssize_t dStride = ctx->dStride;
+  ssize_t tStride = ctx->tStride;
+
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
+
+  if (ctx->isBound[1] == 1)
+  {
+    for (uint y = 0; y < dh; y++)
     {
-      ImageResize_BicubicFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 2.0f);
-    }
+      uint8_t* tData = ctx->tData + (ssize_t)recordList->pos * tStride;
+      uint16_t* dp = reinterpret_cast<uint16_t*>(dData);
+      uint count = recordList->count;
 
-    case IMAGE_RESIZE_BELL:
+      for (uint x = 0; x < dw; x++)
+      {
+        const uint8_t* tp = tData;
+        const int32_t* wp = weightList;
+
+        uint32_t c[4] = { 0x8000, 0x8000, 0x8000, 0x8000 };
+
+        for (uint j = count; j; j--)
+        {
+          uint32_t w0 = (uint32_t)wp[0];
+
+          for (uint k = 0; k < wScale; k++)
+            c[k] += (uint32_t)reinterpret_cast<const uint16_t*>(tp)[k] * w0;
+
+          tp += tStride;
+          wp += 1;
+        }
+
+        for (uint k = 0; k < wScale; k++)
+          dp[k] = (uint16_t)(c[k] >> 16);
+
+        dp += wScale;
+        tData += wScale * 2;
+      }
+
+      recordList += 1;
+      weightList += kernelSize;
+
+      dData += dStride;
+    }
+  }
+  else
+  {
+    for (uint y = 0; y < dh; y++)
     {
-      ImageResize_BellFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 1.5f);
+      uint8_t* tData = ctx->tData + (ssize_t)recordList->pos * tStride;
+      uint16_t* dp = reinterpret_cast<uint16_t*>(dData);
+      uint count = recordList->count;
+
+      for (uint x = 0; x < dw; x++)
+      {
+        const uint8_t* tp = tData;
+        const int32_t* wp = weightList;
+
+        int64_t c[4] = { 0x8000, 0x8000, 0x8000, 0x8000 };
+
+        for (uint j = count; j; j--)
+        {
+          int64_t w0 = wp[0];
+
+          for (uint k = 0; k < wScale; k++)
+            c[k] += (int64_t)reinterpret_cast<const uint16_t*>(tp)[k] * w0;
+
+          tp += tStride;
+          wp += 1;
+        }
+
+        int32_t cMax = 0xFFFF;
+        if (aIndex < wScale)
+        {
+          cMax = (int32_t)Math::bound<int64_t>(c[aIndex] >> 16, 0, 0xFFFF);
+          dp[aIndex] = (uint16_t)cMax;
+        }
+
+        for (uint k = 0; k < wScale; k++)
+        {
+          if (k != aIndex)
+            dp[k] = (uint16_t)Math::bound<int64_t>(c[k] >> 16, 0, cMax);
+        }
+
+        dp += wScale;
+        tData += wScale * 2;
+      }
+
+      recordList += 1;
+      weightList += kernelSize;
+
+      dData += dStride;
     }
+  }
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_PRGB64(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words(ctx, 4, PIXEL_ARGB64_WORD_A);
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_RGB48(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words(ctx, 3, 3);
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_A16(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words(ctx, 1, 1);
+}
+
+// ============================================================================
+// [Fog::ImageResize - Function - Create]
+// ============================================================================
+
+static err_t ImageResize_createFunc(MathFunctionF** dst, float* radius, uint32_t resizeFunc, const Hash<StringW, Var>* params)
+{
+  MathFunctionF* f = NULL;
+  float r = 1.0f;
+
+  switch (resizeFunc)
+  {
+    case IMAGE_RESIZE_NEAREST:
+      f = fog_new ImageResize_NearestFunction();
+      break;
+
+    case IMAGE_RESIZE_BILINEAR:
+      f = fog_new ImageResize_BilinearFunction();
+      break;
+
+    case IMAGE_RESIZE_BICUBIC:
+      f = fog_new ImageResize_BicubicFunction();
+      r = 2.0f;
+      break;
+
+    case IMAGE_RESIZE_BELL:
+      f = fog_new ImageResize_BellFunction();
+      r = 1.5f;
+      break;
 
     case IMAGE_RESIZE_GAUSS:
-    {
-      ImageResize_GaussFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 2.0f);
-    }
+      f = fog_new ImageResize_GaussFunction();
+      r = 2.0f;
+      break;
 
     case IMAGE_RESIZE_HERMITE:
-    {
-      ImageResize_HermiteFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 1.0f);
-    }
+      f = fog_new ImageResize_HermiteFunction();
+      break;
 
     case IMAGE_RESIZE_HANNING:
-    {
-      ImageResize_HanningFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 1.0f);
-    }
+      f = fog_new ImageResize_HanningFunction();
+      break;
 
     case IMAGE_RESIZE_CATROM:
-    {
-      ImageResize_CatromFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 2.0f);
-    }
+      f = fog_new ImageResize_CatromFunction();
+      r = 2.0f;
+      break;
 
     case IMAGE_RESIZE_MITCHELL:
     {
-      ImageResize_MitchellFunction f;
+      float b = float(MATH_1_DIV_3);
+      float c = float(MATH_1_DIV_3);
 
       if (params)
       {
-        const Var* b = params->getPtr(Ascii8("b"));
-        const Var* c = params->getPtr(Ascii8("c"));
+        const Var* bVar = params->getPtr(Ascii8("b"));
+        const Var* cVar = params->getPtr(Ascii8("c"));
 
-        if (b != NULL)
-          FOG_RETURN_ON_ERROR(b->getFloat(f.b));
+        if (bVar != NULL)
+          FOG_RETURN_ON_ERROR(bVar->getFloat(b));
 
-        if (c != NULL)
-          FOG_RETURN_ON_ERROR(b->getFloat(f.c));
+        if (cVar != NULL)
+          FOG_RETURN_ON_ERROR(cVar->getFloat(c));
+      }
 
-        if (b != NULL || c != NULL)
-          f.init();
+      ImageResize_MitchellFunction* mf = fog_new ImageResize_MitchellFunction();
+      if (mf != NULL)
+      {
+        mf->b = b;
+        mf->c = c;
+        mf->init();
       }
 
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 2.0f);
+      f = mf;
+      r = 2.0f;
+      break;
     }
 
     case IMAGE_RESIZE_BESSEL:
-    {
-      ImageResize_BesselFunction f;
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, 3.2383f);
-    }
+      f = fog_new ImageResize_BesselFunction();
+      r = 3.2383f;
+      break;
 
     case IMAGE_RESIZE_SINC:
+    case IMAGE_RESIZE_LANCZOS:
+    case IMAGE_RESIZE_BLACKMAN:
     {
-      ImageResize_SincFunction f;
+      r = 2.0f;
 
       if (params)
       {
-        const Var* r = params->getPtr(Ascii8("radius"));
-        if (r != NULL)
-          FOG_RETURN_ON_ERROR(r->getFloat(f.radius, 1.0f, 16.0f));
+        const Var* rVar = params->getPtr(Ascii8("radius"));
+        if (rVar != NULL)
+          FOG_RETURN_ON_ERROR(rVar->getFloat(r, 1.0f, 16.0f));
       }
 
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, f.radius);
+      if (resizeFunc == IMAGE_RESIZE_SINC)
+      {
+        ImageResize_SincFunction* sf = fog_new ImageResize_SincFunction();
+        if (sf != NULL)
+          sf->radius = r;
+        f = sf;
+      }
+      else if (resizeFunc == IMAGE_RESIZE_LANCZOS)
+      {
+        ImageResize_LanczosFunction* lf = fog_new ImageResize_LanczosFunction();
+        if (lf != NULL)
+          lf->radius = r;
+        f = lf;
+      }
+      else
+      {
+        ImageResize_BlackmanFunction* bf = fog_new ImageResize_BlackmanFunction();
+        if (bf != NULL)
+          bf->radius = r;
+        f = bf;
+      }
+      break;
     }
 
-    case IMAGE_RESIZE_LANCZOS:
+    default:
+      return ERR_RT_INVALID_ARGUMENT;
+  }
+
+  if (FOG_IS_NULL(f))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  *dst = f;
+  *radius = r;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ImageResize - Band]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get source rows [sy0, sy1) used by destination rows [y0, y1).
+static void ImageResize_getSourceSpan(const ImageResizeContext* ctx, int y0, int y1, int& sy0, int& sy1)
+{
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+
+  int spanY0 = ctx->sSize[1];
+  int spanY1 = 0;
+
+  for (int y = y0; y < y1; y++)
+  {
+    if (recordList[y].count == 0)
+      continue;
+
+    spanY0 = Math::min<int>(spanY0, int(recordList[y].pos));
+    spanY1 = Math::max<int>(spanY1, int(recordList[y].pos + recordList[y].count));
+  }
+
+  if (spanY0 >= spanY1)
+    spanY0 = spanY1 = 0;
+
+  sy0 = spanY0;
+  sy1 = spanY1;
+}
+
+//! @internal
+//!
+//! @brief Horizontal pass of source rows [sy0, sy1) into @a tData.
+static FOG_INLINE void ImageResize_doHorizontalBand(const ImageResizeContext* ctx, uint32_t format,
+  int sy0, int sy1, uint8_t* tData)
+{
+  ImageResizeContext band = *ctx;
+
+  band.sData += (ssize_t)sy0 * ctx->sStride;
+  band.tData = tData;
+  band.sSize[1] = sy1 - sy0;
+
+  ImageResize_api.doHorizontal[format](&band);
+}
+
+//! @internal
+//!
+//! @brief Vertical pass of destination rows [y0, y1), @a tData is the row of
+//! the first source row (it doesn't have to be allocated).
+static FOG_INLINE void ImageResize_doVerticalBand(const ImageResizeContext* ctx, uint32_t format,
+  int y0, int y1, uint8_t* tData)
+{
+  ImageResizeContext band = *ctx;
+
+  band.dData += (ssize_t)y0 * ctx->dStride;
+  band.tData = tData;
+  band.dSize[1] = y1 - y0;
+
+  band.recordList[1] += y0;
+  band.weightList[1] += (size_t)y0 * ctx->kernelSize[1];
+
+  ImageResize_api.doVertical[format](&band);
+}
+
+// ============================================================================
+// [Fog::ImageResizeWorkMgr - Construction / Destruction]
+// ============================================================================
+
+ImageResizeWorkMgr::ImageResizeWorkMgr(const ImageResizeContext& ctx, uint32_t format, Thread** threads, uint numWorkers) :
+  ctx(ctx),
+  format(format),
+  pass(IMAGE_RESIZE_PASS_HORIZONTAL),
+  numWorkers(numWorkers),
+  stripHeight(0),
+  stripsPerWorker(0),
+  buffer(NULL),
+  bufferSize(0),
+  threads(threads)
+{
+  FOG_ASSERT(numWorkers >= 1);
+}
+
+ImageResizeWorkMgr::~ImageResizeWorkMgr()
+{
+  if (buffer != NULL)
+    MemMgr::free(buffer);
+}
+
+// ============================================================================
+// [Fog::ImageResizeWorkMgr - Process]
+// ============================================================================
+
+err_t ImageResizeWorkMgr::process(uint32_t mode)
+{
+  int dh = ctx.dSize[1];
+  int sh = ctx.sSize[1];
+
+  if (mode == IMAGE_RESIZE_MODE_TWO_PASS)
+  {
+    bufferSize = (size_t)sh * (size_t)ctx.tStride;
+    buffer = reinterpret_cast<uint8_t*>(MemMgr::alloc(bufferSize));
+
+    if (FOG_IS_NULL(buffer))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    ctx.tData = buffer;
+
+    dispatch(IMAGE_RESIZE_PASS_HORIZONTAL);
+    dispatch(IMAGE_RESIZE_PASS_VERTICAL);
+    return ERR_OK;
+  }
+  else
+  {
+    // Calculate the strip height so the part of the temporary image used by
+    // one strip (including rows shared with neighbours) fits into the cache.
+    int kernelSize = int(ctx.kernelSize[1]);
+    int budgetRows = Math::max<int>(int(IMAGE_RESIZE_STRIP_SIZE / (size_t)ctx.tStride), kernelSize * 2);
+
+    stripHeight = int(float(budgetRows - kernelSize) * (float(dh) / float(sh)));
+    stripHeight = Math::bound<int>(stripHeight, 1, dh);
+
+    int numStrips = (dh + stripHeight - 1) / stripHeight;
+    if (numWorkers > uint(numStrips))
+      numWorkers = uint(numStrips);
+    stripsPerWorker = (numStrips + int(numWorkers) - 1) / int(numWorkers);
+
+    int maxSpan = 1;
+    for (int y0 = 0; y0 < dh; y0 += stripHeight)
     {
-      ImageResize_LanczosFunction f;
+      int sy0, sy1;
+      ImageResize_getSourceSpan(&ctx, y0, Math::min<int>(y0 + stripHeight, dh), sy0, sy1);
+      maxSpan = Math::max<int>(maxSpan, sy1 - sy0);
+    }
 
-      if (params)
-      {
-        const Var* r = params->getPtr(Ascii8("radius"));
-        if (r != NULL)
-          FOG_RETURN_ON_ERROR(r->getFloat(f.radius, 1.0f, 16.0f));
-      }
+    bufferSize = (size_t)maxSpan * (size_t)ctx.tStride;
+    buffer = reinterpret_cast<uint8_t*>(MemMgr::alloc(bufferSize * numWorkers));
+
+    if (FOG_IS_NULL(buffer))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    dispatch(IMAGE_RESIZE_PASS_STRIPS);
+    return ERR_OK;
+  }
+}
+
+// ============================================================================
+// [Fog::ImageResizeWorkMgr - Dispatch]
+// ============================================================================
+
+static void FOG_CDECL ImageResizeWorkMgr_runWorker(void* data, uint id)
+{
+  static_cast<ImageResizeWorkMgr*>(data)->runWorker(id);
+}
+
+void ImageResizeWorkMgr::dispatch(uint32_t pass)
+{
+  this->pass = pass;
+  dispatcher.run(threads, numWorkers, ImageResizeWorkMgr_runWorker, this);
+}
 
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, f.radius);
+// ============================================================================
+// [Fog::ImageResizeWorkMgr - Run]
+// ============================================================================
+
+void ImageResizeWorkMgr::runWorker(uint id)
+{
+  int y0, y1;
+
+  switch (pass)
+  {
+    case IMAGE_RESIZE_PASS_HORIZONTAL:
+    {
+      BandDispatcher::getBand(ctx.sSize[1], numWorkers, id, y0, y1);
+      if (y0 < y1)
+        ImageResize_doHorizontalBand(&ctx, format, y0, y1, ctx.tData + (ssize_t)y0 * ctx.tStride);
+      break;
     }
 
-    case IMAGE_RESIZE_BLACKMAN:
+    case IMAGE_RESIZE_PASS_VERTICAL:
     {
-      ImageResize_BlackmanFunction f;
+      BandDispatcher::getBand(ctx.dSize[1], numWorkers, id, y0, y1);
+      if (y0 < y1)
+        ImageResize_doVerticalBand(&ctx, format, y0, y1, ctx.tData);
+      break;
+    }
 
-      if (params)
+    case IMAGE_RESIZE_PASS_STRIPS:
+    {
+      int dh = ctx.dSize[1];
+      uint8_t* tData = buffer + bufferSize * id;
+
+      y0 = Math::min<int>(int(id) * stripsPerWorker * stripHeight, dh);
+      y1 = Math::min<int>(y0 + stripsPerWorker * stripHeight, dh);
+
+      while (y0 < y1)
       {
-        const Var* r = params->getPtr(Ascii8("radius"));
-        if (r != NULL)
-          FOG_RETURN_ON_ERROR(r->getFloat(f.radius, 1.0f, 16.0f));
-      }
+        int yEnd = Math::min<int>(y0 + stripHeight, y1);
+        int sy0, sy1;
 
-      return fog_api.image_resizeCustom(dst, dSize, src, sFragment, &f, f.radius);
+        ImageResize_getSourceSpan(&ctx, y0, yEnd, sy0, sy1);
+        if (sy0 < sy1)
+          ImageResize_doHorizontalBand(&ctx, format, sy0, sy1, tData);
+
+        // The vertical pass addresses the temporary rows by the source row
+        // index, so the buffer is shifted to start at the row 'sy0'.
+        ImageResize_doVerticalBand(&ctx, format, y0, yEnd, tData - (ssize_t)sy0 * ctx.tStride);
+        y0 = yEnd;
+      }
+      break;
     }
 
     default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Helpers]
+// ============================================================================
+
+static ImageResizerData* ImageResizer_getData(ImageResizer* self)
+{
+  ImageResizerData* d = self->_d;
+
+  if (d == NULL)
+  {
+    d = reinterpret_cast<ImageResizerData*>(MemMgr::calloc(sizeof(ImageResizerData)));
+    self->_d = d;
+  }
+
+  return d;
+}
+
+static void ImageResizer_releaseFunc(ImageResizerData* d)
+{
+  if (d->ownsFunc && d->func != NULL)
+    fog_delete(d->func);
+
+  d->func = NULL;
+  d->ownsFunc = false;
+}
+
+static void ImageResizer_releaseThreads(ImageResizerData* d, uint32_t numThreads)
+{
+  if (d->numThreads <= numThreads)
+    return;
+
+  ThreadPool::get()->releaseThreads(d->threads + numThreads, d->numThreads - numThreads);
+  d->numThreads = numThreads;
+}
+
+//! @internal
+//!
+//! @brief Get the weights for given sizes, from cache or computed.
+static err_t ImageResizer_getWeights(ImageResizerData* d, int sSize, int dSize, uint32_t precision, const ImageResizeWeights** dst)
+{
+  uint32_t stamp = ++d->cacheStamp;
+  uint32_t i;
+
+  for (i = 0; i < d->cacheLength; i++)
+  {
+    ImageResizeWeights* weights = &d->cache[i];
+
+    if (weights->sSize == sSize && weights->dSize == dSize && weights->precision == precision)
     {
-      return ERR_RT_INVALID_ARGUMENT;
+      weights->stamp = stamp;
+      *dst = weights;
+      return ERR_OK;
     }
   }
+
+  // Not found, replace the least recently used weights if the cache is full.
+  // The weights are replaced in place, because the weights returned by the
+  // previous call (the other direction) are still in use.
+  ImageResizeWeights* weights;
+
+  if (d->cacheLength < IMAGE_RESIZE_CACHE_SIZE)
+  {
+    weights = &d->cache[d->cacheLength];
+  }
+  else
+  {
+    weights = &d->cache[0];
+    for (i = 1; i < IMAGE_RESIZE_CACHE_SIZE; i++)
+    {
+      if (d->cache[i].stamp < weights->stamp)
+        weights = &d->cache[i];
+    }
+
+    ImageResize_api.destroyWeights(weights);
+  }
+
+  err_t err = ImageResize_api.initWeights(weights, sSize, dSize, precision, d->func, d->radius);
+  if (FOG_IS_ERROR(err))
+  {
+    // Invalid size, never matched and always replaced first.
+    weights->sSize = 0;
+    weights->dSize = 0;
+    weights->stamp = 0;
+  }
+  else
+  {
+    weights->stamp = stamp;
+    *dst = weights;
+  }
+
+  if (weights == &d->cache[d->cacheLength])
+    d->cacheLength++;
+
+  return err;
 }
 
-static err_t FOG_CDECL ImageResize_resizeCustom(Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment, const MathFunctionF* resizeFunc, float radius)
+//! @internal
+//!
+//! @brief Get the number of workers (including the calling thread), acquiring
+//! pooled threads if needed.
+static uint ImageResizer_getWorkers(ImageResizer* self, ImageResizerData* d, const ImageResizeContext* ctx)
+{
+  uint maxThreads = self->_maxThreads;
+
+  if (maxThreads == 0)
+    maxThreads = Math::min<uint>(Cpu::get()->getNumberOfProcessors(), IMAGE_RESIZE_MAX_THREADS_SUGGESTED);
+
+  uint64_t work = (uint64_t)ctx->dSize[0] * (uint64_t)(ctx->sSize[1] + ctx->dSize[1]);
+  uint64_t wanted = Math::min<uint64_t>(work / IMAGE_RESIZE_MIN_WORK_PER_THREAD, maxThreads);
+
+  if (wanted <= 1)
+    return 1;
+
+  uint numPooled = uint(wanted) - 1;
+  if (d->numThreads < numPooled)
+  {
+    // Get as many threads as possible, use these already held if it fails.
+    d->numThreads += BandDispatcher::getThreads(d->threads + d->numThreads, numPooled - d->numThreads);
+  }
+
+  return Math::min<uint>(numPooled, d->numThreads) + 1;
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Construction / Destruction]
+// ============================================================================
+
+static void FOG_CDECL ImageResizer_ctor(ImageResizer* self)
+{
+  self->_resizeFunc = IMAGE_RESIZE_BILINEAR;
+  self->_mode = IMAGE_RESIZE_MODE_AUTO;
+  self->_maxThreads = 0;
+  self->_reserved = 0;
+  self->_d = NULL;
+}
+
+static void FOG_CDECL ImageResizer_dtor(ImageResizer* self)
+{
+  fog_api.imageresizer_reset(self);
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Reset]
+// ============================================================================
+
+static void FOG_CDECL ImageResizer_reset(ImageResizer* self)
+{
+  ImageResizerData* d = self->_d;
+
+  if (d != NULL)
+  {
+    fog_api.imageresizer_clearCache(self);
+
+    ImageResizer_releaseFunc(d);
+    ImageResizer_releaseThreads(d, 0);
+
+    MemMgr::free(d);
+  }
+
+  ImageResizer_ctor(self);
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Function]
+// ============================================================================
+
+static err_t FOG_CDECL ImageResizer_setResizeFunc(ImageResizer* self, uint32_t resizeFunc, const Hash<StringW, Var>* params)
+{
+  ImageResizerData* d = ImageResizer_getData(self);
+
+  if (FOG_IS_NULL(d))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  MathFunctionF* func;
+  float radius;
+
+  FOG_RETURN_ON_ERROR(ImageResize_createFunc(&func, &radius, resizeFunc, params));
+
+  fog_api.imageresizer_clearCache(self);
+  ImageResizer_releaseFunc(d);
+
+  d->func = func;
+  d->ownsFunc = true;
+  d->radius = radius;
+
+  self->_resizeFunc = resizeFunc;
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL ImageResizer_setCustomFunc(ImageResizer* self, const MathFunctionF* resizeFunc, float radius)
 {
   if (FOG_IS_NULL(resizeFunc))
     return ERR_RT_INVALID_ARGUMENT;
@@ -1648,39 +2278,173 @@ static err_t FOG_CDECL ImageResize_resizeCustom(Image* dst, const SizeI* dSize,
   if (!Math::isFinite(radius) || radius < 1.0f || radius > 16.0f)
     return ERR_RT_INVALID_ARGUMENT;
 
-  if (dSize && !dSize->isValid())
+  ImageResizerData* d = ImageResizer_getData(self);
+
+  if (FOG_IS_NULL(d))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  fog_api.imageresizer_clearCache(self);
+  ImageResizer_releaseFunc(d);
+
+  d->func = const_cast<MathFunctionF*>(resizeFunc);
+  d->ownsFunc = false;
+  d->radius = radius;
+
+  self->_resizeFunc = IMAGE_RESIZE_COUNT;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Mode / Threads]
+// ============================================================================
+
+static err_t FOG_CDECL ImageResizer_setMode(ImageResizer* self, uint32_t mode)
+{
+  if (mode >= IMAGE_RESIZE_MODE_COUNT)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  self->_mode = mode;
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL ImageResizer_setMaxThreads(ImageResizer* self, uint32_t maxThreads)
+{
+  if (maxThreads > IMAGE_RESIZE_MAX_THREADS_LIMIT)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  self->_maxThreads = maxThreads;
+
+  if (self->_d != NULL && maxThreads != 0)
+    ImageResizer_releaseThreads(self->_d, maxThreads - 1);
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Cache]
+// ============================================================================
+
+static void FOG_CDECL ImageResizer_clearCache(ImageResizer* self)
+{
+  ImageResizerData* d = self->_d;
+
+  if (d == NULL)
+    return;
+
+  for (uint32_t i = 0; i < d->cacheLength; i++)
+    ImageResize_api.destroyWeights(&d->cache[i]);
+
+  d->cacheLength = 0;
+  d->cacheStamp = 0;
+}
+
+// ============================================================================
+// [Fog::ImageResizer - Resize]
+// ============================================================================
+
+static err_t FOG_CDECL ImageResizer_resize(ImageResizer* self, Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment)
+{
+  if (dSize == NULL || !dSize->isValid())
     return ERR_IMAGE_INVALID_SIZE;
 
-  if (src->isEmpty())
+  RectI sRect(0, 0, src->getWidth(), src->getHeight());
+  if (sFragment != NULL && !RectI::intersect(sRect, sRect, *sFragment))
+    sRect.reset();
+
+  if (src->isEmpty() || !sRect.isValid())
   {
     dst->reset();
     return ERR_OK;
   }
-  
+
   uint32_t format = src->getFormat();
+  if (ImageResize_api.doHorizontal[format] == NULL || ImageResize_api.doVertical[format] == NULL)
+    return ERR_IMAGE_INVALID_FORMAT;
+
+  ImageResizerData* d = self->_d;
+  if (d == NULL || d->func == NULL)
+  {
+    FOG_RETURN_ON_ERROR(fog_api.imageresizer_setResizeFunc(self, self->_resizeFunc, NULL));
+    d = self->_d;
+  }
+
+  const ImageResizeWeights* hWeights;
+  const ImageResizeWeights* vWeights;
+
+  const ImageFormatDescription& fdesc = ImageFormatDescription::getByFormat(format);
+  uint32_t precision = fdesc.getPrecision();
+
+  FOG_RETURN_ON_ERROR(ImageResizer_getWeights(d, sRect.w, dSize->w, precision, &hWeights));
+  FOG_RETURN_ON_ERROR(ImageResizer_getWeights(d, sRect.h, dSize->h, precision, &vWeights));
+
+  // Hold the source data, the destination can be the same image.
+  Image sImage(*src);
   FOG_RETURN_ON_ERROR(dst->create(*dSize, format));
 
   ImageData* dst_d = dst->_d;
-  ImageData* src_d = src->_d;
+  ImageData* src_d = sImage._d;
+
+  uint32_t bpp = fdesc.getBytesPerPixel();
 
   ImageResizeContext ctx;
 
-  FOG_RETURN_ON_ERROR(
-    ImageResize_api.init(&ctx,
-      dst_d->first, dst_d->stride, dst_d->size.w, dst_d->size.h,
-      src_d->first, src_d->stride, src_d->size.w, src_d->size.h,
-      format,
-      resizeFunc, radius)
-  );
+  ctx.dData = dst_d->first;
+  ctx.sData = src_d->first + (ssize_t)sRect.y * src_d->stride + (ssize_t)sRect.x * bpp;
+  ctx.tData = NULL;
 
-  ImageResize_api.doWeights(&ctx, 0);
-  ImageResize_api.doHorizontal[format](&ctx);
+  ctx.dStride = dst_d->stride;
+  ctx.sStride = src_d->stride;
+  ctx.tStride = (ssize_t)((size_t)(dSize->w * bpp + 15) & ~(size_t)15);
 
-  ImageResize_api.doWeights(&ctx, 1);
-  ImageResize_api.doVertical[format](&ctx);
+  ctx.dSize[0] = dSize->w;
+  ctx.dSize[1] = dSize->h;
 
-  ImageResize_api.destroy(&ctx);
-  return ERR_OK;
+  ctx.sSize[0] = sRect.w;
+  ctx.sSize[1] = sRect.h;
+
+  ctx.kernelSize[0] = hWeights->kernelSize;
+  ctx.kernelSize[1] = vWeights->kernelSize;
+
+  ctx.isBound[0] = hWeights->isBound;
+  ctx.isBound[1] = vWeights->isBound;
+
+  ctx.weightList[0] = hWeights->weightList;
+  ctx.weightList[1] = vWeights->weightList;
+
+  ctx.recordList[0] = hWeights->recordList;
+  ctx.recordList[1] = vWeights->recordList;
+
+  uint32_t mode = self->_mode;
+  if (mode == IMAGE_RESIZE_MODE_AUTO)
+  {
+    size_t tSize = (size_t)ctx.sSize[1] * (size_t)ctx.tStride;
+    mode = (tSize > IMAGE_RESIZE_STRIP_THRESHOLD) ? IMAGE_RESIZE_MODE_STRIPS : IMAGE_RESIZE_MODE_TWO_PASS;
+  }
+
+  uint numWorkers = ImageResizer_getWorkers(self, d, &ctx);
+
+  ImageResizeWorkMgr mgr(ctx, format, d->threads, numWorkers);
+  return mgr.process(mode);
+}
+
+// ============================================================================
+// [Fog::ImageResize - Resize]
+// ============================================================================
+
+static err_t FOG_CDECL ImageResize_resize(Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment, uint32_t resizeFunc, const Hash<StringW, Var>* params)
+{
+  ImageResizer resizer;
+
+  FOG_RETURN_ON_ERROR(fog_api.imageresizer_setResizeFunc(&resizer, resizeFunc, params));
+  return fog_api.imageresizer_resize(&resizer, dst, dSize, src, sFragment);
+}
+
+static err_t FOG_CDECL ImageResize_resizeCustom(Image* dst, const SizeI* dSize, const Image* src, const RectI* sFragment, const MathFunctionF* resizeFunc, float radius)
+{
+  ImageResizer resizer;
+
+  FOG_RETURN_ON_ERROR(fog_api.imageresizer_setCustomFunc(&resizer, resizeFunc, radius));
+  return fog_api.imageresizer_resize(&resizer, dst, dSize, src, sFragment);
 }
 
 // ============================================================================
@@ -1698,23 +2462,36 @@ FOG_NO_EXPORT void ImageResize_init(void)
   fog_api.image_resize = ImageResize_resize;
   fog_api.image_resizeCustom = ImageResize_resizeCustom;
 
-  ImageResize_api.init = ImageResizeContext_init;
-  ImageResize_api.destroy = ImageResizeContext_destroy;
-  ImageResize_api.doWeights = ImageResizeContext_doWeights;
+  fog_api.imageresizer_ctor = ImageResizer_ctor;
+  fog_api.imageresizer_dtor = ImageResizer_dtor;
+  fog_api.imageresizer_reset = ImageResizer_reset;
+  fog_api.imageresizer_setResizeFunc = ImageResizer_setResizeFunc;
+  fog_api.imageresizer_setCustomFunc = ImageResizer_setCustomFunc;
+  fog_api.imageresizer_setMode = ImageResizer_setMode;
+  fog_api.imageresizer_setMaxThreads = ImageResizer_setMaxThreads;
+  fog_api.imageresizer_clearCache = ImageResizer_clearCache;
+  fog_api.imageresizer_resize = ImageResizer_resize;
+
+  ImageResize_api.initWeights = ImageResizeWeights_init;
+  ImageResize_api.destroyWeights = ImageResizeWeights_destroy;
 
   ImageResize_api.doHorizontal[IMAGE_FORMAT_PRGB32] = ImageResizeContext_doHorizontal_PRGB32;
   ImageResize_api.doHorizontal[IMAGE_FORMAT_XRGB32] = ImageResizeContext_doHorizontal_XRGB32;
   ImageResize_api.doHorizontal[IMAGE_FORMAT_RGB24 ] = ImageResizeContext_doHorizontal_RGB24;
   ImageResize_api.doHorizontal[IMAGE_FORMAT_A8    ] = ImageResizeContext_doHorizontal_A8;
 //ImageResize_api.doHorizontal[IMAGE_FORMAT_I8    ] = NONE;
-  // TODO: 16-bit image processing.
+  ImageResize_api.doHorizontal[IMAGE_FORMAT_PRGB64] = ImageResizeContext_doHorizontal_PRGB64;
+  ImageResize_api.doHorizontal[IMAGE_FORMAT_RGB48 ] = ImageResizeContext_doHorizontal_RGB48;
+  ImageResize_api.doHorizontal[IMAGE_FORMAT_A16   ] = ImageResizeContext_doHorizontal_A16;
 
   ImageResize_api.doVertical[IMAGE_FORMAT_PRGB32] = ImageResizeContext_doVertical_PRGB32;
   ImageResize_api.doVertical[IMAGE_FORMAT_XRGB32] = ImageResizeContext_doVertical_XRGB32;
   ImageResize_api.doVertical[IMAGE_FORMAT_RGB24 ] = ImageResizeContext_doVertical_RGB24;
   ImageResize_api.doVertical[IMAGE_FORMAT_A8    ] = ImageResizeContext_doVertical_A8;
 //ImageResize_api.doVertical[IMAGE_FORMAT_I8    ] = NONE;
-  // TODO: 16-bit image processing.
+  ImageResize_api.doVertical[IMAGE_FORMAT_PRGB64] = ImageResizeContext_doVertical_PRGB64;
+  ImageResize_api.doVertical[IMAGE_FORMAT_RGB48 ] = ImageResizeContext_doVertical_RGB48;
+  ImageResize_api.doVertical[IMAGE_FORMAT_A16   ] = ImageResizeContext_doVertical_A16;
 
   // --------------------------------------------------------------------------
   // [CPU Based Optimizations]
@@ -35,6 +35,8 @@ FOG_XMM_DECLARE_CONST_PI16_VAR(ImageResizeHalf16HiLo_XRGB32, 0xFFFF, 0x0080, 0x0
 
 FOG_XMM_DECLARE_CONST_PI32_VAR(ImageResizeHalf32, 0x00000080, 0x00000080, 0x00000080, 0x00000080);
 
+FOG_XMM_DECLARE_CONST_PS_SET(ImageResizeInv16, 1.0f / 65536.0f);
+
 // ============================================================================
 // [Fog::ImageResize - Context - DoHorizontal - PRGB32 (SSE2)]
 // ============================================================================
@@ -58,8 +60,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB32_SSE2(ImageResizeCon
 
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -215,8 +217,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB32_SSE2(ImageResizeCon
 
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -428,8 +430,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_XRGB32_SSE2(ImageResizeCon
 
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -585,8 +587,8 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_XRGB32_SSE2(ImageResizeCon
 
     for (uint y = 0; y < sh; y++)
     {
-      const ImageResizeRecord* recordList = ctx->recordList;
-      const int32_t* weightList = ctx->weightList;
+      const ImageResizeRecord* recordList = ctx->recordList[0];
+      const int32_t* weightList = ctx->weightList[0];
 
       uint8_t* tp = tData;
 
@@ -775,7 +777,7 @@ static void FOG_CDECL ImageResizeContext_doHorizontal_XRGB32_SSE2(ImageResizeCon
 
 static void FOG_CDECL ImageResizeContext_doVertical_PRGB32_SSE2(ImageResizeContext* ctx)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0];
   uint dh = ctx->dSize[1];
@@ -785,8 +787,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_PRGB32_SSE2(ImageResizeConte
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1061,7 +1063,7 @@ _UnboundLarge:
 
 static void FOG_CDECL ImageResizeContext_doVertical_XRGB32_SSE2(ImageResizeContext* ctx)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0];
   uint dh = ctx->dSize[1];
@@ -1071,8 +1073,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_XRGB32_SSE2(ImageResizeConte
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1345,7 +1347,7 @@ _UnboundLarge:
 
 static void FOG_CDECL ImageResizeContext_doVertical_Bytes_SSE2(ImageResizeContext* ctx, uint wScale)
 {
-  uint kernelSize = ctx->kernelSize[0];
+  uint kernelSize = ctx->kernelSize[1];
 
   uint dw = ctx->dSize[0] * wScale;
   uint dh = ctx->dSize[1];
@@ -1355,8 +1357,8 @@ static void FOG_CDECL ImageResizeContext_doVertical_Bytes_SSE2(ImageResizeContex
   ssize_t dStride = ctx->dStride;
   ssize_t tStride = ctx->tStride;
 
-  const ImageResizeRecord* recordList = ctx->recordList;
-  const int32_t* weightList = ctx->weightList;
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
 
   if (ctx->isBound[1] == 1)
   {
@@ -1703,6 +1705,287 @@ static void FOG_CDECL ImageResizeContext_doVertical_A8_SSE2(ImageResizeContext*
   ImageResizeContext_doVertical_Bytes_SSE2(ctx, 1);
 }
 
+// ============================================================================
+// [Fog::ImageResize - Context - Helpers - PRGB64, RGB48, A16 (SSE2)]
+// ============================================================================
+
+// SSE2 has no unsigned 16x32-bit multiplication, so 16-bit pixels multiplied
+// by 16.16 weights are accumulated in floats. The accumulated value is scaled
+// down by 1/65536 and saturated to 0...65535 by the final pack.
+
+//! @internal
+//!
+//! @brief Multiply the word-pixel @a xmmPixel by the weight @a wp[0] and add
+//! the result to @a xmmAcc.
+static FOG_INLINE void ImageResize_accWord4_SSE2(__m128f& xmmAcc, const __m128i& xmmPixel, const int32_t* wp)
+{
+  __m128i xmmTmp;
+  __m128f xmmPixelF;
+  __m128f xmmWeightF;
+
+  Acc::m128iCvtSI128FromSI(xmmTmp, wp[0]);
+  Acc::m128fCvtPSFromPI32(xmmWeightF, xmmTmp);
+  Acc::m128iUnpackPI32FromPI16Lo(xmmTmp, xmmPixel);
+  Acc::m128fShuffle<0, 0, 0, 0>(xmmWeightF, xmmWeightF);
+  Acc::m128fCvtPSFromPI32(xmmPixelF, xmmTmp);
+
+  Acc::m128fMulPS(xmmPixelF, xmmPixelF, xmmWeightF);
+  Acc::m128fAddPS(xmmAcc, xmmAcc, xmmPixelF);
+}
+
+//! @internal
+//!
+//! @brief Scale the accumulated value @a xmmAcc and convert it to int32.
+//!
+//! If @a clampAlpha is true then @a xmmAcc contains the PRGB64 pixel and
+//! the color components are saturated to alpha.
+static FOG_INLINE void ImageResize_cvtWord4_SSE2(__m128i& dst0, __m128f& xmmAcc, bool clampAlpha)
+{
+  Acc::m128fMulPS(xmmAcc, xmmAcc, FOG_XMM_GET_CONST_PS(ImageResizeInv16));
+
+  if (clampAlpha)
+  {
+    __m128f xmmAlpha;
+
+    Acc::m128fShuffle<PIXEL_ARGB64_WORD_A, PIXEL_ARGB64_WORD_A, PIXEL_ARGB64_WORD_A, PIXEL_ARGB64_WORD_A>(xmmAlpha, xmmAcc);
+    Acc::m128fMinPS(xmmAcc, xmmAcc, xmmAlpha);
+  }
+
+  Acc::m128iCvtPI32FromPS(dst0, xmmAcc);
+}
+
+// ============================================================================
+// [Fog::ImageResize - Context - DoHorizontal - PRGB64, RGB48 (SSE2)]
+// ============================================================================
+
+static FOG_INLINE void ImageResizeContext_doHorizontal_Words_SSE2(ImageResizeContext* ctx, uint wScale, bool isPRGB)
+{
+  uint kernelSize = ctx->kernelSize[0];
+
+  uint dw = ctx->dSize[0];
+  uint sh = ctx->sSize[1];
+
+  uint8_t* sData = ctx->sData;
+  uint8_t* tData = ctx->tData;
+
+  ssize_t sStride = ctx->sStride;
+  ssize_t tStride = ctx->tStride;
+
+  bool clampAlpha = isPRGB && ctx->isBound[0] != 1;
+
+  for (uint y = 0; y < sh; y++)
+  {
+    const ImageResizeRecord* recordList = ctx->recordList[0];
+    const int32_t* weightList = ctx->weightList[0];
+
+    uint16_t* tp = reinterpret_cast<uint16_t*>(tData);
+
+    for (uint x = 0; x < dw; x++)
+    {
+      const uint16_t* sp = reinterpret_cast<const uint16_t*>(sData) + recordList->pos * wScale;
+      const int32_t* wp = weightList;
+
+      __m128f xmmAcc;
+      __m128i xmmPixel;
+
+      Acc::m128fZero(xmmAcc);
+
+      for (uint j = recordList->count; j; j--)
+      {
+        if (wScale == 4)
+        {
+          Acc::m128iLoad8(xmmPixel, sp);
+        }
+        else
+        {
+          // Don't read behind the pixel, the last pixel in the scanline
+          // doesn't have to be followed by two bytes.
+          Acc::m128iLoad4(xmmPixel, sp);
+          Acc::m128iInsertPI16<2>(xmmPixel, xmmPixel, sp[2]);
+        }
+
+        ImageResize_accWord4_SSE2(xmmAcc, xmmPixel, wp);
+
+        sp += wScale;
+        wp += 1;
+      }
+
+      ImageResize_cvtWord4_SSE2(xmmPixel, xmmAcc, clampAlpha);
+      Acc::m128iPackPU16FromPI32(xmmPixel, xmmPixel);
+
+      if (wScale == 4)
+      {
+        Acc::m128iStore8(tp, xmmPixel);
+      }
+      else
+      {
+        int t2;
+
+        Acc::m128iStore4(tp, xmmPixel);
+        Acc::m128iExtractPI16<2>(t2, xmmPixel);
+        tp[2] = (uint16_t)t2;
+      }
+
+      recordList += 1;
+      weightList += kernelSize;
+
+      tp += wScale;
+    }
+
+    sData += sStride;
+    tData += tStride;
+  }
+}
+
+static void FOG_CDECL ImageResizeContext_doHorizontal_PRGB64_SSE2(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doHorizontal_Words_SSE2(ctx, 4, true);
+}
+
+static void FOG_CDECL ImageResizeContext_doHorizontal_RGB48_SSE2(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doHorizontal_Words_SSE2(ctx, 3, false);
+}
+
+// ============================================================================
+// [Fog::ImageResize - Context - DoVertical - PRGB64, RGB48, A16 (SSE2)]
+// ============================================================================
+
+static FOG_INLINE void ImageResizeContext_doVertical_Words_SSE2(ImageResizeContext* ctx, uint wScale, bool isPRGB)
+{
+  uint kernelSize = ctx->kernelSize[1];
+
+  uint dw = ctx->dSize[0] * wScale;
+  uint dh = ctx->dSize[1];
+
+  uint8_t* dData = ctx->dData;
+
+  ssize_t dStride = ctx->dStride;
+  ssize_t tStride = ctx->tStride;
+
+  const ImageResizeRecord* recordList = ctx->recordList[1];
+  const int32_t* weightList = ctx->weightList[1];
+
+  // Words are processed in groups of 4, which is exactly one PRGB64 pixel.
+  bool clampAlpha = isPRGB && ctx->isBound[1] != 1;
+
+  for (uint y = 0; y < dh; y++)
+  {
+    uint8_t* tData = ctx->tData + (ssize_t)recordList->pos * tStride;
+    uint16_t* dp = reinterpret_cast<uint16_t*>(dData);
+    uint count = recordList->count;
+
+    uint x = dw;
+
+    while (x >= 8)
+    {
+      const uint8_t* tp = tData;
+      const int32_t* wp = weightList;
+
+      __m128f xmmAcc0;
+      __m128f xmmAcc1;
+
+      __m128i xmmPixel0;
+      __m128i xmmPixel1;
+
+      Acc::m128fZero(xmmAcc0);
+      Acc::m128fZero(xmmAcc1);
+
+      for (uint j = count; j; j--)
+      {
+        Acc::m128iLoad16u(xmmPixel0, tp);
+        Acc::m128iShufflePI32<3, 2, 3, 2>(xmmPixel1, xmmPixel0);
+
+        ImageResize_accWord4_SSE2(xmmAcc0, xmmPixel0, wp);
+        ImageResize_accWord4_SSE2(xmmAcc1, xmmPixel1, wp);
+
+        tp += tStride;
+        wp += 1;
+      }
+
+      ImageResize_cvtWord4_SSE2(xmmPixel0, xmmAcc0, clampAlpha);
+      ImageResize_cvtWord4_SSE2(xmmPixel1, xmmAcc1, clampAlpha);
+      Acc::m128iPackPU16FromPI32(xmmPixel0, xmmPixel0, xmmPixel1);
+      Acc::m128iStore16u(dp, xmmPixel0);
+
+      dp += 8;
+      tData += 16;
+      x -= 8;
+    }
+
+    if (x >= 4)
+    {
+      const uint8_t* tp = tData;
+      const int32_t* wp = weightList;
+
+      __m128f xmmAcc0;
+      __m128i xmmPixel0;
+
+      Acc::m128fZero(xmmAcc0);
+
+      for (uint j = count; j; j--)
+      {
+        Acc::m128iLoad8(xmmPixel0, tp);
+        ImageResize_accWord4_SSE2(xmmAcc0, xmmPixel0, wp);
+
+        tp += tStride;
+        wp += 1;
+      }
+
+      ImageResize_cvtWord4_SSE2(xmmPixel0, xmmAcc0, clampAlpha);
+      Acc::m128iPackPU16FromPI32(xmmPixel0, xmmPixel0);
+      Acc::m128iStore8(dp, xmmPixel0);
+
+      dp += 4;
+      tData += 8;
+      x -= 4;
+    }
+
+    // Tail, only possible in non-premultiplied formats (RGB48, A16).
+    while (x)
+    {
+      const uint8_t* tp = tData;
+      const int32_t* wp = weightList;
+
+      int64_t c0 = 0x8000;
+
+      for (uint j = count; j; j--)
+      {
+        c0 += (int64_t)reinterpret_cast<const uint16_t*>(tp)[0] * wp[0];
+
+        tp += tStride;
+        wp += 1;
+      }
+
+      dp[0] = (uint16_t)Math::bound<int64_t>(c0 >> 16, 0, 0xFFFF);
+
+      dp += 1;
+      tData += 2;
+      x--;
+    }
+
+    recordList += 1;
+    weightList += kernelSize;
+
+    dData += dStride;
+  }
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_PRGB64_SSE2(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words_SSE2(ctx, 4, true);
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_RGB48_SSE2(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words_SSE2(ctx, 3, false);
+}
+
+static void FOG_CDECL ImageResizeContext_doVertical_A16_SSE2(ImageResizeContext* ctx)
+{
+  ImageResizeContext_doVertical_Words_SSE2(ctx, 1, false);
+}
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
@@ -1711,11 +1994,16 @@ FOG_NO_EXPORT void ImageResize_init_SSE2(ImageResizeApi* api)
 {
   api->doHorizontal[IMAGE_FORMAT_PRGB32] = ImageResizeContext_doHorizontal_PRGB32_SSE2;
   api->doHorizontal[IMAGE_FORMAT_XRGB32] = ImageResizeContext_doHorizontal_XRGB32_SSE2;
+  api->doHorizontal[IMAGE_FORMAT_PRGB64] = ImageResizeContext_doHorizontal_PRGB64_SSE2;
+  api->doHorizontal[IMAGE_FORMAT_RGB48 ] = ImageResizeContext_doHorizontal_RGB48_SSE2;
 
   api->doVertical[IMAGE_FORMAT_PRGB32] = ImageResizeContext_doVertical_PRGB32_SSE2;
   api->doVertical[IMAGE_FORMAT_XRGB32] = ImageResizeContext_doVertical_XRGB32_SSE2;
   api->doVertical[IMAGE_FORMAT_RGB24 ] = ImageResizeContext_doVertical_RGB24_SSE2;
   api->doVertical[IMAGE_FORMAT_A8    ] = ImageResizeContext_doVertical_A8_SSE2;
+  api->doVertical[IMAGE_FORMAT_PRGB64] = ImageResizeContext_doVertical_PRGB64_SSE2;
+  api->doVertical[IMAGE_FORMAT_RGB48 ] = ImageResizeContext_doVertical_RGB48_SSE2;
+  api->doVertical[IMAGE_FORMAT_A16   ] = ImageResizeContext_doVertical_A16_SSE2;
 }
 
 } // Fog namespace
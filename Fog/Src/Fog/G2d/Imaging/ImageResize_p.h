@@ -8,8 +8,11 @@
 #define _FOG_G2D_IMAGING_IMAGERESIZE_P_H
 
 // [Dependencies]
+#include <Fog/Core/Threading/BandDispatcher_p.h>
+#include <Fog/Core/Threading/Thread.h>
 #include <Fog/G2d/Geometry/Size.h>
 #include <Fog/G2d/Imaging/Image.h>
+#include <Fog/G2d/Imaging/ImageResizer.h>
 
 namespace Fog {
 
@@ -22,6 +25,51 @@ namespace Fog {
 
 struct ImageResizeApi;
 struct ImageResizeContext;
+struct ImageResizeWeights;
+
+// ============================================================================
+// [Fog::IMAGE_RESIZE_CORE]
+// ============================================================================
+
+enum IMAGE_RESIZE_CORE
+{
+  //! @brief Count of weight tables cached by @c ImageResizer (each table is
+  //! for one direction).
+  IMAGE_RESIZE_CACHE_SIZE = 16,
+
+  //! @brief Maximum number of threads used by @c ImageResizer (including the
+  //! calling thread).
+  IMAGE_RESIZE_MAX_THREADS_LIMIT = 64,
+  //! @brief Maximum number of threads used when the number of threads is not
+  //! set explicitly.
+  IMAGE_RESIZE_MAX_THREADS_SUGGESTED = 16,
+
+  //! @brief Minimum count of pixels (produced by both passes) per thread.
+  IMAGE_RESIZE_MIN_WORK_PER_THREAD = 128 * 128,
+
+  //! @brief Size of the temporary buffer, which causes @c IMAGE_RESIZE_MODE_AUTO
+  //! to switch to strips.
+  IMAGE_RESIZE_STRIP_THRESHOLD = 1024 * 1024,
+  //! @brief Preferred size of the temporary buffer used by one strip.
+  IMAGE_RESIZE_STRIP_SIZE = 128 * 1024
+};
+
+// ============================================================================
+// [Fog::IMAGE_RESIZE_PASS]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Pass dispatched by @c ImageResizeWorkMgr.
+enum IMAGE_RESIZE_PASS
+{
+  //! @brief Horizontal pass, source rows are split into bands.
+  IMAGE_RESIZE_PASS_HORIZONTAL = 0,
+  //! @brief Vertical pass, destination rows are split into bands.
+  IMAGE_RESIZE_PASS_VERTICAL = 1,
+  //! @brief Both passes, destination rows are split into bands of strips.
+  IMAGE_RESIZE_PASS_STRIPS = 2
+};
 
 // ============================================================================
 // [Fog::ImageResizeApi]
@@ -29,27 +77,22 @@ struct ImageResizeContext;
 
 struct FOG_NO_EXPORT ImageResizeApi
 {
-  typedef err_t (FOG_CDECL* InitFunc)(ImageResizeContext* ctx,
-    uint8_t* dData, size_t dStride, int dw, int dh,
-    uint8_t* sData, size_t sStride, int sw, int sh,
-    uint32_t format,
-    const MathFunctionF* func, float radius);
-  typedef void (FOG_CDECL* DestroyFunc)(ImageResizeContext* ctx);
-
-  typedef void (FOG_CDECL* DoWeightsFunc)(ImageResizeContext* ctx, uint dir);
+  typedef err_t (FOG_CDECL* InitWeightsFunc)(ImageResizeWeights* weights,
+    int sSize, int dSize, uint32_t precision, const MathFunctionF* func, float radius);
+  typedef void (FOG_CDECL* DestroyWeightsFunc)(ImageResizeWeights* weights);
+
   typedef void (FOG_CDECL* DoHorizontalFunc)(ImageResizeContext* ctx);
   typedef void (FOG_CDECL* DoVerticalFunc)(ImageResizeContext* ctx);
 
-  InitFunc init;
-  DestroyFunc destroy;
+  InitWeightsFunc initWeights;
+  DestroyWeightsFunc destroyWeights;
 
-  DoWeightsFunc doWeights;
   DoHorizontalFunc doHorizontal[IMAGE_FORMAT_COUNT];
   DoVerticalFunc doVertical[IMAGE_FORMAT_COUNT];
 };
 
 // ============================================================================
-// [Fog::ImageResizeOffset]
+// [Fog::ImageResizeRecord]
 // ============================================================================
 
 struct FOG_NO_EXPORT ImageResizeRecord
@@ -58,10 +101,52 @@ struct FOG_NO_EXPORT ImageResizeRecord
   uint32_t count;
 };
 
+// ============================================================================
+// [Fog::ImageResizeWeights]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Weights of one direction.
+//!
+//! Weights depend only on the source and destination size in the direction,
+//! on the precision and on the resize function, so they can be shared by both
+//! directions and reused by all images of the same size.
+//!
+//! The weights are stored in 8.8 fixed point (@c IMAGE_PRECISION_BYTE) or in
+//! 16.16 fixed point (@c IMAGE_PRECISION_WORD), and their sum is always one.
+struct FOG_NO_EXPORT ImageResizeWeights
+{
+  int sSize;
+  int dSize;
+  uint32_t precision;
+
+  float scale;
+  float factor;
+  float radius;
+
+  uint kernelSize;
+  uint isBound;
+
+  //! @brief Last-use stamp (used by @c ImageResizer cache).
+  uint32_t stamp;
+
+  int32_t* weightList;
+  ImageResizeRecord* recordList;
+};
+
 // ============================================================================
 // [Fog::ImageResizeContext]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Resize context, used by the doHorizontal and doVertical functions.
+//!
+//! The horizontal pass processes @c sSize[1] rows from @c sData to @c tData,
+//! the vertical pass processes @c dSize[1] rows from @c tData to @c dData,
+//! where the row at @c tData matches the first source row. Bands are
+//! processed using a copy of the context with adjusted pointers and sizes.
 struct FOG_NO_EXPORT ImageResizeContext
 {
   uint8_t* dData;
@@ -75,17 +160,107 @@ struct FOG_NO_EXPORT ImageResizeContext
   int dSize[2];
   int sSize[2];
 
-  float scale[2];
-  float factor[2];
-  float radius[2];
-
   uint kernelSize[2];
   uint isBound[2];
 
-  int32_t* weightList;
-  ImageResizeRecord* recordList;
+  const int32_t* weightList[2];
+  const ImageResizeRecord* recordList[2];
+};
+
+// ============================================================================
+// [Fog::ImageResizerData]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Private data of @c ImageResizer.
+struct FOG_NO_EXPORT ImageResizerData
+{
+  //! @brief The resize function.
+  MathFunctionF* func;
+  //! @brief Whether the resize function is owned (built-in).
+  uint32_t ownsFunc;
+  //! @brief The resize function radius.
+  float radius;
+
+  //! @brief Count of cached weight tables.
+  uint32_t cacheLength;
+  //! @brief Stamp of the last cache access.
+  uint32_t cacheStamp;
+  //! @brief Cached weight tables.
+  ImageResizeWeights cache[IMAGE_RESIZE_CACHE_SIZE];
+
+  //! @brief Count of pooled threads held by the resizer.
+  uint32_t numThreads;
+  //! @brief Pooled threads.
+  Thread* threads[IMAGE_RESIZE_MAX_THREADS_LIMIT - 1];
+};
+
+// ============================================================================
+// [Fog::ImageResizeWorkMgr]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Image resize worker manager.
+//!
+//! Each pass is split into horizontal bands, one band per worker. The calling
+//! thread processes the first band and waits until all other workers finished.
+struct FOG_NO_EXPORT ImageResizeWorkMgr
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  ImageResizeWorkMgr(const ImageResizeContext& ctx, uint32_t format, Thread** threads, uint numWorkers);
+  ~ImageResizeWorkMgr();
+
+  // --------------------------------------------------------------------------
+  // [Process]
+  // --------------------------------------------------------------------------
+
+  //! @brief Resize using @a mode (@c IMAGE_RESIZE_MODE_TWO_PASS or
+  //! @c IMAGE_RESIZE_MODE_STRIPS).
+  err_t process(uint32_t mode);
+
+  //! @brief Run @a pass by all workers and wait for them.
+  void dispatch(uint32_t pass);
+
+  //! @brief Run the band @a id of the current pass.
+  void runWorker(uint id);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The resize context (the whole image).
+  ImageResizeContext ctx;
+  //! @brief The image format.
+  uint32_t format;
+  //! @brief The current pass.
+  uint32_t pass;
+
+  //! @brief Band dispatcher.
+  BandDispatcher dispatcher;
+
+  //! @brief Count of workers (including the calling thread).
+  uint numWorkers;
+
+  //! @brief Height of one strip (@c IMAGE_RESIZE_PASS_STRIPS).
+  int stripHeight;
+  //! @brief Count of strips processed by one worker (@c IMAGE_RESIZE_PASS_STRIPS).
+  int stripsPerWorker;
+
+  //! @brief Temporary buffer (one per worker in @c IMAGE_RESIZE_PASS_STRIPS).
+  uint8_t* buffer;
+  //! @brief Size of the temporary buffer per worker.
+  size_t bufferSize;
+
+  //! @brief Pooled threads (numWorkers - 1).
+  Thread** threads;
 
-  const MathFunctionF* func;
+private:
+  FOG_NO_COPY(ImageResizeWorkMgr)
 };
 
 //! @}
@@ -0,0 +1,172 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_IMAGING_IMAGERESIZER_H
+#define _FOG_G2D_IMAGING_IMAGERESIZER_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Tools/Hash.h>
+#include <Fog/Core/Tools/String.h>
+#include <Fog/Core/Tools/Var.h>
+#include <Fog/G2d/Geometry/Rect.h>
+#include <Fog/G2d/Geometry/Size.h>
+#include <Fog/G2d/Imaging/Image.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Imaging
+//! @{
+
+// ============================================================================
+// [Fog::ImageResizer]
+// ============================================================================
+
+//! @brief Image resizer.
+//!
+//! Image resizer does the same as @c Image::resize(), but it keeps the weight
+//! tables of the last used sizes (so resizing many images to the same size
+//! computes the weights only once) and the pooled threads used to resize large
+//! images.
+//!
+//! @note Image resizer is not thread-safe, use one resizer per thread.
+struct FOG_NO_EXPORT ImageResizer
+{
+  // --------------------------------------------------------------------------
+  // [Construction & Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE ImageResizer()
+  {
+    fog_api.imageresizer_ctor(this);
+  }
+
+  FOG_INLINE ~ImageResizer()
+  {
+    fog_api.imageresizer_dtor(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Reset]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reset the resizer to defaults, releasing all cached weights and
+  //! pooled threads.
+  FOG_INLINE void reset()
+  {
+    fog_api.imageresizer_reset(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Function]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the resize function, see @c IMAGE_RESIZE.
+  //!
+  //! Returns @c IMAGE_RESIZE_COUNT if custom function is used.
+  FOG_INLINE uint32_t getResizeFunc() const { return _resizeFunc; }
+
+  //! @brief Set the resize function, see @c IMAGE_RESIZE.
+  FOG_INLINE err_t setResizeFunc(uint32_t resizeFunc)
+  {
+    return fog_api.imageresizer_setResizeFunc(this, resizeFunc, NULL);
+  }
+
+  //! @brief Set the resize function, see @c IMAGE_RESIZE.
+  FOG_INLINE err_t setResizeFunc(uint32_t resizeFunc, const Hash<StringW, Var>& params)
+  {
+    return fog_api.imageresizer_setResizeFunc(this, resizeFunc, &params);
+  }
+
+  //! @brief Set the custom resize function.
+  //!
+  //! @note The function is not copied, it must exist until it's replaced or
+  //! until the resizer is destroyed.
+  FOG_INLINE err_t setCustomFunc(const MathFunctionF& resizeFunc, float radius)
+  {
+    return fog_api.imageresizer_setCustomFunc(this, &resizeFunc, radius);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Mode]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the resize mode, see @c IMAGE_RESIZE_MODE.
+  FOG_INLINE uint32_t getMode() const { return _mode; }
+
+  //! @brief Set the resize mode, see @c IMAGE_RESIZE_MODE.
+  FOG_INLINE err_t setMode(uint32_t mode)
+  {
+    return fog_api.imageresizer_setMode(this, mode);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Threads]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the maximum number of threads (zero means to use the number
+  //! of processors).
+  FOG_INLINE uint32_t getMaxThreads() const { return _maxThreads; }
+
+  //! @brief Set the maximum number of threads (including the calling thread).
+  //!
+  //! Use zero to set it to the number of processors, or one to disable the
+  //! multithreading.
+  FOG_INLINE err_t setMaxThreads(uint32_t maxThreads)
+  {
+    return fog_api.imageresizer_setMaxThreads(this, maxThreads);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Cache]
+  // --------------------------------------------------------------------------
+
+  //! @brief Release all cached weights.
+  FOG_INLINE void clearCache()
+  {
+    fog_api.imageresizer_clearCache(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Resize]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE err_t resize(Image& dst, const SizeI& dSize, const Image& src)
+  {
+    return fog_api.imageresizer_resize(this, &dst, &dSize, &src, NULL);
+  }
+
+  FOG_INLINE err_t resize(Image& dst, const SizeI& dSize, const Image& src, const RectI& sFragment)
+  {
+    return fog_api.imageresizer_resize(this, &dst, &dSize, &src, &sFragment);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The resize function.
+  uint32_t _resizeFunc;
+  //! @brief The resize mode.
+  uint32_t _mode;
+  //! @brief The maximum number of threads.
+  uint32_t _maxThreads;
+  //! @brief Reserved for future use.
+  uint32_t _reserved;
+
+  //! @brief Private data (weights cache, resize function and pooled threads).
+  ImageResizerData* _d;
+
+private:
+  FOG_NO_COPY(ImageResizer)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_IMAGING_IMAGERESIZER_H
@@ -119,6 +119,7 @@ static err_t FOG_CDECL Image_MacCG_create(ImageData** pd, const SizeI* size, uin
   d->data = (uint8_t*)( ((size_t)d + sizeof(ImageData) + 15) & ~(size_t)15 );
   d->first = d->data;
   d->stride = stride;
+  d->mipmap = NULL;
 
   CGColorSpaceRef cgColorSpace = CGColorSpaceCreateDeviceRGB();
   if (cgColorSpace == NULL)
@@ -171,6 +171,7 @@ static err_t FOG_CDECL Image_WinDib_create(ImageData** pd, const SizeI* size, ui
   d->data = bits;
   d->first = bits;
   d->stride = stride;
+  d->mipmap = NULL;
 
   d->palette.init();
   d->hBitmap = hBitmap;
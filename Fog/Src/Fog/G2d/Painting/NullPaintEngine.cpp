@@ -689,6 +689,28 @@ static err_t FOG_CDECL MyPaintEngine_paintGroup(Painter* self)
   return ERR_RT_NOT_IMPLEMENTED;
 }
 
+// ============================================================================
+// [Fog::MyPaintEngine - Picture]
+// ============================================================================
+
+static err_t FOG_CDECL MyPaintEngine_beginPicture(Painter* self, uint32_t flags)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_endPicture(Painter* self, Picture* picture)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_paintPicture(Painter* self, const Picture* picture)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
 // ============================================================================
 // [Fog::MyPaintEngine - Flush]
 // ============================================================================
@@ -909,6 +931,14 @@ static void MyPaintEngine_init()
   v->beignGroup = MyPaintEngine_beginGroup;
   v->paintGroup = MyPaintEngine_paintGroup;
 
+  // --------------------------------------------------------------------------
+  // [Picture]
+  // --------------------------------------------------------------------------
+
+  v->beginPicture = MyPaintEngine_beginPicture;
+  v->endPicture = MyPaintEngine_endPicture;
+  v->paintPicture = MyPaintEngine_paintPicture;
+
   // --------------------------------------------------------------------------
   // [Flush]
   // --------------------------------------------------------------------------
@@ -1261,6 +1291,25 @@ static err_t FOG_CDECL NullPaintEngine_paintGroup(Painter* self)
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::NullPaintEngine - Picture]
+// ============================================================================
+
+static err_t FOG_CDECL NullPaintEngine_beginPicture(Painter* self, uint32_t flags)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_CDECL NullPaintEngine_endPicture(Painter* self, Picture* picture)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_CDECL NullPaintEngine_paintPicture(Painter* self, const Picture* picture)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
 // ============================================================================
 // [Fog::NullPaintEngine - Flush]
 // ============================================================================
@@ -1489,6 +1538,14 @@ FOG_NO_EXPORT void NullPaintEngine_init()
   v->beginGroup = NullPaintEngine_beginGroup;
   v->paintGroup = NullPaintEngine_paintGroup;
 
+  // --------------------------------------------------------------------------
+  // [Picture]
+  // --------------------------------------------------------------------------
+
+  v->beginPicture = NullPaintEngine_beginPicture;
+  v->endPicture = NullPaintEngine_endPicture;
+  v->paintPicture = NullPaintEngine_paintPicture;
+
   // --------------------------------------------------------------------------
   // [Flush]
   // --------------------------------------------------------------------------
@@ -404,6 +404,22 @@ struct FOG_NO_EXPORT PaintEngineVTable
   BeginGroup beginGroup;
   PaintGroup paintGroup;
 
+  // --------------------------------------------------------------------------
+  // [Types - Picture]
+  // --------------------------------------------------------------------------
+
+  typedef err_t (FOG_CDECL *BeginPicture)(Painter* self, uint32_t flags);
+  typedef err_t (FOG_CDECL *EndPicture)(Painter* self, Picture* picture);
+  typedef err_t (FOG_CDECL *PaintPicture)(Painter* self, const Picture* picture);
+
+  // --------------------------------------------------------------------------
+  // [Funcs - Picture]
+  // --------------------------------------------------------------------------
+
+  BeginPicture beginPicture;
+  EndPicture endPicture;
+  PaintPicture paintPicture;
+
   // --------------------------------------------------------------------------
   // [Types - Flush]
   // --------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 
 // [Dependencies]
 #include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Memory/MemOps.h>
 #include <Fog/G2d/Geometry/PathStroker.h>
 #include <Fog/G2d/Source/Color.h>
 #include <Fog/G2d/Source/Pattern.h>
@@ -38,6 +39,7 @@ union FOG_NO_EXPORT PaintHints
     outlinedText = 0;
     geometricPrecision = GEOMETRIC_PRECISION_NORMAL;
     fillRule = FILL_RULE_DEFAULT;
+    pathRasterizer = PATH_RASTERIZER_DEFAULT;
     reserved = 0;
   }
 
@@ -55,7 +57,8 @@ union FOG_NO_EXPORT PaintHints
     uint32_t fastLine : 1;
     uint32_t geometricPrecision : 1;
     uint32_t fillRule : 1;
-    uint32_t reserved : 8;
+    uint32_t pathRasterizer : 2;
+    uint32_t reserved : 6;
   };
 
   uint32_t packed;
@@ -284,6 +287,104 @@ struct FOG_NO_EXPORT PaintParamsD
   PaintHints _hints;
 };
 
+// ============================================================================
+// [Fog::PaintProfile]
+// ============================================================================
+
+//! @brief Render-time profile of the paint-engine.
+//!
+//! The profile is collected only if the Fog-Framework was compiled with
+//! @c FOG_BUILD_PROFILER and profiling was enabled by @c Painter::setProfiler().
+//! Times are in microseconds. In multithreaded mode the counters and times of
+//! all workers are summed, so a shape rasterized by more workers is counted
+//! more times.
+struct FOG_NO_EXPORT PaintProfile
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE PaintProfile()
+  {
+    reset();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get count of pixels composited by all operators to all formats.
+  FOG_INLINE uint64_t getPixelsTotal() const
+  {
+    uint64_t total = 0;
+
+    for (uint i = 0; i < COMPOSITE_COUNT; i++)
+      for (uint j = 0; j < IMAGE_FORMAT_COUNT; j++)
+        total += pixels[i][j];
+
+    return total;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Reset]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void reset()
+  {
+    MemOps::zero(this, sizeof(PaintProfile));
+  }
+
+  // --------------------------------------------------------------------------
+  // [Operator Overload]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE PaintProfile& operator+=(const PaintProfile& other)
+  {
+    pathSegments += other.pathSegments;
+    cells += other.cells;
+    spans += other.spans;
+    groupLayers += other.groupLayers;
+
+    for (uint i = 0; i < COMPOSITE_COUNT; i++)
+      for (uint j = 0; j < IMAGE_FORMAT_COUNT; j++)
+        pixels[i][j] += other.pixels[i][j];
+
+    strokeTime += other.strokeTime;
+    clipTime += other.clipTime;
+    rasterizeTime += other.rasterizeTime;
+    compositeTime += other.compositeTime;
+
+    return *this;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Count of path segments passed to the path rasterizer.
+  uint64_t pathSegments;
+  //! @brief Count of cells produced by the path rasterizer.
+  uint64_t cells;
+  //! @brief Count of spans passed to the compositor.
+  uint64_t spans;
+  //! @brief Count of layers allocated by groups and pictures.
+  uint64_t groupLayers;
+
+  //! @brief Count of composited pixels per compositing operator and format
+  //! of the destination.
+  uint64_t pixels[COMPOSITE_COUNT][IMAGE_FORMAT_COUNT];
+
+  //! @brief Time spent in path stroker (microseconds).
+  int64_t strokeTime;
+  //! @brief Time spent in path clipper (microseconds).
+  int64_t clipTime;
+  //! @brief Time spent in rasterizer (microseconds).
+  int64_t rasterizeTime;
+  //! @brief Time spent in compositing, including the scanline sweep
+  //! (microseconds).
+  int64_t compositeTime;
+};
+
 //! @}
 
 } // Fog namespace
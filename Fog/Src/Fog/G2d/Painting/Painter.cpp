@@ -15,7 +15,9 @@
 namespace Fog {
 
 FOG_NO_EXPORT void NullPaintEngine_init(void);
+FOG_NO_EXPORT void Picture_init(void);
 FOG_NO_EXPORT void RasterPaintEngine_init(void);
+FOG_NO_EXPORT void RasterPaintEngine_fini(void);
 
 // ============================================================================
 // [Init / Fini]
@@ -24,7 +26,13 @@ FOG_NO_EXPORT void RasterPaintEngine_init(void);
 FOG_NO_EXPORT void Painter_init(void)
 {
   NullPaintEngine_init();
+  Picture_init();
   RasterPaintEngine_init();
 }
 
+FOG_NO_EXPORT void Painter_fini(void)
+{
+  RasterPaintEngine_fini();
+}
+
 } // Fog namespace
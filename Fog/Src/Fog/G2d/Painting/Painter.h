@@ -30,6 +30,7 @@
 #include <Fog/G2d/Imaging/ImageFilter.h>
 #include <Fog/G2d/Painting/PaintEngine.h>
 #include <Fog/G2d/Painting/PaintParams.h>
+#include <Fog/G2d/Painting/Picture.h>
 
 namespace Fog {
 
@@ -503,6 +504,28 @@ struct FOG_NO_EXPORT Painter
     return _vtable->resetParameter(this, PAINTER_PARAMETER_GEOMETRIC_PRECISION_I);
   }
 
+  // --------------------------------------------------------------------------
+  // [Parameters - Paint Hints - Path Rasterizer Hint]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the path-rasterizer hint, see @c PATH_RASTERIZER.
+  FOG_INLINE err_t getPathRasterizerHint(uint32_t& val) const
+  {
+    return _vtable->getParameter(this, PAINTER_PARAMETER_PATH_RASTERIZER_I, &val);
+  }
+
+  //! @brief Set the path-rasterizer hint, see @c PATH_RASTERIZER.
+  FOG_INLINE err_t setPathRasterizerHint(uint32_t val)
+  {
+    return _vtable->setParameter(this, PAINTER_PARAMETER_PATH_RASTERIZER_I, &val);
+  }
+
+  //! @brief Reset the path-rasterizer hint.
+  FOG_INLINE err_t resetPathRasterizerHint()
+  {
+    return _vtable->resetParameter(this, PAINTER_PARAMETER_PATH_RASTERIZER_I);
+  }
+
   // --------------------------------------------------------------------------
   // [Parameters - Paint Opacity]
   // --------------------------------------------------------------------------
@@ -840,6 +863,43 @@ struct FOG_NO_EXPORT Painter
     return _vtable->resetParameter(this, PAINTER_PARAMETER_FILTER_SCALE_F);
   }
 
+  // --------------------------------------------------------------------------
+  // [Parameters - Profiler]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get whether the render-time profiler is enabled.
+  FOG_INLINE err_t getProfiler(uint32_t& val) const
+  {
+    return _vtable->getParameter(this, PAINTER_PARAMETER_PROFILER_I, &val);
+  }
+
+  //! @brief Enable or disable the render-time profiler.
+  //!
+  //! The profile and trace are kept until @c resetProfile() is called.
+  FOG_INLINE err_t setProfiler(uint32_t val)
+  {
+    return _vtable->setParameter(this, PAINTER_PARAMETER_PROFILER_I, &val);
+  }
+
+  //! @brief Get the profile collected since the last @c resetProfile().
+  FOG_INLINE err_t getProfile(PaintProfile& profile) const
+  {
+    return _vtable->getParameter(this, PAINTER_PARAMETER_PROFILE, &profile);
+  }
+
+  //! @brief Get the trace collected since the last @c resetProfile(), the
+  //! output is JSON which can be loaded by chrome://tracing.
+  FOG_INLINE err_t getProfileTrace(StringA& trace) const
+  {
+    return _vtable->getParameter(this, PAINTER_PARAMETER_PROFILE_TRACE, &trace);
+  }
+
+  //! @brief Reset the collected profile and trace.
+  FOG_INLINE err_t resetProfile()
+  {
+    return _vtable->resetParameter(this, PAINTER_PARAMETER_PROFILE);
+  }
+
   // --------------------------------------------------------------------------
   // [Source - Type]
   // --------------------------------------------------------------------------
@@ -1470,6 +1530,27 @@ struct FOG_NO_EXPORT Painter
   FOG_INLINE err_t beginGroup(uint32_t flags = NO_FLAGS) { return _vtable->beginGroup(this, flags); }
   FOG_INLINE err_t paintGroup() { return _vtable->paintGroup(this); }
 
+  // --------------------------------------------------------------------------
+  // [Picture]
+  // --------------------------------------------------------------------------
+
+  //! @brief Begin recording of a @c Picture.
+  //!
+  //! All paint commands until @c endPicture() are recorded instead of being
+  //! rendered. The states of the painter (transform, source, clip, ...) are
+  //! preserved across the recording, the same way as in @c beginGroup().
+  FOG_INLINE err_t beginPicture(uint32_t flags = NO_FLAGS) { return _vtable->beginPicture(this, flags); }
+
+  //! @brief End recording of a @c Picture, the recorded commands are moved
+  //! to @a picture.
+  FOG_INLINE err_t endPicture(Picture& picture) { return _vtable->endPicture(this, &picture); }
+
+  //! @brief Replay the commands recorded in @a picture.
+  //!
+  //! The picture is replayed in device coordinates of the painter it was
+  //! recorded by, the current transform of the painter is not used.
+  FOG_INLINE err_t paintPicture(const Picture& picture) { return _vtable->paintPicture(this, &picture); }
+
   // --------------------------------------------------------------------------
   // [Flush]
   // --------------------------------------------------------------------------
@@ -0,0 +1,98 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/G2d/Painting/Picture.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::Picture - Global]
+// ============================================================================
+
+static Static<PictureData> Picture_dEmpty;
+
+// ============================================================================
+// [Fog::Picture - Construction / Destruction]
+// ============================================================================
+
+static void FOG_CDECL Picture_ctor(Picture* self)
+{
+  self->_d = Picture_dEmpty->addRef();
+}
+
+static void FOG_CDECL Picture_ctorCopy(Picture* self, const Picture* other)
+{
+  self->_d = other->_d->addRef();
+}
+
+static void FOG_CDECL Picture_dtor(Picture* self)
+{
+  PictureData* d = self->_d;
+
+  if (d != NULL)
+    d->release();
+}
+
+// ============================================================================
+// [Fog::Picture - Reset]
+// ============================================================================
+
+static void FOG_CDECL Picture_reset(Picture* self)
+{
+  atomicPtrXchg(&self->_d, Picture_dEmpty->addRef())->release();
+}
+
+// ============================================================================
+// [Fog::Picture - Copy]
+// ============================================================================
+
+static err_t FOG_CDECL Picture_copy(Picture* self, const Picture* other)
+{
+  atomicPtrXchg(&self->_d, other->_d->addRef())->release();
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Picture_init(void)
+{
+  // --------------------------------------------------------------------------
+  // [Funcs]
+  // --------------------------------------------------------------------------
+
+  fog_api.picture_ctor = Picture_ctor;
+  fog_api.picture_ctorCopy = Picture_ctorCopy;
+  fog_api.picture_dtor = Picture_dtor;
+  fog_api.picture_reset = Picture_reset;
+  fog_api.picture_copy = Picture_copy;
+
+  // NOTE: The command stream is specific to the paint-engine which recorded
+  // the picture, so 'picture_dFree' is initialized by RasterPaintEngine_init().
+
+  // --------------------------------------------------------------------------
+  // [Data]
+  // --------------------------------------------------------------------------
+
+  PictureData* d = &Picture_dEmpty;
+
+  d->reference.init(1);
+  d->format = IMAGE_FORMAT_NULL;
+  d->boundingBox.reset();
+  d->isSrcOver = true;
+  d->memorySize = 0;
+  d->length = 0;
+  d->commands = NULL;
+}
+
+} // Fog namespace
@@ -0,0 +1,161 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_PICTURE_H
+#define _FOG_G2D_PAINTING_PICTURE_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/G2d/Geometry/Box.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::PictureData]
+// ============================================================================
+
+struct FOG_NO_EXPORT PictureData
+{
+  // --------------------------------------------------------------------------
+  // [AddRef / Release]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE PictureData* addRef() const
+  {
+    reference.inc();
+    return const_cast<PictureData*>(this);
+  }
+
+  FOG_INLINE void release()
+  {
+    if (reference.deref())
+      fog_api.picture_dFree(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reference count.
+  mutable Atomic<size_t> reference;
+
+  //! @brief Format of the image the picture was recorded to (see @c IMAGE_FORMAT).
+  uint32_t format;
+
+  //! @brief Bounding box of all recorded commands (in device coordinates).
+  BoxI boundingBox;
+
+  //! @brief Whether all recorded commands use @c COMPOSITE_SRC_OVER.
+  uint32_t isSrcOver;
+
+  //! @brief Approximate count of bytes retained by the picture (commands,
+  //! pattern-contexts, paths and glyph-sets).
+  size_t memorySize;
+
+  //! @brief Size of the recorded command stream in bytes.
+  size_t length;
+  //! @brief Recorded command stream (engine specific, stored after the header).
+  uint8_t* commands;
+};
+
+// ============================================================================
+// [Fog::Picture]
+// ============================================================================
+
+//! @brief Picture (recorded sequence of paint commands).
+//!
+//! A picture is recorded by @c Painter::beginPicture() and
+//! @c Painter::endPicture() and can be replayed any number of times by
+//! @c Painter::paintPicture(). The recorded commands are already transformed
+//! and clipped (device coordinates), so replaying a picture skips all the
+//! work done by the painter before the rasterization.
+//!
+//! The picture is implicitly shared and immutable.
+struct FOG_NO_EXPORT Picture
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE Picture()
+  {
+    fog_api.picture_ctor(this);
+  }
+
+  FOG_INLINE Picture(const Picture& other)
+  {
+    fog_api.picture_ctorCopy(this, &other);
+  }
+
+  explicit FOG_INLINE Picture(PictureData* d) :
+    _d(d)
+  {
+  }
+
+  FOG_INLINE ~Picture()
+  {
+    fog_api.picture_dtor(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Sharing]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE size_t getReference() const { return _d->reference.get(); }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get whether the picture contains no visible command.
+  FOG_INLINE bool isEmpty() const { return _d->length == 0; }
+
+  //! @brief Get the image format the picture was recorded to.
+  FOG_INLINE uint32_t getFormat() const { return _d->format; }
+
+  //! @brief Get the bounding box of the picture (device coordinates).
+  FOG_INLINE const BoxI& getBoundingBox() const { return _d->boundingBox; }
+
+  //! @brief Get the approximate count of bytes retained by the picture.
+  FOG_INLINE size_t getMemorySize() const { return _d->memorySize; }
+
+  FOG_INLINE err_t setPicture(const Picture& other)
+  {
+    return fog_api.picture_copy(this, &other);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Reset]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void reset()
+  {
+    fog_api.picture_reset(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Operator Overload]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE Picture& operator=(const Picture& other) { setPicture(other); return *this; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  _FOG_CLASS_D(PictureData)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_PICTURE_H
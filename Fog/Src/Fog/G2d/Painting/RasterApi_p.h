@@ -42,6 +42,11 @@ struct BoxRasterizer16;
 
 struct PathRasterizer8;
 struct PathRasterizer16;
+struct DensePathRasterizer8;
+
+struct GlyphRasterizer8;
+struct HairlineRasterizer8;
+struct AliasedRasterizer8;
 
 struct RasterFiller;
 struct RasterScanline8;
@@ -54,6 +59,10 @@ union RasterSolid;
 struct RasterPattern;
 struct RasterPatternFetcher;
 
+struct RasterGlyph8;
+struct RasterGlyphItem8;
+struct RasterGlyphCache;
+
 struct RasterFilter;
 struct RasterFilterBlur;
 struct RasterFilterImage;
@@ -326,6 +335,7 @@ struct FOG_NO_EXPORT RasterTextureFuncs
 
     RasterPatternFetchFunc fetch_affine_nearest[IMAGE_FORMAT_COUNT][TEXTURE_TILE_COUNT];
     RasterPatternFetchFunc fetch_affine_bilinear[IMAGE_FORMAT_COUNT][TEXTURE_TILE_COUNT];
+    RasterPatternFetchFunc fetch_affine_bicubic[IMAGE_FORMAT_COUNT][TEXTURE_TILE_COUNT];
 
     RasterPatternFetchFunc fetch_proj_nearest[IMAGE_FORMAT_COUNT][TEXTURE_TILE_COUNT];
     RasterPatternFetchFunc fetch_proj_bilinear[IMAGE_FORMAT_COUNT][TEXTURE_TILE_COUNT];
@@ -0,0 +1,314 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/G2d/Painting/RasterClipMask_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RasterClipMask8 - Destroy]
+// ============================================================================
+
+void RasterClipMask8::destroy(RasterClipMask8* self)
+{
+  // The scanline table and the span/mask data are allocated together with
+  // the mask.
+  MemMgr::free(self);
+}
+
+// ============================================================================
+// [Fog::RasterClipMaskBuilder8 - Filler]
+// ============================================================================
+
+static void FOG_FASTCALL RasterClipMaskBuilder8_prepare(RasterClipMaskBuilder8* self, int y)
+{
+  self->_y = y;
+}
+
+static void FOG_FASTCALL RasterClipMaskBuilder8_skip(RasterClipMaskBuilder8* self, int step)
+{
+  self->_y += step;
+}
+
+static void FOG_FASTCALL RasterClipMaskBuilder8_process(RasterClipMaskBuilder8* self, RasterSpan8* spans)
+{
+  int y = self->_y++;
+
+  if (FOG_IS_ERROR(self->_error))
+    return;
+
+  FOG_ASSERT(y >= self->_sceneBox.y0 && y < self->_sceneBox.y1);
+
+  // --------------------------------------------------------------------------
+  // [Measure]
+  // --------------------------------------------------------------------------
+
+  const RasterSpan8* span;
+  size_t count = 0;
+  size_t maskSize = 0;
+
+  for (span = spans; span != NULL; span = span->getNext())
+  {
+    if (span->isConst())
+    {
+      // Fully transparent spans are not stored, the mask is sparse.
+      if (span->getConstMask() == 0)
+        continue;
+    }
+    else
+    {
+      maskSize += (size_t)span->getLength();
+    }
+    count++;
+  }
+
+  if (count == 0)
+    return;
+
+  size_t spanSize = count * sizeof(RasterSpan8);
+  size_t rowSize = spanSize + ((maskSize + sizeof(void*) - 1) & ~(sizeof(void*) - 1));
+
+  if (self->_dataCapacity - self->_dataSize < rowSize)
+  {
+    size_t capacity = Math::max<size_t>(self->_dataCapacity * 2, 4096);
+    while (capacity - self->_dataSize < rowSize)
+      capacity *= 2;
+
+    uint8_t* data = reinterpret_cast<uint8_t*>(MemMgr::realloc(self->_data, capacity));
+    if (FOG_IS_NULL(data))
+    {
+      self->_error = ERR_RT_OUT_OF_MEMORY;
+      return;
+    }
+
+    self->_data = data;
+    self->_dataCapacity = capacity;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Copy]
+  // --------------------------------------------------------------------------
+
+  size_t rowOffset = self->_dataSize;
+  size_t maskOffset = rowOffset + spanSize;
+
+  RasterSpan8* dst = reinterpret_cast<RasterSpan8*>(self->_data + rowOffset);
+  uint8_t* dstMask = self->_data + maskOffset;
+
+  int x0 = INT_MAX;
+  int x1 = 0;
+  bool isBoxRow = (count == 1);
+
+  for (span = spans; span != NULL; span = span->getNext())
+  {
+    int sx0 = span->getX0();
+    int sx1 = span->getX1();
+
+    if (span->isConst())
+    {
+      uint32_t cMask = span->getConstMask();
+      if (cMask == 0)
+        continue;
+
+      dst->setPositionAndType(sx0, sx1, RASTER_SPAN_C);
+      dst->setConstMask(cMask);
+
+      isBoxRow &= (cMask == 0x100);
+    }
+    else
+    {
+      uint i, w = (uint)(sx1 - sx0);
+      const uint8_t* srcMask = span->getVariantMask();
+
+      switch (span->getType())
+      {
+        case RASTER_SPAN_A8_GLYPH:
+        case RASTER_SPAN_AX_GLYPH:
+          MemOps::copy(dstMask, srcMask, w);
+          break;
+
+        case RASTER_SPAN_AX_EXTRA:
+          // Convert 0..256 into 0..255, the mask is expanded back when used.
+          for (i = 0; i < w; i++)
+          {
+            uint32_t m = reinterpret_cast<const uint16_t*>(srcMask)[i];
+            dstMask[i] = (uint8_t)(m - (m >> 8));
+          }
+          break;
+
+        default:
+          FOG_ASSERT_NOT_REACHED();
+      }
+
+      // Relocated to the pointer by finalize().
+      dst->setPositionAndType(sx0, sx1, RASTER_SPAN_A8_GLYPH);
+      dst->_mask_uint = maskOffset;
+
+      dstMask += w;
+      maskOffset += w;
+      isBoxRow = false;
+    }
+
+    if (sx0 < x0) x0 = sx0;
+    if (sx1 > x1) x1 = sx1;
+
+    // Relocated to the pointer by finalize(), only the last span has NULL.
+    dst->setData(NULL);
+    dst->setNext(reinterpret_cast<RasterSpan*>((size_t)1));
+    dst++;
+  }
+
+  dst[-1].setNext(NULL);
+
+  self->_rowOffset[y - self->_sceneBox.y0] = rowOffset + 1;
+  self->_dataSize += rowSize;
+
+  // --------------------------------------------------------------------------
+  // [Bounds]
+  // --------------------------------------------------------------------------
+
+  BoxI& bBox = self->_boundingBox;
+
+  if (!bBox.isValid())
+  {
+    bBox.setBox(x0, y, x1, y + 1);
+    self->_isBox = isBoxRow;
+  }
+  else
+  {
+    // The mask is a box only if all scanlines are the same and there is no
+    // gap between them.
+    if (!isBoxRow || bBox.y1 != y || bBox.x0 != x0 || bBox.x1 != x1)
+      self->_isBox = false;
+
+    if (x0 < bBox.x0) bBox.x0 = x0;
+    if (x1 > bBox.x1) bBox.x1 = x1;
+    bBox.y1 = y + 1;
+  }
+}
+
+// ============================================================================
+// [Fog::RasterClipMaskBuilder8 - Construction / Destruction]
+// ============================================================================
+
+RasterClipMaskBuilder8::RasterClipMaskBuilder8() :
+  _sceneBox(0, 0, 0, 0),
+  _boundingBox(0, 0, 0, 0),
+  _y(0),
+  _isBox(false),
+  _error(ERR_OK),
+  _rowOffset(NULL),
+  _data(NULL),
+  _dataSize(0),
+  _dataCapacity(0)
+{
+  _prepare = (RasterFiller::PrepareFunc)RasterClipMaskBuilder8_prepare;
+  _process = (RasterFiller::ProcessFunc)RasterClipMaskBuilder8_process;
+  _skip = (RasterFiller::SkipFunc)RasterClipMaskBuilder8_skip;
+}
+
+RasterClipMaskBuilder8::~RasterClipMaskBuilder8()
+{
+  if (_rowOffset != NULL)
+    MemMgr::free(_rowOffset);
+
+  if (_data != NULL)
+    MemMgr::free(_data);
+}
+
+// ============================================================================
+// [Fog::RasterClipMaskBuilder8 - Init / Finalize]
+// ============================================================================
+
+err_t RasterClipMaskBuilder8::init(const BoxI& sceneBox)
+{
+  FOG_ASSERT(sceneBox.isValid());
+  FOG_ASSERT(_rowOffset == NULL);
+
+  size_t rowsSize = (size_t)(uint)sceneBox.getHeight() * sizeof(size_t);
+
+  _rowOffset = reinterpret_cast<size_t*>(MemMgr::calloc(rowsSize));
+  if (FOG_IS_NULL(_rowOffset))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  _sceneBox = sceneBox;
+  _boundingBox.reset();
+  _y = sceneBox.y0;
+  _isBox = false;
+  _error = ERR_OK;
+
+  return ERR_OK;
+}
+
+err_t RasterClipMaskBuilder8::finalize(RasterClipMask8** dst)
+{
+  *dst = NULL;
+
+  if (FOG_IS_ERROR(_error))
+    return _error;
+
+  if (!_boundingBox.isValid())
+    return ERR_OK;
+
+  uint i, h = (uint)_boundingBox.getHeight();
+  size_t rowsSize = h * sizeof(RasterSpan8*);
+
+  RasterClipMask8* mask = reinterpret_cast<RasterClipMask8*>(
+    MemMgr::alloc(sizeof(RasterClipMask8) + rowsSize + _dataSize));
+
+  if (FOG_IS_NULL(mask))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  const RasterSpan8** rows = reinterpret_cast<const RasterSpan8**>(mask + 1);
+  uint8_t* data = reinterpret_cast<uint8_t*>(rows + h);
+
+  mask->_reference.init(1);
+  mask->_boundingBox = _boundingBox;
+  mask->_rows = rows;
+  mask->_dataSize = _dataSize;
+
+  MemOps::copy(data, _data, _dataSize);
+
+  // Relocate all offsets to pointers.
+  const size_t* rowOffset = _rowOffset + (_boundingBox.y0 - _sceneBox.y0);
+
+  for (i = 0; i < h; i++)
+  {
+    if (rowOffset[i] == 0)
+    {
+      rows[i] = NULL;
+      continue;
+    }
+
+    RasterSpan8* span = reinterpret_cast<RasterSpan8*>(data + rowOffset[i] - 1);
+    rows[i] = span;
+
+    for (;;)
+    {
+      if (span->isVariant())
+        span->_mask = data + span->_mask_uint;
+
+      if (span->_next == NULL)
+        break;
+
+      span->setNext(span + 1);
+      span++;
+    }
+  }
+
+  *dst = mask;
+  return ERR_OK;
+}
+
+} // Fog namespace
@@ -0,0 +1,176 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERCLIPMASK_P_H
+#define _FOG_G2D_PAINTING_RASTERCLIPMASK_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/RasterSpan_p.h>
+#include <Fog/G2d/Painting/RasterStructs_p.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::RasterClipMask8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Raster clip-mask (8-bit).
+//!
+//! The clip-mask is a sparse A8 mask encoded per scanline as a list of
+//! @c RasterSpan8 instances. Each span is either @c RASTER_SPAN_C (const
+//! coverage) or @c RASTER_SPAN_A8_GLYPH (variable coverage). Pixels which are
+//! not covered by any span are fully clipped, scanlines without spans are
+//! stored as @c NULL.
+//!
+//! The clip-mask is immutable after it was created by @c RasterClipMaskBuilder8,
+//! so it can be shared (by reference) between the paint-engine states, the
+//! recorded commands and the workers. The rasterizers intersect the mask with
+//! their coverage during span generation (see @c Rasterizer8::setClipMask()).
+struct FOG_NO_EXPORT RasterClipMask8
+{
+  // --------------------------------------------------------------------------
+  // [Reference]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RasterClipMask8* addRef()
+  {
+    _reference.inc();
+    return this;
+  }
+
+  FOG_INLINE void release()
+  {
+    if (_reference.deref())
+      destroy(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const BoxI& getBoundingBox() const { return _boundingBox; }
+
+  //! @brief Get the spans of scanline @a y (or @c NULL if the scanline is
+  //! fully clipped).
+  FOG_INLINE const RasterSpan8* getSpans(int y) const
+  {
+    uint i = (uint)(y - _boundingBox.y0);
+    return i < (uint)_boundingBox.getHeight() ? _rows[i] : NULL;
+  }
+
+  //! @brief Get the scanline table, indexed by <code>y - boundingBox.y0</code>.
+  FOG_INLINE const RasterSpan8** getRows() const { return _rows; }
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  static void destroy(RasterClipMask8* self);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reference count.
+  Atomic<size_t> _reference;
+
+  //! @brief Bounding box of all spans (also the clip-box of the mask).
+  BoxI _boundingBox;
+  //! @brief Scanlines (spans per scanline).
+  const RasterSpan8** _rows;
+  //! @brief Size of the span/mask data (stored after the scanline table).
+  size_t _dataSize;
+};
+
+// ============================================================================
+// [Fog::RasterClipMaskBuilder8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler which collects the rasterizer output into a new
+//! @c RasterClipMask8.
+//!
+//! The builder is passed as a filler to any @c Rasterizer8, so the new mask
+//! is automatically intersected by the current clip (box, region or mask)
+//! of the rasterizer.
+struct FOG_NO_EXPORT RasterClipMaskBuilder8 : public RasterFiller
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterClipMaskBuilder8();
+  ~RasterClipMaskBuilder8();
+
+  // --------------------------------------------------------------------------
+  // [Init / Finalize]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the builder, @a sceneBox is the scene-box of the
+  //! rasterizer which will be used to build the mask.
+  err_t init(const BoxI& sceneBox);
+
+  //! @brief Create the clip-mask.
+  //!
+  //! Returns @c ERR_OK and sets @a dst to @c NULL if the mask is empty, the
+  //! returned mask has reference count set to one.
+  err_t finalize(RasterClipMask8** dst);
+
+  //! @brief Get whether the collected mask is a fully opaque rectangle (in
+  //! such case the paint-engine uses @c RASTER_CLIP_BOX instead).
+  FOG_INLINE bool isBox() const { return _isBox && _boundingBox.isValid(); }
+
+  //! @brief Get the bounding box of the collected mask.
+  FOG_INLINE const BoxI& getBoundingBox() const { return _boundingBox; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Scene-box.
+  BoxI _sceneBox;
+  //! @brief Bounding box of the collected spans.
+  BoxI _boundingBox;
+
+  //! @brief Current scanline.
+  int _y;
+  //! @brief Whether the collected mask is a fully opaque rectangle.
+  uint _isBox;
+  //! @brief Last error (out of memory).
+  err_t _error;
+
+  //! @brief Offset of the first span per scanline (in @c _data) plus one,
+  //! zero means that the scanline is empty.
+  size_t* _rowOffset;
+
+  //! @brief The span/mask data (spans use offsets instead of pointers until
+  //! finalized).
+  uint8_t* _data;
+  //! @brief The span/mask data size.
+  size_t _dataSize;
+  //! @brief The span/mask data capacity.
+  size_t _dataCapacity;
+
+private:
+  FOG_NO_COPY(RasterClipMaskBuilder8)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERCLIPMASK_P_H
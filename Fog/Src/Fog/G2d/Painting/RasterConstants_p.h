@@ -47,7 +47,74 @@ enum RASTER_CORE
   RASTER_MAX_THREADS_LIMIT = 64,
   // Maximum number of threads which may be suggested for rendering by the
   // raster painter engine.
-  RASTER_MAX_THREADS_SUGGESTED = 16
+  RASTER_MAX_THREADS_SUGGESTED = 16,
+
+  // Maximum number of paint commands recorded by the multithreaded paint
+  // engine before the batch is rendered.
+  RASTER_MAX_COMMANDS = 1024,
+
+  // --------------------------------------------------------------------------
+  // [Glyph Cache]
+  // --------------------------------------------------------------------------
+
+  // Number of subpixel positions per axis is (1 << RASTER_GLYPH_SUBPIXEL_SHIFT).
+  RASTER_GLYPH_SUBPIXEL_SHIFT = 2,
+  RASTER_GLYPH_SUBPIXEL_COUNT = 1 << RASTER_GLYPH_SUBPIXEL_SHIFT,
+
+  // Maximum font size (in device pixels) of glyphs stored in the glyph cache,
+  // larger glyphs are always rendered as outlines.
+  RASTER_GLYPH_MAX_SIZE = 128,
+
+  // Number of hash buckets used by the glyph cache.
+  RASTER_GLYPH_CACHE_BUCKETS = 2048,
+  // Maximum memory used by the glyph cache (masks and headers). If exceeded,
+  // the least recently used glyphs are released.
+  RASTER_GLYPH_CACHE_LIMIT = 4 * 1024 * 1024,
+
+  // --------------------------------------------------------------------------
+  // [Layer Pool]
+  // --------------------------------------------------------------------------
+
+  // Layer sizes are rounded up to size-classes, the size of each class is
+  // either (32 << n) or (48 << n) pixels.
+  RASTER_LAYER_POOL_MIN_SIZE = 32,
+  // Count of size-classes per axis, the largest pooled layer side is
+  // (32 << 9) == 16384 pixels, larger layers are never pooled.
+  RASTER_LAYER_POOL_CLASSES = 19,
+  // Maximum memory used by unused layers in the pool. If exceeded, the least
+  // recently used layers are released.
+  RASTER_LAYER_POOL_LIMIT = 32 * 1024 * 1024,
+
+  // --------------------------------------------------------------------------
+  // [Dense Rasterizer]
+  // --------------------------------------------------------------------------
+
+  // Preferred size of the accumulation buffer of one band (in bytes), the band
+  // height is derived from the width of the path.
+  RASTER_DENSE_BAND_SIZE = 64 * 1024,
+  // Maximum height of one band.
+  RASTER_DENSE_BAND_MAX_HEIGHT = 64,
+  // Count of cells resolved by one step of the sweep (the largest SIMD width),
+  // the accumulation buffer is padded so the sweep never needs a tail loop.
+  RASTER_DENSE_BLOCK = 16,
+
+  // Minimum count of path vertices to select the dense rasterizer.
+  RASTER_DENSE_MIN_VERTICES = 32,
+  // Maximum width of the path bounding-box to select the dense rasterizer.
+  RASTER_DENSE_MAX_WIDTH = 2048,
+  // The dense rasterizer is selected if the area of the path bounding-box per
+  // vertex is lower than this threshold (the cost of the cell rasterizer is
+  // driven by the vertices, the cost of the dense rasterizer by the area, see
+  // FogBench for the crossover).
+  RASTER_DENSE_AREA_PER_VERTEX = 512,
+
+  // --------------------------------------------------------------------------
+  // [Profiler]
+  // --------------------------------------------------------------------------
+
+  // Maximum count of trace events recorded per context, events recorded after
+  // the limit is reached are dropped (counters are still updated).
+  RASTER_PROFILE_TRACE_LIMIT = 65536
 };
 
 // ============================================================================
@@ -413,6 +480,12 @@ enum RASTER_PAINT_CMD
   //! @brief Do 'FillNormalizedPathD' command.
   RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D,
 
+  //! @brief Do 'FillNormalizedGlyphs' command.
+  RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS,
+
+  //! @brief Do 'DrawNormalizedHairlineF' command.
+  RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F,
+
   //! @brief Do 'BlitNormalizedImageA(DstPt, SrcImage, NULL)' command.
   RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A,
   //! @brief Do 'BlitNormalizedImageA(DstPt, SrcImage, SrcFragment)' command.
@@ -425,6 +498,8 @@ enum RASTER_PAINT_CMD
   RASTER_PAINT_CMD_SET_CLIP_BOX,
   //! @brief Do 'SetClipRegion' command.
   RASTER_PAINT_CMD_SET_CLIP_REGION,
+  //! @brief Do 'SetClipMask' command.
+  RASTER_PAINT_CMD_SET_CLIP_MASK,
 
   //! @brief Count of raster paint commands (for checking / asserts).
   RASTER_PAINT_CMD_COUNT
@@ -536,6 +611,10 @@ enum RASTER_GROUP
   //! serialization).
   RASTER_GROUP_DIRECT = 0x00000002,
 
+  //! @brief Whether the group records a @c Picture (the commands are not
+  //! rendered, they are moved to the picture by @c Painter::endPicture()).
+  RASTER_GROUP_PICTURE = 0x00000004,
+
   //! @brief Whether the group contains alpha-channel.
   RASTER_GROUP_ALPHA = 0x00000010,
 
@@ -729,6 +808,28 @@ enum RASTER_PRECISION
   RASTER_PRECISION_BOTH = 0x3
 };
 
+// ============================================================================
+// [Fog::RASTER_PROFILE]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Timed sections of the raster paint-engine profiler.
+enum RASTER_PROFILE
+{
+  //! @brief Stroking (@c PathStroker).
+  RASTER_PROFILE_STROKE = 0,
+  //! @brief Clipping (@c PathClipper).
+  RASTER_PROFILE_CLIP = 1,
+  //! @brief Rasterization (@c PathRasterizer8).
+  RASTER_PROFILE_RASTERIZE = 2,
+  //! @brief Compositing (scanline sweep and span compositing).
+  RASTER_PROFILE_COMPOSITE = 3,
+
+  //! @brief Count of timed sections.
+  RASTER_PROFILE_COUNT = 4
+};
+
 // ============================================================================
 // [Fog::RASTER_SOURCE]
 // ============================================================================
@@ -0,0 +1,449 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/G2d/Painting/RasterGlyphCache_p.h>
+#include <Fog/G2d/Painting/Rasterizer_p.h>
+#include <Fog/G2d/Painting/RasterScanline_p.h>
+#include <Fog/G2d/Painting/RasterSpan_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RasterGlyph8 - Destroy]
+// ============================================================================
+
+void RasterGlyph8::destroy(RasterGlyph8* self)
+{
+  self->_face->release();
+
+  // The mask is allocated together with the glyph.
+  MemMgr::free(self);
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Helpers]
+// ============================================================================
+
+static FOG_INLINE uint32_t RasterGlyphCache_getScaleBits(float scale)
+{
+  union { float f; uint32_t u; } bits;
+
+  bits.f = scale;
+  return bits.u;
+}
+
+static FOG_INLINE uint32_t RasterGlyphCache_hash(const Face* face, uint32_t scale, uint32_t glyphIndex, uint32_t subpixel)
+{
+  uint32_t h = (uint32_t)((size_t)face >> 4);
+
+  h = h * 31 + scale;
+  h = h * 31 + glyphIndex;
+  h = h * 31 + subpixel;
+
+  return h ^ (h >> 15);
+}
+
+//! @internal
+//!
+//! @brief Split the pen position into the integral and subpixel part.
+//!
+//! The subpixel part is rounded to the nearest subpixel position (which can
+//! carry into the integral part).
+static FOG_INLINE void RasterGlyphCache_splitPosition(double p, int& i, uint32_t& s)
+{
+  double f = Math::floor(p);
+
+  i = (int)f;
+  s = (uint32_t)Math::iround((p - f) * double(RASTER_GLYPH_SUBPIXEL_COUNT));
+
+  if (s == RASTER_GLYPH_SUBPIXEL_COUNT)
+  {
+    i++;
+    s = 0;
+  }
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Filler]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler which stores the rasterizer output into the glyph mask.
+struct FOG_NO_EXPORT RasterGlyphFiller8 : public RasterFiller
+{
+  //! @brief Glyph mask scanline (adjusted so it can be indexed by x).
+  uint8_t* row;
+  //! @brief Glyph mask stride.
+  ssize_t stride;
+
+  //! @brief Glyph mask.
+  uint8_t* mask;
+  //! @brief Glyph mask origin.
+  int x0, y0;
+};
+
+static void FOG_FASTCALL RasterGlyphFiller8_prepare(RasterGlyphFiller8* self, int y)
+{
+  self->row = self->mask + (y - self->y0) * self->stride - self->x0;
+}
+
+static void FOG_FASTCALL RasterGlyphFiller8_process(RasterGlyphFiller8* self, RasterSpan8* span)
+{
+  uint8_t* row = self->row;
+
+  do {
+    uint8_t* dst = row + span->getX0();
+    uint i, w = (uint)span->getLength();
+
+    switch (span->getType())
+    {
+      case RASTER_SPAN_C:
+      {
+        uint32_t m = span->getConstMask();
+        MemOps::set(dst, (uint8_t)(m - (m >> 8)), w);
+        break;
+      }
+
+      case RASTER_SPAN_A8_GLYPH:
+      case RASTER_SPAN_AX_GLYPH:
+        MemOps::copy(dst, span->getVariantMask(), w);
+        break;
+
+      case RASTER_SPAN_AX_EXTRA:
+      {
+        const uint16_t* src = reinterpret_cast<const uint16_t*>(span->getVariantMask());
+        for (i = 0; i < w; i++)
+          dst[i] = (uint8_t)(src[i] - (src[i] >> 8));
+        break;
+      }
+
+      default:
+        FOG_ASSERT_NOT_REACHED();
+    }
+
+    span = span->getNext();
+  } while (span != NULL);
+
+  self->row = row + self->stride;
+}
+
+static void FOG_FASTCALL RasterGlyphFiller8_skip(RasterGlyphFiller8* self, int step)
+{
+  self->row += self->stride * step;
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Rasterize]
+// ============================================================================
+
+static err_t RasterGlyphCache_rasterize(RasterGlyph8** dst,
+  const Font& font, uint32_t glyphIndex, uint32_t subpixel,
+  PathRasterizer8* rasterizer, RasterScanline8* scanline, PathF* path)
+{
+  const float subpixelScale = 1.0f / float(RASTER_GLYPH_SUBPIXEL_COUNT);
+
+  PointF offset(
+    float(subpixel & (RASTER_GLYPH_SUBPIXEL_COUNT - 1)) * subpixelScale,
+    float(subpixel >> RASTER_GLYPH_SUBPIXEL_SHIFT) * subpixelScale);
+  PointF position(0.0f, 0.0f);
+
+  FOG_RETURN_ON_ERROR(font.getOutlineFromGlyphRun(*path, CONTAINER_OP_REPLACE, offset, &glyphIndex, &position, 1));
+
+  BoxI box(0, 0, 0, 0);
+  BoxF pathBox;
+
+  if (!path->isEmpty() && path->getBoundingBox(pathBox) == ERR_OK)
+  {
+    // Math::ifloor() truncates towards zero, the outline is mostly above the
+    // baseline (negative y).
+    box.setBox((int)Math::floor(pathBox.x0), (int)Math::floor(pathBox.y0),
+               Math::iceil(pathBox.x1), Math::iceil(pathBox.y1));
+    if (!box.isValid())
+      box.setBox(0, 0, 0, 0);
+  }
+
+  uint w = (uint)box.getWidth();
+  uint h = (uint)box.getHeight();
+
+  RasterGlyph8* glyph = reinterpret_cast<RasterGlyph8*>(
+    MemMgr::alloc(sizeof(RasterGlyph8) + (size_t)w * h));
+
+  if (FOG_IS_NULL(glyph))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  glyph->_reference.init(1);
+  glyph->_hashNext = NULL;
+  glyph->_lruPrev = NULL;
+  glyph->_lruNext = NULL;
+
+  glyph->_face = font._d->face->addRef();
+  glyph->_scale = RasterGlyphCache_getScaleBits(font._d->scale);
+  glyph->_glyphIndex = glyphIndex;
+  glyph->_subpixel = subpixel;
+  glyph->_hashCode = RasterGlyphCache_hash(glyph->_face, glyph->_scale, glyphIndex, subpixel);
+
+  glyph->_x = box.x0;
+  glyph->_y = box.y0;
+  glyph->_w = (int)w;
+  glyph->_h = (int)h;
+
+  if (w != 0)
+  {
+    uint8_t* mask = reinterpret_cast<uint8_t*>(glyph + 1);
+    MemOps::zero(mask, (size_t)w * h);
+
+    // The rasterizer works in device space (non-negative coordinates), so the
+    // outline is translated to have the mask origin at [0, 0].
+    err_t err = path->translate(PointF(-float(box.x0), -float(box.y0)));
+    if (FOG_IS_ERROR(err))
+    {
+      glyph->release();
+      return err;
+    }
+
+    rasterizer->setSceneBox(BoxI(0, 0, (int)w, (int)h));
+    rasterizer->setOpacity(0x100);
+    rasterizer->setFillRule(FILL_RULE_NON_ZERO);
+
+    if (FOG_IS_ERROR(rasterizer->init()))
+    {
+      glyph->release();
+      return rasterizer->getError();
+    }
+
+    rasterizer->addPath(*path);
+    rasterizer->finalize();
+
+    if (rasterizer->isValid())
+    {
+      RasterGlyphFiller8 filler;
+
+      filler._prepare = (RasterFiller::PrepareFunc)RasterGlyphFiller8_prepare;
+      filler._process = (RasterFiller::ProcessFunc)RasterGlyphFiller8_process;
+      filler._skip = (RasterFiller::SkipFunc)RasterGlyphFiller8_skip;
+
+      filler.row = NULL;
+      filler.stride = (ssize_t)w;
+      filler.mask = mask;
+      filler.x0 = 0;
+      filler.y0 = 0;
+
+      rasterizer->render(&filler, scanline);
+    }
+  }
+
+  *dst = glyph;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Construction / Destruction]
+// ============================================================================
+
+RasterGlyphCache::RasterGlyphCache() :
+  _lruFirst(NULL),
+  _lruLast(NULL),
+  _memoryUsed(0),
+  _memoryLimit(RASTER_GLYPH_CACHE_LIMIT)
+{
+  MemOps::zero(_buckets, sizeof(_buckets));
+}
+
+RasterGlyphCache::~RasterGlyphCache()
+{
+  clear();
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - LRU]
+// ============================================================================
+
+static FOG_INLINE void RasterGlyphCache_lruUnlink(RasterGlyphCache* self, RasterGlyph8* glyph)
+{
+  RasterGlyph8* prev = glyph->_lruPrev;
+  RasterGlyph8* next = glyph->_lruNext;
+
+  if (prev) prev->_lruNext = next; else self->_lruFirst = next;
+  if (next) next->_lruPrev = prev; else self->_lruLast = prev;
+}
+
+static FOG_INLINE void RasterGlyphCache_lruPrepend(RasterGlyphCache* self, RasterGlyph8* glyph)
+{
+  RasterGlyph8* first = self->_lruFirst;
+
+  glyph->_lruPrev = NULL;
+  glyph->_lruNext = first;
+
+  if (first) first->_lruPrev = glyph; else self->_lruLast = glyph;
+  self->_lruFirst = glyph;
+}
+
+static void RasterGlyphCache_evict(RasterGlyphCache* self)
+{
+  while (self->_memoryUsed > self->_memoryLimit && self->_lruLast != self->_lruFirst)
+  {
+    RasterGlyph8* glyph = self->_lruLast;
+    RasterGlyph8** pPrev = &self->_buckets[glyph->_hashCode % RASTER_GLYPH_CACHE_BUCKETS];
+
+    while (*pPrev != glyph)
+      pPrev = &(*pPrev)->_hashNext;
+    *pPrev = glyph->_hashNext;
+
+    RasterGlyphCache_lruUnlink(self, glyph);
+    self->_memoryUsed -= glyph->getMemoryUsage();
+
+    // Glyphs referenced by recorded commands are destroyed with the commands.
+    glyph->release();
+  }
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Interface]
+// ============================================================================
+
+err_t RasterGlyphCache::getGlyphs(RasterGlyphItem8* dst, size_t* dstLength, BoxI* dstBox,
+  const Font& font, const PointD& pt, const GlyphRun& glyphRun,
+  PathRasterizer8* rasterizer, RasterScanline8* scanline, PathF* tmpPath)
+{
+  size_t i, length = glyphRun.getLength();
+  size_t count = 0;
+
+  const GlyphItem* glyphs = glyphRun.getItemList().getData();
+  const GlyphPosition* positions = glyphRun.getPositionList().getData();
+
+  Face* face = font._d->face;
+  uint32_t scale = RasterGlyphCache_getScaleBits(font._d->scale);
+
+  BoxI bBox(INT_MAX, INT_MAX, INT_MIN, INT_MIN);
+
+  // Glyphs which are not in the cache are rasterized while the lock is held.
+  // It's rare when the cache is warm and it guarantees that each glyph is
+  // rasterized only once.
+  AutoLock locked(_lock);
+
+  for (i = 0; i < length; i++)
+  {
+    double px = pt.x + positions[i].getPosition().x;
+    double py = pt.y + positions[i].getPosition().y;
+
+    // Glyphs so far away are never visible, the check also protects the
+    // integer conversion below.
+    if (Math::abs(px) >= 1e8 || Math::abs(py) >= 1e8)
+      continue;
+
+    int ix, iy;
+    uint32_t sx, sy;
+
+    RasterGlyphCache_splitPosition(px, ix, sx);
+    RasterGlyphCache_splitPosition(py, iy, sy);
+
+    uint32_t glyphIndex = glyphs[i].getGlyphIndex();
+    uint32_t subpixel = (sy << RASTER_GLYPH_SUBPIXEL_SHIFT) | sx;
+    uint32_t hashCode = RasterGlyphCache_hash(face, scale, glyphIndex, subpixel);
+
+    RasterGlyph8* glyph = _buckets[hashCode % RASTER_GLYPH_CACHE_BUCKETS];
+    while (glyph != NULL)
+    {
+      if (glyph->_face == face && glyph->_scale == scale && glyph->_glyphIndex == glyphIndex && glyph->_subpixel == subpixel)
+        break;
+      glyph = glyph->_hashNext;
+    }
+
+    if (glyph != NULL)
+    {
+      RasterGlyphCache_lruUnlink(this, glyph);
+      RasterGlyphCache_lruPrepend(this, glyph);
+    }
+    else
+    {
+      err_t err = RasterGlyphCache_rasterize(&glyph, font, glyphIndex, subpixel, rasterizer, scanline, tmpPath);
+
+      if (FOG_IS_ERROR(err))
+      {
+        while (count)
+          dst[--count].glyph->release();
+        *dstLength = 0;
+        return err;
+      }
+
+      RasterGlyph8** pBucket = &_buckets[hashCode % RASTER_GLYPH_CACHE_BUCKETS];
+      glyph->_hashNext = *pBucket;
+      *pBucket = glyph;
+
+      RasterGlyphCache_lruPrepend(this, glyph);
+      _memoryUsed += glyph->getMemoryUsage();
+      RasterGlyphCache_evict(this);
+    }
+
+    if (glyph->isEmpty())
+      continue;
+
+    // Insert the item, keeping the list sorted by x. Glyphs are usually
+    // already sorted (left-to-right text), so it's mostly append.
+    int x = ix + glyph->_x;
+    int y = iy + glyph->_y;
+
+    size_t j = count++;
+    while (j > 0 && dst[j - 1].x > x)
+    {
+      dst[j] = dst[j - 1];
+      j--;
+    }
+
+    dst[j].x = x;
+    dst[j].y = y;
+    dst[j].glyph = glyph->addRef();
+
+    if (x < bBox.x0) bBox.x0 = x;
+    if (y < bBox.y0) bBox.y0 = y;
+    if (x + glyph->_w > bBox.x1) bBox.x1 = x + glyph->_w;
+    if (y + glyph->_h > bBox.y1) bBox.y1 = y + glyph->_h;
+  }
+
+  *dstLength = count;
+  if (count)
+    *dstBox = bBox;
+  else
+    dstBox->reset();
+
+  return ERR_OK;
+}
+
+void RasterGlyphCache::clear()
+{
+  AutoLock locked(_lock);
+
+  RasterGlyph8* glyph = _lruFirst;
+  while (glyph != NULL)
+  {
+    RasterGlyph8* next = glyph->_lruNext;
+    glyph->release();
+    glyph = next;
+  }
+
+  MemOps::zero(_buckets, sizeof(_buckets));
+
+  _lruFirst = NULL;
+  _lruLast = NULL;
+  _memoryUsed = 0;
+}
+
+// ============================================================================
+// [Fog::RasterGlyphCache - Statics]
+// ============================================================================
+
+FOG_NO_EXPORT Static<RasterGlyphCache> RasterGlyphCache_oInstance;
+
+} // Fog namespace
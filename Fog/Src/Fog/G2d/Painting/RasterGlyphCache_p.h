@@ -0,0 +1,200 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERGLYPHCACHE_P_H
+#define _FOG_G2D_PAINTING_RASTERGLYPHCACHE_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Geometry/Point.h>
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Text/Font.h>
+#include <Fog/G2d/Text/TextLayout.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::RasterGlyph8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Rasterized glyph (8-bit A8 coverage mask).
+//!
+//! The glyph is rasterized for one face, scale and subpixel offset, the mask
+//! box is relative to the integral pen position. The A8 mask is stored after
+//! the glyph header (in the same memory block), empty glyphs (space) have zero
+//! width and height.
+//!
+//! The glyph is immutable after it was created so it can be shared (by
+//! reference) between the glyph cache, the recorded commands and the workers.
+struct FOG_NO_EXPORT RasterGlyph8
+{
+  // --------------------------------------------------------------------------
+  // [Reference]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RasterGlyph8* addRef() const
+  {
+    _reference.inc();
+    return const_cast<RasterGlyph8*>(this);
+  }
+
+  FOG_INLINE void release() const
+  {
+    if (_reference.deref())
+      destroy(const_cast<RasterGlyph8*>(this));
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool isEmpty() const { return _w == 0; }
+
+  //! @brief Get the A8 mask (@c _w bytes per scanline, @c _h scanlines).
+  FOG_INLINE const uint8_t* getMask() const { return reinterpret_cast<const uint8_t*>(this + 1); }
+
+  //! @brief Get the size of memory used by the glyph.
+  FOG_INLINE size_t getMemoryUsage() const { return sizeof(RasterGlyph8) + (size_t)(uint)_w * (uint)_h; }
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  static void destroy(RasterGlyph8* self);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reference count.
+  mutable Atomic<size_t> _reference;
+
+  //! @brief Next glyph in the hash bucket (glyph cache).
+  RasterGlyph8* _hashNext;
+  //! @brief Previous glyph in the LRU list (glyph cache).
+  RasterGlyph8* _lruPrev;
+  //! @brief Next glyph in the LRU list (glyph cache).
+  RasterGlyph8* _lruNext;
+
+  //! @brief Face (referenced).
+  Face* _face;
+  //! @brief Scale used to get the outline from the design units (IEEE bits).
+  uint32_t _scale;
+  //! @brief Glyph index.
+  uint32_t _glyphIndex;
+  //! @brief Subpixel offset, (sy << RASTER_GLYPH_SUBPIXEL_SHIFT) | sx.
+  uint32_t _subpixel;
+  //! @brief Hash code of (face, scale, glyphIndex, subpixel).
+  uint32_t _hashCode;
+
+  //! @brief Mask offset (relative to the integral pen position).
+  int _x, _y;
+  //! @brief Mask size.
+  int _w, _h;
+};
+
+// ============================================================================
+// [Fog::RasterGlyphItem8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Glyph positioned in device space (used by @c GlyphRasterizer8).
+struct FOG_NO_EXPORT RasterGlyphItem8
+{
+  //! @brief Absolute position of the glyph mask.
+  int x, y;
+  //! @brief The glyph (never empty).
+  const RasterGlyph8* glyph;
+};
+
+// ============================================================================
+// [Fog::RasterGlyphCache]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Cache of rasterized glyphs, shared by all raster paint-engines.
+//!
+//! The glyphs are hashed by (face, scale, glyphIndex, subpixel) and kept in
+//! LRU order. If the memory used by the cache exceeds @c _memoryLimit then the
+//! least recently used glyphs are released. The cache only releases its own
+//! reference, glyphs used by pending paint commands stay alive until these
+//! commands are destroyed.
+struct FOG_NO_EXPORT RasterGlyphCache
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterGlyphCache();
+  ~RasterGlyphCache();
+
+  // --------------------------------------------------------------------------
+  // [Interface]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get rasterized glyphs of @a glyphRun.
+  //!
+  //! @param dst Items, at least @c glyphRun.getLength() long. Returned items
+  //! are referenced (must be released by the caller) and sorted by x.
+  //! @param dstLength Count of returned items (empty glyphs are not returned).
+  //! @param dstBox Bounding box of all returned items.
+  //! @param font The font (the font matrix has to be identity).
+  //! @param pt Pen position in device space.
+  //! @param glyphRun Glyphs and their positions relative to @a pt.
+  //! @param rasterizer Path rasterizer used to rasterize glyphs not in cache.
+  //! @param scanline Scanline used to rasterize glyphs not in cache.
+  //! @param tmpPath Temporary path.
+  err_t getGlyphs(RasterGlyphItem8* dst, size_t* dstLength, BoxI* dstBox,
+    const Font& font, const PointD& pt, const GlyphRun& glyphRun,
+    PathRasterizer8* rasterizer, RasterScanline8* scanline, PathF* tmpPath);
+
+  //! @brief Release all glyphs.
+  void clear();
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Lock.
+  Lock _lock;
+
+  //! @brief Hash buckets.
+  RasterGlyph8* _buckets[RASTER_GLYPH_CACHE_BUCKETS];
+
+  //! @brief The most recently used glyph.
+  RasterGlyph8* _lruFirst;
+  //! @brief The least recently used glyph.
+  RasterGlyph8* _lruLast;
+
+  //! @brief Memory used by cached glyphs.
+  size_t _memoryUsed;
+  //! @brief Memory limit.
+  size_t _memoryLimit;
+
+private:
+  FOG_NO_COPY(RasterGlyphCache)
+};
+
+extern FOG_NO_EXPORT Static<RasterGlyphCache> RasterGlyphCache_oInstance;
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERGLYPHCACHE_P_H
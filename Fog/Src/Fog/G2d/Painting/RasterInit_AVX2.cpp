@@ -0,0 +1,211 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/RasterInit_p.h>
+
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseConvert_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+#include <Fog/G2d/Painting/RasterOps_AVX2/CompositeBase_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/CompositeSrc_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/CompositeSrcOver_p.h>
+
+#include <Fog/G2d/Painting/RasterOps_AVX2/GradientLinear_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/GradientRadial_p.h>
+
+#include <Fog/G2d/Painting/RasterOps_AVX2/TextureAffine_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Install the AVX2 raster functions.
+//!
+//! Called after @c RasterOps_init_SSE2() so only the functions which have an
+//! AVX2 version are replaced, everything else keeps using the SSE2 (or C)
+//! implementation.
+FOG_NO_EXPORT void RasterOps_init_AVX2(void)
+{
+  ApiRaster& api = _api_raster;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - API]
+  // --------------------------------------------------------------------------
+
+  RasterConvertFuncs& convert = api.convert;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - Copy]
+  // --------------------------------------------------------------------------
+
+  convert.copy[RASTER_COPY_32] = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::copy_32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - BSwap]
+  // --------------------------------------------------------------------------
+
+  convert.bswap[RASTER_BSWAP_32] = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::bswap_32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - Premultiply / Demultiply]
+  // --------------------------------------------------------------------------
+
+  convert.prgb32_from_argb32 = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::prgb32_from_argb32;
+  convert.argb32_from_prgb32 = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::argb32_from_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - ARGB32]
+  // --------------------------------------------------------------------------
+
+  convert.argb32_from[RASTER_FORMAT_RGB32_888_BS       ] = RasterOps_AVX2::Convert::argb32_from_rgb32_888_bs;
+  convert.argb32_from[RASTER_FORMAT_ARGB32_8888_BS     ] = RasterOps_AVX2::Convert::argb32_from_argb32_8888_bs;
+
+  convert.from_argb32[RASTER_FORMAT_RGB32_888_BS       ] = RasterOps_AVX2::Convert::rgb32_888_bs_from_argb32;
+  convert.from_argb32[RASTER_FORMAT_ARGB32_8888_BS     ] = RasterOps_AVX2::Convert::argb32_8888_bs_from_argb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - PRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrc::prgb32_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrc::prgb32_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::Convert::copy_32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_xrgb32_line);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_XRGB32   ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_xrgb32_span);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_a8_span);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - XRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrc::prgb32_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrc::prgb32_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrc::prgb32_vblit_xrgb32_line);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_AVX2::Convert::copy_32);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - SrcOver - PRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC_OVER];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrcOver::prgb32_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrcOver::prgb32_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_a8_span);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - SrcOver - XRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC_OVER];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrcOver::prgb32_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_AVX2::CompositeSrcOver::prgb32_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A8       ], RasterOps_AVX2::CompositeSrcOver::prgb32_vblit_a8_span);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - API]
+  // --------------------------------------------------------------------------
+
+  RasterGradientFuncs& gradient = api.gradient;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Linear]
+  // --------------------------------------------------------------------------
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_pad_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_pad_prgb32;
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_repeat_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_repeat_prgb32;
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_reflect_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_AVX2::PGradientLinear::fetch_simple_nearest_reflect_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Radial]
+  // --------------------------------------------------------------------------
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_PAD>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_PAD>;
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_REPEAT>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_REPEAT>;
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_REFLECT>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_AVX2::PGradientRadial::fetch_simple_nearest_prgb32<GRADIENT_SPREAD_REFLECT>;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - API]
+  // --------------------------------------------------------------------------
+
+  RasterTextureFuncs& texture = api.texture;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - Affine]
+  // --------------------------------------------------------------------------
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_AVX2::PTextureAffine::fetch_affine_bilinear_pad<IMAGE_FORMAT_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_AVX2::PTextureAffine::fetch_affine_bilinear_pad<IMAGE_FORMAT_XRGB32>;
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_AVX2::PTextureAffine::fetch_affine_bilinear_repeat<IMAGE_FORMAT_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_AVX2::PTextureAffine::fetch_affine_bilinear_repeat<IMAGE_FORMAT_XRGB32>;
+}
+
+} // Fog namespace
@@ -1872,11 +1872,81 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
   texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
   texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
 
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
   // --------------------------------------------------------------------------
   // [RasterOps - Pattern - Texture - Projection]
   // --------------------------------------------------------------------------
 
-  // TODO: Texture-Projection fetcher.
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
 
 #endif // FOG_RASTER_INIT_C
 
@@ -917,6 +917,8 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ]);
   }
 
+  */
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Plus - PRGB32]
   // --------------------------------------------------------------------------
@@ -1255,12 +1257,12 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_prgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_xrgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_rgb24_line);
-    FOG_RASTER_SKIP(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_a8_line);
 
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_prgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_xrgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_rgb24_span);
-    FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeColorDodge::prgb32_vblit_a8_span);
   }
 
   // --------------------------------------------------------------------------
@@ -1301,12 +1303,12 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_prgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_xrgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_rgb24_line);
-    FOG_RASTER_SKIP(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_a8_line);
 
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_prgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_xrgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_rgb24_span);
-    FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeColorBurn::prgb32_vblit_a8_span);
   }
 
   // --------------------------------------------------------------------------
@@ -1347,12 +1349,12 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_prgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_xrgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_rgb24_line);
-    FOG_RASTER_SKIP(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_a8_line);
 
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_prgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_xrgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_rgb24_span);
-    FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeHardLight::prgb32_vblit_a8_span);
   }
 
   // --------------------------------------------------------------------------
@@ -1485,12 +1487,12 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_prgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_xrgb32_line);
     FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_rgb24_line);
-    FOG_RASTER_SKIP(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_a8_line);
 
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_PRGB32], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_prgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_XRGB32], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_xrgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_rgb24_span);
-    FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ]);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_PRGB32_AND_A8    ], RasterOps_SSE2::CompositeExclusion::prgb32_vblit_a8_span);
   }
 
   // --------------------------------------------------------------------------
@@ -1514,7 +1516,6 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_XRGB32_AND_XRGB32], RasterOps_SSE2::CompositeExclusion::xrgb32_vblit_xrgb32_span);
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ], RasterOps_SSE2::CompositeExclusion::xrgb32_vblit_rgb24_span);
   }
-  */
 
   // --------------------------------------------------------------------------
   // [RasterOps - Pattern - Solid]
@@ -1546,6 +1547,313 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
 
   gradient.interpolate[IMAGE_FORMAT_PRGB32] = RasterOps_SSE2::PGradientBase::interpolate_prgb32;
   gradient.interpolate[IMAGE_FORMAT_XRGB32] = RasterOps_SSE2::PGradientBase::interpolate_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Linear]
+  // --------------------------------------------------------------------------
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_pad_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_pad_prgb32;
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_repeat_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_repeat_prgb32;
+
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_reflect_prgb32;
+  gradient.linear.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientLinear::fetch_simple_nearest_reflect_prgb32;
+
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+  gradient.linear.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientLinear::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Radial]
+  // --------------------------------------------------------------------------
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+  gradient.radial.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRadial::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+  gradient.radial.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRadial::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Rectangular]
+  // --------------------------------------------------------------------------
+
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+  gradient.rectangular.fetch_simple_nearest[IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRectangular::fetch_simple_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_PAD    ] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Pad>;
+
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REPEAT ] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Repeat>;
+
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_PRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+  gradient.rectangular.fetch_proj_nearest  [IMAGE_FORMAT_XRGB32][GRADIENT_SPREAD_REFLECT] = RasterOps_SSE2::PGradientRectangular::fetch_proj_nearest<RasterOps_SSE2::PGradientAccessor_PRGB32_Reflect>;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Gradient - Conical]
+  // --------------------------------------------------------------------------
+
+  gradient.conical.fetch_simple_nearest[IMAGE_FORMAT_PRGB32] = RasterOps_SSE2::PGradientConical::fetch_simple_nearest_prgb32;
+  gradient.conical.fetch_simple_nearest[IMAGE_FORMAT_XRGB32] = RasterOps_SSE2::PGradientConical::fetch_simple_nearest_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - API]
+  // --------------------------------------------------------------------------
+
+  RasterTextureFuncs& texture = api.texture;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - Simple]
+  // --------------------------------------------------------------------------
+
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_align_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_align_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_align_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_align_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_align_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_align_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_align_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_align_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_align_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_align_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_align_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_align_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_align_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_align_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_align_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subx0_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subx0_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subx0_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subx0_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subx0_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subxy_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subxy_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subxy_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subxy_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureSimple::fetch_subxy_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_align_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_align_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_align_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_align_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_align[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_align_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subx0[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subx0_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_sub0y[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_sub0y_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_simple_subxy[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureSimple::fetch_subxy_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - Affine]
+  // --------------------------------------------------------------------------
+
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_affine_bicubic [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureAffine::fetch_affine_bicubic_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - Projection]
+  // --------------------------------------------------------------------------
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_SSE2::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_I8    >;
 }
 
 } // Fog namespace
@@ -0,0 +1,206 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/G2d/Painting/RasterLayerPool_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RasterLayerPool - Helpers]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get size-class of @a v, the size of the class is stored to @a size.
+//!
+//! Returns a value equal or greater than @c RASTER_LAYER_POOL_CLASSES if @a v
+//! is too large to be pooled.
+static FOG_INLINE uint32_t RasterLayerPool_getClass(int v, int& size)
+{
+  uint32_t c = 0;
+  size = RASTER_LAYER_POOL_MIN_SIZE;
+
+  while (size < v)
+  {
+    if (++c >= RASTER_LAYER_POOL_CLASSES)
+      return c;
+
+    size = (c & 1) ? ((RASTER_LAYER_POOL_MIN_SIZE * 3 / 2) << (c >> 1))
+                   : ((RASTER_LAYER_POOL_MIN_SIZE        ) << (c >> 1));
+  }
+
+  return c;
+}
+
+// ============================================================================
+// [Fog::RasterLayerPool - LRU]
+// ============================================================================
+
+static FOG_INLINE void RasterLayerPool_lruUnlink(RasterLayerPool* self, RasterLayer* layer)
+{
+  RasterLayer* prev = layer->_lruPrev;
+  RasterLayer* next = layer->_lruNext;
+
+  if (prev) prev->_lruNext = next; else self->_lruFirst = next;
+  if (next) next->_lruPrev = prev; else self->_lruLast = prev;
+}
+
+static FOG_INLINE void RasterLayerPool_lruPrepend(RasterLayerPool* self, RasterLayer* layer)
+{
+  RasterLayer* first = self->_lruFirst;
+
+  layer->_lruPrev = NULL;
+  layer->_lruNext = first;
+
+  if (first) first->_lruPrev = layer; else self->_lruLast = layer;
+  self->_lruFirst = layer;
+}
+
+static void RasterLayerPool_evict(RasterLayerPool* self)
+{
+  while (self->_memoryUsed > self->_memoryLimit && self->_lruLast != NULL)
+  {
+    RasterLayer* layer = self->_lruLast;
+    RasterLayer** pPrev = &self->_buckets[layer->_bucket];
+
+    while (*pPrev != layer)
+      pPrev = &(*pPrev)->_bucketNext;
+    *pPrev = layer->_bucketNext;
+
+    RasterLayerPool_lruUnlink(self, layer);
+    self->_memoryUsed -= layer->getMemoryUsage();
+
+    // Images referenced by recorded commands are destroyed with the commands.
+    fog_delete(layer);
+  }
+}
+
+// ============================================================================
+// [Fog::RasterLayerPool - Construction / Destruction]
+// ============================================================================
+
+RasterLayerPool::RasterLayerPool() :
+  _lruFirst(NULL),
+  _lruLast(NULL),
+  _memoryUsed(0),
+  _memoryLimit(RASTER_LAYER_POOL_LIMIT)
+{
+  MemOps::zero(_buckets, sizeof(_buckets));
+}
+
+RasterLayerPool::~RasterLayerPool()
+{
+  clear();
+}
+
+// ============================================================================
+// [Fog::RasterLayerPool - Interface]
+// ============================================================================
+
+RasterLayer* RasterLayerPool::acquire(const SizeI& size)
+{
+  int w, h;
+  uint32_t cw = RasterLayerPool_getClass(size.w, w);
+  uint32_t ch = RasterLayerPool_getClass(size.h, h);
+
+  uint32_t bucket = (uint32_t)-1;
+
+  if (cw < RASTER_LAYER_POOL_CLASSES && ch < RASTER_LAYER_POOL_CLASSES)
+  {
+    bucket = ch * RASTER_LAYER_POOL_CLASSES + cw;
+
+    AutoLock locked(_lock);
+    RasterLayer** pPrev = &_buckets[bucket];
+    RasterLayer* layer;
+
+    while ((layer = *pPrev) != NULL)
+    {
+      // Skip layers still used by paint commands.
+      if (layer->image.isDetached())
+      {
+        *pPrev = layer->_bucketNext;
+        layer->_bucketNext = NULL;
+
+        RasterLayerPool_lruUnlink(this, layer);
+        _memoryUsed -= layer->getMemoryUsage();
+        return layer;
+      }
+
+      pPrev = &layer->_bucketNext;
+    }
+  }
+  else
+  {
+    // Not pooled, don't waste memory by rounding.
+    w = size.w;
+    h = size.h;
+  }
+
+  RasterLayer* layer = fog_new RasterLayer();
+  if (FOG_IS_NULL(layer))
+    return NULL;
+
+  if (FOG_IS_ERROR(layer->image.create(SizeI(w, h), IMAGE_FORMAT_PRGB32)))
+  {
+    fog_delete(layer);
+    return NULL;
+  }
+
+  layer->_bucket = bucket;
+  return layer;
+}
+
+void RasterLayerPool::release(RasterLayer* layer)
+{
+  if (layer->_bucket == (uint32_t)-1)
+  {
+    fog_delete(layer);
+    return;
+  }
+
+  AutoLock locked(_lock);
+
+  layer->_bucketNext = _buckets[layer->_bucket];
+  _buckets[layer->_bucket] = layer;
+
+  RasterLayerPool_lruPrepend(this, layer);
+  _memoryUsed += layer->getMemoryUsage();
+
+  RasterLayerPool_evict(this);
+}
+
+void RasterLayerPool::clear()
+{
+  AutoLock locked(_lock);
+
+  RasterLayer* layer = _lruFirst;
+  while (layer != NULL)
+  {
+    RasterLayer* next = layer->_lruNext;
+    fog_delete(layer);
+    layer = next;
+  }
+
+  MemOps::zero(_buckets, sizeof(_buckets));
+
+  _lruFirst = NULL;
+  _lruLast = NULL;
+  _memoryUsed = 0;
+}
+
+// ============================================================================
+// [Fog::RasterLayerPool - Statics]
+// ============================================================================
+
+FOG_NO_EXPORT Static<RasterLayerPool> RasterLayerPool_oInstance;
+
+} // Fog namespace
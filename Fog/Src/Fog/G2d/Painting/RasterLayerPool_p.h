@@ -0,0 +1,133 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERLAYERPOOL_P_H
+#define _FOG_G2D_PAINTING_RASTERLAYERPOOL_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/G2d/Geometry/Size.h>
+#include <Fog/G2d/Imaging/Image.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::RasterLayer]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Layer (PRGB32 surface) managed by @c RasterLayerPool.
+struct FOG_NO_EXPORT RasterLayer
+{
+  FOG_INLINE RasterLayer() :
+    _bucketNext(NULL),
+    _lruPrev(NULL),
+    _lruNext(NULL),
+    _bucket(0)
+  {
+  }
+
+  //! @brief Get the size of memory used by the layer pixels.
+  FOG_INLINE size_t getMemoryUsage() const
+  {
+    return (size_t)(uint)image.getHeight() * (size_t)image.getStride();
+  }
+
+  //! @brief Next layer in the same bucket.
+  RasterLayer* _bucketNext;
+  //! @brief Previous layer in the LRU list.
+  RasterLayer* _lruPrev;
+  //! @brief Next layer in the LRU list.
+  RasterLayer* _lruNext;
+
+  //! @brief Bucket index, or @c (uint32_t)-1 if the layer is not pooled.
+  uint32_t _bucket;
+
+  //! @brief The surface, its size is rounded up to the size-class.
+  Image image;
+};
+
+// ============================================================================
+// [Fog::RasterLayerPool]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Pool of layers used by groups, shared by all raster paint-engines.
+//!
+//! The layer size is rounded up to a size-class (see @c RASTER_LAYER_POOL_MIN_SIZE)
+//! and unused layers are kept in a bucket per (width-class, height-class) so
+//! a layer of the same class can be reused without searching. Layers are not
+//! cleared, the caller is responsible to clear the area it uses.
+//!
+//! The memory used by unused layers is limited by @c RASTER_LAYER_POOL_LIMIT,
+//! the least recently released layers are destroyed first.
+struct FOG_NO_EXPORT RasterLayerPool
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterLayerPool();
+  ~RasterLayerPool();
+
+  // --------------------------------------------------------------------------
+  // [Interface]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get a layer which is at least @a size large.
+  //!
+  //! Returns @c NULL if out of memory.
+  RasterLayer* acquire(const SizeI& size);
+
+  //! @brief Return @a layer back to the pool.
+  //!
+  //! The layer image can be still referenced by paint commands which weren't
+  //! rendered yet (multithreaded mode, nested groups), such layer is pooled,
+  //! but it's not reused until all other references are released.
+  void release(RasterLayer* layer);
+
+  //! @brief Destroy all unused layers.
+  void clear();
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Lock.
+  Lock _lock;
+
+  //! @brief Buckets of unused layers (the most recently released first).
+  RasterLayer* _buckets[RASTER_LAYER_POOL_CLASSES * RASTER_LAYER_POOL_CLASSES];
+
+  //! @brief The most recently released layer.
+  RasterLayer* _lruFirst;
+  //! @brief The least recently released layer.
+  RasterLayer* _lruLast;
+
+  //! @brief Memory used by unused layers.
+  size_t _memoryUsed;
+  //! @brief Memory limit.
+  size_t _memoryLimit;
+
+private:
+  FOG_NO_COPY(RasterLayerPool)
+};
+
+extern FOG_NO_EXPORT Static<RasterLayerPool> RasterLayerPool_oInstance;
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERLAYERPOOL_P_H
@@ -0,0 +1,306 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
+
+// [Dependencies]
+#include <Fog/Core/Acc/Constants.h>
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/BaseConvert_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - Convert]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT Convert
+{
+  // ==========================================================================
+  // [MemCopy - 32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL copy_32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [BSwap - 32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL bswap_32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [Convert - Premultiply / Demultiply - Helpers]
+  // ==========================================================================
+
+  //! @brief Demultiply 8 PRGB32 pixels using the reciprocal table (the same
+  //! formula as Acc::p32ARGB32FromPRGB32()).
+  static FOG_INLINE void p8ARGB32FromPRGB32(__m256i& dst0, const __m256i& x0)
+  {
+    __m256i a0 = _mm256_srli_epi32(x0, 24);
+    __m256i m0 = _mm256_set1_epi32(0xFF);
+    __m256i r0;
+
+    Acc::m256iGatherPI32(r0, Acc::_u8_divide_table_d, a0);
+
+    __m256i c0 = _mm256_and_si256(x0, m0);
+    __m256i c1 = _mm256_and_si256(_mm256_srli_epi32(x0, 8), m0);
+    __m256i c2 = _mm256_and_si256(_mm256_srli_epi32(x0, 16), m0);
+
+    c0 = _mm256_srli_epi32(_mm256_mullo_epi32(c0, r0), 16);
+    c1 = _mm256_srli_epi32(_mm256_mullo_epi32(c1, r0), 16);
+    c2 = _mm256_srli_epi32(_mm256_mullo_epi32(c2, r0), 16);
+
+    c0 = _mm256_and_si256(c0, m0);
+    c1 = _mm256_slli_epi32(_mm256_and_si256(c1, m0), 8);
+    c2 = _mm256_slli_epi32(_mm256_and_si256(c2, m0), 16);
+    a0 = _mm256_slli_epi32(a0, 24);
+
+    dst0 = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, a0));
+  }
+
+  // ==========================================================================
+  // [Convert - Premultiply / Demultiply]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_argb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      if (!Acc::m256iPRGB32IsAlphaFF(pix0))
+        Acc::m256iPRGB32FromARGB32(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iPRGB32FromARGB32(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  static void FOG_FASTCALL argb32_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      if (!Acc::m256iPRGB32IsAlphaFF(pix0))
+        p8ARGB32FromPRGB32(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      p8ARGB32FromPRGB32(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [Convert - ARGB32 From - RGB32_888_BS]
+  // ==========================================================================
+
+  static void FOG_FASTCALL argb32_from_rgb32_888_bs(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iFillPBB3(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iFillPBB3(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [Convert - ARGB32 From - ARGB32_8888_BS]
+  // ==========================================================================
+
+  static void FOG_FASTCALL argb32_from_argb32_8888_bs(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    __m256i fill0;
+    Acc::m256iExpandPI32FromSI32(fill0, (int)(uint32_t)reinterpret_cast<const RasterConvertPass*>(closure->data)->fill);
+
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iOr(pix0, pix0, fill0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iOr(pix0, pix0, fill0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [Convert - RGB32_888_BS From - ARGB32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL rgb32_888_bs_from_argb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    __m256i fill0;
+    Acc::m256iExpandPI32FromSI32(fill0, (int)(uint32_t)reinterpret_cast<const RasterConvertPass*>(closure->data)->fill);
+
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iOr(pix0, pix0, fill0);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iOr(pix0, pix0, fill0);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [Convert - ARGB32_8888_BS From - ARGB32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL argb32_8888_bs_from_argb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoad32u(pix0, src);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStore32u(dst, pix0);
+
+      dst += 32;
+      src += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i pix0;
+
+      Acc::m256iLoadMaskPI32(pix0, src, _tailMask);
+      Acc::m256iBSwapPI32(pix0, pix0);
+      Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
@@ -0,0 +1,51 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Acc/AccAvx2.h>
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/BaseDefs_p.h>
+
+// [Dependencies - RasterOps_SSE2]
+#include <Fog/G2d/Painting/RasterOps_SSE2/BaseDefs_p.h>
+
+// ============================================================================
+// [FOG_BLIT_LOOP - 32x8 - 32-bits per pixel, 8 pixels in a main loop]
+// ============================================================================
+
+// The AVX2 blitters don't align the destination buffer, unaligned 256-bit
+// loads and stores are cheap on all CPUs supporting AVX2. The main loop
+// processes 8 pixels per iteration and the tail (1-7 pixels) is processed
+// by the same code using masked loads/stores, the mask is available as
+// '_tailMask' (DWORD mask, see Acc::m256iMaskFromCountPI32()).
+
+#define FOG_BLIT_LOOP_32x8_AVX2_INIT() \
+  FOG_ASSUME(w > 0);
+
+#define FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(_Group_) \
+  while ((w -= 8) >= 0) \
+  {
+
+#define FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(_Group_) \
+  } \
+  \
+  w += 8;
+
+#define FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(_Group_) \
+  if (w != 0) \
+  { \
+    __m256i _tailMask; \
+    Acc::m256iMaskFromCountPI32(_tailMask, w);
+
+#define FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(_Group_) \
+  }
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
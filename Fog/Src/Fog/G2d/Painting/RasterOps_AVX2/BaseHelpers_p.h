@@ -0,0 +1,113 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEHELPERS_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEHELPERS_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/BaseHelpers_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - Helpers]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT Helpers
+{
+  // ==========================================================================
+  // [Load - Source Pixels]
+  // ==========================================================================
+
+  //! @brief Load 8 source pixels of @a SrcFormat and convert them to PRGB32.
+  //!
+  //! Supported formats are PRGB32, XRGB32 (alpha is set to 0xFF) and A8
+  //! (converted to white pixels having the alpha of the source).
+  template<uint32_t SrcFormat>
+  static FOG_INLINE void p8LoadPRGB32(__m256i& dst0, const uint8_t* src)
+  {
+    if (SrcFormat == IMAGE_FORMAT_A8)
+    {
+      Acc::m256iLoad8ExtendPI32FromPI8(dst0, src);
+      Acc::m256iMulLoPI32(dst0, dst0, _mm256_set1_epi32(0x01010101));
+    }
+    else
+    {
+      Acc::m256iLoad32u(dst0, src);
+      if (SrcFormat == IMAGE_FORMAT_XRGB32)
+        Acc::m256iFillPBB3(dst0, dst0);
+    }
+  }
+
+  //! @brief Load 1-7 source pixels (tail) of @a SrcFormat and convert them
+  //! to PRGB32.
+  template<uint32_t SrcFormat>
+  static FOG_INLINE void p8LoadPRGB32Partial(__m256i& dst0, const uint8_t* src, int w, const __m256i& tailMask)
+  {
+    if (SrcFormat == IMAGE_FORMAT_A8)
+    {
+      Acc::m256iLoad8ExtendPI32FromPI8Partial(dst0, src, w);
+      Acc::m256iMulLoPI32(dst0, dst0, _mm256_set1_epi32(0x01010101));
+    }
+    else
+    {
+      Acc::m256iLoadMaskPI32(dst0, src, tailMask);
+      if (SrcFormat == IMAGE_FORMAT_XRGB32)
+        Acc::m256iFillPBB3(dst0, dst0);
+    }
+  }
+
+  // ==========================================================================
+  // [Load - Mask]
+  // ==========================================================================
+
+  //! @brief Load 8 A8-Glyph mask values (0-255) as 0-256 DWORDs.
+  static FOG_INLINE void p8LoadA8Glyph(__m256i& dst0, const uint8_t* msk)
+  {
+    Acc::m256iLoad8ExtendPI32FromPI8(dst0, msk);
+    Acc::m256iCvt256From255PI16(dst0, dst0);
+  }
+
+  static FOG_INLINE void p8LoadA8GlyphPartial(__m256i& dst0, const uint8_t* msk, int w)
+  {
+    Acc::m256iLoad8ExtendPI32FromPI8Partial(dst0, msk, w);
+    Acc::m256iCvt256From255PI16(dst0, dst0);
+  }
+
+  //! @brief Load 8 A8-Extra mask values (already 0-256) as DWORDs.
+  static FOG_INLINE void p8LoadA8Extra(__m256i& dst0, const uint8_t* msk)
+  {
+    Acc::m256iLoad16ExtendPI32FromPI16(dst0, msk);
+  }
+
+  static FOG_INLINE void p8LoadA8ExtraPartial(__m256i& dst0, const uint8_t* msk, int w)
+  {
+    Acc::m256iLoad16ExtendPI32FromPI16Partial(dst0, msk, w);
+  }
+
+  //! @brief Unpack 8 ARGB32-Glyph mask pixels into two vectors of 0-256
+  //! WORDs laid out like Acc::m256iUnpackPI16FromPI8Lo/Hi.
+  //!
+  //! @note @a x0 can be the same variable as @a dst0.
+  static FOG_INLINE void p8UnpackARGB32Glyph(__m256i& dst0, __m256i& dst1, const __m256i& x0)
+  {
+    Acc::m256iUnpackPI16FromPI8Hi(dst1, x0);
+    Acc::m256iUnpackPI16FromPI8Lo(dst0, x0);
+    Acc::m256iCvt256From255PI16(dst0, dst0);
+    Acc::m256iCvt256From255PI16(dst1, dst1);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEHELPERS_P_H
@@ -0,0 +1,159 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITEBASE_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITEBASE_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - CompositeBase]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Pixel kernels shared by the AVX2 compositors, all of them work on
+//! 8 packed PRGB32 pixels. Masks passed as a single vector are DWORDs in the
+//! 0-256 range, masks passed as two vectors are per-component WORDs laid out
+//! like Acc::m256iUnpackPI16FromPI8Lo/Hi.
+struct FOG_NO_EXPORT CompositeBase
+{
+  // ==========================================================================
+  // [Src]
+  // ==========================================================================
+
+  //! @brief Dc' = (Sc.m + Dc.(256 - m)) / 256 (the C Lerp256 function).
+  static FOG_INLINE void p8LerpPBW(__m256i& dst0, const __m256i& src0, const __m256i& m0, const __m256i& m1)
+  {
+    __m256i s0, s1;
+    __m256i d0, d1;
+    __m256i i0, i1;
+
+    Acc::m256iUnpackPI16FromPI8Lo(s0, src0);
+    Acc::m256iUnpackPI16FromPI8Hi(s1, src0);
+    Acc::m256iUnpackPI16FromPI8Lo(d0, dst0);
+    Acc::m256iUnpackPI16FromPI8Hi(d1, dst0);
+
+    Acc::m256iNegate256PI16(i0, m0);
+    Acc::m256iNegate256PI16(i1, m1);
+
+    Acc::m256iMulLoPI16(s0, s0, m0);
+    Acc::m256iMulLoPI16(s1, s1, m1);
+    Acc::m256iMulLoPI16(d0, d0, i0);
+    Acc::m256iMulLoPI16(d1, d1, i1);
+
+    Acc::m256iAddPI16(d0, d0, s0);
+    Acc::m256iAddPI16(d1, d1, s1);
+
+    Acc::m256iRShiftPU16<8>(d0, d0);
+    Acc::m256iRShiftPU16<8>(d1, d1);
+    Acc::m256iPackPU8FromPU16(dst0, d0, d1);
+  }
+
+  static FOG_INLINE void p8Lerp(__m256i& dst0, const __m256i& src0, const __m256i& msk0)
+  {
+    __m256i m0, m1;
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, msk0);
+    p8LerpPBW(dst0, src0, m0, m1);
+  }
+
+  //! @brief Dc' = Sc.m / 256 + Dc.(256 - m) / 256, each term is truncated
+  //! separately (matches the C solid-source compositors).
+  static FOG_INLINE void p8SrcMask(__m256i& dst0, const __m256i& src0, const __m256i& msk0)
+  {
+    __m256i s0, s1;
+    __m256i d0, d1;
+    __m256i m0, m1;
+    __m256i i0, i1;
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, msk0);
+    Acc::m256iUnpackPI16FromPI8Lo(s0, src0);
+    Acc::m256iUnpackPI16FromPI8Hi(s1, src0);
+    Acc::m256iUnpackPI16FromPI8Lo(d0, dst0);
+    Acc::m256iUnpackPI16FromPI8Hi(d1, dst0);
+
+    Acc::m256iNegate256PI16(i0, m0);
+    Acc::m256iNegate256PI16(i1, m1);
+
+    Acc::m256iMulDiv256PI16_2x(s0, s0, m0, s1, s1, m1);
+    Acc::m256iMulDiv256PI16_2x(d0, d0, i0, d1, d1, i1);
+
+    Acc::m256iAddPI16(d0, d0, s0);
+    Acc::m256iAddPI16(d1, d1, s1);
+    Acc::m256iPackPU8FromPU16(dst0, d0, d1);
+  }
+
+  // ==========================================================================
+  // [SrcOver]
+  // ==========================================================================
+
+  //! @brief Dc' = Sc + Dc.(1 - Sa).
+  static FOG_INLINE void p8SrcOver(__m256i& dst0, const __m256i& src0)
+  {
+    __m256i a0, a1;
+    __m256i d0, d1;
+
+    Acc::m256iUnpackNegAlphaPI16FromARGB32_PI8(a0, a1, src0);
+    Acc::m256iUnpackPI16FromPI8Lo(d0, dst0);
+    Acc::m256iUnpackPI16FromPI8Hi(d1, dst0);
+
+    Acc::m256iMulDiv255PI16_2x(d0, d0, a0, d1, d1, a1);
+    Acc::m256iPackPU8FromPU16(d0, d0, d1);
+    Acc::m256iAddPI8(dst0, d0, src0);
+  }
+
+  //! @brief Sc' = Sc.m, Dc' = Sc' + Dc.(1 - Sa').
+  static FOG_INLINE void p8SrcOverMask(__m256i& dst0, const __m256i& src0, const __m256i& msk0)
+  {
+    __m256i s0, s1;
+    __m256i m0, m1;
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, msk0);
+    Acc::m256iUnpackPI16FromPI8Lo(s0, src0);
+    Acc::m256iUnpackPI16FromPI8Hi(s1, src0);
+
+    Acc::m256iMulDiv256PI16_2x(s0, s0, m0, s1, s1, m1);
+    Acc::m256iPackPU8FromPU16(s0, s0, s1);
+
+    p8SrcOver(dst0, s0);
+  }
+
+  //! @brief Component-alpha: Sc' = Sc.Mc, Dc' = Sc' + Dc.(1 - Mc.Sa).
+  static FOG_INLINE void p8SrcOverMaskPBW(__m256i& dst0, const __m256i& src0, const __m256i& m0, const __m256i& m1)
+  {
+    __m256i s0, s1;
+    __m256i d0, d1;
+    __m256i a0, a1;
+
+    Acc::m256iUnpackAlphaPI16FromARGB32_PI8(a0, a1, src0);
+    Acc::m256iUnpackPI16FromPI8Lo(s0, src0);
+    Acc::m256iUnpackPI16FromPI8Hi(s1, src0);
+    Acc::m256iUnpackPI16FromPI8Lo(d0, dst0);
+    Acc::m256iUnpackPI16FromPI8Hi(d1, dst0);
+
+    Acc::m256iMulDiv256PI16_2x(s0, s0, m0, s1, s1, m1);
+    Acc::m256iMulDiv256PI16_2x(a0, a0, m0, a1, a1, m1);
+    Acc::m256iNegate255PI16(a0, a0);
+    Acc::m256iNegate255PI16(a1, a1);
+
+    Acc::m256iMulDiv255PI16_2x(d0, d0, a0, d1, d1, a1);
+    Acc::m256iAddPI16(d0, d0, s0);
+    Acc::m256iAddPI16(d1, d1, s1);
+    Acc::m256iPackPU8FromPU16(dst0, d0, d1);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITEBASE_P_H
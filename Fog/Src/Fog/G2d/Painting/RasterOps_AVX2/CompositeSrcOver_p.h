@@ -0,0 +1,475 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITESRCOVER_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITESRCOVER_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_AVX2/CompositeSrc_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - CompositeSrcOver]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeSrcOver
+{
+  enum { COMBINE_FLAGS = RASTER_COMBINE_OP_SRC_OVER };
+
+  // ==========================================================================
+  // [PRGB32 - CBlit - PRGB32 - Helpers]
+  // ==========================================================================
+
+  static FOG_INLINE void _prgb32_cblit_prgb32_line(
+    uint8_t* dst, int w, const __m256i& src0)
+  {
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i dst0;
+
+      Acc::m256iLoad32u(dst0, dst);
+      CompositeBase::p8SrcOver(dst0, src0);
+      Acc::m256iStore32u(dst, dst0);
+
+      dst += 32;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i dst0;
+
+      Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+      CompositeBase::p8SrcOver(dst0, src0);
+      Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [PRGB32 - CBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_cblit_prgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    __m256i src0;
+    Acc::m256iExpandPI32FromSI32(src0, (int)src->prgb32.u32);
+
+    _prgb32_cblit_prgb32_line(dst, w, src0);
+  }
+
+  // ==========================================================================
+  // [PRGB32 - CBlit - PRGB32 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_cblit_prgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    __m256i sro0;
+    Acc::m256iExpandPI32FromSI32(sro0, (int)src->prgb32.u32);
+
+    FOG_CBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Any]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_ANY()
+    {
+      if (msk0 == 0x100)
+      {
+        _prgb32_cblit_prgb32_line(dst, w, sro0);
+      }
+      else
+      {
+        uint32_t src0p;
+        __m256i src0;
+
+        Acc::p32MulDiv256PBB_SBW(src0p, src->prgb32.u32, msk0);
+        Acc::m256iExpandPI32FromSI32(src0, (int)src0p);
+
+        _prgb32_cblit_prgb32_line(dst, w, src0);
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_GLYPH()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(A8_Glyph)
+        __m256i dst0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8Glyph(msk0x, msk);
+        if (Acc::m256iIsZero(msk0x)) goto _A8_Glyph_Skip;
+
+        Acc::m256iLoad32u(dst0, dst);
+        CompositeBase::p8SrcOverMask(dst0, sro0, msk0x);
+        Acc::m256iStore32u(dst, dst0);
+
+_A8_Glyph_Skip:
+        dst += 32;
+        msk += 8;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(A8_Glyph)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(A8_Glyph)
+        __m256i dst0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8GlyphPartial(msk0x, msk, w);
+
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        CompositeBase::p8SrcOverMask(dst0, sro0, msk0x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(A8_Glyph)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_EXTRA()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(A8_Extra)
+        __m256i dst0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8Extra(msk0x, msk);
+        Acc::m256iLoad32u(dst0, dst);
+        CompositeBase::p8SrcOverMask(dst0, sro0, msk0x);
+        Acc::m256iStore32u(dst, dst0);
+
+        dst += 32;
+        msk += 16;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(A8_Extra)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(A8_Extra)
+        __m256i dst0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8ExtraPartial(msk0x, msk, w);
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        CompositeBase::p8SrcOverMask(dst0, sro0, msk0x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(A8_Extra)
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(ARGB32_Glyph)
+        __m256i dst0;
+        __m256i msk0x, msk1x;
+
+        Acc::m256iLoad32u(msk0x, msk);
+        if (Acc::m256iIsZero(msk0x)) goto _ARGB32_Glyph_Skip;
+
+        Acc::m256iLoad32u(dst0, dst);
+        Helpers::p8UnpackARGB32Glyph(msk0x, msk1x, msk0x);
+        CompositeBase::p8SrcOverMaskPBW(dst0, sro0, msk0x, msk1x);
+        Acc::m256iStore32u(dst, dst0);
+
+_ARGB32_Glyph_Skip:
+        dst += 32;
+        msk += 32;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(ARGB32_Glyph)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(ARGB32_Glyph)
+        __m256i dst0;
+        __m256i msk0x, msk1x;
+
+        Acc::m256iLoadMaskPI32(msk0x, msk, _tailMask);
+
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        Helpers::p8UnpackARGB32Glyph(msk0x, msk1x, msk0x);
+        CompositeBase::p8SrcOverMaskPBW(dst0, sro0, msk0x, msk1x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(ARGB32_Glyph)
+    }
+
+    FOG_CBLIT_SPAN8_END()
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit - Helpers]
+  // ==========================================================================
+
+  template<uint32_t SrcFormat>
+  static FOG_INLINE void _prgb32_vblit_line(
+    uint8_t* dst, const uint8_t* src, int w)
+  {
+    enum { SRC_BPP = (SrcFormat == IMAGE_FORMAT_A8) ? 1 : 4 };
+
+    FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Opaque)
+      __m256i dst0;
+      __m256i src0;
+
+      Helpers::p8LoadPRGB32<SrcFormat>(src0, src);
+      if (Acc::m256iPRGB32IsAlpha00(src0)) goto _C_Opaque_Skip;
+      if (Acc::m256iPRGB32IsAlphaFF(src0)) goto _C_Opaque_Fill;
+
+      Acc::m256iLoad32u(dst0, dst);
+      CompositeBase::p8SrcOver(dst0, src0);
+      Acc::m256iStore32u(dst, dst0);
+      goto _C_Opaque_Skip;
+
+_C_Opaque_Fill:
+      Acc::m256iStore32u(dst, src0);
+
+_C_Opaque_Skip:
+      dst += 32;
+      src += 8 * SRC_BPP;
+    FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Opaque)
+
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Opaque)
+      __m256i dst0;
+      __m256i src0;
+
+      Helpers::p8LoadPRGB32Partial<SrcFormat>(src0, src, w, _tailMask);
+      Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+      CompositeBase::p8SrcOver(dst0, src0);
+      Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+    FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Opaque)
+  }
+
+  template<uint32_t SrcFormat>
+  static FOG_INLINE void _prgb32_vblit_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    enum { SRC_BPP = (SrcFormat == IMAGE_FORMAT_A8) ? 1 : 4 };
+
+    FOG_VBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_OPAQUE()
+    {
+      _prgb32_vblit_line<SrcFormat>(dst, src, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_MASK()
+    {
+      __m256i msk0x;
+      Acc::m256iExpandPI32FromSI32(msk0x, (int)msk0);
+
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(C_Mask)
+        __m256i dst0;
+        __m256i src0;
+
+        Helpers::p8LoadPRGB32<SrcFormat>(src0, src);
+        Acc::m256iLoad32u(dst0, dst);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStore32u(dst, dst0);
+
+        dst += 32;
+        src += 8 * SRC_BPP;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(C_Mask)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(C_Mask)
+        __m256i dst0;
+        __m256i src0;
+
+        Helpers::p8LoadPRGB32Partial<SrcFormat>(src0, src, w, _tailMask);
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(C_Mask)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_GLYPH()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(A8_Glyph)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8Glyph(msk0x, msk);
+        if (Acc::m256iIsZero(msk0x)) goto _A8_Glyph_Skip;
+
+        Helpers::p8LoadPRGB32<SrcFormat>(src0, src);
+        Acc::m256iLoad32u(dst0, dst);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStore32u(dst, dst0);
+
+_A8_Glyph_Skip:
+        dst += 32;
+        src += 8 * SRC_BPP;
+        msk += 8;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(A8_Glyph)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(A8_Glyph)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8GlyphPartial(msk0x, msk, w);
+
+        Helpers::p8LoadPRGB32Partial<SrcFormat>(src0, src, w, _tailMask);
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(A8_Glyph)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_EXTRA()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(A8_Extra)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8Extra(msk0x, msk);
+        Helpers::p8LoadPRGB32<SrcFormat>(src0, src);
+        Acc::m256iLoad32u(dst0, dst);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStore32u(dst, dst0);
+
+        dst += 32;
+        src += 8 * SRC_BPP;
+        msk += 16;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(A8_Extra)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(A8_Extra)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x;
+
+        Helpers::p8LoadA8ExtraPartial(msk0x, msk, w);
+        Helpers::p8LoadPRGB32Partial<SrcFormat>(src0, src, w, _tailMask);
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        CompositeBase::p8SrcOverMask(dst0, src0, msk0x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(A8_Extra)
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(ARGB32_Glyph)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x, msk1x;
+
+        Acc::m256iLoad32u(msk0x, msk);
+        if (Acc::m256iIsZero(msk0x)) goto _ARGB32_Glyph_Skip;
+
+        Helpers::p8LoadPRGB32<SrcFormat>(src0, src);
+        Acc::m256iLoad32u(dst0, dst);
+        Helpers::p8UnpackARGB32Glyph(msk0x, msk1x, msk0x);
+        CompositeBase::p8SrcOverMaskPBW(dst0, src0, msk0x, msk1x);
+        Acc::m256iStore32u(dst, dst0);
+
+_ARGB32_Glyph_Skip:
+        dst += 32;
+        src += 8 * SRC_BPP;
+        msk += 32;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(ARGB32_Glyph)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(ARGB32_Glyph)
+        __m256i dst0;
+        __m256i src0;
+        __m256i msk0x, msk1x;
+
+        Acc::m256iLoadMaskPI32(msk0x, msk, _tailMask);
+
+        Helpers::p8LoadPRGB32Partial<SrcFormat>(src0, src, w, _tailMask);
+        Acc::m256iLoadMaskPI32(dst0, dst, _tailMask);
+        Helpers::p8UnpackARGB32Glyph(msk0x, msk1x, msk0x);
+        CompositeBase::p8SrcOverMaskPBW(dst0, src0, msk0x, msk1x);
+        Acc::m256iStoreMaskPI32(dst, dst0, _tailMask);
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(ARGB32_Glyph)
+    }
+
+    FOG_VBLIT_SPAN8_END()
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_vblit_prgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _prgb32_vblit_line<IMAGE_FORMAT_PRGB32>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit - PRGB32 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_vblit_prgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _prgb32_vblit_span<IMAGE_FORMAT_PRGB32>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit - A8 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_vblit_a8_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _prgb32_vblit_line<IMAGE_FORMAT_A8>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit - A8 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_vblit_a8_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _prgb32_vblit_span<IMAGE_FORMAT_A8>(dst, span, closure);
+  }
+
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_COMPOSITESRCOVER_P_H
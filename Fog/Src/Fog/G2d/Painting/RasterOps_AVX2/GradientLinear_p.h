@@ -0,0 +1,295 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTLINEAR_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTLINEAR_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientBase_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/GradientLinear_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - PGradientLinear]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Linear gradient fetchers (simple transform, nearest).
+//!
+//! The position of 8 consecutive pixels is kept in a single register, the
+//! table indices are computed by the same fixed-point arithmetic the C fetcher
+//! uses and the colors are fetched by a single gather. The length of the
+//! color table is always a power of two (see
+//! @c RasterOps_C::PGradientBase::get_optimal_cache_length()), so repeat and
+//! reflect can wrap the position using a mask.
+struct FOG_NO_EXPORT PGradientLinear
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get positions of 8 pixels starting at @a pos, advancing by @a xx.
+  static FOG_INLINE void p8PosInit(__m256i& dst0, int pos, int xx)
+  {
+    __m256i t0;
+
+    Acc::m256iExpandPI32FromSI32(dst0, pos);
+    Acc::m256iExpandPI32FromSI32(t0, xx);
+
+    Acc::m256iMulLoPI32(t0, t0, FOG_YMM_GET_CONST_PI(m256i_76543210));
+    Acc::m256iAddPI32(dst0, dst0, t0);
+  }
+
+  //! @brief Fetch 8 pixels from @a table, indices are 16.16 fixed-point.
+  static FOG_INLINE void p8FetchRaw(__m256i& dst0, const uint32_t* table, const __m256i& pos0)
+  {
+    __m256i idx0;
+
+    Acc::m256iRShiftPU32<16>(idx0, pos0);
+    Acc::m256iGatherPI32(dst0, table, idx0);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Pad]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_pad_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len = ctx->_d.gradient.base.len16x16;
+
+    // The position of the last pixel in a group must not overflow, this is
+    // only possible when the whole color table is skipped by a single pixel,
+    // which is handled by C.
+    if (xx > len || xx < -len)
+    {
+      RasterOps_C::PGradientLinear::fetch_simple_nearest_pad<RasterOps_C::PGradientAccessor_PRGB32_Base>(
+        fetcher, span, buffer);
+      return;
+    }
+
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int pos = Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + x * xx;
+
+    // When all pixels are past the end (or the start) of the table the
+    // position is clamped so it can't overflow, the fetched color stays the
+    // same (the first or the last color in the table).
+    int posMin = (xx < 0) ? -1 : INT_MIN;
+    int posMax = (xx < 0) ? INT_MAX : len;
+
+    __m256i cLen;
+    __m256i cZero;
+
+    Acc::m256iExpandPI32FromSI32(cLen, len);
+    Acc::m256iZero(cZero);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(Pad)
+        __m256i pos0;
+        __m256i pix0;
+
+        p8PosInit(pos0, pos, xx);
+        Acc::m256iMaxPI32(pos0, pos0, cZero);
+        Acc::m256iMinPI32(pos0, pos0, cLen);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStore32u(dst, pix0);
+
+        dst += 32;
+        pos += xx * 8;
+
+        if (pos < posMin) pos = posMin;
+        if (pos > posMax) pos = posMax;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(Pad)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(Pad)
+        __m256i pos0;
+        __m256i pix0;
+
+        p8PosInit(pos0, pos, xx);
+        Acc::m256iMaxPI32(pos0, pos0, cZero);
+        Acc::m256iMinPI32(pos0, pos0, cLen);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+
+        dst += w * 4;
+        pos += xx * w;
+
+        if (pos < posMin) pos = posMin;
+        if (pos > posMax) pos = posMax;
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(Pad)
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += hole * xx;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Repeat]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_repeat_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len = ctx->_d.gradient.base.len16x16;
+    FOG_ASSERT((len & (len - 1)) == 0);
+
+    // Unsigned arithmetic, the position wraps around the table length so the
+    // overflow is harmless.
+    uint pos = (uint)Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + (uint)x * (uint)xx;
+
+    __m256i cMask;
+    Acc::m256iExpandPI32FromSI32(cMask, len - 1);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(Repeat)
+        __m256i pos0;
+        __m256i pix0;
+
+        p8PosInit(pos0, (int)(pos & (uint)(len - 1)), xx);
+        Acc::m256iAnd(pos0, pos0, cMask);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStore32u(dst, pix0);
+
+        dst += 32;
+        pos += (uint)xx * 8;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(Repeat)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(Repeat)
+        __m256i pos0;
+        __m256i pix0;
+
+        p8PosInit(pos0, (int)(pos & (uint)(len - 1)), xx);
+        Acc::m256iAnd(pos0, pos0, cMask);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+
+        dst += w * 4;
+        pos += (uint)xx * (uint)w;
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(Repeat)
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += (uint)hole * (uint)xx;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Reflect]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_reflect_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len2 = ctx->_d.gradient.base.len16x16 * 2;
+    FOG_ASSERT((len2 & (len2 - 1)) == 0);
+
+    uint pos = (uint)Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + (uint)x * (uint)xx;
+
+    __m256i cMask;
+    __m256i cLen2;
+
+    Acc::m256iExpandPI32FromSI32(cMask, len2 - 1);
+    Acc::m256iExpandPI32FromSI32(cLen2, len2);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      // The position is wrapped to [0, len2), positions above len are
+      // reflected by 'len2 - pos', which is the smaller of 'pos' and
+      // 'len2 - pos' (exactly the same value the C fetcher produces).
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(Reflect)
+        __m256i pos0, pos1;
+        __m256i pix0;
+
+        p8PosInit(pos0, (int)(pos & (uint)(len2 - 1)), xx);
+        Acc::m256iAnd(pos0, pos0, cMask);
+        Acc::m256iSubPI32(pos1, cLen2, pos0);
+        Acc::m256iMinPI32(pos0, pos0, pos1);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStore32u(dst, pix0);
+
+        dst += 32;
+        pos += (uint)xx * 8;
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(Reflect)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(Reflect)
+        __m256i pos0, pos1;
+        __m256i pix0;
+
+        p8PosInit(pos0, (int)(pos & (uint)(len2 - 1)), xx);
+        Acc::m256iAnd(pos0, pos0, cMask);
+        Acc::m256iSubPI32(pos1, cLen2, pos0);
+        Acc::m256iMinPI32(pos0, pos0, pos1);
+
+        p8FetchRaw(pix0, table, pos0);
+        Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+
+        dst += w * 4;
+        pos += (uint)xx * (uint)w;
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(Reflect)
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += (uint)hole * (uint)xx;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTLINEAR_P_H
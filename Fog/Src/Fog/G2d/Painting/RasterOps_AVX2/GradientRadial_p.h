@@ -0,0 +1,227 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTRADIAL_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTRADIAL_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientBase_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/GradientRadial_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - PGradientRadial]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Radial gradient fetchers (simple transform, nearest).
+//!
+//! The C fetcher uses forward differencing, which serializes the loop. The
+//! AVX2 version evaluates the equation directly for 8 pixels (two vectors of
+//! 4 doubles), the position of each pixel is 'p + i * xx', so the result may
+//! differ from C by one table entry because of rounding.
+struct FOG_NO_EXPORT PGradientRadial
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get table positions of 8 pixels (as doubles) at @a px / @a py.
+  static FOG_INLINE void p8Position(__m256d& dst0, __m256d& dst1,
+    const __m256d& px0, const __m256d& px1,
+    const __m256d& py0, const __m256d& py1,
+    const RasterPattern* ctx)
+  {
+    __m256d fx = _mm256_set1_pd(ctx->_d.gradient.radial.simple.fx);
+    __m256d fy = _mm256_set1_pd(ctx->_d.gradient.radial.simple.fy);
+    __m256d c1 = _mm256_set1_pd(ctx->_d.gradient.radial.simple.r2mfyfy);
+    __m256d c2 = _mm256_set1_pd(ctx->_d.gradient.radial.simple.r2mfxfx);
+    __m256d c3 = _mm256_set1_pd(ctx->_d.gradient.radial.simple._2_fxfy);
+    __m256d scale = _mm256_set1_pd(ctx->_d.gradient.radial.simple.scale);
+
+    __m256d b0, b1;
+    __m256d d0, d1;
+    __m256d t0, t1;
+
+    // b = x * fx + y * fy
+    Acc::m256dMul(b0, px0, fx);
+    Acc::m256dMul(b1, px1, fx);
+    Acc::m256dMul(t0, py0, fy);
+    Acc::m256dMul(t1, py1, fy);
+    Acc::m256dAdd(b0, b0, t0);
+    Acc::m256dAdd(b1, b1, t1);
+
+    // d = x^2 * C1 + y^2 * C2 + x*y * C3
+    Acc::m256dMul(d0, _mm256_mul_pd(px0, px0), c1);
+    Acc::m256dMul(d1, _mm256_mul_pd(px1, px1), c1);
+
+    Acc::m256dMul(t0, _mm256_mul_pd(py0, py0), c2);
+    Acc::m256dMul(t1, _mm256_mul_pd(py1, py1), c2);
+    Acc::m256dAdd(d0, d0, t0);
+    Acc::m256dAdd(d1, d1, t1);
+
+    Acc::m256dMul(t0, _mm256_mul_pd(px0, py0), c3);
+    Acc::m256dMul(t1, _mm256_mul_pd(px1, py1), c3);
+    Acc::m256dAdd(d0, d0, t0);
+    Acc::m256dAdd(d1, d1, t1);
+
+    // pos = (b + sqrt(|d|)) * scale
+    Acc::m256dAbs(d0, d0);
+    Acc::m256dAbs(d1, d1);
+    Acc::m256dSqrt(d0, d0);
+    Acc::m256dSqrt(d1, d1);
+
+    Acc::m256dAdd(d0, d0, b0);
+    Acc::m256dAdd(d1, d1, b1);
+    Acc::m256dMul(dst0, d0, scale);
+    Acc::m256dMul(dst1, d1, scale);
+  }
+
+  // ==========================================================================
+  // [Helpers - Spread]
+  // ==========================================================================
+
+  //! @brief Convert positions to table indices, the same as
+  //! @c RasterOps_C::PGradientAccessor_PRGB32_XXX::fetchAtD().
+  template<uint32_t Spread>
+  static FOG_INLINE void p8Index(__m256i& dst0, const __m256d& pos0, const __m256d& pos1, int len)
+  {
+    if (Spread == GRADIENT_SPREAD_PAD)
+    {
+      __m256d zero = _mm256_setzero_pd();
+      __m256d lenD = _mm256_set1_pd((double)len);
+      __m256d t0, t1;
+
+      Acc::m256dMax(t0, pos0, zero);
+      Acc::m256dMax(t1, pos1, zero);
+      Acc::m256dMin(t0, t0, lenD);
+      Acc::m256dMin(t1, t1, lenD);
+      Acc::m256iCvttPI32FromPD_2x(dst0, t0, t1);
+    }
+    else if (Spread == GRADIENT_SPREAD_REPEAT)
+    {
+      __m256i mask;
+
+      Acc::m256iExpandPI32FromSI32(mask, len - 1);
+      Acc::m256iCvttPI32FromPD_2x(dst0, pos0, pos1);
+      Acc::m256iAnd(dst0, dst0, mask);
+    }
+    else
+    {
+      __m256i mask2;
+      __m256i lenI;
+      __m256i t0;
+
+      Acc::m256iExpandPI32FromSI32(mask2, len * 2 - 1);
+      Acc::m256iExpandPI32FromSI32(lenI, len);
+
+      Acc::m256iCvttPI32FromPD_2x(dst0, pos0, pos1);
+      Acc::m256iAnd(dst0, dst0, mask2);
+
+      // if (i > len) i ^= mask2;
+      Acc::m256iCmpGtPI32(t0, dst0, lenI);
+      Acc::m256iAnd(t0, t0, mask2);
+      Acc::m256iXor(dst0, dst0, t0);
+    }
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple]
+  // ==========================================================================
+
+  template<uint32_t Spread>
+  static void FOG_FASTCALL fetch_simple_nearest_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+    int len = ctx->_d.gradient.base.len;
+
+    __m256d xxStep;
+    __m256d xyStep;
+    __m256d xx0, xx1;
+    __m256d xy0, xy1;
+
+    {
+      double xx = ctx->_d.gradient.radial.simple.xx;
+      double xy = ctx->_d.gradient.radial.simple.xy;
+
+      xxStep = _mm256_set1_pd(xx * 8.0);
+      xyStep = _mm256_set1_pd(xy * 8.0);
+
+      xx0 = _mm256_set_pd(xx * 3.0, xx * 2.0, xx, 0.0);
+      xx1 = _mm256_set_pd(xx * 7.0, xx * 6.0, xx * 5.0, xx * 4.0);
+      xy0 = _mm256_set_pd(xy * 3.0, xy * 2.0, xy, 0.0);
+      xy1 = _mm256_set_pd(xy * 7.0, xy * 6.0, xy * 5.0, xy * 4.0);
+    }
+
+    P_FETCH_SPAN8_INIT()
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double px = _x * ctx->_d.gradient.radial.simple.xx + fetcher->_d.gradient.radial.simple.px;
+      double py = _x * ctx->_d.gradient.radial.simple.xy + fetcher->_d.gradient.radial.simple.py;
+
+      __m256d px0 = _mm256_add_pd(_mm256_set1_pd(px), xx0);
+      __m256d px1 = _mm256_add_pd(_mm256_set1_pd(px), xx1);
+      __m256d py0 = _mm256_add_pd(_mm256_set1_pd(py), xy0);
+      __m256d py1 = _mm256_add_pd(_mm256_set1_pd(py), xy1);
+
+      FOG_BLIT_LOOP_32x8_AVX2_INIT()
+
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_BEGIN(Simple)
+        __m256d pos0, pos1;
+        __m256i idx0;
+        __m256i pix0;
+
+        p8Position(pos0, pos1, px0, px1, py0, py1, ctx);
+        p8Index<Spread>(idx0, pos0, pos1, len);
+
+        Acc::m256iGatherPI32(pix0, table, idx0);
+        Acc::m256iStore32u(dst, pix0);
+
+        dst += 32;
+        Acc::m256dAdd(px0, px0, xxStep);
+        Acc::m256dAdd(px1, px1, xxStep);
+        Acc::m256dAdd(py0, py0, xyStep);
+        Acc::m256dAdd(py1, py1, xyStep);
+      FOG_BLIT_LOOP_32x8_AVX2_MAIN_END(Simple)
+
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_BEGIN(Simple)
+        __m256d pos0, pos1;
+        __m256i idx0;
+        __m256i pix0;
+
+        p8Position(pos0, pos1, px0, px1, py0, py1, ctx);
+        p8Index<Spread>(idx0, pos0, pos1, len);
+
+        Acc::m256iGatherPI32(pix0, table, idx0);
+        Acc::m256iStoreMaskPI32(dst, pix0, _tailMask);
+
+        dst += w * 4;
+      FOG_BLIT_LOOP_32x8_AVX2_TAIL_END(Simple)
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientRadial::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_GRADIENTRADIAL_P_H
@@ -0,0 +1,544 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_TEXTUREAFFINE_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_TEXTUREAFFINE_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/TextureAffine_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/TextureBase_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - PTextureAffine]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Affine texture fetchers (bilinear).
+//!
+//! Only the fixed-point path is vectorized. The positions of 8 pixels are
+//! kept in registers, the four neighbors of each pixel are fetched by gathers
+//! and interpolated using exactly the same weights as the C fetcher, so the
+//! output is identical. The fixed-point position is recalculated every
+//! @c RasterOps_C::PTextureAffine::MAX_FIXED_STEP pixels, like in C.
+struct FOG_NO_EXPORT PTextureAffine
+{
+  // ==========================================================================
+  // [Constants]
+  // ==========================================================================
+
+  enum { MAX_FIXED_STEP = RasterOps_C::PTextureAffine::MAX_FIXED_STEP };
+
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get whether the texture can be addressed by 32-bit gather offsets.
+  static FOG_INLINE bool canGather(const RasterPattern* ctx)
+  {
+    ssize_t stride = ctx->_d.texture.base.stride;
+    int th = ctx->_d.texture.base.h;
+
+    return stride > 0 && (uint64_t)stride * (uint)th <= (uint64_t)INT_MAX;
+  }
+
+  //! @brief Get 8 fixed-point positions starting at @a pos, advancing by @a d.
+  static FOG_INLINE void p8PosInit(__m256i& dst0, int pos, int d)
+  {
+    __m256i t0;
+
+    Acc::m256iExpandPI32FromSI32(dst0, pos);
+    Acc::m256iExpandPI32FromSI32(t0, d);
+
+    Acc::m256iMulLoPI32(t0, t0, FOG_YMM_GET_CONST_PI(m256i_76543210));
+    Acc::m256iAddPI32(dst0, dst0, t0);
+  }
+
+  //! @brief Get bilinear weight (0-255) from 16.16 fixed-point positions.
+  static FOG_INLINE void p8Weight(__m256i& dst0, const __m256i& pos0)
+  {
+    Acc::m256iRShiftPU32<8>(dst0, pos0);
+    Acc::m256iAnd(dst0, dst0, FOG_YMM_GET_CONST_PI(m256i_00FF));
+  }
+
+  //! @brief Interpolate four neighbors of 8 pixels.
+  //!
+  //! The weights are calculated the same way as in C:
+  //!
+  //!   w00 = ((256 - wx) * (256 - wy)) >> 8
+  //!   w10 = ((      wx) * (256 - wy)) >> 8
+  //!   w01 = ((256 - wx) * (      wy)) >> 8
+  //!   w11 = ((      wx) * (      wy)) >> 8
+  //!
+  //!   dst = (p00 * w00 + p10 * w10 + p01 * w01 + p11 * w11) >> 8
+  static FOG_INLINE void p8Interpolate(__m256i& dst0,
+    const __m256i& p00, const __m256i& p10,
+    const __m256i& p01, const __m256i& p11,
+    const __m256i& wx, const __m256i& wy)
+  {
+    __m256i c256;
+    __m256i iwx, iwy;
+    __m256i w00, w10, w01, w11;
+
+    Acc::m256iExpandPI32FromSI32(c256, 256);
+    Acc::m256iSubPI32(iwx, c256, wx);
+    Acc::m256iSubPI32(iwy, c256, wy);
+
+    Acc::m256iMulLoPI32(w00, iwx, iwy);
+    Acc::m256iMulLoPI32(w10, wx, iwy);
+    Acc::m256iMulLoPI32(w01, iwx, wy);
+    Acc::m256iMulLoPI32(w11, wx, wy);
+
+    Acc::m256iRShiftPU32<8>(w00, w00);
+    Acc::m256iRShiftPU32<8>(w10, w10);
+    Acc::m256iRShiftPU32<8>(w01, w01);
+    Acc::m256iRShiftPU32<8>(w11, w11);
+
+    __m256i a0, a1;
+    __m256i t0, t1;
+    __m256i m0, m1;
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, w00);
+    Acc::m256iUnpackPI16FromPI8Lo(a0, p00);
+    Acc::m256iUnpackPI16FromPI8Hi(a1, p00);
+    Acc::m256iMulLoPI16(a0, a0, m0);
+    Acc::m256iMulLoPI16(a1, a1, m1);
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, w10);
+    Acc::m256iUnpackPI16FromPI8Lo(t0, p10);
+    Acc::m256iUnpackPI16FromPI8Hi(t1, p10);
+    Acc::m256iMulLoPI16(t0, t0, m0);
+    Acc::m256iMulLoPI16(t1, t1, m1);
+    Acc::m256iAddPI16(a0, a0, t0);
+    Acc::m256iAddPI16(a1, a1, t1);
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, w01);
+    Acc::m256iUnpackPI16FromPI8Lo(t0, p01);
+    Acc::m256iUnpackPI16FromPI8Hi(t1, p01);
+    Acc::m256iMulLoPI16(t0, t0, m0);
+    Acc::m256iMulLoPI16(t1, t1, m1);
+    Acc::m256iAddPI16(a0, a0, t0);
+    Acc::m256iAddPI16(a1, a1, t1);
+
+    Acc::m256iUnpackMaskPI16FromPI32(m0, m1, w11);
+    Acc::m256iUnpackPI16FromPI8Lo(t0, p11);
+    Acc::m256iUnpackPI16FromPI8Hi(t1, p11);
+    Acc::m256iMulLoPI16(t0, t0, m0);
+    Acc::m256iMulLoPI16(t1, t1, m1);
+    Acc::m256iAddPI16(a0, a0, t0);
+    Acc::m256iAddPI16(a1, a1, t1);
+
+    Acc::m256iRShiftPU16<8>(a0, a0);
+    Acc::m256iRShiftPU16<8>(a1, a1);
+    Acc::m256iPackPU8FromPU16(dst0, a0, a1);
+  }
+
+  //! @brief Fetch and interpolate 8 pixels.
+  //!
+  //! @a x0 and @a x1 are byte offsets of the left and right neighbors, @a y0
+  //! and @a y1 are byte offsets of the top and bottom scanlines.
+  template<uint32_t SrcFormat>
+  static FOG_INLINE void p8FetchBilinear(__m256i& dst0, const uint8_t* srcPixels,
+    const __m256i& x0, const __m256i& x1,
+    const __m256i& y0, const __m256i& y1,
+    const __m256i& wx, const __m256i& wy)
+  {
+    __m256i p00, p10, p01, p11;
+
+    Acc::m256iGatherPI32Bytes(p00, srcPixels, _mm256_add_epi32(y0, x0));
+    Acc::m256iGatherPI32Bytes(p10, srcPixels, _mm256_add_epi32(y0, x1));
+    Acc::m256iGatherPI32Bytes(p01, srcPixels, _mm256_add_epi32(y1, x0));
+    Acc::m256iGatherPI32Bytes(p11, srcPixels, _mm256_add_epi32(y1, x1));
+
+    p8Interpolate(dst0, p00, p10, p01, p11, wx, wy);
+
+    if (SrcFormat == IMAGE_FORMAT_XRGB32)
+      Acc::m256iFillPBB3(dst0, dst0);
+  }
+
+  // ==========================================================================
+  // [Helpers - Pad]
+  // ==========================================================================
+
+  //! @brief Get pad-clamped coordinates of the two neighbors (as scaled
+  //! offsets) and the weight.
+  static FOG_INLINE void p8PadCoords(__m256i& c0, __m256i& c1, __m256i& wc,
+    const __m256i& pos0, const __m256i& max0, const __m256i& scale0)
+  {
+    __m256i zero;
+    Acc::m256iZero(zero);
+
+    Acc::m256iRShiftPI32<16>(c0, pos0);
+    Acc::m256iAddPI32(c1, c0, _mm256_set1_epi32(1));
+
+    Acc::m256iMaxPI32(c0, c0, zero);
+    Acc::m256iMaxPI32(c1, c1, zero);
+    Acc::m256iMinPI32(c0, c0, max0);
+    Acc::m256iMinPI32(c1, c1, max0);
+
+    Acc::m256iMulLoPI32(c0, c0, scale0);
+    Acc::m256iMulLoPI32(c1, c1, scale0);
+
+    p8Weight(wc, pos0);
+  }
+
+  // ==========================================================================
+  // [Helpers - Repeat]
+  // ==========================================================================
+
+  //! @brief Initialize positions of 8 pixels, wrapping each one the same way
+  //! as the C fetcher does.
+  static FOG_INLINE void p8RepeatInit(__m256i& dst0, int pos, int d, int m, int r)
+  {
+    FOG_ALIGNED_VAR(int, lanes[8], 32);
+
+    for (int i = 0; i < 8; i++)
+    {
+      lanes[i] = pos;
+      pos += d;
+      if ((uint)pos >= (uint)m) pos += r;
+    }
+
+    Acc::m256iLoad32a(dst0, lanes);
+  }
+
+  //! @brief Advance repeated positions by @a step (less than the period).
+  static FOG_INLINE void p8RepeatAdvance(__m256i& pos0, const __m256i& step0, const __m256i& m0, const __m256i& r0)
+  {
+    __m256i t0;
+
+    Acc::m256iAddPI32(pos0, pos0, step0);
+    Acc::m256iCmpGePU32(t0, pos0, m0);
+    Acc::m256iAnd(t0, t0, r0);
+    Acc::m256iAddPI32(pos0, pos0, t0);
+  }
+
+  //! @brief Get the step of 8 pixels wrapped to the period @a m, the sign is
+  //! the same as the sign of @a d (the rewind value expects it).
+  static FOG_INLINE int p8RepeatStep(int d, int m)
+  {
+    return (int)(((int64_t)d * 8) % (int64_t)m);
+  }
+
+  //! @brief Get repeated coordinates of the two neighbors (as scaled
+  //! offsets) and the weight.
+  static FOG_INLINE void p8RepeatCoords(__m256i& c0, __m256i& c1, __m256i& wc,
+    const __m256i& pos0, const __m256i& max0, const __m256i& scale0)
+  {
+    __m256i t0;
+
+    Acc::m256iRShiftPU32<16>(c0, pos0);
+    Acc::m256iAddPI32(c1, c0, _mm256_set1_epi32(1));
+
+    // if (++c1 > max) c1 = 0;
+    Acc::m256iCmpGtPI32(t0, c1, max0);
+    Acc::m256iAndNot(c1, t0, c1);
+
+    Acc::m256iMulLoPI32(c0, c0, scale0);
+    Acc::m256iMulLoPI32(c1, c1, scale0);
+
+    p8Weight(wc, pos0);
+  }
+
+  // ==========================================================================
+  // [Fetch - Affine (Bilinear) - Pad]
+  // ==========================================================================
+
+  template<uint32_t SrcFormat>
+  static void FOG_FASTCALL fetch_affine_bilinear_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+
+    if (!ctx->_d.texture.affine.safeFixedPoint || !canGather(ctx))
+    {
+      if (SrcFormat == IMAGE_FORMAT_XRGB32)
+        RasterOps_C::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>(fetcher, span, buffer);
+      else
+        RasterOps_C::PTextureAffine::fetch_affine_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w - 1;
+    int th = ctx->_d.texture.base.h - 1;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    int srcStride = (int)ctx->_d.texture.base.stride;
+
+    int xx16x16 = ctx->_d.texture.affine.xx16x16;
+    int xy16x16 = ctx->_d.texture.affine.xy16x16;
+    bool xyZero = ctx->_d.texture.affine.xyZero;
+
+    __m256i xStep, xMax, xScale;
+    __m256i yStep, yMax, yScale;
+
+    Acc::m256iExpandPI32FromSI32(xStep, xx16x16 * 8);
+    Acc::m256iExpandPI32FromSI32(xMax, tw);
+    Acc::m256iExpandPI32FromSI32(xScale, 4);
+
+    Acc::m256iExpandPI32FromSI32(yStep, xy16x16 * 8);
+    Acc::m256iExpandPI32FromSI32(yMax, th);
+    Acc::m256iExpandPI32FromSI32(yScale, srcStride);
+
+    // The scanlines don't change if the Y increment is zero.
+    __m256i y0, y1, wy;
+
+    if (xyZero)
+    {
+      __m256i py;
+
+      Acc::m256iExpandPI32FromSI32(py, Math::fixed16x16FromFloat(offy));
+      p8PadCoords(y0, y1, wy, py, yMax, yScale);
+    }
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(4)
+      double _x = (double)x;
+
+      for (;;)
+      {
+        int i = Math::min<int>(w, MAX_FIXED_STEP);
+        w -= i;
+
+        __m256i px;
+        __m256i py;
+
+        p8PosInit(px, Math::fixed16x16FromFloat(offx + _x * xx), xx16x16);
+        if (!xyZero)
+          p8PosInit(py, Math::fixed16x16FromFloat(offy + _x * xy), xy16x16);
+
+        for (;;)
+        {
+          __m256i x0, x1, wx;
+          __m256i pix0;
+
+          p8PadCoords(x0, x1, wx, px, xMax, xScale);
+          if (!xyZero)
+            p8PadCoords(y0, y1, wy, py, yMax, yScale);
+
+          p8FetchBilinear<SrcFormat>(pix0, srcPixels, x0, x1, y0, y1, wx, wy);
+
+          if (i >= 8)
+          {
+            Acc::m256iStore32u(dst, pix0);
+            dst += 32;
+
+            if ((i -= 8) == 0)
+              break;
+
+            Acc::m256iAddPI32(px, px, xStep);
+            if (!xyZero)
+              Acc::m256iAddPI32(py, py, yStep);
+          }
+          else
+          {
+            __m256i msk0;
+
+            Acc::m256iMaskFromCountPI32(msk0, i);
+            Acc::m256iStoreMaskPI32(dst, pix0, msk0);
+
+            dst += i * 4;
+            break;
+          }
+        }
+
+        if (w == 0) break;
+        _x += (double)MAX_FIXED_STEP;
+      }
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Affine (Bilinear) - Repeat]
+  // ==========================================================================
+
+  template<uint32_t SrcFormat>
+  static void FOG_FASTCALL fetch_affine_bilinear_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+
+    if (!ctx->_d.texture.affine.safeFixedPoint || !canGather(ctx))
+    {
+      if (SrcFormat == IMAGE_FORMAT_XRGB32)
+        RasterOps_C::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>(fetcher, span, buffer);
+      else
+        RasterOps_C::PTextureAffine::fetch_affine_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w - 1;
+    int th = ctx->_d.texture.base.h - 1;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    int srcStride = (int)ctx->_d.texture.base.stride;
+
+    int xx16x16 = ctx->_d.texture.affine.xx16x16;
+    int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+    int mx16x16 = ctx->_d.texture.affine.mx16x16;
+    int my16x16 = ctx->_d.texture.affine.my16x16;
+
+    int rx16x16 = ctx->_d.texture.affine.rx16x16;
+    int ry16x16 = ctx->_d.texture.affine.ry16x16;
+
+    bool xyZero = ctx->_d.texture.affine.xyZero;
+
+    __m256i xStep, xMod, xRewind, xMax, xScale;
+    __m256i yStep, yMod, yRewind, yMax, yScale;
+
+    Acc::m256iExpandPI32FromSI32(xStep, p8RepeatStep(xx16x16, mx16x16));
+    Acc::m256iExpandPI32FromSI32(xMod, mx16x16);
+    Acc::m256iExpandPI32FromSI32(xRewind, rx16x16);
+    Acc::m256iExpandPI32FromSI32(xMax, tw);
+    Acc::m256iExpandPI32FromSI32(xScale, 4);
+
+    Acc::m256iExpandPI32FromSI32(yStep, p8RepeatStep(xy16x16, my16x16));
+    Acc::m256iExpandPI32FromSI32(yMod, my16x16);
+    Acc::m256iExpandPI32FromSI32(yRewind, ry16x16);
+    Acc::m256iExpandPI32FromSI32(yMax, th);
+    Acc::m256iExpandPI32FromSI32(yScale, srcStride);
+
+    // The scanlines don't change if the Y increment is zero, the weight is
+    // calculated the same way as in C (from 24.8 fixed point).
+    __m256i y0, y1, wy;
+
+    if (xyZero)
+    {
+      int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+      FOG_ASSERT(py0 >= 0 && py0 <= th);
+
+      int py1 = py0 + 1;
+      if (py1 > th) py1 = 0;
+
+      Acc::m256iExpandPI32FromSI32(y0, py0 * srcStride);
+      Acc::m256iExpandPI32FromSI32(y1, py1 * srcStride);
+      Acc::m256iExpandPI32FromSI32(wy, Math::fixed24x8FromFloat(offy) & 0xFF);
+    }
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(4)
+      double _x = (double)x;
+
+      for (;;)
+      {
+        int i = Math::min<int>(w, MAX_FIXED_STEP);
+        w -= i;
+
+        __m256i px;
+        __m256i py;
+
+        p8RepeatInit(px, RasterOps_C::Helpers::p_repeat_integer(
+          Math::fixed16x16FromFloat(offx + _x * xx), mx16x16), xx16x16, mx16x16, rx16x16);
+
+        if (!xyZero)
+        {
+          p8RepeatInit(py, RasterOps_C::Helpers::p_repeat_integer(
+            Math::fixed16x16FromFloat(offy + _x * xy), my16x16), xy16x16, my16x16, ry16x16);
+        }
+
+        for (;;)
+        {
+          __m256i x0, x1, wx;
+          __m256i pix0;
+
+          p8RepeatCoords(x0, x1, wx, px, xMax, xScale);
+          if (!xyZero)
+            p8RepeatCoords(y0, y1, wy, py, yMax, yScale);
+
+          p8FetchBilinear<SrcFormat>(pix0, srcPixels, x0, x1, y0, y1, wx, wy);
+
+          if (i >= 8)
+          {
+            Acc::m256iStore32u(dst, pix0);
+            dst += 32;
+
+            if ((i -= 8) == 0)
+              break;
+
+            p8RepeatAdvance(px, xStep, xMod, xRewind);
+            if (!xyZero)
+              p8RepeatAdvance(py, yStep, yMod, yRewind);
+          }
+          else
+          {
+            __m256i msk0;
+
+            Acc::m256iMaskFromCountPI32(msk0, i);
+            Acc::m256iStoreMaskPI32(dst, pix0, msk0);
+
+            dst += i * 4;
+            break;
+          }
+        }
+
+        if (w == 0) break;
+        _x += (double)MAX_FIXED_STEP;
+      }
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_TEXTUREAFFINE_P_H
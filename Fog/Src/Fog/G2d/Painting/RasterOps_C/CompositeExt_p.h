@@ -6542,7 +6542,7 @@ struct FOG_NO_EXPORT CompositeExclusion : public CompositeExtPrgbVsPrgb<
     bool pack = false)
   {
     // Same as Difference.
-    prgb32_op_a8_2031(dst0p_20, a0p_20, dst0p_31, a0p_31, b0p_a8, pack);
+    CompositeDifference::prgb32_op_a8_2031(dst0p_20, a0p_20, dst0p_31, a0p_31, b0p_a8, pack);
   }
 
   // Dc' = Dc + Sa - 2.Sa.Dc.
@@ -111,19 +111,28 @@ struct FOG_NO_EXPORT PGradientConical
   static void FOG_FASTCALL prepare_simple(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
+
+    seek_simple(fetcher, _y);
+  }
+
+  // ==========================================================================
+  // [Seek]
+  // ==========================================================================
+
+  static FOG_INLINE void seek_simple(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
 
+    fetcher->_y = _y;
     fetcher->_d.gradient.conical.simple.px = y * ctx->_d.gradient.conical.simple.yx + ctx->_d.gradient.conical.simple.tx;
     fetcher->_d.gradient.conical.simple.py = y * ctx->_d.gradient.conical.simple.yy + ctx->_d.gradient.conical.simple.ty;
-
-    fetcher->_d.gradient.conical.simple.dx = d * ctx->_d.gradient.conical.simple.yx;
-    fetcher->_d.gradient.conical.simple.dy = d * ctx->_d.gradient.conical.simple.yy;
   }
 
   // ==========================================================================
@@ -170,8 +179,7 @@ struct FOG_NO_EXPORT PGradientConical
       P_FETCH_SPAN8_NEXT()
     P_FETCH_SPAN8_END()
 
-    fetcher->_d.gradient.conical.simple.px += fetcher->_d.gradient.conical.simple.dx;
-    fetcher->_d.gradient.conical.simple.py += fetcher->_d.gradient.conical.simple.dy;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -181,10 +189,7 @@ struct FOG_NO_EXPORT PGradientConical
   static void FOG_FASTCALL skip_simple(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.conical.simple.px += fetcher->_d.gradient.conical.simple.dx * s;
-    fetcher->_d.gradient.conical.simple.py += fetcher->_d.gradient.conical.simple.dy * s;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 };
 
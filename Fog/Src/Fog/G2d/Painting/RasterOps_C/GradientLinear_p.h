@@ -150,33 +150,50 @@ struct FOG_NO_EXPORT PGradientLinear
   static void FOG_FASTCALL prepare_simple(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
-    fetcher->_d.gradient.linear.simple.pt = y * ctx->_d.gradient.linear.simple.xy + ctx->_d.gradient.linear.simple.offset;
-    fetcher->_d.gradient.linear.simple.dt = d * ctx->_d.gradient.linear.simple.xy;
+    seek_simple(fetcher, _y);
   }
 
   static void FOG_FASTCALL prepare_proj(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
+
+    seek_proj(fetcher, _y);
+  }
+
+  // ==========================================================================
+  // [Seek]
+  // ==========================================================================
+
+  static FOG_INLINE void seek_simple(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
+    fetcher->_d.gradient.linear.simple.pt = y * ctx->_d.gradient.linear.simple.xy + ctx->_d.gradient.linear.simple.offset;
+  }
+
+  static FOG_INLINE void seek_proj(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
 
+    fetcher->_y = _y;
     fetcher->_d.gradient.linear.proj.pt = y * ctx->_d.gradient.linear.proj.xy + ctx->_d.gradient.linear.proj.xz;
-    fetcher->_d.gradient.linear.proj.dt = d * ctx->_d.gradient.linear.proj.xy;
     fetcher->_d.gradient.linear.proj.pz = y * ctx->_d.gradient.linear.proj.zy + ctx->_d.gradient.linear.proj.zz;
-    fetcher->_d.gradient.linear.proj.dz = d * ctx->_d.gradient.linear.proj.zy;
   }
 
   // ==========================================================================
@@ -304,7 +321,7 @@ _FetchSolidLoop:
     // ------------------------------------------------------------------------
 
 _End:
-    fetcher->_d.gradient.linear.simple.pt += fetcher->_d.gradient.linear.simple.dt;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -326,6 +343,9 @@ _End:
     int pos = Helpers::p_repeat_integer(
       Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + x * xx, len);
 
+    // The loops below expect that a single step never skips the whole table.
+    xx %= len;
+
     // ------------------------------------------------------------------------
     // [Forward Direction]
     // ------------------------------------------------------------------------
@@ -343,8 +363,7 @@ _End:
 
         P_FETCH_SPAN8_HOLE(
         {
-          pos += xx * hole;
-          if (pos > len) pos %= len;
+          pos = Helpers::p_repeat_integer(pos + xx * hole, len);
         })
       P_FETCH_SPAN8_END()
     }
@@ -394,7 +413,7 @@ _End:
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.gradient.linear.simple.pt += fetcher->_d.gradient.linear.simple.dt;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -417,6 +436,10 @@ _End:
     int pos = Helpers::p_repeat_integer(
       Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + x * xx, len2);
 
+    // The loops below expect that a single step never skips the whole table.
+    xx = Helpers::p_repeat_integer(xx, len2);
+    if (xx > len) xx -= len2;
+
     if (pos > len)
     {
       pos = len2 - pos;
@@ -495,7 +518,7 @@ _Backward:
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.gradient.linear.simple.pt += fetcher->_d.gradient.linear.simple.dt;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -539,8 +562,7 @@ _Backward:
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.gradient.linear.proj.pt += fetcher->_d.gradient.linear.proj.dt;
-    fetcher->_d.gradient.linear.proj.pz += fetcher->_d.gradient.linear.proj.dz;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -550,18 +572,13 @@ _Backward:
   static void FOG_FASTCALL skip_simple(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.linear.simple.pt += fetcher->_d.gradient.linear.simple.dt * s;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 
   static void FOG_FASTCALL skip_proj(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.linear.proj.pt += fetcher->_d.gradient.linear.proj.dt * s;
-    fetcher->_d.gradient.linear.proj.pz += fetcher->_d.gradient.linear.proj.dz * s;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 };
 
@@ -233,39 +233,52 @@ struct FOG_NO_EXPORT PGradientRadial
   static void FOG_FASTCALL prepare_simple(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
-    fetcher->_d.gradient.radial.simple.px = y * ctx->_d.gradient.radial.simple.yx + ctx->_d.gradient.radial.simple.tx;
-    fetcher->_d.gradient.radial.simple.py = y * ctx->_d.gradient.radial.simple.yy + ctx->_d.gradient.radial.simple.ty;
-
-    fetcher->_d.gradient.radial.simple.dx = d * ctx->_d.gradient.radial.simple.yx;
-    fetcher->_d.gradient.radial.simple.dy = d * ctx->_d.gradient.radial.simple.yy;
+    seek_simple(fetcher, _y);
   }
 
   static void FOG_FASTCALL prepare_proj(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
+    seek_proj(fetcher, _y);
+  }
+
+  // ==========================================================================
+  // [Seek]
+  // ==========================================================================
+
+  static FOG_INLINE void seek_simple(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
+    fetcher->_d.gradient.radial.simple.px = y * ctx->_d.gradient.radial.simple.yx + ctx->_d.gradient.radial.simple.tx;
+    fetcher->_d.gradient.radial.simple.py = y * ctx->_d.gradient.radial.simple.yy + ctx->_d.gradient.radial.simple.ty;
+  }
+
+  static FOG_INLINE void seek_proj(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
     fetcher->_d.gradient.radial.proj.px = y * ctx->_d.gradient.radial.proj.yx + ctx->_d.gradient.radial.proj.tx;
     fetcher->_d.gradient.radial.proj.py = y * ctx->_d.gradient.radial.proj.yy + ctx->_d.gradient.radial.proj.ty;
     fetcher->_d.gradient.radial.proj.pz = y * ctx->_d.gradient.radial.proj.yz + ctx->_d.gradient.radial.proj.tz;
-
-    fetcher->_d.gradient.radial.proj.dx = d * ctx->_d.gradient.radial.proj.yx;
-    fetcher->_d.gradient.radial.proj.dy = d * ctx->_d.gradient.radial.proj.yy;
-    fetcher->_d.gradient.radial.proj.dz = d * ctx->_d.gradient.radial.proj.yz;
   }
 
   // ==========================================================================
@@ -315,8 +328,7 @@ struct FOG_NO_EXPORT PGradientRadial
       P_FETCH_SPAN8_NEXT()
     P_FETCH_SPAN8_END()
 
-    fetcher->_d.gradient.radial.simple.px += fetcher->_d.gradient.radial.simple.dx;
-    fetcher->_d.gradient.radial.simple.py += fetcher->_d.gradient.radial.simple.dy;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -368,9 +380,7 @@ struct FOG_NO_EXPORT PGradientRadial
       P_FETCH_SPAN8_NEXT()
     P_FETCH_SPAN8_END()
 
-    fetcher->_d.gradient.radial.proj.px += fetcher->_d.gradient.radial.proj.dx;
-    fetcher->_d.gradient.radial.proj.py += fetcher->_d.gradient.radial.proj.dy;
-    fetcher->_d.gradient.radial.proj.pz += fetcher->_d.gradient.radial.proj.dz;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -380,20 +390,13 @@ struct FOG_NO_EXPORT PGradientRadial
   static void FOG_FASTCALL skip_simple(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.radial.simple.px += fetcher->_d.gradient.radial.simple.dx * s;
-    fetcher->_d.gradient.radial.simple.py += fetcher->_d.gradient.radial.simple.dy * s;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 
   static void FOG_FASTCALL skip_proj(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.radial.proj.px += fetcher->_d.gradient.radial.proj.dx * s;
-    fetcher->_d.gradient.radial.proj.py += fetcher->_d.gradient.radial.proj.dy * s;
-    fetcher->_d.gradient.radial.proj.pz += fetcher->_d.gradient.radial.proj.dz * s;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 };
 
@@ -140,39 +140,52 @@ struct FOG_NO_EXPORT PGradientRectangular
   static void FOG_FASTCALL prepare_simple(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
-    fetcher->_d.gradient.rectangular.simple.px = y * ctx->_d.gradient.rectangular.simple.yx + ctx->_d.gradient.rectangular.simple.tx;
-    fetcher->_d.gradient.rectangular.simple.py = y * ctx->_d.gradient.rectangular.simple.yy + ctx->_d.gradient.rectangular.simple.ty;
-
-    fetcher->_d.gradient.rectangular.simple.dx = d * ctx->_d.gradient.rectangular.simple.yx;
-    fetcher->_d.gradient.rectangular.simple.dy = d * ctx->_d.gradient.rectangular.simple.yy;
+    seek_simple(fetcher, _y);
   }
 
   static void FOG_FASTCALL prepare_proj(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
+    seek_proj(fetcher, _y);
+  }
+
+  // ==========================================================================
+  // [Seek]
+  // ==========================================================================
+
+  static FOG_INLINE void seek_simple(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
+    fetcher->_d.gradient.rectangular.simple.px = y * ctx->_d.gradient.rectangular.simple.yx + ctx->_d.gradient.rectangular.simple.tx;
+    fetcher->_d.gradient.rectangular.simple.py = y * ctx->_d.gradient.rectangular.simple.yy + ctx->_d.gradient.rectangular.simple.ty;
+  }
+
+  static FOG_INLINE void seek_proj(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
     fetcher->_d.gradient.rectangular.proj.px = y * ctx->_d.gradient.rectangular.proj.yx + ctx->_d.gradient.rectangular.proj.tx;
     fetcher->_d.gradient.rectangular.proj.py = y * ctx->_d.gradient.rectangular.proj.yy + ctx->_d.gradient.rectangular.proj.ty;
     fetcher->_d.gradient.rectangular.proj.pz = y * ctx->_d.gradient.rectangular.proj.yz + ctx->_d.gradient.rectangular.proj.tz;
-
-    fetcher->_d.gradient.rectangular.proj.dx = d * ctx->_d.gradient.rectangular.proj.yx;
-    fetcher->_d.gradient.rectangular.proj.dy = d * ctx->_d.gradient.rectangular.proj.yy;
-    fetcher->_d.gradient.rectangular.proj.dz = d * ctx->_d.gradient.rectangular.proj.yz;
   }
 
   // ==========================================================================
@@ -219,8 +232,7 @@ struct FOG_NO_EXPORT PGradientRectangular
       P_FETCH_SPAN8_NEXT()
     P_FETCH_SPAN8_END()
 
-    fetcher->_d.gradient.rectangular.simple.px += fetcher->_d.gradient.rectangular.simple.dx;
-    fetcher->_d.gradient.rectangular.simple.py += fetcher->_d.gradient.rectangular.simple.dy;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -278,9 +290,7 @@ struct FOG_NO_EXPORT PGradientRectangular
       P_FETCH_SPAN8_NEXT()
     P_FETCH_SPAN8_END()
 
-    fetcher->_d.gradient.rectangular.proj.px += fetcher->_d.gradient.rectangular.proj.dx;
-    fetcher->_d.gradient.rectangular.proj.py += fetcher->_d.gradient.rectangular.proj.dy;
-    fetcher->_d.gradient.rectangular.proj.pz += fetcher->_d.gradient.rectangular.proj.dz;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // ==========================================================================
@@ -290,20 +300,13 @@ struct FOG_NO_EXPORT PGradientRectangular
   static void FOG_FASTCALL skip_simple(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.rectangular.simple.px += fetcher->_d.gradient.rectangular.simple.dx * s;
-    fetcher->_d.gradient.rectangular.simple.py += fetcher->_d.gradient.rectangular.simple.dy * s;
+    seek_simple(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 
   static void FOG_FASTCALL skip_proj(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.gradient.rectangular.proj.px += fetcher->_d.gradient.rectangular.proj.dx * s;
-    fetcher->_d.gradient.rectangular.proj.py += fetcher->_d.gradient.rectangular.proj.dy * s;
-    fetcher->_d.gradient.rectangular.proj.pz += fetcher->_d.gradient.rectangular.proj.dz * s;
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 };
 
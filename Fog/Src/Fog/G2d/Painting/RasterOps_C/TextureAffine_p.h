@@ -170,8 +170,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -436,8 +435,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -603,13 +601,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
-
-    if (fetcher->_d.texture.affine.py < 0.0)
-      fetcher->_d.texture.affine.py += ctx->_d.texture.affine.my;
-    if (fetcher->_d.texture.affine.py >= ctx->_d.texture.affine.my)
-      fetcher->_d.texture.affine.py -= ctx->_d.texture.affine.my;
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -847,13 +839,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
-
-    if (fetcher->_d.texture.affine.py < 0.0)
-      fetcher->_d.texture.affine.py += ctx->_d.texture.affine.my;
-    if (fetcher->_d.texture.affine.py >= ctx->_d.texture.affine.my)
-      fetcher->_d.texture.affine.py -= ctx->_d.texture.affine.my;
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -1030,13 +1016,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
-
-    if (fetcher->_d.texture.affine.py < 0.0)
-      fetcher->_d.texture.affine.py += ctx->_d.texture.affine.my;
-    if (fetcher->_d.texture.affine.py >= ctx->_d.texture.affine.my)
-      fetcher->_d.texture.affine.py -= ctx->_d.texture.affine.my;
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -1275,13 +1255,7 @@ struct FOG_NO_EXPORT PTextureAffine
     // [Advance]
     // ------------------------------------------------------------------------
 
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
-
-    if (fetcher->_d.texture.affine.py < 0.0)
-      fetcher->_d.texture.affine.py += ctx->_d.texture.affine.my;
-    if (fetcher->_d.texture.affine.py >= ctx->_d.texture.affine.my)
-      fetcher->_d.texture.affine.py -= ctx->_d.texture.affine.my;
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -1468,8 +1442,7 @@ _FetchSolid:
     // ------------------------------------------------------------------------
 
 _FetchEnd:
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
   }
 
   // --------------------------------------------------------------------------
@@ -1793,8 +1766,260 @@ _FixedScaleInterpolate:
     // ------------------------------------------------------------------------
 
 _FetchEnd:
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy;
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Helpers]
+  // --------------------------------------------------------------------------
+
+  //! @brief Calculate Catmull-Rom weights of 4 taps at the fraction @a t
+  //! (0...255). The weights can be negative, but their sum is always 256.
+  static FOG_INLINE void _bicubic_weights(int* w, int t)
+  {
+    int t2 = (t * t) >> 8;
+    int t3 = (t2 * t) >> 8;
+
+    w[0] = (-t3 + 2 * t2 - t) >> 1;
+    w[2] = (-3 * t3 + 4 * t2 + t) >> 1;
+    w[3] = (t3 - t2) >> 1;
+    w[1] = 256 - w[0] - w[2] - w[3];
+  }
+
+  //! @brief Map the tap index @a i to the texture of @a size, returns -1 if
+  //! the tap is outside of the texture and @a TileMode is TEXTURE_TILE_CLAMP.
+  template<uint32_t TileMode>
+  static FOG_INLINE int _bicubic_index(int i, int size)
+  {
+    switch (TileMode)
+    {
+      case TEXTURE_TILE_PAD:
+        return Math::bound<int>(i, 0, size - 1);
+
+      case TEXTURE_TILE_REPEAT:
+        if ((uint)i >= (uint)size)
+        {
+          i %= size;
+          if (i < 0) i += size;
+        }
+        return i;
+
+      case TEXTURE_TILE_REFLECT:
+      {
+        int size2 = size * 2;
+        if ((uint)i >= (uint)size2)
+        {
+          i %= size2;
+          if (i < 0) i += size2;
+        }
+        if (i >= size) i = size2 - 1 - i;
+        return i;
+      }
+
+      case TEXTURE_TILE_CLAMP:
+      default:
+        return (uint)i < (uint)size ? i : -1;
+    }
+  }
+
+  //! @brief Bicubic fetch, common for all tile modes.
+  //!
+  //! The 4x4 neighbourhood of each pixel is convolved with the Catmull-Rom
+  //! kernel. The components are accumulated as signed integers and clamped
+  //! at the end so the color is never greater than the alpha (the kernel has
+  //! negative lobes, thus the premultiplied result can overshoot).
+  template<typename Accessor, uint32_t TileMode>
+  static FOG_INLINE void _fetch_affine_bicubic(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double mx = ctx->_d.texture.affine.mx;
+    double my = ctx->_d.texture.affine.my;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    // Used to check whether all 16 taps are inside the texture.
+    int tw3 = Math::max<int>(tw - 3, 0);
+    int th3 = Math::max<int>(th - 3, 0);
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+      double _x = (double)x;
+
+      double px = offx + _x * xx;
+      double py = offy + _x * xy;
+
+      do {
+        double fx = px;
+        double fy = py;
+
+        // Keep the position in a range where it can be converted to the fixed
+        // point, the taps outside of the texture are handled by the tile mode.
+        if (TileMode == TEXTURE_TILE_PAD || TileMode == TEXTURE_TILE_CLAMP)
+        {
+          fx = Math::bound<double>(fx, -4.0, mx + 4.0);
+          fy = Math::bound<double>(fy, -4.0, my + 4.0);
+        }
+        else
+        {
+          if (!(fx >= 0.0 && fx < mx)) fx = Math::repeat(fx, mx);
+          if (!(fy >= 0.0 && fy < my)) fy = Math::repeat(fy, my);
+        }
+
+        int fx24x8 = Math::fixed24x8FromFloat(fx);
+        int fy24x8 = Math::fixed24x8FromFloat(fy);
+
+        int wx[4];
+        int wy[4];
+
+        _bicubic_weights(wx, fx24x8 & 0xFF);
+        _bicubic_weights(wy, fy24x8 & 0xFF);
+
+        int tx[4];
+        const uint8_t* srcLine[4];
+
+        int x0 = (fx24x8 >> 8) - 1;
+        int y0 = (fy24x8 >> 8) - 1;
+
+        if (FOG_LIKELY(((uint)x0 < (uint)tw3) & ((uint)y0 < (uint)th3)))
+        {
+          for (int k = 0; k < 4; k++)
+          {
+            tx[k] = x0 + k;
+            srcLine[k] = srcPixels + (y0 + k) * srcStride;
+          }
+        }
+        else
+        {
+          for (int k = 0; k < 4; k++)
+          {
+            int ty = _bicubic_index<TileMode>(y0 + k, th);
+
+            tx[k] = _bicubic_index<TileMode>(x0 + k, tw);
+            srcLine[k] = (ty >= 0) ? srcPixels + ty * srcStride : NULL;
+          }
+        }
+
+        int c0 = 0x8000;
+        int c1 = 0x8000;
+        int c2 = 0x8000;
+        int c3 = 0x8000;
+
+        for (int j = 0; j < 4; j++)
+        {
+          int r0 = 0;
+          int r1 = 0;
+          int r2 = 0;
+          int r3 = 0;
+
+          for (int k = 0; k < 4; k++)
+          {
+            typename Accessor::Pixel pix;
+
+            if (TileMode == TEXTURE_TILE_CLAMP && (srcLine[j] == NULL || tx[k] < 0))
+              pix = clamp;
+            else
+              accessor.fetchNorm(pix, srcLine[j] + (uint)tx[k] * Accessor::SRC_BPP);
+
+            r0 += (int)((pix      ) & 0xFF) * wx[k];
+            r1 += (int)((pix >>  8) & 0xFF) * wx[k];
+            r2 += (int)((pix >> 16) & 0xFF) * wx[k];
+            r3 += (int)((pix >> 24)       ) * wx[k];
+          }
+
+          c0 += r0 * wy[j];
+          c1 += r1 * wy[j];
+          c2 += r2 * wy[j];
+          c3 += r3 * wy[j];
+        }
+
+        c3 = Math::bound<int>(c3 >> 16, 0, 255);
+        c0 = Math::bound<int>(c0 >> 16, 0, c3);
+        c1 = Math::bound<int>(c1 >> 16, 0, c3);
+        c2 = Math::bound<int>(c2 >> 16, 0, c3);
+
+        typename Accessor::Pixel pix = (uint32_t)(c0 | (c1 << 8) | (c2 << 16) | (c3 << 24));
+        accessor.store(dst, pix);
+
+        dst += Accessor::DST_BPP;
+        px += xx;
+        py += xy;
+      } while (--w);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_PAD>(fetcher, span, buffer);
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_REPEAT>(fetcher, span, buffer);
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_REFLECT>(fetcher, span, buffer);
+    PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_CLAMP>(fetcher, span, buffer);
+    PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
   }
 };
 
@@ -50,6 +50,53 @@ struct FOG_NO_EXPORT PTextureBase
       return Helpers::p_solid_create_color(ctx, dstFormat, clampColor);
     }
 
+    // ------------------------------------------------------------------------
+    // [Mipmap]
+    // ------------------------------------------------------------------------
+
+    // If the texture is scaled down more than twice then the filter skips the
+    // texels in between, which results in aliasing. The mip level closest to
+    // the destination size is used instead and the inverse transform is scaled
+    // to match it. The level can be used only if the whole image is fetched,
+    // the fragment boundaries would be blurred otherwise.
+    Image mipImage;
+    RectI mipFragment(UNINITIALIZED);
+
+    if (transformType > TRANSFORM_TYPE_TRANSLATION &&
+        transformType <= TRANSFORM_TYPE_AFFINE &&
+        imageQuality != IMAGE_QUALITY_NEAREST &&
+        srcFragment->x == 0 && srcFragment->y == 0 &&
+        srcFragment->w == srcImage->getWidth() &&
+        srcFragment->h == srcImage->getHeight())
+    {
+      // The texture step per destination pixel in both directions, the smaller
+      // one is used so the result is never more blurred than necessary.
+      double step = Math::min(Math::sqrt(inv._00 * inv._00 + inv._01 * inv._01),
+                              Math::sqrt(inv._10 * inv._10 + inv._11 * inv._11));
+      uint32_t level = 0;
+
+      while (step >= 2.0 && level < 31)
+      {
+        step *= 0.5;
+        level++;
+      }
+
+      if (level != 0 && srcImage->getMipLevel(mipImage, level) == ERR_OK && mipImage._d != srcImage->_d)
+      {
+        // The size of a level is rounded up, so the exact ratio is used.
+        double kx = (double)mipImage.getWidth() / (double)srcFragment->w;
+        double ky = (double)mipImage.getHeight() / (double)srcFragment->h;
+
+        inv._00 *= kx; inv._01 *= ky;
+        inv._10 *= kx; inv._11 *= ky;
+        inv._20 *= kx; inv._21 *= ky;
+
+        mipFragment.setRect(0, 0, mipImage.getWidth(), mipImage.getHeight());
+        srcImage = &mipImage;
+        srcFragment = &mipFragment;
+      }
+    }
+
     uint32_t srcFormat = srcImage->getFormat();
     uint32_t srcBPP = srcImage->getBytesPerPixel();
     uint32_t srcHasAlpha = (srcImage->getFormatDescription().getComponentMask() & IMAGE_COMPONENT_ALPHA) != 0;
@@ -333,6 +380,9 @@ _Has16BPC:
 
       if (imageQuality == IMAGE_QUALITY_NEAREST)
         ctx->_fetch = fetchFuncs->fetch_affine_nearest[srcFormat][tileMode];
+      else if ((imageQuality == IMAGE_QUALITY_BICUBIC || imageQuality == IMAGE_QUALITY_BICUBIC_HQ) &&
+               fetchFuncs->fetch_affine_bicubic[srcFormat][tileMode] != NULL)
+        ctx->_fetch = fetchFuncs->fetch_affine_bicubic[srcFormat][tileMode];
       else
         ctx->_fetch = fetchFuncs->fetch_affine_bilinear[srcFormat][tileMode];
       return ERR_OK;
@@ -343,9 +393,55 @@ _Has16BPC:
     // ------------------------------------------------------------------------
 
     {
-      // TODO: Not implemented.
-      ctx->_fetch = NULL;
-      return ERR_RT_NOT_IMPLEMENTED;
+      // The texture position of pixel [x, y] is taken at its center, which is
+      // [x + 0.5, y + 0.5], the seek functions start at 'tx', 'ty' and 'tz'.
+      ctx->_d.texture.proj.xx = inv._00;
+      ctx->_d.texture.proj.xy = inv._01;
+      ctx->_d.texture.proj.xz = inv._02;
+
+      ctx->_d.texture.proj.yx = inv._10;
+      ctx->_d.texture.proj.yy = inv._11;
+      ctx->_d.texture.proj.yz = inv._12;
+
+      ctx->_d.texture.proj.tx = 0.5 * (inv._00 + inv._10) + inv._20;
+      ctx->_d.texture.proj.ty = 0.5 * (inv._01 + inv._11) + inv._21;
+      ctx->_d.texture.proj.tz = 0.5 * (inv._02 + inv._12) + inv._22;
+
+      // Translate the center of pixel back if the filter is not NEAREST. The
+      // position is divided by 'z' so the translation is multiplied by it.
+      if (imageQuality != IMAGE_QUALITY_NEAREST)
+      {
+        ctx->_d.texture.proj.xx -= 0.5 * ctx->_d.texture.proj.xz;
+        ctx->_d.texture.proj.xy -= 0.5 * ctx->_d.texture.proj.xz;
+
+        ctx->_d.texture.proj.yx -= 0.5 * ctx->_d.texture.proj.yz;
+        ctx->_d.texture.proj.yy -= 0.5 * ctx->_d.texture.proj.yz;
+
+        ctx->_d.texture.proj.tx -= 0.5 * ctx->_d.texture.proj.tz;
+        ctx->_d.texture.proj.ty -= 0.5 * ctx->_d.texture.proj.tz;
+      }
+
+      ctx->_d.texture.proj.mx = (double)ctx->_d.texture.base.w;
+      ctx->_d.texture.proj.my = (double)ctx->_d.texture.base.h;
+
+      if (tileMode == TEXTURE_TILE_REFLECT)
+      {
+        ctx->_d.texture.proj.mx *= 2.0;
+        ctx->_d.texture.proj.my *= 2.0;
+      }
+
+      ctx->_d.texture.proj.mx24x8 = Math::fixed24x8FromFloat(ctx->_d.texture.proj.mx);
+      ctx->_d.texture.proj.my24x8 = Math::fixed24x8FromFloat(ctx->_d.texture.proj.my);
+
+      // Setup functions.
+      ctx->_prepare = prepare_proj;
+      ctx->_skip = skip_proj;
+
+      if (imageQuality == IMAGE_QUALITY_NEAREST)
+        ctx->_fetch = fetchFuncs->fetch_proj_nearest[srcFormat][tileMode];
+      else
+        ctx->_fetch = fetchFuncs->fetch_proj_bilinear[srcFormat][tileMode];
+      return ERR_OK;
     }
   }
 
@@ -403,37 +499,79 @@ _Has16BPC:
   static void FOG_FASTCALL prepare_affine_pad_clamp(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
-
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
 
-    fetcher->_d.texture.affine.px = y * ctx->_d.texture.affine.yx + ctx->_d.texture.affine.tx;
-    fetcher->_d.texture.affine.py = y * ctx->_d.texture.affine.yy + ctx->_d.texture.affine.ty;
-
-    fetcher->_d.texture.affine.dx = d * ctx->_d.texture.affine.yx;
-    fetcher->_d.texture.affine.dy = d * ctx->_d.texture.affine.yy;
+    seek_affine_pad_clamp(fetcher, _y);
   }
 
   static void FOG_FASTCALL prepare_affine_repeat_reflect(
     const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
   {
-    double y = (double)_y;
-    double d = (double)_delta;
+    fetcher->_ctx = ctx;
+    fetcher->_fetch = ctx->_fetch;
+    fetcher->_skip = ctx->_skip;
+    fetcher->_mode = mode;
+    fetcher->_delta = _delta;
+
+    seek_affine_repeat_reflect(fetcher, _y);
+  }
 
+  static void FOG_FASTCALL prepare_proj(
+    const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
+  {
     fetcher->_ctx = ctx;
     fetcher->_fetch = ctx->_fetch;
     fetcher->_skip = ctx->_skip;
     fetcher->_mode = mode;
+    fetcher->_delta = _delta;
+
+    seek_proj(fetcher, _y);
+  }
 
+  // ==========================================================================
+  // [Seek]
+  // ==========================================================================
+
+  // The position is calculated from the scanline, it's not accumulated, so
+  // the fetched pixels don't depend on the scanline where the fetcher was
+  // prepared (multithreaded paint-engine renders each band separately).
+
+  static FOG_INLINE void seek_affine_pad_clamp(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
+    fetcher->_d.texture.affine.px = y * ctx->_d.texture.affine.yx + ctx->_d.texture.affine.tx;
+    fetcher->_d.texture.affine.py = y * ctx->_d.texture.affine.yy + ctx->_d.texture.affine.ty;
+  }
+
+  static FOG_INLINE void seek_affine_repeat_reflect(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
     fetcher->_d.texture.affine.px = Math::repeat(y * ctx->_d.texture.affine.yx + ctx->_d.texture.affine.tx, ctx->_d.texture.affine.mx);
     fetcher->_d.texture.affine.py = Math::repeat(y * ctx->_d.texture.affine.yy + ctx->_d.texture.affine.ty, ctx->_d.texture.affine.my);
+  }
 
-    fetcher->_d.texture.affine.dx = Math::repeat(d * ctx->_d.texture.affine.yx, ctx->_d.texture.affine.mx);
-    fetcher->_d.texture.affine.dy = Math::repeat(d * ctx->_d.texture.affine.yy, ctx->_d.texture.affine.my);
+  static FOG_INLINE void seek_proj(
+    RasterPatternFetcher* fetcher, int _y)
+  {
+    const RasterPattern* ctx = fetcher->_ctx;
+    double y = (double)_y;
+
+    fetcher->_y = _y;
+    fetcher->_d.texture.proj.px = y * ctx->_d.texture.proj.yx + ctx->_d.texture.proj.tx;
+    fetcher->_d.texture.proj.py = y * ctx->_d.texture.proj.yy + ctx->_d.texture.proj.ty;
+    fetcher->_d.texture.proj.pz = y * ctx->_d.texture.proj.yz + ctx->_d.texture.proj.tz;
   }
 
   // ==========================================================================
@@ -463,23 +601,19 @@ _Has16BPC:
   static void FOG_FASTCALL skip_affine_pad_clamp(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.texture.affine.px += fetcher->_d.texture.affine.dx * s;
-    fetcher->_d.texture.affine.py += fetcher->_d.texture.affine.dy * s;
+    seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 
   static void FOG_FASTCALL skip_affine_repeat_reflect(
     RasterPatternFetcher* fetcher, int step)
   {
-    double s = (double)step;
-
-    fetcher->_d.texture.affine.px = Math::repeat(
-      fetcher->_d.texture.affine.px + fetcher->_d.texture.affine.dx * s,
-      fetcher->_ctx->_d.texture.affine.mx);
-    fetcher->_d.texture.affine.py = Math::repeat(
-      fetcher->_d.texture.affine.py + fetcher->_d.texture.affine.dy * s,
-      fetcher->_ctx->_d.texture.affine.my);
+    seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta * step);
+  }
+
+  static void FOG_FASTCALL skip_proj(
+    RasterPatternFetcher* fetcher, int step)
+  {
+    seek_proj(fetcher, fetcher->_y + fetcher->_delta * step);
   }
 };
 
@@ -545,6 +679,7 @@ struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_XRGB32 : public PTextureAccess
   FOG_INLINE PTextureAccessor_PRGB32_From_XRGB32(const RasterPattern* ctx) {}
 
   FOG_INLINE void fetchRaw(Pixel& dst, const uint8_t* src) { Acc::p32Load4a(dst, src); }
+  FOG_INLINE void fetchNorm(Pixel& dst, const uint8_t* src) { Acc::p32Load4a(dst, src); Acc::p32FillPBB3(dst, dst); }
 
   FOG_INLINE void interpolateRaw_2(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1)
   { P_INTERPOLATE_C_32_2(dst, c0, w0, c1, w1); }
@@ -566,6 +701,7 @@ struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_RGB24 : public PTextureAccesso
   FOG_INLINE PTextureAccessor_PRGB32_From_RGB24(const RasterPattern* ctx) {}
 
   FOG_INLINE void fetchRaw(Pixel& dst, const uint8_t* src) { Acc::p32Load3b(dst, src); }
+  FOG_INLINE void fetchNorm(Pixel& dst, const uint8_t* src) { Acc::p32Load3b(dst, src); Acc::p32FillPBB3(dst, dst); }
 
   FOG_INLINE void interpolateRaw_2(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1)
   { P_INTERPOLATE_C_32_2(dst, c0, w0, c1, w1); }
@@ -587,6 +723,7 @@ struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_A8 : public PTextureAccessor_P
   FOG_INLINE PTextureAccessor_PRGB32_From_A8(const RasterPattern* ctx) {}
 
   FOG_INLINE void fetchRaw(Pixel& dst, const uint8_t* p) { Acc::p32Load1b(dst, p); }
+  FOG_INLINE void fetchNorm(Pixel& dst, const uint8_t* p) { Acc::p32Load1b(dst, p); Acc::p32ExtendPBBFromSBB(dst, dst); }
 
   FOG_INLINE void interpolateRaw_2(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1)
   { dst = (c0 * w0 + c1 * w1) >> 8; }
@@ -608,6 +745,7 @@ struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_I8 : public PTextureAccessor_P
   FOG_INLINE PTextureAccessor_PRGB32_From_I8(const RasterPattern* ctx) : pal(ctx->_d.texture.base.pal) {}
 
   FOG_INLINE void fetchRaw(Pixel& dst, const uint8_t* src) { Acc::p32Load4a(dst, pal + src[0]); }
+  FOG_INLINE void fetchNorm(Pixel& dst, const uint8_t* src) { Acc::p32Load4a(dst, pal + src[0]); }
 
   FOG_INLINE void interpolateRaw_2(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1)
   { P_INTERPOLATE_C_32_2(dst, c0, w0, c1, w1); }
@@ -13,6 +13,916 @@
 namespace Fog {
 namespace RasterOps_C {
 
+// ============================================================================
+// [Fog::RasterOps_C - PTextureProjection]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Projection (perspective) texture fetchers.
+//!
+//! The texture position is divided exactly only once per segment of (at most)
+//! @c SPAN_STEP pixels, the position of pixels in between is interpolated
+//! linearly using 24.8 fixed point. Segments are shortened where the
+//! perspective is strong, see @c _segment().
+struct FOG_NO_EXPORT PTextureProjection
+{
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum
+  {
+    //! @brief Count of pixels between two exact divisions.
+    SPAN_STEP = 16,
+
+    //! @brief Maximum position (in texels), positions near the horizon are
+    //! bound to it so they can be converted to 24.8 fixed point.
+    MAX_POS = 1 << 21
+  };
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the texture position of the pixel @a x (exact division).
+  static FOG_INLINE void _project(double& u, double& v, double& z,
+    const RasterPattern* ctx, const RasterPatternFetcher* fetcher, double x)
+  {
+    z = x * ctx->_d.texture.proj.xz + fetcher->_d.texture.proj.pz;
+
+    if (Math::abs(z) < 1e-12)
+      z = 1e-12;
+
+    double rz = 1.0 / z;
+
+    u = (x * ctx->_d.texture.proj.xx + fetcher->_d.texture.proj.px) * rz;
+    v = (x * ctx->_d.texture.proj.xy + fetcher->_d.texture.proj.py) * rz;
+
+    u = Math::bound<double>(u, -(double)MAX_POS, (double)MAX_POS);
+    v = Math::bound<double>(v, -(double)MAX_POS, (double)MAX_POS);
+  }
+
+  //! @brief Get the texture position of the end of a segment, which starts at
+  //! the pixel @a x, and return the length of the segment.
+  //!
+  //! The length @a i is halved until the error of the linear interpolation is
+  //! below 1/8 of texel. The error is less than '|p1 - p0| * |z1 - z0| / (4 *
+  //! min(|z0|, |z1|))', so the exact division is done only once per segment
+  //! unless the perspective is very strong.
+  static FOG_INLINE int _segment(double& u1, double& v1, double& z1,
+    const RasterPattern* ctx, const RasterPatternFetcher* fetcher,
+    double x, int i, double u0, double v0, double z0)
+  {
+    for (;;)
+    {
+      _project(u1, v1, z1, ctx, fetcher, x + (double)i);
+      if (i == 1) break;
+
+      double e = (Math::abs(u1 - u0) + Math::abs(v1 - v0)) * Math::abs(z1 - z0);
+      double m = Math::min(Math::abs(z0), Math::abs(z1));
+
+      if (z0 * z1 > 0.0 && e <= 0.5 * m) break;
+      i >>= 1;
+    }
+
+    return i;
+  }
+
+  //! @brief Get the 24.8 fixed point position @a f and step @a d of a segment
+  //! of @a i pixels, which starts at @a p0 and ends at @a p1.
+  static FOG_INLINE void _step(int& f, int& d, double p0, double p1, int i)
+  {
+    f = Math::fixed24x8FromFloat(p0);
+    d = Math::fixed24x8FromFloat((p1 - p0) / (double)i);
+  }
+
+  //! @brief Like @c _step(), but the position and step are wrapped to [0, m),
+  //! so the position can be wrapped by a single subtraction per pixel.
+  static FOG_INLINE void _stepRepeat(int& f, int& d, double p0, double p1, int i, double m, int m24x8)
+  {
+    f = Math::fixed24x8FromFloat(Math::repeat(p0, m));
+    d = Math::fixed24x8FromFloat(Math::repeat((p1 - p0) / (double)i, m));
+
+    // Math::repeat() returns 'm' for a tiny negative argument.
+    if (f >= m24x8) f -= m24x8;
+    if (d >= m24x8) d -= m24x8;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _step(px, dx, u0, u1, i);
+        _step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = Math::bound<int>(px >> 8, 0, tw);
+          int py0 = Math::bound<int>(py >> 8, 0, th);
+
+          typename Accessor::Pixel pix;
+          accessor.fetchNorm(pix, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+          accessor.store(dst, pix);
+
+          dst += Accessor::DST_BPP;
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _step(px, dx, u0, u1, i);
+        _step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+          {
+            const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+            accessor.fetchRaw(pix_x0y0, srcLine);
+            accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+            srcLine += srcStride;
+            accessor.fetchRaw(pix_x0y1, srcLine);
+            accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+          }
+          else
+          {
+            int px1 = px0 + 1;
+            int py1 = py0 + 1;
+
+            if (px0 < 0) { px0 = px1 = 0; } else if (px0 >= tw) { px0 = px1 = tw; }
+            if (py0 < 0) { py0 = py1 = 0; } else if (py0 >= th) { py0 = py1 = th; }
+
+            const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+            const uint8_t* srcLine1 = srcPixels + (uint)py1 * srcStride;
+
+            accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+          }
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          accessor.interpolateRaw_4(pix_x0y0,
+            pix_x0y0, ((0x100 - wx) * (0x100 - wy)) >> 8,
+            pix_x1y0, ((wx        ) * (0x100 - wy)) >> 8,
+            pix_x0y1, ((0x100 - wx) * (wy        )) >> 8,
+            pix_x1y1, ((wx        ) * (wy        )) >> 8);
+          accessor.normalize(pix_x0y0, pix_x0y0);
+          accessor.store(dst, pix_x0y0);
+
+          dst += Accessor::DST_BPP;
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        _stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          typename Accessor::Pixel pix;
+          accessor.fetchNorm(pix, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+          accessor.store(dst, pix);
+
+          dst += Accessor::DST_BPP;
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        _stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          int px1 = px0 + 1;
+          int py1 = py0 + 1;
+
+          if (px1 > tw) px1 = 0;
+          if (py1 > th) py1 = 0;
+
+          const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+          const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          accessor.interpolateRaw_4(pix_x0y0,
+            pix_x0y0, ((0x100 - wx) * (0x100 - wy)) >> 8,
+            pix_x1y0, ((wx        ) * (0x100 - wy)) >> 8,
+            pix_x0y1, ((0x100 - wx) * (wy        )) >> 8,
+            pix_x1y1, ((wx        ) * (wy        )) >> 8);
+          accessor.normalize(pix_x0y0, pix_x0y0);
+          accessor.store(dst, pix_x0y0);
+
+          dst += Accessor::DST_BPP;
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        _stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          if (px0 > tw) px0 = tw2 - px0;
+          if (py0 > th) py0 = th2 - py0;
+
+          typename Accessor::Pixel pix;
+          accessor.fetchNorm(pix, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+          accessor.store(dst, pix);
+
+          dst += Accessor::DST_BPP;
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        _stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          int px1 = px0 + 1;
+          int py1 = py0 + 1;
+
+          // The position is in [0, tw2], wrap the neighbor first, then reflect.
+          if (px1 > tw2) px1 = 0;
+          if (py1 > th2) py1 = 0;
+
+          if (px0 > tw) px0 = tw2 - px0;
+          if (py0 > th) py0 = th2 - py0;
+          if (px1 > tw) px1 = tw2 - px1;
+          if (py1 > th) py1 = th2 - py1;
+
+          const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+          const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          accessor.interpolateRaw_4(pix_x0y0,
+            pix_x0y0, ((0x100 - wx) * (0x100 - wy)) >> 8,
+            pix_x1y0, ((wx        ) * (0x100 - wy)) >> 8,
+            pix_x0y1, ((0x100 - wx) * (wy        )) >> 8,
+            pix_x1y1, ((wx        ) * (wy        )) >> 8);
+          accessor.normalize(pix_x0y0, pix_x0y0);
+          accessor.store(dst, pix_x0y0);
+
+          dst += Accessor::DST_BPP;
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _step(px, dx, u0, u1, i);
+        _step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          if (((uint)px0 <= (uint)tw) & ((uint)py0 <= (uint)th))
+          {
+            typename Accessor::Pixel pix;
+            accessor.fetchNorm(pix, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+            accessor.store(dst, pix);
+          }
+          else
+          {
+            accessor.store(dst, clamp);
+          }
+
+          dst += Accessor::DST_BPP;
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      _project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = _segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        _step(px, dx, u0, u1, i);
+        _step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+          {
+            const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+            accessor.fetchRaw(pix_x0y0, srcLine);
+            accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+            srcLine += srcStride;
+            accessor.fetchRaw(pix_x0y1, srcLine);
+            accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+
+            accessor.interpolateRaw_4(pix_x0y0,
+              pix_x0y0, ((0x100 - wx) * (0x100 - wy)) >> 8,
+              pix_x1y0, ((wx        ) * (0x100 - wy)) >> 8,
+              pix_x0y1, ((0x100 - wx) * (wy        )) >> 8,
+              pix_x1y1, ((wx        ) * (wy        )) >> 8);
+            accessor.normalize(pix_x0y0, pix_x0y0);
+          }
+          else
+          {
+            int px1 = px0 + 1;
+            int py1 = py0 + 1;
+
+            pix_x0y0 = clamp;
+
+            if ((uint)px1 <= (uint)tw+1 && (uint)py1 <= (uint)th+1)
+            {
+              const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+              const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+              pix_x1y0 = clamp;
+              pix_x0y1 = clamp;
+              pix_x1y1 = clamp;
+
+              if ((uint)px0 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+              if ((uint)px1 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+              if ((uint)px0 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+              if ((uint)px1 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+              accessor.interpolateNorm_4(pix_x0y0,
+                pix_x0y0, ((0x100 - wx) * (0x100 - wy)) >> 8,
+                pix_x1y0, ((wx        ) * (0x100 - wy)) >> 8,
+                pix_x0y1, ((0x100 - wx) * (wy        )) >> 8,
+                pix_x1y1, ((wx        ) * (wy        )) >> 8);
+            }
+          }
+
+          accessor.store(dst, pix_x0y0);
+
+          dst += Accessor::DST_BPP;
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
 } // RasterOps_C namespace
 } // Fog namespace
 
@@ -199,6 +199,11 @@ _FetchEnd:
         src += Accessor::SRC_BPP;
 
         if (w == 0) goto _FetchSkip;
+        if (tw == 1)
+        {
+          c0 = norm0;
+          goto _FetchSolidLoop;
+        }
         goto _FetchFill;
       }
 
@@ -521,6 +526,7 @@ _FetchEnd:
           src += Accessor::SRC_BPP;
 
           if (w == 0) goto _FetchBorderSkip;
+          if (tw == 1) goto _FetchSolidLoop;
 
           accessor.fetchRaw(back0, src);
           goto _FetchBorderFill;
@@ -604,6 +610,11 @@ _FetchBorderSkip:
           dst = accessor.fill(dst, c0, i);
           if (w == 0) goto _FetchInsideSkip;
 
+          if (tw == 1)
+          {
+            back0 = c0;
+            goto _FetchSolidLoop;
+          }
           goto _FetchInsideFill;
         }
 
@@ -2205,13 +2216,13 @@ _FetchBorderSkip:
     else
     {
       const uint8_t* srcLine = ctx->_d.texture.base.pixels + y * ctx->_d.texture.base.stride;
-      const uint8_t* srcCur0 = srcLine;
-      const uint8_t* srcCur1 = srcLine + ctx->_d.texture.base.stride;
 
       P_FETCH_SPAN8_BEGIN()
         P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
         x += ctx->_d.texture.simple.tx;
 
+        const uint8_t* srcCur0 = srcLine;
+        const uint8_t* srcCur1 = srcLine + ctx->_d.texture.base.stride;
         int i;
 
         // --------------------------------------------------------------------
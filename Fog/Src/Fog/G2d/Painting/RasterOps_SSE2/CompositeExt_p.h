@@ -13,6 +13,1323 @@
 namespace Fog {
 namespace RasterOps_SSE2 {
 
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeExt - Src]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Source fetchers used by @c CompositeExtSeparable.
+//!
+//! Each fetcher returns the source pixels unpacked to 16-bit words and
+//! premultiplied, so XRGB32 and RGB24 get opaque alpha and A8 is expanded to
+//! all four components (premultiplied white). Fetching advances the source
+//! pointer, except for the solid source.
+struct FOG_NO_EXPORT CompositeExtSrcSolid
+{
+  FOG_INLINE CompositeExtSrcSolid(const RasterSolid* solid, bool opaque)
+  {
+    Acc::m128iCvtSI128FromSI(src0xmm, (int)solid->prgb32.u32);
+    if (opaque)
+      Acc::m128iOr(src0xmm, src0xmm, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+
+    Acc::m128iExtendPI32FromSI32(src0xmm, src0xmm);
+    Acc::m128iUnpackPI16FromPI8Lo(src0xmm, src0xmm);
+  }
+
+  FOG_INLINE void fetch1(__m128i& s0) { s0 = src0xmm; }
+  FOG_INLINE void fetch2(__m128i& s0) { s0 = src0xmm; }
+  FOG_INLINE void fetch4(__m128i& s0, __m128i& s1) { s0 = src0xmm; s1 = src0xmm; }
+  FOG_INLINE void skip(int n) {}
+
+  __m128i src0xmm;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtSrcPRGB32
+{
+  FOG_INLINE CompositeExtSrcPRGB32(const uint8_t* src) : src(src) {}
+
+  FOG_INLINE void fetch1(__m128i& s0)
+  {
+    Acc::m128iLoad4(s0, src);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 4;
+  }
+
+  FOG_INLINE void fetch2(__m128i& s0)
+  {
+    Acc::m128iLoad8(s0, src);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 8;
+  }
+
+  FOG_INLINE void fetch4(__m128i& s0, __m128i& s1)
+  {
+    Acc::m128iLoad16u(s0, src);
+    Acc::m128iUnpackPI16FromPI8Hi(s1, s0);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 16;
+  }
+
+  FOG_INLINE void skip(int n) { src += (uint)n * 4; }
+
+  const uint8_t* src;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtSrcXRGB32
+{
+  FOG_INLINE CompositeExtSrcXRGB32(const uint8_t* src) : src(src) {}
+
+  FOG_INLINE void fetch1(__m128i& s0)
+  {
+    Acc::m128iLoad4(s0, src);
+    Acc::m128iOr(s0, s0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 4;
+  }
+
+  FOG_INLINE void fetch2(__m128i& s0)
+  {
+    Acc::m128iLoad8(s0, src);
+    Acc::m128iOr(s0, s0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 8;
+  }
+
+  FOG_INLINE void fetch4(__m128i& s0, __m128i& s1)
+  {
+    Acc::m128iLoad16u(s0, src);
+    Acc::m128iOr(s0, s0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Hi(s1, s0);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    src += 16;
+  }
+
+  FOG_INLINE void skip(int n) { src += (uint)n * 4; }
+
+  const uint8_t* src;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtSrcRGB24
+{
+  FOG_INLINE CompositeExtSrcRGB24(const uint8_t* src) : src(src) {}
+
+  FOG_INLINE void _load1(__m128i& s0)
+  {
+    uint32_t p0;
+
+    Acc::p32Load3b(p0, src);
+    Acc::m128iCvtSI128FromSI(s0, (int)(p0 | 0xFF000000));
+    src += 3;
+  }
+
+  FOG_INLINE void fetch1(__m128i& s0)
+  {
+    _load1(s0);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+  }
+
+  FOG_INLINE void fetch2(__m128i& s0)
+  {
+    __m128i s1;
+
+    _load1(s0);
+    _load1(s1);
+    Acc::m128iUnpackPI64FromPI32Lo(s0, s0, s1);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+  }
+
+  FOG_INLINE void fetch4(__m128i& s0, __m128i& s1)
+  {
+    __m128i s2, s3;
+
+    _load1(s0);
+    _load1(s2);
+    _load1(s1);
+    _load1(s3);
+
+    Acc::m128iUnpackPI64FromPI32Lo(s0, s0, s2);
+    Acc::m128iUnpackPI64FromPI32Lo(s1, s1, s3);
+    Acc::m128iUnpackPI16FromPI8Lo(s0, s0);
+    Acc::m128iUnpackPI16FromPI8Lo(s1, s1);
+  }
+
+  FOG_INLINE void skip(int n) { src += (uint)n * 3; }
+
+  const uint8_t* src;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtSrcA8
+{
+  FOG_INLINE CompositeExtSrcA8(const uint8_t* src) : src(src) {}
+
+  FOG_INLINE void fetch1(__m128i& s0)
+  {
+    Acc::m128iLoad1(s0, src);
+    Acc::m128iExtendPI16FromSI16Lo(s0, s0);
+    src += 1;
+  }
+
+  FOG_INLINE void fetch2(__m128i& s0)
+  {
+    Acc::m128iLoad2(s0, src);
+    Acc::m128iUnpackMask2PI8(s0, s0);
+    src += 2;
+  }
+
+  FOG_INLINE void fetch4(__m128i& s0, __m128i& s1)
+  {
+    Acc::m128iLoad4(s0, src);
+    Acc::m128iUnpackMask4PI8(s0, s1, s0);
+    src += 4;
+  }
+
+  FOG_INLINE void skip(int n) { src += (uint)n; }
+
+  const uint8_t* src;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeExt - Msk]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Mask fetchers used by @c CompositeExtSeparable.
+//!
+//! Masks are returned as 16-bit words in 0...256 range, replicated to all four
+//! components of the pixel. Component masks (@c PER_COMPONENT) have a separate
+//! value for each component and interpolate the result of the operator instead
+//! of masking the source, like the ARGB32-Glyph span in the C implementation.
+struct FOG_NO_EXPORT CompositeExtMskNone
+{
+  enum { HAS_MASK = 0, CAN_SKIP = 0, PER_COMPONENT = 0 };
+
+  FOG_INLINE void fetch1(__m128i& m0) {}
+  FOG_INLINE void fetch2(__m128i& m0) {}
+  FOG_INLINE void fetch4(__m128i& m0, __m128i& m1) {}
+  FOG_INLINE bool isZero4() const { return false; }
+  FOG_INLINE void skip(int n) {}
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtMskConst
+{
+  enum { HAS_MASK = 1, CAN_SKIP = 0, PER_COMPONENT = 0 };
+
+  FOG_INLINE CompositeExtMskConst(uint32_t msk0)
+  {
+    Acc::m128iCvtSI128FromSI(msk0xmm, (int)msk0);
+    Acc::m128iExpandPI16FromSI16(msk0xmm, msk0xmm);
+  }
+
+  FOG_INLINE void fetch1(__m128i& m0) { m0 = msk0xmm; }
+  FOG_INLINE void fetch2(__m128i& m0) { m0 = msk0xmm; }
+  FOG_INLINE void fetch4(__m128i& m0, __m128i& m1) { m0 = msk0xmm; m1 = msk0xmm; }
+  FOG_INLINE bool isZero4() const { return false; }
+  FOG_INLINE void skip(int n) {}
+
+  __m128i msk0xmm;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtMskA8Glyph
+{
+  enum { HAS_MASK = 1, CAN_SKIP = 1, PER_COMPONENT = 0 };
+
+  FOG_INLINE CompositeExtMskA8Glyph(const uint8_t* msk) : msk(msk) {}
+
+  FOG_INLINE void fetch1(__m128i& m0)
+  {
+    Acc::m128iLoad1(m0, msk);
+    Acc::m128iExtendPI16FromSI16Lo(m0, m0);
+    Acc::m128iCvt256From255PI16(m0, m0);
+    msk += 1;
+  }
+
+  FOG_INLINE void fetch2(__m128i& m0)
+  {
+    Acc::m128iLoad2(m0, msk);
+    Acc::m128iUnpackMask2PI8(m0, m0);
+    Acc::m128iCvt256From255PI16(m0, m0);
+    msk += 2;
+  }
+
+  FOG_INLINE void fetch4(__m128i& m0, __m128i& m1)
+  {
+    Acc::m128iLoad4(m0, msk);
+    Acc::m128iUnpackMask4PI8(m0, m1, m0);
+    Acc::m128iCvt256From255PI16_2x(m0, m0, m1, m1);
+    msk += 4;
+  }
+
+  FOG_INLINE bool isZero4() const { return reinterpret_cast<const uint32_t*>(msk)[0] == 0; }
+  FOG_INLINE void skip(int n) { msk += (uint)n; }
+
+  const uint8_t* msk;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtMskA8Extra
+{
+  enum { HAS_MASK = 1, CAN_SKIP = 1, PER_COMPONENT = 0 };
+
+  FOG_INLINE CompositeExtMskA8Extra(const uint8_t* msk) : msk(msk) {}
+
+  FOG_INLINE void fetch1(__m128i& m0)
+  {
+    Acc::m128iLoad2(m0, msk);
+    Acc::m128iExtendPI16FromSI16Lo(m0, m0);
+    msk += 2;
+  }
+
+  FOG_INLINE void fetch2(__m128i& m0)
+  {
+    Acc::m128iLoad4(m0, msk);
+    Acc::m128iUnpackMask2PI16(m0, m0);
+    msk += 4;
+  }
+
+  FOG_INLINE void fetch4(__m128i& m0, __m128i& m1)
+  {
+    Acc::m128iLoad8(m0, msk);
+    Acc::m128iUnpackMask4PI16(m0, m1, m0);
+    msk += 8;
+  }
+
+  FOG_INLINE bool isZero4() const
+  {
+    return (reinterpret_cast<const uint32_t*>(msk)[0] |
+            reinterpret_cast<const uint32_t*>(msk)[1]) == 0;
+  }
+
+  FOG_INLINE void skip(int n) { msk += (uint)n * 2; }
+
+  const uint8_t* msk;
+};
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExtMskARGB32Glyph
+{
+  enum { HAS_MASK = 1, CAN_SKIP = 1, PER_COMPONENT = 1 };
+
+  FOG_INLINE CompositeExtMskARGB32Glyph(const uint8_t* msk) : msk(msk) {}
+
+  FOG_INLINE void fetch1(__m128i& m0)
+  {
+    Acc::m128iLoad4(m0, msk);
+    Acc::m128iUnpackPI16FromPI8Lo(m0, m0);
+    Acc::m128iCvt256From255PI16(m0, m0);
+    msk += 4;
+  }
+
+  FOG_INLINE void fetch2(__m128i& m0)
+  {
+    Acc::m128iLoad8(m0, msk);
+    Acc::m128iUnpackPI16FromPI8Lo(m0, m0);
+    Acc::m128iCvt256From255PI16(m0, m0);
+    msk += 8;
+  }
+
+  FOG_INLINE void fetch4(__m128i& m0, __m128i& m1)
+  {
+    Acc::m128iLoad16u(m0, msk);
+    Acc::m128iUnpackPI16FromPI8Hi(m1, m0);
+    Acc::m128iUnpackPI16FromPI8Lo(m0, m0);
+    Acc::m128iCvt256From255PI16_2x(m0, m0, m1, m1);
+    msk += 16;
+  }
+
+  FOG_INLINE bool isZero4() const
+  {
+    return (reinterpret_cast<const uint32_t*>(msk)[0] |
+            reinterpret_cast<const uint32_t*>(msk)[1] |
+            reinterpret_cast<const uint32_t*>(msk)[2] |
+            reinterpret_cast<const uint32_t*>(msk)[3]) == 0;
+  }
+
+  FOG_INLINE void skip(int n) { msk += (uint)n * 4; }
+
+  const uint8_t* msk;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeExtSeparable]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Separable compositing operators (base template).
+//!
+//! All operators are evaluated on unpacked PRGB32 pixels (two pixels per
+//! register). The mask is applied to the source before the operator is called,
+//! which is how the C implementation handles all bound operators (component
+//! masks interpolate the result instead, see @c _op_msk()). XRGB32
+//! destination is treated as PRGB32 having opaque alpha; the operators keep
+//! alpha at 255 in that case so the result can be stored back unmodified.
+//!
+//! @c CompositeOp must provide:
+//!
+//!   static void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0);
+//!
+//! where @a a0 is the destination and @a b0 is the source. @a dst0 can alias
+//! @a a0.
+template<typename CompositeOp>
+struct CompositeExtSeparable
+{
+  // ==========================================================================
+  // [Helpers - Dst]
+  // ==========================================================================
+
+  template<bool DstAlpha>
+  static FOG_INLINE void _load_dst1(__m128i& d0, const uint8_t* dst)
+  {
+    Acc::m128iLoad4(d0, dst);
+    if (!DstAlpha)
+      Acc::m128iOr(d0, d0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Lo(d0, d0);
+  }
+
+  template<bool DstAlpha>
+  static FOG_INLINE void _load_dst2(__m128i& d0, const uint8_t* dst)
+  {
+    Acc::m128iLoad8(d0, dst);
+    if (!DstAlpha)
+      Acc::m128iOr(d0, d0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Lo(d0, d0);
+  }
+
+  template<bool DstAlpha>
+  static FOG_INLINE void _load_dst4(__m128i& d0, __m128i& d1, const uint8_t* dst)
+  {
+    Acc::m128iLoad16a(d0, dst);
+    if (!DstAlpha)
+      Acc::m128iOr(d0, d0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+    Acc::m128iUnpackPI16FromPI8Hi(d1, d0);
+    Acc::m128iUnpackPI16FromPI8Lo(d0, d0);
+  }
+
+  // ==========================================================================
+  // [Helpers - Mask]
+  // ==========================================================================
+
+  //! @brief Apply the operator to unpacked pixels using mask @a m0.
+  //!
+  //! A component mask interpolates the destination and the result of the
+  //! operator as '(dst * (256 - m) + op(dst, src) * m) >> 8', the sum doesn't
+  //! overflow 16 bits and opaque alpha of XRGB32 destination is preserved.
+  template<typename MskF>
+  static FOG_INLINE void _op_msk(__m128i& d0, __m128i& s0, const __m128i& m0)
+  {
+    if (!MskF::PER_COMPONENT)
+    {
+      Acc::m128iMulDiv256PI16(s0, s0, m0);
+      CompositeOp::prgb32_op_prgb32_pbw(d0, d0, s0);
+    }
+    else
+    {
+      __m128i inv0;
+
+      Acc::m128iNegate256PI16(inv0, m0);
+      Acc::m128iMulLoPI16(inv0, inv0, d0);
+
+      CompositeOp::prgb32_op_prgb32_pbw(d0, d0, s0);
+      Acc::m128iMulLoPI16(d0, d0, m0);
+      Acc::m128iAddPI16(d0, d0, inv0);
+      Acc::m128iRShiftPU16<8>(d0, d0);
+    }
+  }
+
+  // ==========================================================================
+  // [Helpers - Blit]
+  // ==========================================================================
+
+  template<bool DstAlpha, typename SrcF, typename MskF>
+  static FOG_INLINE void _blit(uint8_t* dst, SrcF& srcF, MskF& mskF, int w)
+  {
+    FOG_BLIT_LOOP_32x4_SSE2_INIT()
+
+    FOG_BLIT_LOOP_32x4_SSE2_ONE_BEGIN(Blit)
+      __m128i dst0xmm;
+      __m128i src0xmm;
+
+      _load_dst1<DstAlpha>(dst0xmm, dst);
+      srcF.fetch1(src0xmm);
+
+      if (MskF::HAS_MASK)
+      {
+        __m128i msk0xmm;
+
+        mskF.fetch1(msk0xmm);
+        _op_msk<MskF>(dst0xmm, src0xmm, msk0xmm);
+      }
+      else
+      {
+        CompositeOp::prgb32_op_prgb32_pbw(dst0xmm, dst0xmm, src0xmm);
+      }
+      Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm);
+      Acc::m128iStore4(dst, dst0xmm);
+
+      dst += 4;
+    FOG_BLIT_LOOP_32x4_SSE2_ONE_END(Blit)
+
+    FOG_BLIT_LOOP_32x4_SSE2_TWO_BEGIN(Blit)
+      __m128i dst0xmm;
+      __m128i src0xmm;
+
+      _load_dst2<DstAlpha>(dst0xmm, dst);
+      srcF.fetch2(src0xmm);
+
+      if (MskF::HAS_MASK)
+      {
+        __m128i msk0xmm;
+
+        mskF.fetch2(msk0xmm);
+        _op_msk<MskF>(dst0xmm, src0xmm, msk0xmm);
+      }
+      else
+      {
+        CompositeOp::prgb32_op_prgb32_pbw(dst0xmm, dst0xmm, src0xmm);
+      }
+      Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm);
+      Acc::m128iStore8(dst, dst0xmm);
+
+      dst += 8;
+    FOG_BLIT_LOOP_32x4_SSE2_TWO_END(Blit)
+
+    FOG_BLIT_LOOP_32x4_SSE2_MAIN_BEGIN(Blit)
+      // Fully transparent mask means no-op for all bound operators.
+      if (MskF::CAN_SKIP && mskF.isZero4())
+      {
+        srcF.skip(4);
+        mskF.skip(4);
+      }
+      else
+      {
+        __m128i dst0xmm, dst1xmm;
+        __m128i src0xmm, src1xmm;
+
+        _load_dst4<DstAlpha>(dst0xmm, dst1xmm, dst);
+        srcF.fetch4(src0xmm, src1xmm);
+
+        if (MskF::HAS_MASK)
+        {
+          __m128i msk0xmm, msk1xmm;
+
+          mskF.fetch4(msk0xmm, msk1xmm);
+          _op_msk<MskF>(dst0xmm, src0xmm, msk0xmm);
+          _op_msk<MskF>(dst1xmm, src1xmm, msk1xmm);
+        }
+        else
+        {
+          CompositeOp::prgb32_op_prgb32_pbw(dst0xmm, dst0xmm, src0xmm);
+          CompositeOp::prgb32_op_prgb32_pbw(dst1xmm, dst1xmm, src1xmm);
+        }
+        Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm, dst1xmm);
+        Acc::m128iStore16a(dst, dst0xmm);
+      }
+
+      dst += 16;
+    FOG_BLIT_LOOP_32x4_SSE2_MAIN_END(Blit)
+  }
+
+  // ==========================================================================
+  // [Helpers - Span]
+  // ==========================================================================
+
+  template<bool DstAlpha>
+  static FOG_INLINE void _cblit_span(
+    uint8_t* dst, const RasterSolid* src, bool srcOpaque, const RasterSpan* span, const RasterClosure* closure)
+  {
+    CompositeExtSrcSolid srcF(src, srcOpaque);
+
+    FOG_CBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_OPAQUE()
+    {
+      CompositeExtMskNone mskF;
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_MASK()
+    {
+      CompositeExtMskConst mskF(msk0);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_GLYPH()
+    {
+      CompositeExtMskA8Glyph mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_EXTRA()
+    {
+      CompositeExtMskA8Extra mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      CompositeExtMskARGB32Glyph mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    FOG_CBLIT_SPAN8_END()
+  }
+
+  template<bool DstAlpha, typename SrcF>
+  static FOG_INLINE void _vblit_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    FOG_VBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_OPAQUE()
+    {
+      SrcF srcF(src);
+      CompositeExtMskNone mskF;
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_MASK()
+    {
+      SrcF srcF(src);
+      CompositeExtMskConst mskF(msk0);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_GLYPH()
+    {
+      SrcF srcF(src);
+      CompositeExtMskA8Glyph mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_EXTRA()
+    {
+      SrcF srcF(src);
+      CompositeExtMskA8Extra mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      SrcF srcF(src);
+      CompositeExtMskARGB32Glyph mskF(msk);
+      _blit<DstAlpha>(dst, srcF, mskF, w);
+    }
+
+    FOG_VBLIT_SPAN8_END()
+  }
+
+  // ==========================================================================
+  // [PRGB32 - CBlit]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_cblit_prgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcSolid srcF(src, false);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_cblit_prgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _cblit_span<true>(dst, src, false, span, closure);
+  }
+
+  static void FOG_FASTCALL prgb32_cblit_xrgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcSolid srcF(src, true);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_cblit_xrgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _cblit_span<true>(dst, src, true, span, closure);
+  }
+
+  // ==========================================================================
+  // [PRGB32 - VBlit]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_vblit_prgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcPRGB32 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_prgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<true, CompositeExtSrcPRGB32>(dst, span, closure);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_xrgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcXRGB32 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_xrgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<true, CompositeExtSrcXRGB32>(dst, span, closure);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_rgb24_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcRGB24 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_rgb24_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<true, CompositeExtSrcRGB24>(dst, span, closure);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_a8_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcA8 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<true>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL prgb32_vblit_a8_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<true, CompositeExtSrcA8>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [XRGB32 - CBlit]
+  // ==========================================================================
+
+  static void FOG_FASTCALL xrgb32_cblit_prgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcSolid srcF(src, false);
+    CompositeExtMskNone mskF;
+    _blit<false>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL xrgb32_cblit_prgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _cblit_span<false>(dst, src, false, span, closure);
+  }
+
+  static void FOG_FASTCALL xrgb32_cblit_xrgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcSolid srcF(src, true);
+    CompositeExtMskNone mskF;
+    _blit<false>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL xrgb32_cblit_xrgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _cblit_span<false>(dst, src, true, span, closure);
+  }
+
+  // ==========================================================================
+  // [XRGB32 - VBlit]
+  // ==========================================================================
+
+  static void FOG_FASTCALL xrgb32_vblit_prgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcPRGB32 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<false>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL xrgb32_vblit_prgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<false, CompositeExtSrcPRGB32>(dst, span, closure);
+  }
+
+  static void FOG_FASTCALL xrgb32_vblit_xrgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcXRGB32 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<false>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL xrgb32_vblit_xrgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<false, CompositeExtSrcXRGB32>(dst, span, closure);
+  }
+
+  static void FOG_FASTCALL xrgb32_vblit_rgb24_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    CompositeExtSrcRGB24 srcF(src);
+    CompositeExtMskNone mskF;
+    _blit<false>(dst, srcF, mskF, w);
+  }
+
+  static void FOG_FASTCALL xrgb32_vblit_rgb24_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _vblit_span<false, CompositeExtSrcRGB24>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [Helpers - Op]
+  // ==========================================================================
+
+  // Dca' = Dca.(1 - Sa) + Sca.(1 - Da).
+  // Da'  = Da.(1 - Sa) + Sa.(1 - Da).
+  static FOG_INLINE void _op_cross_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i da0, sa0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(da0, a0);
+    Acc::m128iShufflePI16<3, 3, 3, 3>(sa0, b0);
+    Acc::m128iNegate255PI16(da0, da0);
+    Acc::m128iNegate255PI16(sa0, sa0);
+    Acc::m128iMulDiv255PI16(da0, da0, b0);
+    Acc::m128iMulDiv255PI16(sa0, sa0, a0);
+    Acc::m128iAddPI16(dst0, da0, sa0);
+  }
+
+  // Dca' = Dca + Sca - 2.X, Da' = Da + Sa - X.
+  static FOG_INLINE void _op_sub_twice_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0, const __m128i& x0)
+  {
+    __m128i t0;
+
+    Acc::m128iAndNot(t0, FOG_XMM_GET_CONST_PI(00FF000000000000_00FF000000000000), x0);
+    Acc::m128iAddPI16(dst0, a0, b0);
+    Acc::m128iSubPI16(dst0, dst0, x0);
+    Acc::m128iSubPI16(dst0, dst0, t0);
+  }
+
+  // Operators which need division or square root are evaluated using SP-FP
+  // (one pixel per register, components scaled to 0...1 range). PsOp must
+  // provide prgb32_op_prgb32_ps(dst0, a0, b0) working on unpacked floats.
+  template<typename PsOp>
+  static FOG_INLINE void _op_ps_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0, t1;
+    __m128f a0f, a1f;
+    __m128f b0f, b1f;
+
+    Acc::m128iUnpackPI32FromPI16Lo(t0, a0);
+    Acc::m128iUnpackPI32FromPI16Hi(t1, a0);
+    Acc::m128fCvtPSFromPI32(a0f, t0);
+    Acc::m128fCvtPSFromPI32(a1f, t1);
+    Acc::m128fMulPS(a0f, a0f, FOG_XMM_GET_CONST_PS(m128f_4x_1_div_255));
+    Acc::m128fMulPS(a1f, a1f, FOG_XMM_GET_CONST_PS(m128f_4x_1_div_255));
+
+    Acc::m128iUnpackPI32FromPI16Lo(t0, b0);
+    Acc::m128iUnpackPI32FromPI16Hi(t1, b0);
+    Acc::m128fCvtPSFromPI32(b0f, t0);
+    Acc::m128fCvtPSFromPI32(b1f, t1);
+    Acc::m128fMulPS(b0f, b0f, FOG_XMM_GET_CONST_PS(m128f_4x_1_div_255));
+    Acc::m128fMulPS(b1f, b1f, FOG_XMM_GET_CONST_PS(m128f_4x_1_div_255));
+
+    PsOp::prgb32_op_prgb32_ps(a0f, a0f, b0f);
+    PsOp::prgb32_op_prgb32_ps(a1f, a1f, b1f);
+
+    Acc::m128fMulPS(a0f, a0f, FOG_XMM_GET_CONST_PS(m128f_4x_255));
+    Acc::m128fMulPS(a1f, a1f, FOG_XMM_GET_CONST_PS(m128f_4x_255));
+    Acc::m128iCvtPI32FromPS(t0, a0f);
+    Acc::m128iCvtPI32FromPS(t1, a1f);
+    Acc::m128iPackPI16FromPI32(dst0, t0, t1);
+  }
+
+  // Select x0 where msk0 is set, y0 otherwise.
+  static FOG_INLINE void _select_ps(__m128f& dst0, const __m128f& msk0, const __m128f& x0, const __m128f& y0)
+  {
+    __m128f t0;
+
+    Acc::m128fAnd(t0, x0, msk0);
+    Acc::m128fAndNot(dst0, msk0, y0);
+    Acc::m128fOr(dst0, dst0, t0);
+  }
+
+  // Dca' = Dca.(1 - Sa) + Sca.(1 - Da) (SP-FP version of _op_cross_pbw()).
+  static FOG_INLINE void _op_cross_ps(__m128f& dst0, const __m128f& a0, const __m128f& b0, const __m128f& da0, const __m128f& sa0)
+  {
+    __m128f t0, t1;
+
+    Acc::m128fSubPS(t0, FOG_XMM_GET_CONST_PS(m128f_p1_p1_p1_p1), sa0);
+    Acc::m128fSubPS(t1, FOG_XMM_GET_CONST_PS(m128f_p1_p1_p1_p1), da0);
+    Acc::m128fMulPS(t0, t0, a0);
+    Acc::m128fMulPS(t1, t1, b0);
+    Acc::m128fAddPS(dst0, t0, t1);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositePlus]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositePlus : public CompositeExtSeparable<CompositePlus>
+{
+  // Dca' = Sca + Dca.
+  // Da'  = Sa + Da.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    // Saturation is done by PackPU8FromPU16().
+    Acc::m128iAddPI16(dst0, a0, b0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeMinus]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeMinus : public CompositeExtSeparable<CompositeMinus>
+{
+  // Dca' = Dca - Sca.
+  // Da'  = Sa + Da - Sa.Da.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i c0, t0;
+
+    Acc::m128iSubusPU16(c0, a0, b0);
+    Acc::m128iMulDiv255PI16(t0, a0, b0);
+    Acc::m128iAddPI16(dst0, a0, b0);
+    Acc::m128iSubPI16(dst0, dst0, t0);
+
+    Acc::m128iAnd(dst0, dst0, FOG_XMM_GET_CONST_PI(00FF000000000000_00FF000000000000));
+    Acc::m128iAndNot(c0, FOG_XMM_GET_CONST_PI(00FF000000000000_00FF000000000000), c0);
+    Acc::m128iOr(dst0, dst0, c0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeMultiply]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeMultiply : public CompositeExtSeparable<CompositeMultiply>
+{
+  // Dca' = Dca.Sca + Dca.(1 - Sa) + Sca.(1 - Da).
+  // Da'  = Da.Sa   + Da.(1 - Sa) + Sa.(1 - Da).
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0, x0;
+
+    Acc::m128iMulDiv255PI16(t0, a0, b0);
+    _op_cross_pbw(x0, a0, b0);
+    Acc::m128iAddPI16(dst0, t0, x0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeScreen]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeScreen : public CompositeExtSeparable<CompositeScreen>
+{
+  // Dca' = Sca + Dca - Sca.Dca.
+  // Da'  = Sa + Da - Sa.Da.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0;
+
+    Acc::m128iMulDiv255PI16(t0, a0, b0);
+    Acc::m128iAddPI16(dst0, a0, b0);
+    Acc::m128iSubPI16(dst0, dst0, t0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeOverlay]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeOverlay : public CompositeExtSeparable<CompositeOverlay>
+{
+  // Used also by CompositeHardLight, the only difference is the condition,
+  // which is computed by the caller and passed in msk0 (all bits set means
+  // that the multiply part is used).
+  //
+  // Dca' = 2.Sca.Dca + Sca.(1 - Da) + Dca.(1 - Sa)                  [msk0]
+  // Dca' = Sa.Da - 2.(Da - Dca).(Sa - Sca) + Sca.(1 - Da) + Dca.(1 - Sa)
+  // Da'  = Sa + Da - Sa.Da
+  static FOG_INLINE void _op_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0, const __m128i& msk0)
+  {
+    __m128i da0, sa0;
+    __m128i t0, t1, x0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(da0, a0);
+    Acc::m128iShufflePI16<3, 3, 3, 3>(sa0, b0);
+
+    // Multiply.
+    Acc::m128iMulDiv255PI16(t0, a0, b0);
+    Acc::m128iAddPI16(t0, t0, t0);
+
+    // Screen.
+    Acc::m128iSubPI16(x0, da0, a0);
+    Acc::m128iSubPI16(t1, sa0, b0);
+    Acc::m128iMulDiv255PI16(t1, t1, x0);
+    Acc::m128iAddPI16(t1, t1, t1);
+    Acc::m128iMulDiv255PI16(x0, sa0, da0);
+    Acc::m128iSubPI16(t1, x0, t1);
+
+    Acc::m128iAnd(t0, t0, msk0);
+    Acc::m128iAndNot(t1, msk0, t1);
+    Acc::m128iOr(t0, t0, t1);
+
+    _op_cross_pbw(x0, a0, b0);
+    Acc::m128iAddPI16(dst0, t0, x0);
+  }
+
+  // Condition: 2.Dca < Da.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i msk0, da0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(da0, a0);
+    Acc::m128iAddPI16(msk0, a0, a0);
+    Acc::m128iCmpLtPI16(msk0, msk0, da0);
+
+    _op_pbw(dst0, a0, b0, msk0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeDarken]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeDarken : public CompositeExtSeparable<CompositeDarken>
+{
+  // Dca' = min(Sca.Da, Dca.Sa) + Sca.(1 - Da) + Dca.(1 - Sa).
+  // Da'  = min(Sa.Da, Da.Sa)   + Sa.(1 - Da)  + Da.(1 - Sa).
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0, t1, x0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t0, a0);
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t1, b0);
+    Acc::m128iMulDiv255PI16(t0, t0, b0);
+    Acc::m128iMulDiv255PI16(t1, t1, a0);
+    Acc::m128iMinPI16(t0, t0, t1);
+
+    _op_cross_pbw(x0, a0, b0);
+    Acc::m128iAddPI16(dst0, t0, x0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeLighten]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeLighten : public CompositeExtSeparable<CompositeLighten>
+{
+  // Dca' = max(Sca.Da, Dca.Sa) + Sca.(1 - Da) + Dca.(1 - Sa).
+  // Da'  = max(Sa.Da, Da.Sa)   + Sa.(1 - Da)  + Da.(1 - Sa).
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0, t1, x0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t0, a0);
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t1, b0);
+    Acc::m128iMulDiv255PI16(t0, t0, b0);
+    Acc::m128iMulDiv255PI16(t1, t1, a0);
+    Acc::m128iMaxPI16(t0, t0, t1);
+
+    _op_cross_pbw(x0, a0, b0);
+    Acc::m128iAddPI16(dst0, t0, x0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeColorDodge]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeColorDodge : public CompositeExtSeparable<CompositeColorDodge>
+{
+  // Dca' = if (Sca.Da + Dca.Sa >= Sa.Da)
+  //          Sa.Da + Sca.(1 - Da) + Dca.(1 - Sa).
+  //        else
+  //          Dca.Sa.Sa/(Sa - Sca) + Sca.(1 - Da) + Dca.(1 - Sa).
+  // Da'  = Sa + Da - Sa.Da
+  static FOG_INLINE void prgb32_op_prgb32_ps(__m128f& dst0, const __m128f& a0, const __m128f& b0)
+  {
+    __m128f da0, sa0, saDa0;
+    __m128f t0, t1, msk0;
+
+    Acc::m128fShuffle<3, 3, 3, 3>(da0, a0);
+    Acc::m128fShuffle<3, 3, 3, 3>(sa0, b0);
+    Acc::m128fMulPS(saDa0, sa0, da0);
+
+    // Sca.Da + Dca.Sa >= Sa.Da.
+    Acc::m128fMulPS(t0, b0, da0);
+    Acc::m128fMulPS(t1, a0, sa0);
+    Acc::m128fAddPS(msk0, t0, t1);
+    Acc::m128fCmpGePS(msk0, msk0, saDa0);
+
+    // Dca.Sa.Sa/(Sa - Sca), division by zero is masked-out by the condition.
+    Acc::m128fMulPS(t1, t1, sa0);
+    Acc::m128fSubPS(t0, sa0, b0);
+    Acc::m128fDivPS(t1, t1, t0);
+
+    _select_ps(t0, msk0, saDa0, t1);
+    _op_cross_ps(t1, a0, b0, da0, sa0);
+    Acc::m128fAddPS(dst0, t0, t1);
+  }
+
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    _op_ps_pbw<CompositeColorDodge>(dst0, a0, b0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeColorBurn]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeColorBurn : public CompositeExtSeparable<CompositeColorBurn>
+{
+  // Dca' = if (Sca.Da + Dca.Sa <= Sa.Da)
+  //          Sca.(1 - Da) + Dca.(1 - Sa).
+  //        else
+  //          Sa.(Sca.Da + Dca.Sa - Sa.Da)/Sca + Sca.(1 - Da) + Dca.(1 - Sa).
+  // Da'  = Sa + Da - Sa.Da
+  static FOG_INLINE void prgb32_op_prgb32_ps(__m128f& dst0, const __m128f& a0, const __m128f& b0)
+  {
+    __m128f da0, sa0, saDa0;
+    __m128f t0, t1, msk0;
+
+    Acc::m128fShuffle<3, 3, 3, 3>(da0, a0);
+    Acc::m128fShuffle<3, 3, 3, 3>(sa0, b0);
+    Acc::m128fMulPS(saDa0, sa0, da0);
+
+    // Sca.Da + Dca.Sa <= Sa.Da.
+    Acc::m128fMulPS(t0, b0, da0);
+    Acc::m128fMulPS(t1, a0, sa0);
+    Acc::m128fAddPS(t0, t0, t1);
+    Acc::m128fCmpLePS(msk0, t0, saDa0);
+
+    // Sa.(Sca.Da + Dca.Sa - Sa.Da)/Sca, Sca == 0 always satisfies the
+    // condition so the division by zero is masked-out.
+    Acc::m128fSubPS(t0, t0, saDa0);
+    Acc::m128fMulPS(t0, t0, sa0);
+    Acc::m128fDivPS(t0, t0, b0);
+    Acc::m128fAndNot(t0, msk0, t0);
+
+    _op_cross_ps(t1, a0, b0, da0, sa0);
+    Acc::m128fAddPS(dst0, t0, t1);
+  }
+
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    _op_ps_pbw<CompositeColorBurn>(dst0, a0, b0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeHardLight]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeHardLight : public CompositeExtSeparable<CompositeHardLight>
+{
+  // Overlay with source and destination swapped in the condition:
+  //
+  // Condition: 2.Sca < Sa.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i msk0, sa0;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(sa0, b0);
+    Acc::m128iAddPI16(msk0, b0, b0);
+    Acc::m128iCmpLtPI16(msk0, msk0, sa0);
+
+    CompositeOverlay::_op_pbw(dst0, a0, b0, msk0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeSoftLight]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeSoftLight : public CompositeExtSeparable<CompositeSoftLight>
+{
+  // Dc = Dca/Da (zero if Da is zero), K = 2.Sca - Sa.
+  //
+  // Dca' = if (2.Sca <= Sa)
+  //          Dca + Sca.(1 - Da)  +  Dca.K.(1 - Dc)
+  //        else if (4.Dca <= Da)
+  //          Dca + Sca.(1 - Da)  +  Da.K.(16.Dc^3 - 12.Dc^2 + 3.Dc)
+  //        else
+  //          Dca + Sca.(1 - Da)  +  Da.K.(Dc^0.5 - Dc)
+  // Da'  = Sa + Da - Sa.Da
+  static FOG_INLINE void prgb32_op_prgb32_ps(__m128f& dst0, const __m128f& a0, const __m128f& b0)
+  {
+    FOG_XMM_DECLARE_CONST_PS_SET(Two    ,  2.0f);
+    FOG_XMM_DECLARE_CONST_PS_SET(Three  ,  3.0f);
+    FOG_XMM_DECLARE_CONST_PS_SET(Four   ,  4.0f);
+    FOG_XMM_DECLARE_CONST_PS_SET(Twelve , 12.0f);
+    FOG_XMM_DECLARE_CONST_PS_SET(Sixteen, 16.0f);
+
+    __m128f da0, sa0, dc0, k0;
+    __m128f t0, t1, t2, msk0;
+
+    Acc::m128fShuffle<3, 3, 3, 3>(da0, a0);
+    Acc::m128fShuffle<3, 3, 3, 3>(sa0, b0);
+
+    // Dca <= Da, so dividing by epsilon when Da is zero results in zero.
+    Acc::m128fMaxPS(dc0, da0, FOG_XMM_GET_CONST_PS(m128f_eps_eps_eps_eps));
+    Acc::m128fDivPS(dc0, a0, dc0);
+
+    Acc::m128fMulPS(k0, b0, FOG_XMM_GET_CONST_PS(Two));
+    Acc::m128fSubPS(k0, k0, sa0);
+
+    // [4.Dca <= Da] - Da.(16.Dc^3 - 12.Dc^2 + 3.Dc).
+    Acc::m128fMulPS(t1, dc0, FOG_XMM_GET_CONST_PS(Sixteen));
+    Acc::m128fSubPS(t1, t1, FOG_XMM_GET_CONST_PS(Twelve));
+    Acc::m128fMulPS(t1, t1, dc0);
+    Acc::m128fAddPS(t1, t1, FOG_XMM_GET_CONST_PS(Three));
+    Acc::m128fMulPS(t1, t1, dc0);
+
+    // [Else] - Da.(Dc^0.5 - Dc).
+    Acc::m128fSqrtPS(t2, dc0);
+    Acc::m128fSubPS(t2, t2, dc0);
+
+    Acc::m128fMulPS(t0, a0, FOG_XMM_GET_CONST_PS(Four));
+    Acc::m128fCmpLePS(msk0, t0, da0);
+    _select_ps(t1, msk0, t1, t2);
+    Acc::m128fMulPS(t1, t1, da0);
+
+    // [2.Sca <= Sa] - Dca.(1 - Dc).
+    Acc::m128fSubPS(t0, FOG_XMM_GET_CONST_PS(m128f_p1_p1_p1_p1), dc0);
+    Acc::m128fMulPS(t0, t0, a0);
+
+    Acc::m128fZero(t2);
+    Acc::m128fCmpLePS(msk0, k0, t2);
+    _select_ps(t0, msk0, t0, t1);
+    Acc::m128fMulPS(t0, t0, k0);
+
+    // Dca + Sca.(1 - Da).
+    Acc::m128fSubPS(t1, FOG_XMM_GET_CONST_PS(m128f_p1_p1_p1_p1), da0);
+    Acc::m128fMulPS(t1, t1, b0);
+    Acc::m128fAddPS(t1, t1, a0);
+
+    Acc::m128fAddPS(dst0, t0, t1);
+  }
+
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    _op_ps_pbw<CompositeSoftLight>(dst0, a0, b0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeDifference]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeDifference : public CompositeExtSeparable<CompositeDifference>
+{
+  // Dca' = Sca + Dca - 2.min(Sca.Da, Dca.Sa).
+  // Da'  = Sa + Da - min(Sa.Da, Da.Sa).
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0, t1;
+
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t0, a0);
+    Acc::m128iShufflePI16<3, 3, 3, 3>(t1, b0);
+    Acc::m128iMulDiv255PI16(t0, t0, b0);
+    Acc::m128iMulDiv255PI16(t1, t1, a0);
+    Acc::m128iMinPI16(t0, t0, t1);
+
+    _op_sub_twice_pbw(dst0, a0, b0, t0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - CompositeExclusion]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT CompositeExclusion : public CompositeExtSeparable<CompositeExclusion>
+{
+  // Dca' = Sca + Dca - 2.Sca.Dca.
+  // Da'  = Sa + Da - Sa.Da.
+  static FOG_INLINE void prgb32_op_prgb32_pbw(__m128i& dst0, const __m128i& a0, const __m128i& b0)
+  {
+    __m128i t0;
+
+    Acc::m128iMulDiv255PI16(t0, a0, b0);
+    _op_sub_twice_pbw(dst0, a0, b0, t0);
+  }
+};
+
 } // RasterOps_SSE2 namespace
 } // Fog namespace
 
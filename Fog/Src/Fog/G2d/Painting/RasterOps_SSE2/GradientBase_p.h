@@ -9,6 +9,11 @@
 
 // [Dependencies]
 #include <Fog/G2d/Geometry/Math2d.h>
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientBase_p.h>
+
+// [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/BaseDefs_p.h>
 #include <Fog/G2d/Painting/RasterOps_SSE2/BaseHelpers_p.h>
 
@@ -262,6 +267,192 @@ struct FOG_NO_EXPORT PGradientBase
       } while (--w);
     }
   }
+
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get 4 positions starting at @a p, advancing by @a step.
+  //!
+  //! The positions are accumulated exactly like 'p += step' in the C fetchers
+  //! (instead of 'p + i * step'), so the results are bit-exact. @a p is
+  //! advanced by four steps.
+  static FOG_INLINE void p4Accumulate(__m128d& dst0, __m128d& dst1, double& p, double step)
+  {
+    double p0 = p; p += step;
+    double p1 = p; p += step;
+    double p2 = p; p += step;
+    double p3 = p; p += step;
+
+    dst0 = _mm_set_pd(p1, p0);
+    dst1 = _mm_set_pd(p3, p2);
+  }
+
+  //! @brief Fetch 4 pixels from @a table at indices @a idx0.
+  //!
+  //! There is no gather in SSE2, the indices are extracted and the pixels are
+  //! loaded one by one.
+  static FOG_INLINE void p4FetchRaw(__m128i& dst0, const uint32_t* table, const __m128i& idx0)
+  {
+    xmm_t t;
+    __m128i pix1, pix2, pix3;
+
+    t.m128i = idx0;
+
+    Acc::m128iCvtSI128FromSI(dst0, table[t.sd[0]]);
+    Acc::m128iCvtSI128FromSI(pix1, table[t.sd[1]]);
+    Acc::m128iCvtSI128FromSI(pix2, table[t.sd[2]]);
+    Acc::m128iCvtSI128FromSI(pix3, table[t.sd[3]]);
+
+    Acc::m128iUnpackPI64FromPI32Lo(dst0, dst0, pix1);
+    Acc::m128iUnpackPI64FromPI32Lo(pix2, pix2, pix3);
+    Acc::m128iUnpackSI128FromPI64Lo(dst0, dst0, pix2);
+  }
+
+  //! @brief Store 4 pixels or less (@a w) to @a dst, returns the advanced
+  //! @a dst.
+  static FOG_INLINE uint8_t* p4Store(uint8_t* dst, const __m128i& src0, int w)
+  {
+    if (w >= 4)
+    {
+      Acc::m128iStore16u(dst, src0);
+      return dst + 16;
+    }
+
+    __m128i t0 = src0;
+
+    do {
+      Acc::m128iStore4(dst, t0);
+      Acc::m128iRShiftSU128<32>(t0, t0);
+      dst += 4;
+    } while (--w);
+
+    return dst;
+  }
+
+  //! @brief Convert 4 positions (as doubles) to 4 integers (truncated).
+  static FOG_INLINE void p4TruncFromPD(__m128i& dst0, const __m128d& pos0, const __m128d& pos1)
+  {
+    __m128i t0;
+
+    Acc::m128iTruncPI32FromPD(dst0, pos0);
+    Acc::m128iTruncPI32FromPD(t0, pos1);
+    Acc::m128iUnpackSI128FromPI64Lo(dst0, dst0, t0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PGradientAccessor_PRGB32_Pad]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 extension of @c RasterOps_C::PGradientAccessor_PRGB32_Pad.
+//!
+//! @c p4FetchAtPD() converts 4 positions to table indices the same way as
+//! @c fetchAtD(), NaN is converted to the first index.
+struct FOG_NO_EXPORT PGradientAccessor_PRGB32_Pad : public RasterOps_C::PGradientAccessor_PRGB32_Pad
+{
+  FOG_INLINE PGradientAccessor_PRGB32_Pad(const RasterPattern* ctx) :
+    RasterOps_C::PGradientAccessor_PRGB32_Pad(ctx)
+  {
+    _len_pd = _mm_set1_pd(_len_d);
+  }
+
+  FOG_INLINE void p4FetchAtPD(__m128i& dst0, const __m128d& pos0, const __m128d& pos1)
+  {
+    __m128d zero = _mm_setzero_pd();
+    __m128d t0, t1;
+    __m128i idx0;
+
+    Acc::m128dMaxPD(t0, pos0, zero);
+    Acc::m128dMaxPD(t1, pos1, zero);
+    Acc::m128dMinPD(t0, t0, _len_pd);
+    Acc::m128dMinPD(t1, t1, _len_pd);
+
+    PGradientBase::p4TruncFromPD(idx0, t0, t1);
+    PGradientBase::p4FetchRaw(dst0, _table, idx0);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  __m128d _len_pd;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PGradientAccessor_PRGB32_Repeat]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 extension of @c RasterOps_C::PGradientAccessor_PRGB32_Repeat.
+struct FOG_NO_EXPORT PGradientAccessor_PRGB32_Repeat : public RasterOps_C::PGradientAccessor_PRGB32_Repeat
+{
+  FOG_INLINE PGradientAccessor_PRGB32_Repeat(const RasterPattern* ctx) :
+    RasterOps_C::PGradientAccessor_PRGB32_Repeat(ctx)
+  {
+    Acc::m128iCvtSI128FromSI(_lenMask_pi, (int)_lenMask);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(_lenMask_pi, _lenMask_pi);
+  }
+
+  FOG_INLINE void p4FetchAtPD(__m128i& dst0, const __m128d& pos0, const __m128d& pos1)
+  {
+    __m128i idx0;
+
+    PGradientBase::p4TruncFromPD(idx0, pos0, pos1);
+    Acc::m128iAnd(idx0, idx0, _lenMask_pi);
+    PGradientBase::p4FetchRaw(dst0, _table, idx0);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  __m128i _lenMask_pi;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PGradientAccessor_PRGB32_Reflect]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 extension of @c RasterOps_C::PGradientAccessor_PRGB32_Reflect.
+struct FOG_NO_EXPORT PGradientAccessor_PRGB32_Reflect : public RasterOps_C::PGradientAccessor_PRGB32_Reflect
+{
+  FOG_INLINE PGradientAccessor_PRGB32_Reflect(const RasterPattern* ctx) :
+    RasterOps_C::PGradientAccessor_PRGB32_Reflect(ctx)
+  {
+    Acc::m128iCvtSI128FromSI(_len_pi, _len);
+    Acc::m128iCvtSI128FromSI(_lenMask2_pi, (int)_lenMask2);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(_len_pi, _len_pi);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(_lenMask2_pi, _lenMask2_pi);
+  }
+
+  FOG_INLINE void p4FetchAtPD(__m128i& dst0, const __m128d& pos0, const __m128d& pos1)
+  {
+    __m128i idx0;
+    __m128i t0;
+
+    PGradientBase::p4TruncFromPD(idx0, pos0, pos1);
+    Acc::m128iAnd(idx0, idx0, _lenMask2_pi);
+
+    // if (i > len) i ^= lenMask2;
+    Acc::m128iCmpGtPI32(t0, idx0, _len_pi);
+    Acc::m128iAnd(t0, t0, _lenMask2_pi);
+    Acc::m128iXor(idx0, idx0, t0);
+
+    PGradientBase::p4FetchRaw(dst0, _table, idx0);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  __m128i _len_pi;
+  __m128i _lenMask2_pi;
 };
 
 } // RasterOps_SSE2 namespace
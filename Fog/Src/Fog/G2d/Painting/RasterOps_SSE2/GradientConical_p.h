@@ -8,15 +8,172 @@
 #define _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTCONICAL_P_H
 
 // [Dependencies]
+#include <Fog/Core/Math/Constants.h>
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientConical_p.h>
+
+// [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/GradientBase_p.h>
 
 namespace Fog {
 namespace RasterOps_SSE2 {
 
 // ============================================================================
-// [Fog::RasterOps_SSE2]
+// [Fog::RasterOps_SSE2 - PGradientConical]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Conical gradient fetchers.
+//!
+//! The angle is calculated by a vectorized atan2() approximation (the maximum
+//! error is below 1e-7 radians), so the table index can differ by one from
+//! the C fetcher when the exact angle is very close to the edge of a table
+//! entry.
+struct FOG_NO_EXPORT PGradientConical
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Select @a a where @a msk is set, otherwise @a b.
+  static FOG_INLINE void p2Select(__m128d& dst0, const __m128d& msk, const __m128d& a, const __m128d& b)
+  {
+    __m128d t0;
+
+    Acc::m128dAnd(t0, a, msk);
+    Acc::m128dAndNot(dst0, msk, b);
+    Acc::m128dOr(dst0, dst0, t0);
+  }
+
+  //! @brief Calculate atan2(y, x) of 2 pixels.
+  //!
+  //! The argument is reduced to [0, tan(PI/8)] and the arctangent is then
+  //! approximated by a polynomial (Cephes atanf), the quadrant is restored
+  //! at the end.
+  static FOG_INLINE void p2Atan2(__m128d& dst0, const __m128d& y0, const __m128d& x0)
+  {
+    __m128d nm = FOG_XMM_GET_CONST_PD(m128d_nm_nm);
+    __m128d sn = FOG_XMM_GET_CONST_PD(m128d_sn_sn);
+    __m128d one = FOG_XMM_GET_CONST_PD(m128d_p1_p1);
+
+    __m128d ax, ay;
+    __m128d mn, mx;
+    __m128d t, z, r, p;
+    __m128d m0, m1;
+
+    Acc::m128dAnd(ax, x0, nm);
+    Acc::m128dAnd(ay, y0, nm);
+
+    // t = min(|x|, |y|) / max(|x|, |y|), in [0, 1].
+    Acc::m128dMinPD(mn, ax, ay);
+    Acc::m128dMaxPD(mx, ax, ay);
+    Acc::m128dMaxPD(mx, mx, _mm_set1_pd(1e-300));
+    Acc::m128dDivPD(t, mn, mx);
+
+    // if (t > tan(PI/8)) t = (t - 1) / (t + 1), r = PI/4.
+    Acc::m128dCmpGtPD(m0, t, _mm_set1_pd(0.41421356237309504880));
+    {
+      __m128d tn, td;
+
+      Acc::m128dSubPD(tn, t, one);
+      Acc::m128dAddPD(td, t, one);
+      Acc::m128dDivPD(tn, tn, td);
+      p2Select(t, m0, tn, t);
+    }
+    Acc::m128dAnd(r, m0, _mm_set1_pd(MATH_QUARTER_PI));
+
+    // r += t + t * z * P(z).
+    Acc::m128dMulPD(z, t, t);
+    Acc::m128dMulPD(p, z, _mm_set1_pd(8.05374449538e-2));
+    Acc::m128dSubPD(p, p, _mm_set1_pd(1.38776856032e-1));
+    Acc::m128dMulPD(p, p, z);
+    Acc::m128dAddPD(p, p, _mm_set1_pd(1.99777106478e-1));
+    Acc::m128dMulPD(p, p, z);
+    Acc::m128dSubPD(p, p, _mm_set1_pd(3.33329491539e-1));
+    Acc::m128dMulPD(p, p, z);
+    Acc::m128dMulPD(p, p, t);
+    Acc::m128dAddPD(p, p, t);
+    Acc::m128dAddPD(r, r, p);
+
+    // if (|y| > |x|) r = PI/2 - r.
+    Acc::m128dCmpGtPD(m1, ay, ax);
+    Acc::m128dSubPD(p, _mm_set1_pd(MATH_HALF_PI), r);
+    p2Select(r, m1, p, r);
+
+    // if (x < 0) r = PI - r.
+    Acc::m128dCmpLtPD(m1, x0, _mm_setzero_pd());
+    Acc::m128dSubPD(p, _mm_set1_pd(MATH_PI), r);
+    p2Select(r, m1, p, r);
+
+    // r = copysign(r, y).
+    Acc::m128dAnd(m1, y0, sn);
+    Acc::m128dOr(dst0, r, m1);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    double dx = ctx->_d.gradient.conical.simple.xx;
+    double dy = ctx->_d.gradient.conical.simple.xy;
+
+    __m128d offset = _mm_set1_pd(ctx->_d.gradient.conical.simple.offset);
+    __m128d scale = _mm_set1_pd(ctx->_d.gradient.conical.simple.scale);
+
+    __m128i lenMask;
+    Acc::m128iCvtSI128FromSI(lenMask, ctx->_d.gradient.base.len - 1);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(lenMask, lenMask);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double px = _x * dx + fetcher->_d.gradient.conical.simple.px;
+      double py = _x * dy + fetcher->_d.gradient.conical.simple.py;
+
+      do {
+        __m128d px0, px1;
+        __m128d py0, py1;
+        __m128i idx0;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(px0, px1, px, dx);
+        PGradientBase::p4Accumulate(py0, py1, py, dy);
+
+        p2Atan2(px0, py0, px0);
+        p2Atan2(px1, py1, px1);
+
+        // (int)(offset - a * scale) & lenMask, the offset is always greater
+        // than 'a * scale' so the truncation is the same as floor().
+        Acc::m128dMulPD(px0, px0, scale);
+        Acc::m128dMulPD(px1, px1, scale);
+        Acc::m128dSubPD(px0, offset, px0);
+        Acc::m128dSubPD(px1, offset, px1);
+
+        PGradientBase::p4TruncFromPD(idx0, px0, px1);
+        Acc::m128iAnd(idx0, idx0, lenMask);
+
+        PGradientBase::p4FetchRaw(pix0, table, idx0);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientConical::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
 } // RasterOps_SSE2 namespace
 } // Fog namespace
 
@@ -7,16 +7,302 @@
 #ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTLINEAR_P_H
 #define _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTLINEAR_P_H
 
-// [Dependencies]
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientLinear_p.h>
+
+// [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/GradientBase_p.h>
 
 namespace Fog {
 namespace RasterOps_SSE2 {
 
 // ============================================================================
-// [Fog::RasterOps_SSE2]
+// [Fog::RasterOps_SSE2 - PGradientLinear]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Linear gradient fetchers.
+//!
+//! The simple fetchers keep the position of 4 consecutive pixels in a single
+//! register, the table indices are computed by the same 16.16 fixed-point
+//! arithmetic the C fetchers use. The length of the color table is always a
+//! power of two, so repeat and reflect can wrap the position using a mask.
+//!
+//! The projection fetcher accumulates the position exactly like C and divides
+//! two pixels at a time.
+struct FOG_NO_EXPORT PGradientLinear
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get positions of 4 pixels starting at @a pos, the offsets of the
+  //! pixels are in @a off0 (0, xx, xx * 2, xx * 3).
+  static FOG_INLINE void p4PosInit(__m128i& dst0, int pos, const __m128i& off0)
+  {
+    Acc::m128iCvtSI128FromSI(dst0, pos);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(dst0, dst0);
+    Acc::m128iAddPI32(dst0, dst0, off0);
+  }
+
+  static FOG_INLINE void p4OffInit(__m128i& dst0, int xx)
+  {
+    dst0 = _mm_set_epi32(xx * 3, xx * 2, xx, 0);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Pad]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_pad_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len = ctx->_d.gradient.base.len16x16;
+
+    // The position of the last pixel in a group must not overflow, this is
+    // only possible when the whole color table is skipped by a single pixel,
+    // which is handled by C.
+    if (xx > len || xx < -len)
+    {
+      RasterOps_C::PGradientLinear::fetch_simple_nearest_pad<RasterOps_C::PGradientAccessor_PRGB32_Base>(
+        fetcher, span, buffer);
+      return;
+    }
+
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int pos = Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + x * xx;
+
+    // When all pixels are past the end (or the start) of the table the
+    // position is clamped so it can't overflow, the fetched color stays the
+    // same (the first or the last color in the table).
+    int posMin = (xx < 0) ? -1 : INT_MIN;
+    int posMax = (xx < 0) ? INT_MAX : len;
+
+    __m128i cOff;
+    __m128i cLen;
+
+    p4OffInit(cOff, xx);
+    Acc::m128iCvtSI128FromSI(cLen, len);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(cLen, cLen);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      do {
+        __m128i pos0;
+        __m128i pix0;
+        __m128i t0;
+
+        p4PosInit(pos0, pos, cOff);
+
+        // if (pos < 0) pos = 0;
+        Acc::m128iRShiftPI32<31>(t0, pos0);
+        Acc::m128iAndNot(pos0, t0, pos0);
+
+        // if (pos > len) pos = len;
+        Acc::m128iCmpGtPI32(t0, pos0, cLen);
+        Acc::m128iAndNot(pos0, t0, pos0);
+        Acc::m128iAnd(t0, t0, cLen);
+        Acc::m128iOr(pos0, pos0, t0);
+
+        Acc::m128iRShiftPU32<16>(pos0, pos0);
+        PGradientBase::p4FetchRaw(pix0, table, pos0);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+
+        pos += xx * Math::min(w, 4);
+        if (pos < posMin) pos = posMin;
+        if (pos > posMax) pos = posMax;
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += hole * xx;
+        if (pos < posMin) pos = posMin;
+        if (pos > posMax) pos = posMax;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Repeat]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_repeat_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len = ctx->_d.gradient.base.len16x16;
+    FOG_ASSERT((len & (len - 1)) == 0);
+
+    // Unsigned arithmetic, the position wraps around the table length so the
+    // overflow is harmless.
+    uint pos = (uint)Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + (uint)x * (uint)xx;
+
+    __m128i cOff;
+    __m128i cMask;
+
+    p4OffInit(cOff, xx);
+    Acc::m128iCvtSI128FromSI(cMask, len - 1);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(cMask, cMask);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      do {
+        __m128i pos0;
+        __m128i pix0;
+
+        p4PosInit(pos0, (int)pos, cOff);
+        Acc::m128iAnd(pos0, pos0, cMask);
+
+        Acc::m128iRShiftPU32<16>(pos0, pos0);
+        PGradientBase::p4FetchRaw(pix0, table, pos0);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+
+        pos += (uint)xx * (uint)Math::min(w, 4);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += (uint)hole * (uint)xx;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple - Reflect]
+  // ==========================================================================
+
+  static void FOG_FASTCALL fetch_simple_nearest_reflect_prgb32(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(ctx->_d.gradient.base.table);
+
+    P_FETCH_SPAN8_INIT()
+
+    int xx = ctx->_d.gradient.linear.simple.xx16x16;
+    int len = ctx->_d.gradient.base.len16x16;
+    int len2 = len * 2;
+    FOG_ASSERT((len2 & (len2 - 1)) == 0);
+
+    uint pos = (uint)Math::fixed16x16FromFloat(fetcher->_d.gradient.linear.simple.pt) + (uint)x * (uint)xx;
+
+    __m128i cOff;
+    __m128i cLen;
+    __m128i cLen2;
+    __m128i cMask;
+
+    p4OffInit(cOff, xx);
+    Acc::m128iCvtSI128FromSI(cLen, len);
+    Acc::m128iCvtSI128FromSI(cLen2, len2);
+    Acc::m128iCvtSI128FromSI(cMask, len2 - 1);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(cLen, cLen);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(cLen2, cLen2);
+    Acc::m128iShufflePI32<0, 0, 0, 0>(cMask, cMask);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      do {
+        __m128i pos0;
+        __m128i pix0;
+        __m128i t0, t1;
+
+        // The position is wrapped to [0, len2), positions above len are
+        // reflected by 'len2 - pos' (exactly the same value the C fetcher
+        // produces).
+        p4PosInit(pos0, (int)pos, cOff);
+        Acc::m128iAnd(pos0, pos0, cMask);
+
+        Acc::m128iCmpGtPI32(t0, pos0, cLen);
+        Acc::m128iSubPI32(t1, cLen2, pos0);
+        Acc::m128iAnd(t1, t1, t0);
+        Acc::m128iAndNot(pos0, t0, pos0);
+        Acc::m128iOr(pos0, pos0, t1);
+
+        Acc::m128iRShiftPU32<16>(pos0, pos0);
+        PGradientBase::p4FetchRaw(pix0, table, pos0);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+
+        pos += (uint)xx * (uint)Math::min(w, 4);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_HOLE(
+      {
+        pos += (uint)hole * (uint)xx;
+      })
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Projection]
+  // ==========================================================================
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    P_FETCH_SPAN8_INIT()
+
+    double xx = ctx->_d.gradient.linear.proj.xx;
+    double zx = ctx->_d.gradient.linear.proj.zx;
+
+    __m128d off = _mm_set1_pd(ctx->_d.gradient.linear.proj.offset);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double px = fetcher->_d.gradient.linear.proj.pt + _x * xx;
+      double pz = fetcher->_d.gradient.linear.proj.pz + _x * zx;
+
+      do {
+        __m128d px0, px1;
+        __m128d pz0, pz1;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(px0, px1, px, xx);
+        PGradientBase::p4Accumulate(pz0, pz1, pz, zx);
+
+        // off + px / pz.
+        Acc::m128dDivPD(px0, px0, pz0);
+        Acc::m128dDivPD(px1, px1, pz1);
+        Acc::m128dAddPD(px0, px0, off);
+        Acc::m128dAddPD(px1, px1, off);
+
+        accessor.p4FetchAtPD(pix0, px0, px1);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientLinear::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
 } // RasterOps_SSE2 namespace
 } // Fog namespace
 
@@ -7,16 +7,212 @@
 #ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTRADIAL_P_H
 #define _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTRADIAL_P_H
 
-// [Dependencies]
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientRadial_p.h>
+
+// [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/GradientBase_p.h>
 
 namespace Fog {
 namespace RasterOps_SSE2 {
 
 // ============================================================================
-// [Fog::RasterOps_SSE2]
+// [Fog::RasterOps_SSE2 - PGradientRadial]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Radial gradient fetchers.
+//!
+//! The forward differences (simple) and positions (projection) are still
+//! accumulated per pixel exactly like in C, the expensive part (square root,
+//! division and table index calculation) is done for 4 pixels at a time, so
+//! the result is bit-exact.
+struct FOG_NO_EXPORT PGradientRadial
+{
+  // ==========================================================================
+  // [Fetch - Simple]
+  // ==========================================================================
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_simple_nearest(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    P_FETCH_SPAN8_INIT()
+
+    __m128d nm = FOG_XMM_GET_CONST_PD(m128d_nm_nm);
+    __m128d scale = _mm_set1_pd(ctx->_d.gradient.radial.simple.scale);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x    = (double)x;
+      double px    = _x * ctx->_d.gradient.radial.simple.xx + fetcher->_d.gradient.radial.simple.px;
+      double py    = _x * ctx->_d.gradient.radial.simple.xy + fetcher->_d.gradient.radial.simple.py;
+
+      double b     = ctx->_d.gradient.radial.simple.fx * px +
+                     ctx->_d.gradient.radial.simple.fy * py;
+      double b_d   = ctx->_d.gradient.radial.simple.b_d;
+
+      double d     = ctx->_d.gradient.radial.simple.r2mfyfy * px * px +
+                     ctx->_d.gradient.radial.simple.r2mfxfx * py * py +
+                     ctx->_d.gradient.radial.simple._2_fxfy * px * py;
+      double d_d   = ctx->_d.gradient.radial.simple.d_d +
+                     ctx->_d.gradient.radial.simple.d_d_x * px +
+                     ctx->_d.gradient.radial.simple.d_d_y * py;
+      double d_d_d = ctx->_d.gradient.radial.simple.d_d_d;
+
+      do {
+        __m128d b0, b1;
+        __m128d d0, d1;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(b0, b1, b, b_d);
+
+        {
+          double t0 = d; d += d_d; d_d += d_d_d;
+          double t1 = d; d += d_d; d_d += d_d_d;
+          double t2 = d; d += d_d; d_d += d_d_d;
+          double t3 = d; d += d_d; d_d += d_d_d;
+
+          d0 = _mm_set_pd(t1, t0);
+          d1 = _mm_set_pd(t3, t2);
+        }
+
+        // (b + sqrt(abs(d))) * scale.
+        Acc::m128dAnd(d0, d0, nm);
+        Acc::m128dAnd(d1, d1, nm);
+        Acc::m128dSqrtPD(d0, d0);
+        Acc::m128dSqrtPD(d1, d1);
+        Acc::m128dAddPD(d0, d0, b0);
+        Acc::m128dAddPD(d1, d1, b1);
+        Acc::m128dMulPD(d0, d0, scale);
+        Acc::m128dMulPD(d1, d1, scale);
+
+        accessor.p4FetchAtPD(pix0, d0, d1);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientRadial::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Projection]
+  // ==========================================================================
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    P_FETCH_SPAN8_INIT()
+
+    __m128d nm = FOG_XMM_GET_CONST_PD(m128d_nm_nm);
+    __m128d one = FOG_XMM_GET_CONST_PD(m128d_p1_p1);
+
+    __m128d fx = _mm_set1_pd(ctx->_d.gradient.radial.proj.fx);
+    __m128d fy = _mm_set1_pd(ctx->_d.gradient.radial.proj.fy);
+    __m128d fxOrig = _mm_set1_pd(ctx->_d.gradient.radial.proj.fxOrig);
+    __m128d fyOrig = _mm_set1_pd(ctx->_d.gradient.radial.proj.fyOrig);
+
+    __m128d r2mfyfy = _mm_set1_pd(ctx->_d.gradient.radial.proj.r2mfyfy);
+    __m128d r2mfxfx = _mm_set1_pd(ctx->_d.gradient.radial.proj.r2mfxfx);
+    __m128d _2_fxfy = _mm_set1_pd(ctx->_d.gradient.radial.proj._2_fxfy);
+    __m128d scale = _mm_set1_pd(ctx->_d.gradient.radial.simple.scale);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double pz = _x * ctx->_d.gradient.radial.proj.xz + fetcher->_d.gradient.radial.proj.pz;
+      double px = _x * ctx->_d.gradient.radial.proj.xx + fetcher->_d.gradient.radial.proj.px;
+      double py = _x * ctx->_d.gradient.radial.proj.xy + fetcher->_d.gradient.radial.proj.py;
+
+      do {
+        __m128d rx0, rx1;
+        __m128d ry0, ry1;
+        __m128d rz0, rz1;
+        __m128d b0, b1;
+        __m128d d0, d1;
+        __m128d t0, t1;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(rx0, rx1, px, ctx->_d.gradient.radial.proj.xx);
+        PGradientBase::p4Accumulate(ry0, ry1, py, ctx->_d.gradient.radial.proj.xy);
+        PGradientBase::p4Accumulate(rz0, rz1, pz, ctx->_d.gradient.radial.proj.xz);
+
+        // rx = px * (1 / pz) - fxOrig.
+        // ry = py * (1 / pz) - fyOrig.
+        Acc::m128dDivPD(rz0, one, rz0);
+        Acc::m128dDivPD(rz1, one, rz1);
+
+        Acc::m128dMulPD(rx0, rx0, rz0);
+        Acc::m128dMulPD(rx1, rx1, rz1);
+        Acc::m128dMulPD(ry0, ry0, rz0);
+        Acc::m128dMulPD(ry1, ry1, rz1);
+
+        Acc::m128dSubPD(rx0, rx0, fxOrig);
+        Acc::m128dSubPD(rx1, rx1, fxOrig);
+        Acc::m128dSubPD(ry0, ry0, fyOrig);
+        Acc::m128dSubPD(ry1, ry1, fyOrig);
+
+        // b = fx * rx + fy * ry.
+        Acc::m128dMulPD(b0, fx, rx0);
+        Acc::m128dMulPD(b1, fx, rx1);
+        Acc::m128dMulPD(t0, fy, ry0);
+        Acc::m128dMulPD(t1, fy, ry1);
+        Acc::m128dAddPD(b0, b0, t0);
+        Acc::m128dAddPD(b1, b1, t1);
+
+        // d = r2mfyfy * rx * rx + r2mfxfx * ry * ry + _2_fxfy * rx * ry.
+        Acc::m128dMulPD(d0, r2mfyfy, rx0);
+        Acc::m128dMulPD(d1, r2mfyfy, rx1);
+        Acc::m128dMulPD(d0, d0, rx0);
+        Acc::m128dMulPD(d1, d1, rx1);
+
+        Acc::m128dMulPD(t0, r2mfxfx, ry0);
+        Acc::m128dMulPD(t1, r2mfxfx, ry1);
+        Acc::m128dMulPD(t0, t0, ry0);
+        Acc::m128dMulPD(t1, t1, ry1);
+        Acc::m128dAddPD(d0, d0, t0);
+        Acc::m128dAddPD(d1, d1, t1);
+
+        Acc::m128dMulPD(t0, _2_fxfy, rx0);
+        Acc::m128dMulPD(t1, _2_fxfy, rx1);
+        Acc::m128dMulPD(t0, t0, ry0);
+        Acc::m128dMulPD(t1, t1, ry1);
+        Acc::m128dAddPD(d0, d0, t0);
+        Acc::m128dAddPD(d1, d1, t1);
+
+        // (b + sqrt(abs(d))) * scale.
+        Acc::m128dAnd(d0, d0, nm);
+        Acc::m128dAnd(d1, d1, nm);
+        Acc::m128dSqrtPD(d0, d0);
+        Acc::m128dSqrtPD(d1, d1);
+        Acc::m128dAddPD(d0, d0, b0);
+        Acc::m128dAddPD(d1, d1, b1);
+        Acc::m128dMulPD(d0, d0, scale);
+        Acc::m128dMulPD(d1, d1, scale);
+
+        accessor.p4FetchAtPD(pix0, d0, d1);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientRadial::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
 } // RasterOps_SSE2 namespace
 } // Fog namespace
 
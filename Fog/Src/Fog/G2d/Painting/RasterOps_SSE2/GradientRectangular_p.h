@@ -7,16 +7,177 @@
 #ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTRECTANGULAR_P_H
 #define _FOG_G2D_PAINTING_RASTEROPS_SSE2_GRADIENTRECTANGULAR_P_H
 
-// [Dependencies]
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/GradientRectangular_p.h>
+
+// [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/GradientBase_p.h>
 
 namespace Fog {
 namespace RasterOps_SSE2 {
 
 // ============================================================================
-// [Fog::RasterOps_SSE2]
+// [Fog::RasterOps_SSE2 - PGradientRectangular]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Rectangular gradient fetchers.
+//!
+//! Positions are accumulated per pixel exactly like in C, the rest is done for
+//! 4 pixels at a time, so the result is bit-exact.
+struct FOG_NO_EXPORT PGradientRectangular
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Get the table position of 2 pixels, which is
+  //! 'max((px < 0) ? px * px0 : px * px1, (py < 0) ? py * py0 : py * py1)'.
+  static FOG_INLINE void p2Position(__m128d& dst0,
+    const __m128d& px, const __m128d& py,
+    const __m128d& px0, const __m128d& py0,
+    const __m128d& px1, const __m128d& py1)
+  {
+    __m128d zero = _mm_setzero_pd();
+    __m128d m0, m1;
+    __m128d rx, ry;
+    __m128d t0, t1;
+
+    Acc::m128dCmpLtPD(m0, px, zero);
+    Acc::m128dCmpLtPD(m1, py, zero);
+
+    Acc::m128dMulPD(rx, px, px1);
+    Acc::m128dMulPD(t0, px, px0);
+    Acc::m128dMulPD(ry, py, py1);
+    Acc::m128dMulPD(t1, py, py0);
+
+    Acc::m128dAnd(t0, t0, m0);
+    Acc::m128dAndNot(rx, m0, rx);
+    Acc::m128dAnd(t1, t1, m1);
+    Acc::m128dAndNot(ry, m1, ry);
+
+    Acc::m128dOr(rx, rx, t0);
+    Acc::m128dOr(ry, ry, t1);
+
+    Acc::m128dMaxPD(dst0, rx, ry);
+  }
+
+  // ==========================================================================
+  // [Fetch - Simple]
+  // ==========================================================================
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_simple_nearest(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    P_FETCH_SPAN8_INIT()
+
+    double dx = ctx->_d.gradient.rectangular.simple.xx;
+    double dy = ctx->_d.gradient.rectangular.simple.xy;
+
+    __m128d px0 = _mm_set1_pd(ctx->_d.gradient.rectangular.simple.px0);
+    __m128d py0 = _mm_set1_pd(ctx->_d.gradient.rectangular.simple.py0);
+    __m128d px1 = _mm_set1_pd(ctx->_d.gradient.rectangular.simple.px1);
+    __m128d py1 = _mm_set1_pd(ctx->_d.gradient.rectangular.simple.py1);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double px = _x * dx + fetcher->_d.gradient.rectangular.simple.px;
+      double py = _x * dy + fetcher->_d.gradient.rectangular.simple.py;
+
+      do {
+        __m128d rx0, rx1;
+        __m128d ry0, ry1;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(rx0, rx1, px, dx);
+        PGradientBase::p4Accumulate(ry0, ry1, py, dy);
+
+        p2Position(rx0, rx0, ry0, px0, py0, px1, py1);
+        p2Position(rx1, rx1, ry1, px0, py0, px1, py1);
+
+        accessor.p4FetchAtPD(pix0, rx0, rx1);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientRectangular::seek_simple(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // ==========================================================================
+  // [Fetch - Projection]
+  // ==========================================================================
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    P_FETCH_SPAN8_INIT()
+
+    double dx = ctx->_d.gradient.rectangular.proj.xx;
+    double dy = ctx->_d.gradient.rectangular.proj.xy;
+    double dz = ctx->_d.gradient.rectangular.proj.xz;
+
+    __m128d one = FOG_XMM_GET_CONST_PD(m128d_p1_p1);
+
+    __m128d px0 = _mm_set1_pd(ctx->_d.gradient.rectangular.proj.px0);
+    __m128d py0 = _mm_set1_pd(ctx->_d.gradient.rectangular.proj.py0);
+    __m128d px1 = _mm_set1_pd(ctx->_d.gradient.rectangular.proj.px1);
+    __m128d py1 = _mm_set1_pd(ctx->_d.gradient.rectangular.proj.py1);
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+
+      double _x = (double)x;
+      double pz = _x * ctx->_d.gradient.rectangular.proj.xz + fetcher->_d.gradient.rectangular.proj.pz;
+      double px = _x * dx + fetcher->_d.gradient.rectangular.proj.px;
+      double py = _x * dy + fetcher->_d.gradient.rectangular.proj.py;
+
+      do {
+        __m128d rx0, rx1;
+        __m128d ry0, ry1;
+        __m128d rz0, rz1;
+        __m128i pix0;
+
+        PGradientBase::p4Accumulate(rx0, rx1, px, dx);
+        PGradientBase::p4Accumulate(ry0, ry1, py, dy);
+        PGradientBase::p4Accumulate(rz0, rz1, pz, dz);
+
+        // rx = px * (1 / pz).
+        // ry = py * (1 / pz).
+        Acc::m128dDivPD(rz0, one, rz0);
+        Acc::m128dDivPD(rz1, one, rz1);
+
+        Acc::m128dMulPD(rx0, rx0, rz0);
+        Acc::m128dMulPD(rx1, rx1, rz1);
+        Acc::m128dMulPD(ry0, ry0, rz0);
+        Acc::m128dMulPD(ry1, ry1, rz1);
+
+        p2Position(rx0, rx0, ry0, px0, py0, px1, py1);
+        p2Position(rx1, rx1, ry1, px0, py0, px1, py1);
+
+        accessor.p4FetchAtPD(pix0, rx0, rx1);
+        dst = PGradientBase::p4Store(dst, pix0, w);
+      } while ((w -= 4) > 0);
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    RasterOps_C::PGradientRectangular::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
 } // RasterOps_SSE2 namespace
 } // Fog namespace
 
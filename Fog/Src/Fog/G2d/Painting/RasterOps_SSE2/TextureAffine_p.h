@@ -0,0 +1,1623 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREAFFINE_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREAFFINE_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_C/TextureAffine_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/TextureBase_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAffine]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 version of @c RasterOps_C::PTextureAffine.
+//!
+//! The coordinates are calculated per pixel exactly like in C, the fetched
+//! pixels are collected by @c PTextureNearest4 or @c PTextureBilinear4 and
+//! normalized (and interpolated) four at a time. The floating point path
+//! (used only if the fixed point could overflow) is handled by C.
+struct FOG_NO_EXPORT PTextureAffine
+{
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum { MAX_FIXED_STEP = RasterOps_C::PTextureAffine::MAX_FIXED_STEP };
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Nearest) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_nearest_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::bound<int>(Math::fixed16x16FromFloat(offy) >> 16, 0, th);
+        srcPixels += py0 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+
+            w -= i;
+
+            do {
+              int px0 = Math::bound<int>(px >> 16, 0, tw);
+
+              dst = batch.add(accessor, dst, srcPixels + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+            int py = Math::fixed16x16FromFloat(offy + _x * xy);
+
+            w -= i;
+
+            do {
+              int px0 = Math::bound<int>(px >> 16, 0, tw);
+              int py0 = Math::bound<int>(py >> 16, 0, th);
+
+              dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+              py += xy16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_nearest_pad<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bilinear) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bilinear_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py = Math::fixed16x16FromFloat(offy);
+        int py0 = py >> 16;
+
+        uint32_t wy = (uint)(py >> 8) & 0xFF;
+
+        const uint8_t* srcLine0 = srcPixels;
+        const uint8_t* srcLine1 = srcPixels;
+
+        if (py0 >= 0)
+        {
+          srcLine0 += Math::min<int>(py0    , th) * srcStride;
+          srcLine1 += Math::min<int>(py0 + 1, th) * srcStride;
+        }
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              if (FOG_LIKELY((uint)px0 < (uint)tw))
+              {
+                accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP + Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP + Accessor::SRC_BPP);
+              }
+              else
+              {
+                if (px0 < 0) px0 = 0; else px0 = tw;
+                accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+
+                pix_x1y0 = pix_x0y0;
+                pix_x1y1 = pix_x0y1;
+              }
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+            int py = Math::fixed16x16FromFloat(offy + _x * xy);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+              {
+                const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+                accessor.fetchRaw(pix_x0y0, srcLine);
+                accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+                srcLine += srcStride;
+                accessor.fetchRaw(pix_x0y1, srcLine);
+                accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+              }
+              else
+              {
+                int px1 = px0 + 1;
+                int py1 = py0 + 1;
+
+                if (px0 < 0) { px0 = px1 = 0; } else if (px0 >= tw) { px0 = px1 = tw; }
+                if (py0 < 0) { py0 = py1 = 0; } else if (py0 >= th) { py0 = py1 = th; }
+
+                const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+                const uint8_t* srcLine1 = srcPixels + (uint)py1 * srcStride;
+
+                accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+              }
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+              uint32_t wy = (uint)(py >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+              py += xy16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_bilinear_pad<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Nearest) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_nearest_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      int mx16x16 = ctx->_d.texture.affine.mx16x16;
+      int my16x16 = ctx->_d.texture.affine.my16x16;
+
+      int rx16x16 = ctx->_d.texture.affine.rx16x16;
+      int ry16x16 = ctx->_d.texture.affine.ry16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+
+        FOG_ASSERT(py0 >= 0 && py0 <= th);
+        srcPixels += py0 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+
+              dst = batch.add(accessor, dst, srcPixels + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+            int py = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offy + _x * xy), my16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+              py += xy16x16;
+
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+              if ((uint)py >= (uint)my16x16) py += ry16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_nearest_repeat<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bilinear) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bilinear_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      int mx16x16 = ctx->_d.texture.affine.mx16x16;
+      int my16x16 = ctx->_d.texture.affine.my16x16;
+
+      int rx16x16 = ctx->_d.texture.affine.rx16x16;
+      int ry16x16 = ctx->_d.texture.affine.ry16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+        FOG_ASSERT(py0 >= 0 && py0 <= th);
+
+        uint32_t wy = (uint)(Math::fixed24x8FromFloat(offy) & 0xFF);
+
+        const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+        if (++py0 > th) py0 = 0;
+        const uint8_t* srcLine1 = srcPixels + py0 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+
+              if (++px0 > tw) px0 = 0;
+
+              accessor.fetchRaw(pix_x1y0, srcLine0 + px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y1, srcLine1 + px0 * Accessor::SRC_BPP);
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+            int py = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offy + _x * xy), my16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+              if (++py0 > th) py0 = 0;
+              const uint8_t* srcLine1 = srcPixels + (uint)py0 * srcStride;
+
+              accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+
+              if (++px0 > tw) px0 = 0;
+
+              accessor.fetchRaw(pix_x1y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+              uint32_t wy = (uint)(py >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+              py += xy16x16;
+
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+              if ((uint)py >= (uint)my16x16) py += ry16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_bilinear_repeat<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Nearest) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_nearest_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      int mx16x16 = ctx->_d.texture.affine.mx16x16;
+      int my16x16 = ctx->_d.texture.affine.my16x16;
+
+      int rx16x16 = ctx->_d.texture.affine.rx16x16;
+      int ry16x16 = ctx->_d.texture.affine.ry16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+        if (py0 > th) py0 = th2 - py0;
+
+        FOG_ASSERT(py0 >= 0 && py0 <= th);
+        srcPixels += py0 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              if (px0 > tw) px0 = tw2 - px0;
+
+              dst = batch.add(accessor, dst, srcPixels + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+            int py = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offy + _x * xy), my16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              if (px0 > tw) px0 = tw2 - px0;
+              if (py0 > th) py0 = th2 - py0;
+
+              dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+              px += xx16x16;
+              py += xy16x16;
+
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+              if ((uint)py >= (uint)my16x16) py += ry16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_nearest_reflect<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bilinear) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bilinear_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      int mx16x16 = ctx->_d.texture.affine.mx16x16;
+      int my16x16 = ctx->_d.texture.affine.my16x16;
+
+      int rx16x16 = ctx->_d.texture.affine.rx16x16;
+      int ry16x16 = ctx->_d.texture.affine.ry16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+        int py1;
+
+        RasterOps_C::Helpers::p_reflect_integer(py0, py1, th, th2);
+
+        uint32_t wy = (uint)(Math::fixed24x8FromFloat(offy) & 0xFF);
+
+        const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+        const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16, px1;
+              RasterOps_C::Helpers::p_reflect_integer(px0, px1, tw, tw2);
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+
+              accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offx + _x * xx), mx16x16);
+            int py = RasterOps_C::Helpers::p_repeat_integer(Math::fixed16x16FromFloat(offy + _x * xy), my16x16);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16, px1;
+              int py0 = py >> 16, py1;
+
+              RasterOps_C::Helpers::p_reflect_integer(px0, px1, tw, tw2);
+              RasterOps_C::Helpers::p_reflect_integer(py0, py1, th, th2);
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+              const uint8_t* srcLine1 = srcPixels + (uint)py1 * srcStride;
+
+              accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y0, srcLine0 + (uint)px1 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+              accessor.fetchRaw(pix_x1y1, srcLine1 + (uint)px1 * Accessor::SRC_BPP);
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+              uint32_t wy = (uint)(py >> 8) & 0xFF;
+
+              dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              px += xx16x16;
+              py += xy16x16;
+
+              if ((uint)px >= (uint)mx16x16) px += rx16x16;
+              if ((uint)py >= (uint)my16x16) py += ry16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_bilinear_reflect<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Nearest) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_nearest_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      if (ctx->_d.texture.affine.xyZero)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+        if ((uint)py0 > (uint)th) goto _FetchSolid;
+
+        srcPixels += py0 * srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+
+              if ((uint)px0 <= (uint)tw)
+                dst = batch.add(accessor, dst, srcPixels + px0 * Accessor::SRC_BPP);
+              else
+                dst = batch.addSolid(accessor, dst, clamp);
+
+              px += xx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+            int py = Math::fixed16x16FromFloat(offy + _x * xy);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              if (((uint)px0 <= (uint)tw) & ((uint)py0 <= (uint)th))
+                dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+              else
+                dst = batch.addSolid(accessor, dst, clamp);
+
+              px += xx16x16;
+              py += xy16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_nearest_clamp<Accessor>(fetcher, span, buffer);
+      return;
+    }
+    goto _FetchEnd;
+
+    // ------------------------------------------------------------------------
+    // [Solid]
+    // ------------------------------------------------------------------------
+
+_FetchSolid:
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+      dst = accessor.fill(dst, clamp, w);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+_FetchEnd:
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bilinear) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bilinear_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop - FixedPoint]
+    // ------------------------------------------------------------------------
+
+    if (ctx->_d.texture.affine.safeFixedPoint)
+    {
+      int xx16x16 = ctx->_d.texture.affine.xx16x16;
+      int xy16x16 = ctx->_d.texture.affine.xy16x16;
+
+      if (ctx->_d.texture.affine.xyZero && offy >= 0.0 && offy < (double)th)
+      {
+        int py0 = Math::fixed16x16FromFloat(offy) >> 16;
+        FOG_ASSERT(py0 >= 0 && py0 < th);
+
+        uint32_t wy = (uint)(Math::fixed24x8FromFloat(offy) & 0xFF);
+
+        const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+        const uint8_t* srcLine1 = srcLine0 + srcStride;
+
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              if (FOG_LIKELY((uint)px0 < (uint)tw))
+              {
+                accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y0, srcLine0 + (uint)px0 * Accessor::SRC_BPP + Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP);
+                accessor.fetchRaw(pix_x1y1, srcLine1 + (uint)px0 * Accessor::SRC_BPP + Accessor::SRC_BPP);
+
+                dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              }
+              else if (px0 == -1)
+              {
+                accessor.fetchNorm(pix_x1y0, srcLine0);
+                accessor.fetchNorm(pix_x1y1, srcLine1);
+
+                dst = batch.addNorm(accessor, dst, clamp, pix_x1y0, clamp, pix_x1y1, wx, wy);
+              }
+              else if (px0 == tw)
+              {
+                accessor.fetchNorm(pix_x0y0, srcLine0 + tw * Accessor::SRC_BPP);
+                accessor.fetchNorm(pix_x0y1, srcLine1 + tw * Accessor::SRC_BPP);
+
+                dst = batch.addNorm(accessor, dst, pix_x0y0, clamp, pix_x0y1, clamp, wx, wy);
+              }
+              else
+              {
+                dst = batch.addSolid(accessor, dst, clamp);
+              }
+
+              px += xx16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+      else
+      {
+        P_FETCH_SPAN8_BEGIN()
+          P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+          double _x = (double)x;
+
+          for (;;)
+          {
+            int i = Math::min<int>(w, MAX_FIXED_STEP);
+            int px = Math::fixed16x16FromFloat(offx + _x * xx);
+            int py = Math::fixed16x16FromFloat(offy + _x * xy);
+
+            w -= i;
+
+            do {
+              int px0 = px >> 16;
+              int py0 = py >> 16;
+
+              typename Accessor::Pixel pix_x0y0;
+              typename Accessor::Pixel pix_x1y0;
+              typename Accessor::Pixel pix_x0y1;
+              typename Accessor::Pixel pix_x1y1;
+
+              uint32_t wx = (uint)(px >> 8) & 0xFF;
+              uint32_t wy = (uint)(py >> 8) & 0xFF;
+
+              if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+              {
+                const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+                accessor.fetchRaw(pix_x0y0, srcLine);
+                accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+                srcLine += srcStride;
+                accessor.fetchRaw(pix_x0y1, srcLine);
+                accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+
+                dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+              }
+              else
+              {
+                int px1 = px0 + 1;
+                int py1 = py0 + 1;
+
+                if ((uint)px1 <= (uint)tw+1 && (uint)py1 <= (uint)th+1)
+                {
+                  const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+                  const uint8_t* srcLine1 = srcPixels + (uint)py1 * srcStride;
+
+                  pix_x0y0 = clamp;
+                  pix_x1y0 = clamp;
+                  pix_x0y1 = clamp;
+                  pix_x1y1 = clamp;
+
+                  if ((uint)px0 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+                  if ((uint)px1 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+                  if ((uint)px0 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+                  if ((uint)px1 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+                  dst = batch.addNorm(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+                }
+                else
+                {
+                  dst = batch.addSolid(accessor, dst, clamp);
+                }
+              }
+
+              px += xx16x16;
+              py += xy16x16;
+            } while (--i);
+
+            if (w == 0) break;
+            _x += (double)MAX_FIXED_STEP;
+          }
+
+          dst = batch.flush(accessor, dst);
+          P_FETCH_SPAN8_NEXT()
+        P_FETCH_SPAN8_END()
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Loop - Float]
+    // ------------------------------------------------------------------------
+
+    else
+    {
+      RasterOps_C::PTextureAffine::fetch_affine_bilinear_clamp<Accessor>(fetcher, span, buffer);
+      return;
+    }
+
+    goto _FetchEnd;
+
+    // ------------------------------------------------------------------------
+    // [Solid]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+      dst = accessor.fill(dst, clamp, w);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+_FetchEnd:
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Helpers]
+  // --------------------------------------------------------------------------
+
+  //! @brief Pack the weights @a w0 and @a w1 into all PI16 pairs of @a dst0.
+  static FOG_INLINE void _bicubic_weights2(__m128i& dst0, int w0, int w1)
+  {
+    Acc::m128iCvtSI128FromSI(dst0, (int)(((uint)w1 << 16) | ((uint)w0 & 0xFFFF)));
+    Acc::m128iShufflePI32<0, 0, 0, 0>(dst0, dst0);
+  }
+
+  //! @brief Convolve the pixels in @a pix0 (stored as p0, p2, p1, p3) with
+  //! the weights @a w01 and @a w23, the result is 4 components (PI32).
+  static FOG_INLINE void _bicubic_row(__m128i& dst0, const __m128i& pix0, const __m128i& w01, const __m128i& w23)
+  {
+    __m128i t0, t1;
+
+    // Interleave the components of pixels p0/p1 and p2/p3.
+    Acc::m128iRShiftSU128<64>(t0, pix0);
+    Acc::m128iUnpackPI16FromPI8Lo(t0, pix0, t0);
+
+    Acc::m128iUnpackPI16FromPI8Hi(t1, t0);
+    Acc::m128iUnpackPI16FromPI8Lo(t0, t0);
+
+    Acc::m128iMAddPI16(t0, t0, w01);
+    Acc::m128iMAddPI16(t1, t1, w23);
+    Acc::m128iAddPI32(dst0, t0, t1);
+  }
+
+  //! @brief Convolve two rows @a r0 and @a r1 (PI32, 8-bit fraction) with the
+  //! weights @a w01.
+  static FOG_INLINE void _bicubic_col(__m128i& dst0, const __m128i& r0, const __m128i& r1, const __m128i& w01)
+  {
+    __m128i t0, t1;
+
+    Acc::m128iPackPI16FromPI32(t0, r0, r1);
+    Acc::m128iRShiftSU128<64>(t1, t0);
+    Acc::m128iUnpackPI32FromPI16Lo(t0, t0, t1);
+    Acc::m128iMAddPI16(dst0, t0, w01);
+  }
+
+  //! @brief SSE2 version of @c RasterOps_C::PTextureAffine::_fetch_affine_bicubic().
+  //!
+  //! The 4 taps of each row are convolved by a single PMADDWD pair, the rows
+  //! are rounded to integers before they are convolved vertically, so the
+  //! result can differ by one from the C version.
+  template<typename Accessor, uint32_t TileMode>
+  static FOG_INLINE void _fetch_affine_bicubic(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.affine.xx;
+    double xy = ctx->_d.texture.affine.xy;
+
+    double mx = ctx->_d.texture.affine.mx;
+    double my = ctx->_d.texture.affine.my;
+
+    double offx = fetcher->_d.texture.affine.px;
+    double offy = fetcher->_d.texture.affine.py;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    // Used to check whether all 16 taps are inside the texture.
+    int tw3 = Math::max<int>(tw - 3, 0);
+    int th3 = Math::max<int>(th - 3, 0);
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT()
+      double _x = (double)x;
+
+      double px = offx + _x * xx;
+      double py = offy + _x * xy;
+
+      do {
+        double fx = px;
+        double fy = py;
+
+        if (TileMode == TEXTURE_TILE_PAD || TileMode == TEXTURE_TILE_CLAMP)
+        {
+          fx = Math::bound<double>(fx, -4.0, mx + 4.0);
+          fy = Math::bound<double>(fy, -4.0, my + 4.0);
+        }
+        else
+        {
+          if (!(fx >= 0.0 && fx < mx)) fx = Math::repeat(fx, mx);
+          if (!(fy >= 0.0 && fy < my)) fy = Math::repeat(fy, my);
+        }
+
+        int fx24x8 = Math::fixed24x8FromFloat(fx);
+        int fy24x8 = Math::fixed24x8FromFloat(fy);
+
+        int wx[4];
+        int wy[4];
+
+        RasterOps_C::PTextureAffine::_bicubic_weights(wx, fx24x8 & 0xFF);
+        RasterOps_C::PTextureAffine::_bicubic_weights(wy, fy24x8 & 0xFF);
+
+        __m128i wx01, wx23;
+        __m128i wy01, wy23;
+
+        _bicubic_weights2(wx01, wx[0], wx[1]);
+        _bicubic_weights2(wx23, wx[2], wx[3]);
+        _bicubic_weights2(wy01, wy[0], wy[1]);
+        _bicubic_weights2(wy23, wy[2], wy[3]);
+
+        __m128i row[4];
+
+        int x0 = (fx24x8 >> 8) - 1;
+        int y0 = (fy24x8 >> 8) - 1;
+
+        if (FOG_LIKELY(((uint)x0 < (uint)tw3) & ((uint)y0 < (uint)th3)))
+        {
+          const uint8_t* srcLine = srcPixels + y0 * srcStride + (uint)x0 * Accessor::SRC_BPP;
+
+          for (int j = 0; j < 4; j++)
+          {
+            __m128i pix0;
+
+            accessor.fetchRaw4(pix0, srcLine);
+            accessor.normalize4(pix0, pix0);
+            Acc::m128iShufflePI32<3, 1, 2, 0>(pix0, pix0);
+
+            _bicubic_row(row[j], pix0, wx01, wx23);
+            srcLine += srcStride;
+          }
+        }
+        else
+        {
+          int tx[4];
+          const uint8_t* srcLine[4];
+
+          for (int k = 0; k < 4; k++)
+          {
+            int ty = RasterOps_C::PTextureAffine::_bicubic_index<TileMode>(y0 + k, th);
+
+            tx[k] = RasterOps_C::PTextureAffine::_bicubic_index<TileMode>(x0 + k, tw);
+            srcLine[k] = (ty >= 0) ? srcPixels + ty * srcStride : NULL;
+          }
+
+          for (int j = 0; j < 4; j++)
+          {
+            typename Accessor::Pixel pix[4];
+
+            for (int k = 0; k < 4; k++)
+            {
+              if (TileMode == TEXTURE_TILE_CLAMP && (srcLine[j] == NULL || tx[k] < 0))
+                pix[k] = clamp;
+              else
+                accessor.fetchNorm(pix[k], srcLine[j] + (uint)tx[k] * Accessor::SRC_BPP);
+            }
+
+            __m128i pix0 = _mm_setr_epi32((int)pix[0], (int)pix[2], (int)pix[1], (int)pix[3]);
+            _bicubic_row(row[j], pix0, wx01, wx23);
+          }
+        }
+
+        for (int j = 0; j < 4; j++)
+        {
+          Acc::m128iAddPI32(row[j], row[j], FOG_XMM_GET_CONST_PI(0080000000800000_0080000000800000));
+          Acc::m128iRShiftPI32<8>(row[j], row[j]);
+        }
+
+        __m128i c0, c1;
+
+        _bicubic_col(c0, row[0], row[1], wy01);
+        _bicubic_col(c1, row[2], row[3], wy23);
+
+        Acc::m128iAddPI32(c0, c0, c1);
+        Acc::m128iAddPI32(c0, c0, FOG_XMM_GET_CONST_PI(0080000000800000_0080000000800000));
+        Acc::m128iRShiftPI32<8>(c0, c0);
+
+        // Clamp to [0, 255] and the color components to the alpha.
+        Acc::m128iPackPI16FromPI32(c0, c0);
+        Acc::m128iMaxPI16(c0, c0, _mm_setzero_si128());
+        Acc::m128iMinPI16(c0, c0, FOG_XMM_GET_CONST_PI(00FF00FF00FF00FF_00FF00FF00FF00FF));
+        Acc::m128iShufflePI16Lo<3, 3, 3, 3>(c1, c0);
+        Acc::m128iMinPI16(c0, c0, c1);
+        Acc::m128iPackPU8FromPU16(c0, c0);
+
+        Acc::m128iStore4(dst, c0);
+
+        dst += Accessor::DST_BPP;
+        px += xx;
+        py += xy;
+      } while (--w);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_PAD>(fetcher, span, buffer);
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_REPEAT>(fetcher, span, buffer);
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_REFLECT>(fetcher, span, buffer);
+    RasterOps_C::PTextureBase::seek_affine_repeat_reflect(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Affine (Bicubic) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_affine_bicubic_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_affine_bicubic<Accessor, TEXTURE_TILE_CLAMP>(fetcher, span, buffer);
+    RasterOps_C::PTextureBase::seek_affine_pad_clamp(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREAFFINE_P_H
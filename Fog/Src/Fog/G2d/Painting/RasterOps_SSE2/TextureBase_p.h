@@ -0,0 +1,610 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREBASE_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREBASE_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/TextureBase_p.h>
+
+// [Dependencies - RasterOps_SSE2]
+#include <Fog/G2d/Painting/RasterOps_SSE2/BaseDefs_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/BaseHelpers_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureBase]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Texture helpers working with 4 pixels at a time.
+//!
+//! All interpolations use 16-bit lanes and give exactly the same results as
+//! the C interpolation (P_INTERPOLATE_C_32_2 and P_INTERPOLATE_C_32_4), the
+//! weights are never larger than 256 and their sum is never larger than 256,
+//! so the products and sums fit into 16 bits.
+struct FOG_NO_EXPORT PTextureBase
+{
+  // ==========================================================================
+  // [Pack]
+  // ==========================================================================
+
+  //! @brief Pack four 32-bit pixels into @a dst0.
+  static FOG_INLINE void p4Pack(__m128i& dst0, uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3)
+  {
+    __m128i t0, t1, t2;
+
+    Acc::m128iCvtSI128FromSI(dst0, (int)c0);
+    Acc::m128iCvtSI128FromSI(t0, (int)c1);
+    Acc::m128iCvtSI128FromSI(t1, (int)c2);
+    Acc::m128iCvtSI128FromSI(t2, (int)c3);
+
+    Acc::m128iUnpackPI64FromPI32Lo(dst0, dst0, t0);
+    Acc::m128iUnpackPI64FromPI32Lo(t1, t1, t2);
+    Acc::m128iUnpackSI128FromPI64Lo(dst0, dst0, t1);
+  }
+
+  //! @brief Get 16-bit weight @a w in all lanes.
+  static FOG_INLINE void p4Weight(__m128i& dst0, uint w)
+  {
+    Acc::m128iCvtSI128FromSI(dst0, (int)w);
+    Acc::m128iExtendPI16FromSI16(dst0, dst0);
+  }
+
+  //! @brief Expand four 32-bit weights (one per pixel) into 16-bit lanes of
+  //! the first two pixels (@a dst0) and the last two pixels (@a dst1).
+  static FOG_INLINE void p4WeightExpand(__m128i& dst0, __m128i& dst1, const __m128i& w0)
+  {
+    Acc::m128iPackPI16FromPI32(dst0, w0);
+    Acc::m128iUnpackPI32FromPI16Lo(dst0, dst0, dst0);
+    Acc::m128iUnpackPI64FromPI32Hi(dst1, dst0, dst0);
+    Acc::m128iUnpackPI64FromPI32Lo(dst0, dst0, dst0);
+  }
+
+  // ==========================================================================
+  // [Interpolate]
+  // ==========================================================================
+
+  //! @brief Multiply 4 pixels by 16-bit weights (@a w0 for the first two and
+  //! @a w1 for the last two pixels) and add them to @a a0 and @a a1.
+  static FOG_INLINE void p4MulAdd(__m128i& a0, __m128i& a1,
+    const __m128i& c0, const __m128i& w0, const __m128i& w1)
+  {
+    __m128i t0, t1;
+
+    Acc::m128iUnpackPI16FromPI8Lo(t0, c0);
+    Acc::m128iUnpackPI16FromPI8Hi(t1, c0);
+    Acc::m128iMulLoPI16(t0, t0, w0);
+    Acc::m128iMulLoPI16(t1, t1, w1);
+    Acc::m128iAddPI16(a0, a0, t0);
+    Acc::m128iAddPI16(a1, a1, t1);
+  }
+
+  //! @brief Pack the result of interpolation.
+  static FOG_INLINE void p4Pack8(__m128i& dst0, __m128i& a0, __m128i& a1)
+  {
+    Acc::m128iRShiftPU16<8>(a0, a0);
+    Acc::m128iRShiftPU16<8>(a1, a1);
+    Acc::m128iPackPU8FromPU16(dst0, a0, a1);
+  }
+
+  //! @brief Interpolate 4 pixels by 2 weights, same for all pixels.
+  static FOG_INLINE void p4Interpolate_2(__m128i& dst0,
+    const __m128i& c0, const __m128i& w0,
+    const __m128i& c1, const __m128i& w1)
+  {
+    __m128i a0, a1;
+
+    Acc::m128iZero(a0);
+    Acc::m128iZero(a1);
+
+    p4MulAdd(a0, a1, c0, w0, w0);
+    p4MulAdd(a0, a1, c1, w1, w1);
+    p4Pack8(dst0, a0, a1);
+  }
+
+  //! @brief Interpolate 4 pixels by 4 weights, same for all pixels.
+  static FOG_INLINE void p4Interpolate_4(__m128i& dst0,
+    const __m128i& c0, const __m128i& w0,
+    const __m128i& c1, const __m128i& w1,
+    const __m128i& c2, const __m128i& w2,
+    const __m128i& c3, const __m128i& w3)
+  {
+    __m128i a0, a1;
+
+    Acc::m128iZero(a0);
+    Acc::m128iZero(a1);
+
+    p4MulAdd(a0, a1, c0, w0, w0);
+    p4MulAdd(a0, a1, c1, w1, w1);
+    p4MulAdd(a0, a1, c2, w2, w2);
+    p4MulAdd(a0, a1, c3, w3, w3);
+    p4Pack8(dst0, a0, a1);
+  }
+
+  //! @brief Interpolate four neighbors of 4 pixels, each pixel has its own
+  //! @a wx and @a wy (0-255, in 32-bit lanes).
+  //!
+  //! The weights are calculated the same way as in C:
+  //!
+  //!   w00 = ((256 - wx) * (256 - wy)) >> 8
+  //!   w10 = ((      wx) * (256 - wy)) >> 8
+  //!   w01 = ((256 - wx) * (      wy)) >> 8
+  //!   w11 = ((      wx) * (      wy)) >> 8
+  static FOG_INLINE void p4InterpolateBilinear(__m128i& dst0,
+    const __m128i& p00, const __m128i& p10,
+    const __m128i& p01, const __m128i& p11,
+    const __m128i& wx, const __m128i& wy)
+  {
+    __m128i c256;
+    __m128i iwx, iwy;
+    __m128i w0, w1;
+    __m128i a0, a1;
+
+    Acc::m128iCvtSI128FromSI(c256, 256);
+    Acc::m128iExtendPI32FromSI32(c256, c256);
+    Acc::m128iSubPI32(iwx, c256, wx);
+    Acc::m128iSubPI32(iwy, c256, wy);
+
+    Acc::m128iZero(a0);
+    Acc::m128iZero(a1);
+
+    // The high 16 bits of each 32-bit lane are zero, MAdd is 32-bit multiply.
+    Acc::m128iMAddPI16(w0, iwx, iwy);
+    Acc::m128iRShiftPU32<8>(w0, w0);
+    p4WeightExpand(w0, w1, w0);
+    p4MulAdd(a0, a1, p00, w0, w1);
+
+    Acc::m128iMAddPI16(w0, wx, iwy);
+    Acc::m128iRShiftPU32<8>(w0, w0);
+    p4WeightExpand(w0, w1, w0);
+    p4MulAdd(a0, a1, p10, w0, w1);
+
+    Acc::m128iMAddPI16(w0, iwx, wy);
+    Acc::m128iRShiftPU32<8>(w0, w0);
+    p4WeightExpand(w0, w1, w0);
+    p4MulAdd(a0, a1, p01, w0, w1);
+
+    Acc::m128iMAddPI16(w0, wx, wy);
+    Acc::m128iRShiftPU32<8>(w0, w0);
+    p4WeightExpand(w0, w1, w0);
+    p4MulAdd(a0, a1, p11, w0, w1);
+
+    p4Pack8(dst0, a0, a1);
+  }
+
+  // ==========================================================================
+  // [Store]
+  // ==========================================================================
+
+  //! @brief Store the first @a n pixels of @a src0 (n is 1 to 4).
+  static FOG_INLINE uint8_t* p4StorePartial(uint8_t* dst, const __m128i& src0, int n)
+  {
+    __m128i t0 = src0;
+
+    do {
+      Acc::m128iStore4(dst, t0);
+      Acc::m128iRShiftSU128<32>(t0, t0);
+      dst += 4;
+    } while (--n);
+
+    return dst;
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureNearest4]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Four pixels collected by an affine (nearest) fetcher to be fetched
+//! and normalized at once.
+//!
+//! The coordinates are calculated per pixel exactly like in C, only the
+//! source addresses are collected. Pixels outside of the texture (clamp) are
+//! stored in @c solid and fetched from there, the @c mask is then used to
+//! replace the normalized pixel by the solid one.
+struct FOG_NO_EXPORT PTextureNearest4
+{
+  FOG_INLINE PTextureNearest4() :
+    length(0),
+    hasSolid(0)
+  {
+  }
+
+  //! @brief Add the pixel at @a s0, store the batch if it's full.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* add(Accessor& accessor, uint8_t* dst, const uint8_t* s0)
+  {
+    src[length] = s0;
+    mask[length] = 0;
+
+    if (++length < 4)
+      return dst;
+    return store(accessor, dst);
+  }
+
+  //! @brief Add the already normalized pixel @a c0, store the batch if it's
+  //! full.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* addSolid(Accessor& accessor, uint8_t* dst, uint32_t c0)
+  {
+    solid[length] = c0;
+    mask[length] = 0xFFFFFFFF;
+    src[length] = reinterpret_cast<const uint8_t*>(&solid[length]);
+    hasSolid = 1;
+
+    if (++length < 4)
+      return dst;
+    return store(accessor, dst);
+  }
+
+  //! @brief Store the remaining pixels.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* flush(Accessor& accessor, uint8_t* dst)
+  {
+    if (length == 0)
+      return dst;
+
+    // Unused lanes must point to a valid memory.
+    for (int i = length; i < 4; i++)
+      src[i] = src[0];
+
+    return store(accessor, dst);
+  }
+
+  template<typename Accessor>
+  FOG_INLINE uint8_t* store(Accessor& accessor, uint8_t* dst)
+  {
+    __m128i c0;
+
+    accessor.fetchRaw4(c0, src[0], src[1], src[2], src[3]);
+    accessor.normalize4(c0, c0);
+
+    if (hasSolid)
+    {
+      __m128i s0, m0;
+
+      Acc::m128iLoad16u(s0, solid);
+      Acc::m128iLoad16u(m0, mask);
+      Acc::m128iAnd(s0, s0, m0);
+      Acc::m128iAndNot(c0, m0, c0);
+      Acc::m128iOr(c0, c0, s0);
+      hasSolid = 0;
+    }
+
+    int n = length;
+    length = 0;
+
+    if (n == 4)
+    {
+      Acc::m128iStore16u(dst, c0);
+      return dst + 16;
+    }
+    else
+    {
+      return PTextureBase::p4StorePartial(dst, c0, n);
+    }
+  }
+
+  const uint8_t* src[4];
+  uint32_t solid[4];
+  uint32_t mask[4];
+
+  int length;
+  int hasSolid;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureBilinear4]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Four pixels collected by an affine (bilinear) fetcher to be
+//! interpolated at once.
+//!
+//! The coordinates are calculated per pixel exactly like in C, then the four
+//! neighbors of each pixel are stored in @c p00, @c p10, @c p01 and @c p11
+//! together with the weights @c wx and @c wy. If the neighbors are already
+//! normalized (pixels interpolated with the clamp color) the @c norm mask is
+//! set and the accessor's normalize step is skipped for such pixel.
+struct FOG_NO_EXPORT PTextureBilinear4
+{
+  FOG_INLINE PTextureBilinear4() :
+    length(0),
+    hasNorm(0)
+  {
+  }
+
+  //! @brief Add raw neighbors, store the batch if it's full.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* add(Accessor& accessor, uint8_t* dst,
+    uint32_t c00, uint32_t c10, uint32_t c01, uint32_t c11, uint32_t cwx, uint32_t cwy)
+  {
+    int i = length;
+
+    p00[i] = c00;
+    p10[i] = c10;
+    p01[i] = c01;
+    p11[i] = c11;
+    wx[i] = cwx;
+    wy[i] = cwy;
+    norm[i] = 0;
+
+    if (++length < 4)
+      return dst;
+    return store(accessor, dst);
+  }
+
+  //! @brief Add normalized neighbors, store the batch if it's full.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* addNorm(Accessor& accessor, uint8_t* dst,
+    uint32_t c00, uint32_t c10, uint32_t c01, uint32_t c11, uint32_t cwx, uint32_t cwy)
+  {
+    int i = length;
+
+    p00[i] = c00;
+    p10[i] = c10;
+    p01[i] = c01;
+    p11[i] = c11;
+    wx[i] = cwx;
+    wy[i] = cwy;
+    norm[i] = 0xFFFFFFFF;
+    hasNorm = 1;
+
+    if (++length < 4)
+      return dst;
+    return store(accessor, dst);
+  }
+
+  //! @brief Add the normalized pixel @a c0 (interpolated by 256).
+  template<typename Accessor>
+  FOG_INLINE uint8_t* addSolid(Accessor& accessor, uint8_t* dst, uint32_t c0)
+  {
+    return addNorm(accessor, dst, c0, c0, c0, c0, 0, 0);
+  }
+
+  //! @brief Store the remaining pixels.
+  template<typename Accessor>
+  FOG_INLINE uint8_t* flush(Accessor& accessor, uint8_t* dst)
+  {
+    if (length == 0)
+      return dst;
+    return store(accessor, dst);
+  }
+
+  template<typename Accessor>
+  FOG_INLINE uint8_t* store(Accessor& accessor, uint8_t* dst)
+  {
+    __m128i c00, c10, c01, c11;
+    __m128i cwx, cwy;
+
+    Acc::m128iLoad16u(c00, p00);
+    Acc::m128iLoad16u(c10, p10);
+    Acc::m128iLoad16u(c01, p01);
+    Acc::m128iLoad16u(c11, p11);
+    Acc::m128iLoad16u(cwx, wx);
+    Acc::m128iLoad16u(cwy, wy);
+
+    PTextureBase::p4InterpolateBilinear(c00, c00, c10, c01, c11, cwx, cwy);
+    accessor.normalize4(c10, c00);
+
+    if (hasNorm)
+    {
+      __m128i msk;
+
+      Acc::m128iLoad16u(msk, norm);
+      Acc::m128iAnd(c00, c00, msk);
+      Acc::m128iAndNot(c10, msk, c10);
+      Acc::m128iOr(c10, c10, c00);
+      hasNorm = 0;
+    }
+
+    int n = length;
+    length = 0;
+
+    if (n == 4)
+    {
+      Acc::m128iStore16u(dst, c10);
+      return dst + 16;
+    }
+    else
+    {
+      return PTextureBase::p4StorePartial(dst, c10, n);
+    }
+  }
+
+  uint32_t p00[4];
+  uint32_t p10[4];
+  uint32_t p01[4];
+  uint32_t p11[4];
+  uint32_t wx[4];
+  uint32_t wy[4];
+  uint32_t norm[4];
+
+  int length;
+  int hasNorm;
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- PRGB32]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 accessors extend the C accessors by functions working with 4
+//! pixels. The raw pixels have the same layout as in C, so the scalar
+//! functions of the C accessor can be mixed with the SSE2 ones.
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_PRGB32 : public RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_PRGB32(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32(ctx) {}
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* src)
+  {
+    Acc::m128iLoad16u(dst, src);
+  }
+
+  FOG_INLINE void fetchRaw4Rev(__m128i& dst, const uint8_t* src)
+  {
+    Acc::m128iLoad16u(dst, src - 12);
+    Acc::m128iShufflePI32<0, 1, 2, 3>(dst, dst);
+  }
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, const uint8_t* s3)
+  {
+    PTextureBase::p4Pack(dst, ((const uint32_t*)s0)[0], ((const uint32_t*)s1)[0], ((const uint32_t*)s2)[0], ((const uint32_t*)s3)[0]);
+  }
+
+  FOG_INLINE void normalize4(__m128i& dst, const __m128i& src) { dst = src; }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- XRGB32]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_XRGB32 : public RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_XRGB32(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32(ctx) {}
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* src)
+  {
+    Acc::m128iLoad16u(dst, src);
+  }
+
+  FOG_INLINE void fetchRaw4Rev(__m128i& dst, const uint8_t* src)
+  {
+    Acc::m128iLoad16u(dst, src - 12);
+    Acc::m128iShufflePI32<0, 1, 2, 3>(dst, dst);
+  }
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, const uint8_t* s3)
+  {
+    PTextureBase::p4Pack(dst, ((const uint32_t*)s0)[0], ((const uint32_t*)s1)[0], ((const uint32_t*)s2)[0], ((const uint32_t*)s3)[0]);
+  }
+
+  FOG_INLINE void normalize4(__m128i& dst, const __m128i& src)
+  {
+    Acc::m128iOr(dst, src, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- RGB24]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_RGB24 : public RasterOps_C::PTextureAccessor_PRGB32_From_RGB24
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_RGB24(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_RGB24(ctx) {}
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* src)
+  {
+    fetchRaw4(dst, src, src + 3, src + 6, src + 9);
+  }
+
+  FOG_INLINE void fetchRaw4Rev(__m128i& dst, const uint8_t* src)
+  {
+    fetchRaw4(dst, src, src - 3, src - 6, src - 9);
+  }
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, const uint8_t* s3)
+  {
+    uint32_t c0, c1, c2, c3;
+
+    fetchRaw(c0, s0);
+    fetchRaw(c1, s1);
+    fetchRaw(c2, s2);
+    fetchRaw(c3, s3);
+
+    PTextureBase::p4Pack(dst, c0, c1, c2, c3);
+  }
+
+  FOG_INLINE void normalize4(__m128i& dst, const __m128i& src)
+  {
+    Acc::m128iOr(dst, src, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- A8]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_A8 : public RasterOps_C::PTextureAccessor_PRGB32_From_A8
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_A8(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_A8(ctx) {}
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* src)
+  {
+    __m128i zero;
+
+    Acc::m128iZero(zero);
+    Acc::m128iLoad4(dst, src);
+    Acc::m128iUnpackPI16FromPI8Lo(dst, dst, zero);
+    Acc::m128iUnpackPI32FromPI16Lo(dst, dst, zero);
+  }
+
+  FOG_INLINE void fetchRaw4Rev(__m128i& dst, const uint8_t* src)
+  {
+    fetchRaw4(dst, src - 3);
+    Acc::m128iShufflePI32<0, 1, 2, 3>(dst, dst);
+  }
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, const uint8_t* s3)
+  {
+    PTextureBase::p4Pack(dst, s0[0], s1[0], s2[0], s3[0]);
+  }
+
+  FOG_INLINE void normalize4(__m128i& dst, const __m128i& src)
+  {
+    __m128i t0;
+
+    Acc::m128iLShiftPU32<8>(t0, src);
+    Acc::m128iOr(dst, src, t0);
+    Acc::m128iLShiftPU32<16>(t0, dst);
+    Acc::m128iOr(dst, dst, t0);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- I8]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_I8 : public RasterOps_C::PTextureAccessor_PRGB32_From_I8
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_I8(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_I8(ctx) {}
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* src)
+  {
+    PTextureBase::p4Pack(dst, pal[src[0]], pal[src[1]], pal[src[2]], pal[src[3]]);
+  }
+
+  FOG_INLINE void fetchRaw4Rev(__m128i& dst, const uint8_t* src)
+  {
+    PTextureBase::p4Pack(dst, pal[src[0]], pal[src[-1]], pal[src[-2]], pal[src[-3]]);
+  }
+
+  FOG_INLINE void fetchRaw4(__m128i& dst, const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, const uint8_t* s3)
+  {
+    PTextureBase::p4Pack(dst, pal[s0[0]], pal[s1[0]], pal[s2[0]], pal[s3[0]]);
+  }
+
+  FOG_INLINE void normalize4(__m128i& dst, const __m128i& src) { dst = src; }
+};
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREBASE_P_H
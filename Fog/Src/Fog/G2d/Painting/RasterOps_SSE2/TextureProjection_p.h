@@ -0,0 +1,832 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_C/TextureProjection_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/TextureBase_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureProjection]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 version of @c RasterOps_C::PTextureProjection.
+//!
+//! The segments and coordinates are calculated exactly like in C, the fetched
+//! pixels are collected by @c PTextureNearest4 or @c PTextureBilinear4 and
+//! normalized (and interpolated) four at a time.
+struct FOG_NO_EXPORT PTextureProjection
+{
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum { SPAN_STEP = RasterOps_C::PTextureProjection::SPAN_STEP };
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_step(px, dx, u0, u1, i);
+        RasterOps_C::PTextureProjection::_step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = Math::bound<int>(px >> 8, 0, tw);
+          int py0 = Math::bound<int>(py >> 8, 0, th);
+
+          dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Pad]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_step(px, dx, u0, u1, i);
+        RasterOps_C::PTextureProjection::_step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+          {
+            const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+            accessor.fetchRaw(pix_x0y0, srcLine);
+            accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+            srcLine += srcStride;
+            accessor.fetchRaw(pix_x0y1, srcLine);
+            accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+          }
+          else
+          {
+            int px1 = px0 + 1;
+            int py1 = py0 + 1;
+
+            if (px0 < 0) { px0 = px1 = 0; } else if (px0 >= tw) { px0 = px1 = tw; }
+            if (py0 < 0) { py0 = py1 = 0; } else if (py0 >= th) { py0 = py1 = th; }
+
+            const uint8_t* srcLine0 = srcPixels + (uint)py0 * srcStride;
+            const uint8_t* srcLine1 = srcPixels + (uint)py1 * srcStride;
+
+            accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+            accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+          }
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        RasterOps_C::PTextureProjection::_stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Repeat]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        RasterOps_C::PTextureProjection::_stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          int px1 = px0 + 1;
+          int py1 = py0 + 1;
+
+          if (px1 > tw) px1 = 0;
+          if (py1 > th) py1 = 0;
+
+          const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+          const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        RasterOps_C::PTextureProjection::_stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          if (px0 > tw) px0 = tw2 - px0;
+          if (py0 > th) py0 = th2 - py0;
+
+          dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Reflect]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    int tw2 = tw * 2 - 1;
+    int th2 = th * 2 - 1;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx24x8 = ctx->_d.texture.proj.mx24x8;
+    int my24x8 = ctx->_d.texture.proj.my24x8;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_stepRepeat(px, dx, u0, u1, i, mx, mx24x8);
+        RasterOps_C::PTextureProjection::_stepRepeat(py, dy, v0, v1, i, my, my24x8);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          int px1 = px0 + 1;
+          int py1 = py0 + 1;
+
+          // The position is in [0, tw2], wrap the neighbor first, then reflect.
+          if (px1 > tw2) px1 = 0;
+          if (py1 > th2) py1 = 0;
+
+          if (px0 > tw) px0 = tw2 - px0;
+          if (py0 > th) py0 = th2 - py0;
+          if (px1 > tw) px1 = tw2 - px1;
+          if (py1 > th) py1 = th2 - py1;
+
+          const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+          const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          accessor.fetchRaw(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+          accessor.fetchRaw(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+
+          px += dx; if (px >= mx24x8) px -= mx24x8;
+          py += dy; if (py >= my24x8) py -= my24x8;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureNearest4 batch;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_step(px, dx, u0, u1, i);
+        RasterOps_C::PTextureProjection::_step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          if (((uint)px0 <= (uint)tw) & ((uint)py0 <= (uint)th))
+            dst = batch.add(accessor, dst, srcPixels + (ssize_t)py0 * srcStride + px0 * Accessor::SRC_BPP);
+          else
+            dst = batch.addSolid(accessor, dst, clamp);
+
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear) - Clamp]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    PTextureBilinear4 batch;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    tw--;
+    th--;
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      double u0, v0, z0;
+      double u1, v1, z1;
+      RasterOps_C::PTextureProjection::_project(u0, v0, z0, ctx, fetcher, _x);
+
+      do {
+        int i = RasterOps_C::PTextureProjection::_segment(u1, v1, z1, ctx, fetcher, _x, Math::min<int>(w, SPAN_STEP), u0, v0, z0);
+        int px, dx;
+        int py, dy;
+
+        _x += (double)i;
+
+        RasterOps_C::PTextureProjection::_step(px, dx, u0, u1, i);
+        RasterOps_C::PTextureProjection::_step(py, dy, v0, v1, i);
+
+        w -= i;
+
+        do {
+          int px0 = px >> 8;
+          int py0 = py >> 8;
+
+          uint32_t wx = (uint)px & 0xFF;
+          uint32_t wy = (uint)py & 0xFF;
+
+          typename Accessor::Pixel pix_x0y0;
+          typename Accessor::Pixel pix_x1y0;
+          typename Accessor::Pixel pix_x0y1;
+          typename Accessor::Pixel pix_x1y1;
+
+          if (FOG_LIKELY(((uint)px0 < (uint)tw) & ((uint)py0 < (uint)th)))
+          {
+            const uint8_t* srcLine = srcPixels + py0 * srcStride + (uint)px0 * Accessor::SRC_BPP;
+
+            accessor.fetchRaw(pix_x0y0, srcLine);
+            accessor.fetchRaw(pix_x1y0, srcLine + Accessor::SRC_BPP);
+            srcLine += srcStride;
+            accessor.fetchRaw(pix_x0y1, srcLine);
+            accessor.fetchRaw(pix_x1y1, srcLine + Accessor::SRC_BPP);
+
+            dst = batch.add(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+          }
+          else
+          {
+            int px1 = px0 + 1;
+            int py1 = py0 + 1;
+
+            if ((uint)px1 <= (uint)tw+1 && (uint)py1 <= (uint)th+1)
+            {
+              const uint8_t* srcLine0 = srcPixels + py0 * srcStride;
+              const uint8_t* srcLine1 = srcPixels + py1 * srcStride;
+
+              pix_x0y0 = clamp;
+              pix_x1y0 = clamp;
+              pix_x0y1 = clamp;
+              pix_x1y1 = clamp;
+
+              if ((uint)px0 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x0y0, srcLine0 + px0 * Accessor::SRC_BPP);
+              if ((uint)px1 <= (uint)tw && (uint)py0 <= (uint)th) accessor.fetchNorm(pix_x1y0, srcLine0 + px1 * Accessor::SRC_BPP);
+              if ((uint)px0 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x0y1, srcLine1 + px0 * Accessor::SRC_BPP);
+              if ((uint)px1 <= (uint)tw && (uint)py1 <= (uint)th) accessor.fetchNorm(pix_x1y1, srcLine1 + px1 * Accessor::SRC_BPP);
+
+              dst = batch.addNorm(accessor, dst, pix_x0y0, pix_x1y0, pix_x0y1, pix_x1y1, wx, wy);
+            }
+            else
+            {
+              dst = batch.addSolid(accessor, dst, clamp);
+            }
+          }
+
+          px += dx;
+          py += dy;
+        } while (--i);
+
+        u0 = u1;
+        v0 = v1;
+        z0 = z1;
+      } while (w);
+
+      dst = batch.flush(accessor, dst);
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    RasterOps_C::PTextureBase::seek_proj(fetcher, fetcher->_y + fetcher->_delta);
+  }
+};
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
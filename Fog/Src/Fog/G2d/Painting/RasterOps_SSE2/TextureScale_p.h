@@ -0,0 +1,24 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTURESCALE_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTURESCALE_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_SSE2/TextureBase_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2]
+// ============================================================================
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTURESCALE_P_H
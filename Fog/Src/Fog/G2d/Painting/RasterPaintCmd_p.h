@@ -1,736 +1,852 @@
-// [Fog-G2d]
-//
-// [License]
-// MIT, See COPYING file in package
-
-// [Guard]
-#ifndef _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
-#define _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
-
-// [Dependencies]
-#include <Fog/Core/Global/Global.h>
-#include <Fog/Core/Global/Private.h>
-#include <Fog/G2d/Geometry/Point.h>
-#include <Fog/G2d/Geometry/Transform.h>
-#include <Fog/G2d/Imaging/Image.h>
-#include <Fog/G2d/Imaging/ImageFilter.h>
-#include <Fog/G2d/Imaging/ImageFilterScale.h>
-#include <Fog/G2d/Painting/PaintParams.h>
-#include <Fog/G2d/Painting/RasterPaintStructs_p.h>
-#include <Fog/G2d/Painting/RasterStructs_p.h>
-#include <Fog/G2d/Tools/Region.h>
-
-namespace Fog {
-
-//! @addtogroup Fog_G2d_Painting
-//! @{
-
-// ============================================================================
-// [Fog::RasterPaintCmd]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd
-{
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd) { _setCommand(cmd); }
-  FOG_INLINE void destroy(RasterPaintEngine* engine) {}
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint8_t getCommand() const { return _command; }
-  FOG_INLINE void _setCommand(uint8_t command) { _command = command; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  //! @brief Command bytecode.
-  uint32_t _command : 8;
-  //! @brief Command embedded data (24-bits).
-  uint32_t _data24 : 24;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_Next]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_Next : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint8_t* ptr)
-  {
-    Base::init(engine, cmd);
-    _setPtr(ptr);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  { 
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint8_t* getPtr() const { return _ptr; }
-  FOG_INLINE void _setPtr(uint8_t* ptr) { _ptr = ptr; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  uint8_t* _ptr;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetPaintHints]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetPaintHints : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd,
-    const PaintHints& paintHints)
-  {
-    Base::init(engine, cmd);
-    _setPaintHints(paintHints);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const PaintHints& getPaintHints() const { return _paintHints; }
-  FOG_INLINE void _setPaintHints(const PaintHints& paintHints) { _paintHints.packed = paintHints.packed; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  PaintHints _paintHints;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetOpacity]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetOpacity : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity)
-  {
-    Base::init(engine, cmd);
-    _setOpacity(opacity);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint32_t getOpacity() const { return _data24; }
-  FOG_INLINE void _setOpacity(uint32_t opacity) { _data24 = opacity; }
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetOpacityAndPrgb32]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetOpacityAndPrgb32 :
-  public RasterPaintCmd_SetOpacity
-{
-  typedef RasterPaintCmd_SetOpacity Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity, uint32_t prgb32)
-  {
-    Base::init(engine, cmd, opacity);
-    _setPrgb32(prgb32);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint32_t getPrgb32() const { return _prgb32; }
-  FOG_INLINE void _setPrgb32(uint32_t prgb32) { _prgb32 = prgb32; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  uint32_t _prgb32;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetOpacityAndPattern]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetOpacityAndPattern :
-  public RasterPaintCmd_SetOpacity
-{
-  typedef RasterPaintCmd_SetOpacity Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity, RasterPattern* pc)
-  {
-    Base::init(engine, cmd, opacity);
-    
-    FOG_ASSERT(pc != NULL);
-    _pc = pc;
-    _pc->_reference.inc();
-  }
-
-  // Implemented-Later: RasterPaintEngine_p.h
-  FOG_INLINE void destroy(RasterPaintEngine* engine);
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE RasterPattern* getPatternContext() const { return _pc; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  RasterPattern* _pc;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_Fill]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_Fill : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t fillRule)
-  {
-    Base::init(engine, cmd);
-    _setFillRule(fillRule); 
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint32_t getFillRule() const { return _data24; }
-  FOG_INLINE void _setFillRule(uint32_t fillRule) { _data24 = fillRule; }
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_Fill]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillAll : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd)
-  {
-    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_FillNormalizedBoxI]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxI : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& box)
-  {
-    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
-    _box.init(box);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const BoxI& getPath() const { return _box(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxI> _box;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_FillNormalizedBoxF]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxF : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxF& box)
-  {
-    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
-    _box.init(box);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const BoxF& getPath() const { return _box(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxF> _box;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_FillNormalizedBoxD]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxD : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxD& box)
-  {
-    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
-    _box.init(box);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const BoxD& getPath() const { return _box(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxD> _box;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_FillNormalizedPathF]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedPathF : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PathF& path, const PointF& pt, uint32_t fillRule)
-  {
-    Base::init(engine, cmd, fillRule);
-    _path.init(path);
-    _pt.init(pt);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _path.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const PathF& getPath() const { return _path(); }
-  FOG_INLINE const PointF& getPoint() const { return _pt(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<PathF> _path;
-  Static<PointF> _pt;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_FillNormalizedPathD]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedPathD : public RasterPaintCmd_Fill
-{
-  typedef RasterPaintCmd_Fill Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PathD& path, const PointD& pt, uint32_t fillRule)
-  {
-    Base::init(engine, cmd, fillRule);
-    _path.init(path);
-    _pt.init(pt);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _path.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const PathD& getPath() const { return _path(); }
-  FOG_INLINE const PointD& getPoint() const { return _pt(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<PathD> _path;
-  Static<PointD> _pt;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_BlitNormalizedImageA]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageA : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PointI& pt, const Image& srcImage)
-  {
-    Base::init(engine, cmd);
-    _pt.init(pt);
-    _srcImage.initCustom1(srcImage);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _srcImage.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const PointI& getPt() const { return _pt; }
-  FOG_INLINE const Image& getSrcImage() const { return _srcImage; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<PointI> _pt;
-  Static<Image> _srcImage;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_BlitNormalizedImageFragmentA]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageFragmentA : public RasterPaintCmd_BlitNormalizedImageA
-{
-  typedef RasterPaintCmd_BlitNormalizedImageA Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PointI& dstPt, const Image& srcImage, const RectI& srcFragment)
-  {
-    Base::init(engine, cmd, dstPt, srcImage);
-    _srcFragment.init(srcFragment);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment; }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<RectI> _srcFragment;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_BlitNormalizedImageI]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageI : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& box,
-    const Image& srcImage, const RectI& srcFragment, const TransformD& srcTransform, uint32_t imageQuality)
-  {
-    Base::init(engine, cmd);
-    _data24 = imageQuality;
-
-    _box.initCustom1(box);
-    _srcImage.initCustom1(srcImage);
-    _srcFragment.initCustom1(srcFragment);
-    _srcTransform.initCustom1(srcTransform);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _srcImage.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint32_t getImageQuality() const { return _data24; }
-  FOG_INLINE const BoxI& getBox() const { return _box(); }
-  FOG_INLINE const Image& getSrcImage() const { return _srcImage(); }
-  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment(); }
-  FOG_INLINE const TransformD& getSrcTransform() const { return _srcTransform(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxI> _box;
-  Static<Image> _srcImage;
-  Static<RectI> _srcFragment;
-  Static<TransformD> _srcTransform;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_BlitNormalizedImageD]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageD : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-  
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxD& box,
-    const Image& srcImage, const RectI& srcFragment, const TransformD& srcTransform, uint32_t imageQuality)
-  {
-    Base::init(engine, cmd);
-    _data24 = imageQuality;
-
-    _box.initCustom1(box);
-    _srcImage.initCustom1(srcImage);
-    _srcFragment.initCustom1(srcFragment);
-    _srcTransform.initCustom1(srcTransform);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _srcImage.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE uint32_t getImageQuality() const { return _data24; }
-  FOG_INLINE const BoxD& getBox() const { return _box(); }
-  FOG_INLINE const Image& getSrcImage() const { return _srcImage(); }
-  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment(); }
-  FOG_INLINE const TransformD& getSrcTransform() const { return _srcTransform(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxD> _box;
-  Static<Image> _srcImage;
-  Static<RectI> _srcFragment;
-  Static<TransformD> _srcTransform;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetClipBox]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetClipBox : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& clipBox)
-  {
-    Base::init(engine, cmd);
-    _clipBox.init(clipBox);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const BoxI& getClipBox() const { return _clipBox(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<BoxI> _clipBox;
-};
-
-// ============================================================================
-// [Fog::RasterPaintCmd_SetClipRegion]
-// ============================================================================
-
-struct FOG_NO_EXPORT RasterPaintCmd_SetClipRegion : public RasterPaintCmd
-{
-  typedef RasterPaintCmd Base;
-
-  // --------------------------------------------------------------------------
-  // [Init / Destroy]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const Region& clipRegion)
-  {
-    Base::init(engine, cmd);
-    _clipRegion.init(clipRegion);
-  }
-
-  FOG_INLINE void destroy(RasterPaintEngine* engine)
-  {
-    Base::destroy(engine);
-    _clipRegion.destroy();
-  }
-
-  // --------------------------------------------------------------------------
-  // [Accessors]
-  // --------------------------------------------------------------------------
-
-  FOG_INLINE const Region& getClipRegion() const { return _clipRegion(); }
-
-  // --------------------------------------------------------------------------
-  // [Members]
-  // --------------------------------------------------------------------------
-
-  Static<Region> _clipRegion;
-};
-
-//! @}
-
-} // Fog namespace
-
-// [Guard]
-#endif // _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
+#define _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/G2d/Geometry/Point.h>
+#include <Fog/G2d/Geometry/Transform.h>
+#include <Fog/G2d/Imaging/Image.h>
+#include <Fog/G2d/Imaging/ImageFilter.h>
+#include <Fog/G2d/Imaging/ImageFilterScale.h>
+#include <Fog/G2d/Painting/PaintParams.h>
+#include <Fog/G2d/Painting/RasterClipMask_p.h>
+#include <Fog/G2d/Painting/RasterGlyphCache_p.h>
+#include <Fog/G2d/Painting/RasterPaintStructs_p.h>
+#include <Fog/G2d/Painting/RasterStructs_p.h>
+#include <Fog/G2d/Tools/Region.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::RasterPaintCmd]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd
+{
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd) { _setCommand(cmd); }
+  FOG_INLINE void destroy(RasterPaintEngine* engine) {}
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint8_t getCommand() const { return _command; }
+  FOG_INLINE void _setCommand(uint8_t command) { _command = command; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Command bytecode.
+  uint32_t _command : 8;
+  //! @brief Command embedded data (24-bits).
+  uint32_t _data24 : 24;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_Next]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_Next : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint8_t* ptr)
+  {
+    Base::init(engine, cmd);
+    _setPtr(ptr);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  { 
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint8_t* getPtr() const { return _ptr; }
+  FOG_INLINE void _setPtr(uint8_t* ptr) { _ptr = ptr; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  uint8_t* _ptr;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetPaintHints]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetPaintHints : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd,
+    const PaintHints& paintHints)
+  {
+    Base::init(engine, cmd);
+    _setPaintHints(paintHints);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const PaintHints& getPaintHints() const { return _paintHints; }
+  FOG_INLINE void _setPaintHints(const PaintHints& paintHints) { _paintHints.packed = paintHints.packed; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  PaintHints _paintHints;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetOpacity]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetOpacity : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity)
+  {
+    Base::init(engine, cmd);
+    _setOpacity(opacity);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getOpacity() const { return _data24; }
+  FOG_INLINE void _setOpacity(uint32_t opacity) { _data24 = opacity; }
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetOpacityAndPrgb32]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetOpacityAndPrgb32 :
+  public RasterPaintCmd_SetOpacity
+{
+  typedef RasterPaintCmd_SetOpacity Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity, uint32_t prgb32)
+  {
+    Base::init(engine, cmd, opacity);
+    _setPrgb32(prgb32);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getPrgb32() const { return _prgb32; }
+  FOG_INLINE void _setPrgb32(uint32_t prgb32) { _prgb32 = prgb32; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  uint32_t _prgb32;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetOpacityAndPattern]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetOpacityAndPattern :
+  public RasterPaintCmd_SetOpacity
+{
+  typedef RasterPaintCmd_SetOpacity Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t opacity, RasterPattern* pc)
+  {
+    Base::init(engine, cmd, opacity);
+    
+    FOG_ASSERT(pc != NULL);
+    _pc = pc;
+    _pc->_reference.inc();
+  }
+
+  // Implemented-Later: RasterPaintEngine_p.h
+  FOG_INLINE void destroy(RasterPaintEngine* engine);
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RasterPattern* getPatternContext() const { return _pc; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  RasterPattern* _pc;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_Fill]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_Fill : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, uint32_t fillRule)
+  {
+    Base::init(engine, cmd);
+    _setFillRule(fillRule); 
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getFillRule() const { return _data24; }
+  FOG_INLINE void _setFillRule(uint32_t fillRule) { _data24 = fillRule; }
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_Fill]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillAll : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd)
+  {
+    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedBoxI]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxI : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& box)
+  {
+    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
+    _box.init(box);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const BoxI& getPath() const { return _box(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxI> _box;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedBoxF]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxF : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxF& box)
+  {
+    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
+    _box.init(box);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const BoxF& getPath() const { return _box(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxF> _box;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedBoxD]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedBoxD : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxD& box)
+  {
+    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
+    _box.init(box);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const BoxD& getPath() const { return _box(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxD> _box;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedPathF]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedPathF : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PathF& path, const PointF& pt, uint32_t fillRule)
+  {
+    Base::init(engine, cmd, fillRule);
+    _path.init(path);
+    _pt.init(pt);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _path.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const PathF& getPath() const { return _path(); }
+  FOG_INLINE const PointF& getPoint() const { return _pt(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<PathF> _path;
+  Static<PointF> _pt;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_DrawNormalizedHairlineF]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief The hairline is stored the same way as 'FillNormalizedPathF' (the
+//! point and the fill-rule are not used).
+typedef RasterPaintCmd_FillNormalizedPathF RasterPaintCmd_DrawNormalizedHairlineF;
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedPathD]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedPathD : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PathD& path, const PointD& pt, uint32_t fillRule)
+  {
+    Base::init(engine, cmd, fillRule);
+    _path.init(path);
+    _pt.init(pt);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _path.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const PathD& getPath() const { return _path(); }
+  FOG_INLINE const PointD& getPoint() const { return _pt(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<PathD> _path;
+  Static<PointD> _pt;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_FillNormalizedGlyphs]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_FillNormalizedGlyphs : public RasterPaintCmd_Fill
+{
+  typedef RasterPaintCmd_Fill Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the command, glyphs are copied and referenced.
+  //!
+  //! If out of memory the command is still valid, but it doesn't contain any
+  //! glyph.
+  FOG_INLINE err_t init(RasterPaintEngine* engine, uint8_t cmd, const RasterGlyphItem8* items, size_t length, const BoxI& box)
+  {
+    Base::init(engine, cmd, FILL_RULE_NON_ZERO);
+    _box.init(box);
+
+    _items = reinterpret_cast<RasterGlyphItem8*>(MemMgr::alloc(length * sizeof(RasterGlyphItem8)));
+    _length = 0;
+
+    if (FOG_IS_NULL(_items))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    for (size_t i = 0; i < length; i++)
+    {
+      _items[i] = items[i];
+      items[i].glyph->addRef();
+    }
+
+    _length = length;
+    return ERR_OK;
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+
+    if (_items != NULL)
+    {
+      for (size_t i = 0; i < _length; i++)
+        _items[i].glyph->release();
+      MemMgr::free(_items);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const RasterGlyphItem8* getItems() const { return _items; }
+  FOG_INLINE size_t getLength() const { return _length; }
+  FOG_INLINE const BoxI& getBox() const { return _box(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  RasterGlyphItem8* _items;
+  size_t _length;
+  Static<BoxI> _box;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_BlitNormalizedImageA]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageA : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PointI& pt, const Image& srcImage)
+  {
+    Base::init(engine, cmd);
+    _pt.init(pt);
+    _srcImage.initCustom1(srcImage);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _srcImage.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const PointI& getPt() const { return _pt; }
+  FOG_INLINE const Image& getSrcImage() const { return _srcImage; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<PointI> _pt;
+  Static<Image> _srcImage;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_BlitNormalizedImageFragmentA]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageFragmentA : public RasterPaintCmd_BlitNormalizedImageA
+{
+  typedef RasterPaintCmd_BlitNormalizedImageA Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const PointI& dstPt, const Image& srcImage, const RectI& srcFragment)
+  {
+    Base::init(engine, cmd, dstPt, srcImage);
+    _srcFragment.init(srcFragment);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<RectI> _srcFragment;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_BlitNormalizedImageI]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageI : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& box,
+    const Image& srcImage, const RectI& srcFragment, const TransformD& srcTransform, uint32_t imageQuality)
+  {
+    Base::init(engine, cmd);
+    _data24 = imageQuality;
+
+    _box.initCustom1(box);
+    _srcImage.initCustom1(srcImage);
+    _srcFragment.initCustom1(srcFragment);
+    _srcTransform.initCustom1(srcTransform);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _srcImage.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getImageQuality() const { return _data24; }
+  FOG_INLINE const BoxI& getBox() const { return _box(); }
+  FOG_INLINE const Image& getSrcImage() const { return _srcImage(); }
+  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment(); }
+  FOG_INLINE const TransformD& getSrcTransform() const { return _srcTransform(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxI> _box;
+  Static<Image> _srcImage;
+  Static<RectI> _srcFragment;
+  Static<TransformD> _srcTransform;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_BlitNormalizedImageD]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_BlitNormalizedImageD : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+  
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxD& box,
+    const Image& srcImage, const RectI& srcFragment, const TransformD& srcTransform, uint32_t imageQuality)
+  {
+    Base::init(engine, cmd);
+    _data24 = imageQuality;
+
+    _box.initCustom1(box);
+    _srcImage.initCustom1(srcImage);
+    _srcFragment.initCustom1(srcFragment);
+    _srcTransform.initCustom1(srcTransform);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _srcImage.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getImageQuality() const { return _data24; }
+  FOG_INLINE const BoxD& getBox() const { return _box(); }
+  FOG_INLINE const Image& getSrcImage() const { return _srcImage(); }
+  FOG_INLINE const RectI& getSrcFragment() const { return _srcFragment(); }
+  FOG_INLINE const TransformD& getSrcTransform() const { return _srcTransform(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxD> _box;
+  Static<Image> _srcImage;
+  Static<RectI> _srcFragment;
+  Static<TransformD> _srcTransform;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetClipBox]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetClipBox : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const BoxI& clipBox)
+  {
+    Base::init(engine, cmd);
+    _clipBox.init(clipBox);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const BoxI& getClipBox() const { return _clipBox(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<BoxI> _clipBox;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetClipRegion]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetClipRegion : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, const Region& clipRegion)
+  {
+    Base::init(engine, cmd);
+    _clipRegion.init(clipRegion);
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _clipRegion.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const Region& getClipRegion() const { return _clipRegion(); }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  Static<Region> _clipRegion;
+};
+
+// ============================================================================
+// [Fog::RasterPaintCmd_SetClipMask]
+// ============================================================================
+
+struct FOG_NO_EXPORT RasterPaintCmd_SetClipMask : public RasterPaintCmd
+{
+  typedef RasterPaintCmd Base;
+
+  // --------------------------------------------------------------------------
+  // [Init / Destroy]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void init(RasterPaintEngine* engine, uint8_t cmd, RasterClipMask8* clipMask)
+  {
+    Base::init(engine, cmd);
+    _clipMask = clipMask->addRef();
+  }
+
+  FOG_INLINE void destroy(RasterPaintEngine* engine)
+  {
+    Base::destroy(engine);
+    _clipMask->release();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RasterClipMask8* getClipMask() const { return _clipMask; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  RasterClipMask8* _clipMask;
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERPAINTCMD_P_H
@@ -21,9 +21,11 @@ RasterPaintContext::RasterPaintContext() :
   engine(NULL),
   precision(0xFFFFFFFF),
   clipType(RASTER_CLIP_BOX),
-  clipBoxI(0, 0, 0, 0)
+  clipBoxI(0, 0, 0, 0),
+  clipMask(NULL)
 {
   scope.reset();
+  resetBand();
   target.reset();
 
   paintHints.packed = 0;
@@ -41,6 +43,7 @@ RasterPaintContext::RasterPaintContext() :
 
 RasterPaintContext::~RasterPaintContext()
 {
+  resetClipMask();
   _initPrecision(0xFFFFFFFF);
 }
 
@@ -61,6 +64,11 @@ err_t RasterPaintContext::_initByMaster(const RasterPaintContext& master)
   clipRegion = master.clipRegion;
   clipBoxI = master.clipBoxI;
 
+  // The clip-mask is immutable, it's shared with the master context.
+  resetClipMask();
+  if (master.clipMask != NULL)
+    clipMask = master.clipMask->addRef();
+
   paintHints = master.paintHints;
   rasterHints = master.rasterHints;
 
@@ -69,6 +77,10 @@ err_t RasterPaintContext::_initByMaster(const RasterPaintContext& master)
   solid.prgb32 = master.solid.prgb32;
   pc = (RasterPattern*)(size_t)0x1;
 
+#if defined(FOG_BUILD_PROFILER)
+  profile.enabled = master.profile.enabled;
+#endif // FOG_BUILD_PROFILER
+
   return _initPrecision(master.precision);
 }
 
@@ -82,6 +94,7 @@ err_t RasterPaintContext::_initPrecision(uint32_t precision)
       case IMAGE_PRECISION_BYTE:
         boxRasterizer8.destroy();
         pathRasterizer8.destroy();
+        densePathRasterizer8.destroy();
         scanline8.destroy();
         break;
 
@@ -106,6 +119,7 @@ err_t RasterPaintContext::_initPrecision(uint32_t precision)
         fullOpacity.f = float(0x100);
         boxRasterizer8.init();
         pathRasterizer8.init();
+        densePathRasterizer8.init();
         scanline8.init();
         break;
 
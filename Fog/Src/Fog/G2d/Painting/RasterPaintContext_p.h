@@ -18,7 +18,9 @@
 #include <Fog/G2d/Imaging/ImageFilter.h>
 #include <Fog/G2d/Imaging/ImageFilterScale.h>
 #include <Fog/G2d/Painting/PaintParams.h>
+#include <Fog/G2d/Painting/RasterClipMask_p.h>
 #include <Fog/G2d/Painting/RasterPaintStructs_p.h>
+#include <Fog/G2d/Painting/RasterProfile_p.h>
 #include <Fog/G2d/Painting/RasterScanline_p.h>
 #include <Fog/G2d/Painting/RasterStructs_p.h>
 #include <Fog/G2d/Painting/Rasterizer_p.h>
@@ -60,6 +62,52 @@ struct FOG_NO_EXPORT RasterPaintContext
   FOG_INLINE bool isSingleThreaded() const { return scope.isSingleThreaded(); }
   FOG_INLINE bool isMultiThreaded() const { return scope.isMultiThreaded(); }
 
+  // --------------------------------------------------------------------------
+  // [Band]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void setBand(int y0, int y1)
+  {
+    bandY0 = y0;
+    bandY1 = y1;
+  }
+
+  FOG_INLINE void resetBand()
+  {
+    bandY0 = 0;
+    bandY1 = INT_MAX;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Clip-Mask]
+  // --------------------------------------------------------------------------
+
+  //! @brief Set the clip-mask (takes the reference) and switch to
+  //! @c RASTER_CLIP_MASK.
+  FOG_INLINE void setClipMask(RasterClipMask8* mask)
+  {
+    FOG_ASSERT(mask != NULL);
+
+    if (clipMask != NULL)
+      clipMask->release();
+
+    clipType = RASTER_CLIP_MASK;
+    clipMask = mask;
+    clipRegion.clear();
+    clipBoxI = mask->getBoundingBox();
+  }
+
+  //! @brief Release the clip-mask (if any), the clip-type must be changed by
+  //! the caller.
+  FOG_INLINE void resetClipMask()
+  {
+    if (clipMask != NULL)
+    {
+      clipMask->release();
+      clipMask = NULL;
+    }
+  }
+
   // --------------------------------------------------------------------------
   // [Mask]
   // --------------------------------------------------------------------------
@@ -74,6 +122,15 @@ struct FOG_NO_EXPORT RasterPaintContext
   //! @brief Context scope (used by multithreaded paint-engine)
   RasterScope scope;
 
+  //! @brief First scanline of the band rendered by this context (inclusive).
+  //!
+  //! The multithreaded paint-engine splits the target into horizontal bands,
+  //! each worker renders only scanlines in range [bandY0, bandY1). The
+  //! single-threaded context covers the whole target.
+  int bandY0;
+  //! @brief Last scanline of the band rendered by this context (exclusive).
+  int bandY1;
+
   // --------------------------------------------------------------------------
   // [Members - Precision]
   // --------------------------------------------------------------------------
@@ -140,6 +197,12 @@ struct FOG_NO_EXPORT RasterPaintContext
     // Static<PathRasterizer16> pathRasterizer16;
   };
 
+  union
+  {
+    //! @brief The path/polygon dense-accumulation rasterizer (8-bit).
+    Static<DensePathRasterizer8> densePathRasterizer8;
+  };
+
   union
   {
     //! @brief The scanline container (8-bit).
@@ -160,6 +223,8 @@ struct FOG_NO_EXPORT RasterPaintContext
   Region clipRegion;
   //! @brief Clip box (integer).
   BoxI clipBoxI;
+  //! @brief Clip mask (only used by @c RASTER_CLIP_MASK, otherwise @c NULL).
+  RasterClipMask8* clipMask;
 
   // --------------------------------------------------------------------------
   // [Members - Temp]
@@ -174,6 +239,15 @@ struct FOG_NO_EXPORT RasterPaintContext
   //! @brief Temporary path per context, used by calculations (double).
   PathD tmpPathD[3];
 
+#if defined(FOG_BUILD_PROFILER)
+  // --------------------------------------------------------------------------
+  // [Members - Profiler]
+  // --------------------------------------------------------------------------
+
+  //! @brief Render-time profile.
+  RasterProfile profile;
+#endif // FOG_BUILD_PROFILER
+
 private:
   FOG_NO_COPY(RasterPaintContext)
 };
@@ -11,6 +11,7 @@
 // [Dependencies]
 #include <Fog/Core/Acc/AccC.h>
 #include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/Threading/Atomic.h>
@@ -31,10 +32,13 @@
 #include <Fog/G2d/Painting/Painter.h>
 #include <Fog/G2d/Painting/RasterApi_p.h>
 #include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/RasterGlyphCache_p.h>
+#include <Fog/G2d/Painting/RasterLayerPool_p.h>
 #include <Fog/G2d/Painting/RasterPaintCmd_p.h>
 #include <Fog/G2d/Painting/RasterPaintContext_p.h>
 #include <Fog/G2d/Painting/RasterPaintEngine_p.h>
 #include <Fog/G2d/Painting/RasterPaintStructs_p.h>
+#include <Fog/G2d/Painting/RasterPaintWorker_p.h>
 #include <Fog/G2d/Painting/RasterScanline_p.h>
 #include <Fog/G2d/Painting/RasterSpan_p.h>
 #include <Fog/G2d/Painting/RasterUtil_p.h>
@@ -177,6 +181,8 @@ static err_t FOG_CDECL RasterPaintEngine_getMetaParams(const Painter* self, Regi
 static err_t FOG_CDECL RasterPaintEngine_setMetaParams(Painter* self, const Region* region, const PointI* origin)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  FOG_RETURN_ON_ERROR(engine->flushMT());
+
   engine->discardStates(NULL);
   // TODO: Discard also groups.
 
@@ -197,6 +203,8 @@ static err_t FOG_CDECL RasterPaintEngine_setMetaParams(Painter* self, const Regi
 static err_t FOG_CDECL RasterPaintEngine_resetMetaParams(Painter* self)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  FOG_RETURN_ON_ERROR(engine->flushMT());
+
   engine->discardStates(NULL);
   // TODO: Discard also groups.
 
@@ -259,7 +267,7 @@ static err_t FOG_CDECL RasterPaintEngine_getParameter(const Painter* self, uint3
 
     case PAINTER_PARAMETER_MULTITHREADED_I:
     {
-      _PARAM_M(uint32_t) = false;
+      _PARAM_M(uint32_t) = engine->getMode() == RASTER_MODE_MT;
       return ERR_OK;
     }
 
@@ -385,6 +393,12 @@ static err_t FOG_CDECL RasterPaintEngine_getParameter(const Painter* self, uint3
       return ERR_OK;
     }
 
+    case PAINTER_PARAMETER_PATH_RASTERIZER_I:
+    {
+      _PARAM_M(uint32_t) = engine->ctx.paintHints.pathRasterizer;
+      return ERR_OK;
+    }
+
     // ------------------------------------------------------------------------
     // [Paint - Opacity]
     // ------------------------------------------------------------------------
@@ -627,6 +641,40 @@ static err_t FOG_CDECL RasterPaintEngine_getParameter(const Painter* self, uint3
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Profiler]
+    // ------------------------------------------------------------------------
+
+#if defined(FOG_BUILD_PROFILER)
+    case PAINTER_PARAMETER_PROFILER_I:
+    {
+      _PARAM_M(uint32_t) = engine->ctx.profile.enabled;
+      return ERR_OK;
+    }
+
+    case PAINTER_PARAMETER_PROFILE:
+    {
+      // Workers' profiles are merged after the batch is rendered.
+      FOG_RETURN_ON_ERROR(engine->flushMT());
+
+      _PARAM_M(PaintProfile) = engine->ctx.profile.counters;
+      return ERR_OK;
+    }
+
+    case PAINTER_PARAMETER_PROFILE_TRACE:
+    {
+      FOG_RETURN_ON_ERROR(engine->flushMT());
+      return engine->ctx.profile.toTrace(_PARAM_M(StringA));
+    }
+#else
+    case PAINTER_PARAMETER_PROFILER_I:
+    case PAINTER_PARAMETER_PROFILE:
+    case PAINTER_PARAMETER_PROFILE_TRACE:
+    {
+      return ERR_RT_NOT_IMPLEMENTED;
+    }
+#endif // FOG_BUILD_PROFILER
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -667,7 +715,16 @@ static err_t FOG_CDECL RasterPaintEngine_setParameter(Painter* self, uint32_t pa
     {
       uint32_t v = _PARAM_C(uint32_t);
 
-      // TODO:
+      if (v >= 2)
+        return ERR_RT_INVALID_ARGUMENT;
+
+      if (v == (engine->getMode() == RASTER_MODE_MT))
+        return ERR_OK;
+
+      if (v)
+        return engine->startMT();
+
+      engine->stopMT();
       return ERR_OK;
     }
 
@@ -681,7 +738,17 @@ static err_t FOG_CDECL RasterPaintEngine_setParameter(Painter* self, uint32_t pa
       if (v > RASTER_MAX_THREADS_LIMIT)
         v = RASTER_MAX_THREADS_LIMIT;
 
+      if (engine->maxThreads == v)
+        return ERR_OK;
+
       engine->maxThreads = v;
+
+      // Restart the multithreaded mode to use the new count of threads.
+      if (engine->getMode() == RASTER_MODE_MT)
+      {
+        engine->stopMT();
+        return engine->startMT();
+      }
       return ERR_OK;
     }
 
@@ -841,10 +908,13 @@ static err_t FOG_CDECL RasterPaintEngine_setParameter(Painter* self, uint32_t pa
       if (v >= RENDER_QUALITY_COUNT)
         return ERR_RT_INVALID_ARGUMENT;
 
+      if (engine->ctx.paintHints.renderQuality == v)
+        return ERR_OK;
+
+      // The renderQuality hint selects the rasterizer (aliased or analytic),
+      // so it must be passed to group and multi-threaded paint workers.
       engine->ctx.paintHints.renderQuality = v;
-      // We should normally set 'RASTER_PENDING_PAINT_HINTS' flag to masterFlags,
-      // but renderQuality hint is never used by group or multi-threaded paint
-      // workers.
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
       return ERR_OK;
     }
 
@@ -920,6 +990,22 @@ static err_t FOG_CDECL RasterPaintEngine_setParameter(Painter* self, uint32_t pa
       return ERR_OK;
     }
 
+    case PAINTER_PARAMETER_PATH_RASTERIZER_I:
+    {
+      uint32_t v = _PARAM_C(uint32_t);
+      if (v >= PATH_RASTERIZER_COUNT)
+        return ERR_RT_INVALID_ARGUMENT;
+
+      if (engine->ctx.paintHints.pathRasterizer == v)
+        return ERR_OK;
+
+      // The pathRasterizer hint is used by fillNormalizedPath, so it must be
+      // passed to group and multi-threaded paint workers.
+      engine->ctx.paintHints.pathRasterizer = v;
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
+      return ERR_OK;
+    }
+
     // ------------------------------------------------------------------------
     // [Paint Opacity]
     // ------------------------------------------------------------------------
@@ -1475,6 +1561,35 @@ _GlobalOpacityF:
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Profiler]
+    // ------------------------------------------------------------------------
+
+    case PAINTER_PARAMETER_PROFILER_I:
+    {
+#if defined(FOG_BUILD_PROFILER)
+      uint32_t v = _PARAM_C(uint32_t);
+
+      if (v >= 2)
+        return ERR_RT_INVALID_ARGUMENT;
+
+      // Workers take the flag from the master context for each batch.
+      FOG_RETURN_ON_ERROR(engine->flushMT());
+
+      engine->ctx.profile.enabled = v;
+      return ERR_OK;
+#else
+      return ERR_RT_NOT_IMPLEMENTED;
+#endif // FOG_BUILD_PROFILER
+    }
+
+    // The profile and trace are read-only.
+    case PAINTER_PARAMETER_PROFILE:
+    case PAINTER_PARAMETER_PROFILE_TRACE:
+    {
+      return ERR_RT_INVALID_ARGUMENT;
+    }
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -1510,14 +1625,25 @@ static err_t FOG_CDECL RasterPaintEngine_resetParameter(Painter* self, uint32_t
 
     case PAINTER_PARAMETER_MULTITHREADED_I:
     {
-      // TODO: ...
-      return ERR_RT_NOT_IMPLEMENTED;
+      engine->stopMT();
+      return ERR_OK;
     }
 
     case PAINTER_PARAMETER_MAX_THREADS_I:
     {
-      // TODO: ...
-      return ERR_RT_NOT_IMPLEMENTED;
+      uint v = RasterPaintEngine::detectMaxThreads();
+
+      if (engine->maxThreads == v)
+        return ERR_OK;
+
+      engine->maxThreads = v;
+
+      if (engine->getMode() == RASTER_MODE_MT)
+      {
+        engine->stopMT();
+        return engine->startMT();
+      }
+      return ERR_OK;
     }
 
     // ------------------------------------------------------------------------
@@ -1557,16 +1683,30 @@ static err_t FOG_CDECL RasterPaintEngine_resetParameter(Painter* self, uint32_t
       return ERR_OK;
     }
 
-    // 'renderQuality', 'gradientQuality', 'outlinedText', 'fastLine',
-    // 'geomatricPrecision' hints are never used by group or multi-threaded
-    // paint workers, se it's not needed to set RASTER_PENDING_PAINT_HINTS
-    // flag in engine->masterFlags.
     case PAINTER_PARAMETER_RENDER_QUALITY_I:
     {
+      if (engine->ctx.paintHints.renderQuality == RENDER_QUALITY_DEFAULT)
+        return ERR_OK;
       engine->ctx.paintHints.renderQuality = RENDER_QUALITY_DEFAULT;
+
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
+      return ERR_OK;
+    }
+
+    case PAINTER_PARAMETER_PATH_RASTERIZER_I:
+    {
+      if (engine->ctx.paintHints.pathRasterizer == PATH_RASTERIZER_DEFAULT)
+        return ERR_OK;
+      engine->ctx.paintHints.pathRasterizer = PATH_RASTERIZER_DEFAULT;
+
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
       return ERR_OK;
     }
 
+    // 'gradientQuality', 'outlinedText', 'fastLine', 'geomatricPrecision'
+    // hints are never used by group or multi-threaded paint workers, se it's
+    // not needed to set RASTER_PENDING_PAINT_HINTS flag in engine->masterFlags.
+
     case PAINTER_PARAMETER_IMAGE_QUALITY_I:
     {
       engine->ctx.paintHints.imageQuality = IMAGE_QUALITY_DEFAULT;
@@ -1812,6 +1952,28 @@ static err_t FOG_CDECL RasterPaintEngine_resetParameter(Painter* self, uint32_t
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Profiler]
+    // ------------------------------------------------------------------------
+
+    case PAINTER_PARAMETER_PROFILER_I:
+    case PAINTER_PARAMETER_PROFILE:
+    case PAINTER_PARAMETER_PROFILE_TRACE:
+    {
+#if defined(FOG_BUILD_PROFILER)
+      // Don't merge workers' profiles of the current batch after reset.
+      FOG_RETURN_ON_ERROR(engine->flushMT());
+
+      if (parameterId == PAINTER_PARAMETER_PROFILER_I)
+        engine->ctx.profile.enabled = 0;
+
+      engine->ctx.profile.reset();
+      return ERR_OK;
+#else
+      return ERR_RT_NOT_IMPLEMENTED;
+#endif // FOG_BUILD_PROFILER
+    }
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -2327,8 +2489,20 @@ static err_t FOG_CDECL RasterPaintEngine_restore(Painter* self)
   // [Previous]
   // --------------------------------------------------------------------------
 
+  // The restored states must be serialized again by group and multithreaded
+  // recorders, so keep the pending flags set before and add these which are
+  // related to the states being restored.
+  uint32_t pendingFlags = (engine->masterFlags & RASTER_PENDING_ALL_FLAGS) |
+    RASTER_PENDING_OPACITY |
+    RASTER_PENDING_PAINT_HINTS;
+
+  if (restoreFlags & RASTER_STATE_SOURCE   ) pendingFlags |= RASTER_PENDING_SOURCE;
+  if (restoreFlags & RASTER_STATE_STROKE   ) pendingFlags |= RASTER_PENDING_STROKE_PARAMS;
+  if (restoreFlags & RASTER_STATE_TRANSFORM) pendingFlags |= RASTER_PENDING_TRANSFORM;
+  if (restoreFlags & RASTER_STATE_CLIPPING ) pendingFlags |= RASTER_PENDING_CLIP;
+
   engine->state = state->prevState;
-  engine->masterFlags = state->prevMasterFlags;
+  engine->masterFlags = (state->prevMasterFlags & ~RASTER_PENDING_ALL_FLAGS) | pendingFlags;
   engine->savedStateFlags = state->savedStateFlags;
 
   // --------------------------------------------------------------------------
@@ -2476,9 +2650,7 @@ _RestoreSourceContinue:
     {
       case RASTER_CLIP_BOX:
         if (engine->ctx.clipType == RASTER_CLIP_MASK)
-        {
-          // TODO: RasterPaintEngine - clip-mask.
-        }
+          engine->ctx.resetClipMask();
 
         engine->ctx.clipType = state->clipType;
         engine->ctx.clipBoxI = state->clipBoxI;
@@ -2491,9 +2663,7 @@ _RestoreSourceContinue:
 
       case RASTER_CLIP_REGION:
         if (engine->ctx.clipType == RASTER_CLIP_MASK)
-        {
-          // TODO: RasterPaintEngine - clip-mask.
-        }
+          engine->ctx.resetClipMask();
 
         engine->ctx.clipType = state->clipType;
         engine->ctx.clipBoxI = state->clipBoxI;
@@ -2506,7 +2676,11 @@ _RestoreSourceContinue:
         break;
 
       case RASTER_CLIP_MASK:
-        // TODO: RasterPaintEngine - clip-mask.
+        // The reference is moved from the state to the context.
+        engine->ctx.setClipMask(state->clipMask);
+        engine->ctx.clipBoxI = state->clipBoxI;
+        engine->stroker.f().setClipBox(state->clipBoxF);
+        engine->stroker.d().setClipBox(state->clipBoxD);
         break;
 
       default:
@@ -2604,7 +2778,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_drawRawPathF(
   PathF& tmp = engine->ctx.tmpPathF[0];
 
   tmp.clear();
-  FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
+  FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker.strokePath(tmp, *path))));
 
   return engine->doCmd->fillNormalizedPathF(engine, &tmp, &engine->dummyPointF, FILL_RULE_NON_ZERO);
 }
@@ -2623,11 +2797,108 @@ static err_t FOG_FASTCALL RasterPaintEngine_drawRawPathD(
   PathD& tmp = engine->ctx.tmpPathD[0];
 
   tmp.clear();
-  FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
+  FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker.strokePath(tmp, *path))));
 
   return engine->doCmd->fillNormalizedPathD(engine, &tmp, &engine->dummyPointD, FILL_RULE_NON_ZERO);
 }
 
+// ============================================================================
+// [Fog::RasterPaintEngine - Draw - Hairline]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get whether the stroke can be rendered as hairline.
+//!
+//! The hairline is used only if the @c fastLine hint is set, the stroke is
+//! not dashed and the line-width transformed to the device space is not
+//! larger than one pixel. Caps and joins are ignored (ideal line).
+static bool RasterPaintEngine_isHairline(RasterPaintEngine* engine)
+{
+  if (!engine->ctx.paintHints.fastLine)
+    return false;
+
+  const TransformD& tr = engine->getFinalTransformD();
+  if (tr.getType() >= TRANSFORM_TYPE_PROJECTION)
+    return false;
+
+  double lineWidth;
+
+  if (engine->strokerPrecision == RASTER_PRECISION_F)
+  {
+    const PathStrokerParamsF& params = engine->stroker.f->_params();
+    if (!params.getDashList().isEmpty())
+      return false;
+    lineWidth = params.getLineWidth();
+  }
+  else
+  {
+    const PathStrokerParamsD& params = engine->stroker.d->_params();
+    if (!params.getDashList().isEmpty())
+      return false;
+    lineWidth = params.getLineWidth();
+  }
+
+  // The largest scale of the transform is the largest singular value of its
+  // 2x2 matrix.
+  double s = tr._00 * tr._00 + tr._01 * tr._01 + tr._10 * tr._10 + tr._11 * tr._11;
+  double det = tr._00 * tr._11 - tr._01 * tr._10;
+  double scale2 = 0.5 * (s + Math::sqrt(Math::max(s * s - 4.0 * det * det, 0.0)));
+
+  return lineWidth * lineWidth * scale2 <= 1.0 + 1e-6;
+}
+
+static FOG_INLINE bool RasterPaintEngine_isHairlineShape(uint32_t shapeType)
+{
+  return shapeType == SHAPE_TYPE_LINE     ||
+         shapeType == SHAPE_TYPE_RECT     ||
+         shapeType == SHAPE_TYPE_POLYLINE ;
+}
+
+static err_t FOG_FASTCALL RasterPaintEngine_drawHairlineF(
+  RasterPaintEngine* engine, const PathF* path)
+{
+  if (!engine->ensureFinalTransformF())
+    return engine->doCmd->drawNormalizedHairlineF(engine, path);
+
+  PathF& tmp = engine->ctx.tmpPathF[0];
+  FOG_RETURN_ON_ERROR(engine->getFinalTransformF().mapPath(tmp, *path));
+
+  return engine->doCmd->drawNormalizedHairlineF(engine, &tmp);
+}
+
+static err_t FOG_FASTCALL RasterPaintEngine_drawHairlineD(
+  RasterPaintEngine* engine, const PathD* path)
+{
+  const TransformD& tr = engine->getFinalTransformD();
+
+  if (tr.getType() != TRANSFORM_TYPE_IDENTITY)
+  {
+    PathD& tmpD = engine->ctx.tmpPathD[0];
+    FOG_RETURN_ON_ERROR(tr.mapPath(tmpD, *path));
+    path = &tmpD;
+  }
+
+  // The hairline rasterizer works in single precision, the path is converted
+  // after it has been transformed to the device space.
+  PathF& tmp = engine->ctx.tmpPathF[0];
+  size_t length = path->getLength();
+
+  tmp.clear();
+  if (tmp._add(length) == INVALID_INDEX)
+    return ERR_RT_OUT_OF_MEMORY;
+
+  MemOps::copy(tmp.getCommandsX(), path->getCommands(), length);
+
+  PointF* dstPts = tmp.getVerticesX();
+  const PointD* srcPts = path->getVertices();
+
+  for (size_t i = 0; i < length; i++)
+    dstPts[i].set((float)srcPts[i].x, (float)srcPts[i].y);
+
+  return engine->doCmd->drawNormalizedHairlineF(engine, &tmp);
+}
+
 // ============================================================================
 // [Fog::RasterPaintEngine - Draw - Rect]
 // ============================================================================
@@ -2657,7 +2928,11 @@ static err_t FOG_CDECL RasterPaintEngine_drawRectF(Painter* self, const RectF* r
   PathF* path = &engine->ctx.tmpPathF[2];
   path->clear();
   path->rect(*r);
-  return RasterPaintEngine_drawRawPathF(engine, path);
+
+  if (RasterPaintEngine_isHairline(engine))
+    return RasterPaintEngine_drawHairlineF(engine, path);
+  else
+    return RasterPaintEngine_drawRawPathF(engine, path);
 }
 
 static err_t FOG_CDECL RasterPaintEngine_drawRectD(Painter* self, const RectD* r)
@@ -2668,7 +2943,11 @@ static err_t FOG_CDECL RasterPaintEngine_drawRectD(Painter* self, const RectD* r
   PathD* path = &engine->ctx.tmpPathD[2];
   path->clear();
   path->rect(*r);
-  return RasterPaintEngine_drawRawPathD(engine, path);
+
+  if (RasterPaintEngine_isHairline(engine))
+    return RasterPaintEngine_drawHairlineD(engine, path);
+  else
+    return RasterPaintEngine_drawRawPathD(engine, path);
 }
 
 // ============================================================================
@@ -2685,14 +2964,22 @@ static err_t FOG_CDECL RasterPaintEngine_drawPolylineI(Painter* self, const Poin
     PathF* path = &engine->ctx.tmpPathF[2];
     path->clear();
     path->polyline(p, count);
-    return RasterPaintEngine_drawRawPathF(engine, path);
+
+    if (RasterPaintEngine_isHairline(engine))
+      return RasterPaintEngine_drawHairlineF(engine, path);
+    else
+      return RasterPaintEngine_drawRawPathF(engine, path);
   }
   else
   {
     PathD* path = &engine->ctx.tmpPathD[2];
     path->clear();
     path->polyline(p, count);
-    return RasterPaintEngine_drawRawPathD(engine, path);
+
+    if (RasterPaintEngine_isHairline(engine))
+      return RasterPaintEngine_drawHairlineD(engine, path);
+    else
+      return RasterPaintEngine_drawRawPathD(engine, path);
   }
 }
 
@@ -2748,7 +3035,11 @@ static err_t FOG_CDECL RasterPaintEngine_drawShapeF(Painter* self, uint32_t shap
       PathF* path = &engine->ctx.tmpPathF[2];
       path->clear();
       path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
-      return RasterPaintEngine_drawRawPathF(engine, path);
+
+      if (RasterPaintEngine_isHairlineShape(shapeType) && RasterPaintEngine_isHairline(engine))
+        return RasterPaintEngine_drawHairlineF(engine, path);
+      else
+        return RasterPaintEngine_drawRawPathF(engine, path);
     }
   }
 }
@@ -2776,7 +3067,11 @@ static err_t FOG_CDECL RasterPaintEngine_drawShapeD(Painter* self, uint32_t shap
       PathD* path = &engine->ctx.tmpPathD[2];
       path->clear();
       path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
-      return RasterPaintEngine_drawRawPathD(engine, path);
+
+      if (RasterPaintEngine_isHairlineShape(shapeType) && RasterPaintEngine_isHairline(engine))
+        return RasterPaintEngine_drawHairlineD(engine, path);
+      else
+        return RasterPaintEngine_drawRawPathD(engine, path);
     }
   }
 }
@@ -2823,7 +3118,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_fillRawPathF(
           return engine->doCmd->fillNormalizedPathF(engine, path, &pt, fillRule);
         case PATH_CLIPPER_MEASURE_UNBOUNDED:
           tmp->clear();
-          FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
           return engine->doCmd->fillNormalizedPathF(engine, tmp, &pt, fillRule);
         default:
           return ERR_GEOMETRY_INVALID;
@@ -2831,7 +3126,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_fillRawPathF(
 
     default:
       tmp->clear();
-      FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, transform));
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
       return engine->doCmd->fillNormalizedPathF(engine, tmp, &pt, fillRule);
   }
 }
@@ -2860,7 +3155,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_fillRawPathD(
           return engine->doCmd->fillNormalizedPathD(engine, path, &pt, fillRule);
         case PATH_CLIPPER_MEASURE_UNBOUNDED:
           tmp->clear();
-          FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
           return engine->doCmd->fillNormalizedPathD(engine, tmp, &pt, fillRule);
         default:
           return ERR_GEOMETRY_INVALID;
@@ -2868,7 +3163,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_fillRawPathD(
     
     default:
       tmp->clear();
-      FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, transform));
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
       return engine->doCmd->fillNormalizedPathD(engine, tmp, &pt, fillRule);
   }
 }
@@ -3084,17 +3379,81 @@ _Default:
 // [Fog::RasterPaintEngine - Fill - GlyphRun]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Get whether the glyph-run can be rendered using the glyph cache.
+//!
+//! Cached glyphs are rasterized without any transformation, so they can be
+//! only used if the final transform is identity or integral translation.
+static FOG_INLINE bool RasterPaintEngine_canUseGlyphCache(RasterPaintEngine* engine, const Font* font)
+{
+  if (engine->ctx.precision != IMAGE_PRECISION_BYTE)
+    return false;
+
+  const TransformD& tr = engine->getFinalTransformD();
+  uint32_t trType = tr._getType();
+
+  if (trType > TRANSFORM_TYPE_TRANSLATION)
+    return false;
+
+  if (trType == TRANSFORM_TYPE_TRANSLATION &&
+      (tr._20 != Math::floor(tr._20) || tr._21 != Math::floor(tr._21)))
+    return false;
+
+  const FontData* fd = font->_d;
+  return fd->matrix.isIdentity() && fd->metrics.getSize() <= float(RASTER_GLYPH_MAX_SIZE);
+}
+
+//! @internal
+//!
+//! @brief Fill the glyph-run using the glyph cache.
+static err_t RasterPaintEngine_fillGlyphRunCached(RasterPaintEngine* engine, const PointD& p, const GlyphRun* glyphRun, const Font* font)
+{
+  size_t length = glyphRun->getLength();
+  if (length == 0)
+    return ERR_OK;
+
+  MemBufferTmp<sizeof(RasterGlyphItem8) * 128> buffer;
+  RasterGlyphItem8* items = reinterpret_cast<RasterGlyphItem8*>(buffer.alloc(length * sizeof(RasterGlyphItem8)));
+
+  if (FOG_IS_NULL(items))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  const TransformD& tr = engine->getFinalTransformD();
+  PointD pt(p.x + tr._20, p.y + tr._21);
+
+  size_t count;
+  BoxI box(UNINITIALIZED);
+
+  FOG_RETURN_ON_ERROR(RasterGlyphCache_oInstance->getGlyphs(items, &count, &box,
+    *font, pt, *glyphRun,
+    &engine->ctx.pathRasterizer8, &engine->ctx.scanline8, &engine->ctx.tmpPathF[0]));
+
+  err_t err = ERR_OK;
+  if (count != 0 && BoxI::intersect(box, box, engine->ctx.clipBoxI))
+    err = engine->doCmd->fillNormalizedGlyphs(engine, items, count, &box);
+
+  // Recorded commands hold their own references.
+  for (size_t i = 0; i < count; i++)
+    items[i].glyph->release();
+
+  return err;
+}
+
 static err_t FOG_CDECL RasterPaintEngine_fillGlyphRunI(Painter* self, const PointI* p, const GlyphRun* glyphRun, const Font* font, const RectI* clip)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   _FOG_RASTER_ENTER_FILL_FUNC();
 
+  // TODO: Clip.
+  if (RasterPaintEngine_canUseGlyphCache(engine, font))
+    return RasterPaintEngine_fillGlyphRunCached(engine, PointD(*p), glyphRun, font);
+
   PointF pf(*p);
 
   PathF* path = &engine->ctx.tmpPathF[0];
   font->getOutlineFromGlyphRun(*path, CONTAINER_OP_REPLACE, pf, *glyphRun);
 
-  // TODO: Clip.
   return RasterPaintEngine_fillRawPathF(engine, path, FILL_RULE_NON_ZERO);
 }
 
@@ -3103,10 +3462,13 @@ static err_t FOG_CDECL RasterPaintEngine_fillGlyphRunF(Painter* self, const Poin
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   _FOG_RASTER_ENTER_FILL_FUNC();
 
+  // TODO: Clip.
+  if (RasterPaintEngine_canUseGlyphCache(engine, font))
+    return RasterPaintEngine_fillGlyphRunCached(engine, PointD(*p), glyphRun, font);
+
   PathF* path = &engine->ctx.tmpPathF[0];
   font->getOutlineFromGlyphRun(*path, CONTAINER_OP_REPLACE, *p, *glyphRun);
 
-  // TODO: Clip.
   return RasterPaintEngine_fillRawPathF(engine, path, FILL_RULE_NON_ZERO);
 }
 
@@ -3115,10 +3477,13 @@ static err_t FOG_CDECL RasterPaintEngine_fillGlyphRunD(Painter* self, const Poin
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   _FOG_RASTER_ENTER_FILL_FUNC();
 
+  // TODO: Clip.
+  if (RasterPaintEngine_canUseGlyphCache(engine, font))
+    return RasterPaintEngine_fillGlyphRunCached(engine, *p, glyphRun, font);
+
   PathD* path = &engine->ctx.tmpPathD[0];
   font->getOutlineFromGlyphRun(*path, CONTAINER_OP_REPLACE, *p, *glyphRun);
 
-  // TODO: Clip.
   return RasterPaintEngine_fillRawPathD(engine, path, FILL_RULE_NON_ZERO);
 }
 
@@ -3804,7 +4169,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterRawPathF(
           return engine->doCmd->filterNormalizedPathF(engine, feBase, path, &pt, fillRule);
         case PATH_CLIPPER_MEASURE_UNBOUNDED:
           tmp->clear();
-          FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
           return engine->doCmd->filterNormalizedPathF(engine, feBase, tmp, &pt, fillRule);
         default:
           return ERR_GEOMETRY_INVALID;
@@ -3812,7 +4177,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterRawPathF(
     
     default:
       tmp->clear();
-      FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, transform));
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
       return engine->doCmd->filterNormalizedPathF(engine, feBase, tmp, &pt, fillRule);
   }
 }
@@ -3841,7 +4206,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterRawPathD(
           return engine->doCmd->filterNormalizedPathD(engine, feBase, path, &pt, fillRule);
         case PATH_CLIPPER_MEASURE_UNBOUNDED:
           tmp->clear();
-          FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
           return engine->doCmd->filterNormalizedPathD(engine, feBase, tmp, &pt, fillRule);
         default:
           return ERR_GEOMETRY_INVALID;
@@ -3849,7 +4214,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterRawPathD(
     
     default:
       tmp->clear();
-      FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, transform));
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
       return engine->doCmd->filterNormalizedPathD(engine, feBase, tmp, &pt, fillRule);
   }
 }
@@ -4085,7 +4450,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedRawPathF(
   PathF& tmp = engine->ctx.tmpPathF[0];
 
   tmp.clear();
-  FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
+  FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker.strokePath(tmp, *path))));
 
   return engine->doCmd->filterNormalizedPathF(engine, feBase, &tmp, &engine->dummyPointF, FILL_RULE_NON_ZERO);
 }
@@ -4104,7 +4469,7 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedRawPathD(
   PathD& tmp = engine->ctx.tmpPathD[0];
 
   tmp.clear();
-  FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
+  FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker.strokePath(tmp, *path))));
 
   return engine->doCmd->filterNormalizedPathD(engine, feBase, &tmp, &engine->dummyPointD, FILL_RULE_NON_ZERO);
 }
@@ -4168,8 +4533,10 @@ static err_t FOG_FASTCALL RasterPaintEngine_clipAll(
   if ((engine->savedStateFlags & RASTER_STATE_CLIPPING) == 0)
     engine->saveClipping();
 
+  engine->ctx.clipType = RASTER_CLIP_BOX;
   engine->ctx.clipBoxI.reset();
   engine->ctx.clipRegion.clear();
+  engine->ctx.resetClipMask();
   engine->stroker.f->_clipBox.reset();
   engine->stroker.d->_clipBox.reset();
   engine->masterFlags |= RASTER_NO_PAINT_USER_CLIP | RASTER_PENDING_CLIP;
@@ -4178,53 +4545,144 @@ static err_t FOG_FASTCALL RasterPaintEngine_clipAll(
 }
 
 // ============================================================================
-// [Fog::RasterPaintEngine - ClipNormalizedBox]
+// [Fog::RasterPaintEngine - ClipRasterizedShape]
 // ============================================================================
 
-static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBoxI(
-  RasterPaintEngine* engine, uint32_t clipOp, const BoxI* box)
+static void FOG_FASTCALL RasterPaintEngine_prepareClipRasterizer(
+  RasterPaintEngine* engine, uint32_t clipOp, Rasterizer8* rasterizer)
 {
-  FOG_ASSERT(box->isValid());
+  rasterizer->setOpacity(0x100);
 
-  if ((engine->savedStateFlags & RASTER_STATE_CLIPPING) == 0)
-    engine->saveClipping();
+  if (clipOp == CLIP_OP_REPLACE)
+  {
+    rasterizer->setSceneBox(engine->metaClipBoxI);
 
-  Region* newRegion;
-  size_t newLength;
+    if (engine->metaRegion.getLength() > 1)
+      rasterizer->setClipRegion(engine->metaRegion.getData(), engine->metaRegion.getLength());
+    return;
+  }
 
-  switch (clipOp)
+  rasterizer->setSceneBox(engine->ctx.clipBoxI);
+
+  switch (engine->ctx.clipType)
   {
-    case CLIP_OP_REPLACE:
-      switch (engine->ctx.clipType)
-      {
-        case RASTER_CLIP_BOX:
-          // RasterPaintEngine always clips only to clip-box, if there is a
-          // meta-region then we have to clip manually.
-_ReplaceTryMeta:
-          if (engine->metaRegion.getLength() > 1)
-          {
-            newRegion = engine->getTemporaryRegion();
-            FOG_RETURN_ON_ERROR(Region::intersect(*newRegion, engine->metaRegion, *box));
+    case RASTER_CLIP_BOX:
+      break;
 
-            newLength = newRegion->getLength();
-            box = &newRegion->_d->boundingBox;
+    case RASTER_CLIP_REGION:
+      rasterizer->setClipRegion(engine->ctx.clipRegion.getData(), engine->ctx.clipRegion.getLength());
+      break;
 
-            if (newLength == 0)
-              return RasterPaintEngine_clipAll(engine);
+    case RASTER_CLIP_MASK:
+    {
+      const RasterClipMask8* mask = engine->ctx.clipMask;
+      rasterizer->setClipMask(mask->getBoundingBox().y0, mask->getBoundingBox().y1, mask->getRows());
+      break;
+    }
 
-            if (newLength > 1)
-              goto _ReplaceClipRegion;
-          }
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+}
 
-_ReplaceClipBox:
-          engine->ctx.clipType = RASTER_CLIP_BOX;
-          engine->ctx.clipBoxI = *box;
-          engine->stroker.f->_clipBox.setBox(*box);
-          engine->stroker.d->_clipBox.setBox(*box);
+//! @internal
+//!
+//! @brief Render the shape stored in @a rasterizer (prepared by
+//! @c RasterPaintEngine_prepareClipRasterizer()) into a new clip-mask and use
+//! it as a current clip.
+//!
+//! The rasterizer already intersects the shape with the current clip (or with
+//! the meta clip in case of @c CLIP_OP_REPLACE), so the result can be simply
+//! stored in the context. If the result is a fully opaque rectangle then
+//! @c RASTER_CLIP_BOX is used instead.
+static err_t FOG_FASTCALL RasterPaintEngine_clipRasterizedShape8(
+  RasterPaintEngine* engine, Rasterizer8* rasterizer)
+{
+  RasterClipMaskBuilder8 builder;
+  FOG_RETURN_ON_ERROR(builder.init(rasterizer->getSceneBox()));
 
-          engine->masterFlags &= ~RASTER_NO_PAINT_USER_CLIP;
-          engine->masterFlags |= RASTER_PENDING_CLIP;
-          return ERR_OK;
+  rasterizer->render(&builder, &engine->ctx.scanline8);
+
+  RasterClipMask8* mask;
+  FOG_RETURN_ON_ERROR(builder.finalize(&mask));
+
+  if (mask == NULL)
+    return RasterPaintEngine_clipAll(engine);
+
+  if ((engine->savedStateFlags & RASTER_STATE_CLIPPING) == 0)
+    engine->saveClipping();
+
+  if (builder.isBox())
+  {
+    mask->release();
+
+    engine->ctx.clipType = RASTER_CLIP_BOX;
+    engine->ctx.clipBoxI = builder.getBoundingBox();
+    engine->ctx.clipRegion.clear();
+    engine->ctx.resetClipMask();
+  }
+  else
+  {
+    engine->ctx.clipRegion.clear();
+    engine->ctx.setClipMask(mask);
+  }
+
+  engine->stroker.f->_clipBox.setBox(engine->ctx.clipBoxI);
+  engine->stroker.d->_clipBox.setBox(engine->ctx.clipBoxI);
+
+  engine->masterFlags &= ~RASTER_NO_PAINT_USER_CLIP;
+  engine->masterFlags |= RASTER_PENDING_CLIP;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RasterPaintEngine - ClipNormalizedBox]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBoxI(
+  RasterPaintEngine* engine, uint32_t clipOp, const BoxI* box)
+{
+  FOG_ASSERT(box->isValid());
+
+  if ((engine->savedStateFlags & RASTER_STATE_CLIPPING) == 0)
+    engine->saveClipping();
+
+  Region* newRegion;
+  size_t newLength;
+
+  switch (clipOp)
+  {
+    case CLIP_OP_REPLACE:
+      switch (engine->ctx.clipType)
+      {
+        case RASTER_CLIP_BOX:
+          // RasterPaintEngine always clips only to clip-box, if there is a
+          // meta-region then we have to clip manually.
+_ReplaceTryMeta:
+          if (engine->metaRegion.getLength() > 1)
+          {
+            newRegion = engine->getTemporaryRegion();
+            FOG_RETURN_ON_ERROR(Region::intersect(*newRegion, engine->metaRegion, *box));
+
+            newLength = newRegion->getLength();
+            box = &newRegion->_d->boundingBox;
+
+            if (newLength == 0)
+              return RasterPaintEngine_clipAll(engine);
+
+            if (newLength > 1)
+              goto _ReplaceClipRegion;
+          }
+
+_ReplaceClipBox:
+          engine->ctx.clipType = RASTER_CLIP_BOX;
+          engine->ctx.clipBoxI = *box;
+          engine->stroker.f->_clipBox.setBox(*box);
+          engine->stroker.d->_clipBox.setBox(*box);
+
+          engine->masterFlags &= ~RASTER_NO_PAINT_USER_CLIP;
+          engine->masterFlags |= RASTER_PENDING_CLIP;
+          return ERR_OK;
 
         case RASTER_CLIP_REGION:
           // Not used anymore.
@@ -4232,7 +4690,8 @@ _ReplaceClipBox:
           goto _ReplaceTryMeta;
 
         case RASTER_CLIP_MASK:
-          // TODO: RasterPaintEngine - clip-mask.
+          // Not used anymore.
+          engine->ctx.resetClipMask();
           goto _ReplaceTryMeta;
 
         default:
@@ -4286,8 +4745,15 @@ _ReplaceClipRegion:
           return ERR_OK;
 
         case RASTER_CLIP_MASK:
-          // TODO: RasterPaintEngine - clip-mask.
-          break;
+        {
+          // The box is intersected with the current clip-mask by the
+          // rasterizer, the result is a new clip-mask.
+          BoxRasterizer8* rasterizer = &engine->ctx.boxRasterizer8;
+          RasterPaintEngine_prepareClipRasterizer(engine, clipOp, rasterizer);
+
+          rasterizer->init32x0(*box);
+          return RasterPaintEngine_clipRasterizedShape8(engine, rasterizer);
+        }
 
         default:
           FOG_ASSERT_NOT_REACHED();
@@ -4301,18 +4767,142 @@ _ReplaceClipRegion:
   return ERR_RT_INVALID_STATE;
 }
 
+static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBox24x8(
+  RasterPaintEngine* engine, uint32_t clipOp, const BoxI* box24x8)
+{
+  if (RasterUtil::isBox24x8Aligned(*box24x8))
+  {
+    BoxI boxI(box24x8->x0 >> 8, box24x8->y0 >> 8, box24x8->x1 >> 8, box24x8->y1 >> 8);
+    if (!boxI.isValid())
+      return RasterPaintEngine_clipAll(engine);
+    return RasterPaintEngine_clipNormalizedBoxI(engine, clipOp, &boxI);
+  }
+
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      BoxRasterizer8* rasterizer = &engine->ctx.boxRasterizer8;
+      RasterPaintEngine_prepareClipRasterizer(engine, clipOp, rasterizer);
+
+      rasterizer->init24x8(*box24x8);
+      return RasterPaintEngine_clipRasterizedShape8(engine, rasterizer);
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
+}
+
 static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBoxF(
   RasterPaintEngine* engine, uint32_t clipOp, const BoxF* box)
 {
-  // TODO: Raster paint engine.
-  return ERR_RT_NOT_IMPLEMENTED;
+  BoxI box24x8(UNINITIALIZED);
+  box24x8.x0 = Math::fixed24x8FromFloat(box->x0);
+  box24x8.y0 = Math::fixed24x8FromFloat(box->y0);
+  box24x8.x1 = Math::fixed24x8FromFloat(box->x1);
+  box24x8.y1 = Math::fixed24x8FromFloat(box->y1);
+
+  return RasterPaintEngine_clipNormalizedBox24x8(engine, clipOp, &box24x8);
 }
 
 static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBoxD(
   RasterPaintEngine* engine, uint32_t clipOp, const BoxD* box)
 {
-  // TODO: Raster paint engine.
-  return ERR_RT_NOT_IMPLEMENTED;
+  BoxI box24x8(UNINITIALIZED);
+  box24x8.x0 = Math::fixed24x8FromFloat(box->x0);
+  box24x8.y0 = Math::fixed24x8FromFloat(box->y0);
+  box24x8.x1 = Math::fixed24x8FromFloat(box->x1);
+  box24x8.y1 = Math::fixed24x8FromFloat(box->y1);
+
+  return RasterPaintEngine_clipNormalizedBox24x8(engine, clipOp, &box24x8);
+}
+
+// ============================================================================
+// [Fog::RasterPaintEngine - ClipNormalizedPath]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedPathF(
+  RasterPaintEngine* engine, uint32_t clipOp, const PathF* path, const PointF* pt, uint32_t fillRule)
+{
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      PathRasterizer8* rasterizer = &engine->ctx.pathRasterizer8;
+      RasterPaintEngine_prepareClipRasterizer(engine, clipOp, rasterizer);
+
+      rasterizer->setFillRule(fillRule);
+      if (FOG_IS_ERROR(rasterizer->init()))
+        return rasterizer->getError();
+
+      rasterizer->addPath(*path, *pt);
+      rasterizer->finalize();
+
+      if (rasterizer->isValid())
+        return RasterPaintEngine_clipRasterizedShape8(engine, rasterizer);
+      else
+        return RasterPaintEngine_clipAll(engine);
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedPathD(
+  RasterPaintEngine* engine, uint32_t clipOp, const PathD* path, const PointD* pt, uint32_t fillRule)
+{
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      PathRasterizer8* rasterizer = &engine->ctx.pathRasterizer8;
+      RasterPaintEngine_prepareClipRasterizer(engine, clipOp, rasterizer);
+
+      rasterizer->setFillRule(fillRule);
+      if (FOG_IS_ERROR(rasterizer->init()))
+        return rasterizer->getError();
+
+      rasterizer->addPath(*path, *pt);
+      rasterizer->finalize();
+
+      if (rasterizer->isValid())
+        return RasterPaintEngine_clipRasterizedShape8(engine, rasterizer);
+      else
+        return RasterPaintEngine_clipAll(engine);
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
 }
 
 // ============================================================================
@@ -4322,15 +4912,77 @@ static err_t FOG_FASTCALL RasterPaintEngine_clipNormalizedBoxD(
 static err_t FOG_FASTCALL RasterPaintEngine_clipRawPathF(
   RasterPaintEngine* engine, uint32_t clipOp, const PathF* path, uint32_t fillRule)
 {
-  // TODO: Raster paint engine.
-  return ERR_RT_NOT_IMPLEMENTED;
+  const TransformF& transform = engine->getFinalTransformF();
+  uint32_t transformType = engine->ensureFinalTransformF() 
+    ? transform._getType()
+    : TRANSFORM_TYPE_IDENTITY;
+
+  PathClipperF clipper(clipOp == CLIP_OP_REPLACE ? engine->getMetaClipBoxF() : engine->getClipBoxF());
+  PathF* tmp = &engine->ctx.tmpPathF[1];
+  PointF pt(0.0f, 0.0f);
+
+  switch (transformType)
+  {
+    case TRANSFORM_TYPE_TRANSLATION:
+      pt.set(transform._20, transform._21);
+      clipper._clipBox.translate(-transform._20, -transform._21);
+      // ... Fall through ...
+
+    case TRANSFORM_TYPE_IDENTITY:
+      switch (clipper.measurePath(*path))
+      {
+        case PATH_CLIPPER_MEASURE_BOUNDED:
+          return RasterPaintEngine_clipNormalizedPathF(engine, clipOp, path, &pt, fillRule);
+        case PATH_CLIPPER_MEASURE_UNBOUNDED:
+          tmp->clear();
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
+          return RasterPaintEngine_clipNormalizedPathF(engine, clipOp, tmp, &pt, fillRule);
+        default:
+          return ERR_GEOMETRY_INVALID;
+      }
+
+    default:
+      tmp->clear();
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
+      return RasterPaintEngine_clipNormalizedPathF(engine, clipOp, tmp, &pt, fillRule);
+  }
 }
 
 static err_t FOG_FASTCALL RasterPaintEngine_clipRawPathD(
   RasterPaintEngine* engine, uint32_t clipOp, const PathD* path, uint32_t fillRule)
 {
-  // TODO: Raster paint engine.
-  return ERR_RT_NOT_IMPLEMENTED;
+  const TransformD& transform = engine->getFinalTransformD();
+  uint32_t transformType = transform._getType();
+
+  PathClipperD clipper(clipOp == CLIP_OP_REPLACE ? engine->getMetaClipBoxD() : engine->getClipBoxD());
+  PathD* tmp = &engine->ctx.tmpPathD[1];
+  PointD pt(0.0, 0.0);
+
+  switch (transformType)
+  {
+    case TRANSFORM_TYPE_TRANSLATION:
+      pt.set(transform._20, transform._21);
+      clipper._clipBox.translate(-transform._20, -transform._21);
+      // ... Fall through ...
+
+    case TRANSFORM_TYPE_IDENTITY:
+      switch (clipper.measurePath(*path))
+      {
+        case PATH_CLIPPER_MEASURE_BOUNDED:
+          return RasterPaintEngine_clipNormalizedPathD(engine, clipOp, path, &pt, fillRule);
+        case PATH_CLIPPER_MEASURE_UNBOUNDED:
+          tmp->clear();
+          FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
+          return RasterPaintEngine_clipNormalizedPathD(engine, clipOp, tmp, &pt, fillRule);
+        default:
+          return ERR_GEOMETRY_INVALID;
+      }
+    
+    default:
+      tmp->clear();
+      FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, transform))));
+      return RasterPaintEngine_clipNormalizedPathD(engine, clipOp, tmp, &pt, fillRule);
+  }
 }
 
 
@@ -4387,7 +5039,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipPathF(
 
       case PATH_CLIPPER_MEASURE_UNBOUNDED:
         tmp->clear();
-        FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+        FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
         engine->doCmd->clipNormalizedPathF(engine, clipOp, tmp, fillRule);
         return ERR_OK;
 
@@ -4398,7 +5050,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipPathF(
   else
   {
     tmp->clear();
-    FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, engine->getFinalTransformF()));
+    FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, engine->getFinalTransformF()))));
     engine->doCmd->clipNormalizedPathF(engine, clipOp, tmp, fillRule);
     return ERR_OK;
   }
@@ -4422,7 +5074,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipPathD(
 
       case PATH_CLIPPER_MEASURE_UNBOUNDED:
         tmp->clear();
-        FOG_RETURN_ON_ERROR(clipper.continuePath(*tmp, *path));
+        FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.continuePath(*tmp, *path))));
         engine->doCmd->clipNormalizedPathD(engine, clipOp, tmp, fillRule);
         return ERR_OK;
 
@@ -4433,7 +5085,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipPathD(
   else
   {
     tmp->clear();
-    FOG_RETURN_ON_ERROR(clipper.clipPath(*tmp, *path, engine->getFinalTransformD()));
+    FOG_RETURN_ON_ERROR(_FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_CLIP, (clipper.clipPath(*tmp, *path, engine->getFinalTransformD()))));
     engine->doCmd->clipNormalizedPathD(engine, clipOp, tmp, fillRule);
     return ERR_OK;
   }
@@ -4453,7 +5105,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipStrokedPathF(
   PathF* tmp = &engine->ctx.tmpPathF[0];
 
   tmp->clear();
-  stroker->strokePath(*tmp, *path);
+  _FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker->strokePath(*tmp, *path)));
   return engine->doCmd->clipNormalizedPathF(engine, clipOp, tmp, FILL_RULE_NON_ZERO);
 }
 
@@ -4471,7 +5123,7 @@ static err_t FOG_FASTCALL RasterPaintSerializer_clipStrokedPathD(
   PathD* tmp = &engine->ctx.tmpPathD[0];
 
   tmp->clear();
-  stroker->strokePath(*tmp, *path);
+  _FOG_RASTER_PROFILE_CALL(engine->ctx, RASTER_PROFILE_STROKE, (stroker->strokePath(*tmp, *path)));
   return engine->doCmd->clipNormalizedPathD(engine, clipOp, tmp, FILL_RULE_NON_ZERO);
 }
 
@@ -4676,7 +5328,7 @@ static err_t FOG_CDECL RasterPaintEngine_clipRectF(Painter* self, uint32_t clipO
   }
 
   if (!BoxF::intersect(normBox, normBox, clipBox))
-    return ERR_OK;
+    return RasterPaintEngine_clipAll(engine);
 
   return RasterPaintEngine_clipNormalizedBoxF(engine, clipOp, &normBox);
 }
@@ -4700,7 +5352,7 @@ static err_t FOG_CDECL RasterPaintEngine_clipRectD(Painter* self, uint32_t clipO
   engine->getFinalTransformD().mapBox(normBox, normBox);
 
   if (!BoxD::intersect(normBox, normBox, clipBox))
-    return ERR_OK;
+    return RasterPaintEngine_clipAll(engine);
 
   return RasterPaintEngine_clipNormalizedBoxD(engine, clipOp, &normBox);
 }
@@ -4708,33 +5360,122 @@ static err_t FOG_CDECL RasterPaintEngine_clipRectD(Painter* self, uint32_t clipO
 static err_t FOG_CDECL RasterPaintEngine_clipRectsI(Painter* self, uint32_t clipOp, const RectI* r, size_t count)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_CLIP_FUNC();
 
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  if (count == 1)
+    return self->_vtable->clipRectI(self, clipOp, r);
+
+  if (!engine->ctx.paintHints.geometricPrecision)
+  {
+    PathF* path = &engine->ctx.tmpPathF[0];
+    path->clear();
+    path->rects(r, count);
+    return RasterPaintEngine_clipRawPathF(engine, clipOp, path, FILL_RULE_NON_ZERO);
+  }
+  else
+  {
+    PathD* path = &engine->ctx.tmpPathD[0];
+    path->clear();
+    path->rects(r, count);
+    return RasterPaintEngine_clipRawPathD(engine, clipOp, path, FILL_RULE_NON_ZERO);
+  }
 }
 
 static err_t FOG_CDECL RasterPaintEngine_clipPolygonI(Painter* self, uint32_t clipOp, const PointI* p, size_t count)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_CLIP_FUNC();
 
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  if (!engine->ctx.paintHints.geometricPrecision)
+  {
+    PathF* path = &engine->ctx.tmpPathF[0];
+    path->clear();
+    path->polygon(p, count, PATH_DIRECTION_CW);
+    return RasterPaintEngine_clipRawPathF(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+  }
+  else
+  {
+    PathD* path = &engine->ctx.tmpPathD[0];
+    path->clear();
+    path->polygon(p, count, PATH_DIRECTION_CW);
+    return RasterPaintEngine_clipRawPathD(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+  }
 }
 
 static err_t FOG_CDECL RasterPaintEngine_clipShapeF(Painter* self, uint32_t clipOp, uint32_t shapeType, const void* shapeData)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_CLIP_FUNC();
 
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  switch (shapeType)
+  {
+    case SHAPE_TYPE_RECT:
+    {
+      return self->_vtable->clipRectF(self, clipOp, static_cast<const RectF*>(shapeData));
+    }
+
+    case SHAPE_TYPE_RECT_ARRAY:
+    {
+      const RectArrayF* rects = reinterpret_cast<const RectArrayF*>(shapeData);
+      if (rects->getLength() == 1)
+        return self->_vtable->clipRectF(self, clipOp, rects->getData());
+      else
+        goto _Default;
+    }
+
+    case SHAPE_TYPE_PATH:
+    {
+      const PathF* path = reinterpret_cast<const PathF*>(shapeData);
+      return RasterPaintEngine_clipRawPathF(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+    }
+
+    default:
+    {
+_Default:
+      PathF* path = &engine->ctx.tmpPathF[0];
+      path->clear();
+      path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
+      return RasterPaintEngine_clipRawPathF(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+    }
+  }
 }
 
 static err_t FOG_CDECL RasterPaintEngine_clipShapeD(Painter* self, uint32_t clipOp, uint32_t shapeType, const void* shapeData)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_CLIP_FUNC();
 
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  switch (shapeType)
+  {
+    case SHAPE_TYPE_RECT:
+    {
+      return self->_vtable->clipRectD(self, clipOp, static_cast<const RectD*>(shapeData));
+    }
+
+    case SHAPE_TYPE_RECT_ARRAY:
+    {
+      const RectArrayD* rects = reinterpret_cast<const RectArrayD*>(shapeData);
+      if (rects->getLength() == 1)
+        return self->_vtable->clipRectD(self, clipOp, rects->getData());
+      else
+        goto _Default;
+    }
+
+    case SHAPE_TYPE_PATH:
+    {
+      const PathD* path = reinterpret_cast<const PathD*>(shapeData);
+      return RasterPaintEngine_clipRawPathD(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+    }
+
+    default:
+    {
+_Default:
+      PathD* path = &engine->ctx.tmpPathD[0];
+      path->clear();
+      path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
+      return RasterPaintEngine_clipRawPathD(engine, clipOp, path, engine->ctx.paintHints.fillRule);
+    }
+  }
 }
 
 static err_t FOG_CDECL RasterPaintEngine_clipStrokedShapeF(Painter* self, uint32_t clipOp, uint32_t shapeType, const void* shapeData)
@@ -4877,6 +5618,7 @@ static err_t FOG_CDECL RasterPaintEngine_resetClip(Painter* self)
     engine->ctx.clipRegion.clear();
   }
 
+  engine->ctx.resetClipMask();
   engine->stroker.f->_clipBox.setBox(engine->ctx.clipBoxI);
   engine->stroker.d->_clipBox.setBox(engine->ctx.clipBoxI);
 
@@ -4890,10 +5632,10 @@ static err_t FOG_CDECL RasterPaintEngine_resetClip(Painter* self)
 // ============================================================================
 
 template<bool Evaluate, bool Destroy>
-static void RasterPaintEngine_doCommands(Painter* self, uint8_t* p, uint8_t* pEnd)
+static void RasterPaintEngine_doCommands(RasterPaintEngine* engine, uint8_t* p, uint8_t* pEnd)
 {
-  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
-  const RasterPaintDoCmd* doCmd = engine->doCmd;
+  // The engine can be NULL if commands are only destroyed (see Picture).
+  const RasterPaintDoCmd* doCmd = Evaluate ? engine->doCmd : NULL;
 
   while (p != pEnd)
   {
@@ -5067,6 +5809,34 @@ static void RasterPaintEngine_doCommands(Painter* self, uint8_t* p, uint8_t* pEn
           cmd->destroy(engine);
         break;
       }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS:
+      {
+        RasterPaintCmd_FillNormalizedGlyphs* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedGlyphs*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedGlyphs);
+
+        if (Evaluate && cmd->getLength() != 0)
+          doCmd->fillNormalizedGlyphs(engine, cmd->getItems(), cmd->getLength(), &cmd->getBox());
+
+        if (Destroy)
+          cmd->destroy(engine);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F:
+      {
+        RasterPaintCmd_DrawNormalizedHairlineF* cmd =
+          reinterpret_cast<RasterPaintCmd_DrawNormalizedHairlineF*>(p);
+        p += sizeof(RasterPaintCmd_DrawNormalizedHairlineF);
+
+        if (Evaluate)
+          doCmd->drawNormalizedHairlineF(engine, &cmd->_path);
+
+        if (Destroy)
+          cmd->destroy(engine);
+        break;
+      }
       
       case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A:
       {
@@ -5100,6 +5870,36 @@ static void RasterPaintEngine_doCommands(Painter* self, uint8_t* p, uint8_t* pEn
         break;
       }
 
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I:
+      {
+        RasterPaintCmd_BlitNormalizedImageI* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageI*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageI);
+
+        if (Evaluate)
+          doCmd->blitNormalizedImageI(engine, &cmd->getBox(),
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+
+        if (Destroy)
+          cmd->destroy(engine);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D:
+      {
+        RasterPaintCmd_BlitNormalizedImageD* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageD*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageD);
+
+        if (Evaluate)
+          doCmd->blitNormalizedImageD(engine, &cmd->getBox(),
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+
+        if (Destroy)
+          cmd->destroy(engine);
+        break;
+      }
+
       case RASTER_PAINT_CMD_SET_CLIP_BOX:
       {
         RasterPaintCmd_SetClipBox* cmd =
@@ -5110,6 +5910,7 @@ static void RasterPaintEngine_doCommands(Painter* self, uint8_t* p, uint8_t* pEn
         {
           engine->ctx.clipType = RASTER_CLIP_BOX;
           engine->ctx.clipBoxI = cmd->getClipBox();
+          engine->ctx.resetClipMask();
         }
 
         if (Destroy)
@@ -5128,12 +5929,27 @@ static void RasterPaintEngine_doCommands(Painter* self, uint8_t* p, uint8_t* pEn
           engine->ctx.clipType = RASTER_CLIP_REGION;
           engine->ctx.clipRegion = cmd->getClipRegion();
           engine->ctx.clipBoxI = engine->ctx.clipRegion.getBoundingBox();
+          engine->ctx.resetClipMask();
         }
         
         if (Destroy)
           cmd->destroy(engine);
         break;
       }
+
+      case RASTER_PAINT_CMD_SET_CLIP_MASK:
+      {
+        RasterPaintCmd_SetClipMask* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipMask*>(p);
+        p += sizeof(RasterPaintCmd_SetClipMask);
+
+        if (Evaluate)
+          engine->ctx.setClipMask(cmd->getClipMask()->addRef());
+
+        if (Destroy)
+          cmd->destroy(engine);
+        break;
+      }
     }
   }
 }
@@ -5146,10 +5962,17 @@ static void FOG_CDECL RasterPaintEngine_resetGroupStates(RasterPaintEngine* engi
   engine->masterFlags &= ~(RASTER_NO_PAINT_OPACITY | RASTER_NO_PAINT_COMPOSITING_OPERATOR);
 }
 
-static err_t FOG_CDECL RasterPaintEngine_beginGroup(Painter* self, uint32_t flags)
+//! @internal
+//!
+//! @brief Create a new group, used by @c beginGroup() and @c beginPicture().
+static err_t RasterPaintEngine_createGroup(Painter* self, uint32_t groupFlags)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
 
+  // Groups share the command allocator with the multithreaded recorder, the
+  // recorded commands must be rendered before.
+  FOG_RETURN_ON_ERROR(engine->flushMT());
+
   MemZoneRecord* cRecord = engine->cmdAllocator.record();
   MemZoneRecord* gRecord = engine->groupAllocator.record();
 
@@ -5157,149 +5980,876 @@ static err_t FOG_CDECL RasterPaintEngine_beginGroup(Painter* self, uint32_t flag
   RasterPaintGroup* g = static_cast<RasterPaintGroup*>(
     engine->groupAllocator.alloc(sizeof(RasterPaintGroup)));
 
-  if (FOG_IS_NULL(g))
+  if (FOG_IS_NULL(g))
+  {
+    engine->cmdAllocator.revert(cRecord);
+    engine->groupAllocator.revert(gRecord);
+
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  // Prepare.
+  g->reset();
+  g->top = engine->curGroup;
+  g->flags = groupFlags;
+
+  g->groupRecord = gRecord;
+  g->cmdRecord = cRecord;
+  g->cmdStart = engine->cmdAllocator._pos;
+
+  // Save all states, because states are always preserved across the groups.
+  err_t err = engine->vtable->save(self);
+  if (FOG_IS_ERROR(err))
+  {
+    engine->cmdAllocator.revert(cRecord);
+    engine->groupAllocator.revert(gRecord);
+
+    return err;
+  }
+
+  engine->saveAll();
+  engine->state->lockedByGroup = true;
+  g->savedState = engine->state;
+
+  // The recorded commands can't depend on the states serialized before the
+  // group was created, the first command serializes all of them.
+  engine->masterFlags |= RASTER_PENDING_SOURCE | RASTER_PENDING_BASE_FLAGS;
+
+  // Set the current group to 'g' and set the command handler to 'RasterPaintDoGroup'.
+  engine->curGroup = g;
+  engine->doCmd = &RasterPaintDoGroup_vtable[engine->getMode()];
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL RasterPaintEngine_beginGroup(Painter* self, uint32_t flags)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_createGroup(self, NO_FLAGS));
+
+  // Reset core states which are always set to default values when new group
+  // is created.
+  RasterPaintEngine_resetGroupStates(engine);
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  RasterPaintGroup* g = engine->curGroup;
+
+  if (g == &engine->topGroup || (g->flags & RASTER_GROUP_PICTURE) != 0)
+    return ERR_PAINTER_NO_GROUP;
+
+  if (RasterUtil::isPatternContext(engine->ctx.pc) && engine->ctx.pc->_reference.deref())
+    engine->destroyPatternContext(engine->ctx.pc);
+
+  if (engine->state != g->savedState)
+    engine->discardStates(g->savedState);
+
+  RasterLayer* layer = NULL;
+  BoxI targetBBox = g->boundingBox;
+
+  engine->curGroup = g->top;
+
+  // The group is composited using the states saved by beginGroup(), if these
+  // states don't allow painting (zero opacity, NOP operator, empty clip) then
+  // the commands are discarded without rendering them.
+  if (targetBBox.isValid() &&
+      (g->savedState->prevMasterFlags & (RASTER_NO_PAINT_BASE_FLAGS | RASTER_NO_PAINT_FATAL)) == 0 &&
+      (layer = RasterLayerPool_oInstance->acquire(SizeI(targetBBox.getWidth(), targetBBox.getHeight()))) != NULL)
+  {
+    _FOG_RASTER_PROFILE_LAYER(engine->ctx);
+    RasterPaintTarget savedTarget = engine->ctx.target;
+
+    // We don't change target size, the layer can be larger than the bounding
+    // box, only the bounding box area is used.
+    engine->ctx.target.stride = layer->image.getStride();
+    engine->ctx.target.pixels = layer->image.getFirstX();
+    engine->ctx.target.format = IMAGE_FORMAT_PRGB32;
+    engine->ctx.target.setup();
+
+    // Offset target buffer.
+    engine->ctx.target.pixels -= targetBBox.x0 * engine->ctx.target.bpp;
+    engine->ctx.target.pixels -= targetBBox.y0 * engine->ctx.target.stride;
+
+    engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+
+    // Clear the bounding box area of the layer (pooled layers contain pixels
+    // of the previous group).
+    uint32_t oldPaintHints = engine->ctx.paintHints.packed;
+    uint32_t oldPrgb32 = engine->ctx.solid.prgb32.u32;
+
+    engine->ctx.paintHints.compositingOperator = COMPOSITE_SRC;
+    engine->ctx.solid.prgb32.u32 = 0x00000000;
+    engine->ctx.pc = (RasterPattern*)(size_t)0x1;
+
+    engine->doCmd->fillNormalizedBoxI(engine, &targetBBox);
+
+    engine->ctx.paintHints.packed = oldPaintHints;
+    engine->ctx.solid.prgb32.u32 = oldPrgb32;
+    engine->ctx.pc = NULL;
+
+    // Reset core states which are always set to default values when new group
+    // is created.
+    RasterPaintEngine_resetGroupStates(engine);
+
+    // Run commands.
+    RasterPaintEngine_doCommands<true, true>(engine, g->cmdStart, engine->cmdAllocator._pos);
+
+    // Switch 'doCmd' interface to the previous group or to the direct
+    // rendering in case that there is no previous group.
+    if (engine->curGroup != &engine->topGroup)
+      engine->doCmd = &RasterPaintDoGroup_vtable[engine->getMode()];
+    else
+      engine->doCmd = &RasterPaintDoRender_vtable[engine->getMode()];
+
+    // Revert target, and everything else.
+    engine->ctx.target = savedTarget;
+  }
+  else
+  {
+    RasterPaintEngine_doCommands<false, true>(engine, g->cmdStart, engine->cmdAllocator._pos);
+
+    // Switch 'doCmd' interface to the previous group or to the direct rendering.
+    if (engine->curGroup != &engine->topGroup)
+      engine->doCmd = &RasterPaintDoGroup_vtable[engine->getMode()];
+    else
+      engine->doCmd = &RasterPaintDoRender_vtable[engine->getMode()];
+  }
+
+  // We must zero pattern context pointer, because it has been invalidated.
+  engine->ctx.pc = NULL;
+
+  FOG_ASSERT(engine->state == g->savedState);
+  engine->state->lockedByGroup = false;
+  engine->vtable->restore(self);
+
+  // Revert group and command allocators.
+  engine->cmdAllocator.revert(g->cmdRecord);
+  engine->groupAllocator.revert(g->groupRecord);
+
+  // Composite the layer and return it back to the pool. The commands can be
+  // recorded by the multithreaded engine or by the outer group, in that case
+  // the layer isn't reused until the image is released by these commands.
+  if (layer != NULL)
+  {
+    BoxI visibleBox;
+    if (BoxI::intersect(visibleBox, targetBBox, engine->ctx.clipBoxI))
+    {
+      PointI dPos(visibleBox.x0, visibleBox.y0);
+      RectI sRect(visibleBox.x0 - targetBBox.x0, visibleBox.y0 - targetBBox.y0,
+        visibleBox.getWidth(), visibleBox.getHeight());
+      engine->doCmd->blitNormalizedImageA(engine, &dPos, &layer->image, &sRect);
+    }
+
+    RasterLayerPool_oInstance->release(layer);
+  }
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RasterPaintEngine - Picture]
+// ============================================================================
+
+static size_t RasterPaintEngine_getCommandSize(uint32_t command)
+{
+  switch (command)
+  {
+    case RASTER_PAINT_CMD_NEXT                           : return sizeof(RasterPaintCmd_Next);
+    case RASTER_PAINT_CMD_SET_OPACITY                    : return sizeof(RasterPaintCmd_SetOpacity);
+    case RASTER_PAINT_CMD_SET_OPACITY_AND_PRGB32         : return sizeof(RasterPaintCmd_SetOpacityAndPrgb32);
+    case RASTER_PAINT_CMD_SET_OPACITY_AND_PATTERN        : return sizeof(RasterPaintCmd_SetOpacityAndPattern);
+    case RASTER_PAINT_CMD_SET_PAINT_HINTS                : return sizeof(RasterPaintCmd_SetPaintHints);
+    case RASTER_PAINT_CMD_FILL_ALL                       : return sizeof(RasterPaintCmd_FillAll);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_I          : return sizeof(RasterPaintCmd_FillNormalizedBoxI);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_F          : return sizeof(RasterPaintCmd_FillNormalizedBoxF);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_D          : return sizeof(RasterPaintCmd_FillNormalizedBoxD);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F         : return sizeof(RasterPaintCmd_FillNormalizedPathF);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D         : return sizeof(RasterPaintCmd_FillNormalizedPathD);
+    case RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS         : return sizeof(RasterPaintCmd_FillNormalizedGlyphs);
+    case RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F     : return sizeof(RasterPaintCmd_DrawNormalizedHairlineF);
+    case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A        : return sizeof(RasterPaintCmd_BlitNormalizedImageA);
+    case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_FRAGMENT_A: return sizeof(RasterPaintCmd_BlitNormalizedImageFragmentA);
+    case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I        : return sizeof(RasterPaintCmd_BlitNormalizedImageI);
+    case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D        : return sizeof(RasterPaintCmd_BlitNormalizedImageD);
+    case RASTER_PAINT_CMD_SET_CLIP_BOX                   : return sizeof(RasterPaintCmd_SetClipBox);
+    case RASTER_PAINT_CMD_SET_CLIP_REGION                : return sizeof(RasterPaintCmd_SetClipRegion);
+    case RASTER_PAINT_CMD_SET_CLIP_MASK                  : return sizeof(RasterPaintCmd_SetClipMask);
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+      return 0;
+  }
+}
+
+static FOG_INLINE bool RasterPaintEngine_isPictureCompatible(uint32_t pictureFormat, uint32_t targetFormat)
+{
+  if (pictureFormat == targetFormat)
+    return true;
+
+  // Pattern-contexts created for the 8-bit ARGB formats fetch the same pixels
+  // (groups use them to render into PRGB32 layers as well).
+  return pictureFormat <= IMAGE_FORMAT_RGB24 && targetFormat <= IMAGE_FORMAT_RGB24;
+}
+
+//! @internal
+//!
+//! @brief Move the commands recorded by the picture group @a g to a new
+//! @c PictureData instance.
+//!
+//! The commands are moved without calling their destructors, the zone-records
+//! (@c RASTER_PAINT_CMD_NEXT) are removed so the command stream is contiguous.
+static PictureData* RasterPaintEngine_createPicture(RasterPaintEngine* engine,
+  const RasterPaintGroup* g, uint8_t* pStart, uint8_t* pEnd)
+{
+  BoxI boundingBox = g->boundingBox;
+
+  size_t length = 0;
+  size_t retainedSize = 0;
+
+  const RasterPattern* lastPc = NULL;
+  bool isSrcOver = true;
+  uint8_t* p = pStart;
+
+  // --------------------------------------------------------------------------
+  // [Pass 1 - Size]
+  // --------------------------------------------------------------------------
+
+  while (p != pEnd)
+  {
+    uint32_t command = reinterpret_cast<RasterPaintCmd*>(p)->getCommand();
+
+    if (command == RASTER_PAINT_CMD_NEXT)
+    {
+      p = reinterpret_cast<RasterPaintCmd_Next*>(p)->getPtr();
+      continue;
+    }
+
+    switch (command)
+    {
+      case RASTER_PAINT_CMD_SET_PAINT_HINTS:
+      {
+        const PaintHints& hints = reinterpret_cast<RasterPaintCmd_SetPaintHints*>(p)->getPaintHints();
+        if (hints.compositingOperator != COMPOSITE_SRC_OVER)
+          isSrcOver = false;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY_AND_PATTERN:
+      {
+        const RasterPattern* pc = reinterpret_cast<RasterPaintCmd_SetOpacityAndPattern*>(p)->getPatternContext();
+        FOG_ASSERT(pc->_isRetained);
+
+        if (pc != lastPc)
+        {
+          retainedSize += sizeof(RasterPattern);
+          lastPc = pc;
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F:
+      case RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F:
+      {
+        const PathF& path = reinterpret_cast<RasterPaintCmd_FillNormalizedPathF*>(p)->getPath();
+        retainedSize += path.getCapacity() * (sizeof(PointF) + sizeof(uint8_t));
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D:
+      {
+        const PathD& path = reinterpret_cast<RasterPaintCmd_FillNormalizedPathD*>(p)->getPath();
+        retainedSize += path.getCapacity() * (sizeof(PointD) + sizeof(uint8_t));
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS:
+      {
+        retainedSize += reinterpret_cast<RasterPaintCmd_FillNormalizedGlyphs*>(p)->getLength() * sizeof(RasterGlyphItem8);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_REGION:
+      {
+        retainedSize += reinterpret_cast<RasterPaintCmd_SetClipRegion*>(p)->getClipRegion().getLength() * sizeof(BoxI);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_MASK:
+      {
+        // The clip-mask is replayed only if it's not clipped, it's easier to
+        // make it a part of the picture bounding-box.
+        const RasterClipMask8* mask = reinterpret_cast<RasterPaintCmd_SetClipMask*>(p)->getClipMask();
+        BoxI::bound(boundingBox, boundingBox, mask->getBoundingBox());
+        break;
+      }
+    }
+
+    size_t size = RasterPaintEngine_getCommandSize(command);
+    length += size;
+    p += size;
+  }
+
+  size_t headerSize = (sizeof(PictureData) + 15) & ~(size_t)15;
+  PictureData* d = reinterpret_cast<PictureData*>(MemMgr::alloc(headerSize + length));
+
+  if (FOG_IS_NULL(d))
+    return NULL;
+
+  d->reference.init(1);
+  d->format = engine->ctx.target.format;
+  d->boundingBox = boundingBox;
+  d->isSrcOver = isSrcOver;
+  d->memorySize = headerSize + length + retainedSize;
+  d->length = length;
+  d->commands = reinterpret_cast<uint8_t*>(d) + headerSize;
+
+  // --------------------------------------------------------------------------
+  // [Pass 2 - Move]
+  // --------------------------------------------------------------------------
+
+  uint8_t* dst = d->commands;
+  uint8_t* segment = pStart;
+
+  p = pStart;
+  while (p != pEnd)
+  {
+    uint32_t command = reinterpret_cast<RasterPaintCmd*>(p)->getCommand();
+
+    if (command == RASTER_PAINT_CMD_NEXT)
+    {
+      size_t segmentSize = (size_t)(p - segment);
+      MemOps::copy(dst, segment, segmentSize);
+      dst += segmentSize;
+
+      p = reinterpret_cast<RasterPaintCmd_Next*>(p)->getPtr();
+      segment = p;
+      continue;
+    }
+
+    p += RasterPaintEngine_getCommandSize(command);
+  }
+
+  MemOps::copy(dst, segment, (size_t)(p - segment));
+  return d;
+}
+
+static void FOG_CDECL RasterPaintEngine_freePicture(PictureData* d)
+{
+  // All pattern-contexts referenced by the picture are retained, so the
+  // commands can be destroyed without the paint-engine.
+  RasterPaintEngine_doCommands<false, true>(NULL, d->commands, d->commands + d->length);
+  MemMgr::free(d);
+}
+
+//! @internal
+//!
+//! @brief Replay the picture @a d using the current command handler.
+//!
+//! All geometry in the picture is already clipped by the recorded clip, the
+//! clip commands are intersected with @a replayBox, which must subsume the
+//! picture bounding box. The states of the paint-engine context are restored
+//! after the replay.
+static err_t RasterPaintEngine_doPicture(RasterPaintEngine* engine, const PictureData* d, const BoxI& replayBox)
+{
+  FOG_ASSERT(replayBox.subsumes(d->boundingBox));
+
+  RasterPaintContext& ctx = engine->ctx;
+  const RasterPaintDoCmd* doCmd = engine->doCmd;
+
+  // Save the context, the source of the picture is always set by the first
+  // command in the stream, the clip is initialized to the replay-box.
+  RasterPattern* savedPc = ctx.pc;
+  RasterSolid savedSolid = ctx.solid;
+  PaintHints savedPaintHints = ctx.paintHints;
+  RasterHints savedRasterHints = ctx.rasterHints;
+
+  uint32_t savedClipType = ctx.clipType;
+  BoxI savedClipBoxI = ctx.clipBoxI;
+  Region savedClipRegion(ctx.clipRegion);
+  RasterClipMask8* savedClipMask = ctx.clipMask;
+
+  ctx.pc = NULL;
+  ctx.clipType = RASTER_CLIP_BOX;
+  ctx.clipBoxI = replayBox;
+  ctx.clipMask = NULL;
+
+  bool noPaint = false;
+  err_t err = ERR_OK;
+
+  uint8_t* p = d->commands;
+  uint8_t* pEnd = p + d->length;
+
+  while (p != pEnd)
+  {
+    switch (reinterpret_cast<RasterPaintCmd*>(p)->getCommand())
+    {
+      case RASTER_PAINT_CMD_SET_OPACITY:
+      {
+        RasterPaintCmd_SetOpacity* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacity*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacity);
+
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        engine->masterFlags |= RASTER_PENDING_OPACITY;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY_AND_PRGB32:
+      {
+        RasterPaintCmd_SetOpacityAndPrgb32* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacityAndPrgb32*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacityAndPrgb32);
+
+        if (RasterUtil::isPatternContext(ctx.pc) && ctx.pc->_reference.deref())
+          engine->destroyPatternContext(ctx.pc);
+
+        ctx.pc = (RasterPattern*)(size_t)0x1;
+        ctx.solid.prgb32.u32 = cmd->getPrgb32();
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        engine->masterFlags |= RASTER_PENDING_SOURCE | RASTER_PENDING_OPACITY;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY_AND_PATTERN:
+      {
+        RasterPaintCmd_SetOpacityAndPattern* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacityAndPattern*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacityAndPattern);
+
+        if (RasterUtil::isPatternContext(ctx.pc) && ctx.pc->_reference.deref())
+          engine->destroyPatternContext(ctx.pc);
+
+        ctx.pc = cmd->getPatternContext();
+        ctx.pc->_reference.inc();
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        engine->masterFlags |= RASTER_PENDING_SOURCE | RASTER_PENDING_OPACITY;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_PAINT_HINTS:
+      {
+        RasterPaintCmd_SetPaintHints* cmd =
+          reinterpret_cast<RasterPaintCmd_SetPaintHints*>(p);
+        p += sizeof(RasterPaintCmd_SetPaintHints);
+
+        ctx.paintHints.packed = cmd->getPaintHints().packed;
+        engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_ALL:
+      {
+        p += sizeof(RasterPaintCmd_FillAll);
+
+        if (!noPaint)
+          err = doCmd->fillAll(engine);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_I:
+      {
+        RasterPaintCmd_FillNormalizedBoxI* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxI*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxI);
+
+        if (!noPaint)
+          err = doCmd->fillNormalizedBoxI(engine, &cmd->_box);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_F:
+      {
+        RasterPaintCmd_FillNormalizedBoxF* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxF*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxF);
+
+        if (!noPaint)
+          err = doCmd->fillNormalizedBoxF(engine, &cmd->_box);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_D:
+      {
+        RasterPaintCmd_FillNormalizedBoxD* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxD*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxD);
+
+        if (!noPaint)
+          err = doCmd->fillNormalizedBoxD(engine, &cmd->_box);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F:
+      {
+        RasterPaintCmd_FillNormalizedPathF* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedPathF*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedPathF);
+
+        if (!noPaint)
+          err = doCmd->fillNormalizedPathF(engine, &cmd->_path, &cmd->_pt, cmd->getFillRule());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D:
+      {
+        RasterPaintCmd_FillNormalizedPathD* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedPathD*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedPathD);
+
+        if (!noPaint)
+          err = doCmd->fillNormalizedPathD(engine, &cmd->_path, &cmd->_pt, cmd->getFillRule());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS:
+      {
+        RasterPaintCmd_FillNormalizedGlyphs* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedGlyphs*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedGlyphs);
+
+        if (!noPaint && cmd->getLength() != 0)
+          err = doCmd->fillNormalizedGlyphs(engine, cmd->getItems(), cmd->getLength(), &cmd->getBox());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F:
+      {
+        RasterPaintCmd_DrawNormalizedHairlineF* cmd =
+          reinterpret_cast<RasterPaintCmd_DrawNormalizedHairlineF*>(p);
+        p += sizeof(RasterPaintCmd_DrawNormalizedHairlineF);
+
+        if (!noPaint)
+          err = doCmd->drawNormalizedHairlineF(engine, &cmd->_path);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A:
+      {
+        RasterPaintCmd_BlitNormalizedImageA* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageA*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageA);
+
+        if (!noPaint)
+        {
+          const Image& srcImage = cmd->getSrcImage();
+          RectI srcFragment(0, 0, srcImage.getWidth(), srcImage.getHeight());
+          err = doCmd->blitNormalizedImageA(engine, &cmd->_pt, &srcImage, &srcFragment);
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_FRAGMENT_A:
+      {
+        RasterPaintCmd_BlitNormalizedImageFragmentA* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageFragmentA*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageFragmentA);
+
+        if (!noPaint)
+          err = doCmd->blitNormalizedImageA(engine, &cmd->_pt, &cmd->_srcImage, &cmd->_srcFragment);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I:
+      {
+        RasterPaintCmd_BlitNormalizedImageI* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageI*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageI);
+
+        if (!noPaint)
+          err = doCmd->blitNormalizedImageI(engine, &cmd->getBox(),
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D:
+      {
+        RasterPaintCmd_BlitNormalizedImageD* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageD*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageD);
+
+        if (!noPaint)
+          err = doCmd->blitNormalizedImageD(engine, &cmd->getBox(),
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_BOX:
+      {
+        RasterPaintCmd_SetClipBox* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipBox*>(p);
+        p += sizeof(RasterPaintCmd_SetClipBox);
+
+        ctx.resetClipMask();
+        ctx.clipType = RASTER_CLIP_BOX;
+        noPaint = !BoxI::intersect(ctx.clipBoxI, cmd->getClipBox(), replayBox);
+
+        engine->masterFlags |= RASTER_PENDING_CLIP;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_REGION:
+      {
+        RasterPaintCmd_SetClipRegion* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipRegion*>(p);
+        p += sizeof(RasterPaintCmd_SetClipRegion);
+
+        ctx.resetClipMask();
+        noPaint = Region::intersect(ctx.clipRegion, cmd->getClipRegion(), replayBox) != ERR_OK ||
+                  ctx.clipRegion.isEmpty();
+
+        if (!noPaint)
+        {
+          ctx.clipType = ctx.clipRegion.isRect() ? RASTER_CLIP_BOX : RASTER_CLIP_REGION;
+          ctx.clipBoxI = ctx.clipRegion.getBoundingBox();
+        }
+
+        engine->masterFlags |= RASTER_PENDING_CLIP;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_MASK:
+      {
+        RasterPaintCmd_SetClipMask* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipMask*>(p);
+        p += sizeof(RasterPaintCmd_SetClipMask);
+
+        // The bounding box of the picture contains all clip-masks.
+        RasterClipMask8* mask = cmd->getClipMask();
+        FOG_ASSERT(replayBox.subsumes(mask->getBoundingBox()));
+
+        ctx.setClipMask(mask->addRef());
+        noPaint = false;
+
+        engine->masterFlags |= RASTER_PENDING_CLIP;
+        break;
+      }
+
+      default:
+      {
+        FOG_ASSERT_NOT_REACHED();
+        err = ERR_RT_INVALID_STATE;
+        break;
+      }
+    }
+
+    // The replay is stopped on the first error, but the context is always
+    // restored.
+    if (FOG_IS_ERROR(err))
+      break;
+  }
+
+  // Restore the context.
+  if (RasterUtil::isPatternContext(ctx.pc) && ctx.pc->_reference.deref())
+    engine->destroyPatternContext(ctx.pc);
+  ctx.resetClipMask();
+
+  ctx.pc = savedPc;
+  ctx.solid = savedSolid;
+  ctx.paintHints = savedPaintHints;
+  ctx.rasterHints = savedRasterHints;
+
+  ctx.clipType = savedClipType;
+  ctx.clipBoxI = savedClipBoxI;
+  ctx.clipRegion = savedClipRegion;
+  ctx.clipMask = savedClipMask;
+
+  engine->masterFlags |= RASTER_PENDING_SOURCE | RASTER_PENDING_BASE_FLAGS;
+  return err;
+}
+
+//! @internal
+//!
+//! @brief Replay the picture @a d into a temporary layer and composite the
+//! layer using the current compositing operator and opacity.
+//!
+//! Used when the picture can't be replayed directly, see
+//! @c RasterPaintEngine_paintPicture().
+static err_t RasterPaintEngine_paintPictureLayer(RasterPaintEngine* engine, const PictureData* d)
+{
+  // The layer is rendered by the master thread, the pending commands must be
+  // rendered before the target is changed.
+  FOG_RETURN_ON_ERROR(engine->flushMT());
+
+  const BoxI& layerBox = d->boundingBox;
+  int w = layerBox.getWidth();
+  int h = layerBox.getHeight();
+
+  // The temporary buffer is allocated for the width of the current target,
+  // but the layer can be wider.
+  if (engine->ctx.buffer.alloc((size_t)layerBox.x1 * 4) == NULL)
+    return ERR_RT_OUT_OF_MEMORY;
+
+  RasterLayer* layer = RasterLayerPool_oInstance->acquire(SizeI(w, h));
+  if (FOG_IS_NULL(layer))
+    return ERR_RT_OUT_OF_MEMORY;
+  _FOG_RASTER_PROFILE_LAYER(engine->ctx);
+
+  // Clear the area used by the picture.
   {
-    engine->cmdAllocator.revert(cRecord);
-    engine->groupAllocator.revert(gRecord);
+    uint8_t* pixels = layer->image.getFirstX();
+    ssize_t stride = layer->image.getStride();
 
-    return ERR_RT_OUT_OF_MEMORY;
+    for (int y = 0; y < h; y++, pixels += stride)
+      MemOps::zero(pixels, (size_t)(uint)w * 4);
   }
 
-  // Prepare.
-  g->reset();
-  g->top = engine->curGroup;
+  RasterPaintTarget savedTarget = engine->ctx.target;
+  const RasterPaintDoCmd* savedDoCmd = engine->doCmd;
 
-  g->groupRecord = gRecord;
-  g->cmdRecord = cRecord;
-  g->cmdStart = engine->cmdAllocator._pos;
+  // The layer covers the picture bounding box, which can be outside of the
+  // current target.
+  engine->ctx.target.size.set(layerBox.x1, layerBox.y1);
+  engine->ctx.target.stride = layer->image.getStride();
+  engine->ctx.target.pixels = layer->image.getFirstX();
+  engine->ctx.target.format = IMAGE_FORMAT_PRGB32;
+  engine->ctx.target.setup();
 
-  // Save all states, because states are always preserved across the groups.
-  err_t err = engine->vtable->save(self);
-  if (FOG_IS_ERROR(err))
-  {
-    engine->cmdAllocator.revert(cRecord);
-    engine->groupAllocator.revert(gRecord);
+  // Offset target buffer.
+  engine->ctx.target.pixels -= layerBox.x0 * engine->ctx.target.bpp;
+  engine->ctx.target.pixels -= layerBox.y0 * engine->ctx.target.stride;
 
-    return err;
+  engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+  err_t err = RasterPaintEngine_doPicture(engine, d, layerBox);
+
+  engine->ctx.target = savedTarget;
+  engine->doCmd = savedDoCmd;
+
+  BoxI visibleBox;
+
+  if (err == ERR_OK && BoxI::intersect(visibleBox, layerBox, engine->ctx.clipBoxI))
+  {
+    PointI dPos(visibleBox.x0, visibleBox.y0);
+    RectI sRect(visibleBox.x0 - layerBox.x0, visibleBox.y0 - layerBox.y0,
+      visibleBox.getWidth(), visibleBox.getHeight());
+    err = engine->doCmd->blitNormalizedImageA(engine, &dPos, &layer->image, &sRect);
   }
 
-  engine->saveAll();
-  engine->state->lockedByGroup = true;
-  g->savedState = engine->state;
+  RasterLayerPool_oInstance->release(layer);
+  return err;
+}
 
-  // Reset core states which are always set to default values when new group
-  // is created.
-  RasterPaintEngine_resetGroupStates(engine);
+static err_t FOG_CDECL RasterPaintEngine_beginPicture(Painter* self, uint32_t flags)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_createGroup(self, RASTER_GROUP_PICTURE));
 
-  // Set the current group to 'g' and set the command handler to 'RasterPaintDoGroup'.
-  engine->curGroup = g;
-  engine->doCmd = &RasterPaintDoGroup_vtable[RASTER_MODE_ST];
+  // Pattern-contexts referenced by the picture must be retained. The current
+  // pattern-context is referenced by the saved state, it will be created again
+  // by the first command which needs it.
+  if (RasterUtil::isPatternContext(engine->ctx.pc))
+  {
+    if (engine->ctx.pc->_reference.deref())
+      engine->destroyPatternContext(engine->ctx.pc);
+    engine->ctx.pc = NULL;
+  }
+
+  engine->pictureDepth++;
   return ERR_OK;
 }
 
-static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
+static err_t FOG_CDECL RasterPaintEngine_endPicture(Painter* self, Picture* picture)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   RasterPaintGroup* g = engine->curGroup;
 
-  if (g == &engine->topGroup)
+  if ((g->flags & RASTER_GROUP_PICTURE) == 0)
     return ERR_PAINTER_NO_GROUP;
 
   if (RasterUtil::isPatternContext(engine->ctx.pc) && engine->ctx.pc->_reference.deref())
     engine->destroyPatternContext(engine->ctx.pc);
 
+  // We must zero pattern context pointer, because it has been invalidated.
+  engine->ctx.pc = NULL;
+
   if (engine->state != g->savedState)
     engine->discardStates(g->savedState);
-  
-  Static<Image> image;
-  BoxI targetBBox = g->boundingBox;
 
-  image->_d = NULL;
-  engine->curGroup = g->top;
-
-  if (targetBBox.isValid())
-  {
-    RasterPaintTarget savedTarget = engine->ctx.target;
-    SizeI targetSize(targetBBox.getWidth(), targetBBox.getHeight());
+  uint8_t* cmdStart = g->cmdStart;
+  uint8_t* cmdEnd = engine->cmdAllocator._pos;
 
-    image.init();
-    if (image->create(targetSize, IMAGE_FORMAT_PRGB32) != ERR_OK)
-      goto _DiscardCommands;
+  PictureData* d = NULL;
+  err_t err = ERR_OK;
 
-    // We don't change target size.
-    engine->ctx.target.stride = image->getStride();
-    engine->ctx.target.pixels = image->getFirstX();
-    engine->ctx.target.format = IMAGE_FORMAT_PRGB32;
-    engine->ctx.target.setup();
+  if (g->hasBoundingBox())
+  {
+    d = RasterPaintEngine_createPicture(engine, g, cmdStart, cmdEnd);
+    if (FOG_IS_NULL(d))
+      err = ERR_RT_OUT_OF_MEMORY;
+  }
 
-    // Offset target buffer.
-    engine->ctx.target.pixels -= targetBBox.x0 * engine->ctx.target.bpp;
-    engine->ctx.target.pixels -= targetBBox.y0 * engine->ctx.target.stride;
+  // Commands moved to the picture are owned by the picture.
+  if (d == NULL)
+    RasterPaintEngine_doCommands<false, true>(engine, cmdStart, cmdEnd);
 
-    engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+  // Switch 'doCmd' interface to the previous group or to the direct rendering.
+  engine->curGroup = g->top;
+  if (engine->curGroup != &engine->topGroup)
+    engine->doCmd = &RasterPaintDoGroup_vtable[engine->getMode()];
+  else
+    engine->doCmd = &RasterPaintDoRender_vtable[engine->getMode()];
 
-    // Clear the temporary image.
-    uint32_t oldPaintHints = engine->ctx.paintHints.packed;
-    uint32_t oldPrgb32 = engine->ctx.solid.prgb32.u32;
+  engine->pictureDepth--;
 
-    engine->ctx.paintHints.compositingOperator = COMPOSITE_SRC;
-    engine->ctx.solid.prgb32.u32 = 0x00000000;
-    engine->ctx.pc = (RasterPattern*)(size_t)0x1;
+  FOG_ASSERT(engine->state == g->savedState);
+  engine->state->lockedByGroup = false;
+  engine->vtable->restore(self);
 
-    engine->doCmd->fillNormalizedBoxI(engine, &targetBBox);
+  // Revert group and command allocators.
+  engine->cmdAllocator.revert(g->cmdRecord);
+  engine->groupAllocator.revert(g->groupRecord);
 
-    engine->ctx.paintHints.packed = oldPaintHints;
-    engine->ctx.solid.prgb32.u32 = oldPrgb32;
-    engine->ctx.pc = NULL;
+  if (d != NULL)
+    atomicPtrXchg(&picture->_d, d)->release();
+  else if (err == ERR_OK)
+    picture->reset();
 
-    // Reset core states which are always set to default values when new group
-    // is created.
-    RasterPaintEngine_resetGroupStates(engine);
+  return err;
+}
 
-    // Run commands.
-    RasterPaintEngine_doCommands<true, true>(self, g->cmdStart, engine->cmdAllocator._pos);
+static err_t FOG_CDECL RasterPaintEngine_paintPicture(Painter* self, const Picture* picture)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  const PictureData* d = picture->_d;
 
-    // Switch 'doCmd' interface to the previous group or keep direct rendering
-    // in case that there is no previous group.
-    if (engine->curGroup != &engine->topGroup)
-      engine->doCmd = &RasterPaintDoGroup_vtable[RASTER_MODE_ST];
+  if (d->length == 0)
+    return ERR_OK;
 
-    // Revert target, and everything else.
-    engine->ctx.target = savedTarget;
-  }
-  else
+  if (!RasterPaintEngine_isPictureCompatible(d->format, engine->ctx.target.format))
+    return ERR_PAINTER_WRONG_FORMAT;
+
+  // The picture is composited as a layer by the current compositing operator
+  // and opacity, so it's not painted if they are no-op.
+  if (engine->masterFlags & (RASTER_NO_PAINT_META_REGION          |
+                             RASTER_NO_PAINT_USER_CLIP            |
+                             RASTER_NO_PAINT_USER_MASK            |
+                             RASTER_NO_PAINT_COMPOSITING_OPERATOR |
+                             RASTER_NO_PAINT_OPACITY              |
+                             RASTER_NO_PAINT_FATAL                ))
   {
-_DiscardCommands:
-    RasterPaintEngine_doCommands<false, true>(self, g->cmdStart, engine->cmdAllocator._pos);
-
-    // Switch 'doCmd' interface to the previous group or to the direct rendering.
-    if (engine->curGroup != &engine->topGroup)
-      engine->doCmd = &RasterPaintDoGroup_vtable[RASTER_MODE_ST];
-    else
-      engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+    return ERR_OK;
   }
 
-  // We must zero pattern context pointer, because it has been invalidated.
-  engine->ctx.pc = NULL;
-
-  FOG_ASSERT(engine->state == g->savedState);
-  engine->state->lockedByGroup = false;
-  engine->vtable->restore(self);
-
-  // Revert group and command allocators.
-  engine->cmdAllocator.revert(g->cmdRecord);
-  engine->groupAllocator.revert(g->groupRecord);
+  const BoxI& clipBox = engine->ctx.clipBoxI;
+  if (!clipBox.overlaps(d->boundingBox))
+    return ERR_OK;
 
-  // Destroy image buffer, if created.
-  if (image->_d != NULL)
+  // The picture is replayed directly if the result is the same as compositing
+  // the layer - it's fully visible, the layer would be composited by opaque
+  // SRC_OVER and all recorded commands are SRC_OVER. The recorded commands are
+  // passed to the current command handler (rendered, serialized for the
+  // workers, or recorded by a group).
+  if (engine->ctx.clipType == RASTER_CLIP_BOX &&
+      clipBox.subsumes(d->boundingBox) &&
+      engine->ctx.paintHints.compositingOperator == COMPOSITE_SRC_OVER &&
+      engine->ctx.rasterHints.opacity == engine->ctx.fullOpacity.u &&
+      d->isSrcOver)
   {
-    PointI dPos(targetBBox.x0, targetBBox.y0);
-    RectI sRect(0, 0, image->getWidth(), image->getHeight());
-    engine->doCmd->blitNormalizedImageA(engine, &dPos, &image, &sRect);
-    image.destroy();
+    return RasterPaintEngine_doPicture(engine, d, clipBox);
   }
 
-  return ERR_OK;
+  return RasterPaintEngine_paintPictureLayer(engine, d);
 }
 
 // ============================================================================
@@ -5310,8 +6860,8 @@ static err_t FOG_CDECL RasterPaintEngine_flush(Painter* self, uint32_t flags)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
 
-  // TODO: MT version.
-  return ERR_OK;
+  // Commands recorded inside a group are rendered by paintGroup().
+  return engine->flushMT();
 }
 
 // ============================================================================
@@ -5339,7 +6889,9 @@ RasterPaintEngine::RasterPaintEngine() :
   pcPool(NULL),
   groupAllocator(500),
   curGroup(&topGroup),
+  pictureDepth(0),
   cmdAllocator(16300),
+  wm(NULL),
   maxThreads(0),
   finalizing(0)
 {
@@ -5371,11 +6923,13 @@ RasterPaintEngine::RasterPaintEngine() :
 
 RasterPaintEngine::~RasterPaintEngine()
 {
+  stopMT();
+
   if (ctx.target.imageData)
     ctx.target.imageData->locked--;
 
+  discardGroups();
   discardStates(NULL);
-  // TODO: Discard also groups.
   discardSource();
 
   stroker.f.destroy();
@@ -5391,7 +6945,11 @@ err_t RasterPaintEngine::init(const ImageBits& imageBits, ImageData* imaged, uin
   ctx.target.format = imageBits.getFormat();
 
   ctx.target.imageData = imaged;
-  if (imaged) imaged->locked++;
+  if (imaged)
+  {
+    imaged->locked++;
+    imaged->resetMipmap();
+  }
 
   vtable = &RasterPaintEngine_vtable[ctx.target.precision];
   doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
@@ -5402,13 +6960,91 @@ err_t RasterPaintEngine::init(const ImageBits& imageBits, ImageData* imaged, uin
   setupOps();
   setupDefaultClip();
 
+  if (initFlags & PAINTER_INIT_MT)
+    FOG_RETURN_ON_ERROR(startMT());
+
   return ERR_OK;
 }
 
 err_t RasterPaintEngine::switchTo(const ImageBits& imageBits, ImageData* imaged)
 {
-  // TODO.
-  return ERR_RT_NOT_IMPLEMENTED;
+  // Render everything recorded for the current target.
+  FOG_RETURN_ON_ERROR(flushMT());
+
+  // Groups, states and source are discarded, the allocators, pools and the
+  // stroker objects are kept.
+  discardGroups();
+  discardStates(NULL);
+  discardSource();
+
+  ctx.solid.prgb32.u32 = 0xFF000000;
+  ctx.solid.prgb64.u64 = FOG_UINT64_C(0xFFFF000000000000);
+  ctx.pc = (RasterPattern*)(size_t)0x1;
+
+  // Setup the primary group.
+  if (imaged)
+  {
+    imaged->locked++;
+    imaged->resetMipmap();
+  }
+  if (ctx.target.imageData) ctx.target.imageData->locked--;
+
+  ctx.target.pixels = imageBits.getData();
+  ctx.target.size = imageBits.getSize();
+  ctx.target.stride = imageBits.getStride();
+  ctx.target.format = imageBits.getFormat();
+  ctx.target.imageData = imaged;
+
+  ctx.target.setup();
+  FOG_RETURN_ON_ERROR(ctx._initPrecision(ctx.target.precision));
+
+  vtable = &RasterPaintEngine_vtable[ctx.target.precision];
+
+  // Reset the base states to the defaults used by a new engine.
+  masterFlags = 0;
+  masterLayerId = 0;
+  masterMaskId = 0;
+  masterMaskSaved = 0;
+  savedStateFlags = 0xFF;
+
+  strokerPrecision = RASTER_PRECISION_NONE;
+  stroker.f->_params->reset();
+  stroker.f->_transform->reset();
+  stroker.f->_isDirty = true;
+  stroker.d->_params->reset();
+  stroker.d->_transform->reset();
+  stroker.d->_isDirty = true;
+
+  integralTransformType = RASTER_INTEGRAL_TRANSFORM_SIMPLE;
+  integralTransform._sx = 1;
+  integralTransform._sy = 1;
+  integralTransform._tx = 0;
+  integralTransform._ty = 0;
+
+  metaTransformD.reset();
+  userTransformD.reset();
+
+  setupOps();
+  setupDefaultClip();
+
+  // The worker manager splits the target into bands for each batch, so it can
+  // be kept if the new target is still suitable for multithreading.
+  if (wm != NULL)
+  {
+    if (ctx.precision != IMAGE_PRECISION_BYTE ||
+        ctx.target.size.w * ctx.target.size.h < RASTER_MIN_SIZE_THRESHOLD ||
+        wm->numWorkers > (uint)ctx.target.size.h)
+    {
+      stopMT();
+    }
+    else
+    {
+      masterFlags |= RASTER_PENDING_BASE_FLAGS | RASTER_PENDING_SOURCE;
+    }
+  }
+
+  doCmd = &RasterPaintDoRender_vtable[getMode()];
+  return ERR_OK;
 }
 
 // ============================================================================
@@ -5417,7 +7053,105 @@ err_t RasterPaintEngine::switchTo(const ImageBits& imageBits, ImageData* imaged)
 
 uint RasterPaintEngine::detectMaxThreads()
 {
-  return Math::max<uint>(Cpu::get()->getNumberOfProcessors(), RASTER_MAX_THREADS_SUGGESTED);
+  return Math::min<uint>(Cpu::get()->getNumberOfProcessors(), RASTER_MAX_THREADS_SUGGESTED);
+}
+
+// ============================================================================
+// [Fog::RasterPaintEngine - Multithreading]
+// ============================================================================
+
+err_t RasterPaintEngine::startMT()
+{
+  if (wm != NULL)
+    return ERR_OK;
+
+  // Multithreading is not used for small targets, the cost of synchronization
+  // is higher than the gain in such case.
+  uint numThreads = Math::min<uint>(maxThreads, RASTER_MAX_THREADS_LIMIT);
+  if (numThreads < 2 ||
+      ctx.precision != IMAGE_PRECISION_BYTE ||
+      ctx.target.size.w * ctx.target.size.h < RASTER_MIN_SIZE_THRESHOLD)
+  {
+    return ERR_OK;
+  }
+
+  // Don't create more bands than scanlines.
+  if (numThreads > (uint)ctx.target.size.h)
+    numThreads = (uint)ctx.target.size.h;
+
+  RasterPaintWorkMgr* mgr = fog_new RasterPaintWorkMgr(this);
+  if (FOG_IS_NULL(mgr))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  err_t err = mgr->init(numThreads);
+  if (FOG_IS_ERROR(err))
+  {
+    fog_delete(mgr);
+
+    // Not having threads is not an error, we just stay in single-threaded mode.
+    return err == ERR_RT_OUT_OF_THREADS ? (err_t)ERR_OK : err;
+  }
+
+  wm = mgr;
+
+  // All states must be serialized into the first batch.
+  masterFlags |= RASTER_PENDING_BASE_FLAGS | RASTER_PENDING_SOURCE;
+
+  if (curGroup == &topGroup)
+    doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_MT];
+  else
+    doCmd = &RasterPaintDoGroup_vtable[RASTER_MODE_MT];
+
+  return ERR_OK;
+}
+
+void RasterPaintEngine::stopMT()
+{
+  if (wm == NULL)
+    return;
+
+  // Can't fail when finalizing; if the batch can't be rendered then its
+  // commands are at least destroyed.
+  flushMT();
+
+  fog_delete(wm);
+  wm = NULL;
+
+  if (curGroup == &topGroup)
+    doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+  else
+    doCmd = &RasterPaintDoGroup_vtable[RASTER_MODE_ST];
+}
+
+err_t RasterPaintEngine::flushMT()
+{
+  if (wm == NULL || !wm->hasBatch())
+    return ERR_OK;
+
+  // There is never a group while the batch is recorded.
+  FOG_ASSERT(curGroup == &topGroup);
+
+  // The batch is destroyed even if a worker failed, the error is returned
+  // after the engine is ready to record the next batch.
+  err_t err = wm->run();
+
+#if defined(FOG_BUILD_PROFILER)
+  for (uint i = 0; i < wm->numWorkers; i++)
+    ctx.profile.merge(wm->workers[i]->engine.ctx.profile);
+#endif // FOG_BUILD_PROFILER
+
+  // Destroy the commands and reuse the allocator for the next batch.
+  RasterPaintEngine_doCommands<false, true>(this, wm->cmdStart, wm->cmdEnd);
+  cmdAllocator.clear();
+
+  wm->cmdStart = NULL;
+  wm->cmdEnd = NULL;
+  wm->numCommands = 0;
+
+  // Workers are initialized by the master context for each batch, all states
+  // must be serialized again.
+  masterFlags |= RASTER_PENDING_BASE_FLAGS | RASTER_PENDING_SOURCE;
+  return err;
 }
 
 // ============================================================================
@@ -5519,10 +7253,10 @@ void RasterPaintEngine::saveSourceAndDiscard()
         MemOps::copy_t<GradientD>(&state->source.gradient, &source.gradient);
 
 _SaveSourceContinue:
+        // The source is moved into the state, including the reference of
+        // the pattern-context (ctx.pc is always overwritten by the caller).
         state->source.transform.initCustom1(source.transform());
         state->pc = ctx.pc;
-        if (state->pc != NULL)
-          state->pc->_reference.inc();
         break;
 
       default:
@@ -5594,7 +7328,7 @@ void RasterPaintEngine::saveClipping()
       break;
 
     case RASTER_CLIP_MASK:
-      // TODO: RasterPaintEngine - clip-mask.
+      state->clipMask = ctx.clipMask->addRef();
       break;
 
     default:
@@ -5710,7 +7444,7 @@ _SaveSourceContinue:
       break;
 
     case RASTER_CLIP_MASK:
-      // TODO: RasterPaintEngine - clip-mask.
+      state->clipMask = ctx.clipMask->addRef();
       break;
 
     default:
@@ -5789,7 +7523,7 @@ _DiscardSourceContinue:
           break;
 
         case RASTER_CLIP_MASK:
-          // TODO: RasterPaintEngine - clip-mask.
+          cur->clipMask->release();
           break;
           
         default:
@@ -5797,6 +7531,10 @@ _DiscardSourceContinue:
       }
     }
 
+    // The flags of the previous state are stored in the discarded one, the
+    // same way as done by restore().
+    savedStateFlags = cur->savedStateFlags;
+
     last = cur;
     cur = cur->prevState;
   } while (cur != top);
@@ -5808,6 +7546,27 @@ _DiscardSourceContinue:
   state = top;
 }
 
+void RasterPaintEngine::discardGroups()
+{
+  if (curGroup == &topGroup)
+    return;
+
+  // Nested groups record into the same command allocator, all commands
+  // recorded after the outermost group was created belong to groups.
+  RasterPaintGroup* g = curGroup;
+  while (g->top != &topGroup)
+    g = g->top;
+
+  RasterPaintEngine_doCommands<false, true>(this, g->cmdStart, cmdAllocator._pos);
+
+  cmdAllocator.revert(g->cmdRecord);
+  groupAllocator.revert(g->groupRecord);
+
+  curGroup = &topGroup;
+  pictureDepth = 0;
+  doCmd = &RasterPaintDoRender_vtable[getMode()];
+}
+
 // ============================================================================
 // [Fog::RasterPaintEngine - Setup]
 // ============================================================================
@@ -5823,6 +7582,7 @@ void RasterPaintEngine::setupOps()
   ctx.paintHints.fastLine = 0;
   ctx.paintHints.geometricPrecision = GEOMETRIC_PRECISION_NORMAL;
   ctx.paintHints.fillRule = FILL_RULE_DEFAULT;
+  ctx.paintHints.pathRasterizer = PATH_RASTERIZER_DEFAULT;
 
   ctx.rasterHints.packed = 0;
   ctx.rasterHints.opacity = ctx.fullOpacity.u;
@@ -5851,6 +7611,7 @@ void RasterPaintEngine::setupDefaultClip()
 
   ctx.clipType = RASTER_CLIP_BOX;
   ctx.clipRegion.clear();
+  ctx.resetClipMask();
   ctx.clipBoxI = bounds;
   stroker.f->_clipBox.setBox(bounds);
   stroker.d->_clipBox.setBox(bounds);
@@ -5875,17 +7636,32 @@ err_t RasterPaintEngine::createPatternContext()
 
   err_t err = ERR_RT_NOT_IMPLEMENTED;
 
-  // First try to reuse context from context-pool.
-  RasterPattern* pc = reinterpret_cast<RasterPattern*>(pcPool);
+  RasterPattern* pc;
 
-  if (FOG_IS_NULL(pc))
+  if (pictureDepth == 0)
   {
-    pc = reinterpret_cast<RasterPattern*>(pcAllocator.alloc(sizeof(RasterPattern)));
-    if (FOG_IS_NULL(pc)) return ERR_RT_OUT_OF_MEMORY;
+    // First try to reuse context from context-pool.
+    pc = reinterpret_cast<RasterPattern*>(pcPool);
+
+    if (FOG_IS_NULL(pc))
+    {
+      pc = reinterpret_cast<RasterPattern*>(pcAllocator.alloc(sizeof(RasterPattern)));
+      if (FOG_IS_NULL(pc)) return ERR_RT_OUT_OF_MEMORY;
+    }
+    else
+    {
+      pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc)->next;
+    }
+
+    pc->_isRetained = false;
   }
   else
   {
-    pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc)->next;
+    // Pattern-context used by a picture can outlive the paint-engine.
+    pc = reinterpret_cast<RasterPattern*>(MemMgr::alloc(sizeof(RasterPattern)));
+    if (FOG_IS_NULL(pc)) return ERR_RT_OUT_OF_MEMORY;
+
+    pc->_isRetained = true;
   }
 
   ctx.pc = pc;
@@ -5931,8 +7707,15 @@ err_t RasterPaintEngine::createPatternContext()
 
   if (FOG_IS_ERROR(err))
   {
-    reinterpret_cast<RasterAbstractLinkedList*>(pc)->next = pcPool;
-    pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc);
+    if (pc->_isRetained)
+    {
+      MemMgr::free(pc);
+    }
+    else
+    {
+      reinterpret_cast<RasterAbstractLinkedList*>(pc)->next = pcPool;
+      pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc);
+    }
     ctx.pc = NULL;
   }
 
@@ -5961,6 +7744,7 @@ void RasterPaintEngine::changedMetaParams()
     ctx.clipType = RASTER_CLIP_BOX;
     ctx.clipBoxI.reset();
     ctx.clipRegion.clear();
+    ctx.resetClipMask();
   }
   else
   {
@@ -5983,6 +7767,8 @@ void RasterPaintEngine::changedMetaParams()
       ctx.clipBoxI = metaClipBoxI;
       ctx.clipRegion.clear();
     }
+
+    ctx.resetClipMask();
   }
 
   metaTransformD._type = (metaOrigin.x | metaOrigin.y) == 0 
@@ -6110,8 +7896,8 @@ static err_t RasterPaintEngine_prepareToImage(ImageBits& imageBits, Image& image
   if (rect)
   {
     imageBits._size.set(rect->w, rect->h);
-    imageBits._data += rect->h * imageBits._stride +
-                       rect->w * image.getBytesPerPixel();
+    imageBits._data += rect->y * imageBits._stride +
+                       rect->x * image.getBytesPerPixel();
   }
 
   return ERR_OK;
@@ -6132,8 +7918,8 @@ static err_t RasterPaintEngine_prepareToImage(ImageBits& imageBits, const ImageB
   if (rect)
   {
     imageBits._size.set(rect->w, rect->h);
-    imageBits._data += rect->h * imageBits._stride +
-                       rect->w * ImageFormatDescription::getByFormat(imageBits._format).getBytesPerPixel();
+    imageBits._data += rect->y * imageBits._stride +
+                       rect->x * ImageFormatDescription::getByFormat(imageBits._format).getBytesPerPixel();
   }
 
   return ERR_OK;
@@ -6238,11 +8024,17 @@ static err_t FOG_CDECL RasterPaintEngine_switchToImage(Painter* self, Image* ima
   // If we know that the paint engine is RASTER then we use switchTo() instead
   // of beginImage(), because there can be a lot of cache objects already
   // initialized, thus they can be used.
-  if (deviceId == PAINT_DEVICE_IMAGE)
-    return static_cast<RasterPaintEngine*>(self->_engine)->switchTo(imageBits, image->_d);
-  else
+  if (deviceId != PAINT_DEVICE_IMAGE)
     return fog_api.painter_beginImage(self, image, rect, NO_FLAGS);
 
+  err = static_cast<RasterPaintEngine*>(self->_engine)->switchTo(imageBits, image->_d);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
+
+  // The vtable depends on the target precision.
+  self->_vtable = self->_engine->vtable;
+  return ERR_OK;
+
 _Fail:
   self->end();
   return err;
@@ -6262,11 +8054,17 @@ static err_t FOG_CDECL RasterPaintEngine_switchToIBits(Painter* self, const Imag
   if (FOG_IS_ERROR(err))
     goto _Fail;
 
-  if (deviceId == PAINT_DEVICE_IMAGE)
-    return static_cast<RasterPaintEngine*>(self->_engine)->switchTo(imageBits, NULL);
-  else
+  if (deviceId != PAINT_DEVICE_IMAGE)
     return fog_api.painter_beginIBits(self, _imageBits, rect, NO_FLAGS);
 
+  err = static_cast<RasterPaintEngine*>(self->_engine)->switchTo(imageBits, NULL);
+  if (FOG_IS_ERROR(err))
+    goto _Fail;
+
+  // The vtable depends on the target precision.
+  self->_vtable = self->_engine->vtable;
+  return ERR_OK;
+
 _Fail:
   self->end();
   return err;
@@ -6482,6 +8280,14 @@ static void RasterPaintEngine_init_vtable_t()
   v->beginGroup = RasterPaintEngine_beginGroup;
   v->paintGroup = RasterPaintEngine_paintGroup;
 
+  // --------------------------------------------------------------------------
+  // [Picture]
+  // --------------------------------------------------------------------------
+
+  v->beginPicture = RasterPaintEngine_beginPicture;
+  v->endPicture = RasterPaintEngine_endPicture;
+  v->paintPicture = RasterPaintEngine_paintPicture;
+
   // --------------------------------------------------------------------------
   // [Flush]
   // --------------------------------------------------------------------------
@@ -6507,6 +8313,12 @@ FOG_NO_EXPORT void RasterPaintEngine_init(void)
   fog_api.painter_switchToImage = RasterPaintEngine_switchToImage;
   fog_api.painter_switchToIBits = RasterPaintEngine_switchToIBits;
 
+  // --------------------------------------------------------------------------
+  // [Picture - API]
+  // --------------------------------------------------------------------------
+
+  fog_api.picture_dFree = RasterPaintEngine_freePicture;
+
   // --------------------------------------------------------------------------
   // [RasterPaintEngine - Init]
   // --------------------------------------------------------------------------
@@ -6520,6 +8332,24 @@ FOG_NO_EXPORT void RasterPaintEngine_init(void)
   // --------------------------------------------------------------------------
 
   FOG_CPU_USE_INITIALIZER_SSE2( RasterPaintEngine_init_SSE2() )
+
+  // --------------------------------------------------------------------------
+  // [RasterGlyphCache]
+  // --------------------------------------------------------------------------
+
+  RasterGlyphCache_oInstance.init();
+
+  // --------------------------------------------------------------------------
+  // [RasterLayerPool]
+  // --------------------------------------------------------------------------
+
+  RasterLayerPool_oInstance.init();
+}
+
+FOG_NO_EXPORT void RasterPaintEngine_fini(void)
+{
+  RasterLayerPool_oInstance.destroy();
+  RasterGlyphCache_oInstance.destroy();
 }
 
 } // Fog namespace
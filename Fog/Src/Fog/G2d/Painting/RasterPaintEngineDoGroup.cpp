@@ -50,7 +50,6 @@ FOG_NO_EXPORT RasterPaintDoCmd RasterPaintDoGroup_vtable[RASTER_MODE_COUNT];
 static err_t FOG_FASTCALL RasterPaintDoGroup_processPendingFlags(RasterPaintEngine* engine, uint32_t pending)
 {
   FOG_ASSERT(pending != 0);
-  engine->masterFlags ^= pending;
 
   if (pending & RASTER_PENDING_SOURCE)
   {
@@ -102,20 +101,27 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_processPendingFlags(RasterPaintEngi
         return ERR_RT_OUT_OF_MEMORY;
       cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_BOX, engine->ctx.clipBoxI);
     }
-    else
+    else if (clipType == RASTER_CLIP_REGION)
     {
       RasterPaintCmd_SetClipRegion* cmd = engine->newCmd<RasterPaintCmd_SetClipRegion>();
       if (FOG_IS_NULL(cmd))
         return ERR_RT_OUT_OF_MEMORY;
       cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_REGION, engine->ctx.clipRegion);
     }
+    else
+    {
+      RasterPaintCmd_SetClipMask* cmd = engine->newCmd<RasterPaintCmd_SetClipMask>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_MASK, engine->ctx.clipMask);
+    }
   }
 
   if (pending & RASTER_PENDING_STROKE_PARAMS)
   {
   }
 
-  engine->masterFlags ^= pending;
+  engine->masterFlags &= ~pending;
   return ERR_OK;
 }
 
@@ -291,6 +297,51 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedPathD(
   return ERR_OK;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Fill - NormalizedGlyphs]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedGlyphs(
+  RasterPaintEngine* engine, const RasterGlyphItem8* items, size_t length, const BoxI* box)
+{
+  _SERIALIZE_PENDING_FLAGS_FILL();
+
+  RasterPaintCmd_FillNormalizedGlyphs* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedGlyphs>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  FOG_RETURN_ON_ERROR(cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS, items, length, *box));
+
+  engine->curGroup->mergeBoundingBox(box->x0, box->y0, box->x1, box->y1);
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Draw - NormalizedHairline]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoGroup_drawNormalizedHairlineF(
+  RasterPaintEngine* engine, const PathF* path)
+{
+  BoxF boundingBox;
+  FOG_RETURN_ON_ERROR(path->getBoundingBox(boundingBox));
+
+  _SERIALIZE_PENDING_FLAGS_FILL();
+
+  RasterPaintCmd_DrawNormalizedHairlineF* cmd = engine->newCmd<RasterPaintCmd_DrawNormalizedHairlineF>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F,
+    *path, engine->dummyPointF, FILL_RULE_NON_ZERO);
+
+  // The hairline covers pixels up to one pixel from the path.
+  engine->curGroup->mergeBoundingBox(
+    Math::ifloor(boundingBox.x0) - 1,
+    Math::ifloor(boundingBox.y0) - 1,
+    Math::iceil(boundingBox.x1) + 1,
+    Math::iceil(boundingBox.y1) + 1);
+  return ERR_OK;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoGroup - Blit - Image]
 // ============================================================================
@@ -524,6 +575,13 @@ void FOG_NO_EXPORT RasterPaintDoGroup_init(void)
   v->fillNormalizedBoxD = RasterPaintDoGroup_fillNormalizedBoxD;
   v->fillNormalizedPathF = RasterPaintDoGroup_fillNormalizedPathF;
   v->fillNormalizedPathD = RasterPaintDoGroup_fillNormalizedPathD;
+  v->fillNormalizedGlyphs = RasterPaintDoGroup_fillNormalizedGlyphs;
+
+  // --------------------------------------------------------------------------
+  // [Draw]
+  // --------------------------------------------------------------------------
+
+  v->drawNormalizedHairlineF = RasterPaintDoGroup_drawNormalizedHairlineF;
 
   // --------------------------------------------------------------------------
   // [Blit]
@@ -559,6 +617,14 @@ void FOG_NO_EXPORT RasterPaintDoGroup_init(void)
   v->maskNormalizedBoxD = RasterPaintDoGroup_maskNormalizedBoxD;
   v->maskNormalizedPathF = RasterPaintDoGroup_maskNormalizedPathF;
   v->maskNormalizedPathD = RasterPaintDoGroup_maskNormalizedPathD;
+
+  // --------------------------------------------------------------------------
+  // [MT]
+  // --------------------------------------------------------------------------
+
+  // Groups are always recorded and rendered by the master thread, the batch
+  // of the multithreaded mode is flushed before the group is created.
+  RasterPaintDoGroup_vtable[RASTER_MODE_MT] = RasterPaintDoGroup_vtable[RASTER_MODE_ST];
 }
 
 } // Fog namespace
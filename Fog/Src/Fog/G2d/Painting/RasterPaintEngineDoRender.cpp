@@ -28,6 +28,8 @@
 #include <Fog/G2d/Painting/RasterPaintContext_p.h>
 #include <Fog/G2d/Painting/RasterPaintEngine_p.h>
 #include <Fog/G2d/Painting/RasterPaintStructs_p.h>
+#include <Fog/G2d/Painting/RasterPaintWorker_p.h>
+#include <Fog/G2d/Painting/RasterProfile_p.h>
 #include <Fog/G2d/Painting/RasterScanline_p.h>
 #include <Fog/G2d/Painting/RasterSpan_p.h>
 #include <Fog/G2d/Painting/RasterUtil_p.h>
@@ -210,6 +212,169 @@ static void FOG_FASTCALL RasterPaintFiller_skip_filter(RasterPaintFiller* self,
   self->f.srcPixels += self->f.srcStride * step;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - Filler - Band]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler which forwards only scanlines inside the context band.
+//!
+//! Used by the multithreaded paint-engine for shapes which can't be clipped
+//! to the band before rasterization without changing the result (the covers
+//! of 24x8 boxes depend on the first/last scanline of the box).
+struct FOG_NO_EXPORT RasterPaintBandFiller : public RasterFiller
+{
+  //! @brief The wrapped filler.
+  RasterFiller* filler;
+
+  //! @brief Current scanline (rasterizer).
+  int y;
+  //! @brief Current scanline (wrapped filler), -1 if not prepared yet.
+  int yFiller;
+
+  int bandY0;
+  int bandY1;
+};
+
+static void FOG_FASTCALL RasterPaintBandFiller_prepare(RasterPaintBandFiller* self, int y)
+{
+  self->y = y;
+  self->yFiller = -1;
+}
+
+static void FOG_FASTCALL RasterPaintBandFiller_process(RasterPaintBandFiller* self, RasterSpan8* spans)
+{
+  int y = self->y++;
+
+  if (y < self->bandY0 || y >= self->bandY1)
+    return;
+
+  if (self->yFiller == -1)
+    self->filler->prepare(y);
+  else if (self->yFiller != y)
+    self->filler->skip(y - self->yFiller);
+
+  self->filler->process(spans);
+  self->yFiller = y + 1;
+}
+
+static void FOG_FASTCALL RasterPaintBandFiller_skip(RasterPaintBandFiller* self, int step)
+{
+  self->y += step;
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - Filler - Profile]
+// ============================================================================
+
+#if defined(FOG_BUILD_PROFILER)
+//! @internal
+//!
+//! @brief Filler which counts spans and pixels passed to the wrapped filler.
+struct FOG_NO_EXPORT RasterPaintProfileFiller : public RasterFiller
+{
+  //! @brief The wrapped filler.
+  RasterFiller* filler;
+
+  //! @brief Counters.
+  PaintProfile* counters;
+  //! @brief Pixel counter of the current compositing operator and format.
+  uint64_t* pixels;
+};
+
+static void FOG_FASTCALL RasterPaintProfileFiller_prepare(RasterPaintProfileFiller* self, int y)
+{
+  self->filler->prepare(y);
+}
+
+static void FOG_FASTCALL RasterPaintProfileFiller_process(RasterPaintProfileFiller* self, RasterSpan8* spans)
+{
+  RasterSpan8* s = spans;
+  uint64_t count = 0;
+  uint64_t pixels = 0;
+
+  do {
+    count++;
+    pixels += (uint)(s->getX1() - s->getX0());
+    s = s->getNext();
+  } while (s != NULL);
+
+  self->counters->spans += count;
+  self->pixels[0] += pixels;
+
+  self->filler->process(spans);
+}
+
+static void FOG_FASTCALL RasterPaintProfileFiller_skip(RasterPaintProfileFiller* self, int step)
+{
+  self->filler->skip(step);
+}
+#endif // FOG_BUILD_PROFILER
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - Band]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Clip the rows of finalized path rasterizer to the context band.
+//!
+//! Each row of the path rasterizer is independent, so the result of the
+//! clipped render is the same as the result of the full render within the
+//! band.
+static FOG_INLINE bool RasterPaintDoRender_clipToBand(RasterPaintEngine* engine, PathRasterizer8* rasterizer)
+{
+  BoxI& bBox = rasterizer->_boundingBox;
+
+  if (bBox.y0 < engine->ctx.bandY0) bBox.y0 = engine->ctx.bandY0;
+  if (bBox.y1 > engine->ctx.bandY1) bBox.y1 = engine->ctx.bandY1;
+
+  return bBox.y0 < bBox.y1;
+}
+
+static FOG_INLINE void RasterPaintDoRender_render8(RasterPaintEngine* engine, Rasterizer8* rasterizer, RasterFiller* filler, bool bandFilter)
+{
+  _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_COMPOSITE);
+
+#if defined(FOG_BUILD_PROFILER)
+  RasterPaintProfileFiller profileFiller;
+
+  if (engine->ctx.profile.enabled)
+  {
+    profileFiller._prepare = (RasterFiller::PrepareFunc)RasterPaintProfileFiller_prepare;
+    profileFiller._process = (RasterFiller::ProcessFunc)RasterPaintProfileFiller_process;
+    profileFiller._skip = (RasterFiller::SkipFunc)RasterPaintProfileFiller_skip;
+
+    profileFiller.filler = filler;
+    profileFiller.counters = &engine->ctx.profile.counters;
+    profileFiller.pixels = &engine->ctx.profile.counters.pixels
+      [engine->ctx.paintHints.compositingOperator][engine->ctx.target.format];
+
+    filler = &profileFiller;
+  }
+#endif // FOG_BUILD_PROFILER
+
+  if (!bandFilter)
+  {
+    rasterizer->render(filler, &engine->ctx.scanline8);
+  }
+  else
+  {
+    RasterPaintBandFiller bandFiller;
+
+    bandFiller._prepare = (RasterFiller::PrepareFunc)RasterPaintBandFiller_prepare;
+    bandFiller._process = (RasterFiller::ProcessFunc)RasterPaintBandFiller_process;
+    bandFiller._skip = (RasterFiller::SkipFunc)RasterPaintBandFiller_skip;
+
+    bandFiller.filler = filler;
+    bandFiller.bandY0 = engine->ctx.bandY0;
+    bandFiller.bandY1 = engine->ctx.bandY1;
+
+    rasterizer->render(&bandFiller, &engine->ctx.scanline8);
+  }
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - PrepareRasterizer]
 // ============================================================================
@@ -229,19 +394,39 @@ static void FOG_INLINE RasterPaintDoRender_prepareRasterizer(RasterPaintEngine*
       break;
 
     case RASTER_CLIP_MASK:
-      // TODO: RasterPaintEngine - clip-mask.
+    {
+      const RasterClipMask8* mask = engine->ctx.clipMask;
+      rasterizer->setClipMask(mask->getBoundingBox().y0, mask->getBoundingBox().y1, mask->getRows());
       break;
+    }
 
     default:
       FOG_ASSERT_NOT_REACHED();
   }
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - RasterizePath]
+// ============================================================================
+
+template<typename PathT, typename PointT>
+static FOG_INLINE void RasterPaintDoRender_rasterizePath(RasterPaintEngine* engine, PathRasterizer8* rasterizer, const PathT* path, const PointT* pt)
+{
+  {
+    _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_RASTERIZE);
+
+    rasterizer->addPath(*path, *pt);
+    rasterizer->finalize();
+  }
+
+  _FOG_RASTER_PROFILE_PATH(engine->ctx, *path, rasterizer);
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - FillRasterizedShape]
 // ============================================================================
 
-static err_t FOG_FASTCALL RasterPaintDoRender_fillRasterizedShape8(RasterPaintEngine* engine, Rasterizer8* rasterizer)
+static err_t FOG_FASTCALL RasterPaintDoRender_fillRasterizedShape8(RasterPaintEngine* engine, Rasterizer8* rasterizer, bool bandFilter = false)
 {
   RasterPaintFiller filler;
 
@@ -267,7 +452,7 @@ _Solid:
     filler.c.closure = &engine->ctx.closure;
     filler.c.solid = &engine->ctx.solid;
 
-    rasterizer->render(&filler, &engine->ctx.scanline8);
+    RasterPaintDoRender_render8(engine, rasterizer, &filler, bandFilter);
   }
   else
   {
@@ -288,12 +473,27 @@ _Solid:
     filler.v.pc = engine->ctx.pc;
     filler.v.pb = &engine->ctx.buffer;
 
-    rasterizer->render(&filler, &engine->ctx.scanline8);
+    RasterPaintDoRender_render8(engine, rasterizer, &filler, bandFilter);
   }
 
   return ERR_OK;
 }
 
+static err_t FOG_FASTCALL RasterPaintDoRender_fillRasterizedBox8(RasterPaintEngine* engine, BoxRasterizer8* rasterizer)
+{
+  if (!rasterizer->_initialized)
+    return ERR_OK;
+
+  int y0 = rasterizer->_boxBounds.y0;
+  int y1 = rasterizer->_boxBounds.y1;
+
+  if (y0 >= engine->ctx.bandY1 || y1 <= engine->ctx.bandY0)
+    return ERR_OK;
+
+  return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer,
+    y0 < engine->ctx.bandY0 || y1 > engine->ctx.bandY1);
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - FillAll]
 // ============================================================================
@@ -317,6 +517,12 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxI(
   {
     case IMAGE_PRECISION_BYTE:
     {
+      int y0 = Math::max<int>(box->y0, engine->ctx.bandY0);
+      int y1 = Math::min<int>(box->y1, engine->ctx.bandY1);
+
+      if (y0 >= y1)
+        return ERR_OK;
+
       // Fast-path (clip-box and full-opacity).
       if (engine->ctx.rasterHints.opacity == 0x100 && engine->ctx.clipType == RASTER_CLIP_BOX)
       {
@@ -325,10 +531,11 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxI(
         uint32_t dstFormat = engine->ctx.target.format;
         uint32_t compositingOperator = engine->ctx.paintHints.compositingOperator;
 
-        int y0 = box->y0;
-
         int w = box->x1 - box->x0;
-        int i = box->y1 - box->y0;
+        int i = y1 - y0;
+
+        _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_COMPOSITE);
+        _FOG_RASTER_PROFILE_PIXELS(engine->ctx, w, i);
 
         dstPixels += y0 * dstStride;
 
@@ -395,7 +602,7 @@ _Solid:
         BoxRasterizer8* rasterizer = &engine->ctx.boxRasterizer8;
         RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
-        rasterizer->init32x0(*box);
+        rasterizer->init32x0(BoxI(box->x0, y0, box->x1, y1));
         return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
       }
     }
@@ -414,6 +621,23 @@ _Solid:
   return ERR_RT_INVALID_STATE;
 }
 
+//! @internal
+//!
+//! @brief Fill the unaligned box using @c RENDER_QUALITY_ALIASED, pixels
+//! which centers are inside the box are filled (the same as done by
+//! @c AliasedRasterizer8).
+static FOG_INLINE err_t RasterPaintDoRender_fillAliasedBox8(
+  RasterPaintEngine* engine, const BoxI& box24x8)
+{
+  BoxI boxI((box24x8.x0 + 127) >> 8, (box24x8.y0 + 127) >> 8,
+            (box24x8.x1 + 127) >> 8, (box24x8.y1 + 127) >> 8);
+
+  if (!boxI.isValid())
+    return ERR_OK;
+
+  return engine->doCmd->fillNormalizedBoxI(engine, &boxI);
+}
+
 static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxF(
   RasterPaintEngine* engine, const BoxF* box)
 {
@@ -433,11 +657,14 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxF(
         return engine->doCmd->fillNormalizedBoxI(engine, &boxI);
       }
 
+      if (engine->ctx.paintHints.renderQuality == RENDER_QUALITY_ALIASED)
+        return RasterPaintDoRender_fillAliasedBox8(engine, box24x8);
+
       BoxRasterizer8* rasterizer = &engine->ctx.boxRasterizer8;
       RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
       rasterizer->init24x8(box24x8);
-      return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
+      return RasterPaintDoRender_fillRasterizedBox8(engine, rasterizer);
     }
 
     case IMAGE_PRECISION_WORD:
@@ -473,11 +700,14 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxD(
         return engine->doCmd->fillNormalizedBoxI(engine, &boxI);
       }
 
+      if (engine->ctx.paintHints.renderQuality == RENDER_QUALITY_ALIASED)
+        return RasterPaintDoRender_fillAliasedBox8(engine, box24x8);
+
       BoxRasterizer8* rasterizer = &engine->ctx.boxRasterizer8;
       RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
       rasterizer->init24x8(box24x8);
-      return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
+      return RasterPaintDoRender_fillRasterizedBox8(engine, rasterizer);
     }
 
     case IMAGE_PRECISION_WORD:
@@ -498,6 +728,97 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxD(
 // [Fog::RasterPaintDoRender - FillNormalizedPath]
 // ============================================================================
 
+template<typename PathT, typename PointT>
+static err_t RasterPaintDoRender_fillAliasedPath8(RasterPaintEngine* engine, const PathT* path, const PointT* pt, uint32_t fillRule)
+{
+  BoxI bBox(engine->ctx.clipBoxI);
+
+  if (bBox.y0 < engine->ctx.bandY0) bBox.y0 = engine->ctx.bandY0;
+  if (bBox.y1 > engine->ctx.bandY1) bBox.y1 = engine->ctx.bandY1;
+
+  if (bBox.y0 >= bBox.y1)
+    return ERR_OK;
+
+  AliasedRasterizer8 rasterizer;
+  RasterPaintDoRender_prepareRasterizer(engine, &rasterizer);
+
+  {
+    _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_RASTERIZE);
+    FOG_RETURN_ON_ERROR(rasterizer.init(*path, *pt, fillRule, bBox));
+  }
+
+  if (!rasterizer._initialized)
+    return ERR_OK;
+
+  return RasterPaintDoRender_fillRasterizedShape8(engine, &rasterizer);
+}
+
+//! @internal
+//!
+//! @brief Get whether to fill @a path using @c DensePathRasterizer8.
+//!
+//! The dense rasterizer sweeps the whole bounding-box of the path, so it's
+//! only used by default for paths which have many vertices in a small area
+//! (many cells per pixel), see RASTER_DENSE_* constants.
+template<typename BoxT, typename PathT, typename PointT>
+static bool RasterPaintDoRender_useDensePath8(RasterPaintEngine* engine, const PathT* path, const PointT* pt)
+{
+  switch (engine->ctx.paintHints.pathRasterizer)
+  {
+    case PATH_RASTERIZER_CELL:
+      return false;
+
+    case PATH_RASTERIZER_DENSE:
+      return true;
+
+    default:
+      break;
+  }
+
+  size_t length = path->getLength();
+  if (length < RASTER_DENSE_MIN_VERTICES)
+    return false;
+
+  BoxT bBox(UNINITIALIZED);
+  if (FOG_IS_ERROR(path->getBoundingBox(bBox)))
+    return false;
+
+  const BoxI& clipBox = engine->ctx.clipBoxI;
+
+  double w = Math::min<double>(double(bBox.x1) + pt->x, clipBox.x1) - Math::max<double>(double(bBox.x0) + pt->x, clipBox.x0);
+  double h = Math::min<double>(double(bBox.y1) + pt->y, engine->ctx.bandY1) - Math::max<double>(double(bBox.y0) + pt->y, engine->ctx.bandY0);
+
+  if (w <= 0.0 || h <= 0.0 || w > double(RASTER_DENSE_MAX_WIDTH))
+    return false;
+
+  return w * h < double(length) * double(RASTER_DENSE_AREA_PER_VERTEX);
+}
+
+template<typename PathT, typename PointT>
+static err_t RasterPaintDoRender_fillDensePath8(RasterPaintEngine* engine, const PathT* path, const PointT* pt, uint32_t fillRule)
+{
+  BoxI bBox(engine->ctx.clipBoxI);
+
+  if (bBox.y0 < engine->ctx.bandY0) bBox.y0 = engine->ctx.bandY0;
+  if (bBox.y1 > engine->ctx.bandY1) bBox.y1 = engine->ctx.bandY1;
+
+  if (bBox.y0 >= bBox.y1)
+    return ERR_OK;
+
+  DensePathRasterizer8* rasterizer = &engine->ctx.densePathRasterizer8;
+  RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
+
+  {
+    _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_RASTERIZE);
+    FOG_RETURN_ON_ERROR(rasterizer->init(*path, *pt, fillRule, bBox));
+  }
+
+  if (!rasterizer->_initialized)
+    return ERR_OK;
+
+  return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
+}
+
 static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathF(
   RasterPaintEngine* engine, const PathF* path, const PointF* pt, uint32_t fillRule)
 {
@@ -505,6 +826,12 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathF(
   {
     case IMAGE_PRECISION_BYTE:
     {
+      if (engine->ctx.paintHints.renderQuality == RENDER_QUALITY_ALIASED)
+        return RasterPaintDoRender_fillAliasedPath8(engine, path, pt, fillRule);
+
+      if (RasterPaintDoRender_useDensePath8<BoxF>(engine, path, pt))
+        return RasterPaintDoRender_fillDensePath8(engine, path, pt, fillRule);
+
       PathRasterizer8* rasterizer = &engine->ctx.pathRasterizer8;
       RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
@@ -512,10 +839,9 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathF(
       if (FOG_IS_ERROR(rasterizer->init()))
         return rasterizer->getError();
 
-      rasterizer->addPath(*path, *pt);
-      rasterizer->finalize();
+      RasterPaintDoRender_rasterizePath(engine, rasterizer, path, pt);
 
-      if (rasterizer->isValid())
+      if (rasterizer->isValid() && RasterPaintDoRender_clipToBand(engine, rasterizer))
         return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
       else
         return ERR_OK;
@@ -542,6 +868,12 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathD(
   {
     case IMAGE_PRECISION_BYTE:
     {
+      if (engine->ctx.paintHints.renderQuality == RENDER_QUALITY_ALIASED)
+        return RasterPaintDoRender_fillAliasedPath8(engine, path, pt, fillRule);
+
+      if (RasterPaintDoRender_useDensePath8<BoxD>(engine, path, pt))
+        return RasterPaintDoRender_fillDensePath8(engine, path, pt, fillRule);
+
       PathRasterizer8* rasterizer = &engine->ctx.pathRasterizer8;
       RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
@@ -549,10 +881,9 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathD(
       if (FOG_IS_ERROR(rasterizer->init()))
         return rasterizer->getError();
 
-      rasterizer->addPath(*path, *pt);
-      rasterizer->finalize();
+      RasterPaintDoRender_rasterizePath(engine, rasterizer, path, pt);
 
-      if (rasterizer->isValid())
+      if (rasterizer->isValid() && RasterPaintDoRender_clipToBand(engine, rasterizer))
         return RasterPaintDoRender_fillRasterizedShape8(engine, rasterizer);
       else
         return ERR_OK;
@@ -572,6 +903,96 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedPathD(
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - FillNormalizedGlyphs]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedGlyphs(
+  RasterPaintEngine* engine, const RasterGlyphItem8* items, size_t length, const BoxI* box)
+{
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      BoxI bBox(*box);
+
+      if (bBox.y0 < engine->ctx.bandY0) bBox.y0 = engine->ctx.bandY0;
+      if (bBox.y1 > engine->ctx.bandY1) bBox.y1 = engine->ctx.bandY1;
+
+      if (bBox.y0 >= bBox.y1)
+        return ERR_OK;
+
+      GlyphRasterizer8 rasterizer;
+      RasterPaintDoRender_prepareRasterizer(engine, &rasterizer);
+
+      rasterizer.init(items, length, bBox);
+      if (!rasterizer._initialized)
+        return ERR_OK;
+
+      return RasterPaintDoRender_fillRasterizedShape8(engine, &rasterizer);
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - DrawNormalizedHairline]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_drawNormalizedHairlineF(
+  RasterPaintEngine* engine, const PathF* path)
+{
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      BoxI bBox(engine->ctx.clipBoxI);
+
+      if (bBox.y0 < engine->ctx.bandY0) bBox.y0 = engine->ctx.bandY0;
+      if (bBox.y1 > engine->ctx.bandY1) bBox.y1 = engine->ctx.bandY1;
+
+      if (bBox.y0 >= bBox.y1)
+        return ERR_OK;
+
+      HairlineRasterizer8 rasterizer;
+      RasterPaintDoRender_prepareRasterizer(engine, &rasterizer);
+
+      {
+        _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_RASTERIZE);
+        FOG_RETURN_ON_ERROR(rasterizer.init(*path, bBox));
+      }
+
+      if (!rasterizer._initialized)
+        return ERR_OK;
+
+      return RasterPaintDoRender_fillRasterizedShape8(engine, &rasterizer);
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - BlitImage]
 // ============================================================================
@@ -651,12 +1072,29 @@ static err_t FOG_FASTCALL RasterPaintDoRender_blitNormalizedImageA(
 
         int x0 = pt->x;
         int y0 = pt->y;
+        int y1 = y0 + srcHeight;
+        FOG_ASSERT(y1 <= engine->ctx.target.size.h);
+
+        int srcY = srcFragment->y;
+        if (y0 < engine->ctx.bandY0)
+        {
+          srcY += engine->ctx.bandY0 - y0;
+          y0 = engine->ctx.bandY0;
+        }
+
+        if (y1 > engine->ctx.bandY1)
+          y1 = engine->ctx.bandY1;
+
+        if (y0 >= y1)
+          return ERR_OK;
+
+        int i = y1 - y0;
 
-        int i = srcHeight;
-        FOG_ASSERT(y0 + srcHeight <= engine->ctx.target.size.h);
+        _FOG_RASTER_PROFILE_SCOPE(engine->ctx, RASTER_PROFILE_COMPOSITE);
+        _FOG_RASTER_PROFILE_PIXELS(engine->ctx, srcWidth, i);
 
         pixels += y0 * stride;
-        srcPixels += srcFragment->y * srcStride;
+        srcPixels += srcY * srcStride;
 
         if (opacity == 0x100)
         {
@@ -771,6 +1209,12 @@ _BlitImageA8_Alpha:
         RasterPaintDoRender_prepareRasterizer(engine, rasterizer);
 
         BoxI box(pt->x, pt->y, pt->x + srcFragment->w, pt->y + srcFragment->h);
+        if (box.y0 < engine->ctx.bandY0) box.y0 = engine->ctx.bandY0;
+        if (box.y1 > engine->ctx.bandY1) box.y1 = engine->ctx.bandY1;
+
+        if (box.y0 >= box.y1)
+          return ERR_OK;
+
         rasterizer->init32x0(box);
 
         RasterPattern* old = engine->ctx.pc;
@@ -1135,8 +1579,7 @@ static err_t FOG_FASTCALL RasterPaintDoRender_filterNormalizedPathF(
       if (FOG_IS_ERROR(rasterizer->init()))
         return rasterizer->getError();
 
-      rasterizer->addPath(*path, *pt);
-      rasterizer->finalize();
+      RasterPaintDoRender_rasterizePath(engine, rasterizer, path, pt);
 
       if (rasterizer->isValid())
         return RasterPaintDoRender_filterRasterizedShape8(engine, feBase, rasterizer, &rasterizer->_boundingBox);
@@ -1172,8 +1615,7 @@ static err_t FOG_FASTCALL RasterPaintDoRender_filterNormalizedPathD(
       if (FOG_IS_ERROR(rasterizer->init()))
         return rasterizer->getError();
 
-      rasterizer->addPath(*path, *pt);
-      rasterizer->finalize();
+      RasterPaintDoRender_rasterizePath(engine, rasterizer, path, pt);
 
       if (rasterizer->isValid())
         return RasterPaintDoRender_filterRasterizedShape8(engine, feBase, rasterizer, &rasterizer->_boundingBox);
@@ -1265,6 +1707,425 @@ static err_t FOG_FASTCALL RasterPaintDoRender_maskNormalizedPathD(RasterPaintEng
   return ERR_RT_NOT_IMPLEMENTED;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Pending]
+// ============================================================================
+
+// The multithreaded mode records commands (the same commands as used by the
+// group recorder) and renders them by workers at synchronization points. Each
+// batch starts with the states serialized, because each worker context is
+// initialized by the master context when the batch is rendered.
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtSerializePending(RasterPaintEngine* engine, uint32_t pending)
+{
+  FOG_ASSERT(pending != 0);
+  FOG_RETURN_ON_ERROR(engine->wm->beginBatch());
+
+  if (pending & RASTER_PENDING_SOURCE)
+  {
+    if (RasterUtil::isSolidContext(engine->ctx.pc))
+    {
+      RasterPaintCmd_SetOpacityAndPrgb32* cmd = engine->newCmd<RasterPaintCmd_SetOpacityAndPrgb32>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_OPACITY_AND_PRGB32, engine->ctx.rasterHints.opacity, engine->ctx.solid.prgb32.u32);
+    }
+    else
+    {
+      _FOG_RASTER_ENSURE_PATTERN(engine);
+
+      RasterPaintCmd_SetOpacityAndPattern* cmd = engine->newCmd<RasterPaintCmd_SetOpacityAndPattern>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_OPACITY_AND_PATTERN, engine->ctx.rasterHints.opacity, engine->ctx.pc);
+    }
+  }
+  else if (pending & RASTER_PENDING_OPACITY)
+  {
+    RasterPaintCmd_SetOpacity* cmd = engine->newCmd<RasterPaintCmd_SetOpacity>();
+    if (FOG_IS_NULL(cmd))
+      return ERR_RT_OUT_OF_MEMORY;
+    cmd->init(engine, RASTER_PAINT_CMD_SET_OPACITY, engine->ctx.rasterHints.opacity);
+  }
+
+  if (pending & RASTER_PENDING_PAINT_HINTS)
+  {
+    RasterPaintCmd_SetPaintHints* cmd = engine->newCmd<RasterPaintCmd_SetPaintHints>();
+    if (FOG_IS_NULL(cmd))
+      return ERR_RT_OUT_OF_MEMORY;
+    cmd->init(engine, RASTER_PAINT_CMD_SET_PAINT_HINTS, engine->ctx.paintHints);
+  }
+
+  if (pending & RASTER_PENDING_CLIP)
+  {
+    if (engine->ctx.clipType == RASTER_CLIP_BOX)
+    {
+      RasterPaintCmd_SetClipBox* cmd = engine->newCmd<RasterPaintCmd_SetClipBox>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_BOX, engine->ctx.clipBoxI);
+    }
+    else if (engine->ctx.clipType == RASTER_CLIP_REGION)
+    {
+      RasterPaintCmd_SetClipRegion* cmd = engine->newCmd<RasterPaintCmd_SetClipRegion>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_REGION, engine->ctx.clipRegion);
+    }
+    else
+    {
+      RasterPaintCmd_SetClipMask* cmd = engine->newCmd<RasterPaintCmd_SetClipMask>();
+      if (FOG_IS_NULL(cmd))
+        return ERR_RT_OUT_OF_MEMORY;
+      cmd->init(engine, RASTER_PAINT_CMD_SET_CLIP_MASK, engine->ctx.clipMask);
+    }
+  }
+
+  // Transform and stroke parameters are not needed, all recorded commands
+  // are normalized.
+  engine->masterFlags &= ~pending;
+  return ERR_OK;
+}
+
+#define _FOG_RASTER_MT_SERIALIZE(_Flags_) \
+  FOG_MACRO_BEGIN \
+    uint32_t pending = engine->masterFlags & (_Flags_); \
+    \
+    if (pending != 0) \
+    { \
+      FOG_RETURN_ON_ERROR(RasterPaintDoRender_mtSerializePending(engine, pending)); \
+    } \
+    else \
+    { \
+      FOG_RETURN_ON_ERROR(engine->wm->beginBatch()); \
+    } \
+  FOG_MACRO_END
+
+#define _FOG_RASTER_MT_SERIALIZE_FILL() \
+  _FOG_RASTER_MT_SERIALIZE(RASTER_PENDING_BASE_FLAGS | RASTER_PENDING_SOURCE)
+
+#define _FOG_RASTER_MT_SERIALIZE_BLIT() \
+  _FOG_RASTER_MT_SERIALIZE(RASTER_PENDING_BASE_FLAGS)
+
+// Limit the count of commands in a batch, so the pattern contexts and paths
+// referenced by the commands are released in a reasonable time.
+#define _FOG_RASTER_MT_RECORDED() \
+  FOG_MACRO_BEGIN \
+    if (++engine->wm->numCommands >= RASTER_MAX_COMMANDS) \
+      return engine->flushMT(); \
+    return ERR_OK; \
+  FOG_MACRO_END
+
+// Operations which can't be recorded are rendered by the master thread after
+// the current batch was rendered by workers.
+#define _FOG_RASTER_MT_RENDER_ST(_Call_) \
+  FOG_MACRO_BEGIN \
+    FOG_RETURN_ON_ERROR(engine->flushMT()); \
+    \
+    engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST]; \
+    err_t err = _Call_; \
+    engine->doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_MT]; \
+    \
+    return err; \
+  FOG_MACRO_END
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Fill]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillAll(
+  RasterPaintEngine* engine)
+{
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillAll* cmd = engine->newCmd<RasterPaintCmd_FillAll>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_ALL);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedBoxI(
+  RasterPaintEngine* engine, const BoxI* box)
+{
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedBoxI* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedBoxI>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_I, *box);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedBoxF(
+  RasterPaintEngine* engine, const BoxF* box)
+{
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedBoxF* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedBoxF>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_F, *box);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedBoxD(
+  RasterPaintEngine* engine, const BoxD* box)
+{
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedBoxD* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedBoxD>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_D, *box);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedPathF(
+  RasterPaintEngine* engine, const PathF* path, const PointF* pt, uint32_t fillRule)
+{
+  // Calculate (and cache) the bounding-box here, workers only read it.
+  BoxF boundingBox(UNINITIALIZED);
+  if (path->getBoundingBox(boundingBox) != ERR_OK)
+    return ERR_OK;
+
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedPathF* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedPathF>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F, *path, *pt, fillRule);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedPathD(
+  RasterPaintEngine* engine, const PathD* path, const PointD* pt, uint32_t fillRule)
+{
+  BoxD boundingBox(UNINITIALIZED);
+  if (path->getBoundingBox(boundingBox) != ERR_OK)
+    return ERR_OK;
+
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedPathD* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedPathD>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D, *path, *pt, fillRule);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFillNormalizedGlyphs(
+  RasterPaintEngine* engine, const RasterGlyphItem8* items, size_t length, const BoxI* box)
+{
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_FillNormalizedGlyphs* cmd = engine->newCmd<RasterPaintCmd_FillNormalizedGlyphs>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  FOG_RETURN_ON_ERROR(cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS, items, length, *box));
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Draw]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtDrawNormalizedHairlineF(
+  RasterPaintEngine* engine, const PathF* path)
+{
+  // Calculate (and cache) the bounding-box here, workers only read it.
+  BoxF boundingBox(UNINITIALIZED);
+  if (path->getBoundingBox(boundingBox) != ERR_OK)
+    return ERR_OK;
+
+  _FOG_RASTER_MT_SERIALIZE_FILL();
+
+  RasterPaintCmd_DrawNormalizedHairlineF* cmd = engine->newCmd<RasterPaintCmd_DrawNormalizedHairlineF>();
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+  cmd->init(engine, RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F, *path, engine->dummyPointF, FILL_RULE_NON_ZERO);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Blit]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtBlitImageD(
+  RasterPaintEngine* engine, const BoxD* box, const Image* srcImage, const RectI* srcFragment, const TransformD* srcTransform, uint32_t imageQuality)
+{
+  // Uses a temporary pattern context, which can't be recorded.
+  _FOG_RASTER_MT_RENDER_ST(
+    RasterPaintDoRender_blitImageD(engine, box, srcImage, srcFragment, srcTransform, imageQuality));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtBlitNormalizedImageA(
+  RasterPaintEngine* engine, const PointI* pt, const Image* srcImage, const RectI* srcFragment)
+{
+  _FOG_RASTER_MT_SERIALIZE_BLIT();
+
+  ImageData* srcD = srcImage->_d;
+
+  if (srcFragment->x == 0 &&
+      srcFragment->y == 0 &&
+      srcFragment->w == srcD->size.w &&
+      srcFragment->h == srcD->size.h)
+  {
+    RasterPaintCmd_BlitNormalizedImageA* cmd =
+      engine->newCmd<RasterPaintCmd_BlitNormalizedImageA>();
+
+    if (FOG_IS_NULL(cmd))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A,
+      *pt, *srcImage);
+  }
+  else
+  {
+    RasterPaintCmd_BlitNormalizedImageFragmentA* cmd =
+      engine->newCmd<RasterPaintCmd_BlitNormalizedImageFragmentA>();
+
+    if (FOG_IS_NULL(cmd))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_FRAGMENT_A,
+      *pt, *srcImage, *srcFragment);
+  }
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtBlitNormalizedImageI(
+  RasterPaintEngine* engine, const BoxI* box, const Image* srcImage, const RectI* srcFragment, const TransformD* srcTransform, uint32_t imageQuality)
+{
+  _FOG_RASTER_MT_SERIALIZE_BLIT();
+
+  RasterPaintCmd_BlitNormalizedImageI* cmd =
+    engine->newCmd<RasterPaintCmd_BlitNormalizedImageI>();
+
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I,
+    *box, *srcImage, *srcFragment, *srcTransform, imageQuality);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtBlitNormalizedImageD(
+  RasterPaintEngine* engine, const BoxD* box, const Image* srcImage, const RectI* srcFragment, const TransformD* srcTransform, uint32_t imageQuality)
+{
+  _FOG_RASTER_MT_SERIALIZE_BLIT();
+
+  RasterPaintCmd_BlitNormalizedImageD* cmd =
+    engine->newCmd<RasterPaintCmd_BlitNormalizedImageD>();
+
+  if (FOG_IS_NULL(cmd))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D,
+    *box, *srcImage, *srcFragment, *srcTransform, imageQuality);
+
+  _FOG_RASTER_MT_RECORDED();
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Filter]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFilterNormalizedBoxI(
+  RasterPaintEngine* engine, const FeBase* feBase, const BoxI* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_filterNormalizedBoxI(engine, feBase, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFilterNormalizedBoxF(
+  RasterPaintEngine* engine, const FeBase* feBase, const BoxF* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_filterNormalizedBoxF(engine, feBase, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFilterNormalizedBoxD(
+  RasterPaintEngine* engine, const FeBase* feBase, const BoxD* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_filterNormalizedBoxD(engine, feBase, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFilterNormalizedPathF(
+  RasterPaintEngine* engine, const FeBase* feBase, const PathF* path, const PointF* pt, uint32_t fillRule)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_filterNormalizedPathF(engine, feBase, path, pt, fillRule));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtFilterNormalizedPathD(
+  RasterPaintEngine* engine, const FeBase* feBase, const PathD* path, const PointD* pt, uint32_t fillRule)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_filterNormalizedPathD(engine, feBase, path, pt, fillRule));
+}
+
+// ============================================================================
+// [Fog::RasterPaintDoRender - MT - Mask]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtSwitchToMask(RasterPaintEngine* engine)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_switchToMask(engine));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtDiscardMask(RasterPaintEngine* engine)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_discardMask(engine));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtSaveMask(RasterPaintEngine* engine)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_saveMask(engine));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtRestoreMask(RasterPaintEngine* engine)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_restoreMask(engine));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtMaskNormalizedBoxI(RasterPaintEngine* engine, uint32_t clipOp, const BoxI* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_maskNormalizedBoxI(engine, clipOp, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtMaskNormalizedBoxF(RasterPaintEngine* engine, uint32_t clipOp, const BoxF* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_maskNormalizedBoxF(engine, clipOp, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtMaskNormalizedBoxD(RasterPaintEngine* engine, uint32_t clipOp, const BoxD* box)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_maskNormalizedBoxD(engine, clipOp, box));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtMaskNormalizedPathF(RasterPaintEngine* engine, uint32_t clipOp, const PathF* path, uint32_t fillRule)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_maskNormalizedPathF(engine, clipOp, path, fillRule));
+}
+
+static err_t FOG_FASTCALL RasterPaintDoRender_mtMaskNormalizedPathD(RasterPaintEngine* engine, uint32_t clipOp, const PathD* path, uint32_t fillRule)
+{
+  _FOG_RASTER_MT_RENDER_ST(RasterPaintDoRender_maskNormalizedPathD(engine, clipOp, path, fillRule));
+}
+
+#undef _FOG_RASTER_MT_RENDER_ST
+#undef _FOG_RASTER_MT_RECORDED
+#undef _FOG_RASTER_MT_SERIALIZE_BLIT
+#undef _FOG_RASTER_MT_SERIALIZE_FILL
+#undef _FOG_RASTER_MT_SERIALIZE
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - Init]
 // ============================================================================
@@ -1283,6 +2144,13 @@ void FOG_NO_EXPORT RasterPaintDoRender_init(void)
   v->fillNormalizedBoxD = RasterPaintDoRender_fillNormalizedBoxD;
   v->fillNormalizedPathF = RasterPaintDoRender_fillNormalizedPathF;
   v->fillNormalizedPathD = RasterPaintDoRender_fillNormalizedPathD;
+  v->fillNormalizedGlyphs = RasterPaintDoRender_fillNormalizedGlyphs;
+
+  // --------------------------------------------------------------------------
+  // [Draw]
+  // --------------------------------------------------------------------------
+
+  v->drawNormalizedHairlineF = RasterPaintDoRender_drawNormalizedHairlineF;
 
   // --------------------------------------------------------------------------
   // [Blit]
@@ -1317,6 +2185,44 @@ void FOG_NO_EXPORT RasterPaintDoRender_init(void)
   v->maskNormalizedBoxD = RasterPaintDoRender_maskNormalizedBoxD;
   v->maskNormalizedPathF = RasterPaintDoRender_maskNormalizedPathF;
   v->maskNormalizedPathD = RasterPaintDoRender_maskNormalizedPathD;
+
+  // --------------------------------------------------------------------------
+  // [MT]
+  // --------------------------------------------------------------------------
+
+  v = &RasterPaintDoRender_vtable[RASTER_MODE_MT];
+
+  v->fillAll = RasterPaintDoRender_mtFillAll;
+  v->fillNormalizedBoxI = RasterPaintDoRender_mtFillNormalizedBoxI;
+  v->fillNormalizedBoxF = RasterPaintDoRender_mtFillNormalizedBoxF;
+  v->fillNormalizedBoxD = RasterPaintDoRender_mtFillNormalizedBoxD;
+  v->fillNormalizedPathF = RasterPaintDoRender_mtFillNormalizedPathF;
+  v->fillNormalizedPathD = RasterPaintDoRender_mtFillNormalizedPathD;
+  v->fillNormalizedGlyphs = RasterPaintDoRender_mtFillNormalizedGlyphs;
+
+  v->drawNormalizedHairlineF = RasterPaintDoRender_mtDrawNormalizedHairlineF;
+
+  v->blitImageD = RasterPaintDoRender_mtBlitImageD;
+  v->blitNormalizedImageA = RasterPaintDoRender_mtBlitNormalizedImageA;
+  v->blitNormalizedImageI = RasterPaintDoRender_mtBlitNormalizedImageI;
+  v->blitNormalizedImageD = RasterPaintDoRender_mtBlitNormalizedImageD;
+
+  v->filterNormalizedBoxI = RasterPaintDoRender_mtFilterNormalizedBoxI;
+  v->filterNormalizedBoxF = RasterPaintDoRender_mtFilterNormalizedBoxF;
+  v->filterNormalizedBoxD = RasterPaintDoRender_mtFilterNormalizedBoxD;
+  v->filterNormalizedPathF = RasterPaintDoRender_mtFilterNormalizedPathF;
+  v->filterNormalizedPathD = RasterPaintDoRender_mtFilterNormalizedPathD;
+
+  v->switchToMask = RasterPaintDoRender_mtSwitchToMask;
+  v->discardMask = RasterPaintDoRender_mtDiscardMask;
+  v->saveMask = RasterPaintDoRender_mtSaveMask;
+  v->restoreMask = RasterPaintDoRender_mtRestoreMask;
+
+  v->maskNormalizedBoxI = RasterPaintDoRender_mtMaskNormalizedBoxI;
+  v->maskNormalizedBoxF = RasterPaintDoRender_mtMaskNormalizedBoxF;
+  v->maskNormalizedBoxD = RasterPaintDoRender_mtMaskNormalizedBoxD;
+  v->maskNormalizedPathF = RasterPaintDoRender_mtMaskNormalizedPathF;
+  v->maskNormalizedPathD = RasterPaintDoRender_mtMaskNormalizedPathD;
 }
 
 } // Fog namespace
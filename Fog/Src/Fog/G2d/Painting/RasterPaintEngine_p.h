@@ -35,6 +35,12 @@ namespace Fog {
 //! @addtogroup Fog_G2d_Painting
 //! @{
 
+// ============================================================================
+// [Forward Declarations]
+// ============================================================================
+
+struct RasterPaintWorkMgr;
+
 // ============================================================================
 // [Fog::RasterPaintEngine]
 // ============================================================================
@@ -64,6 +70,23 @@ struct FOG_NO_EXPORT RasterPaintEngine : public PaintEngine
 
   static uint detectMaxThreads();
 
+  // --------------------------------------------------------------------------
+  // [Multithreading]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the current mode (see @c RASTER_MODE).
+  FOG_INLINE uint32_t getMode() const { return wm != NULL ? RASTER_MODE_MT : RASTER_MODE_ST; }
+
+  //! @brief Switch to multithreaded mode.
+  //!
+  //! Does nothing if the target is too small or if there is only one thread
+  //! available, the engine stays in single-threaded mode in such case.
+  err_t startMT();
+  //! @brief Render all recorded commands and switch to single-threaded mode.
+  void stopMT();
+  //! @brief Render all recorded commands (synchronization point).
+  err_t flushMT();
+
   // --------------------------------------------------------------------------
   // [Clipping]
   // --------------------------------------------------------------------------
@@ -165,6 +188,10 @@ struct FOG_NO_EXPORT RasterPaintEngine : public PaintEngine
 
   void discardStates(RasterPaintState* top);
 
+  //! @brief Discard all groups (including pictures being recorded), the
+  //! recorded commands are destroyed without rendering them.
+  void discardGroups();
+
   // --------------------------------------------------------------------------
   // [Setup]
   // --------------------------------------------------------------------------
@@ -209,6 +236,12 @@ _DiscardContinue:
   {
     pc->destroy();
 
+    if (FOG_UNLIKELY(pc->_isRetained))
+    {
+      MemMgr::free(pc);
+      return;
+    }
+
     reinterpret_cast<RasterAbstractLinkedList*>(pc)->next = pcPool;
     pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc);
   }
@@ -432,6 +465,9 @@ _DiscardContinue:
   RasterPaintGroup topGroup;
   //! @brief Current group.
   RasterPaintGroup* curGroup;
+  //! @brief Count of pictures being recorded (pattern-contexts created while
+  //! recording are retained, see @c RasterPattern::_isRetained).
+  uint32_t pictureDepth;
 
   // --------------------------------------------------------------------------
   // [Members - Commands]
@@ -444,8 +480,8 @@ _DiscardContinue:
   // [Members - Multithreading]
   // --------------------------------------------------------------------------
 
-  // @brief The worker manager.
-  // RasterPaintWorkMgr* wm;
+  //! @brief The worker manager (only used by multithreaded mode).
+  RasterPaintWorkMgr* wm;
 
   //! @brief The maximum number of threads that can be used for rendering after
   //! the multithreading is initialized.
@@ -475,7 +511,19 @@ _DiscardContinue:
 FOG_INLINE void RasterPaintCmd_SetOpacityAndPattern::destroy(RasterPaintEngine* engine)
 {
   if (_pc->_reference.deref())
-    engine->destroyPatternContext(_pc);
+  {
+    // Retained pattern-context can be destroyed without the paint-engine
+    // (engine is NULL when the commands of a @c Picture are destroyed).
+    if (_pc->_isRetained)
+    {
+      _pc->destroy();
+      MemMgr::free(_pc);
+    }
+    else
+    {
+      engine->destroyPatternContext(_pc);
+    }
+  }
   Base::destroy(engine);
 }
 
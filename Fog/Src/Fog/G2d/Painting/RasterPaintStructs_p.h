@@ -19,6 +19,7 @@
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Painting/PaintParams.h>
 #include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterClipMask_p.h>
 #include <Fog/G2d/Painting/RasterConstants_p.h>
 #include <Fog/G2d/Painting/RasterSpan_p.h>
 #include <Fog/G2d/Painting/RasterStructs_p.h>
@@ -404,6 +405,8 @@ struct FOG_NO_EXPORT RasterPaintState
 
   //! @brief The clip-region.
   Static<Region> clipRegion;
+  //! @brief The clip-mask (only used by @c RASTER_CLIP_MASK).
+  RasterClipMask8* clipMask;
 
   // ------------------------------------------------------------------------
   // [RASTER_STATE_FILTER]
@@ -435,6 +438,16 @@ struct FOG_NO_EXPORT RasterPaintDoCmd
   err_t (FOG_FASTCALL *fillNormalizedBoxD)(RasterPaintEngine* engine, const BoxD* box);
   err_t (FOG_FASTCALL *fillNormalizedPathF)(RasterPaintEngine* engine, const PathF* path, const PointF* pt, uint32_t fillRule);
   err_t (FOG_FASTCALL *fillNormalizedPathD)(RasterPaintEngine* engine, const PathD* path, const PointD* pt, uint32_t fillRule);
+  err_t (FOG_FASTCALL *fillNormalizedGlyphs)(RasterPaintEngine* engine, const RasterGlyphItem8* items, size_t length, const BoxI* box);
+
+  // --------------------------------------------------------------------------
+  // [Funcs - Draw]
+  // --------------------------------------------------------------------------
+
+  //! @brief Draw a flat path in device space as anti-aliased hairline (used
+  //! by stroke functions if the @c fastLine hint is set and the stroke is an
+  //! ideal line).
+  err_t (FOG_FASTCALL *drawNormalizedHairlineF)(RasterPaintEngine* engine, const PathF* path);
 
   // --------------------------------------------------------------------------
   // [Funcs - Blit]
@@ -0,0 +1,469 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Threading/ThreadPool.h>
+#include <Fog/G2d/Painting/RasterPaintCmd_p.h>
+#include <Fog/G2d/Painting/RasterPaintEngine_p.h>
+#include <Fog/G2d/Painting/RasterPaintWorker_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RasterPaintWorker - Helpers]
+// ============================================================================
+
+static FOG_INLINE bool RasterPaintWorker_isVisible(const RasterPaintContext& ctx, int y0, int y1)
+{
+  return y0 < ctx.bandY1 && y1 > ctx.bandY0;
+}
+
+template<typename NumT>
+static FOG_INLINE bool RasterPaintWorker_isVisible(const RasterPaintContext& ctx, NumT y0, NumT y1)
+{
+  // Conservative, the rasterizer can touch one scanline before/after.
+  return RasterPaintWorker_isVisible(ctx, Math::ifloor(y0) - 1, Math::iceil(y1) + 1);
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorker - Construction / Destruction]
+// ============================================================================
+
+RasterPaintWorker::RasterPaintWorker(RasterPaintWorkMgr* mgr, uint id) :
+  mgr(mgr),
+  id(id),
+  failed(0)
+{
+#if defined(FOG_BUILD_PROFILER)
+  // Thread id 0 is used by the master context.
+  engine.ctx.profile.tid = id + 1;
+#endif // FOG_BUILD_PROFILER
+}
+
+RasterPaintWorker::~RasterPaintWorker()
+{
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorker - Setup]
+// ============================================================================
+
+err_t RasterPaintWorker::setup(int bandY0, int bandY1)
+{
+  RasterPaintEngine* master = mgr->master;
+
+  err_t err = engine.ctx._initByMaster(master->ctx);
+
+  // The target is owned (and locked) by the master engine.
+  engine.ctx.target.imageData = NULL;
+  engine.ctx.setBand(bandY0, bandY1);
+
+  engine.vtable = master->vtable;
+  engine.doCmd = &RasterPaintDoRender_vtable[RASTER_MODE_ST];
+  engine.metaClipBoxI = master->metaClipBoxI;
+
+  engine.stroker.f->_clipBox.setBox(engine.ctx.clipBoxI);
+  engine.stroker.d->_clipBox.setBox(engine.ctx.clipBoxI);
+
+  failed = FOG_IS_ERROR(err);
+  return err;
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorker - Run]
+// ============================================================================
+
+void RasterPaintWorker::run()
+{
+  if (failed || engine.ctx.bandY0 >= engine.ctx.bandY1)
+    return;
+
+  RasterPaintContext& ctx = engine.ctx;
+  const RasterPaintDoCmd* doCmd = engine.doCmd;
+
+  uint8_t* p = mgr->cmdStart;
+  uint8_t* pEnd = mgr->cmdEnd;
+
+  // Commands are shared by all workers, they can't be modified or destroyed
+  // here. Pattern contexts are borrowed (the references are held by commands
+  // until the master destroys the batch).
+  while (p != pEnd)
+  {
+    switch (reinterpret_cast<RasterPaintCmd*>(p)->getCommand())
+    {
+      case RASTER_PAINT_CMD_NULL:
+      default:
+      {
+        FOG_ASSERT_NOT_REACHED();
+        goto _End;
+      }
+
+      case RASTER_PAINT_CMD_NEXT:
+      {
+        RasterPaintCmd_Next* cmd =
+          reinterpret_cast<RasterPaintCmd_Next*>(p);
+        p = cmd->getPtr();
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY:
+      {
+        RasterPaintCmd_SetOpacity* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacity*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacity);
+
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY_AND_PRGB32:
+      {
+        RasterPaintCmd_SetOpacityAndPrgb32* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacityAndPrgb32*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacityAndPrgb32);
+
+        ctx.pc = (RasterPattern*)(size_t)0x1;
+        ctx.solid.prgb32.u32 = cmd->getPrgb32();
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_OPACITY_AND_PATTERN:
+      {
+        RasterPaintCmd_SetOpacityAndPattern* cmd =
+          reinterpret_cast<RasterPaintCmd_SetOpacityAndPattern*>(p);
+        p += sizeof(RasterPaintCmd_SetOpacityAndPattern);
+
+        ctx.pc = cmd->getPatternContext();
+        ctx.rasterHints.opacity = cmd->getOpacity();
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_PAINT_HINTS:
+      {
+        RasterPaintCmd_SetPaintHints* cmd =
+          reinterpret_cast<RasterPaintCmd_SetPaintHints*>(p);
+        p += sizeof(RasterPaintCmd_SetPaintHints);
+
+        ctx.paintHints.packed = cmd->getPaintHints().packed;
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_ALL:
+      {
+        p += sizeof(RasterPaintCmd_FillAll);
+
+        if (RasterPaintWorker_isVisible(ctx, ctx.clipBoxI.y0, ctx.clipBoxI.y1))
+          doCmd->fillAll(&engine);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_I:
+      {
+        RasterPaintCmd_FillNormalizedBoxI* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxI*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxI);
+
+        doCmd->fillNormalizedBoxI(&engine, &cmd->_box());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_F:
+      {
+        RasterPaintCmd_FillNormalizedBoxF* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxF*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxF);
+
+        doCmd->fillNormalizedBoxF(&engine, &cmd->_box());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_D:
+      {
+        RasterPaintCmd_FillNormalizedBoxD* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedBoxD*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedBoxD);
+
+        doCmd->fillNormalizedBoxD(&engine, &cmd->_box());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F:
+      {
+        RasterPaintCmd_FillNormalizedPathF* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedPathF*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedPathF);
+
+        // The bounding-box was calculated (and cached) by the master before
+        // the command was recorded, so this is only a read.
+        BoxF bBox(UNINITIALIZED);
+        const PointF& pt = cmd->getPoint();
+
+        if (cmd->getPath().getBoundingBox(bBox) == ERR_OK &&
+            RasterPaintWorker_isVisible<float>(ctx, bBox.y0 + pt.y, bBox.y1 + pt.y))
+        {
+          doCmd->fillNormalizedPathF(&engine, &cmd->getPath(), &pt, cmd->getFillRule());
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D:
+      {
+        RasterPaintCmd_FillNormalizedPathD* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedPathD*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedPathD);
+
+        BoxD bBox(UNINITIALIZED);
+        const PointD& pt = cmd->getPoint();
+
+        if (cmd->getPath().getBoundingBox(bBox) == ERR_OK &&
+            RasterPaintWorker_isVisible<double>(ctx, bBox.y0 + pt.y, bBox.y1 + pt.y))
+        {
+          doCmd->fillNormalizedPathD(&engine, &cmd->getPath(), &pt, cmd->getFillRule());
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_DRAW_NORMALIZED_HAIRLINE_F:
+      {
+        RasterPaintCmd_DrawNormalizedHairlineF* cmd =
+          reinterpret_cast<RasterPaintCmd_DrawNormalizedHairlineF*>(p);
+        p += sizeof(RasterPaintCmd_DrawNormalizedHairlineF);
+
+        // The hairline covers pixels up to one pixel from the path.
+        BoxF bBox(UNINITIALIZED);
+
+        if (cmd->getPath().getBoundingBox(bBox) == ERR_OK &&
+            RasterPaintWorker_isVisible<float>(ctx, bBox.y0 - 1.0f, bBox.y1 + 1.0f))
+        {
+          doCmd->drawNormalizedHairlineF(&engine, &cmd->getPath());
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_FILL_NORMALIZED_GLYPHS:
+      {
+        RasterPaintCmd_FillNormalizedGlyphs* cmd =
+          reinterpret_cast<RasterPaintCmd_FillNormalizedGlyphs*>(p);
+        p += sizeof(RasterPaintCmd_FillNormalizedGlyphs);
+
+        const BoxI& box = cmd->getBox();
+        if (cmd->getLength() != 0 && RasterPaintWorker_isVisible(ctx, box.y0, box.y1))
+          doCmd->fillNormalizedGlyphs(&engine, cmd->getItems(), cmd->getLength(), &box);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_A:
+      {
+        RasterPaintCmd_BlitNormalizedImageA* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageA*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageA);
+
+        const Image& srcImage = cmd->getSrcImage();
+        RectI srcFragment(0, 0, srcImage.getWidth(), srcImage.getHeight());
+        doCmd->blitNormalizedImageA(&engine, &cmd->getPt(), &srcImage, &srcFragment);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_FRAGMENT_A:
+      {
+        RasterPaintCmd_BlitNormalizedImageFragmentA* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageFragmentA*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageFragmentA);
+
+        doCmd->blitNormalizedImageA(&engine, &cmd->getPt(), &cmd->getSrcImage(), &cmd->getSrcFragment());
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I:
+      {
+        RasterPaintCmd_BlitNormalizedImageI* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageI*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageI);
+
+        const BoxI& box = cmd->getBox();
+        if (RasterPaintWorker_isVisible(ctx, box.y0, box.y1))
+        {
+          doCmd->blitNormalizedImageI(&engine, &box,
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D:
+      {
+        RasterPaintCmd_BlitNormalizedImageD* cmd =
+          reinterpret_cast<RasterPaintCmd_BlitNormalizedImageD*>(p);
+        p += sizeof(RasterPaintCmd_BlitNormalizedImageD);
+
+        const BoxD& box = cmd->getBox();
+        if (RasterPaintWorker_isVisible<double>(ctx, box.y0, box.y1))
+        {
+          doCmd->blitNormalizedImageD(&engine, &box,
+            &cmd->getSrcImage(), &cmd->getSrcFragment(), &cmd->getSrcTransform(), cmd->getImageQuality());
+        }
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_BOX:
+      {
+        RasterPaintCmd_SetClipBox* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipBox*>(p);
+        p += sizeof(RasterPaintCmd_SetClipBox);
+
+        ctx.clipType = RASTER_CLIP_BOX;
+        ctx.clipBoxI = cmd->getClipBox();
+        ctx.resetClipMask();
+
+        engine.stroker.f->_clipBox.setBox(ctx.clipBoxI);
+        engine.stroker.d->_clipBox.setBox(ctx.clipBoxI);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_REGION:
+      {
+        RasterPaintCmd_SetClipRegion* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipRegion*>(p);
+        p += sizeof(RasterPaintCmd_SetClipRegion);
+
+        ctx.clipType = RASTER_CLIP_REGION;
+        ctx.clipRegion = cmd->getClipRegion();
+        ctx.clipBoxI = ctx.clipRegion.getBoundingBox();
+        ctx.resetClipMask();
+
+        engine.stroker.f->_clipBox.setBox(ctx.clipBoxI);
+        engine.stroker.d->_clipBox.setBox(ctx.clipBoxI);
+        break;
+      }
+
+      case RASTER_PAINT_CMD_SET_CLIP_MASK:
+      {
+        RasterPaintCmd_SetClipMask* cmd =
+          reinterpret_cast<RasterPaintCmd_SetClipMask*>(p);
+        p += sizeof(RasterPaintCmd_SetClipMask);
+
+        ctx.setClipMask(cmd->getClipMask()->addRef());
+
+        engine.stroker.f->_clipBox.setBox(ctx.clipBoxI);
+        engine.stroker.d->_clipBox.setBox(ctx.clipBoxI);
+        break;
+      }
+    }
+  }
+
+_End:
+  // Never dereference the borrowed pattern context.
+  ctx.pc = (RasterPattern*)(size_t)0x1;
+  ctx.clipRegion.clear();
+  ctx.resetClipMask();
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorkMgr - Construction / Destruction]
+// ============================================================================
+
+RasterPaintWorkMgr::RasterPaintWorkMgr(RasterPaintEngine* master) :
+  master(master),
+  numWorkers(0),
+  cmdStart(NULL),
+  cmdEnd(NULL),
+  numCommands(0)
+{
+}
+
+RasterPaintWorkMgr::~RasterPaintWorkMgr()
+{
+  FOG_ASSERT(cmdStart == NULL);
+
+  uint i;
+  for (i = 0; i < numWorkers; i++)
+    fog_delete(workers[i]);
+
+  if (numWorkers > 1)
+    ThreadPool::get()->releaseThreads(threads, numWorkers - 1);
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorkMgr - Init]
+// ============================================================================
+
+err_t RasterPaintWorkMgr::init(uint numThreads)
+{
+  FOG_ASSERT(numWorkers == 0);
+  FOG_ASSERT(numThreads >= 2 && numThreads <= RASTER_MAX_THREADS_LIMIT);
+
+  // Get as many threads as possible (the master thread is not pooled).
+  uint numPooled = BandDispatcher::getThreads(threads, numThreads - 1);
+  if (numPooled == 0)
+    return ERR_RT_OUT_OF_THREADS;
+
+  uint i;
+  for (i = 0; i <= numPooled; i++)
+  {
+    workers[i] = fog_new RasterPaintWorker(this, i);
+    if (FOG_IS_NULL(workers[i]))
+      break;
+  }
+
+  if (i <= numPooled)
+  {
+    while (i)
+      fog_delete(workers[--i]);
+
+    ThreadPool::get()->releaseThreads(threads, numPooled);
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  numWorkers = numPooled + 1;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RasterPaintWorkMgr - Run]
+// ============================================================================
+
+static void FOG_CDECL RasterPaintWorkMgr_runWorker(void* data, uint id)
+{
+  static_cast<RasterPaintWorkMgr*>(data)->workers[id]->run();
+}
+
+err_t RasterPaintWorkMgr::run()
+{
+  FOG_ASSERT(cmdStart != NULL);
+
+  cmdEnd = master->cmdAllocator._pos;
+
+  // Split the target into bands. Setup is done by the master thread, because
+  // the master context can't be accessed while workers are running.
+  int h = master->ctx.target.size.h;
+
+  // A worker which failed to setup skips its band, the other bands are still
+  // rendered and the first error is returned.
+  err_t err = ERR_OK;
+
+  uint i;
+  for (i = 0; i < numWorkers; i++)
+  {
+    int y0, y1;
+    BandDispatcher::getBand(h, numWorkers, i, y0, y1);
+
+    err_t e = workers[i]->setup(y0, y1);
+    if (FOG_IS_ERROR(e) && err == ERR_OK)
+      err = e;
+  }
+
+  // The master renders the first band.
+  dispatcher.run(threads, numWorkers, RasterPaintWorkMgr_runWorker, this);
+
+  return err;
+}
+
+} // Fog namespace
@@ -0,0 +1,171 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERPAINTWORKER_P_H
+#define _FOG_G2D_PAINTING_RASTERPAINTWORKER_P_H
+
+// [Dependencies]
+#include <Fog/Core/Threading/BandDispatcher_p.h>
+#include <Fog/Core/Threading/Thread.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/RasterPaintEngine_p.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [Fog::RasterPaintWorker]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Raster paint worker (multithreaded paint-engine).
+//!
+//! Each worker renders the recorded commands into its own horizontal band of
+//! the target. The worker contains a slave @c RasterPaintEngine, which is only
+//! used as a rendering context (the @c ctx member and the single-threaded
+//! @c RasterPaintDoRender functions).
+struct FOG_NO_EXPORT RasterPaintWorker
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterPaintWorker(RasterPaintWorkMgr* mgr, uint id);
+  ~RasterPaintWorker();
+
+  // --------------------------------------------------------------------------
+  // [Setup / Run]
+  // --------------------------------------------------------------------------
+
+  //! @brief Setup the worker context for the next batch (called by the master
+  //! thread before the batch is dispatched).
+  err_t setup(int bandY0, int bandY1);
+
+  //! @brief Render all commands of the current batch in the worker band.
+  void run();
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The worker manager.
+  RasterPaintWorkMgr* mgr;
+  //! @brief The worker id (zero is the master thread).
+  uint id;
+  //! @brief Whether the setup failed (the worker can't render the batch).
+  uint failed;
+
+  //! @brief The slave engine (per-thread context).
+  RasterPaintEngine engine;
+
+private:
+  FOG_NO_COPY(RasterPaintWorker)
+};
+
+// ============================================================================
+// [Fog::RasterPaintWorkMgr]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Raster paint worker manager (multithreaded paint-engine).
+//!
+//! The master engine records commands into its @c cmdAllocator. The recorded
+//! batch is rendered at synchronization points (@c Painter::flush(),
+//! @c Painter::end(), and each operation which can't be recorded), where the
+//! target is split into horizontal bands, one band per worker. The master
+//! thread renders the first band and waits until all other workers finished.
+struct FOG_NO_EXPORT RasterPaintWorkMgr
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterPaintWorkMgr(RasterPaintEngine* master);
+  ~RasterPaintWorkMgr();
+
+  // --------------------------------------------------------------------------
+  // [Init]
+  // --------------------------------------------------------------------------
+
+  //! @brief Acquire threads and create workers, @a numThreads includes the
+  //! master thread.
+  err_t init(uint numThreads);
+
+  // --------------------------------------------------------------------------
+  // [Batch]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool hasBatch() const { return cmdStart != NULL; }
+
+  //! @brief Begin a new batch if not started yet.
+  //!
+  //! The batch always starts at the beginning of @c cmdAllocator, because the
+  //! command allocator is only used by the multithreaded recorder when there
+  //! is no group (groups flush the batch before they are created).
+  FOG_INLINE err_t beginBatch()
+  {
+    if (FOG_LIKELY(cmdStart != NULL))
+      return ERR_OK;
+
+    MemZoneAllocator& allocator = master->cmdAllocator;
+    allocator.clear();
+
+    // Ensure that there is space for RasterPaintCmd_Next, which is required
+    // by RasterPaintEngine::newCmd<>().
+    uint8_t* p = static_cast<uint8_t*>(allocator.alloc(sizeof(RasterPaintCmd_Next)));
+    if (FOG_IS_NULL(p))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    allocator._pos = p;
+    cmdStart = p;
+    return ERR_OK;
+  }
+
+  //! @brief Render the current batch using all workers and wait for them.
+  //!
+  //! Returns the first error of the worker setup, the band of the failed
+  //! worker is not rendered.
+  err_t run();
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The master engine.
+  RasterPaintEngine* master;
+
+  //! @brief Band dispatcher.
+  BandDispatcher dispatcher;
+
+  //! @brief Count of workers (including the master).
+  uint numWorkers;
+
+  //! @brief Start of the current batch (NULL if there is no batch).
+  uint8_t* cmdStart;
+  //! @brief End of the current batch (valid while the batch is rendered).
+  uint8_t* cmdEnd;
+  //! @brief Count of paint commands in the current batch.
+  uint numCommands;
+
+  //! @brief Pooled threads (numWorkers - 1).
+  Thread* threads[RASTER_MAX_THREADS_LIMIT];
+  //! @brief Workers.
+  RasterPaintWorker* workers[RASTER_MAX_THREADS_LIMIT];
+
+private:
+  FOG_NO_COPY(RasterPaintWorkMgr)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERPAINTWORKER_P_H
@@ -0,0 +1,224 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/G2d/Painting/RasterProfile_p.h>
+
+#if defined(FOG_BUILD_PROFILER)
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RasterProfile - Helpers]
+// ============================================================================
+
+static const char RasterProfile_sectionName[RASTER_PROFILE_COUNT][12] =
+{
+  "Stroke",
+  "Clip",
+  "Rasterize",
+  "Composite"
+};
+
+template<typename PathT>
+static FOG_INLINE uint64_t RasterProfile_countSegments(const PathT& path)
+{
+  const uint8_t* cmd = path.getCommands();
+  size_t i = path.getLength();
+  uint64_t segments = 0;
+
+  while (i)
+  {
+    uint c = cmd[0];
+    segments += (c >= PATH_CMD_LINE_TO && c <= PATH_CMD_CLOSE);
+
+    cmd++;
+    i--;
+  }
+
+  return segments;
+}
+
+static uint64_t RasterProfile_countCells(const PathRasterizer8* rasterizer)
+{
+  if (!rasterizer->_isValid)
+    return 0;
+
+  const BoxI& bBox = rasterizer->_boundingBox;
+  uint64_t cells = 0;
+
+  for (int y = bBox.y0; y < bBox.y1; y++)
+  {
+    const PathRasterizer8::Chunk* first = rasterizer->_rowsAdjusted[y].first;
+    const PathRasterizer8::Chunk* chunk = first;
+
+    if (chunk == NULL)
+      continue;
+
+    do {
+      cells += (uint)chunk->getLength();
+      chunk = chunk->next;
+    } while (chunk != first);
+  }
+
+  return cells;
+}
+
+//! @internal
+//!
+//! @brief Grow the events array, returns @c false if the limit was reached or
+//! the memory allocation failed (the event is dropped in such case).
+static bool RasterProfile_grow(RasterProfile* self)
+{
+  size_t newCapacity = self->capacity ? self->capacity * 2 : 1024;
+  if (newCapacity > RASTER_PROFILE_TRACE_LIMIT)
+    return false;
+
+  RasterProfileEvent* newEvents = reinterpret_cast<RasterProfileEvent*>(
+    MemMgr::realloc(self->events, newCapacity * sizeof(RasterProfileEvent)));
+  if (FOG_IS_NULL(newEvents))
+    return false;
+
+  self->events = newEvents;
+  self->capacity = newCapacity;
+  return true;
+}
+
+// ============================================================================
+// [Fog::RasterProfile - Construction / Destruction]
+// ============================================================================
+
+RasterProfile::RasterProfile() :
+  enabled(0),
+  tid(0),
+  events(NULL),
+  length(0),
+  capacity(0)
+{
+  origin = now();
+}
+
+RasterProfile::~RasterProfile()
+{
+  if (events != NULL)
+    MemMgr::free(events);
+}
+
+// ============================================================================
+// [Fog::RasterProfile - Reset]
+// ============================================================================
+
+void RasterProfile::reset()
+{
+  counters.reset();
+  origin = now();
+
+  if (events != NULL)
+    MemMgr::free(events);
+
+  events = NULL;
+  length = 0;
+  capacity = 0;
+}
+
+// ============================================================================
+// [Fog::RasterProfile - Merge]
+// ============================================================================
+
+void RasterProfile::merge(RasterProfile& other)
+{
+  counters += other.counters;
+  other.counters.reset();
+
+  for (size_t i = 0; i < other.length; i++)
+  {
+    if (length == capacity && !RasterProfile_grow(this))
+      break;
+    events[length++] = other.events[i];
+  }
+
+  other.length = 0;
+}
+
+// ============================================================================
+// [Fog::RasterProfile - Add]
+// ============================================================================
+
+void RasterProfile::addTime(uint32_t section, int64_t start)
+{
+  FOG_ASSERT(section < RASTER_PROFILE_COUNT);
+
+  int64_t dur = now() - start;
+
+  switch (section)
+  {
+    case RASTER_PROFILE_STROKE   : counters.strokeTime    += dur; break;
+    case RASTER_PROFILE_CLIP     : counters.clipTime      += dur; break;
+    case RASTER_PROFILE_RASTERIZE: counters.rasterizeTime += dur; break;
+    case RASTER_PROFILE_COMPOSITE: counters.compositeTime += dur; break;
+  }
+
+  if (length == capacity && !RasterProfile_grow(this))
+    return;
+
+  RasterProfileEvent& e = events[length++];
+  e.section = section;
+  e.tid = tid;
+  e.ts = start;
+  e.dur = dur;
+}
+
+void RasterProfile::addPath(const PathF& path, const PathRasterizer8* rasterizer)
+{
+  counters.pathSegments += RasterProfile_countSegments<PathF>(path);
+  counters.cells += RasterProfile_countCells(rasterizer);
+}
+
+void RasterProfile::addPath(const PathD& path, const PathRasterizer8* rasterizer)
+{
+  counters.pathSegments += RasterProfile_countSegments<PathD>(path);
+  counters.cells += RasterProfile_countCells(rasterizer);
+}
+
+// ============================================================================
+// [Fog::RasterProfile - Trace]
+// ============================================================================
+
+err_t RasterProfile::toTrace(StringA& dst) const
+{
+  dst.clear();
+  FOG_RETURN_ON_ERROR(dst.reserve(64 + length * 96));
+  FOG_RETURN_ON_ERROR(dst.append("{\"traceEvents\":["));
+
+  for (size_t i = 0; i < length; i++)
+  {
+    const RasterProfileEvent& e = events[i];
+
+    if (i != 0)
+      dst.append(',');
+
+    dst.append("\n{\"name\":\"");
+    dst.append(RasterProfile_sectionName[e.section]);
+    dst.append("\",\"cat\":\"raster\",\"ph\":\"X\",\"pid\":0,\"tid\":");
+    dst.appendInt(e.tid);
+    dst.append(",\"ts\":");
+    dst.appendInt(e.ts - origin);
+    dst.append(",\"dur\":");
+    dst.appendInt(e.dur);
+    dst.append('}');
+  }
+
+  return dst.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+} // Fog namespace
+
+#endif // FOG_BUILD_PROFILER
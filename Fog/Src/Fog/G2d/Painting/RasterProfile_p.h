@@ -0,0 +1,225 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTERPROFILE_P_H
+#define _FOG_G2D_PAINTING_RASTERPROFILE_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Tools/String.h>
+#include <Fog/Core/Tools/Time.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Painting/PaintParams.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/Rasterizer_p.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Painting
+//! @{
+
+// ============================================================================
+// [_FOG_RASTER_PROFILE]
+// ============================================================================
+
+// The profiler hooks expand to nothing if FOG_BUILD_PROFILER is not defined,
+// so the raster paint-engine has no overhead when the profiler is compiled out.
+//
+// _FOG_RASTER_PROFILE_SCOPE - Time the rest of the current scope.
+// _FOG_RASTER_PROFILE_CALL  - Time the expression _Call_ (which must be
+//                             enclosed in parentheses) and return its result.
+//                             Use it only as a full-expression.
+
+#if defined(FOG_BUILD_PROFILER)
+
+#define _FOG_RASTER_PROFILE_SCOPE(_Ctx_, _Section_) \
+  RasterProfileScope _profileScope(&(_Ctx_).profile, _Section_)
+
+#define _FOG_RASTER_PROFILE_CALL(_Ctx_, _Section_, _Call_) \
+  (RasterProfileScope(&(_Ctx_).profile, _Section_), _Call_)
+
+#define _FOG_RASTER_PROFILE_PATH(_Ctx_, _Path_, _Rasterizer_) \
+  FOG_MACRO_BEGIN \
+    if ((_Ctx_).profile.enabled) \
+      (_Ctx_).profile.addPath(_Path_, _Rasterizer_); \
+  FOG_MACRO_END
+
+#define _FOG_RASTER_PROFILE_PIXELS(_Ctx_, _Width_, _Height_) \
+  FOG_MACRO_BEGIN \
+    if ((_Ctx_).profile.enabled) \
+      (_Ctx_).profile.addPixels((_Ctx_).paintHints.compositingOperator, (_Ctx_).target.format, _Width_, _Height_); \
+  FOG_MACRO_END
+
+#define _FOG_RASTER_PROFILE_LAYER(_Ctx_) \
+  FOG_MACRO_BEGIN \
+    if ((_Ctx_).profile.enabled) \
+      (_Ctx_).profile.counters.groupLayers++; \
+  FOG_MACRO_END
+
+#else
+
+#define _FOG_RASTER_PROFILE_SCOPE(_Ctx_, _Section_) FOG_NOP
+#define _FOG_RASTER_PROFILE_CALL(_Ctx_, _Section_, _Call_) _Call_
+#define _FOG_RASTER_PROFILE_PATH(_Ctx_, _Path_, _Rasterizer_) FOG_NOP
+#define _FOG_RASTER_PROFILE_PIXELS(_Ctx_, _Width_, _Height_) FOG_NOP
+#define _FOG_RASTER_PROFILE_LAYER(_Ctx_) FOG_NOP
+
+#endif // FOG_BUILD_PROFILER
+
+#if defined(FOG_BUILD_PROFILER)
+
+// ============================================================================
+// [Fog::RasterProfileEvent]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Trace event (timed section, see @c RASTER_PROFILE).
+struct FOG_NO_EXPORT RasterProfileEvent
+{
+  //! @brief Section, see @c RASTER_PROFILE.
+  uint32_t section;
+  //! @brief Thread id (0 is the master context, workers start at 1).
+  uint32_t tid;
+  //! @brief Start time (microseconds).
+  int64_t ts;
+  //! @brief Duration (microseconds).
+  int64_t dur;
+};
+
+// ============================================================================
+// [Fog::RasterProfile]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Profile collected by a raster paint context.
+//!
+//! Each context has its own profile, so no synchronization is needed. The
+//! profiles of workers are merged into the master profile after each batch
+//! is rendered (see @c RasterPaintEngine::flushMT()).
+struct FOG_NO_EXPORT RasterProfile
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  RasterProfile();
+  ~RasterProfile();
+
+  // --------------------------------------------------------------------------
+  // [Reset]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reset counters and destroy all events.
+  void reset();
+
+  // --------------------------------------------------------------------------
+  // [Merge]
+  // --------------------------------------------------------------------------
+
+  //! @brief Add counters and events of @a other and reset it.
+  void merge(RasterProfile& other);
+
+  // --------------------------------------------------------------------------
+  // [Add]
+  // --------------------------------------------------------------------------
+
+  //! @brief Add the time of @a section which started at @a start.
+  void addTime(uint32_t section, int64_t start);
+
+  //! @brief Add segments of @a path and cells produced by @a rasterizer.
+  void addPath(const PathF& path, const PathRasterizer8* rasterizer);
+  //! @overload
+  void addPath(const PathD& path, const PathRasterizer8* rasterizer);
+
+  //! @brief Add @a width x @a height pixels composited by @a op to @a format.
+  FOG_INLINE void addPixels(uint32_t op, uint32_t format, int width, int height)
+  {
+    FOG_ASSERT(op < COMPOSITE_COUNT && format < IMAGE_FORMAT_COUNT);
+
+    counters.spans += (uint)height;
+    counters.pixels[op][format] += (uint64_t)(uint)width * (uint)height;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Trace]
+  // --------------------------------------------------------------------------
+
+  //! @brief Serialize events to @a dst (Chrome-trace JSON).
+  err_t toTrace(StringA& dst) const;
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE int64_t now()
+  {
+    return TimeTicks::now(CPU_TICKS_PRECISION_HIGH).getTicks();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Whether the profiler is enabled.
+  uint32_t enabled;
+  //! @brief Thread id stored in trace events.
+  uint32_t tid;
+
+  //! @brief Time of the last reset, used as trace origin (microseconds).
+  int64_t origin;
+
+  //! @brief Counters.
+  PaintProfile counters;
+
+  //! @brief Trace events.
+  RasterProfileEvent* events;
+  //! @brief Count of trace events.
+  size_t length;
+  //! @brief Capacity of @c events.
+  size_t capacity;
+
+private:
+  FOG_NO_COPY(RasterProfile)
+};
+
+// ============================================================================
+// [Fog::RasterProfileScope]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Times the section from construction to destruction.
+struct FOG_NO_EXPORT RasterProfileScope
+{
+  FOG_INLINE RasterProfileScope(RasterProfile* profile, uint32_t section) :
+    _profile(profile->enabled ? profile : NULL),
+    _section(section)
+  {
+    if (_profile != NULL)
+      _start = RasterProfile::now();
+  }
+
+  FOG_INLINE ~RasterProfileScope()
+  {
+    if (_profile != NULL)
+      _profile->addTime(_section, _start);
+  }
+
+  RasterProfile* _profile;
+  uint32_t _section;
+  int64_t _start;
+};
+
+#endif // FOG_BUILD_PROFILER
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTERPROFILE_P_H
@@ -319,6 +319,12 @@ struct FOG_NO_EXPORT RasterPattern
   //! @brief Whether the source is fully-opaque.
   uint16_t _isOpaque;
 
+  //! @brief Whether the pattern-context is retained by a @c Picture.
+  //!
+  //! Retained pattern-contexts are allocated by @c MemMgr instead of the
+  //! paint-engine zone allocator, because they can outlive the paint-engine.
+  uint32_t _isRetained;
+
   //! @brief Bounding box.
   BoxI _boundingBox;
 
@@ -402,6 +408,23 @@ struct FOG_NO_EXPORT RasterPattern
     //int fyrewind;
   };
 
+  struct _TextureProjection
+  {
+    // Homogeneous texture coordinates (U, V, W) of a pixel [x, y] are:
+    //
+    //   U = x * xx + y * yx + tx
+    //   V = x * xy + y * yy + ty
+    //   W = x * xz + y * yz + tz
+    double xx, xy, xz;
+    double yx, yy, yz;
+    double tx, ty, tz;
+
+    double mx, my; // Max X/Y (doubled for REFLECT tiling).
+
+    //! @brief The maximum X/Y in 24.8 fixed point (@c mx and @c my).
+    int mx24x8, my24x8;
+  };
+
   struct _TexturePacked
   {
     _TextureBase base;
@@ -410,6 +433,7 @@ struct FOG_NO_EXPORT RasterPattern
     {
       _TextureSimple simple;
       _TextureAffine affine;
+      _TextureProjection proj;
     };
   };
 
@@ -597,6 +621,15 @@ struct FOG_NO_EXPORT RasterPatternFetcher
   RasterPatternSkipFunc _skip;
 
   uint32_t _mode;
+
+  //! @brief Current scanline.
+  //!
+  //! The position of transformed fetchers is always calculated from the
+  //! scanline instead of being accumulated, see @c _delta.
+  int _y;
+  //! @brief Scanline delta (distance between two fetched scanlines).
+  int _delta;
+
 #if FOG_ARCH_BITS >= 64
   uint32_t _reserved;
 #endif // FOG_ARCH
@@ -616,8 +649,12 @@ struct FOG_NO_EXPORT RasterPatternFetcher
     struct _Affine
     {
       double px, py;
-      double dx, dy;
     } affine;
+
+    struct _Projection
+    {
+      double px, py, pz;
+    } proj;
   };
 
   // --------------------------------------------------------------------------
@@ -629,16 +666,12 @@ struct FOG_NO_EXPORT RasterPatternFetcher
     struct _Simple
     {
       double pt;
-      double dt;
     } simple;
 
     struct _Projection
     {
       double pt;
       double pz;
-
-      double dt;
-      double dz;
     } proj;
   };
 
@@ -648,13 +681,11 @@ struct FOG_NO_EXPORT RasterPatternFetcher
     struct _Simple
     {
       double px, py;
-      double dx, dy;
     } simple;
 
     struct _Projection
     {
       double px, py, pz;
-      double dx, dy, dz;
     } proj;
   };
 
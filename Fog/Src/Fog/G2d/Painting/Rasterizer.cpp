@@ -14,9 +14,12 @@
 #include <Fog/Core/Global/Private.h>
 #include <Fog/Core/Math/Math.h>
 #include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/Threading/Lock.h>
+#include <Fog/Core/Tools/Cpu.h>
 #include <Fog/Core/Tools/Swap.h>
 #include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterGlyphCache_p.h>
 #include <Fog/G2d/Painting/RasterScanline_p.h>
 #include <Fog/G2d/Painting/RasterSpan_p.h>
 #include <Fog/G2d/Painting/RasterStructs_p.h>
@@ -214,6 +217,381 @@ static FOG_INLINE int upscale24x8(double v) { return Math::ifloor(v * (double)25
 
 FOG_NO_EXPORT RasterizerApi Rasterizer_api;
 
+// ============================================================================
+// [Fog::Rasterizer8 - Clip-Mask Filler]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler which intersects the rasterizer output with the clip-mask
+//! and forwards the result into the wrapped filler.
+//!
+//! All clip-mask render functions only wrap the given filler and call the
+//! clip-box version, so the clip-mask costs one multiply per pixel in the
+//! worst case (variant coverage and variant mask). Intersection of two const
+//! spans is const and a fully opaque span forwards the other one without any
+//! per-pixel work.
+struct FOG_NO_EXPORT Rasterizer8ClipMaskFiller : public RasterFiller
+{
+  //! @brief The wrapped filler.
+  RasterFiller* filler;
+  //! @brief The scanline container (used to allocate spans).
+  RasterScanline8* scanline;
+
+  //! @brief Clip-mask scanlines.
+  const RasterSpan8** rows;
+  //! @brief Clip-mask first scanline.
+  int maskY0;
+  //! @brief Clip-mask last scanline (exclusive).
+  int maskY1;
+
+  //! @brief Current scanline.
+  int y;
+  //! @brief Count of scanlines not forwarded to the wrapped filler yet.
+  int pendingSkip;
+
+  //! @brief Storage for the variant spans created by the intersection.
+  uint8_t* buffer;
+  //! @brief Whether the span allocator has to be cleared per scanline (box
+  //! rasterizer doesn't use the scanline container at all).
+  bool clearSpans;
+};
+
+static FOG_INLINE uint32_t Rasterizer8ClipMaskFiller_expandA8(uint32_t m)
+{
+  return m + (m >> 7);
+}
+
+static FOG_INLINE uint32_t Rasterizer8ClipMaskFiller_fetchVariant(uint32_t type, const uint8_t* p, uint i)
+{
+  if (type == RASTER_SPAN_AX_EXTRA)
+    return reinterpret_cast<const uint16_t*>(p)[i];
+  else
+    return Rasterizer8ClipMaskFiller_expandA8(p[i]);
+}
+
+static RasterSpan8* Rasterizer8ClipMaskFiller_intersect(Rasterizer8ClipMaskFiller* self,
+  const RasterSpan8* a, const RasterSpan8* b)
+{
+  RasterScanline8* scanline = self->scanline;
+
+  RasterSpan8 first;
+  RasterSpan8* span = &first;
+  first.setNext(NULL);
+
+  uint8_t* dst = self->buffer;
+
+  for (;;)
+  {
+    int x0 = Math::max<int>(a->getX0(), b->getX0());
+    int x1 = Math::min<int>(a->getX1(), b->getX1());
+
+    if (x0 < x1)
+    {
+      uint aType = a->getType();
+      uint i, w = (uint)(x1 - x0);
+
+      // Mask is always const or A8-glyph.
+      FOG_ASSERT(b->getType() == RASTER_SPAN_C || b->getType() == RASTER_SPAN_A8_GLYPH);
+      // Rasterizers never generate ARGB spans.
+      FOG_ASSERT(aType <= RASTER_SPAN_AX_EXTRA);
+
+      if (aType == RASTER_SPAN_C)
+      {
+        uint32_t ca = a->getConstMask();
+
+        if (b->isConst())
+        {
+          uint32_t m = (ca * b->getConstMask()) >> 8;
+          if (m != 0)
+          {
+            NEW_SPAN(span, return NULL);
+            span->setPositionAndType(x0, x1, RASTER_SPAN_C);
+            span->setConstMask(m);
+          }
+        }
+        else if (ca == 0x100)
+        {
+          NEW_SPAN(span, return NULL);
+          span->setPositionAndType(x0, x1, RASTER_SPAN_A8_GLYPH);
+          span->setA8Glyph(b->getA8Glyph() + (x0 - b->getX0()));
+        }
+        else if (ca != 0)
+        {
+          const uint8_t* bMask = b->getA8Glyph() + (x0 - b->getX0());
+
+          NEW_SPAN(span, return NULL);
+          span->setPositionAndType(x0, x1, RASTER_SPAN_AX_EXTRA);
+          span->setA8Extra(dst);
+
+          for (i = 0; i < w; i++)
+            reinterpret_cast<uint16_t*>(dst)[i] = (uint16_t)((ca * Rasterizer8ClipMaskFiller_expandA8(bMask[i])) >> 8);
+          dst += w * 2;
+        }
+      }
+      else
+      {
+        const uint8_t* aMask = a->getVariantMask() + RasterSpan8::getMaskAdvance(aType, x0 - a->getX0());
+
+        if (b->isConst() && b->isConstMaskOpaque())
+        {
+          NEW_SPAN(span, return NULL);
+          span->setPositionAndType(x0, x1, aType);
+          span->setVariantMask(const_cast<uint8_t*>(aMask));
+        }
+        else
+        {
+          NEW_SPAN(span, return NULL);
+          span->setPositionAndType(x0, x1, RASTER_SPAN_AX_EXTRA);
+          span->setA8Extra(dst);
+
+          if (b->isConst())
+          {
+            uint32_t cb = b->getConstMask();
+            for (i = 0; i < w; i++)
+              reinterpret_cast<uint16_t*>(dst)[i] = (uint16_t)((Rasterizer8ClipMaskFiller_fetchVariant(aType, aMask, i) * cb) >> 8);
+          }
+          else
+          {
+            const uint8_t* bMask = b->getA8Glyph() + (x0 - b->getX0());
+            for (i = 0; i < w; i++)
+              reinterpret_cast<uint16_t*>(dst)[i] = (uint16_t)((Rasterizer8ClipMaskFiller_fetchVariant(aType, aMask, i) *
+                Rasterizer8ClipMaskFiller_expandA8(bMask[i])) >> 8);
+          }
+          dst += w * 2;
+        }
+      }
+    }
+
+    if (a->getX1() <= b->getX1())
+    {
+      if ((a = a->getNext()) == NULL)
+        break;
+    }
+    else
+    {
+      if ((b = b->getNext()) == NULL)
+        break;
+    }
+  }
+
+  span->setNext(NULL);
+  return first.getNext();
+}
+
+static void FOG_FASTCALL Rasterizer8ClipMaskFiller_prepare(Rasterizer8ClipMaskFiller* self, int y)
+{
+  self->y = y;
+  self->pendingSkip = 0;
+  self->filler->prepare(y);
+}
+
+static void FOG_FASTCALL Rasterizer8ClipMaskFiller_process(Rasterizer8ClipMaskFiller* self, RasterSpan8* spans)
+{
+  int y = self->y++;
+  RasterSpan8* result = NULL;
+
+  if (y >= self->maskY0 && y < self->maskY1)
+  {
+    const RasterSpan8* clip = self->rows[y - self->maskY0];
+
+    if (clip != NULL)
+    {
+      if (self->clearSpans)
+        self->scanline->_spanAllocator.clear();
+      result = Rasterizer8ClipMaskFiller_intersect(self, spans, clip);
+    }
+  }
+
+  if (result == NULL)
+  {
+    self->pendingSkip++;
+    return;
+  }
+
+  if (self->pendingSkip)
+  {
+    self->filler->skip(self->pendingSkip);
+    self->pendingSkip = 0;
+  }
+
+  self->filler->process(result);
+}
+
+static void FOG_FASTCALL Rasterizer8ClipMaskFiller_skip(Rasterizer8ClipMaskFiller* self, int step)
+{
+  self->y += step;
+  self->pendingSkip += step;
+}
+
+//! @internal
+//!
+//! @brief Initialize the clip-mask filler, the mask storage is placed at
+//! @a bufferOffset in the scanline mask (after the data used by the rasterizer).
+static FOG_INLINE bool Rasterizer8ClipMaskFiller_init(Rasterizer8ClipMaskFiller* self,
+  const Rasterizer8* rasterizer, RasterFiller* filler, RasterScanline8* scanline,
+  size_t bufferOffset, bool clearSpans)
+{
+  int w = rasterizer->_sceneBox.getWidth();
+  if (FOG_IS_ERROR(scanline->prepare(bufferOffset + (size_t)w * 2 + 16)))
+    return false;
+
+  self->_prepare = (RasterFiller::PrepareFunc)Rasterizer8ClipMaskFiller_prepare;
+  self->_process = (RasterFiller::ProcessFunc)Rasterizer8ClipMaskFiller_process;
+  self->_skip = (RasterFiller::SkipFunc)Rasterizer8ClipMaskFiller_skip;
+
+  self->filler = filler;
+  self->scanline = scanline;
+
+  self->rows = rasterizer->_clip.mask.spans;
+  self->maskY0 = rasterizer->_clip.mask.y0;
+  self->maskY1 = rasterizer->_clip.mask.y1;
+
+  self->y = 0;
+  self->pendingSkip = 0;
+
+  self->buffer = scanline->getMask() + bufferOffset;
+  self->clearSpans = clearSpans;
+  return true;
+}
+
+// ============================================================================
+// [Fog::Rasterizer8 - Clip-Region Filler]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler which intersects the rasterizer output with the clip-region
+//! and forwards the result into the wrapped filler.
+//!
+//! Only the span positions are changed, the intersection never touches the
+//! mask data (variant spans are advanced to the new start position).
+struct FOG_NO_EXPORT Rasterizer8ClipRegionFiller : public RasterFiller
+{
+  //! @brief The wrapped filler.
+  RasterFiller* filler;
+  //! @brief The scanline container (used to allocate spans).
+  RasterScanline8* scanline;
+
+  //! @brief Current clip-box (the first box of the current band).
+  const BoxI* cPtr;
+  //! @brief End of clip-boxes.
+  const BoxI* cEnd;
+
+  //! @brief Current scanline.
+  int y;
+  //! @brief Count of scanlines not forwarded to the wrapped filler yet.
+  int pendingSkip;
+};
+
+static RasterSpan8* Rasterizer8ClipRegionFiller_intersect(Rasterizer8ClipRegionFiller* self,
+  const RasterSpan8* a, const BoxI* b)
+{
+  RasterScanline8* scanline = self->scanline;
+
+  RasterSpan8 first;
+  RasterSpan8* span = &first;
+  first.setNext(NULL);
+
+  const BoxI* bEnd = self->cEnd;
+  int bandY0 = b->y0;
+
+  for (;;)
+  {
+    int x0 = Math::max<int>(a->getX0(), b->x0);
+    int x1 = Math::min<int>(a->getX1(), b->x1);
+
+    if (x0 < x1)
+    {
+      uint aType = a->getType();
+
+      NEW_SPAN(span, return NULL);
+      span->setPositionAndType(x0, x1, aType);
+
+      if (aType == RASTER_SPAN_C)
+        span->setConstMask(a->getConstMask());
+      else
+        span->setVariantMask(a->getVariantMask() + RasterSpan8::getMaskAdvance(aType, x0 - a->getX0()));
+    }
+
+    if (a->getX1() <= b->x1)
+    {
+      if ((a = a->getNext()) == NULL)
+        break;
+    }
+    else
+    {
+      if (++b == bEnd || b->y0 != bandY0)
+        break;
+    }
+  }
+
+  span->setNext(NULL);
+  return first.getNext();
+}
+
+static void FOG_FASTCALL Rasterizer8ClipRegionFiller_prepare(Rasterizer8ClipRegionFiller* self, int y)
+{
+  self->y = y;
+  self->pendingSkip = 0;
+  self->filler->prepare(y);
+}
+
+static void FOG_FASTCALL Rasterizer8ClipRegionFiller_process(Rasterizer8ClipRegionFiller* self, RasterSpan8* spans)
+{
+  int y = self->y++;
+  RasterSpan8* result = NULL;
+
+  // Scanlines are processed top-to-bottom, so the current band is only
+  // advanced.
+  const BoxI* cPtr = self->cPtr;
+  const BoxI* cEnd = self->cEnd;
+
+  while (cPtr != cEnd && cPtr->y1 <= y)
+    cPtr++;
+  self->cPtr = cPtr;
+
+  if (cPtr != cEnd && cPtr->y0 <= y)
+    result = Rasterizer8ClipRegionFiller_intersect(self, spans, cPtr);
+
+  if (result == NULL)
+  {
+    self->pendingSkip++;
+    return;
+  }
+
+  if (self->pendingSkip)
+  {
+    self->filler->skip(self->pendingSkip);
+    self->pendingSkip = 0;
+  }
+
+  self->filler->process(result);
+}
+
+static void FOG_FASTCALL Rasterizer8ClipRegionFiller_skip(Rasterizer8ClipRegionFiller* self, int step)
+{
+  self->y += step;
+  self->pendingSkip += step;
+}
+
+static FOG_INLINE void Rasterizer8ClipRegionFiller_init(Rasterizer8ClipRegionFiller* self,
+  const Rasterizer8* rasterizer, RasterFiller* filler, RasterScanline8* scanline)
+{
+  self->_prepare = (RasterFiller::PrepareFunc)Rasterizer8ClipRegionFiller_prepare;
+  self->_process = (RasterFiller::ProcessFunc)Rasterizer8ClipRegionFiller_process;
+  self->_skip = (RasterFiller::SkipFunc)Rasterizer8ClipRegionFiller_skip;
+
+  self->filler = filler;
+  self->scanline = scanline;
+
+  self->cPtr = rasterizer->_clip.region.data;
+  self->cEnd = rasterizer->_clip.region.data + rasterizer->_clip.region.length;
+
+  self->y = 0;
+  self->pendingSkip = 0;
+}
+
 // ============================================================================
 // [Fog::BoxRasterizer8 - Init - 32x0]
 // ============================================================================
@@ -475,8 +853,11 @@ _Start:
 static void FOG_CDECL BoxRasterizer8_render_32x0_st_clip_mask(
   Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
 {
-  // TODO: BoxRasterizer8 - render 32x0 - clip-mask.
-  BoxRasterizer8* self = static_cast<BoxRasterizer8*>(_self);
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, _self, filler, scanline, 0, true))
+    return;
+
+  BoxRasterizer8_render_32x0_st_clip_box(_self, &clipFiller, scanline);
 }
 
 // ============================================================================
@@ -761,8 +1142,11 @@ _Repeat:
 static void FOG_CDECL BoxRasterizer8_render_24x8_st_clip_mask(
   Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
 {
-  // TODO: BoxRasterizer8 - render 24x8 - clip-mask.
-  BoxRasterizer8* self = static_cast<BoxRasterizer8*>(_self);
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, _self, filler, scanline, 0, true))
+    return;
+
+  BoxRasterizer8_render_24x8_st_clip_box(_self, &clipFiller, scanline);
 }
 
 // ============================================================================
@@ -796,6 +1180,18 @@ PathRasterizer8::~PathRasterizer8()
 template<typename FixedT>
 static bool PathRasterizer8_renderLine(PathRasterizer8* self, FixedT x0, FixedT y0, FixedT x1, FixedT y1);
 
+//! @internal
+//!
+//! @brief Line sinks used by @c PathRasterizer8_addPathData(), which is shared
+//! by @c PathRasterizer8, @c DensePathRasterizer8 and @c AliasedRasterizer8.
+static FOG_INLINE bool Rasterizer8_addLine(PathRasterizer8* self, int x0, int y0, int x1, int y1)
+{
+  return PathRasterizer8_renderLine<int>(self, x0, y0, x1, y1);
+}
+
+static bool Rasterizer8_addLine(DensePathRasterizer8* self, int x0, int y0, int x1, int y1);
+static bool Rasterizer8_addLine(AliasedRasterizer8* self, int x0, int y0, int x1, int y1);
+
 // ============================================================================
 // [Fog::PathRasterizer8 - Reset]
 // ============================================================================
@@ -863,8 +1259,8 @@ err_t PathRasterizer8::init()
 // [Fog::PathRasterizer8 - AddPath]
 // ============================================================================
 
-template<typename SrcT>
-static void PathRasterizer8_addPathData(PathRasterizer8* self,
+template<typename SrcT, typename RasterizerT>
+static void PathRasterizer8_addPathData(RasterizerT* self,
   const SrcT_(Point)* srcPts, const uint8_t* srcCmd, size_t count, const SrcT_(Point)& offset)
 {
   if (count == 0)
@@ -925,7 +1321,7 @@ _MoveTo:
       Fixed24x8 x1 = Math::bound<Fixed24x8>(upscale24x8(srcPts[0].x + offset.x), self->_sceneBox24x8.x0, self->_sceneBox24x8.x1);
       Fixed24x8 y1 = Math::bound<Fixed24x8>(upscale24x8(srcPts[0].y + offset.y), self->_sceneBox24x8.y0, self->_sceneBox24x8.y1);
 
-      if ((x0 != x1) | (y0 != y1) && !PathRasterizer8_renderLine<int>(self, x0, y0, x1, y1))
+      if ((x0 != x1) | (y0 != y1) && !Rasterizer8_addLine(self, x0, y0, x1, y1))
         return;
 
       x0 = x1;
@@ -996,7 +1392,7 @@ _MoveTo:
         Fixed24x8 x1 = Math::bound<Fixed24x8>(curve[0].x, self->_sceneBox24x8.x0, self->_sceneBox24x8.x1);
         Fixed24x8 y1 = Math::bound<Fixed24x8>(curve[0].y, self->_sceneBox24x8.y0, self->_sceneBox24x8.y1);
 
-        if (!PathRasterizer8_renderLine<int>(self, x0, y0, x1, y1))
+        if (!Rasterizer8_addLine(self, x0, y0, x1, y1))
           return;
 
         x0 = x1;
@@ -1110,7 +1506,7 @@ _MoveTo:
           Fixed24x8 x1 = Math::bound<Fixed24x8>(curve[0].x, self->_sceneBox24x8.x0, self->_sceneBox24x8.x1);
           Fixed24x8 y1 = Math::bound<Fixed24x8>(curve[0].y, self->_sceneBox24x8.y0, self->_sceneBox24x8.y1);
 
-          if (!PathRasterizer8_renderLine<int>(self, x0, y0, x1, y1))
+          if (!Rasterizer8_addLine(self, x0, y0, x1, y1))
             return;
 
           x0 = x1;
@@ -1169,7 +1565,7 @@ _CBezierSplit:
 
 _ClosePath:
       // Close the current polygon.
-      if ((x0 != startX0) | (y0 != startY0) && !PathRasterizer8_renderLine<int>(self, x0, y0, startX0, startY0))
+      if ((x0 != startX0) | (y0 != startY0) && !Rasterizer8_addLine(self, x0, y0, startX0, startY0))
         return;
 
       if (srcCmd == srcEnd)
@@ -3061,8 +3457,18 @@ template<int _RULE, int _USE_ALPHA>
 static void FOG_CDECL PathRasterizer8_render_st_clip_mask(
   Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
 {
-  // TODO: Rasterizer - clip-mask
   PathRasterizer8* self = static_cast<PathRasterizer8*>(_self);
+  FOG_ASSERT(self->_isFinalized);
+
+  // The clip-box render uses 'width * 2' bytes of the scanline mask, the
+  // intersection is stored after it.
+  size_t bufferOffset = (size_t)self->_sceneBox.getWidth() * 2 + 16;
+
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, self, filler, scanline, bufferOffset, false))
+    return;
+
+  PathRasterizer8_render_st_clip_box<_RULE, _USE_ALPHA>(self, &clipFiller, scanline);
 }
 
 // ============================================================================
@@ -3115,42 +3521,1987 @@ _NotValid:
 #undef SETUP_FUNCS
 }
 
-FOG_NO_EXPORT void Rasterizer_init(void)
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Construction / Destruction]
+// ============================================================================
+
+DensePathRasterizer8::DensePathRasterizer8()
 {
-  // --------------------------------------------------------------------------
-  // [Fog::BoxRasterizer8]
-  // --------------------------------------------------------------------------
+  _lines = NULL;
+  _length = 0;
+  _capacity = 0;
 
-  Rasterizer_api.box8.init32x0 = BoxRasterizer8_init32x0;
-  Rasterizer_api.box8.init24x8 = BoxRasterizer8_init24x8;
+  _boxBounds.reset();
+  _clipX0 = 0;
+  _clipX1 = 0;
 
-  Rasterizer_api.box8.render_32x0[RASTER_CLIP_BOX   ] = BoxRasterizer8_render_32x0_st_clip_box;
-  Rasterizer_api.box8.render_32x0[RASTER_CLIP_REGION] = BoxRasterizer8_render_32x0_st_clip_region;
-  Rasterizer_api.box8.render_32x0[RASTER_CLIP_MASK  ] = BoxRasterizer8_render_32x0_st_clip_mask;
+  _bandHeight = 0;
+  _stride = 0;
 
-  Rasterizer_api.box8.render_24x8[RASTER_CLIP_BOX   ] = BoxRasterizer8_render_24x8_st_clip_box;
-  Rasterizer_api.box8.render_24x8[RASTER_CLIP_REGION] = BoxRasterizer8_render_24x8_st_clip_region;
-  Rasterizer_api.box8.render_24x8[RASTER_CLIP_MASK  ] = BoxRasterizer8_render_24x8_st_clip_mask;
+  _acc = NULL;
+  _rowX = NULL;
+  _bands = NULL;
+  _active = NULL;
 
-  // --------------------------------------------------------------------------
-  // [Fog::PathRasterizer8]
-  // --------------------------------------------------------------------------
+  _error = ERR_OK;
+}
 
-  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO, 0>;
-  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO, 0>;
-  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO, 0>;
+DensePathRasterizer8::~DensePathRasterizer8()
+{
+  if (_lines != NULL)
+    MemMgr::free(_lines);
+}
 
-  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO, 1>;
-  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO, 1>;
-  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO, 1>;
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Init]
+// ============================================================================
 
-  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD, 0>;
-  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD, 0>;
-  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD, 0>;
+//! @internal
+//!
+//! @brief End of the per-band list of lines.
+static const uint32_t DensePathRasterizer8_NONE = 0xFFFFFFFFU;
 
-  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD, 1>;
-  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD, 1>;
-  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD, 1>;
+static bool DensePathRasterizer8_grow(DensePathRasterizer8* self)
+{
+  size_t capacity = self->_capacity != 0 ? self->_capacity * 2 : 256;
+
+  // Lines are indexed by 32-bit integers.
+  if (capacity >= (size_t)DensePathRasterizer8_NONE / sizeof(DensePathRasterizer8::Line))
+  {
+    self->_error = ERR_RT_OUT_OF_MEMORY;
+    return false;
+  }
+
+  DensePathRasterizer8::Line* lines = reinterpret_cast<DensePathRasterizer8::Line*>(
+    MemMgr::realloc(self->_lines, capacity * sizeof(DensePathRasterizer8::Line)));
+
+  if (FOG_IS_NULL(lines))
+  {
+    self->_error = ERR_RT_OUT_OF_MEMORY;
+    return false;
+  }
+
+  self->_lines = lines;
+  self->_capacity = capacity;
+  return true;
+}
+
+static FOG_INLINE bool DensePathRasterizer8_push(DensePathRasterizer8* self, int x0, int y0, int x1, int y1)
+{
+  if (y0 == y1)
+    return true;
+
+  if (self->_length == self->_capacity && !DensePathRasterizer8_grow(self))
+    return false;
+
+  DensePathRasterizer8::Line& line = self->_lines[self->_length++];
+  line.x0 = x0;
+  line.y0 = y0;
+  line.x1 = x1;
+  line.y1 = y1;
+  return true;
+}
+
+//! @internal
+//!
+//! @brief Get y coordinate of the line [x0, y0] -> [x1, y1] at @a x (24.8).
+static FOG_INLINE int DensePathRasterizer8_yAt(int x0, int y0, int x1, int y1, int x)
+{
+  return y0 + int(int64_t(x - x0) * int64_t(y1 - y0) / int64_t(x1 - x0));
+}
+
+static bool Rasterizer8_addLine(DensePathRasterizer8* self, int x0, int y0, int x1, int y1)
+{
+  // Horizontal lines don't change the coverage.
+  if (y0 == y1)
+    return true;
+
+  if (Math::max(y0, y1) <= (self->_boxBounds.y0 << A8_SHIFT) ||
+      Math::min(y0, y1) >= (self->_boxBounds.y1 << A8_SHIFT))
+  {
+    return true;
+  }
+
+  int cx0 = self->_clipX0;
+  int cx1 = self->_clipX1;
+
+  // Parts at the right of the box never change the coverage of pixels inside
+  // the box, so they are simply removed.
+  if (x0 >= cx1 && x1 >= cx1)
+    return true;
+
+  if (x0 > cx1 || x1 > cx1)
+  {
+    int y = DensePathRasterizer8_yAt(x0, y0, x1, y1, cx1);
+
+    if (x0 > cx1)
+    {
+      x0 = cx1;
+      y0 = y;
+    }
+    else
+    {
+      x1 = cx1;
+      y1 = y;
+    }
+  }
+
+  // Parts at the left of the box are replaced by a vertical line at the left
+  // edge of the box, which has the same cover and covers the whole cell.
+  if (x0 <= cx0 && x1 <= cx0)
+    return DensePathRasterizer8_push(self, cx0, y0, cx0, y1);
+
+  if (x0 < cx0 || x1 < cx0)
+  {
+    int y = DensePathRasterizer8_yAt(x0, y0, x1, y1, cx0);
+
+    if (x0 < cx0)
+    {
+      if (!DensePathRasterizer8_push(self, cx0, y0, cx0, y))
+        return false;
+
+      x0 = cx0;
+      y0 = y;
+    }
+    else
+    {
+      if (!DensePathRasterizer8_push(self, cx0, y, cx0, y1))
+        return false;
+
+      x1 = cx0;
+      y1 = y;
+    }
+  }
+
+  return DensePathRasterizer8_push(self, x0, y0, x1, y1);
+}
+
+template<typename SrcT>
+static err_t DensePathRasterizer8_initT(DensePathRasterizer8* self,
+  const SrcT_(Path)* path, const SrcT_(Point)* offset, uint32_t fillRule, const BoxI* box)
+{
+  // The box should be already clipped to the scene-box.
+  FOG_ASSERT(self->_sceneBox.subsumes(*box));
+  FOG_ASSERT(self->_clipType < RASTER_CLIP_COUNT);
+
+  self->_initialized = false;
+  self->_length = 0;
+  self->_boxBounds = *box;
+  self->_clipX0 = box->x0 << A8_SHIFT;
+  self->_clipX1 = box->x1 << A8_SHIFT;
+  self->_error = ERR_OK;
+
+  if (fillRule == FILL_RULE_EVEN_ODD)
+    self->_render = Rasterizer_api.dense8.render_evenodd[self->_clipType];
+  else
+    self->_render = Rasterizer_api.dense8.render_nonzero[self->_clipType];
+
+  if (path->getLength() < 2 || !box->isValid())
+    return ERR_OK;
+
+  PathRasterizer8_addPathData<SrcT>(self,
+    path->getVertices(), path->getCommands(), path->getLength(), *offset);
+
+  if (FOG_IS_ERROR(self->_error))
+    return self->_error;
+
+  size_t length = self->_length;
+  if (length == 0)
+    return ERR_OK;
+
+  // --------------------------------------------------------------------------
+  // [Bounds]
+  // --------------------------------------------------------------------------
+
+  DensePathRasterizer8::Line* lines = self->_lines;
+  size_t i;
+
+  int minX = Math::min(lines[0].x0, lines[0].x1);
+  int maxX = Math::max(lines[0].x0, lines[0].x1);
+  int minY = Math::min(lines[0].y0, lines[0].y1);
+  int maxY = Math::max(lines[0].y0, lines[0].y1);
+
+  for (i = 1; i < length; i++)
+  {
+    const DensePathRasterizer8::Line& line = lines[i];
+
+    if (minX > line.x0) minX = line.x0;
+    if (minX > line.x1) minX = line.x1;
+    if (maxX < line.x0) maxX = line.x0;
+    if (maxX < line.x1) maxX = line.x1;
+
+    if (minY > line.y0) minY = line.y0;
+    if (minY > line.y1) minY = line.y1;
+    if (maxY < line.y0) maxY = line.y0;
+    if (maxY < line.y1) maxY = line.y1;
+  }
+
+  // Pixels at the right of the last cell are never covered (the cover of
+  // closed path is zero there) and lines clipped at the right edge of the box
+  // extend the bounds to the edge.
+  BoxI& bounds = self->_boxBounds;
+  bounds.x0 = Math::max(box->x0, minX >> A8_SHIFT);
+  bounds.y0 = Math::max(box->y0, minY >> A8_SHIFT);
+  bounds.x1 = Math::min(box->x1, (maxX >> A8_SHIFT) + 1);
+  bounds.y1 = Math::min(box->y1, (maxY + A8_MASK) >> A8_SHIFT);
+
+  if (!bounds.isValid())
+    return ERR_OK;
+
+  // --------------------------------------------------------------------------
+  // [Buffers]
+  // --------------------------------------------------------------------------
+
+  // The touched cells are in [0, w + 1] and the sweep may read up to
+  // RASTER_DENSE_BLOCK - 1 cells after them.
+  size_t w = (uint)bounds.getWidth();
+  size_t h = (uint)bounds.getHeight();
+  size_t stride = (w + 2 + (RASTER_DENSE_BLOCK - 1) * 2) & ~(size_t)(RASTER_DENSE_BLOCK - 1);
+
+  size_t bandHeight = Math::bound<size_t>(RASTER_DENSE_BAND_SIZE / (stride * sizeof(int32_t)), 1, RASTER_DENSE_BAND_MAX_HEIGHT);
+  if (bandHeight > h)
+    bandHeight = h;
+  size_t bandCount = (h + bandHeight - 1) / bandHeight;
+
+  uint8_t* mem = reinterpret_cast<uint8_t*>(self->_buffer.alloc(
+    bandHeight * stride * sizeof(int32_t) +
+    bandHeight * 2 * sizeof(int) +
+    bandCount * sizeof(uint32_t) +
+    length * sizeof(uint32_t)));
+
+  if (FOG_IS_NULL(mem))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  self->_acc = reinterpret_cast<int32_t*>(mem);
+  self->_rowX = reinterpret_cast<int*>(self->_acc + bandHeight * stride);
+  self->_bands = reinterpret_cast<uint32_t*>(self->_rowX + bandHeight * 2);
+  self->_active = self->_bands + bandCount;
+
+  self->_stride = stride;
+  self->_bandHeight = (int)bandHeight;
+
+  // --------------------------------------------------------------------------
+  // [Bands]
+  // --------------------------------------------------------------------------
+
+  MemOps::set(self->_bands, 0xFF, bandCount * sizeof(uint32_t));
+
+  i = length;
+  while (i)
+  {
+    DensePathRasterizer8::Line& line = lines[--i];
+
+    int row = Math::max(Math::min(line.y0, line.y1) >> A8_SHIFT, bounds.y0);
+    uint32_t* band = &self->_bands[(uint)(row - bounds.y0) / bandHeight];
+
+    line.next = *band;
+    *band = (uint32_t)i;
+  }
+
+  self->_initialized = true;
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL DensePathRasterizer8_initF(DensePathRasterizer8* self,
+  const PathF* path, const PointF* offset, uint32_t fillRule, const BoxI* box)
+{
+  return DensePathRasterizer8_initT<float>(self, path, offset, fillRule, box);
+}
+
+static err_t FOG_CDECL DensePathRasterizer8_initD(DensePathRasterizer8* self,
+  const PathD* path, const PointD* offset, uint32_t fillRule, const BoxI* box)
+{
+  return DensePathRasterizer8_initT<double>(self, path, offset, fillRule, box);
+}
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Accumulate]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Accumulation buffer of the current band.
+struct FOG_NO_EXPORT DensePathRasterizer8Band
+{
+  int32_t* acc;
+  int* rowX;
+  size_t stride;
+
+  //! @brief The first column of the buffer.
+  int x0;
+  //! @brief The first row of the band.
+  int y0;
+};
+
+//! @internal
+//!
+//! @brief Add @a cover and @a area of the cell [ex, ey].
+//!
+//! The prefix-sum of the row is then 'cover * 512 - area' of the current
+//! cell plus the cover of all cells at the left, which is the same coverage
+//! as calculated by @c PathRasterizer8.
+static FOG_INLINE void DensePathRasterizer8_addCell(const DensePathRasterizer8Band& band,
+  int ex, int ey, int cover, int area)
+{
+  int x = ex - band.x0;
+  int r = ey - band.y0;
+
+  int32_t* p = band.acc + (size_t)(uint)r * band.stride + (uint)x;
+  p[0] += cover * A8_SCALE_2 - area;
+  p[1] += area;
+
+  int* rowX = band.rowX + r * 2;
+  if (rowX[0] > x) rowX[0] = x;
+  if (rowX[1] < x) rowX[1] = x;
+}
+
+//! @internal
+//!
+//! @brief Accumulate the part of line at the row @a ey, @a y0 and @a y1 are
+//! fractional.
+static void DensePathRasterizer8_renderHLine(const DensePathRasterizer8Band& band,
+  int ey, int x0, int y0, int x1, int y1)
+{
+  if (y0 == y1)
+    return;
+
+  int ex0 = x0 >> A8_SHIFT;
+  int ex1 = x1 >> A8_SHIFT;
+  int fx0 = x0 & A8_MASK;
+  int fx1 = x1 & A8_MASK;
+
+  // Single cell.
+  if (ex0 == ex1)
+  {
+    int delta = y1 - y0;
+    DensePathRasterizer8_addCell(band, ex0, ey, delta, (fx0 + fx1) * delta);
+    return;
+  }
+
+  // Run of adjacent cells.
+  int dx = x1 - x0;
+  int p = (A8_SCALE - fx0) * (y1 - y0);
+  int first = A8_SCALE;
+  int inc = 1;
+
+  if (dx < 0)
+  {
+    p = fx0 * (y1 - y0);
+    first = 0;
+    inc = -1;
+    dx = -dx;
+  }
+
+  int delta = p / dx;
+  int mod = p % dx;
+
+  if (mod < 0)
+  {
+    delta--;
+    mod += dx;
+  }
+
+  DensePathRasterizer8_addCell(band, ex0, ey, delta, (fx0 + first) * delta);
+
+  ex0 += inc;
+  y0 += delta;
+
+  if (ex0 != ex1)
+  {
+    p = A8_SCALE * (y1 - y0 + delta);
+
+    int lift = p / dx;
+    int rem = p % dx;
+
+    if (rem < 0)
+    {
+      lift--;
+      rem += dx;
+    }
+
+    mod -= dx;
+
+    do {
+      delta = lift;
+      mod += rem;
+
+      if (mod >= 0)
+      {
+        mod -= dx;
+        delta++;
+      }
+
+      DensePathRasterizer8_addCell(band, ex0, ey, delta, A8_SCALE * delta);
+
+      ex0 += inc;
+      y0 += delta;
+    } while (ex0 != ex1);
+  }
+
+  delta = y1 - y0;
+  DensePathRasterizer8_addCell(band, ex1, ey, delta, (fx1 + A8_SCALE - first) * delta);
+}
+
+//! @internal
+//!
+//! @brief Get x coordinate of @a line at @a y (24.8).
+//!
+//! Always calculated from the original line, so both bands sharing the split
+//! point get the same value.
+static FOG_INLINE int DensePathRasterizer8_xAt(const DensePathRasterizer8::Line& line, int y)
+{
+  return line.x0 + int(int64_t(y - line.y0) * int64_t(line.x1 - line.x0) / int64_t(line.y1 - line.y0));
+}
+
+//! @internal
+//!
+//! @brief Accumulate the part of @a line in the band [by0, by1) (24.8).
+static void DensePathRasterizer8_renderLine(const DensePathRasterizer8Band& band,
+  const DensePathRasterizer8::Line& line, int by0, int by1)
+{
+  int x0 = line.x0;
+  int y0 = line.y0;
+  int x1 = line.x1;
+  int y1 = line.y1;
+
+  if (y0 < y1)
+  {
+    if (y0 >= by1 || y1 <= by0)
+      return;
+
+    if (y0 < by0) { x0 = DensePathRasterizer8_xAt(line, by0); y0 = by0; }
+    if (y1 > by1) { x1 = DensePathRasterizer8_xAt(line, by1); y1 = by1; }
+  }
+  else
+  {
+    if (y1 >= by1 || y0 <= by0)
+      return;
+
+    if (y0 > by1) { x0 = DensePathRasterizer8_xAt(line, by1); y0 = by1; }
+    if (y1 < by0) { x1 = DensePathRasterizer8_xAt(line, by0); y1 = by0; }
+  }
+
+  int ey0 = y0 >> A8_SHIFT;
+  int ey1 = y1 >> A8_SHIFT;
+  int fy0 = y0 & A8_MASK;
+  int fy1 = y1 & A8_MASK;
+
+  // Single row.
+  if (ey0 == ey1)
+  {
+    DensePathRasterizer8_renderHLine(band, ey0, x0, fy0, x1, fy1);
+    return;
+  }
+
+  // Multiple rows, the intermediate results may not fit into 32-bit integer.
+  int64_t dx = x1 - x0;
+  int64_t dy = y1 - y0;
+
+  int64_t p = int64_t(A8_SCALE - fy0) * dx;
+  int first = A8_SCALE;
+  int inc = 1;
+
+  if (dy < 0)
+  {
+    p = int64_t(fy0) * dx;
+    first = 0;
+    inc = -1;
+    dy = -dy;
+  }
+
+  int64_t delta = p / dy;
+  int64_t mod = p % dy;
+
+  if (mod < 0)
+  {
+    delta--;
+    mod += dy;
+  }
+
+  int xFrom = x0 + int(delta);
+  DensePathRasterizer8_renderHLine(band, ey0, x0, fy0, xFrom, first);
+
+  ey0 += inc;
+
+  if (ey0 != ey1)
+  {
+    p = int64_t(A8_SCALE) * dx;
+
+    int64_t lift = p / dy;
+    int64_t rem = p % dy;
+
+    if (rem < 0)
+    {
+      lift--;
+      rem += dy;
+    }
+
+    mod -= dy;
+
+    do {
+      delta = lift;
+      mod += rem;
+
+      if (mod >= 0)
+      {
+        mod -= dy;
+        delta++;
+      }
+
+      int xTo = xFrom + int(delta);
+      DensePathRasterizer8_renderHLine(band, ey0, xFrom, A8_SCALE - first, xTo, first);
+
+      xFrom = xTo;
+      ey0 += inc;
+    } while (ey0 != ey1);
+  }
+
+  DensePathRasterizer8_renderHLine(band, ey0, xFrom, A8_SCALE - first, x1, fy1);
+}
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Sweep]
+// ============================================================================
+
+template<int _RULE>
+static FOG_INLINE uint32_t DensePathRasterizer8_calculateAlpha(int32_t cover, uint32_t opacity)
+{
+  uint32_t alpha = uint32_t(Math::abs(cover)) >> 9;
+
+  if (_RULE == FILL_RULE_NON_ZERO)
+  {
+    if (alpha > A8_SCALE)
+      alpha = A8_SCALE;
+  }
+  else
+  {
+    alpha &= A8_MASK_2;
+    if (alpha > A8_SCALE)
+      alpha = A8_SCALE_2 - alpha;
+  }
+
+  return (alpha * opacity) >> 8;
+}
+
+template<int _RULE>
+static int32_t FOG_CDECL DensePathRasterizer8_sweep(uint16_t* dst, int32_t* acc, size_t w, uint32_t opacity)
+{
+  int32_t cover = 0;
+
+  for (size_t i = 0; i < w; i++)
+  {
+    cover += acc[i];
+    acc[i] = 0;
+    dst[i] = (uint16_t)DensePathRasterizer8_calculateAlpha<_RULE>(cover, opacity);
+  }
+
+  return cover;
+}
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Render - Clip-Box]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL DensePathRasterizer8_render_st_clip_box(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  DensePathRasterizer8* self = static_cast<DensePathRasterizer8*>(_self);
+  const BoxI& box = self->_boxBounds;
+
+  if (!self->_initialized)
+    return;
+
+  int bx0 = box.x0;
+  int bx1 = box.x1;
+  int w = bx1 - bx0;
+
+  int y = box.y0;
+  int yEnd = box.y1;
+
+  const DensePathRasterizer8::Line* lines = self->_lines;
+  const uint32_t* bands = self->_bands;
+
+  uint32_t* active = self->_active;
+  size_t activeLength = 0;
+
+  DensePathRasterizer8Band band;
+  band.acc = self->_acc;
+  band.rowX = self->_rowX;
+  band.stride = self->_stride;
+  band.x0 = bx0;
+
+  int bandHeight = self->_bandHeight;
+
+  RasterizerApi::DensePathRasterizer8_Sweep sweep = (_RULE == FILL_RULE_EVEN_ODD)
+    ? Rasterizer_api.dense8.sweep_evenodd
+    : Rasterizer_api.dense8.sweep_nonzero;
+
+  uint32_t opacity = self->_opacity;
+  int pendingSkip = 0;
+
+  // --------------------------------------------------------------------------
+  // [Prepare]
+  // --------------------------------------------------------------------------
+
+  if (FOG_IS_ERROR(scanline->prepare(band.stride * 2)))
+    return;
+
+  uint16_t* mask = reinterpret_cast<uint16_t*>(scanline->getMask());
+
+  // The previous render could be interrupted (out of memory), so the buffer
+  // is cleared here and then by each sweep.
+  MemOps::zero(band.acc, (size_t)(uint)bandHeight * band.stride * sizeof(int32_t));
+
+  filler->prepare(y);
+  RasterFiller::ProcessFunc process = filler->_process;
+
+  // --------------------------------------------------------------------------
+  // [Process]
+  // --------------------------------------------------------------------------
+
+  for (uint32_t bandIndex = 0; y < yEnd; bandIndex++)
+  {
+    int bandY1 = Math::min(y + bandHeight, yEnd);
+    int r, rows = bandY1 - y;
+
+    for (uint32_t index = bands[bandIndex]; index != DensePathRasterizer8_NONE; index = lines[index].next)
+      active[activeLength++] = index;
+
+    for (r = 0; r < rows; r++)
+    {
+      band.rowX[r * 2 + 0] = w + 2;
+      band.rowX[r * 2 + 1] = -1;
+    }
+
+    // Accumulate all lines crossing the band and remove the finished ones.
+    band.y0 = y;
+
+    int by0 = y << A8_SHIFT;
+    int by1 = bandY1 << A8_SHIFT;
+
+    size_t i, j = 0;
+    for (i = 0; i < activeLength; i++)
+    {
+      const DensePathRasterizer8::Line& line = lines[active[i]];
+      DensePathRasterizer8_renderLine(band, line, by0, by1);
+
+      if (Math::max(line.y0, line.y1) > by1)
+        active[j++] = active[i];
+    }
+    activeLength = j;
+
+    // Resolve the rows.
+    for (r = 0; r < rows; r++, y++)
+    {
+      RasterSpan8* span = scanline->begin();
+
+      int x = band.rowX[r * 2 + 0];
+      int xEnd = band.rowX[r * 2 + 1] + 2;
+
+      if (x < xEnd)
+      {
+        int32_t cover = sweep(mask + x, band.acc + (size_t)(uint)r * band.stride + (uint)x, (size_t)(uint)(xEnd - x), opacity);
+        int lastX1 = -1;
+
+        if (xEnd > w)
+          xEnd = w;
+
+        while (x < xEnd)
+        {
+          if (mask[x] == 0)
+          {
+            x++;
+            continue;
+          }
+
+          int x0 = x;
+
+          // Const span (fully covered pixels).
+          if (mask[x] == opacity)
+          {
+            while (x < xEnd && mask[x] == opacity)
+              x++;
+
+            if (x - x0 >= RASTER_SPAN_C_THRESHOLD)
+            {
+              NEW_SPAN(span, return);
+              span->setPositionAndType(bx0 + x0, bx0 + x, RASTER_SPAN_C);
+              span->setConstMask(opacity);
+
+              lastX1 = x;
+              continue;
+            }
+          }
+
+          // Variant span, ends before zero or before a long run of fully
+          // covered pixels.
+          while (x < xEnd && mask[x] != 0)
+          {
+            if (mask[x] != opacity)
+            {
+              x++;
+              continue;
+            }
+
+            int xOpaque = x;
+            while (xOpaque < xEnd && mask[xOpaque] == opacity)
+              xOpaque++;
+
+            if (xOpaque - x >= RASTER_SPAN_C_THRESHOLD)
+              break;
+            x = xOpaque;
+          }
+
+          NEW_SPAN(span, return);
+          span->setPositionAndType(bx0 + x0, bx0 + x, RASTER_SPAN_AX_EXTRA);
+          span->setA8Extra(reinterpret_cast<uint8_t*>(mask + x0));
+          lastX1 = -1;
+        }
+
+        // The cover after the last touched cell is constant (non-zero if the
+        // path was clipped by the right edge of the box).
+        uint32_t alpha = DensePathRasterizer8_calculateAlpha<_RULE>(cover, opacity);
+        if (alpha != 0 && xEnd < w)
+        {
+          if (lastX1 == xEnd && alpha == opacity)
+          {
+            span->setX1(bx1);
+          }
+          else
+          {
+            NEW_SPAN(span, return);
+            span->setPositionAndType(bx0 + xEnd, bx1, RASTER_SPAN_C);
+            span->setConstMask(alpha);
+          }
+        }
+      }
+
+      span = scanline->end(span);
+      if (span == NULL)
+      {
+        pendingSkip++;
+      }
+      else
+      {
+        if (pendingSkip)
+        {
+          filler->_skip(filler, pendingSkip);
+          pendingSkip = 0;
+        }
+
+        process(filler, span);
+      }
+    }
+  }
+}
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Render - Clip-Region]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL DensePathRasterizer8_render_st_clip_region(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  Rasterizer8ClipRegionFiller clipFiller;
+  Rasterizer8ClipRegionFiller_init(&clipFiller, _self, filler, scanline);
+
+  DensePathRasterizer8_render_st_clip_box<_RULE>(_self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Render - Clip-Mask]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL DensePathRasterizer8_render_st_clip_mask(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  DensePathRasterizer8* self = static_cast<DensePathRasterizer8*>(_self);
+
+  // The clip-box render uses 'stride * 2' bytes of the scanline mask, the
+  // intersection is stored after it.
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, self, filler, scanline, self->_stride * 2, false))
+    return;
+
+  DensePathRasterizer8_render_st_clip_box<_RULE>(self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::GlyphRasterizer8 - Init]
+// ============================================================================
+
+static void FOG_CDECL GlyphRasterizer8_init(GlyphRasterizer8* self, const RasterGlyphItem8* items, size_t length, const BoxI* box)
+{
+  // The box should be already clipped to the scene-box.
+  FOG_ASSERT(self->_sceneBox.subsumes(*box));
+  FOG_ASSERT(self->_clipType < RASTER_CLIP_COUNT);
+
+  self->_initialized = (length != 0) & box->isValid();
+  self->_items = items;
+  self->_length = length;
+  self->_boxBounds = *box;
+  self->_render = Rasterizer_api.glyph8.render[self->_clipType];
+}
+
+// ============================================================================
+// [Fog::GlyphRasterizer8 - Render - Helpers]
+// ============================================================================
+
+static FOG_INLINE uint32_t GlyphRasterizer8_expandA8(uint32_t m)
+{
+  return m + (m >> 7);
+}
+
+//! @internal
+//!
+//! @brief Add the glyph coverage into the accumulation buffer (saturated).
+static FOG_INLINE void GlyphRasterizer8_accumulate(uint16_t* dst, const uint8_t* src, uint w)
+{
+  for (uint i = 0; i < w; i++)
+  {
+    uint32_t m = (uint32_t)dst[i] + GlyphRasterizer8_expandA8(src[i]);
+    dst[i] = (uint16_t)(m > 0x100 ? 0x100 : m);
+  }
+}
+
+static FOG_INLINE const uint8_t* GlyphRasterizer8_getMask(const RasterGlyphItem8* item, int x, int y)
+{
+  const RasterGlyph8* glyph = item->glyph;
+  return glyph->getMask() + (size_t)(uint)(y - item->y) * (uint)glyph->_w + (uint)(x - item->x);
+}
+
+// ============================================================================
+// [Fog::GlyphRasterizer8 - Render - Clip-Box]
+// ============================================================================
+
+static void FOG_CDECL GlyphRasterizer8_render_st_clip_box(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  GlyphRasterizer8* self = static_cast<GlyphRasterizer8*>(_self);
+  const BoxI& box = self->_boxBounds;
+
+  if (!self->_initialized)
+    return;
+
+  int x0 = box.x0;
+  int x1 = box.x1;
+
+  int y = box.y0;
+  int yEnd = box.y1;
+
+  const RasterGlyphItem8* items = self->_items;
+  const RasterGlyphItem8* itemsEnd = items + self->_length;
+
+  uint32_t opacity = self->_opacity;
+  int pendingSkip = 0;
+
+  // --------------------------------------------------------------------------
+  // [Prepare]
+  // --------------------------------------------------------------------------
+
+  // The accumulation buffer never exceeds the box width (clusters of glyphs
+  // don't overlap).
+  if (FOG_IS_ERROR(scanline->prepare((size_t)box.getWidth() * 2 + 16)))
+    return;
+
+  filler->prepare(y);
+  RasterFiller::ProcessFunc process = filler->_process;
+
+  // --------------------------------------------------------------------------
+  // [Process]
+  // --------------------------------------------------------------------------
+
+  for (; y < yEnd; y++)
+  {
+    RasterSpan8* span = scanline->begin();
+    uint16_t* acc = reinterpret_cast<uint16_t*>(scanline->getMask());
+
+    // The current cluster of overlapping glyphs. If the cluster contains only
+    // one glyph then cItem is set and nothing is accumulated (yet).
+    const RasterGlyphItem8* cItem = NULL;
+    uint16_t* cAcc = NULL;
+    int cx0 = 0;
+    int cx1 = 0;
+
+    const RasterGlyphItem8* item = items;
+    for (;;)
+    {
+      bool flush = (item == itemsEnd) || (item->x >= x1);
+
+      int ix0 = 0;
+      int ix1 = 0;
+
+      if (!flush)
+      {
+        const RasterGlyph8* glyph = item->glyph;
+
+        if ((uint)(y - item->y) >= (uint)glyph->_h)
+          goto _Next;
+
+        ix0 = Math::max<int>(item->x, x0);
+        ix1 = Math::min<int>(item->x + glyph->_w, x1);
+
+        if (ix0 >= ix1)
+          goto _Next;
+
+        if (cx0 < cx1 && ix0 < cx1)
+        {
+          // Overlap, accumulate the cluster.
+          if (cAcc == NULL)
+          {
+            cAcc = acc;
+            MemOps::zero(cAcc, (size_t)(uint)(cx1 - cx0) * 2);
+            GlyphRasterizer8_accumulate(cAcc, GlyphRasterizer8_getMask(cItem, cx0, y), (uint)(cx1 - cx0));
+            cItem = NULL;
+          }
+
+          if (ix1 > cx1)
+          {
+            MemOps::zero(cAcc + (cx1 - cx0), (size_t)(uint)(ix1 - cx1) * 2);
+            cx1 = ix1;
+          }
+
+          GlyphRasterizer8_accumulate(cAcc + (ix0 - cx0), GlyphRasterizer8_getMask(item, ix0, y), (uint)(ix1 - ix0));
+          goto _Next;
+        }
+      }
+
+      // Flush the current cluster.
+      if (cx0 < cx1)
+      {
+        uint i, w = (uint)(cx1 - cx0);
+
+        if (cAcc == NULL)
+        {
+          const uint8_t* mask = GlyphRasterizer8_getMask(cItem, cx0, y);
+
+          if (opacity == 0x100)
+          {
+            NEW_SPAN(span, return);
+            span->setPositionAndType(cx0, cx1, RASTER_SPAN_A8_GLYPH);
+            span->setA8Glyph(const_cast<uint8_t*>(mask));
+          }
+          else
+          {
+            for (i = 0; i < w; i++)
+              acc[i] = (uint16_t)((GlyphRasterizer8_expandA8(mask[i]) * opacity) >> 8);
+
+            NEW_SPAN(span, return);
+            span->setPositionAndType(cx0, cx1, RASTER_SPAN_AX_EXTRA);
+            span->setA8Extra(reinterpret_cast<uint8_t*>(acc));
+            acc += w;
+          }
+        }
+        else
+        {
+          if (opacity != 0x100)
+          {
+            for (i = 0; i < w; i++)
+              cAcc[i] = (uint16_t)(((uint32_t)cAcc[i] * opacity) >> 8);
+          }
+
+          NEW_SPAN(span, return);
+          span->setPositionAndType(cx0, cx1, RASTER_SPAN_AX_EXTRA);
+          span->setA8Extra(reinterpret_cast<uint8_t*>(cAcc));
+          acc = cAcc + w;
+        }
+      }
+
+      if (flush)
+        break;
+
+      // Start a new cluster.
+      cItem = item;
+      cAcc = NULL;
+      cx0 = ix0;
+      cx1 = ix1;
+
+_Next:
+      item++;
+    }
+
+    span = scanline->end(span);
+    if (span == NULL)
+    {
+      pendingSkip++;
+      continue;
+    }
+
+    if (pendingSkip)
+    {
+      filler->_skip(filler, pendingSkip);
+      pendingSkip = 0;
+    }
+
+    process(filler, span);
+  }
+}
+
+// ============================================================================
+// [Fog::GlyphRasterizer8 - Render - Clip-Region]
+// ============================================================================
+
+static void FOG_CDECL GlyphRasterizer8_render_st_clip_region(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  Rasterizer8ClipRegionFiller clipFiller;
+  Rasterizer8ClipRegionFiller_init(&clipFiller, _self, filler, scanline);
+
+  GlyphRasterizer8_render_st_clip_box(_self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::GlyphRasterizer8 - Render - Clip-Mask]
+// ============================================================================
+
+static void FOG_CDECL GlyphRasterizer8_render_st_clip_mask(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  GlyphRasterizer8* self = static_cast<GlyphRasterizer8*>(_self);
+
+  // The clip-box render uses 'width * 2' bytes of the scanline mask, the
+  // intersection is stored after it.
+  size_t bufferOffset = (size_t)self->_boxBounds.getWidth() * 2 + 16;
+
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, self, filler, scanline, bufferOffset, false))
+    return;
+
+  GlyphRasterizer8_render_st_clip_box(self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::HairlineRasterizer8 - Init]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief End of the per-row list of segments.
+static const uint32_t HairlineRasterizer8_NONE = 0xFFFFFFFFU;
+
+static FOG_INLINE void HairlineRasterizer8_addSegment(HairlineRasterizer8* self,
+  float x0, float y0, float x1, float y1, BoxI& bBox)
+{
+  float dx = x1 - x0;
+  float dy = y1 - y0;
+
+  // Reject degenerated segments (and NaNs).
+  if (!Math::isFinite(dx) || !Math::isFinite(dy) || (dx == 0.0f && dy == 0.0f))
+    return;
+
+  const BoxI& box = self->_boxBounds;
+
+  // The line band is one pixel wide, so nothing is painted outside of the
+  // bounding box of the segment expanded by one pixel.
+  if (Math::max(x0, x1) <= (float)(box.x0 - 1) || Math::min(x0, x1) >= (float)(box.x1 + 1) ||
+      Math::max(y0, y1) <= (float)(box.y0 - 1) || Math::min(y0, y1) >= (float)(box.y1 + 1))
+  {
+    return;
+  }
+
+  HairlineRasterizer8::Segment* seg = &self->_segments[self->_length];
+  int rowStart;
+  int rowEnd;
+
+  if (Math::abs(dx) >= Math::abs(dy))
+  {
+    if (dx < 0.0f)
+    {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+
+    seg->slope = dy / dx;
+    seg->yMajor = false;
+
+    // Pixel centers of the end columns can be up to 0.5 pixel outside of the
+    // segment, so the line is evaluated in [yMin - 0.5, yMax + 0.5] and the
+    // row is touched if its center is less than one pixel from the line.
+    rowStart = Math::ifloor(Math::max(Math::min(y0, y1) - 2.0f, (float)(box.y0 - 1))) + 1;
+    rowEnd = Math::iceil(Math::min(Math::max(y0, y1) + 1.0f, (float)box.y1));
+  }
+  else
+  {
+    if (dy < 0.0f)
+    {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+
+    seg->slope = dx / dy;
+    seg->yMajor = true;
+
+    rowStart = Math::ifloor(Math::max(y0, (float)box.y0));
+    rowEnd = Math::iceil(Math::min(y1, (float)box.y1));
+  }
+
+  if (rowStart >= rowEnd)
+    return;
+
+  seg->x0 = x0;
+  seg->y0 = y0;
+  seg->x1 = x1;
+  seg->y1 = y1;
+  seg->rowEnd = rowEnd;
+
+  uint32_t index = (uint32_t)self->_length++;
+  uint32_t* row = &self->_rows[rowStart - box.y0];
+
+  self->_next[index] = *row;
+  *row = index;
+
+  // The y-major segment is ordered by y, so x0 is greater than x1 if the line
+  // goes down-left.
+  int px0 = Math::ifloor(Math::max(Math::min(seg->x0, seg->x1) - 1.0f, (float)box.x0));
+  int px1 = Math::iceil(Math::min(Math::max(seg->x0, seg->x1) + 1.0f, (float)box.x1));
+
+  if (bBox.x0 > px0) bBox.x0 = px0;
+  if (bBox.x1 < px1) bBox.x1 = px1;
+  if (bBox.y0 > rowStart) bBox.y0 = rowStart;
+  if (bBox.y1 < rowEnd) bBox.y1 = rowEnd;
+}
+
+static err_t FOG_CDECL HairlineRasterizer8_init(HairlineRasterizer8* self, const PathF* path, const BoxI* box)
+{
+  // The box should be already clipped to the scene-box.
+  FOG_ASSERT(self->_sceneBox.subsumes(*box));
+  FOG_ASSERT(self->_clipType < RASTER_CLIP_COUNT);
+
+  self->_initialized = false;
+  self->_length = 0;
+  self->_boxBounds = *box;
+  self->_render = Rasterizer_api.hairline8.render[self->_clipType];
+
+  size_t length = path->getLength();
+  if (length < 2 || !box->isValid())
+    return ERR_OK;
+
+  size_t h = (uint)box->getHeight();
+  uint8_t* mem = reinterpret_cast<uint8_t*>(self->_buffer.alloc(
+    length * (sizeof(HairlineRasterizer8::Segment) + 2 * sizeof(uint32_t)) + h * sizeof(uint32_t)));
+
+  if (FOG_IS_NULL(mem))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  self->_segments = reinterpret_cast<HairlineRasterizer8::Segment*>(mem);
+  self->_next = reinterpret_cast<uint32_t*>(self->_segments + length);
+  self->_active = self->_next + length;
+  self->_rows = self->_active + length;
+  MemOps::set(self->_rows, 0xFF, h * sizeof(uint32_t));
+
+  // --------------------------------------------------------------------------
+  // [Segments]
+  // --------------------------------------------------------------------------
+
+  const uint8_t* cmd = path->getCommands();
+  const PointF* pts = path->getVertices();
+
+  BoxI bBox(box->x1, box->y1, box->x0, box->y0);
+  PointF start(0.0f, 0.0f);
+  PointF last(0.0f, 0.0f);
+  bool hasLast = false;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    switch (cmd[i])
+    {
+      case PATH_CMD_LINE_TO:
+        if (hasLast)
+        {
+          HairlineRasterizer8_addSegment(self, last.x, last.y, pts[i].x, pts[i].y, bBox);
+          last = pts[i];
+          break;
+        }
+        // ... Fall through ...
+
+      case PATH_CMD_MOVE_TO:
+        start = pts[i];
+        last = pts[i];
+        hasLast = true;
+        break;
+
+      case PATH_CMD_CLOSE:
+        if (hasLast)
+        {
+          HairlineRasterizer8_addSegment(self, last.x, last.y, start.x, start.y, bBox);
+          last = start;
+        }
+        break;
+
+      default:
+        // The path must be flat, curves are not expected here.
+        FOG_ASSERT_NOT_REACHED();
+    }
+  }
+
+  if (self->_length == 0)
+    return ERR_OK;
+
+  // Rows are indexed from the top of the box to render.
+  self->_rows += bBox.y0 - box->y0;
+  self->_boxBounds = bBox;
+  self->_initialized = bBox.isValid();
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::HairlineRasterizer8 - Render - Helpers]
+// ============================================================================
+
+static FOG_INLINE void HairlineRasterizer8_accumulate(uint16_t* dst, float coverage)
+{
+  uint32_t m = (uint32_t)dst[0] + (uint32_t)(int)(coverage * 256.0f + 0.5f);
+  dst[0] = (uint16_t)(m > 0x100 ? 0x100 : m);
+}
+
+//! @internal
+//!
+//! @brief Accumulate the coverage of x-major segment @a seg in row @a y,
+//! the touched columns are merged into [@a spanX0, @a spanX1).
+static FOG_INLINE void HairlineRasterizer8_renderX(const HairlineRasterizer8::Segment& seg,
+  uint16_t* acc, int y, int bx0, int bx1, int& spanX0, int& spanX1)
+{
+  float cy = (float)y + 0.5f;
+
+  int x0 = Math::ifloor(Math::max(seg.x0, (float)bx0));
+  int x1 = Math::iceil(Math::min(seg.x1, (float)bx1));
+
+  // Columns where the line center is less than one pixel from the row center.
+  // For nearly horizontal segments it's faster to test all columns.
+  if (Math::abs(seg.slope) >= 1e-6f)
+  {
+    float extent = Math::abs(1.0f / seg.slope);
+    float t = seg.x0 + (cy - seg.y0) / seg.slope - 0.5f;
+
+    float tLo = Math::bound<float>(t - extent, (float)(bx0 - 1), (float)(bx1 + 1));
+    float tHi = Math::bound<float>(t + extent, (float)(bx0 - 1), (float)(bx1 + 1));
+
+    x0 = Math::max<int>(x0, Math::ifloor(tLo));
+    x1 = Math::min<int>(x1, Math::ifloor(tHi) + 1);
+  }
+
+  if (x0 >= x1)
+    return;
+
+  for (int x = x0; x < x1; x++)
+  {
+    float fx = (float)x;
+    float d = Math::abs(seg.y0 + (fx + 0.5f - seg.x0) * seg.slope - cy);
+
+    if (d >= 1.0f)
+      continue;
+
+    // Fractional coverage of the end columns.
+    float h = Math::min(fx + 1.0f, seg.x1) - Math::max(fx, seg.x0);
+    HairlineRasterizer8_accumulate(&acc[x - bx0], (1.0f - d) * Math::min(h, 1.0f));
+  }
+
+  if (spanX0 > x0) spanX0 = x0;
+  if (spanX1 < x1) spanX1 = x1;
+}
+
+//! @internal
+//!
+//! @brief Accumulate the coverage of y-major segment @a seg in row @a y,
+//! the touched columns are merged into [@a spanX0, @a spanX1).
+static FOG_INLINE void HairlineRasterizer8_renderY(const HairlineRasterizer8::Segment& seg,
+  uint16_t* acc, int y, int bx0, int bx1, int& spanX0, int& spanX1)
+{
+  float fy = (float)y;
+
+  // Fractional coverage of the end rows.
+  float v = Math::min(fy + 1.0f, seg.y1) - Math::max(fy, seg.y0);
+  if (v <= 0.0f)
+    return;
+
+  float t = seg.x0 + (fy + 0.5f - seg.y0) * seg.slope - 0.5f;
+  if (!(t > (float)(bx0 - 1) && t < (float)bx1))
+    return;
+
+  int x = Math::ifloor(t);
+  float f = t - (float)x;
+
+  v = Math::min(v, 1.0f);
+
+  int x0 = x;
+  int x1 = x + 2;
+
+  if (x >= bx0)
+    HairlineRasterizer8_accumulate(&acc[x - bx0], (1.0f - f) * v);
+  else
+    x0++;
+
+  if (x + 1 < bx1)
+    HairlineRasterizer8_accumulate(&acc[x + 1 - bx0], f * v);
+  else
+    x1--;
+
+  if (spanX0 > x0) spanX0 = x0;
+  if (spanX1 < x1) spanX1 = x1;
+}
+
+// ============================================================================
+// [Fog::HairlineRasterizer8 - Render - Clip-Box]
+// ============================================================================
+
+static void FOG_CDECL HairlineRasterizer8_render_st_clip_box(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  HairlineRasterizer8* self = static_cast<HairlineRasterizer8*>(_self);
+  const BoxI& box = self->_boxBounds;
+
+  if (!self->_initialized)
+    return;
+
+  int bx0 = box.x0;
+  int bx1 = box.x1;
+
+  int y = box.y0;
+  int yEnd = box.y1;
+
+  const HairlineRasterizer8::Segment* segments = self->_segments;
+  const uint32_t* next = self->_next;
+  const uint32_t* rows = self->_rows;
+
+  uint32_t* active = self->_active;
+  size_t activeLength = 0;
+
+  uint32_t opacity = self->_opacity;
+  int pendingSkip = 0;
+
+  // --------------------------------------------------------------------------
+  // [Prepare]
+  // --------------------------------------------------------------------------
+
+  if (FOG_IS_ERROR(scanline->prepare((size_t)box.getWidth() * 2 + 16)))
+    return;
+
+  uint16_t* acc = reinterpret_cast<uint16_t*>(scanline->getMask());
+  MemOps::zero(acc, (size_t)box.getWidth() * 2);
+
+  filler->prepare(y);
+  RasterFiller::ProcessFunc process = filler->_process;
+
+  // --------------------------------------------------------------------------
+  // [Process]
+  // --------------------------------------------------------------------------
+
+  for (; y < yEnd; y++)
+  {
+    for (uint32_t index = rows[y - box.y0]; index != HairlineRasterizer8_NONE; index = next[index])
+      active[activeLength++] = index;
+
+    int spanX0 = bx1;
+    int spanX1 = bx0;
+
+    size_t i, j = 0;
+    for (i = 0; i < activeLength; i++)
+    {
+      uint32_t index = active[i];
+      const HairlineRasterizer8::Segment& seg = segments[index];
+
+      if (seg.yMajor)
+        HairlineRasterizer8_renderY(seg, acc, y, bx0, bx1, spanX0, spanX1);
+      else
+        HairlineRasterizer8_renderX(seg, acc, y, bx0, bx1, spanX0, spanX1);
+
+      if (seg.rowEnd > y + 1)
+        active[j++] = index;
+    }
+    activeLength = j;
+
+    // Split the touched columns into spans of non-zero coverage.
+    RasterSpan8* span = scanline->begin();
+    int x = spanX0;
+
+    for (;;)
+    {
+      while (x < spanX1 && acc[x - bx0] == 0)
+        x++;
+
+      if (x >= spanX1)
+        break;
+
+      int x0 = x;
+      uint16_t* mask = &acc[x0 - bx0];
+
+      if (opacity == 0x100)
+      {
+        while (x < spanX1 && acc[x - bx0] != 0)
+          x++;
+      }
+      else
+      {
+        while (x < spanX1 && acc[x - bx0] != 0)
+        {
+          acc[x - bx0] = (uint16_t)(((uint32_t)acc[x - bx0] * opacity) >> 8);
+          x++;
+        }
+      }
+
+      NEW_SPAN(span, return);
+      span->setPositionAndType(x0, x, RASTER_SPAN_AX_EXTRA);
+      span->setA8Extra(reinterpret_cast<uint8_t*>(mask));
+    }
+
+    span = scanline->end(span);
+    if (span == NULL)
+    {
+      pendingSkip++;
+    }
+    else
+    {
+      if (pendingSkip)
+      {
+        filler->_skip(filler, pendingSkip);
+        pendingSkip = 0;
+      }
+
+      process(filler, span);
+    }
+
+    if (spanX0 < spanX1)
+      MemOps::zero(&acc[spanX0 - bx0], (size_t)(uint)(spanX1 - spanX0) * 2);
+  }
+}
+
+// ============================================================================
+// [Fog::HairlineRasterizer8 - Render - Clip-Region]
+// ============================================================================
+
+static void FOG_CDECL HairlineRasterizer8_render_st_clip_region(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  Rasterizer8ClipRegionFiller clipFiller;
+  Rasterizer8ClipRegionFiller_init(&clipFiller, _self, filler, scanline);
+
+  HairlineRasterizer8_render_st_clip_box(_self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::HairlineRasterizer8 - Render - Clip-Mask]
+// ============================================================================
+
+static void FOG_CDECL HairlineRasterizer8_render_st_clip_mask(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  HairlineRasterizer8* self = static_cast<HairlineRasterizer8*>(_self);
+
+  // The clip-box render uses 'width * 2' bytes of the scanline mask, the
+  // intersection is stored after it.
+  size_t bufferOffset = (size_t)self->_boxBounds.getWidth() * 2 + 16;
+
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, self, filler, scanline, bufferOffset, false))
+    return;
+
+  HairlineRasterizer8_render_st_clip_box(self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Construction / Destruction]
+// ============================================================================
+
+AliasedRasterizer8::AliasedRasterizer8()
+{
+  _edges = _edgesStorage;
+  _length = 0;
+  _capacity = FOG_ARRAY_SIZE(_edgesStorage);
+
+  _active = NULL;
+  _rows = NULL;
+
+  _boxBounds.reset();
+  _error = ERR_OK;
+}
+
+AliasedRasterizer8::~AliasedRasterizer8()
+{
+  if (_edges != _edgesStorage)
+    MemMgr::free(_edges);
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Init]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief End of the per-row list of edges.
+static const uint32_t AliasedRasterizer8_NONE = 0xFFFFFFFFU;
+
+static bool AliasedRasterizer8_grow(AliasedRasterizer8* self)
+{
+  size_t capacity = self->_capacity * 2;
+
+  // Edges are indexed by 32-bit integers.
+  if (capacity >= (size_t)AliasedRasterizer8_NONE / sizeof(AliasedRasterizer8::Edge))
+  {
+    self->_error = ERR_RT_OUT_OF_MEMORY;
+    return false;
+  }
+
+  AliasedRasterizer8::Edge* edges = reinterpret_cast<AliasedRasterizer8::Edge*>(
+    MemMgr::alloc(capacity * sizeof(AliasedRasterizer8::Edge)));
+
+  if (FOG_IS_NULL(edges))
+  {
+    self->_error = ERR_RT_OUT_OF_MEMORY;
+    return false;
+  }
+
+  MemOps::copy(edges, self->_edges, self->_length * sizeof(AliasedRasterizer8::Edge));
+
+  if (self->_edges != self->_edgesStorage)
+    MemMgr::free(self->_edges);
+
+  self->_edges = edges;
+  self->_capacity = capacity;
+  return true;
+}
+
+static bool Rasterizer8_addLine(AliasedRasterizer8* self, int x0, int y0, int x1, int y1)
+{
+  // Horizontal edges never cross the row center.
+  if (y0 == y1)
+    return true;
+
+  int dir = 1;
+  if (y0 > y1)
+  {
+    swap(x0, x1);
+    swap(y0, y1);
+    dir = -1;
+  }
+
+  // Rows where the center of the row is in [y0, y1).
+  int r0 = (y0 + 127) >> 8;
+  int r1 = (y1 + 127) >> 8;
+
+  const BoxI& box = self->_boxBounds;
+  if (r0 < box.y0) r0 = box.y0;
+  if (r1 > box.y1) r1 = box.y1;
+
+  if (r0 >= r1)
+    return true;
+
+  // Edges at the right of the box never change the winding of the pixels
+  // inside the box.
+  if (Math::min(x0, x1) > (box.x1 << 8) - 128)
+    return true;
+
+  if (self->_length == self->_capacity && !AliasedRasterizer8_grow(self))
+    return false;
+
+  AliasedRasterizer8::Edge& edge = self->_edges[self->_length++];
+  double slope = double(x1 - x0) / double(y1 - y0);
+
+  // The x is stored relative to the pixel center, so the first pixel at the
+  // right of the crossing is simply ceil(x). The small bias makes the result
+  // stable when the crossing is exactly at the pixel center (the pixel is
+  // then always filled by the left edge).
+  edge.x = (double(x0) + double((r0 << 8) + 128 - y0) * slope) * (1.0 / 256.0) - (0.5 + 1e-7);
+  edge.slope = slope;
+  edge.y0 = r0;
+  edge.y1 = r1;
+  edge.dir = dir;
+  return true;
+}
+
+template<typename SrcT>
+static err_t AliasedRasterizer8_initT(AliasedRasterizer8* self,
+  const SrcT_(Path)* path, const SrcT_(Point)* offset, uint32_t fillRule, const BoxI* box)
+{
+  // The box should be already clipped to the scene-box.
+  FOG_ASSERT(self->_sceneBox.subsumes(*box));
+  FOG_ASSERT(self->_clipType < RASTER_CLIP_COUNT);
+
+  self->_initialized = false;
+  self->_length = 0;
+  self->_boxBounds = *box;
+  self->_error = ERR_OK;
+
+  if (fillRule == FILL_RULE_EVEN_ODD)
+    self->_render = Rasterizer_api.aliased8.render_evenodd[self->_clipType];
+  else
+    self->_render = Rasterizer_api.aliased8.render_nonzero[self->_clipType];
+
+  if (path->getLength() < 2 || !box->isValid())
+    return ERR_OK;
+
+  PathRasterizer8_addPathData<SrcT>(self,
+    path->getVertices(), path->getCommands(), path->getLength(), *offset);
+
+  if (FOG_IS_ERROR(self->_error))
+    return self->_error;
+
+  size_t length = self->_length;
+  if (length == 0)
+    return ERR_OK;
+
+  // --------------------------------------------------------------------------
+  // [Edge Table]
+  // --------------------------------------------------------------------------
+
+  size_t h = (uint)box->getHeight();
+  uint8_t* mem = reinterpret_cast<uint8_t*>(self->_buffer.alloc(
+    length * sizeof(AliasedRasterizer8::Active) + h * sizeof(uint32_t)));
+
+  if (FOG_IS_NULL(mem))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  self->_active = reinterpret_cast<AliasedRasterizer8::Active*>(mem);
+  self->_rows = reinterpret_cast<uint32_t*>(self->_active + length);
+  MemOps::set(self->_rows, 0xFF, h * sizeof(uint32_t));
+
+  AliasedRasterizer8::Edge* edges = self->_edges;
+  int y0 = box->y1;
+  int y1 = box->y0;
+
+  size_t i = length;
+  while (i)
+  {
+    AliasedRasterizer8::Edge& edge = edges[--i];
+    uint32_t* row = &self->_rows[edge.y0 - box->y0];
+
+    edge.next = *row;
+    *row = (uint32_t)i;
+
+    if (y0 > edge.y0) y0 = edge.y0;
+    if (y1 < edge.y1) y1 = edge.y1;
+  }
+
+  // Rows are indexed from the top of the box to render.
+  self->_rows += y0 - box->y0;
+  self->_boxBounds.y0 = y0;
+  self->_boxBounds.y1 = y1;
+  self->_initialized = true;
+
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL AliasedRasterizer8_initF(AliasedRasterizer8* self,
+  const PathF* path, const PointF* offset, uint32_t fillRule, const BoxI* box)
+{
+  return AliasedRasterizer8_initT<float>(self, path, offset, fillRule, box);
+}
+
+static err_t FOG_CDECL AliasedRasterizer8_initD(AliasedRasterizer8* self,
+  const PathD* path, const PointD* offset, uint32_t fillRule, const BoxI* box)
+{
+  return AliasedRasterizer8_initT<double>(self, path, offset, fillRule, box);
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Render - Helpers]
+// ============================================================================
+
+template<int _RULE>
+static FOG_INLINE bool AliasedRasterizer8_isInside(int winding)
+{
+  if (_RULE == FILL_RULE_EVEN_ODD)
+    return (winding & 1) != 0;
+  else
+    return winding != 0;
+}
+
+//! @internal
+//!
+//! @brief Sort the active list by x (insertion sort, the list is sorted or
+//! nearly sorted, edges only swap where they intersect).
+static FOG_INLINE void AliasedRasterizer8_sortActive(AliasedRasterizer8::Active* active, size_t length)
+{
+  for (size_t i = 1; i < length; i++)
+  {
+    AliasedRasterizer8::Active item = active[i];
+    size_t j = i;
+
+    while (j > 0 && active[j - 1].x > item.x)
+    {
+      active[j] = active[j - 1];
+      j--;
+    }
+
+    active[j] = item;
+  }
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Render - Clip-Box]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL AliasedRasterizer8_render_st_clip_box(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  AliasedRasterizer8* self = static_cast<AliasedRasterizer8*>(_self);
+  const BoxI& box = self->_boxBounds;
+
+  if (!self->_initialized)
+    return;
+
+  int bx0 = box.x0;
+  int bx1 = box.x1;
+
+  int y = box.y0;
+  int yEnd = box.y1;
+
+  const AliasedRasterizer8::Edge* edges = self->_edges;
+  const uint32_t* rows = self->_rows;
+
+  AliasedRasterizer8::Active* active = self->_active;
+  size_t activeLength = 0;
+
+  uint32_t opacity = self->_opacity;
+  int pendingSkip = 0;
+
+  // --------------------------------------------------------------------------
+  // [Prepare]
+  // --------------------------------------------------------------------------
+
+  filler->prepare(y);
+  RasterFiller::ProcessFunc process = filler->_process;
+
+  // --------------------------------------------------------------------------
+  // [Process]
+  // --------------------------------------------------------------------------
+
+  for (; y < yEnd; y++)
+  {
+    size_t i;
+
+    for (uint32_t index = rows[y - box.y0]; index != AliasedRasterizer8_NONE; index = edges[index].next)
+    {
+      active[activeLength].x = edges[index].x;
+      active[activeLength].index = index;
+      activeLength++;
+    }
+    AliasedRasterizer8_sortActive(active, activeLength);
+
+    // Pixel 'x' is at the right of the crossing if its center 'x + 0.5' is
+    // greater or equal to the crossing, see Rasterizer8_addLine().
+    RasterSpan8* span = scanline->begin();
+    int winding = 0;
+    int x0 = bx0;
+    int lastX1 = bx0 - 1;
+
+    for (i = 0; i < activeLength; i++)
+    {
+      bool wasInside = AliasedRasterizer8_isInside<_RULE>(winding);
+      winding += edges[active[i].index].dir;
+
+      if (wasInside == AliasedRasterizer8_isInside<_RULE>(winding))
+        continue;
+
+      int x = Math::bound<int>(Math::iceil(active[i].x), bx0, bx1);
+      if (!wasInside)
+      {
+        x0 = x;
+        continue;
+      }
+
+      if (x0 >= x)
+        continue;
+
+      if (x0 == lastX1)
+      {
+        span->setX1(x);
+      }
+      else
+      {
+        NEW_SPAN(span, return);
+        span->setPositionAndType(x0, x, RASTER_SPAN_C);
+        span->setConstMask(opacity);
+      }
+      lastX1 = x;
+    }
+
+    // Edges at the right of the box were not added, so the last span can be
+    // still open.
+    if (AliasedRasterizer8_isInside<_RULE>(winding) && x0 < bx1)
+    {
+      if (x0 == lastX1)
+      {
+        span->setX1(bx1);
+      }
+      else
+      {
+        NEW_SPAN(span, return);
+        span->setPositionAndType(x0, bx1, RASTER_SPAN_C);
+        span->setConstMask(opacity);
+      }
+    }
+
+    span = scanline->end(span);
+    if (span == NULL)
+    {
+      pendingSkip++;
+    }
+    else
+    {
+      if (pendingSkip)
+      {
+        filler->_skip(filler, pendingSkip);
+        pendingSkip = 0;
+      }
+
+      process(filler, span);
+    }
+
+    // Advance to the next row and remove the finished edges.
+    size_t j = 0;
+    for (i = 0; i < activeLength; i++)
+    {
+      const AliasedRasterizer8::Edge& edge = edges[active[i].index];
+      if (edge.y1 > y + 1)
+      {
+        active[j].x = active[i].x + edge.slope;
+        active[j].index = active[i].index;
+        j++;
+      }
+    }
+    activeLength = j;
+  }
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Render - Clip-Region]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL AliasedRasterizer8_render_st_clip_region(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  Rasterizer8ClipRegionFiller clipFiller;
+  Rasterizer8ClipRegionFiller_init(&clipFiller, _self, filler, scanline);
+
+  AliasedRasterizer8_render_st_clip_box<_RULE>(_self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Fog::AliasedRasterizer8 - Render - Clip-Mask]
+// ============================================================================
+
+template<int _RULE>
+static void FOG_CDECL AliasedRasterizer8_render_st_clip_mask(
+  Rasterizer8* _self, RasterFiller* filler, RasterScanline8* scanline)
+{
+  // The clip-box render doesn't use the scanline mask, the intersection is
+  // stored at its start.
+  Rasterizer8ClipMaskFiller clipFiller;
+  if (!Rasterizer8ClipMaskFiller_init(&clipFiller, _self, filler, scanline, 0, false))
+    return;
+
+  AliasedRasterizer8_render_st_clip_box<_RULE>(_self, &clipFiller, scanline);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_CPU_DECLARE_INITIALIZER_SSE2( Rasterizer_init_SSE2(void) )
+FOG_CPU_DECLARE_INITIALIZER_AVX2( Rasterizer_init_AVX2(void) )
+
+FOG_NO_EXPORT void Rasterizer_init(void)
+{
+  // --------------------------------------------------------------------------
+  // [Fog::BoxRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.box8.init32x0 = BoxRasterizer8_init32x0;
+  Rasterizer_api.box8.init24x8 = BoxRasterizer8_init24x8;
+
+  Rasterizer_api.box8.render_32x0[RASTER_CLIP_BOX   ] = BoxRasterizer8_render_32x0_st_clip_box;
+  Rasterizer_api.box8.render_32x0[RASTER_CLIP_REGION] = BoxRasterizer8_render_32x0_st_clip_region;
+  Rasterizer_api.box8.render_32x0[RASTER_CLIP_MASK  ] = BoxRasterizer8_render_32x0_st_clip_mask;
+
+  Rasterizer_api.box8.render_24x8[RASTER_CLIP_BOX   ] = BoxRasterizer8_render_24x8_st_clip_box;
+  Rasterizer_api.box8.render_24x8[RASTER_CLIP_REGION] = BoxRasterizer8_render_24x8_st_clip_region;
+  Rasterizer_api.box8.render_24x8[RASTER_CLIP_MASK  ] = BoxRasterizer8_render_24x8_st_clip_mask;
+
+  // --------------------------------------------------------------------------
+  // [Fog::PathRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO, 0>;
+  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO, 0>;
+  Rasterizer_api.path8.render_nonzero[0][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO, 0>;
+
+  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO, 1>;
+  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO, 1>;
+  Rasterizer_api.path8.render_nonzero[1][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO, 1>;
+
+  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD, 0>;
+  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD, 0>;
+  Rasterizer_api.path8.render_evenodd[0][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD, 0>;
+
+  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_BOX   ] = PathRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD, 1>;
+  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_REGION] = PathRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD, 1>;
+  Rasterizer_api.path8.render_evenodd[1][RASTER_CLIP_MASK  ] = PathRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD, 1>;
+
+  // --------------------------------------------------------------------------
+  // [Fog::GlyphRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.glyph8.init = GlyphRasterizer8_init;
+
+  Rasterizer_api.glyph8.render[RASTER_CLIP_BOX   ] = GlyphRasterizer8_render_st_clip_box;
+  Rasterizer_api.glyph8.render[RASTER_CLIP_REGION] = GlyphRasterizer8_render_st_clip_region;
+  Rasterizer_api.glyph8.render[RASTER_CLIP_MASK  ] = GlyphRasterizer8_render_st_clip_mask;
+
+  // --------------------------------------------------------------------------
+  // [Fog::HairlineRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.hairline8.init = HairlineRasterizer8_init;
+
+  Rasterizer_api.hairline8.render[RASTER_CLIP_BOX   ] = HairlineRasterizer8_render_st_clip_box;
+  Rasterizer_api.hairline8.render[RASTER_CLIP_REGION] = HairlineRasterizer8_render_st_clip_region;
+  Rasterizer_api.hairline8.render[RASTER_CLIP_MASK  ] = HairlineRasterizer8_render_st_clip_mask;
+
+  // --------------------------------------------------------------------------
+  // [Fog::AliasedRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.aliased8.initF = AliasedRasterizer8_initF;
+  Rasterizer_api.aliased8.initD = AliasedRasterizer8_initD;
+
+  Rasterizer_api.aliased8.render_nonzero[RASTER_CLIP_BOX   ] = AliasedRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO>;
+  Rasterizer_api.aliased8.render_nonzero[RASTER_CLIP_REGION] = AliasedRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO>;
+  Rasterizer_api.aliased8.render_nonzero[RASTER_CLIP_MASK  ] = AliasedRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO>;
+
+  Rasterizer_api.aliased8.render_evenodd[RASTER_CLIP_BOX   ] = AliasedRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD>;
+  Rasterizer_api.aliased8.render_evenodd[RASTER_CLIP_REGION] = AliasedRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD>;
+  Rasterizer_api.aliased8.render_evenodd[RASTER_CLIP_MASK  ] = AliasedRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD>;
+
+  // --------------------------------------------------------------------------
+  // [Fog::DensePathRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.dense8.initF = DensePathRasterizer8_initF;
+  Rasterizer_api.dense8.initD = DensePathRasterizer8_initD;
+
+  Rasterizer_api.dense8.sweep_nonzero = DensePathRasterizer8_sweep<FILL_RULE_NON_ZERO>;
+  Rasterizer_api.dense8.sweep_evenodd = DensePathRasterizer8_sweep<FILL_RULE_EVEN_ODD>;
+
+  Rasterizer_api.dense8.render_nonzero[RASTER_CLIP_BOX   ] = DensePathRasterizer8_render_st_clip_box   <FILL_RULE_NON_ZERO>;
+  Rasterizer_api.dense8.render_nonzero[RASTER_CLIP_REGION] = DensePathRasterizer8_render_st_clip_region<FILL_RULE_NON_ZERO>;
+  Rasterizer_api.dense8.render_nonzero[RASTER_CLIP_MASK  ] = DensePathRasterizer8_render_st_clip_mask  <FILL_RULE_NON_ZERO>;
+
+  Rasterizer_api.dense8.render_evenodd[RASTER_CLIP_BOX   ] = DensePathRasterizer8_render_st_clip_box   <FILL_RULE_EVEN_ODD>;
+  Rasterizer_api.dense8.render_evenodd[RASTER_CLIP_REGION] = DensePathRasterizer8_render_st_clip_region<FILL_RULE_EVEN_ODD>;
+  Rasterizer_api.dense8.render_evenodd[RASTER_CLIP_MASK  ] = DensePathRasterizer8_render_st_clip_mask  <FILL_RULE_EVEN_ODD>;
+
+  // --------------------------------------------------------------------------
+  // [CPU Based Optimizations]
+  // --------------------------------------------------------------------------
+
+  FOG_CPU_USE_INITIALIZER_SSE2( Rasterizer_init_SSE2() )
+  FOG_CPU_USE_INITIALIZER_AVX2( Rasterizer_init_AVX2() )
 }
 
 } // Fog namespace
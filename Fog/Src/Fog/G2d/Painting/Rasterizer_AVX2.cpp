@@ -0,0 +1,148 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Acc/AccAvx2.h>
+#include <Fog/Core/Global/Global.h>
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/Rasterizer_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Constants (AVX2)]
+// ============================================================================
+
+FOG_YMM_DECLARE_CONST_PI32_VAR(DensePathRasterizer8_HiLane, -1, -1, -1, -1, 0, 0, 0, 0);
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Sweep (AVX2)]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Resolve 16 cells per iteration.
+//!
+//! The prefix-sum is calculated within each 128-bit lane, then the last cell
+//! of the low lane is added to the high lane and the last cell of the whole
+//! register is broadcasted as a carry to the next 8 cells.
+template<int _RULE>
+static int32_t FOG_CDECL DensePathRasterizer8_sweep_AVX2(uint16_t* dst, int32_t* acc, size_t w, uint32_t opacity)
+{
+  __m256i ymmCarry;
+  __m256i ymmZero;
+  __m256i ymmIdx3;
+  __m256i ymmIdx7;
+  __m256i ymmLimit;
+  __m256i ymmMask;
+  __m256i ymmOpacity;
+
+  Acc::m256iZero(ymmCarry);
+  Acc::m256iZero(ymmZero);
+
+  Acc::m256iExpandPI32FromSI32(ymmIdx3, 3);
+  Acc::m256iExpandPI32FromSI32(ymmIdx7, 7);
+
+  Acc::m256iExpandPI16FromSI16(ymmLimit, _RULE == FILL_RULE_EVEN_ODD ? 512 : 256);
+  Acc::m256iExpandPI32FromSI32(ymmMask, 511);
+
+  // Opacity is applied as 'alpha * (opacity << 8) >> 16'.
+  Acc::m256iExpandPI16FromSI16(ymmOpacity, (int)(opacity << 8));
+
+  for (size_t i = 0; i < w; i += 16, acc += 16, dst += 16)
+  {
+    __m256i ymm0, ymm1;
+    __m256i ymmT0, ymmT1;
+
+    Acc::m256iLoad32u(ymm0, acc + 0);
+    Acc::m256iLoad32u(ymm1, acc + 8);
+
+    Acc::m256iStore32u(acc + 0, ymmZero);
+    Acc::m256iStore32u(acc + 8, ymmZero);
+
+    // Prefix-sum (within lanes).
+    Acc::m256iLShiftSU128<32>(ymmT0, ymm0);
+    Acc::m256iLShiftSU128<32>(ymmT1, ymm1);
+    Acc::m256iAddPI32(ymm0, ymm0, ymmT0);
+    Acc::m256iAddPI32(ymm1, ymm1, ymmT1);
+
+    Acc::m256iLShiftSU128<64>(ymmT0, ymm0);
+    Acc::m256iLShiftSU128<64>(ymmT1, ymm1);
+    Acc::m256iAddPI32(ymm0, ymm0, ymmT0);
+    Acc::m256iAddPI32(ymm1, ymm1, ymmT1);
+
+    // Prefix-sum (across lanes).
+    Acc::m256iPermutePI32(ymmT0, ymm0, ymmIdx3);
+    Acc::m256iPermutePI32(ymmT1, ymm1, ymmIdx3);
+    Acc::m256iAnd(ymmT0, ymmT0, FOG_YMM_GET_CONST_PI(DensePathRasterizer8_HiLane));
+    Acc::m256iAnd(ymmT1, ymmT1, FOG_YMM_GET_CONST_PI(DensePathRasterizer8_HiLane));
+    Acc::m256iAddPI32(ymm0, ymm0, ymmT0);
+    Acc::m256iAddPI32(ymm1, ymm1, ymmT1);
+
+    Acc::m256iAddPI32(ymm0, ymm0, ymmCarry);
+    Acc::m256iPermutePI32(ymmCarry, ymm0, ymmIdx7);
+    Acc::m256iAddPI32(ymm1, ymm1, ymmCarry);
+    Acc::m256iPermutePI32(ymmCarry, ymm1, ymmIdx7);
+
+    // Absolute value.
+    Acc::m256iAbsPI32(ymm0, ymm0);
+    Acc::m256iAbsPI32(ymm1, ymm1);
+
+    Acc::m256iRShiftPU32<9>(ymm0, ymm0);
+    Acc::m256iRShiftPU32<9>(ymm1, ymm1);
+
+    // Alpha, the pack works within lanes, so the result is permuted back.
+    if (_RULE == FILL_RULE_EVEN_ODD)
+    {
+      Acc::m256iAnd(ymm0, ymm0, ymmMask);
+      Acc::m256iAnd(ymm1, ymm1, ymmMask);
+      Acc::m256iPackPI16FromPI32(ymm0, ymm0, ymm1);
+
+      Acc::m256iSubPI16(ymm1, ymmLimit, ymm0);
+      Acc::m256iMinPI16(ymm0, ymm0, ymm1);
+    }
+    else
+    {
+      Acc::m256iPackPI16FromPI32(ymm0, ymm0, ymm1);
+      Acc::m256iMinPI16(ymm0, ymm0, ymmLimit);
+    }
+
+    Acc::m256iPermutePI64<3, 1, 2, 0>(ymm0, ymm0);
+
+    if (opacity < 256)
+      Acc::m256iMulHiPU16(ymm0, ymm0, ymmOpacity);
+
+    Acc::m256iStore32u(dst, ymm0);
+  }
+
+  __m128i xmmCarry;
+  int32_t cover;
+
+  Acc::m128iFromM256iLo(xmmCarry, ymmCarry);
+  Acc::m128iCvtSIFromSI128(cover, xmmCarry);
+  return cover;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Rasterizer_init_AVX2(void)
+{
+  // --------------------------------------------------------------------------
+  // [Fog::DensePathRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.dense8.sweep_nonzero = DensePathRasterizer8_sweep_AVX2<FILL_RULE_NON_ZERO>;
+  Rasterizer_api.dense8.sweep_evenodd = DensePathRasterizer8_sweep_AVX2<FILL_RULE_EVEN_ODD>;
+}
+
+} // Fog namespace
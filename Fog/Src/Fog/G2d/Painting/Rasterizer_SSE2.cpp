@@ -0,0 +1,131 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Acc/AccSse2.h>
+#include <Fog/Core/Global/Global.h>
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/Rasterizer_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::DensePathRasterizer8 - Sweep (SSE2)]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Resolve 8 cells per iteration.
+//!
+//! The prefix-sum of 4 cells is calculated by two shifted additions and the
+//! last cell is then broadcasted as a carry to the next 4 cells.
+template<int _RULE>
+static int32_t FOG_CDECL DensePathRasterizer8_sweep_SSE2(uint16_t* dst, int32_t* acc, size_t w, uint32_t opacity)
+{
+  __m128i xmmCarry;
+  __m128i xmmZero;
+  __m128i xmmLimit;
+  __m128i xmmMask;
+  __m128i xmmOpacity;
+
+  Acc::m128iZero(xmmCarry);
+  Acc::m128iZero(xmmZero);
+
+  Acc::m128iCvtSI128FromSI(xmmLimit, _RULE == FILL_RULE_EVEN_ODD ? 512 : 256);
+  Acc::m128iExtendPI16FromSI16(xmmLimit, xmmLimit);
+
+  Acc::m128iCvtSI128FromSI(xmmMask, 511);
+  Acc::m128iExtendPI32FromSI32(xmmMask, xmmMask);
+
+  // Opacity is applied as 'alpha * (opacity << 8) >> 16'.
+  Acc::m128iCvtSI128FromSI(xmmOpacity, (int)(opacity << 8));
+  Acc::m128iExtendPI16FromSI16(xmmOpacity, xmmOpacity);
+
+  for (size_t i = 0; i < w; i += 8, acc += 8, dst += 8)
+  {
+    __m128i xmm0, xmm1;
+    __m128i xmmT0, xmmT1;
+
+    Acc::m128iLoad16u(xmm0, acc + 0);
+    Acc::m128iLoad16u(xmm1, acc + 4);
+
+    Acc::m128iStore16u(acc + 0, xmmZero);
+    Acc::m128iStore16u(acc + 4, xmmZero);
+
+    // Prefix-sum.
+    Acc::m128iLShiftSU128<32>(xmmT0, xmm0);
+    Acc::m128iLShiftSU128<32>(xmmT1, xmm1);
+    Acc::m128iAddPI32(xmm0, xmm0, xmmT0);
+    Acc::m128iAddPI32(xmm1, xmm1, xmmT1);
+
+    Acc::m128iLShiftSU128<64>(xmmT0, xmm0);
+    Acc::m128iLShiftSU128<64>(xmmT1, xmm1);
+    Acc::m128iAddPI32(xmm0, xmm0, xmmT0);
+    Acc::m128iAddPI32(xmm1, xmm1, xmmT1);
+
+    Acc::m128iAddPI32(xmm0, xmm0, xmmCarry);
+    Acc::m128iShufflePI32<3, 3, 3, 3>(xmmCarry, xmm0);
+    Acc::m128iAddPI32(xmm1, xmm1, xmmCarry);
+    Acc::m128iShufflePI32<3, 3, 3, 3>(xmmCarry, xmm1);
+
+    // Absolute value.
+    Acc::m128iRShiftPI32<31>(xmmT0, xmm0);
+    Acc::m128iRShiftPI32<31>(xmmT1, xmm1);
+    Acc::m128iXor(xmm0, xmm0, xmmT0);
+    Acc::m128iXor(xmm1, xmm1, xmmT1);
+    Acc::m128iSubPI32(xmm0, xmm0, xmmT0);
+    Acc::m128iSubPI32(xmm1, xmm1, xmmT1);
+
+    Acc::m128iRShiftPU32<9>(xmm0, xmm0);
+    Acc::m128iRShiftPU32<9>(xmm1, xmm1);
+
+    // Alpha.
+    if (_RULE == FILL_RULE_EVEN_ODD)
+    {
+      Acc::m128iAnd(xmm0, xmm0, xmmMask);
+      Acc::m128iAnd(xmm1, xmm1, xmmMask);
+      Acc::m128iPackPI16FromPI32(xmm0, xmm0, xmm1);
+
+      Acc::m128iSubPI16(xmm1, xmmLimit, xmm0);
+      Acc::m128iMinPI16(xmm0, xmm0, xmm1);
+    }
+    else
+    {
+      Acc::m128iPackPI16FromPI32(xmm0, xmm0, xmm1);
+      Acc::m128iMinPI16(xmm0, xmm0, xmmLimit);
+    }
+
+    if (opacity < 256)
+      Acc::m128iMulHiPU16(xmm0, xmm0, xmmOpacity);
+
+    Acc::m128iStore16u(dst, xmm0);
+  }
+
+  int32_t cover;
+  Acc::m128iCvtSIFromSI128(cover, xmmCarry);
+  return cover;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Rasterizer_init_SSE2(void)
+{
+  // --------------------------------------------------------------------------
+  // [Fog::DensePathRasterizer8]
+  // --------------------------------------------------------------------------
+
+  Rasterizer_api.dense8.sweep_nonzero = DensePathRasterizer8_sweep_SSE2<FILL_RULE_NON_ZERO>;
+  Rasterizer_api.dense8.sweep_evenodd = DensePathRasterizer8_sweep_SSE2<FILL_RULE_EVEN_ODD>;
+}
+
+} // Fog namespace
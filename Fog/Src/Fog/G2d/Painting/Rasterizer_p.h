@@ -10,6 +10,7 @@
 // [Dependencies]
 #include <Fog/Core/Global/Global.h>
 #include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemZoneAllocator.h>
 #include <Fog/Core/Tools/String.h>
 #include <Fog/G2d/Geometry/Box.h>
@@ -59,6 +60,74 @@ struct FOG_NO_EXPORT RasterizerApi
     Render8Func render_nonzero[2][RASTER_CLIP_COUNT];
     Render8Func render_evenodd[2][RASTER_CLIP_COUNT];
   } path8;
+
+  // --------------------------------------------------------------------------
+  // [Dense]
+  // --------------------------------------------------------------------------
+
+  typedef err_t (FOG_CDECL *DensePathRasterizer8_InitF)(DensePathRasterizer8* self, const PathF* path, const PointF* offset, uint32_t fillRule, const BoxI* box);
+  typedef err_t (FOG_CDECL *DensePathRasterizer8_InitD)(DensePathRasterizer8* self, const PathD* path, const PointD* offset, uint32_t fillRule, const BoxI* box);
+
+  //! @brief Resolve @a w accumulated cells at @a acc into the mask at @a dst
+  //! and clear them, returns the prefix-sum of the last cell.
+  //!
+  //! The count of processed cells is @a w rounded up to @c RASTER_DENSE_BLOCK,
+  //! the cells after @a w must be zero.
+  typedef int32_t (FOG_CDECL *DensePathRasterizer8_Sweep)(uint16_t* dst, int32_t* acc, size_t w, uint32_t opacity);
+
+  struct _Api_DensePathRasterizer8
+  {
+    DensePathRasterizer8_InitF initF;
+    DensePathRasterizer8_InitD initD;
+
+    DensePathRasterizer8_Sweep sweep_nonzero;
+    DensePathRasterizer8_Sweep sweep_evenodd;
+
+    Render8Func render_nonzero[RASTER_CLIP_COUNT];
+    Render8Func render_evenodd[RASTER_CLIP_COUNT];
+  } dense8;
+
+  // --------------------------------------------------------------------------
+  // [Glyph]
+  // --------------------------------------------------------------------------
+
+  typedef void (FOG_CDECL *GlyphRasterizer8_Init)(GlyphRasterizer8* self, const RasterGlyphItem8* items, size_t length, const BoxI* box);
+
+  struct _Api_GlyphRasterizer8
+  {
+    GlyphRasterizer8_Init init;
+
+    Render8Func render[RASTER_CLIP_COUNT];
+  } glyph8;
+
+  // --------------------------------------------------------------------------
+  // [Hairline]
+  // --------------------------------------------------------------------------
+
+  typedef err_t (FOG_CDECL *HairlineRasterizer8_Init)(HairlineRasterizer8* self, const PathF* path, const BoxI* box);
+
+  struct _Api_HairlineRasterizer8
+  {
+    HairlineRasterizer8_Init init;
+
+    Render8Func render[RASTER_CLIP_COUNT];
+  } hairline8;
+
+  // --------------------------------------------------------------------------
+  // [Aliased]
+  // --------------------------------------------------------------------------
+
+  typedef err_t (FOG_CDECL *AliasedRasterizer8_InitF)(AliasedRasterizer8* self, const PathF* path, const PointF* offset, uint32_t fillRule, const BoxI* box);
+  typedef err_t (FOG_CDECL *AliasedRasterizer8_InitD)(AliasedRasterizer8* self, const PathD* path, const PointD* offset, uint32_t fillRule, const BoxI* box);
+
+  struct _Api_AliasedRasterizer8
+  {
+    AliasedRasterizer8_InitF initF;
+    AliasedRasterizer8_InitD initD;
+
+    Render8Func render_nonzero[RASTER_CLIP_COUNT];
+    Render8Func render_evenodd[RASTER_CLIP_COUNT];
+  } aliased8;
 };
 
 extern FOG_NO_EXPORT RasterizerApi Rasterizer_api;
@@ -677,6 +746,379 @@ private:
   FOG_NO_COPY(PathRasterizer8)
 };
 
+// ============================================================================
+// [Fog::DensePathRasterizer8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Dense-accumulation path/polygon rasterizer (8-bit).
+//!
+//! An alternative to @c PathRasterizer8 for complex paths. The path is
+//! flattened (using the same subdivision as @c PathRasterizer8) into lines,
+//! which are bucketed by bands of rows. Lines crossing the band are walked
+//! cell by cell, but the cover and area of each cell are accumulated directly
+//! into a dense buffer of 32-bit integers (one per pixel), so there is no cell
+//! list to sort and merge. Each row of the band is then resolved by a prefix
+//! sum (@c RasterizerApi::dense8 sweep, SSE2/AVX2 when available), which also
+//! clears the buffer for the next band.
+//!
+//! The sweep costs the area of the path bounding-box instead of the count of
+//! cells, the paint engine selects the rasterizer using RASTER_DENSE_*
+//! thresholds (see @c RASTER_CORE) or @c PAINTER_PARAMETER_PATH_RASTERIZER_I.
+//!
+//! The buffers are kept between paths, so the rasterizer should be reused
+//! (the paint engine keeps one per context).
+struct FOG_NO_EXPORT DensePathRasterizer8 : public Rasterizer8
+{
+  // --------------------------------------------------------------------------
+  // [Line]
+  // --------------------------------------------------------------------------
+
+  struct FOG_NO_EXPORT Line
+  {
+    //! @brief Start point (24.8 fixed point, clipped horizontally).
+    int x0, y0;
+    //! @brief End point (24.8 fixed point, clipped horizontally).
+    int x1, y1;
+
+    //! @brief Next line starting in the same band.
+    uint32_t next;
+  };
+
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  DensePathRasterizer8();
+  ~DensePathRasterizer8();
+
+  // --------------------------------------------------------------------------
+  // [Setup]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the rasterizer.
+  //!
+  //! @param path Path in device space (may contain curves), translated by
+  //! @a offset.
+  //! @param fillRule Fill rule, see @c FILL_RULE.
+  //! @param box Box to render, must be clipped to the scene-box.
+  FOG_INLINE err_t init(const PathF& path, const PointF& offset, uint32_t fillRule, const BoxI& box)
+  {
+    return Rasterizer_api.dense8.initF(this, &path, &offset, fillRule, &box);
+  }
+
+  //! @overload
+  FOG_INLINE err_t init(const PathD& path, const PointD& offset, uint32_t fillRule, const BoxI& box)
+  {
+    return Rasterizer_api.dense8.initD(this, &path, &offset, fillRule, &box);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Lines.
+  Line* _lines;
+  //! @brief Count of lines.
+  size_t _length;
+  //! @brief Capacity of @c _lines.
+  size_t _capacity;
+
+  //! @brief Box to render (bounding box of all lines, clipped).
+  BoxI _boxBounds;
+  //! @brief Horizontal clip of lines, in 24.8 fixed point (used by init).
+  int _clipX0, _clipX1;
+
+  //! @brief Height of one band.
+  int _bandHeight;
+  //! @brief Stride of the accumulation buffer (count of cells per row).
+  size_t _stride;
+
+  //! @brief Accumulation buffer (one band).
+  int32_t* _acc;
+  //! @brief The first and last touched cell per row of the band.
+  int* _rowX;
+  //! @brief First line starting in the band (per band of @c _boxBounds).
+  uint32_t* _bands;
+  //! @brief The active list, used by render.
+  uint32_t* _active;
+
+  //! @brief Error code (out of memory while adding lines).
+  err_t _error;
+
+  //! @brief Storage of the accumulation buffer, rows, bands and active list.
+  MemBuffer _buffer;
+
+private:
+  FOG_NO_COPY(DensePathRasterizer8)
+};
+
+// ============================================================================
+// [Fog::GlyphRasterizer8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Rasterizer of pre-rasterized glyphs (see @c RasterGlyphCache).
+//!
+//! The rasterizer doesn't rasterize anything, it only generates spans from
+//! cached A8 glyph masks. A glyph which doesn't overlap with any other glyph
+//! on the scanline is passed to the filler as @c RASTER_SPAN_A8_GLYPH span
+//! pointing directly into the glyph mask (no copy). Overlapping glyphs and
+//! glyphs rendered with opacity are accumulated into @c RASTER_SPAN_AX_EXTRA
+//! spans.
+struct FOG_NO_EXPORT GlyphRasterizer8 : public Rasterizer8
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE GlyphRasterizer8()
+  {
+  }
+
+  FOG_INLINE ~GlyphRasterizer8()
+  {
+  }
+
+  // --------------------------------------------------------------------------
+  // [Setup]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the rasterizer.
+  //!
+  //! @param items Glyphs sorted by x, must be valid until rendered.
+  //! @param length Count of glyphs.
+  //! @param box Box to render, must be clipped to the scene-box.
+  FOG_INLINE void init(const RasterGlyphItem8* items, size_t length, const BoxI& box)
+  {
+    Rasterizer_api.glyph8.init(this, items, length, &box);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Glyphs.
+  const RasterGlyphItem8* _items;
+  //! @brief Count of glyphs.
+  size_t _length;
+  //! @brief Box to render.
+  BoxI _boxBounds;
+
+private:
+  FOG_NO_COPY(GlyphRasterizer8)
+};
+
+// ============================================================================
+// [Fog::HairlineRasterizer8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Anti-aliased hairline rasterizer.
+//!
+//! The rasterizer renders each line segment of the path as an ideal line (one
+//! pixel wide, measured along the minor axis of the segment). The coverage of
+//! each pixel is computed directly from the distance of its center to the line
+//! (Wu's algorithm with the fractional coverage of the end-points), there are
+//! no cells and no sweep, so the cost is proportional to the count of touched
+//! pixels.
+//!
+//! Segments are bucketed by their first row and rendered using an active list,
+//! coverage of overlapping segments is accumulated (saturated) into the
+//! scanline mask and passed to the filler as @c RASTER_SPAN_AX_EXTRA spans.
+struct FOG_NO_EXPORT HairlineRasterizer8 : public Rasterizer8
+{
+  // --------------------------------------------------------------------------
+  // [Segment]
+  // --------------------------------------------------------------------------
+
+  struct FOG_NO_EXPORT Segment
+  {
+    //! @brief Start point (the major coordinate is always increasing).
+    float x0, y0;
+    //! @brief End point.
+    float x1, y1;
+
+    //! @brief Minor delta per one major unit.
+    float slope;
+    //! @brief Half of the extent of the line band in the major direction
+    //! (the reciprocal of @c slope, only used by x-major segments).
+    float extent;
+
+    //! @brief Whether the y is the major axis.
+    uint32_t yMajor;
+    //! @brief The last row touched by the segment (exclusive).
+    int rowEnd;
+  };
+
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE HairlineRasterizer8()
+  {
+  }
+
+  FOG_INLINE ~HairlineRasterizer8()
+  {
+  }
+
+  // --------------------------------------------------------------------------
+  // [Setup]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the rasterizer.
+  //!
+  //! @param path Path in device space, containing only move-to, line-to and
+  //! close commands.
+  //! @param box Box to render, must be clipped to the scene-box.
+  FOG_INLINE err_t init(const PathF& path, const BoxI& box)
+  {
+    return Rasterizer_api.hairline8.init(this, &path, &box);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Segments.
+  Segment* _segments;
+  //! @brief Next segment starting at the same row (per segment).
+  uint32_t* _next;
+  //! @brief The active list, used by render.
+  uint32_t* _active;
+  //! @brief First segment starting at the row (per row of @c _boxBounds).
+  uint32_t* _rows;
+
+  //! @brief Count of segments.
+  size_t _length;
+  //! @brief Box to render (bounding box of all segments, clipped).
+  BoxI _boxBounds;
+
+  //! @brief Storage of segments, lists and rows.
+  MemBufferTmp<2048> _buffer;
+
+private:
+  FOG_NO_COPY(HairlineRasterizer8)
+};
+
+// ============================================================================
+// [Fog::AliasedRasterizer8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Aliased path/polygon rasterizer (used by @c RENDER_QUALITY_ALIASED).
+//!
+//! The path is flattened (using the same subdivision as @c PathRasterizer8)
+//! into non-horizontal edges, which are stored in an edge table bucketed by
+//! their first row. Each row is sampled at the pixel centers: edges crossing
+//! the row center are kept in an active list sorted by x, and a pixel is
+//! filled if its center is inside the path using the current fill rule.
+//!
+//! There are no cells and no coverage, the output is a list of solid spans
+//! (@c RASTER_SPAN_C, the mask is the rasterizer opacity), so the cost depends
+//! only on the count of edges per row, not on the length of the spans.
+struct FOG_NO_EXPORT AliasedRasterizer8 : public Rasterizer8
+{
+  // --------------------------------------------------------------------------
+  // [Edge]
+  // --------------------------------------------------------------------------
+
+  struct FOG_NO_EXPORT Edge
+  {
+    //! @brief X position at the center of the first row (relative to the
+    //! pixel center).
+    double x;
+    //! @brief X delta per one row.
+    double slope;
+
+    //! @brief The first row (its center is crossed by the edge).
+    int y0;
+    //! @brief The last row (exclusive).
+    int y1;
+
+    //! @brief Winding direction (1 or -1).
+    int dir;
+    //! @brief Next edge starting at the same row.
+    uint32_t next;
+  };
+
+  // --------------------------------------------------------------------------
+  // [Active]
+  // --------------------------------------------------------------------------
+
+  struct FOG_NO_EXPORT Active
+  {
+    //! @brief X position at the center of the current row (relative to the
+    //! pixel center).
+    double x;
+    //! @brief Edge index.
+    uint32_t index;
+  };
+
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  AliasedRasterizer8();
+  ~AliasedRasterizer8();
+
+  // --------------------------------------------------------------------------
+  // [Setup]
+  // --------------------------------------------------------------------------
+
+  //! @brief Initialize the rasterizer.
+  //!
+  //! @param path Path in device space (may contain curves), translated by
+  //! @a offset.
+  //! @param fillRule Fill rule, see @c FILL_RULE.
+  //! @param box Box to render, must be clipped to the scene-box.
+  FOG_INLINE err_t init(const PathF& path, const PointF& offset, uint32_t fillRule, const BoxI& box)
+  {
+    return Rasterizer_api.aliased8.initF(this, &path, &offset, fillRule, &box);
+  }
+
+  //! @overload
+  FOG_INLINE err_t init(const PathD& path, const PointD& offset, uint32_t fillRule, const BoxI& box)
+  {
+    return Rasterizer_api.aliased8.initD(this, &path, &offset, fillRule, &box);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Edges.
+  Edge* _edges;
+  //! @brief Count of edges.
+  size_t _length;
+  //! @brief Capacity of @c _edges.
+  size_t _capacity;
+
+  //! @brief The active list, used by render.
+  Active* _active;
+  //! @brief First edge starting at the row (per row of @c _boxBounds).
+  uint32_t* _rows;
+
+  //! @brief Box to render (bounding box of all edges, clipped).
+  BoxI _boxBounds;
+
+  //! @brief Error code (out of memory while adding edges).
+  err_t _error;
+
+  //! @brief Storage of the active list and rows.
+  MemBufferTmp<1024> _buffer;
+  //! @brief Static storage of edges (used until it's too small).
+  Edge _edgesStorage[64];
+
+private:
+  FOG_NO_COPY(AliasedRasterizer8)
+};
+
 //! @}
 
 } // Fog namespace
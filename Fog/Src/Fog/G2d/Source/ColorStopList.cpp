@@ -304,7 +304,7 @@ static err_t FOG_CDECL ColorStopList_addColorStop(ColorStopList* self, const Col
   else
   {
     d->destroyCache();
-    MemOps::move(d->data + i, d->data + i + 1, (length - i) * sizeof(ColorStop));
+    MemOps::move(d->data + i + 1, d->data + i, (length - i) * sizeof(ColorStop));
   }
 
   d->data[i] = *stop;
@@ -1571,6 +1571,10 @@ FOG_NO_EXPORT void Font_init_mac(void);
 FOG_NO_EXPORT void Font_init_freetype(void);
 #endif // FOG_FONT_FREETYPE
 
+#if defined(FOG_FONT_UNIX)
+FOG_NO_EXPORT void Font_init_unix(void);
+#endif // FOG_FONT_UNIX
+
 FOG_NO_EXPORT void Font_init(void)
 {
   // --------------------------------------------------------------------------
@@ -1728,6 +1732,10 @@ FOG_NO_EXPORT void Font_init(void)
 #if defined(FOG_FONT_FREETYPE)
   Font_init_freetype();
 #endif // FOG_FONT_FREETYPE
+
+#if defined(FOG_FONT_UNIX)
+  Font_init_unix();
+#endif // FOG_FONT_UNIX
 }
 
 FOG_NO_EXPORT void Font_fini(void)
@@ -21,11 +21,14 @@ namespace Fog {
 FOG_NO_EXPORT void OTTypes_init(void);
 FOG_NO_EXPORT void OTFace_init(void);
 
+FOG_NO_EXPORT void OTCFF_init(void);
 FOG_NO_EXPORT void OTCMap_init(void);
+FOG_NO_EXPORT void OTGlyf_init(void);
 FOG_NO_EXPORT void OTHHea_init(void);
 FOG_NO_EXPORT void OTHead_init(void);
 FOG_NO_EXPORT void OTHmtx_init(void);
 FOG_NO_EXPORT void OTKern_init(void);
+FOG_NO_EXPORT void OTLoca_init(void);
 FOG_NO_EXPORT void OTMaxp_init(void);
 FOG_NO_EXPORT void OTName_init(void);
 
@@ -41,6 +44,9 @@ FOG_NO_EXPORT void OTApi_init(void)
   OTCMap_init();
   OTKern_init();
   OTMaxp_init();
+  OTLoca_init();
+  OTGlyf_init();
+  OTCFF_init();
 }
 
 } // Fog namespace
@@ -64,6 +64,9 @@ typedef OTUInt16 OTGlyphID;
 typedef OTUInt32 OTFixedVersion;
 typedef OTUInt32 OTTag;
 
+// TrueType/OpenType 'CFF ' support.
+struct OTCFF;
+
 // TrueType/OpenType 'cmap' support.
 struct OTCMap;
 struct OTCMapContext;
@@ -71,6 +74,9 @@ struct OTCMapContext;
 // TrueType/OpenType 'hhea' support.
 struct OTHHea;
 
+// TrueType/OpenType 'glyf' support.
+struct OTGlyf;
+
 // TrueType/OpenType 'head' support.
 struct OTHead;
 
@@ -80,6 +86,9 @@ struct OTHmtx;
 // TrueType/OpenType 'kern' support.
 struct OTKern;
 
+// TrueType/OpenType 'loca' support.
+struct OTLoca;
+
 // TrueType/OpenType 'maxp' support.
 struct OTMaxp;
 
@@ -172,6 +181,28 @@ struct FOG_NO_EXPORT OTApi
 
   FOG_CAPI_METHOD(err_t, otcmap_init)(OTCMap* table);
 
+  // --------------------------------------------------------------------------
+  // [OTLoca]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(err_t, otloca_init)(OTLoca* table);
+
+  // --------------------------------------------------------------------------
+  // [OTGlyf]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(err_t, otglyf_init)(OTGlyf* table);
+  FOG_CAPI_METHOD(err_t, otglyf_getGlyphOutlineF)(const OTGlyf* table, PathF* dst, uint32_t glyphId);
+  FOG_CAPI_METHOD(err_t, otglyf_getGlyphOutlineD)(const OTGlyf* table, PathD* dst, uint32_t glyphId);
+
+  // --------------------------------------------------------------------------
+  // [OTCFF]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(err_t, otcff_init)(OTCFF* table);
+  FOG_CAPI_METHOD(err_t, otcff_getGlyphOutlineF)(const OTCFF* table, PathF* dst, uint32_t glyphId);
+  FOG_CAPI_METHOD(err_t, otcff_getGlyphOutlineD)(const OTCFF* table, PathD* dst, uint32_t glyphId);
+
   // --------------------------------------------------------------------------
   // [OTKern]
   // --------------------------------------------------------------------------
@@ -0,0 +1,1123 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Tools/Logger.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Text/OpenType/OTCFF.h>
+#include <Fog/G2d/Text/OpenType/OTEnum.h>
+#include <Fog/G2d/Text/OpenType/OTFace.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::OTCFF - Constants]
+// ============================================================================
+
+//! @internal
+enum
+{
+  //! @brief Maximum count of operands in DICT and Type2 charstring.
+  OT_CFF_MAX_OPERANDS = 48,
+  //! @brief Maximum nesting of subroutine calls (Type2 limit).
+  OT_CFF_MAX_SUBR_DEPTH = 10
+};
+
+//! @internal
+//!
+//! @brief DICT operators used by the parser (two-byte operators are stored
+//! as 0x0C00 | second byte).
+enum OT_CFF_DICT_OP
+{
+  OT_CFF_DICT_OP_CHAR_STRINGS = 17,
+  OT_CFF_DICT_OP_PRIVATE = 18,
+  OT_CFF_DICT_OP_SUBRS = 19,
+
+  OT_CFF_DICT_OP_CHAR_STRING_TYPE = 0x0C06,
+  OT_CFF_DICT_OP_ROS = 0x0C1E,
+  OT_CFF_DICT_OP_FD_ARRAY = 0x0C24,
+  OT_CFF_DICT_OP_FD_SELECT = 0x0C25
+};
+
+// ============================================================================
+// [Fog::OTCFF - Index]
+// ============================================================================
+
+static FOG_INLINE uint32_t OTCFF_readOffset(const uint8_t* p, uint32_t offsetSize)
+{
+  uint32_t v = 0;
+  for (uint32_t i = 0; i < offsetSize; i++)
+    v = (v << 8) | p[i];
+  return v;
+}
+
+static err_t OTCFF_parseIndex(const uint8_t* data, uint32_t dataLength,
+  uint32_t position, OTCFFIndex* index, uint32_t* end)
+{
+  if (position > dataLength || dataLength - position < 2)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  uint32_t count = reinterpret_cast<const OTUInt16*>(data + position)->getValueU();
+
+  if (count == 0)
+  {
+    index->_count = 0;
+    index->_offsetSize = 1;
+    index->_offsetsPosition = position + 2;
+    index->_dataPosition = position + 2;
+
+    *end = position + 2;
+    return ERR_OK;
+  }
+
+  if (dataLength - position < 3)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  uint32_t offsetSize = data[position + 2];
+  if (offsetSize < 1 || offsetSize > 4)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  uint32_t offsetsPosition = position + 3;
+  uint32_t offsetsLength = (count + 1) * offsetSize;
+
+  if (dataLength - offsetsPosition < offsetsLength)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  uint32_t dataPosition = offsetsPosition + offsetsLength - 1;
+  uint32_t lastOffset = OTCFF_readOffset(data + offsetsPosition + count * offsetSize, offsetSize);
+
+  if (lastOffset < 1 || lastOffset > dataLength - dataPosition)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  index->_count = count;
+  index->_offsetSize = offsetSize;
+  index->_offsetsPosition = offsetsPosition;
+  index->_dataPosition = dataPosition;
+
+  *end = dataPosition + lastOffset;
+  return ERR_OK;
+}
+
+//! @internal
+//!
+//! @brief Get the object @a i of a validated @a index.
+static FOG_INLINE bool OTCFF_getObject(const uint8_t* data, const OTCFFIndex* index,
+  uint32_t i, const uint8_t** pStart, const uint8_t** pEnd)
+{
+  if (i >= index->_count)
+    return false;
+
+  const uint8_t* pOffsets = data + index->_offsetsPosition + i * index->_offsetSize;
+  uint32_t offsetSize = index->_offsetSize;
+
+  uint32_t o0 = OTCFF_readOffset(pOffsets, offsetSize);
+  uint32_t o1 = OTCFF_readOffset(pOffsets + offsetSize, offsetSize);
+
+  // The last offset was validated, so (o1 <= lastOffset) must be checked as
+  // well, but the offsets are required to be increasing.
+  uint32_t last = OTCFF_readOffset(data + index->_offsetsPosition + index->_count * offsetSize, offsetSize);
+  if (o0 < 1 || o0 > o1 || o1 > last)
+    return false;
+
+  *pStart = data + index->_dataPosition + o0;
+  *pEnd = data + index->_dataPosition + o1;
+  return true;
+}
+
+static FOG_INLINE int32_t OTCFF_getSubrBias(uint32_t count)
+{
+  if (count < 1240)
+    return 107;
+  else if (count < 33900)
+    return 1131;
+  else
+    return 32768;
+}
+
+// ============================================================================
+// [Fog::OTCFF - Dict]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief DICT reader, reads operands until an operator is found.
+struct FOG_NO_EXPORT OTCFFDictReader
+{
+  FOG_INLINE OTCFFDictReader(const uint8_t* p, const uint8_t* pEnd) :
+    _p(p),
+    _pEnd(pEnd),
+    _count(0)
+  {
+  }
+
+  //! @brief Read next operator and its operands, returns @c false at the end
+  //! or if the data are malformed.
+  bool next(uint32_t& op)
+  {
+    _count = 0;
+
+    while (_p < _pEnd)
+    {
+      uint32_t b0 = *_p++;
+
+      if (b0 <= 21)
+      {
+        if (b0 == 12)
+        {
+          if (_p == _pEnd)
+            return false;
+          b0 = 0x0C00 | *_p++;
+        }
+
+        op = b0;
+        return true;
+      }
+
+      double v;
+
+      if (b0 >= 32 && b0 <= 246)
+      {
+        v = double(int32_t(b0) - 139);
+      }
+      else if (b0 >= 247 && b0 <= 254)
+      {
+        if (_p == _pEnd)
+          return false;
+
+        int32_t b1 = *_p++;
+        if (b0 <= 250)
+          v = double( (int32_t(b0) - 247) * 256 + b1 + 108);
+        else
+          v = double(-(int32_t(b0) - 251) * 256 - b1 - 108);
+      }
+      else if (b0 == 28)
+      {
+        if (_pEnd - _p < 2)
+          return false;
+
+        v = double(reinterpret_cast<const OTInt16*>(_p)->getValueU());
+        _p += 2;
+      }
+      else if (b0 == 29)
+      {
+        if (_pEnd - _p < 4)
+          return false;
+
+        v = double(reinterpret_cast<const OTInt32*>(_p)->getValueU());
+        _p += 4;
+      }
+      else if (b0 == 30)
+      {
+        if (!readReal(v))
+          return false;
+      }
+      else
+      {
+        return false;
+      }
+
+      if (_count == OT_CFF_MAX_OPERANDS)
+        return false;
+      _operands[_count++] = v;
+    }
+
+    return false;
+  }
+
+  //! @brief Read real number, stored as BCD nibbles.
+  bool readReal(double& dst)
+  {
+    char buf[64];
+    uint32_t length = 0;
+
+    for (;;)
+    {
+      if (_p == _pEnd)
+        return false;
+
+      uint32_t b = *_p++;
+      uint32_t nibbles[2] = { b >> 4, b & 0xF };
+
+      for (uint32_t i = 0; i < 2; i++)
+      {
+        uint32_t n = nibbles[i];
+
+        if (n == 0xF)
+        {
+          buf[length] = '\0';
+          dst = ::strtod(buf, NULL);
+          return true;
+        }
+
+        // Reserve space for "E-" and the terminating null.
+        if (length >= FOG_ARRAY_SIZE(buf) - 3)
+          return false;
+
+        if (n <= 9)
+          buf[length++] = char('0' + n);
+        else if (n == 0xA)
+          buf[length++] = '.';
+        else if (n == 0xB)
+          buf[length++] = 'E';
+        else if (n == 0xC)
+        {
+          buf[length++] = 'E';
+          buf[length++] = '-';
+        }
+        else if (n == 0xE)
+          buf[length++] = '-';
+        else
+          return false;
+      }
+    }
+  }
+
+  FOG_INLINE uint32_t getCount() const { return _count; }
+  FOG_INLINE double getOperand(uint32_t i) const { return _operands[i]; }
+
+  FOG_INLINE uint32_t getOperandU32(uint32_t i) const
+  {
+    double v = _operands[i];
+    return (v >= 0.0 && v <= 4294967295.0) ? uint32_t(v) : 0;
+  }
+
+  const uint8_t* _p;
+  const uint8_t* _pEnd;
+
+  uint32_t _count;
+  double _operands[OT_CFF_MAX_OPERANDS];
+};
+
+//! @internal
+//!
+//! @brief Parse Private DICT and its local subroutines INDEX.
+static err_t OTCFF_parsePrivate(const uint8_t* data, uint32_t dataLength,
+  uint32_t size, uint32_t offset, OTCFFIndex* subrs)
+{
+  subrs->_count = 0;
+  subrs->_offsetSize = 1;
+  subrs->_offsetsPosition = 0;
+  subrs->_dataPosition = 0;
+
+  if (offset > dataLength || size > dataLength - offset)
+    return ERR_FONT_CFF_HEADER_WRONG_DATA;
+
+  OTCFFDictReader reader(data + offset, data + offset + size);
+  uint32_t op;
+
+  while (reader.next(op))
+  {
+    if (op == OT_CFF_DICT_OP_SUBRS && reader.getCount() >= 1)
+    {
+      // Offset is relative to the beginning of the Private DICT.
+      uint32_t subrsOffset = reader.getOperandU32(0);
+      uint32_t end;
+
+      if (subrsOffset > dataLength - offset)
+        return ERR_FONT_CFF_HEADER_WRONG_DATA;
+      return OTCFF_parseIndex(data, dataLength, offset + subrsOffset, subrs, &end);
+    }
+  }
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::OTCFF - Decode]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Type2 charstring interpreter (outline only).
+template<typename NumT>
+struct OTCFFDecoder
+{
+  FOG_INLINE OTCFFDecoder(NumT_(Path)* dst) :
+    _dst(dst),
+    _x(NumT(0.0)),
+    _y(NumT(0.0)),
+    _isOpen(false)
+  {
+  }
+
+  FOG_INLINE err_t moveTo(NumT dx, NumT dy)
+  {
+    if (_isOpen)
+      FOG_RETURN_ON_ERROR(_dst->close());
+
+    _x += dx;
+    _y += dy;
+    _isOpen = true;
+
+    return _dst->moveTo(_x, -_y);
+  }
+
+  FOG_INLINE err_t lineTo(NumT dx, NumT dy)
+  {
+    if (!_isOpen)
+      FOG_RETURN_ON_ERROR(moveTo(NumT(0.0), NumT(0.0)));
+
+    _x += dx;
+    _y += dy;
+
+    return _dst->lineTo(_x, -_y);
+  }
+
+  FOG_INLINE err_t cubicTo(NumT dx1, NumT dy1, NumT dx2, NumT dy2, NumT dx3, NumT dy3)
+  {
+    if (!_isOpen)
+      FOG_RETURN_ON_ERROR(moveTo(NumT(0.0), NumT(0.0)));
+
+    NumT x1 = _x + dx1;
+    NumT y1 = _y + dy1;
+    NumT x2 = x1 + dx2;
+    NumT y2 = y1 + dy2;
+
+    _x = x2 + dx3;
+    _y = y2 + dy3;
+
+    return _dst->cubicTo(x1, -y1, x2, -y2, _x, -_y);
+  }
+
+  FOG_INLINE err_t close()
+  {
+    if (!_isOpen)
+      return ERR_OK;
+
+    _isOpen = false;
+    return _dst->close();
+  }
+
+  NumT_(Path)* _dst;
+  NumT _x;
+  NumT _y;
+  bool _isOpen;
+};
+
+template<typename NumT>
+static err_t OTCFF_decodeCharString(const OTCFF* self, NumT_(Path)* dst,
+  const uint8_t* p, const uint8_t* pEnd, const OTCFFIndex* localSubrs)
+{
+  const uint8_t* data = self->getData();
+
+  OTCFFDecoder<NumT> ctx(dst);
+
+  NumT s[OT_CFF_MAX_OPERANDS];
+  uint32_t sp = 0;
+  uint32_t i;
+
+  struct CallFrame
+  {
+    const uint8_t* p;
+    const uint8_t* pEnd;
+  };
+
+  CallFrame callStack[OT_CFF_MAX_SUBR_DEPTH];
+  uint32_t callDepth = 0;
+
+  uint32_t numStems = 0;
+
+  int32_t localBias = OTCFF_getSubrBias(localSubrs->_count);
+  int32_t globalBias = OTCFF_getSubrBias(self->_globalSubrs._count);
+
+  for (;;)
+  {
+    if (p >= pEnd)
+    {
+      // Subroutine without 'return' (allowed if it ends by 'endchar' in the
+      // caller), or a charstring without 'endchar'.
+      if (callDepth == 0)
+        break;
+
+      callDepth--;
+      p = callStack[callDepth].p;
+      pEnd = callStack[callDepth].pEnd;
+      continue;
+    }
+
+    uint32_t b0 = *p++;
+
+    // ------------------------------------------------------------------------
+    // [Operand]
+    // ------------------------------------------------------------------------
+
+    if (b0 >= 32 || b0 == 28)
+    {
+      NumT v;
+
+      if (b0 <= 246)
+      {
+        if (b0 == 28)
+        {
+          if (pEnd - p < 2)
+            return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+          v = NumT(reinterpret_cast<const OTInt16*>(p)->getValueU());
+          p += 2;
+        }
+        else
+        {
+          v = NumT(int32_t(b0) - 139);
+        }
+      }
+      else if (b0 <= 254)
+      {
+        if (p == pEnd)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        int32_t b1 = *p++;
+        if (b0 <= 250)
+          v = NumT( (int32_t(b0) - 247) * 256 + b1 + 108);
+        else
+          v = NumT(-(int32_t(b0) - 251) * 256 - b1 - 108);
+      }
+      else
+      {
+        if (pEnd - p < 4)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        // 16.16 fixed point.
+        v = NumT(int32_t(reinterpret_cast<const OTInt32*>(p)->getValueU())) * NumT(1.0 / 65536.0);
+        p += 4;
+      }
+
+      if (sp == OT_CFF_MAX_OPERANDS)
+        return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+      s[sp++] = v;
+      continue;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Operator]
+    // ------------------------------------------------------------------------
+
+    i = 0;
+
+    switch (b0)
+    {
+      // hstem, vstem, hstemhm, vstemhm.
+      //
+      // The width (if present) is the first operand, it's odd count of
+      // operands so it's ignored by division.
+      case 1:
+      case 3:
+      case 18:
+      case 23:
+        numStems += sp / 2;
+        break;
+
+      // hintmask, cntrmask.
+      //
+      // Operands (if any) are implicit vstem hints.
+      case 19:
+      case 20:
+        numStems += sp / 2;
+        i = (numStems + 7) / 8;
+
+        if ((uint32_t)(pEnd - p) < i)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+        p += i;
+        break;
+
+      // rmoveto.
+      case 21:
+        if (sp < 2)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+        FOG_RETURN_ON_ERROR(ctx.moveTo(s[sp - 2], s[sp - 1]));
+        break;
+
+      // hmoveto.
+      case 22:
+        if (sp < 1)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+        FOG_RETURN_ON_ERROR(ctx.moveTo(s[sp - 1], NumT(0.0)));
+        break;
+
+      // vmoveto.
+      case 4:
+        if (sp < 1)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+        FOG_RETURN_ON_ERROR(ctx.moveTo(NumT(0.0), s[sp - 1]));
+        break;
+
+      // rlineto.
+      case 5:
+        if (sp < 2)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        for (; i + 1 < sp; i += 2)
+          FOG_RETURN_ON_ERROR(ctx.lineTo(s[i], s[i + 1]));
+        break;
+
+      // hlineto, vlineto.
+      case 6:
+      case 7:
+      {
+        if (sp < 1)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        bool horizontal = (b0 == 6);
+        for (; i < sp; i++, horizontal = !horizontal)
+        {
+          if (horizontal)
+            FOG_RETURN_ON_ERROR(ctx.lineTo(s[i], NumT(0.0)));
+          else
+            FOG_RETURN_ON_ERROR(ctx.lineTo(NumT(0.0), s[i]));
+        }
+        break;
+      }
+
+      // rrcurveto.
+      case 8:
+        if (sp < 6)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        for (; i + 5 < sp; i += 6)
+          FOG_RETURN_ON_ERROR(ctx.cubicTo(s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]));
+        break;
+
+      // rcurveline.
+      case 24:
+        if (sp < 8)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        for (; i + 5 < sp - 2; i += 6)
+          FOG_RETURN_ON_ERROR(ctx.cubicTo(s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]));
+        FOG_RETURN_ON_ERROR(ctx.lineTo(s[i], s[i + 1]));
+        break;
+
+      // rlinecurve.
+      case 25:
+        if (sp < 8)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        for (; i + 1 < sp - 6; i += 2)
+          FOG_RETURN_ON_ERROR(ctx.lineTo(s[i], s[i + 1]));
+        FOG_RETURN_ON_ERROR(ctx.cubicTo(s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]));
+        break;
+
+      // vvcurveto, hhcurveto.
+      case 26:
+      case 27:
+      {
+        if (sp < 4)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        NumT f = NumT(0.0);
+        if (sp & 1)
+          f = s[i++];
+
+        for (; i + 3 < sp; i += 4)
+        {
+          if (b0 == 27)
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[i], f, s[i + 1], s[i + 2], s[i + 3], NumT(0.0)));
+          else
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(f, s[i], s[i + 1], s[i + 2], NumT(0.0), s[i + 3]));
+          f = NumT(0.0);
+        }
+        break;
+      }
+
+      // vhcurveto, hvcurveto.
+      case 30:
+      case 31:
+      {
+        if (sp < 4)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        bool horizontal = (b0 == 31);
+        for (; i + 3 < sp; i += 4, horizontal = !horizontal)
+        {
+          NumT last = (sp - i == 5) ? s[i + 4] : NumT(0.0);
+
+          if (horizontal)
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[i], NumT(0.0), s[i + 1], s[i + 2], last, s[i + 3]));
+          else
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(NumT(0.0), s[i], s[i + 1], s[i + 2], s[i + 3], last));
+        }
+        break;
+      }
+
+      // callsubr, callgsubr.
+      case 10:
+      case 29:
+      {
+        if (sp < 1 || callDepth == OT_CFF_MAX_SUBR_DEPTH)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        const OTCFFIndex* subrs = (b0 == 10) ? localSubrs : &self->_globalSubrs;
+        int32_t index = int32_t(s[--sp]) + (b0 == 10 ? localBias : globalBias);
+
+        const uint8_t* subrStart;
+        const uint8_t* subrEnd;
+
+        if (index < 0 || !OTCFF_getObject(data, subrs, (uint32_t)index, &subrStart, &subrEnd))
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        callStack[callDepth].p = p;
+        callStack[callDepth].pEnd = pEnd;
+        callDepth++;
+
+        p = subrStart;
+        pEnd = subrEnd;
+
+        // Keep the operands, subroutines use them.
+        continue;
+      }
+
+      // return.
+      case 11:
+        if (callDepth == 0)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        callDepth--;
+        p = callStack[callDepth].p;
+        pEnd = callStack[callDepth].pEnd;
+
+        // Keep the operands, they are returned to the caller.
+        continue;
+
+      // endchar.
+      //
+      // The deprecated 'seac' form (4 operands) is not supported, accented
+      // characters are always stored as separate glyphs in OpenType fonts.
+      case 14:
+        return ctx.close();
+
+      // escape.
+      case 12:
+      {
+        if (p == pEnd)
+          return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+        uint32_t b1 = *p++;
+        switch (b1)
+        {
+          // hflex.
+          case 34:
+            if (sp < 7)
+              return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[0], NumT(0.0), s[1], s[2], s[3], NumT(0.0)));
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[4], NumT(0.0), s[5], -s[2], s[6], NumT(0.0)));
+            break;
+
+          // flex.
+          case 35:
+            if (sp < 13)
+              return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[0], s[1], s[2], s[3], s[4], s[5]));
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[6], s[7], s[8], s[9], s[10], s[11]));
+            break;
+
+          // hflex1.
+          case 36:
+            if (sp < 9)
+              return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[0], s[1], s[2], s[3], s[4], NumT(0.0)));
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[5], NumT(0.0), s[6], s[7], s[8], -(s[1] + s[3] + s[7])));
+            break;
+
+          // flex1.
+          case 37:
+          {
+            if (sp < 11)
+              return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+            NumT dx = s[0] + s[2] + s[4] + s[6] + s[8];
+            NumT dy = s[1] + s[3] + s[5] + s[7] + s[9];
+
+            NumT dx6 = s[10];
+            NumT dy6 = s[10];
+
+            if (Math::abs(dx) > Math::abs(dy))
+              dy6 = -dy;
+            else
+              dx6 = -dx;
+
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[0], s[1], s[2], s[3], s[4], s[5]));
+            FOG_RETURN_ON_ERROR(ctx.cubicTo(s[6], s[7], s[8], s[9], dx6, dy6));
+            break;
+          }
+
+          // Arithmetic and storage operators are not used by fonts in the
+          // wild (they were removed from CFF2), the stack is cleared.
+          default:
+            break;
+        }
+        break;
+      }
+
+      // Reserved.
+      default:
+        return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+    }
+
+    // All operators except subroutine calls clear the stack.
+    sp = 0;
+  }
+
+  return ctx.close();
+}
+
+// ============================================================================
+// [Fog::OTCFF - GetGlyphOutline]
+// ============================================================================
+
+template<typename NumT>
+static err_t FOG_CDECL OTCFF_getGlyphOutline(const OTCFF* self, NumT_(Path)* dst, uint32_t glyphId)
+{
+  if (FOG_IS_ERROR(self->getStatus()))
+    return self->getStatus();
+
+  const uint8_t* data = self->getData();
+  const uint8_t* p;
+  const uint8_t* pEnd;
+
+  if (!OTCFF_getObject(data, &self->_charStrings, glyphId, &p, &pEnd))
+    return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+
+  // --------------------------------------------------------------------------
+  // [FDSelect]
+  // --------------------------------------------------------------------------
+
+  const OTCFFIndex* localSubrs = &self->_localSubrs;
+
+  if (self->_fdCount != 0)
+  {
+    const uint8_t* pSelect = data + self->_fdSelectPosition;
+    uint32_t selectLength = self->getDataLength() - self->_fdSelectPosition;
+    uint32_t fd = 0;
+
+    if (self->_fdSelectFormat == 0)
+    {
+      if (glyphId >= selectLength)
+        return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+      fd = pSelect[glyphId];
+    }
+    else
+    {
+      // Format 3 - Ranges (validated by init).
+      uint32_t numRanges = reinterpret_cast<const OTUInt16*>(pSelect)->getValueU();
+      const uint8_t* pRange = pSelect + 2;
+
+      uint32_t r;
+      for (r = 0; r < numRanges; r++, pRange += 3)
+      {
+        uint32_t first = reinterpret_cast<const OTUInt16*>(pRange)->getValueU();
+        uint32_t next = reinterpret_cast<const OTUInt16*>(pRange + 3)->getValueU();
+
+        if (glyphId >= first && glyphId < next)
+        {
+          fd = pRange[2];
+          break;
+        }
+      }
+
+      if (r == numRanges)
+        return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+    }
+
+    if (fd >= self->_fdCount)
+      return ERR_FONT_CFF_CHARSTRING_WRONG_DATA;
+    localSubrs = &self->_fdSubrs[fd];
+  }
+
+  // --------------------------------------------------------------------------
+  // [Decode]
+  // --------------------------------------------------------------------------
+
+  size_t index = dst->getLength();
+  err_t err = OTCFF_decodeCharString<NumT>(self, dst, p, pEnd, localSubrs);
+
+  // Don't leave a partially decoded glyph in the path.
+  if (FOG_IS_ERROR(err) && dst->getLength() != index)
+    dst->_d->length = index;
+
+  return err;
+}
+
+// ============================================================================
+// [Fog::OTCFF - Init / Destroy]
+// ============================================================================
+
+static void FOG_CDECL OTCFF_destroy(OTCFF* self)
+{
+  // This results in crash in case that destroy is called twice by accident.
+  self->_destroy = NULL;
+}
+
+static err_t FOG_CDECL OTCFF_init(OTCFF* self)
+{
+  // --------------------------------------------------------------------------
+  // [Init]
+  // --------------------------------------------------------------------------
+
+  const uint8_t* data = self->getData();
+  uint32_t dataLength = self->getDataLength();
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::OTCFF", "init",
+    "Initializing 'CFF ' table (%u bytes).", dataLength);
+#endif // FOG_OT_DEBUG
+
+  FOG_ASSERT_X(self->_tag == FOG_OT_TAG('C', 'F', 'F', ' '),
+    "Fog::OTCFF::init() - Not a 'CFF ' table.");
+
+  self->_destroy = (OTTableDestroyFunc)OTCFF_destroy;
+
+  MemOps::zero(&self->_charStrings, sizeof(OTCFFIndex));
+  MemOps::zero(&self->_globalSubrs, sizeof(OTCFFIndex));
+  MemOps::zero(&self->_localSubrs, sizeof(OTCFFIndex));
+
+  self->_fdSubrs = NULL;
+  self->_fdCount = 0;
+  self->_fdSelectFormat = 0;
+  self->_fdSelectPosition = 0;
+
+  // --------------------------------------------------------------------------
+  // [Header]
+  // --------------------------------------------------------------------------
+
+  if (dataLength < sizeof(OTCFFHeader))
+    return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+  const OTCFFHeader* header = self->getHeader();
+  uint32_t headerSize = header->headerSize.getValue();
+
+  if (header->majorVersion.getValue() != 1)
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTCFF", "init",
+      "Version of the table is not supported (%u.%u).",
+        header->majorVersion.getValue(),
+        header->minorVersion.getValue());
+#endif // FOG_OT_DEBUG
+    return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_VERSION);
+  }
+
+  if (headerSize < sizeof(OTCFFHeader) || headerSize > dataLength)
+    return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+  // --------------------------------------------------------------------------
+  // [Name / Top DICT / String / Global Subrs INDEXes]
+  // --------------------------------------------------------------------------
+
+  OTCFFIndex nameIndex;
+  OTCFFIndex topDictIndex;
+  OTCFFIndex stringIndex;
+
+  uint32_t position = headerSize;
+  err_t err;
+
+  if (FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, position, &nameIndex, &position)) ||
+      FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, position, &topDictIndex, &position)) ||
+      FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, position, &stringIndex, &position)) ||
+      FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, position, &self->_globalSubrs, &position)))
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTCFF", "init",
+      "Failed to parse the header INDEXes.");
+#endif // FOG_OT_DEBUG
+    return self->setStatus(err);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Top DICT]
+  // --------------------------------------------------------------------------
+
+  // OpenType requires exactly one font in CFF, other fonts are ignored.
+  const uint8_t* pDict;
+  const uint8_t* pDictEnd;
+
+  if (!OTCFF_getObject(data, &topDictIndex, 0, &pDict, &pDictEnd))
+    return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+  uint32_t charStringsOffset = 0;
+  uint32_t charStringType = 2;
+  uint32_t privateSize = 0;
+  uint32_t privateOffset = 0;
+  uint32_t fdArrayOffset = 0;
+  uint32_t fdSelectOffset = 0;
+  bool isCID = false;
+
+  OTCFFDictReader reader(pDict, pDictEnd);
+  uint32_t op;
+
+  while (reader.next(op))
+  {
+    uint32_t count = reader.getCount();
+
+    switch (op)
+    {
+      case OT_CFF_DICT_OP_CHAR_STRINGS:
+        if (count >= 1) charStringsOffset = reader.getOperandU32(0);
+        break;
+
+      case OT_CFF_DICT_OP_PRIVATE:
+        if (count >= 2)
+        {
+          privateSize = reader.getOperandU32(0);
+          privateOffset = reader.getOperandU32(1);
+        }
+        break;
+
+      case OT_CFF_DICT_OP_CHAR_STRING_TYPE:
+        if (count >= 1) charStringType = reader.getOperandU32(0);
+        break;
+
+      case OT_CFF_DICT_OP_ROS:
+        isCID = true;
+        break;
+
+      case OT_CFF_DICT_OP_FD_ARRAY:
+        if (count >= 1) fdArrayOffset = reader.getOperandU32(0);
+        break;
+
+      case OT_CFF_DICT_OP_FD_SELECT:
+        if (count >= 1) fdSelectOffset = reader.getOperandU32(0);
+        break;
+    }
+  }
+
+  if (charStringType != 2 || charStringsOffset == 0)
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTCFF", "init",
+      "Unsupported CharstringType=%u or missing CharStrings.", charStringType);
+#endif // FOG_OT_DEBUG
+    return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+  }
+
+  if (FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, charStringsOffset, &self->_charStrings, &position)))
+    return self->setStatus(err);
+
+  // --------------------------------------------------------------------------
+  // [Private DICT / FDArray / FDSelect]
+  // --------------------------------------------------------------------------
+
+  if (!isCID)
+  {
+    if (privateSize != 0 && FOG_IS_ERROR(err = OTCFF_parsePrivate(data, dataLength, privateSize, privateOffset, &self->_localSubrs)))
+      return self->setStatus(err);
+  }
+  else
+  {
+    OTCFFIndex fdArrayIndex;
+
+    if (fdArrayOffset == 0 || fdSelectOffset == 0 || fdSelectOffset >= dataLength)
+      return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+    if (FOG_IS_ERROR(err = OTCFF_parseIndex(data, dataLength, fdArrayOffset, &fdArrayIndex, &position)))
+      return self->setStatus(err);
+
+    uint32_t fdCount = fdArrayIndex.getCount();
+    if (fdCount == 0 || fdCount > 256)
+      return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+    // FDSelect.
+    uint32_t fdSelectFormat = data[fdSelectOffset];
+    uint32_t fdSelectLength = dataLength - fdSelectOffset - 1;
+
+    if (fdSelectFormat == 0)
+    {
+      if (fdSelectLength < self->_charStrings.getCount())
+        return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+    }
+    else if (fdSelectFormat == 3)
+    {
+      if (fdSelectLength < 2)
+        return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+      uint32_t numRanges = reinterpret_cast<const OTUInt16*>(data + fdSelectOffset + 1)->getValueU();
+
+      // Ranges followed by the sentinel.
+      if (fdSelectLength - 2 < numRanges * 3 + 2)
+        return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+    }
+    else
+    {
+#if defined(FOG_OT_DEBUG)
+      Logger::info("Fog::OTCFF", "init",
+        "Unsupported FDSelect format %u.", fdSelectFormat);
+#endif // FOG_OT_DEBUG
+      return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+    }
+
+    // Local subroutines of each font-dictionary.
+    OTCFFIndex* fdSubrs = static_cast<OTCFFIndex*>(
+      self->getFace()->_allocator->alloc(fdCount * sizeof(OTCFFIndex)));
+
+    if (FOG_IS_NULL(fdSubrs))
+      return self->setStatus(ERR_RT_OUT_OF_MEMORY);
+
+    for (uint32_t fd = 0; fd < fdCount; fd++)
+    {
+      fdSubrs[fd]._count = 0;
+      fdSubrs[fd]._offsetSize = 1;
+      fdSubrs[fd]._offsetsPosition = 0;
+      fdSubrs[fd]._dataPosition = 0;
+
+      if (!OTCFF_getObject(data, &fdArrayIndex, fd, &pDict, &pDictEnd))
+        return self->setStatus(ERR_FONT_CFF_HEADER_WRONG_DATA);
+
+      OTCFFDictReader fdReader(pDict, pDictEnd);
+      while (fdReader.next(op))
+      {
+        if (op == OT_CFF_DICT_OP_PRIVATE && fdReader.getCount() >= 2)
+        {
+          err = OTCFF_parsePrivate(data, dataLength,
+            fdReader.getOperandU32(0), fdReader.getOperandU32(1), &fdSubrs[fd]);
+
+          if (FOG_IS_ERROR(err))
+            return self->setStatus(err);
+          break;
+        }
+      }
+    }
+
+    self->_fdSubrs = fdSubrs;
+    self->_fdCount = fdCount;
+    self->_fdSelectFormat = fdSelectFormat;
+    self->_fdSelectPosition = fdSelectOffset + 1;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Finished]
+  // --------------------------------------------------------------------------
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::OTCFF", "init", "NumberOfGlyphs=%u.", self->_charStrings.getCount());
+  Logger::info("Fog::OTCFF", "init", "NumberOfGlobalSubrs=%u.", self->_globalSubrs.getCount());
+  Logger::info("Fog::OTCFF", "init", "NumberOfLocalSubrs=%u.", self->_localSubrs.getCount());
+  Logger::info("Fog::OTCFF", "init", "NumberOfFDs=%u.", self->_fdCount);
+#endif // FOG_OT_DEBUG
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void OTCFF_init(void)
+{
+  OTApi& api = fog_ot_api;
+
+  // --------------------------------------------------------------------------
+  // [OTCFF]
+  // --------------------------------------------------------------------------
+
+  api.otcff_init = OTCFF_init;
+  api.otcff_getGlyphOutlineF = OTCFF_getGlyphOutline<float>;
+  api.otcff_getGlyphOutlineD = OTCFF_getGlyphOutline<double>;
+}
+
+} // Fog namespace
@@ -0,0 +1,146 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TEXT_OPENTYPE_OTCFF_H
+#define _FOG_G2D_TEXT_OPENTYPE_OTCFF_H
+
+// [Dependencies]
+#include <Fog/G2d/Text/OpenType/OTApi.h>
+#include <Fog/G2d/Text/OpenType/OTTypes.h>
+
+namespace Fog {
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackByte.h>
+
+//! @addtogroup Fog_G2d_Text_OpenType
+//! @{
+
+// ============================================================================
+// [Fog::OTCFFHeader]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'CFF ' - Compact font format header.
+struct FOG_NO_EXPORT OTCFFHeader
+{
+  //! @brief Format major version (1).
+  OTUInt8 majorVersion;
+  //! @brief Format minor version.
+  OTUInt8 minorVersion;
+  //! @brief Header size in bytes.
+  OTUInt8 headerSize;
+  //! @brief Absolute offset size (1-4 bytes).
+  OTUInt8 offsetSize;
+};
+
+// ============================================================================
+// [Fog::OTCFFIndex]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'CFF ' - Location of a validated INDEX structure.
+//!
+//! INDEX is an array of variable-sized objects. It's stored as a count, the
+//! offset size and an array of offsets (count + 1) followed by the object
+//! data. All positions stored here are relative to the beginning of the 'CFF '
+//! table and were validated when the table was initialized.
+struct FOG_NO_EXPORT OTCFFIndex
+{
+  //! @brief Get count of objects.
+  FOG_INLINE uint32_t getCount() const { return _count; }
+
+  //! @brief Count of objects.
+  uint32_t _count;
+  //! @brief Size of a single offset (1-4 bytes).
+  uint32_t _offsetSize;
+  //! @brief Position of the offset array.
+  uint32_t _offsetsPosition;
+  //! @brief Position of the object data minus one (offsets are one-based).
+  uint32_t _dataPosition;
+};
+
+// ============================================================================
+// [Fog::OTCFF]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'CFF ' - Compact font format table.
+//!
+//! OpenType fonts with PostScript outlines store glyphs in CFF format (version
+//! 1), where each glyph is a Type2 charstring - a small program which draws
+//! the glyph using cubic Bezier curves. The charstrings can call local (per
+//! font or per font-dictionary in CID-keyed fonts) and global subroutines.
+//!
+//! The table is validated once, then the charstrings are interpreted on demand
+//! directly from the table data. Hints are skipped and the output is in font
+//! design units with the y axis flipped (see @ref OTGlyf).
+//!
+//! Specification:
+//!   - http://www.microsoft.com/typography/otspec/cff.htm
+//!   - http://partners.adobe.com/public/developer/en/font/5176.CFF.pdf
+//!   - http://partners.adobe.com/public/developer/en/font/5177.Type2.pdf
+struct FOG_NO_EXPORT OTCFF : public OTTable
+{
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const OTCFFHeader* getHeader() const
+  {
+    return reinterpret_cast<const OTCFFHeader*>(_data);
+  }
+
+  //! @brief Get number of glyphs (charstrings).
+  FOG_INLINE uint32_t getNumberOfGlyphs() const { return _charStrings._count; }
+
+  //! @brief Get whether the font is CID-keyed (uses FDArray/FDSelect).
+  FOG_INLINE bool isCID() const { return _fdCount != 0; }
+
+  // --------------------------------------------------------------------------
+  // [Outline]
+  // --------------------------------------------------------------------------
+
+  //! @brief Append outline of glyph @a glyphId to @a dst (in design units).
+  FOG_INLINE err_t getGlyphOutline(PathF& dst, uint32_t glyphId) const
+  {
+    return fog_ot_api.otcff_getGlyphOutlineF(this, &dst, glyphId);
+  }
+
+  //! @overload
+  FOG_INLINE err_t getGlyphOutline(PathD& dst, uint32_t glyphId) const
+  {
+    return fog_ot_api.otcff_getGlyphOutlineD(this, &dst, glyphId);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief CharStrings INDEX.
+  OTCFFIndex _charStrings;
+  //! @brief Global subroutines INDEX.
+  OTCFFIndex _globalSubrs;
+  //! @brief Local subroutines INDEX (not used by CID-keyed fonts).
+  OTCFFIndex _localSubrs;
+
+  //! @brief Local subroutines per font-dictionary (CID-keyed fonts only,
+  //! allocated by the @ref OTFace allocator).
+  OTCFFIndex* _fdSubrs;
+  //! @brief Count of font-dictionaries (zero if the font is not CID-keyed).
+  uint32_t _fdCount;
+  //! @brief FDSelect format (0 or 3).
+  uint32_t _fdSelectFormat;
+  //! @brief FDSelect position.
+  uint32_t _fdSelectPosition;
+};
+
+//! @}
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackRestore.h>
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TEXT_OPENTYPE_OTCFF_H
@@ -102,6 +102,64 @@ enum OT_HEAD_INDEX_TO_LOC
   OT_HEAD_INDEX_TO_LOC_LONG = 1
 };
 
+// ============================================================================
+// [Fog::OT_GLYF_FLAG]
+// ============================================================================
+
+//! @brief Flags used by simple glyphs stored in 'glyf' table.
+enum OT_GLYF_FLAG
+{
+  //! @brief Point is on the curve (otherwise it's quadratic control point).
+  OT_GLYF_FLAG_ON_CURVE = 0x01,
+  //! @brief X coordinate is 1 byte long (otherwise it's 2 bytes long).
+  OT_GLYF_FLAG_X_SHORT = 0x02,
+  //! @brief Y coordinate is 1 byte long (otherwise it's 2 bytes long).
+  OT_GLYF_FLAG_Y_SHORT = 0x04,
+  //! @brief The flag is followed by a count of repeats.
+  OT_GLYF_FLAG_REPEAT = 0x08,
+  //! @brief If @c OT_GLYF_FLAG_X_SHORT is set then this is a sign of the
+  //! coordinate (positive if set), otherwise the coordinate is the same as
+  //! the previous one (if set).
+  OT_GLYF_FLAG_X_SAME_OR_POSITIVE = 0x10,
+  //! @brief If @c OT_GLYF_FLAG_Y_SHORT is set then this is a sign of the
+  //! coordinate (positive if set), otherwise the coordinate is the same as
+  //! the previous one (if set).
+  OT_GLYF_FLAG_Y_SAME_OR_POSITIVE = 0x20
+};
+
+// ============================================================================
+// [Fog::OT_GLYF_COMPOSITE_FLAG]
+// ============================================================================
+
+//! @brief Flags used by composite glyphs stored in 'glyf' table.
+enum OT_GLYF_COMPOSITE_FLAG
+{
+  //! @brief Arguments are 16-bit (otherwise 8-bit).
+  OT_GLYF_COMPOSITE_FLAG_ARGS_ARE_WORDS = 0x0001,
+  //! @brief Arguments are x and y offsets (otherwise point numbers).
+  OT_GLYF_COMPOSITE_FLAG_ARGS_ARE_XY_VALUES = 0x0002,
+  //! @brief Round x and y offsets to the grid (used by hinting only).
+  OT_GLYF_COMPOSITE_FLAG_ROUND_XY_TO_GRID = 0x0004,
+  //! @brief Component has a simple scale.
+  OT_GLYF_COMPOSITE_FLAG_HAVE_SCALE = 0x0008,
+  //! @brief At least one more component follows.
+  OT_GLYF_COMPOSITE_FLAG_MORE_COMPONENTS = 0x0020,
+  //! @brief Component has a different scale for x and y.
+  OT_GLYF_COMPOSITE_FLAG_HAVE_XY_SCALE = 0x0040,
+  //! @brief Component has a 2x2 transformation matrix.
+  OT_GLYF_COMPOSITE_FLAG_HAVE_2X2 = 0x0080,
+  //! @brief Instructions follow the last component.
+  OT_GLYF_COMPOSITE_FLAG_HAVE_INSTRUCTIONS = 0x0100,
+  //! @brief Use metrics of this component for the composite glyph.
+  OT_GLYF_COMPOSITE_FLAG_USE_MY_METRICS = 0x0200,
+  //! @brief Components of the composite glyph overlap.
+  OT_GLYF_COMPOSITE_FLAG_OVERLAP_COMPOUND = 0x0400,
+  //! @brief Component offset should be scaled.
+  OT_GLYF_COMPOSITE_FLAG_SCALED_COMPONENT_OFFSET = 0x0800,
+  //! @brief Component offset should not be scaled.
+  OT_GLYF_COMPOSITE_FLAG_UNSCALED_COMPONENT_OFFSET = 0x1000
+};
+
 // ============================================================================
 // [Fog::OT_PLATFORM_ID]
 // ============================================================================
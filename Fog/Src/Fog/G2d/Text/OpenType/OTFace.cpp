@@ -5,13 +5,16 @@
 
 // [Dependencies]
 #include <Fog/G2d/Text/Font.h>
+#include <Fog/G2d/Text/OpenType/OTCFF.h>
 #include <Fog/G2d/Text/OpenType/OTCMap.h>
 #include <Fog/G2d/Text/OpenType/OTEnum.h>
 #include <Fog/G2d/Text/OpenType/OTFace.h>
+#include <Fog/G2d/Text/OpenType/OTGlyf.h>
 #include <Fog/G2d/Text/OpenType/OTHHea.h>
 #include <Fog/G2d/Text/OpenType/OTHead.h>
 #include <Fog/G2d/Text/OpenType/OTHmtx.h>
 #include <Fog/G2d/Text/OpenType/OTKern.h>
+#include <Fog/G2d/Text/OpenType/OTLoca.h>
 #include <Fog/G2d/Text/OpenType/OTMaxp.h>
 #include <Fog/G2d/Text/OpenType/OTName.h>
 
@@ -72,9 +75,14 @@ static err_t FOG_CDECL OTFace_initCoreTables(OTFace* self)
   OTCMap* cmap = self->_cmap = reinterpret_cast<OTCMap*>(self->tryLoadTable(FOG_OT_TAG('c', 'm', 'a', 'p')));
   OTKern* kern = self->_kern = reinterpret_cast<OTKern*>(self->tryLoadTable(FOG_OT_TAG('k', 'e', 'r', 'n')));
 
-  if (head == NULL || FOG_IS_ERROR(head->getStatus()))
+  if (head == NULL)
+    return ERR_FONT_INVALID_FACE;
+  if (FOG_IS_ERROR(head->getStatus()))
     return head->getStatus();
-  if (cmap == NULL || FOG_IS_ERROR(cmap->getStatus()))
+
+  if (cmap == NULL)
+    return ERR_FONT_CMAP_NOT_FOUND;
+  if (FOG_IS_ERROR(cmap->getStatus()))
     return cmap->getStatus();
 
   return ERR_OK;
@@ -88,11 +96,14 @@ static size_t FOG_CDECL OTFace_getTableSize(uint32_t tag)
 {
   switch (tag)
   {
+    case FOG_OT_TAG('C', 'F', 'F', ' '): return sizeof(OTCFF);
     case FOG_OT_TAG('c', 'm', 'a', 'p'): return sizeof(OTCMap);
+    case FOG_OT_TAG('g', 'l', 'y', 'f'): return sizeof(OTGlyf);
     case FOG_OT_TAG('h', 'e', 'a', 'd'): return sizeof(OTHead);
     case FOG_OT_TAG('h', 'h', 'e', 'a'): return sizeof(OTHHea);
     case FOG_OT_TAG('h', 'm', 't', 'x'): return sizeof(OTHmtx);
     case FOG_OT_TAG('k', 'e', 'r', 'n'): return sizeof(OTKern);
+    case FOG_OT_TAG('l', 'o', 'c', 'a'): return sizeof(OTLoca);
     case FOG_OT_TAG('m', 'a', 'x', 'p'): return sizeof(OTMaxp);
     case FOG_OT_TAG('n', 'a', 'm', 'e'): return sizeof(OTName);
 
@@ -104,11 +115,14 @@ static err_t FOG_CDECL OTFace_initTable(OTFace* self, OTTable* table)
 {
   switch (table->_tag)
   {
+    case FOG_OT_TAG('C', 'F', 'F', ' '): return fog_ot_api.otcff_init(static_cast<OTCFF*>(table));
     case FOG_OT_TAG('c', 'm', 'a', 'p'): return fog_ot_api.otcmap_init(static_cast<OTCMap*>(table));
+    case FOG_OT_TAG('g', 'l', 'y', 'f'): return fog_ot_api.otglyf_init(static_cast<OTGlyf*>(table));
     case FOG_OT_TAG('h', 'e', 'a', 'd'): return fog_ot_api.othead_init(static_cast<OTHead*>(table));
     case FOG_OT_TAG('h', 'h', 'e', 'a'): return fog_ot_api.othhea_init(static_cast<OTHHea*>(table));
     case FOG_OT_TAG('h', 'm', 't', 'x'): return fog_ot_api.othmtx_init(static_cast<OTHmtx*>(table));
     case FOG_OT_TAG('k', 'e', 'r', 'n'): return fog_ot_api.otkern_init(static_cast<OTKern*>(table));
+    case FOG_OT_TAG('l', 'o', 'c', 'a'): return fog_ot_api.otloca_init(static_cast<OTLoca*>(table));
     case FOG_OT_TAG('m', 'a', 'x', 'p'): return fog_ot_api.otmaxp_init(static_cast<OTMaxp*>(table));
     case FOG_OT_TAG('n', 'a', 'm', 'e'): return fog_ot_api.otname_init(static_cast<OTName*>(table));
 
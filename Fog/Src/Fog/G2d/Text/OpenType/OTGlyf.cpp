@@ -0,0 +1,586 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
+#include <Fog/Core/Tools/Logger.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Text/OpenType/OTEnum.h>
+#include <Fog/G2d/Text/OpenType/OTFace.h>
+#include <Fog/G2d/Text/OpenType/OTGlyf.h>
+#include <Fog/G2d/Text/OpenType/OTLoca.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::OTGlyf - Constants]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Maximum nesting of composite glyphs (protects against malformed
+//! fonts which reference glyphs recursively).
+enum { OT_GLYF_MAX_COMPOSITE_DEPTH = 16 };
+
+// ============================================================================
+// [Fog::OTGlyf - Helpers]
+// ============================================================================
+
+static FOG_INLINE int32_t OTGlyf_readI16(const uint8_t* p)
+{
+  return reinterpret_cast<const OTInt16*>(p)->getValueU();
+}
+
+static FOG_INLINE uint32_t OTGlyf_readU16(const uint8_t* p)
+{
+  return reinterpret_cast<const OTUInt16*>(p)->getValueU();
+}
+
+template<typename NumT>
+static FOG_INLINE NumT OTGlyf_readF2Dot14(const uint8_t* p)
+{
+  return NumT(OTGlyf_readI16(p)) * NumT(1.0 / 16384.0);
+}
+
+// ============================================================================
+// [Fog::OTGlyf - Decode - Simple]
+// ============================================================================
+
+template<typename NumT>
+static err_t OTGlyf_decodeSimple(NumT_(Path)* dst,
+  const uint8_t* p, const uint8_t* pEnd, uint32_t numContours)
+{
+  // --------------------------------------------------------------------------
+  // [Header]
+  // --------------------------------------------------------------------------
+
+  const uint8_t* pEndPts = p + sizeof(OTGlyfHeader);
+  p = pEndPts + numContours * 2;
+
+  if ((size_t)(pEnd - p) < 2)
+    return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+  uint32_t i;
+  uint32_t numPoints = 0;
+
+  for (i = 0; i < numContours; i++)
+  {
+    uint32_t end = OTGlyf_readU16(pEndPts + i * 2) + 1;
+    if (end < numPoints)
+      return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+    numPoints = end;
+  }
+
+  // Skip the instructions, hinting is not used.
+  uint32_t instructionLength = OTGlyf_readU16(p);
+  p += 2;
+
+  if ((size_t)(pEnd - p) < instructionLength)
+    return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+  p += instructionLength;
+
+  if (numPoints == 0)
+    return ERR_OK;
+
+  // --------------------------------------------------------------------------
+  // [Flags / Coordinates]
+  // --------------------------------------------------------------------------
+
+  MemBufferTmp<2048> buffer;
+  NumT_(Point)* pts = reinterpret_cast<NumT_(Point)*>(
+    buffer.alloc(numPoints * (sizeof(NumT_(Point)) + 1)));
+
+  if (FOG_IS_NULL(pts))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  uint8_t* flags = reinterpret_cast<uint8_t*>(pts + numPoints);
+
+  i = 0;
+  while (i < numPoints)
+  {
+    if (p == pEnd)
+      return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+    uint32_t f = *p++;
+    flags[i++] = (uint8_t)f;
+
+    if (f & OT_GLYF_FLAG_REPEAT)
+    {
+      if (p == pEnd)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      uint32_t n = *p++;
+      if (n > numPoints - i)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      while (n)
+      {
+        flags[i++] = (uint8_t)f;
+        n--;
+      }
+    }
+  }
+
+  int32_t c = 0;
+  for (i = 0; i < numPoints; i++)
+  {
+    uint32_t f = flags[i];
+
+    if (f & OT_GLYF_FLAG_X_SHORT)
+    {
+      if (p == pEnd)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      int32_t v = *p++;
+      c += (f & OT_GLYF_FLAG_X_SAME_OR_POSITIVE) ? v : -v;
+    }
+    else if ((f & OT_GLYF_FLAG_X_SAME_OR_POSITIVE) == 0)
+    {
+      if ((size_t)(pEnd - p) < 2)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      c += OTGlyf_readI16(p);
+      p += 2;
+    }
+
+    pts[i].x = NumT(c);
+  }
+
+  c = 0;
+  for (i = 0; i < numPoints; i++)
+  {
+    uint32_t f = flags[i];
+
+    if (f & OT_GLYF_FLAG_Y_SHORT)
+    {
+      if (p == pEnd)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      int32_t v = *p++;
+      c += (f & OT_GLYF_FLAG_Y_SAME_OR_POSITIVE) ? v : -v;
+    }
+    else if ((f & OT_GLYF_FLAG_Y_SAME_OR_POSITIVE) == 0)
+    {
+      if ((size_t)(pEnd - p) < 2)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      c += OTGlyf_readI16(p);
+      p += 2;
+    }
+
+    // Flip, the y axis of font design units points up.
+    pts[i].y = NumT(-c);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Contours]
+  // --------------------------------------------------------------------------
+
+  // Each point generates at most two vertices (quad-to with an implied
+  // on-curve point), each contour needs move-to, the closing quad-to and
+  // close, so we can write the vertices without any further checks.
+  size_t maxVertices = (size_t)numPoints * 2 + (size_t)numContours * 4;
+  size_t index = dst->_add(maxVertices);
+
+  if (index == INVALID_INDEX)
+    return ERR_RT_OUT_OF_MEMORY;
+
+  uint8_t* dstCmd = dst->getCommandsX() + index;
+  NumT_(Point)* dstPts = dst->getVerticesX() + index;
+  NumT_(Point)* dstStart = dstPts;
+
+  uint32_t start = 0;
+
+  for (uint32_t contour = 0; contour < numContours; contour++)
+  {
+    uint32_t end = OTGlyf_readU16(pEndPts + contour * 2) + 1;
+    uint32_t n = end - start;
+
+    const NumT_(Point)* cPts = pts + start;
+    const uint8_t* cFlags = flags + start;
+    start = end;
+
+    // Single point contours are used as anchors by hinting, nothing to draw.
+    if (n < 2)
+      continue;
+
+    // Find an on-curve point to start from. If there is no such point then
+    // the contour starts at the midpoint of the first and last points.
+    NumT_(Point) first(UNINITIALIZED);
+    uint32_t k;
+
+    if (cFlags[0] & OT_GLYF_FLAG_ON_CURVE)
+    {
+      first = cPts[0];
+      cPts++;
+      cFlags++;
+      n--;
+    }
+    else if (cFlags[n - 1] & OT_GLYF_FLAG_ON_CURVE)
+    {
+      first = cPts[n - 1];
+      n--;
+    }
+    else
+    {
+      first.set((cPts[0].x + cPts[n - 1].x) * NumT(0.5),
+                (cPts[0].y + cPts[n - 1].y) * NumT(0.5));
+    }
+
+    dstCmd[0] = PATH_CMD_MOVE_TO;
+    dstPts[0] = first;
+    dstCmd++;
+    dstPts++;
+
+    NumT_(Point) ctrl(UNINITIALIZED);
+    bool hasCtrl = false;
+
+    for (k = 0; k < n; k++)
+    {
+      if (cFlags[k] & OT_GLYF_FLAG_ON_CURVE)
+      {
+        if (hasCtrl)
+        {
+          dstCmd[0] = PATH_CMD_QUAD_TO;
+          dstCmd[1] = PATH_CMD_DATA;
+          dstPts[0] = ctrl;
+          dstPts[1] = cPts[k];
+          dstCmd += 2;
+          dstPts += 2;
+          hasCtrl = false;
+        }
+        else
+        {
+          dstCmd[0] = PATH_CMD_LINE_TO;
+          dstPts[0] = cPts[k];
+          dstCmd++;
+          dstPts++;
+        }
+      }
+      else
+      {
+        if (hasCtrl)
+        {
+          // Two consecutive off-curve points imply an on-curve point in the
+          // middle.
+          dstCmd[0] = PATH_CMD_QUAD_TO;
+          dstCmd[1] = PATH_CMD_DATA;
+          dstPts[0] = ctrl;
+          dstPts[1].set((ctrl.x + cPts[k].x) * NumT(0.5),
+                        (ctrl.y + cPts[k].y) * NumT(0.5));
+          dstCmd += 2;
+          dstPts += 2;
+        }
+
+        ctrl = cPts[k];
+        hasCtrl = true;
+      }
+    }
+
+    if (hasCtrl)
+    {
+      dstCmd[0] = PATH_CMD_QUAD_TO;
+      dstCmd[1] = PATH_CMD_DATA;
+      dstPts[0] = ctrl;
+      dstPts[1] = first;
+      dstCmd += 2;
+      dstPts += 2;
+    }
+
+    dstCmd[0] = PATH_CMD_CLOSE;
+    dstPts[0].setNaN();
+    dstCmd++;
+    dstPts++;
+  }
+
+  dst->_d->length = index + (size_t)(dstPts - dstStart);
+  dst->_d->vType |= PATH_FLAG_DIRTY_BBOX | PATH_FLAG_DIRTY_INFO | PATH_FLAG_HAS_QBEZIER;
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::OTGlyf - Decode - Glyph]
+// ============================================================================
+
+template<typename NumT>
+static err_t OTGlyf_decodeGlyph(const OTGlyf* self,
+  NumT_(Path)* dst, uint32_t glyphId, uint32_t depth);
+
+template<typename NumT>
+static err_t OTGlyf_decodeComposite(const OTGlyf* self,
+  NumT_(Path)* dst, const uint8_t* p, const uint8_t* pEnd, uint32_t depth)
+{
+  if (depth >= OT_GLYF_MAX_COMPOSITE_DEPTH)
+    return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+  p += sizeof(OTGlyfHeader);
+
+  uint32_t flags;
+  do {
+    if ((size_t)(pEnd - p) < 4)
+      return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+    flags = OTGlyf_readU16(p + 0);
+    uint32_t glyphId = OTGlyf_readU16(p + 2);
+    p += 4;
+
+    // ------------------------------------------------------------------------
+    // [Arguments]
+    // ------------------------------------------------------------------------
+
+    int32_t arg1, arg2;
+
+    if (flags & OT_GLYF_COMPOSITE_FLAG_ARGS_ARE_WORDS)
+    {
+      if ((size_t)(pEnd - p) < 4)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      arg1 = OTGlyf_readI16(p + 0);
+      arg2 = OTGlyf_readI16(p + 2);
+      p += 4;
+    }
+    else
+    {
+      if ((size_t)(pEnd - p) < 2)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      arg1 = (int8_t)p[0];
+      arg2 = (int8_t)p[1];
+      p += 2;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Transform]
+    // ------------------------------------------------------------------------
+
+    NumT a = NumT(1.0), b = NumT(0.0);
+    NumT c = NumT(0.0), d = NumT(1.0);
+
+    if (flags & OT_GLYF_COMPOSITE_FLAG_HAVE_SCALE)
+    {
+      if ((size_t)(pEnd - p) < 2)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      a = d = OTGlyf_readF2Dot14<NumT>(p);
+      p += 2;
+    }
+    else if (flags & OT_GLYF_COMPOSITE_FLAG_HAVE_XY_SCALE)
+    {
+      if ((size_t)(pEnd - p) < 4)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      a = OTGlyf_readF2Dot14<NumT>(p + 0);
+      d = OTGlyf_readF2Dot14<NumT>(p + 2);
+      p += 4;
+    }
+    else if (flags & OT_GLYF_COMPOSITE_FLAG_HAVE_2X2)
+    {
+      if ((size_t)(pEnd - p) < 8)
+        return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+      a = OTGlyf_readF2Dot14<NumT>(p + 0);
+      b = OTGlyf_readF2Dot14<NumT>(p + 2);
+      c = OTGlyf_readF2Dot14<NumT>(p + 4);
+      d = OTGlyf_readF2Dot14<NumT>(p + 6);
+      p += 8;
+    }
+
+    // Matching of points (arguments are not xy-values) needs the hinted
+    // outline of both glyphs, it's rarely used and not supported - the
+    // component is placed at the origin.
+    NumT dx = NumT(0.0);
+    NumT dy = NumT(0.0);
+
+    if (flags & OT_GLYF_COMPOSITE_FLAG_ARGS_ARE_XY_VALUES)
+    {
+      dx = NumT(arg1);
+      dy = NumT(arg2);
+
+      if ((flags & (OT_GLYF_COMPOSITE_FLAG_SCALED_COMPONENT_OFFSET |
+                    OT_GLYF_COMPOSITE_FLAG_UNSCALED_COMPONENT_OFFSET)) == OT_GLYF_COMPOSITE_FLAG_SCALED_COMPONENT_OFFSET)
+      {
+        NumT tx = a * dx + c * dy;
+        NumT ty = b * dx + d * dy;
+
+        dx = tx;
+        dy = ty;
+      }
+    }
+
+    // ------------------------------------------------------------------------
+    // [Component]
+    // ------------------------------------------------------------------------
+
+    size_t index = dst->getLength();
+    FOG_RETURN_ON_ERROR(OTGlyf_decodeGlyph<NumT>(self, dst, glyphId, depth + 1));
+
+    size_t length = dst->getLength();
+    if (index == length)
+      continue;
+
+    // The component transform is defined in font design units where the y
+    // axis points up. The decoded vertices are already flipped:
+    //
+    //   x' = a*x + c*y + dx   =>   X' =  a*X - c*Y + dx
+    //   y' = b*x + d*y + dy   =>   Y' = -b*X + d*Y - dy
+    bool isTranslation = (a == NumT(1.0) && b == NumT(0.0) && c == NumT(0.0) && d == NumT(1.0));
+    if (isTranslation && dx == NumT(0.0) && dy == NumT(0.0))
+      continue;
+
+    NumT_(Point)* pts = dst->getVerticesX() + index;
+    NumT_(Point)* end = dst->getVerticesX() + length;
+
+    if (isTranslation)
+    {
+      for (; pts != end; pts++)
+      {
+        pts->x += dx;
+        pts->y -= dy;
+      }
+    }
+    else
+    {
+      for (; pts != end; pts++)
+      {
+        NumT x = pts->x;
+        NumT y = pts->y;
+
+        pts->x =  a * x - c * y + dx;
+        pts->y = -b * x + d * y - dy;
+      }
+    }
+  } while (flags & OT_GLYF_COMPOSITE_FLAG_MORE_COMPONENTS);
+
+  return ERR_OK;
+}
+
+template<typename NumT>
+static err_t OTGlyf_decodeGlyph(const OTGlyf* self,
+  NumT_(Path)* dst, uint32_t glyphId, uint32_t depth)
+{
+  uint32_t offset;
+  uint32_t length;
+
+  if (!self->_loca->getGlyphRange(glyphId, offset, length))
+    return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+  // Glyph without outline.
+  if (length == 0)
+    return ERR_OK;
+
+  uint32_t dataLength = self->getDataLength();
+  if (offset > dataLength || length > dataLength - offset || length < sizeof(OTGlyfHeader))
+    return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+
+  const uint8_t* p = self->getData() + offset;
+  const uint8_t* pEnd = p + length;
+
+  int32_t numContours = reinterpret_cast<const OTGlyfHeader*>(p)->numberOfContours.getValueU();
+
+  if (numContours > 0)
+  {
+    if ((size_t)numContours * 2 > length - sizeof(OTGlyfHeader))
+      return ERR_FONT_GLYF_GLYPH_WRONG_DATA;
+    return OTGlyf_decodeSimple<NumT>(dst, p, pEnd, (uint32_t)numContours);
+  }
+  else if (numContours < 0)
+  {
+    return OTGlyf_decodeComposite<NumT>(self, dst, p, pEnd, depth);
+  }
+  else
+  {
+    return ERR_OK;
+  }
+}
+
+// ============================================================================
+// [Fog::OTGlyf - GetGlyphOutline]
+// ============================================================================
+
+template<typename NumT>
+static err_t FOG_CDECL OTGlyf_getGlyphOutline(const OTGlyf* self, NumT_(Path)* dst, uint32_t glyphId)
+{
+  if (FOG_IS_ERROR(self->getStatus()))
+    return self->getStatus();
+
+  size_t index = dst->getLength();
+  err_t err = OTGlyf_decodeGlyph<NumT>(self, dst, glyphId, 0);
+
+  // Don't leave a partially decoded composite glyph in the path.
+  if (FOG_IS_ERROR(err) && dst->getLength() != index)
+    dst->_d->length = index;
+
+  return err;
+}
+
+// ============================================================================
+// [Fog::OTGlyf - Init / Destroy]
+// ============================================================================
+
+static void FOG_CDECL OTGlyf_destroy(OTGlyf* self)
+{
+  // This results in crash in case that destroy is called twice by accident.
+  self->_destroy = NULL;
+}
+
+static err_t FOG_CDECL OTGlyf_init(OTGlyf* self)
+{
+  // --------------------------------------------------------------------------
+  // [Init]
+  // --------------------------------------------------------------------------
+
+  uint32_t dataLength = self->getDataLength();
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::OTGlyf", "init",
+    "Initializing 'glyf' table (%u bytes).", dataLength);
+#endif // FOG_OT_DEBUG
+
+  FOG_ASSERT_X(self->_tag == FOG_OT_TAG('g', 'l', 'y', 'f'),
+    "Fog::OTGlyf::init() - Not a 'glyf' table.");
+
+  self->_destroy = (OTTableDestroyFunc)OTGlyf_destroy;
+  self->_loca = NULL;
+
+  // --------------------------------------------------------------------------
+  // [Loca]
+  // --------------------------------------------------------------------------
+
+  OTLoca* loca = reinterpret_cast<OTLoca*>(
+    self->getFace()->tryLoadTable(FOG_OT_TAG('l', 'o', 'c', 'a'))); // Depends on 'head', 'maxp'.
+
+  if (FOG_IS_NULL(loca) || FOG_IS_ERROR(loca->getStatus()))
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTGlyf", "init",
+      "Table 'glyf' requires 'loca' table to be present.");
+#endif // FOG_OT_DEBUG
+    return self->setStatus(ERR_FONT_GLYF_HEADER_WRONG_DATA);
+  }
+
+  self->_loca = loca;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void OTGlyf_init(void)
+{
+  OTApi& api = fog_ot_api;
+
+  // --------------------------------------------------------------------------
+  // [OTGlyf]
+  // --------------------------------------------------------------------------
+
+  api.otglyf_init = OTGlyf_init;
+  api.otglyf_getGlyphOutlineF = OTGlyf_getGlyphOutline<float>;
+  api.otglyf_getGlyphOutlineD = OTGlyf_getGlyphOutline<double>;
+}
+
+} // Fog namespace
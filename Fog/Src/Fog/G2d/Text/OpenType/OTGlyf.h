@@ -0,0 +1,102 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TEXT_OPENTYPE_OTGLYF_H
+#define _FOG_G2D_TEXT_OPENTYPE_OTGLYF_H
+
+// [Dependencies]
+#include <Fog/G2d/Text/OpenType/OTApi.h>
+#include <Fog/G2d/Text/OpenType/OTTypes.h>
+
+namespace Fog {
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackByte.h>
+
+//! @addtogroup Fog_G2d_Text_OpenType
+//! @{
+
+// ============================================================================
+// [Fog::OTGlyfHeader]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'glyf' - Glyph header.
+struct FOG_NO_EXPORT OTGlyfHeader
+{
+  //! @brief Number of contours, negative for composite glyphs.
+  OTInt16 numberOfContours;
+  //! @brief Minimum x for coordinate data.
+  OTInt16 xMin;
+  //! @brief Minimum y for coordinate data.
+  OTInt16 yMin;
+  //! @brief Maximum x for coordinate data.
+  OTInt16 xMax;
+  //! @brief Maximum y for coordinate data.
+  OTInt16 yMax;
+};
+
+// ============================================================================
+// [Fog::OTGlyf]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'glyf' - Glyph data table.
+//!
+//! The 'glyf' table contains the data that defines the appearance of the
+//! glyphs in the font. Each glyph is either simple (contours made of quadratic
+//! B-splines) or composite (made of other glyphs, each transformed by a 2x2
+//! matrix and offset). Glyphs are located by the 'loca' table, which is loaded
+//! together with this table.
+//!
+//! The outline decoder works directly on the table data, nothing is copied or
+//! cached, and it emits vertices in font design units with the y axis flipped
+//! (so the baseline is at y=0 and the ascent is negative), which is the
+//! coordinate system used by Fog paths.
+//!
+//! Specification:
+//!   - http://www.microsoft.com/typography/otspec/glyf.htm
+//!   - https://developer.apple.com/fonts/ttrefman/RM06/Chap6glyf.html
+struct FOG_NO_EXPORT OTGlyf : public OTTable
+{
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the associated 'loca' table.
+  FOG_INLINE OTLoca* getLoca() const { return _loca; }
+
+  // --------------------------------------------------------------------------
+  // [Outline]
+  // --------------------------------------------------------------------------
+
+  //! @brief Append outline of glyph @a glyphId to @a dst (in design units).
+  FOG_INLINE err_t getGlyphOutline(PathF& dst, uint32_t glyphId) const
+  {
+    return fog_ot_api.otglyf_getGlyphOutlineF(this, &dst, glyphId);
+  }
+
+  //! @overload
+  FOG_INLINE err_t getGlyphOutline(PathD& dst, uint32_t glyphId) const
+  {
+    return fog_ot_api.otglyf_getGlyphOutlineD(this, &dst, glyphId);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief 'loca' table.
+  OTLoca* _loca;
+};
+
+//! @}
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackRestore.h>
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TEXT_OPENTYPE_OTGLYF_H
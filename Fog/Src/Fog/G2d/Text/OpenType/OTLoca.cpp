@@ -0,0 +1,125 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Dependencies]
+#include <Fog/Core/Tools/Logger.h>
+#include <Fog/G2d/Text/OpenType/OTEnum.h>
+#include <Fog/G2d/Text/OpenType/OTFace.h>
+#include <Fog/G2d/Text/OpenType/OTHead.h>
+#include <Fog/G2d/Text/OpenType/OTLoca.h>
+#include <Fog/G2d/Text/OpenType/OTMaxp.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::OTLoca - Init / Destroy]
+// ============================================================================
+
+static void FOG_CDECL OTLoca_destroy(OTLoca* self)
+{
+  // This results in crash in case that destroy is called twice by accident.
+  self->_destroy = NULL;
+}
+
+static err_t FOG_CDECL OTLoca_init(OTLoca* self)
+{
+  // --------------------------------------------------------------------------
+  // [Init]
+  // --------------------------------------------------------------------------
+
+  uint32_t dataLength = self->getDataLength();
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::OTLoca", "init",
+    "Initializing 'loca' table (%u bytes).", dataLength);
+#endif // FOG_OT_DEBUG
+
+  FOG_ASSERT_X(self->_tag == FOG_OT_TAG('l', 'o', 'c', 'a'),
+    "Fog::OTLoca::init() - Not a 'loca' table.");
+
+  self->_destroy = (OTTableDestroyFunc)OTLoca_destroy;
+  self->_format = OT_HEAD_INDEX_TO_LOC_SHORT;
+  self->_numberOfGlyphs = 0;
+
+  // --------------------------------------------------------------------------
+  // [Header]
+  // --------------------------------------------------------------------------
+
+  OTHead* head = self->getFace()->getHead();
+  OTMaxp* maxp = self->getFace()->getMaxp();
+
+  if (FOG_IS_NULL(head) || FOG_IS_ERROR(head->getStatus()) ||
+      FOG_IS_NULL(maxp) || FOG_IS_ERROR(maxp->getStatus()))
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTLoca", "init",
+      "Table 'loca' requires 'head' and 'maxp' tables to be present.");
+#endif // FOG_OT_DEBUG
+    return self->setStatus(ERR_FONT_LOCA_HEADER_WRONG_DATA);
+  }
+
+  uint32_t format = (uint16_t)head->getHeader()->indexToLocFormat.getValueU();
+  uint32_t numOfGlyphs = maxp->getNumberOfGlyphs();
+
+  if (format > OT_HEAD_INDEX_TO_LOC_LONG)
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTLoca", "init",
+      "Unsupported IndexToLocFormat=%u.", format);
+#endif // FOG_OT_DEBUG
+    return self->setStatus(ERR_FONT_LOCA_HEADER_WRONG_DATA);
+  }
+
+  uint32_t entrySize = (format == OT_HEAD_INDEX_TO_LOC_SHORT) ? 2 : 4;
+
+  // Some fonts store less entries than they should (ignoring the last entry
+  // which is needed to compute the length of the last glyph), so the number
+  // of glyphs is clamped instead of refusing the table.
+  if (dataLength / entrySize <= numOfGlyphs)
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::OTLoca", "init",
+      "Inconsistency - NumberOfGlyphs=%u, DataLength=%u (%u per entry).",
+        numOfGlyphs,
+        dataLength,
+        entrySize);
+#endif // FOG_OT_DEBUG
+
+    if (dataLength < entrySize * 2)
+      return self->setStatus(ERR_FONT_LOCA_HEADER_WRONG_DATA);
+    numOfGlyphs = dataLength / entrySize - 1;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Finished]
+  // --------------------------------------------------------------------------
+
+  self->_format = format;
+  self->_numberOfGlyphs = numOfGlyphs;
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::OTLoca", "init", "Format=%s.", format == OT_HEAD_INDEX_TO_LOC_SHORT ? "Short" : "Long");
+  Logger::info("Fog::OTLoca", "init", "NumberOfGlyphs=%u.", numOfGlyphs);
+#endif // FOG_OT_DEBUG
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void OTLoca_init(void)
+{
+  OTApi& api = fog_ot_api;
+
+  // --------------------------------------------------------------------------
+  // [OTLoca]
+  // --------------------------------------------------------------------------
+
+  api.otloca_init = OTLoca_init;
+}
+
+} // Fog namespace
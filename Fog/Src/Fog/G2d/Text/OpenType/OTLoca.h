@@ -0,0 +1,101 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TEXT_OPENTYPE_OTLOCA_H
+#define _FOG_G2D_TEXT_OPENTYPE_OTLOCA_H
+
+// [Dependencies]
+#include <Fog/G2d/Text/OpenType/OTApi.h>
+#include <Fog/G2d/Text/OpenType/OTEnum.h>
+#include <Fog/G2d/Text/OpenType/OTTypes.h>
+
+namespace Fog {
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackByte.h>
+
+//! @addtogroup Fog_G2d_Text_OpenType
+//! @{
+
+// ============================================================================
+// [Fog::OTLoca]
+// ============================================================================
+
+//! @brief TrueType/OpenType 'loca' - Index to location table.
+//!
+//! The indexToLoc table stores the offsets to the locations of the glyphs in
+//! the font, relative to the beginning of the 'glyf' table. In order to
+//! compute the length of the last glyph element, there is an extra entry after
+//! the last valid index. The version of the table is specified in the 'head'
+//! table (indexToLocFormat), the short version stores the actual offset
+//! divided by 2.
+//!
+//! Specification:
+//!   - http://www.microsoft.com/typography/otspec/loca.htm
+//!   - https://developer.apple.com/fonts/ttrefman/RM06/Chap6loca.html
+struct FOG_NO_EXPORT OTLoca : public OTTable
+{
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the format of the table, see @ref OT_HEAD_INDEX_TO_LOC.
+  FOG_INLINE uint32_t getFormat() const { return _format; }
+
+  //! @brief Get number of glyphs which can be located.
+  FOG_INLINE uint32_t getNumberOfGlyphs() const { return _numberOfGlyphs; }
+
+  //! @brief Get offset and length of the glyph @a glyphId (relative to the
+  //! beginning of the 'glyf' table).
+  //!
+  //! Returns @c false if the @a glyphId is out of range or the entry is
+  //! malformed. Glyphs without outline (space) have zero length.
+  FOG_INLINE bool getGlyphRange(uint32_t glyphId, uint32_t& offset, uint32_t& length) const
+  {
+    if (glyphId >= _numberOfGlyphs)
+      return false;
+
+    uint32_t start, end;
+    if (_format == OT_HEAD_INDEX_TO_LOC_SHORT)
+    {
+      const OTUInt16* p = reinterpret_cast<const OTUInt16*>(_data) + glyphId;
+      start = uint32_t(p[0].getValueU()) * 2;
+      end   = uint32_t(p[1].getValueU()) * 2;
+    }
+    else
+    {
+      const OTUInt32* p = reinterpret_cast<const OTUInt32*>(_data) + glyphId;
+      start = p[0].getValueU();
+      end   = p[1].getValueU();
+    }
+
+    if (start > end)
+      return false;
+
+    offset = start;
+    length = end - start;
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Format, see @ref OT_HEAD_INDEX_TO_LOC.
+  uint32_t _format;
+  //! @brief Number of glyphs (the table contains one extra entry).
+  uint32_t _numberOfGlyphs;
+};
+
+//! @}
+
+// [Byte-Pack]
+#include <Fog/Core/C++/PackRestore.h>
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TEXT_OPENTYPE_OTLOCA_H
@@ -0,0 +1,888 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/OS/DirIterator.h>
+#include <Fog/Core/OS/FileInfo.h>
+#include <Fog/Core/OS/FilePath.h>
+#include <Fog/Core/OS/UserUtil.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/Core/Tools/Logger.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Text/OpenType/OTCFF.h>
+#include <Fog/G2d/Text/OpenType/OTGlyf.h>
+#include <Fog/G2d/Text/OpenType/OTHHea.h>
+#include <Fog/G2d/Text/OpenType/OTHead.h>
+#include <Fog/G2d/Text/UnixFont.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Globals]
+// ============================================================================
+
+static FaceVTable UnixFace_vtable;
+
+static FontEngineVTable UnixFontEngine_vtable;
+static Static<UnixFontEngine> UnixFontEngine_oInstance;
+
+//! @internal
+//!
+//! @brief Maximum depth of font directories to scan (guards symlink loops).
+enum { UNIX_FONT_MAX_DIRECTORY_DEPTH = 8 };
+
+// ============================================================================
+// [Fog::UnixFont - SFNT]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Information about a single face, read directly from the sfnt data
+//! when scanning the font directories.
+struct FOG_NO_EXPORT UnixFont_SfntInfo
+{
+  StringW family;
+  FaceFeatures features;
+  uint32_t emSize;
+};
+
+static FOG_INLINE uint32_t UnixFont_readU16(const uint8_t* p)
+{
+  return reinterpret_cast<const OTUInt16*>(p)->getValueU();
+}
+
+static FOG_INLINE uint32_t UnixFont_readU32(const uint8_t* p)
+{
+  return reinterpret_cast<const OTUInt32*>(p)->getValueU();
+}
+
+//! @internal
+//!
+//! @brief Get count of faces stored in font file (more than one if the file
+//! is a TrueType collection).
+static uint32_t UnixFont_getFaceCount(const uint8_t* data, size_t length)
+{
+  if (length < 12)
+    return 0;
+
+  if (UnixFont_readU32(data) != FOG_OT_TAG('t', 't', 'c', 'f'))
+    return 1;
+
+  uint32_t count = UnixFont_readU32(data + 8);
+  if ((length - 12) / 4 < count)
+    return 0;
+
+  return count;
+}
+
+//! @internal
+//!
+//! @brief Get offset of the sfnt header of face @a index.
+static FOG_INLINE uint32_t UnixFont_getFaceOffset(const uint8_t* data, uint32_t index)
+{
+  if (UnixFont_readU32(data) != FOG_OT_TAG('t', 't', 'c', 'f'))
+    return 0;
+  else
+    return UnixFont_readU32(data + 12 + index * 4);
+}
+
+//! @internal
+//!
+//! @brief Find a table @a tag in a table directory at @a faceOffset.
+static bool UnixFont_findTable(const uint8_t* data, size_t length,
+  uint32_t faceOffset, uint32_t tag, uint32_t* tOffset, uint32_t* tLength)
+{
+  if (faceOffset > length || length - faceOffset < 12)
+    return false;
+
+  const uint8_t* p = data + faceOffset;
+  uint32_t version = UnixFont_readU32(p);
+
+  // TrueType outlines (1.0 or 'true') or PostScript outlines ('OTTO').
+  if (version != 0x00010000 &&
+      version != FOG_OT_TAG('t', 'r', 'u', 'e') &&
+      version != FOG_OT_TAG('O', 'T', 'T', 'O'))
+  {
+    return false;
+  }
+
+  uint32_t numTables = UnixFont_readU16(p + 4);
+  if ((length - faceOffset - 12) / 16 < numTables)
+    return false;
+
+  p += 12;
+  for (uint32_t i = 0; i < numTables; i++, p += 16)
+  {
+    if (UnixFont_readU32(p) != tag)
+      continue;
+
+    uint32_t offset = UnixFont_readU32(p + 8);
+    uint32_t size = UnixFont_readU32(p + 12);
+
+    if (offset > length || size > length - offset)
+      return false;
+
+    *tOffset = offset;
+    *tLength = size;
+    return true;
+  }
+
+  return false;
+}
+
+//! @internal
+//!
+//! @brief Read the family name (prefers the typographic family).
+static bool UnixFont_readFamilyName(const uint8_t* data, uint32_t length, StringW& dst)
+{
+  if (length < 6)
+    return false;
+
+  uint32_t count = UnixFont_readU16(data + 2);
+  uint32_t stringOffset = UnixFont_readU16(data + 4);
+
+  if ((length - 6) / 12 < count || stringOffset > length)
+    return false;
+
+  const uint8_t* bestRecord = NULL;
+  uint32_t bestScore = 0;
+
+  const uint8_t* p = data + 6;
+  for (uint32_t i = 0; i < count; i++, p += 12)
+  {
+    uint32_t platformId = UnixFont_readU16(p + 0);
+    uint32_t specificId = UnixFont_readU16(p + 2);
+    uint32_t languageId = UnixFont_readU16(p + 4);
+    uint32_t nameId = UnixFont_readU16(p + 6);
+
+    uint32_t score;
+
+    if (nameId == 16)
+      score = 16;
+    else if (nameId == 1)
+      score = 0;
+    else
+      continue;
+
+    // Unicode strings are preferred, english (US) name is preferred.
+    if (platformId == 3 && (specificId == 1 || specificId == 10))
+      score += 4 + (languageId == 0x0409) * 8;
+    else if (platformId == 0)
+      score += 3;
+    else if (platformId == 1 && specificId == 0)
+      score += 1 + (languageId == 0) * 8;
+    else
+      continue;
+
+    if (score > bestScore)
+    {
+      bestScore = score;
+      bestRecord = p;
+    }
+  }
+
+  if (bestRecord == NULL)
+    return false;
+
+  uint32_t platformId = UnixFont_readU16(bestRecord + 0);
+  uint32_t sLength = UnixFont_readU16(bestRecord + 8);
+  uint32_t sOffset = UnixFont_readU16(bestRecord + 10);
+
+  if (sOffset > length - stringOffset || sLength > length - stringOffset - sOffset)
+    return false;
+
+  const uint8_t* s = data + stringOffset + sOffset;
+
+  if (platformId == 1)
+  {
+    // Macintosh Roman, use only the ASCII part of the character set.
+    CharW* d = dst._prepare(CONTAINER_OP_REPLACE, sLength);
+    if (FOG_IS_NULL(d))
+      return false;
+
+    for (uint32_t i = 0; i < sLength; i++)
+      d[i] = CharW(s[i] < 0x80 ? s[i] : '?');
+  }
+  else
+  {
+    // UTF-16BE.
+    sLength /= 2;
+
+    CharW* d = dst._prepare(CONTAINER_OP_REPLACE, sLength);
+    if (FOG_IS_NULL(d))
+      return false;
+
+    for (uint32_t i = 0; i < sLength; i++)
+      d[i] = CharW(UnixFont_readU16(s + i * 2));
+  }
+
+  return !dst.isEmpty();
+}
+
+//! @internal
+//!
+//! @brief Read the face information from the sfnt data at @a faceOffset.
+static bool UnixFont_readSfntInfo(const uint8_t* data, size_t length,
+  uint32_t faceOffset, UnixFont_SfntInfo& info)
+{
+  uint32_t tOffset;
+  uint32_t tLength;
+
+  // Only fonts with outlines are supported.
+  if (!UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('g', 'l', 'y', 'f'), &tOffset, &tLength) &&
+      !UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('C', 'F', 'F', ' '), &tOffset, &tLength))
+  {
+    return false;
+  }
+
+  // 'cmap' is needed to shape text.
+  if (!UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('c', 'm', 'a', 'p'), &tOffset, &tLength))
+    return false;
+
+  // 'head'.
+  if (!UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('h', 'e', 'a', 'd'), &tOffset, &tLength) || tLength < 54)
+    return false;
+
+  const uint8_t* head = data + tOffset;
+  uint32_t macStyle = UnixFont_readU16(head + 44);
+
+  info.emSize = UnixFont_readU16(head + 18);
+  if (info.emSize < 16)
+    return false;
+
+  // 'name'.
+  if (!UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('n', 'a', 'm', 'e'), &tOffset, &tLength) ||
+      !UnixFont_readFamilyName(data + tOffset, tLength, info.family))
+  {
+    return false;
+  }
+
+  // 'OS/2' (optional).
+  uint32_t weight = FONT_WEIGHT_NORMAL;
+  uint32_t stretch = FONT_STRETCH_NORMAL;
+  bool italic = (macStyle & 0x0002) != 0;
+
+  if (UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('O', 'S', '/', '2'), &tOffset, &tLength) && tLength >= 64)
+  {
+    const uint8_t* os2 = data + tOffset;
+
+    uint32_t usWeightClass = UnixFont_readU16(os2 + 4);
+    uint32_t usWidthClass = UnixFont_readU16(os2 + 6);
+    uint32_t fsSelection = UnixFont_readU16(os2 + 62);
+
+    // Weight class is 100...900 (some old fonts use 1...9).
+    if (usWeightClass >= 1 && usWeightClass <= 9)
+      usWeightClass *= 100;
+    if (usWeightClass >= 100 && usWeightClass <= 900)
+      weight = usWeightClass / 10;
+
+    // Width class is 1...9, 5 is normal.
+    if (usWidthClass >= 1 && usWidthClass <= 9)
+      stretch = usWidthClass * 10;
+
+    // ITALIC or OBLIQUE.
+    italic = (fsSelection & 0x0201) != 0;
+  }
+
+  info.features = FaceFeatures(weight, stretch, italic);
+  return true;
+}
+
+// ============================================================================
+// [Fog::UnixFace - Create / Destroy]
+// ============================================================================
+
+static void FOG_CDECL UnixFace_freeTableData(OTTable* table)
+{
+  // Table data point to the mapped file.
+  table->_data = NULL;
+  table->_dataLength = 0;
+}
+
+static void FOG_CDECL UnixFace_create(UnixFace* self,
+  const FileMapping& mapping, uint32_t faceOffset,
+  const StringW& family, const FaceFeatures& features)
+{
+  fog_new_p(self) UnixFace(&UnixFace_vtable, family);
+
+  self->engineId = FONT_ENGINE_UNIX;
+  self->features = features;
+
+  self->mapping() = mapping;
+  self->faceOffset = faceOffset;
+
+  self->ot->_freeTableDataFunc = UnixFace_freeTableData;
+  self->ot->initCoreTables();
+
+  OTTable* table;
+
+  table = self->ot->tryLoadTable(FOG_OT_TAG('g', 'l', 'y', 'f'));
+  if (table != NULL && !FOG_IS_ERROR(table->getStatus()))
+    self->glyf = static_cast<OTGlyf*>(table);
+
+  table = self->ot->tryLoadTable(FOG_OT_TAG('C', 'F', 'F', ' '));
+  if (table != NULL && !FOG_IS_ERROR(table->getStatus()))
+    self->cff = static_cast<OTCFF*>(table);
+}
+
+static void FOG_CDECL UnixFace_destroy(Face* self_)
+{
+  UnixFace* self = static_cast<UnixFace*>(self_);
+
+  self->~UnixFace();
+  MemMgr::free(self);
+}
+
+// ============================================================================
+// [Fog::UnixFace - GetTable / ReleaseTable]
+// ============================================================================
+
+static OTFace* FOG_CDECL UnixFace_getOTFace(const Face* self_)
+{
+  const UnixFace* self = static_cast<const UnixFace*>(self_);
+  return const_cast<OTFace*>(&self->ot);
+}
+
+static OTTable* FOG_CDECL UnixFace_getOTTable(const Face* self_, uint32_t tag)
+{
+  const UnixFace* self = static_cast<const UnixFace*>(self_);
+  OTTable* table;
+
+  // Not needed to synchronize, because we only add into the list using atomic
+  // operations.
+  table = self->ot->getTable(tag);
+  if (table != NULL)
+    return table;
+
+  AutoLock locked(UnixFontEngine_oInstance->lock());
+
+  // Try to get the table again in case that it was created before we acquired
+  // the lock.
+  table = self->ot->getTable(tag);
+  if (table != NULL)
+    return table;
+
+  const uint8_t* data = static_cast<const uint8_t*>(self->mapping->getData());
+  size_t length = self->mapping->getLength();
+
+  uint32_t tOffset;
+  uint32_t tLength;
+
+  if (!UnixFont_findTable(data, length, self->faceOffset, tag, &tOffset, &tLength))
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::UnixFace", "getOTTable",
+      "Requested table '%c%c%c%c' not found in the font.",
+        (tag >> 24) & 0xFF,
+        (tag >> 16) & 0xFF,
+        (tag >>  8) & 0xFF,
+        (tag      ) & 0xFF);
+#endif // FOG_OT_DEBUG
+    return NULL;
+  }
+
+  table = const_cast<UnixFace*>(self)->ot->addTable(tag, const_cast<uint8_t*>(data) + tOffset, tLength);
+  if (FOG_IS_NULL(table))
+  {
+#if defined(FOG_OT_DEBUG)
+    Logger::info("Fog::UnixFace", "getOTTable",
+      "Failed to add table '%c%c%c%c' to OTFace.",
+        (tag >> 24) & 0xFF,
+        (tag >> 16) & 0xFF,
+        (tag >>  8) & 0xFF,
+        (tag      ) & 0xFF);
+#endif // FOG_OT_DEBUG
+  }
+
+  return table;
+}
+
+// ============================================================================
+// [Fog::UnixFace - GetOutlineFromGlyphRun]
+// ============================================================================
+
+template<typename NumT>
+static FOG_INLINE err_t UnixFace_getOutlineFromGlyphRunT(FontData* d,
+  NumT_(Path)* dst, uint32_t cntOp, const NumT_(Point)* pt,
+  const uint32_t* glyphList, size_t glyphAdvance,
+  const PointF* positionList, size_t positionAdvance,
+  size_t length)
+{
+  UnixFace* face = static_cast<UnixFace*>(d->face);
+
+  if (cntOp == CONTAINER_OP_REPLACE)
+    dst->clear();
+
+  if (length == 0)
+    return ERR_OK;
+
+  if (face->glyf == NULL && face->cff == NULL)
+    return ERR_FONT_INVALID_FACE;
+
+  // Build the transform, outlines are in design units.
+  NumT_(Transform) transform;
+
+  transform.scale(
+    NumT_(Point)(d->scale, d->scale));
+  transform.transform(
+    NumT_(Transform)(d->matrix._xx, d->matrix._xy, d->matrix._yx, d->matrix._yy, 0.0f, 0.0f));
+
+  if (transform.getType() == TRANSFORM_TYPE_IDENTITY)
+    transform._type = TRANSFORM_TYPE_TRANSLATION;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    size_t index = dst->getLength();
+    err_t err;
+
+    if (face->glyf != NULL)
+      err = face->glyf->getGlyphOutline(*dst, glyphList[0]);
+    else
+      err = face->cff->getGlyphOutline(*dst, glyphList[0]);
+
+    // Malformed glyph is skipped (the decoder doesn't leave partial data in
+    // the path), running out of memory is fatal.
+    if (err == ERR_RT_OUT_OF_MEMORY)
+      return err;
+
+    if (dst->getLength() != index)
+    {
+      transform._20 = pt->x + NumT(positionList[0].x);
+      transform._21 = pt->y + NumT(positionList[0].y);
+      FOG_RETURN_ON_ERROR(dst->transform(transform, Range(index, DETECT_LENGTH)));
+    }
+
+    glyphList = (const uint32_t*)((const uint8_t*)glyphList + glyphAdvance);
+    positionList = (const PointF*)((const uint8_t*)positionList + positionAdvance);
+  }
+
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL UnixFace_getOutlineFromGlyphRunF(FontData* d,
+  PathF* dst, uint32_t cntOp, const PointF* pt,
+  const uint32_t* glyphList, size_t glyphAdvance,
+  const PointF* positionList, size_t positionAdvance,
+  size_t length)
+{
+  return UnixFace_getOutlineFromGlyphRunT<float>(d,
+    dst, cntOp, pt, glyphList, glyphAdvance, positionList, positionAdvance, length);
+}
+
+static err_t FOG_CDECL UnixFace_getOutlineFromGlyphRunD(FontData* d,
+  PathD* dst, uint32_t cntOp, const PointD* pt,
+  const uint32_t* glyphList, size_t glyphAdvance,
+  const PointF* positionList, size_t positionAdvance,
+  size_t length)
+{
+  return UnixFace_getOutlineFromGlyphRunT<double>(d,
+    dst, cntOp, pt, glyphList, glyphAdvance, positionList, positionAdvance, length);
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - Create / Destroy]
+// ============================================================================
+
+static void UnixFontEngine_create(UnixFontEngine* self)
+{
+  fog_new_p(self) UnixFontEngine(&UnixFontEngine_vtable);
+
+  self->engineId = FONT_ENGINE_UNIX;
+  self->defaultFaceName->setAscii8(Ascii8("DejaVu Sans"));
+  self->defaultFont->_d = fog_api.font_oNull->_d->addRef();
+}
+
+static void UnixFontEngine_destroy(FontEngine* self_)
+{
+  UnixFontEngine* self = static_cast<UnixFontEngine*>(self_);
+
+  if (self->defaultFont->_d != NULL)
+  {
+    self->defaultFont->_d->release();
+    self->defaultFont->_d = NULL;
+  }
+
+  self->~UnixFontEngine();
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - QueryFace]
+// ============================================================================
+
+static FOG_INLINE uint32_t UnixFontEngine_score(uint32_t a, uint32_t b)
+{
+  return static_cast<uint32_t>(Math::abs(int32_t(a) - int32_t(b)));
+}
+
+static err_t FOG_CDECL UnixFontEngine_queryFace(const FontEngine* self_,
+  Face** dst, const StringW* family, const FaceFeatures* features)
+{
+  *dst = NULL;
+
+  const UnixFontEngine* self = static_cast<const UnixFontEngine*>(self_);
+  AutoLock locked(self->lock());
+
+  UnixFace* face = static_cast<UnixFace*>(self->cache->getExactFace(*family, *features));
+  if (face != NULL)
+  {
+    *dst = face;
+    return ERR_OK;
+  }
+
+  Range range = self->faceCollection->getFamilyRange(*family);
+  if (!range.isValid())
+    return ERR_FONT_NOT_MATCHED;
+
+  const FaceInfo* pInfo = self->faceCollection->getList().getData();
+  const FaceInfo* pEnd = pInfo;
+
+  pInfo += range.getStart();
+  pEnd += range.getEnd();
+
+  const FaceInfo* bestInfo = NULL;
+  uint32_t bestDiff = UINT32_MAX;
+  FaceFeatures bestFeatures;
+
+  uint32_t isItalic = features->getItalic();
+
+  do {
+    FaceFeatures cFeatures = pInfo->_d->features;
+    uint32_t cDiff = 0;
+
+    // If the requested font is not italic, but the font in FontInfo is,
+    // then we setup the biggest possible difference. The opposite way
+    // is not a problem, because we can switch to oblique style.
+    if (cFeatures.getItalic() && !isItalic)
+      cDiff |= 0x80000000;
+
+    // Stretch makes bigger difference than weight. We can tune this later.
+    cDiff += UnixFontEngine_score(cFeatures.getStretch(), features->getStretch());
+    cDiff += UnixFontEngine_score(cFeatures.getWeight(), features->getWeight()) * 2;
+
+    if (cDiff < bestDiff)
+    {
+      bestDiff = cDiff;
+      bestFeatures = cFeatures;
+      bestInfo = pInfo;
+
+      // Exact match.
+      if (cDiff == 0)
+        break;
+    }
+  } while (++pInfo != pEnd);
+
+  if (bestInfo == NULL)
+    return ERR_FONT_NOT_MATCHED;
+
+  face = static_cast<UnixFace*>(self->cache->getExactFace(*family, bestFeatures));
+  if (face != NULL)
+  {
+    *dst = face;
+    return ERR_OK;
+  }
+
+  FileMapping mapping;
+  FOG_RETURN_ON_ERROR(mapping.open(bestInfo->getFileName(), FILE_MAPPING_FLAG_LOAD_FALLBACK));
+
+  const uint8_t* data = static_cast<const uint8_t*>(mapping.getData());
+  size_t length = mapping.getLength();
+
+  // The file can be a TrueType collection, find the matching face.
+  uint32_t faceCount = UnixFont_getFaceCount(data, length);
+  uint32_t faceOffset = 0;
+  uint32_t faceIndex;
+
+  UnixFont_SfntInfo sfntInfo;
+
+  for (faceIndex = 0; faceIndex < faceCount; faceIndex++)
+  {
+    faceOffset = UnixFont_getFaceOffset(data, faceIndex);
+
+    if (UnixFont_readSfntInfo(data, length, faceOffset, sfntInfo) &&
+        sfntInfo.family == *family &&
+        sfntInfo.features == bestFeatures)
+    {
+      break;
+    }
+  }
+
+  // Font file was modified after the font directories were scanned.
+  if (faceIndex == faceCount)
+    return ERR_FONT_NOT_MATCHED;
+
+  face = static_cast<UnixFace*>(MemMgr::alloc(sizeof(UnixFace)));
+  if (FOG_IS_NULL(face))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  UnixFace_create(face, mapping, faceOffset, *family, bestFeatures);
+
+  OTHead* head = face->ot->getHead();
+  OTHHea* hhea = face->ot->getHHea();
+
+  if (face->ot->getCMap() == NULL || head == NULL || hhea == NULL ||
+      (face->glyf == NULL && face->cff == NULL))
+  {
+    face->release();
+    return ERR_FONT_INVALID_FACE;
+  }
+
+  FontMetrics& fm = face->designMetrics;
+  const OTHHeaHeader* hheaHeader = hhea->getHeader();
+
+  fm._size        = float(head->getUnitsPerEM());
+  fm._ascent      = float(hheaHeader->ascender.getValueU());
+  fm._descent     = float(-hheaHeader->descender.getValueU());
+  fm._lineGap     = float(hheaHeader->lineGap.getValueU());
+  fm._capHeight   = 0.0f;
+  fm._xHeight     = 0.0f;
+  fm._lineSpacing = fm._ascent + fm._descent + fm._lineGap;
+
+  // Use 'OS/2' sxHeight and sCapHeight if available (version 2+).
+  uint32_t tOffset;
+  uint32_t tLength;
+
+  if (UnixFont_findTable(data, length, faceOffset, FOG_OT_TAG('O', 'S', '/', '2'), &tOffset, &tLength) &&
+      tLength >= 90 && UnixFont_readU16(data + tOffset) >= 2)
+  {
+    fm._xHeight   = float(reinterpret_cast<const OTInt16*>(data + tOffset + 86)->getValueU());
+    fm._capHeight = float(reinterpret_cast<const OTInt16*>(data + tOffset + 88)->getValueU());
+  }
+
+  // Make a guess in case that the information is not in the font.
+  if (fm._xHeight <= 0.0f)
+    fm._xHeight = fm._ascent * 0.56f;
+
+  face->designEm = fm._size;
+
+  self->cache->put(*family, bestFeatures, face);
+
+  *dst = face;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - GetAvailableFaces]
+// ============================================================================
+
+static err_t FOG_CDECL UnixFontEngine_getAvailableFaces(const FontEngine* self_,
+  FaceCollection* dst)
+{
+  const UnixFontEngine* self = static_cast<const UnixFontEngine*>(self_);
+  AutoLock locked(self->lock());
+
+  return dst->setCollection(self->faceCollection());
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - UpdateAvailableFaces]
+// ============================================================================
+
+static void UnixFontEngine_updateAvailableFaces_addFile(FaceCollection* collection,
+  const StringW& fileName)
+{
+  FileMapping mapping;
+  if (mapping.open(fileName, FILE_MAPPING_FLAG_LOAD_FALLBACK) != ERR_OK)
+    return;
+
+  const uint8_t* data = static_cast<const uint8_t*>(mapping.getData());
+  size_t length = mapping.getLength();
+
+  uint32_t faceCount = UnixFont_getFaceCount(data, length);
+  UnixFont_SfntInfo sfntInfo;
+
+  for (uint32_t faceIndex = 0; faceIndex < faceCount; faceIndex++)
+  {
+    uint32_t faceOffset = UnixFont_getFaceOffset(data, faceIndex);
+
+    if (!UnixFont_readSfntInfo(data, length, faceOffset, sfntInfo))
+      continue;
+
+    // The first font found wins (user fonts are scanned first).
+    if (collection->indexOf(sfntInfo.family, sfntInfo.features) != INVALID_INDEX)
+      continue;
+
+    FaceInfo item;
+
+    item.setFamilyName(sfntInfo.family);
+    item.setFileName(fileName);
+    item.setFeatures(sfntInfo.features);
+    item.setMetrics(FaceInfoMetrics(sfntInfo.emSize));
+
+    collection->addItem(item);
+  }
+}
+
+static void UnixFontEngine_updateAvailableFaces_addDirectory(FaceCollection* collection,
+  const StringW& path, uint32_t depth)
+{
+  DirIterator dir;
+  if (dir.open(path) != ERR_OK)
+    return;
+
+  FileInfo fileInfo;
+  StringW fileName;
+
+  while (dir.read(fileInfo))
+  {
+    const StringW& name = fileInfo.getFileName();
+    if (name.isEmpty() || name.getAt(0) == CharW('.'))
+      continue;
+
+    if (FilePath::join(fileName, path, name) != ERR_OK)
+      continue;
+
+    if (fileInfo.getFileFlags() & FILE_INFO_DIRECTORY)
+    {
+      if (depth < UNIX_FONT_MAX_DIRECTORY_DEPTH)
+        UnixFontEngine_updateAvailableFaces_addDirectory(collection, fileName, depth + 1);
+    }
+    else if (name.endsWith(Ascii8(".ttf"), CASE_INSENSITIVE) ||
+             name.endsWith(Ascii8(".otf"), CASE_INSENSITIVE) ||
+             name.endsWith(Ascii8(".ttc"), CASE_INSENSITIVE))
+    {
+      UnixFontEngine_updateAvailableFaces_addFile(collection, fileName);
+    }
+  }
+}
+
+static err_t FOG_CDECL UnixFontEngine_updateAvailableFaces(UnixFontEngine* self)
+{
+  AutoLock locked(self->lock());
+
+  FaceCollection* collection = &self->faceCollection;
+  collection->clear();
+
+  StringW home;
+  StringW path;
+
+  if (UserUtil::getUserDirectory(home, USER_DIRECTORY_HOME) == ERR_OK && !home.isEmpty())
+  {
+    if (FilePath::join(path, home, StringW::fromAscii8(".local/share/fonts")) == ERR_OK)
+      UnixFontEngine_updateAvailableFaces_addDirectory(collection, path, 0);
+
+    if (FilePath::join(path, home, StringW::fromAscii8(".fonts")) == ERR_OK)
+      UnixFontEngine_updateAvailableFaces_addDirectory(collection, path, 0);
+  }
+
+  UnixFontEngine_updateAvailableFaces_addDirectory(collection, StringW::fromAscii8("/usr/local/share/fonts"), 0);
+  UnixFontEngine_updateAvailableFaces_addDirectory(collection, StringW::fromAscii8("/usr/share/fonts"), 0);
+
+#if defined(FOG_OT_DEBUG)
+  Logger::info("Fog::UnixFontEngine", "updateAvailableFaces",
+    "Found %u faces.", (uint)collection->getList().getLength());
+#endif // FOG_OT_DEBUG
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - GetDefaultFace]
+// ============================================================================
+
+static err_t FOG_CDECL UnixFontEngine_getDefaultFace(const FontEngine* self_,
+  FaceInfo* dst)
+{
+  const UnixFontEngine* self = static_cast<const UnixFontEngine*>(self_);
+  AutoLock locked(self->lock());
+
+  FontData* d = self->defaultFont->_d;
+  FaceFeatures features;
+
+  features.setWeight(d->features.getWeight());
+  features.setStretch(d->features.getStretch());
+  features.setItalic(d->features.getStyle() == FONT_STYLE_ITALIC);
+
+  dst->setFamilyName(d->face->family);
+  dst->setFileName(StringW::getEmptyInstance());
+  dst->setFeatures(features);
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::UnixFontEngine - SetupDefaultFace]
+// ============================================================================
+
+static err_t FOG_CDECL UnixFontEngine_setupDefaultFace(UnixFontEngine* self)
+{
+  FaceFeatures features(FONT_WEIGHT_NORMAL, FONT_STRETCH_NORMAL, false);
+  Face* face;
+
+  StringW name = self->defaultFaceName;
+  float size = 12.0f;
+
+  // Fallback to the first available family if the default one is not
+  // installed.
+  if (!self->faceCollection->getFamilyRange(name).isValid())
+  {
+    if (self->faceCollection->getList().isEmpty())
+      return ERR_FONT_NOT_MATCHED;
+    name = self->faceCollection->getList().getAt(0).getFamilyName();
+  }
+
+  FOG_RETURN_ON_ERROR(self->queryFace(&face, name, features));
+
+  Static<Font> font;
+  font.init();
+
+  err_t err = font->_init(face, size, FontFeatures(), FontMatrix());
+  if (FOG_IS_ERROR(err))
+  {
+    font.destroy();
+    face->release();
+    return err;
+  }
+  else
+  {
+    self->defaultFont->_d = font->_d;
+    return ERR_OK;
+  }
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Font_init_unix(void)
+{
+  // --------------------------------------------------------------------------
+  // [UnixFace / UnixFontEngine]
+  // --------------------------------------------------------------------------
+
+  UnixFace_vtable.destroy = UnixFace_destroy;
+  UnixFace_vtable.getOTFace = UnixFace_getOTFace;
+  UnixFace_vtable.getOTTable = UnixFace_getOTTable;
+  UnixFace_vtable.getOutlineFromGlyphRunF = UnixFace_getOutlineFromGlyphRunF;
+  UnixFace_vtable.getOutlineFromGlyphRunD = UnixFace_getOutlineFromGlyphRunD;
+
+  UnixFontEngine_vtable.destroy = UnixFontEngine_destroy;
+  UnixFontEngine_vtable.getAvailableFaces = UnixFontEngine_getAvailableFaces;
+  UnixFontEngine_vtable.getDefaultFace = UnixFontEngine_getDefaultFace;
+  UnixFontEngine_vtable.queryFace = UnixFontEngine_queryFace;
+
+  UnixFontEngine* engine = &UnixFontEngine_oInstance;
+  UnixFontEngine_create(engine);
+
+  UnixFontEngine_updateAvailableFaces(engine);
+
+  // Keep the null engine if there are no usable fonts in the system.
+  if (UnixFontEngine_setupDefaultFace(engine) != ERR_OK)
+  {
+    UnixFontEngine_destroy(engine);
+    return;
+  }
+
+  fog_api.fontengine_oGlobal = engine;
+}
+
+} // Fog namespace
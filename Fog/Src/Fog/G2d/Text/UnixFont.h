@@ -0,0 +1,122 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TEXT_UNIXFONT_H
+#define _FOG_G2D_TEXT_UNIXFONT_H
+
+// [Dependencies]
+#include <Fog/Core/OS/FileMapping.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/G2d/Text/Font.h>
+#include <Fog/G2d/Text/OpenType/OTFace.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Text
+//! @{
+
+// ============================================================================
+// [Fog::UnixFace]
+// ============================================================================
+
+//! @brief Font-face loaded from a TrueType/OpenType file.
+//!
+//! The font file is memory mapped and all OpenType tables point directly to
+//! the mapped data (nothing is copied). Glyph outlines are decoded by 'glyf'
+//! or 'CFF ' table, depending on the font flavor.
+struct FOG_NO_EXPORT UnixFace : public Face
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE UnixFace(const FaceVTable* vtable_, const StringW& family_) :
+    Face(vtable_, family_)
+  {
+    mapping.init();
+    faceOffset = 0;
+
+    ot.init();
+    ot->_face = this;
+
+    glyf = NULL;
+    cff = NULL;
+  }
+
+  FOG_INLINE ~UnixFace()
+  {
+    // Tables point to the mapped data, so destroy them first.
+    ot.destroy();
+    mapping.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Mapped font file.
+  Static<FileMapping> mapping;
+  //! @brief Offset of the sfnt header in the file (non-zero for collections).
+  uint32_t faceOffset;
+
+  //! @brief TrueType/OpenType face.
+  Static<OTFace> ot;
+
+  //! @brief 'glyf' table (TrueType outlines), or @c NULL.
+  OTGlyf* glyf;
+  //! @brief 'CFF ' table (PostScript outlines), or @c NULL.
+  OTCFF* cff;
+
+private:
+  FOG_NO_COPY(UnixFace)
+};
+
+// ============================================================================
+// [Fog::UnixFontEngine]
+// ============================================================================
+
+//! @brief Font engine which locates TrueType/OpenType files in the standard
+//! font directories and decodes them using the OpenType support of Fog.
+struct FOG_NO_EXPORT UnixFontEngine : public FontEngine
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE UnixFontEngine(FontEngineVTable* vtable_) :
+    FontEngine(vtable_)
+  {
+    lock.init();
+    cache.init();
+    defaultFaceName.init();
+  }
+
+  FOG_INLINE ~UnixFontEngine()
+  {
+    defaultFaceName.destroy();
+    cache.destroy();
+    lock.destroy();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  mutable Static<Lock> lock;
+  mutable Static<FaceCache> cache;
+
+  Static<StringW> defaultFaceName;
+
+private:
+  FOG_NO_COPY(UnixFontEngine)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TEXT_UNIXFONT_H
@@ -0,0 +1,1004 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Acc/AccC.h>
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/Core/Threading/ThreadPool.h>
+#include <Fog/Core/Tools/Cpu.h>
+#include <Fog/G2d/Tools/ColorQuantizer_p.h>
+#include <Fog/G2d/Tools/DitherTable_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::ColorQuantizer - Global]
+// ============================================================================
+
+ColorQuantizerApi ColorQuantizer_api;
+
+// ============================================================================
+// [Fog::ColorQuantizer - Helpers]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Count of moments per axis, the first one is always zero.
+enum { COLOR_QUANTIZER_MOMENT_SIZE = (1 << ColorQuantizer::HIST_BITS) + 1 };
+
+//! @internal
+//!
+//! @brief Cumulative moments of the histogram (Wu's quantizer).
+struct FOG_NO_EXPORT ColorQuantizerMoment
+{
+  int64_t w;
+  int64_t r;
+  int64_t g;
+  int64_t b;
+  double q;
+};
+
+//! @internal
+//!
+//! @brief Box of the histogram, lower bounds are exclusive, upper inclusive.
+struct FOG_NO_EXPORT ColorQuantizerCube
+{
+  int r0, r1;
+  int g0, g1;
+  int b0, b1;
+};
+
+static FOG_INLINE int ColorQuantizer_clamp255(int x)
+{
+  return x < 0 ? 0 : x > 255 ? 255 : x;
+}
+
+static FOG_INLINE uint32_t ColorQuantizer_hashExact(uint32_t c)
+{
+  return (c * 0x9E3779B1U) >> 23;
+}
+
+static FOG_INLINE size_t ColorQuantizer_momentIndex(int r, int g, int b)
+{
+  return ((size_t)r * COLOR_QUANTIZER_MOMENT_SIZE + (size_t)g) * COLOR_QUANTIZER_MOMENT_SIZE + (size_t)b;
+}
+
+//! @internal
+//!
+//! @brief Get moments of the part of the cube having the coordinate of @a axis
+//! lower or equal to @a pos.
+static void ColorQuantizer_face(ColorQuantizerMoment& dst, const ColorQuantizerMoment* m,
+  const ColorQuantizerCube& c, uint32_t axis, int pos)
+{
+  const ColorQuantizerMoment* m0;
+  const ColorQuantizerMoment* m1;
+  const ColorQuantizerMoment* m2;
+  const ColorQuantizerMoment* m3;
+
+  switch (axis)
+  {
+    case 0:
+      m0 = &m[ColorQuantizer_momentIndex(pos, c.g1, c.b1)];
+      m1 = &m[ColorQuantizer_momentIndex(pos, c.g1, c.b0)];
+      m2 = &m[ColorQuantizer_momentIndex(pos, c.g0, c.b1)];
+      m3 = &m[ColorQuantizer_momentIndex(pos, c.g0, c.b0)];
+      break;
+
+    case 1:
+      m0 = &m[ColorQuantizer_momentIndex(c.r1, pos, c.b1)];
+      m1 = &m[ColorQuantizer_momentIndex(c.r1, pos, c.b0)];
+      m2 = &m[ColorQuantizer_momentIndex(c.r0, pos, c.b1)];
+      m3 = &m[ColorQuantizer_momentIndex(c.r0, pos, c.b0)];
+      break;
+
+    default:
+      m0 = &m[ColorQuantizer_momentIndex(c.r1, c.g1, pos)];
+      m1 = &m[ColorQuantizer_momentIndex(c.r1, c.g0, pos)];
+      m2 = &m[ColorQuantizer_momentIndex(c.r0, c.g1, pos)];
+      m3 = &m[ColorQuantizer_momentIndex(c.r0, c.g0, pos)];
+      break;
+  }
+
+  dst.w = m0->w - m1->w - m2->w + m3->w;
+  dst.r = m0->r - m1->r - m2->r + m3->r;
+  dst.g = m0->g - m1->g - m2->g + m3->g;
+  dst.b = m0->b - m1->b - m2->b + m3->b;
+  dst.q = m0->q - m1->q - m2->q + m3->q;
+}
+
+static void ColorQuantizer_volume(ColorQuantizerMoment& dst, const ColorQuantizerMoment* m, const ColorQuantizerCube& c)
+{
+  ColorQuantizerMoment lo;
+
+  ColorQuantizer_face(dst, m, c, 0, c.r1);
+  ColorQuantizer_face(lo, m, c, 0, c.r0);
+
+  dst.w -= lo.w;
+  dst.r -= lo.r;
+  dst.g -= lo.g;
+  dst.b -= lo.b;
+  dst.q -= lo.q;
+}
+
+static FOG_INLINE double ColorQuantizer_weightedSquare(int64_t w, int64_t r, int64_t g, int64_t b)
+{
+  double dr = (double)r;
+  double dg = (double)g;
+  double db = (double)b;
+
+  return (dr * dr + dg * dg + db * db) / (double)w;
+}
+
+static double ColorQuantizer_variance(const ColorQuantizerMoment* m, const ColorQuantizerCube& c)
+{
+  ColorQuantizerMoment v;
+  ColorQuantizer_volume(v, m, c);
+
+  if (v.w == 0)
+    return 0.0;
+
+  return v.q - ColorQuantizer_weightedSquare(v.w, v.r, v.g, v.b);
+}
+
+//! @internal
+//!
+//! @brief Find the cut of the cube along @a axis which minimizes the sum of
+//! variances of both parts. Returns the score, @a cut is -1 if there is none.
+static double ColorQuantizer_maximize(const ColorQuantizerMoment* m, const ColorQuantizerCube& c,
+  uint32_t axis, int first, int last, int& cut, const ColorQuantizerMoment& whole)
+{
+  ColorQuantizerMoment base;
+  ColorQuantizer_face(base, m, c, axis, first - 1);
+
+  double best = 0.0;
+  cut = -1;
+
+  for (int i = first; i < last; i++)
+  {
+    ColorQuantizerMoment half;
+    ColorQuantizer_face(half, m, c, axis, i);
+
+    int64_t hw = half.w - base.w;
+    int64_t rw = whole.w - hw;
+
+    if (hw == 0 || rw == 0)
+      continue;
+
+    int64_t hr = half.r - base.r;
+    int64_t hg = half.g - base.g;
+    int64_t hb = half.b - base.b;
+
+    double score = ColorQuantizer_weightedSquare(hw, hr, hg, hb) +
+                   ColorQuantizer_weightedSquare(rw, whole.r - hr, whole.g - hg, whole.b - hb);
+
+    if (score > best)
+    {
+      best = score;
+      cut = i;
+    }
+  }
+
+  return best;
+}
+
+//! @internal
+//!
+//! @brief Cut the cube @a a into @a a and @a b, returns false if it's not
+//! possible.
+static bool ColorQuantizer_cut(const ColorQuantizerMoment* m, ColorQuantizerCube& a, ColorQuantizerCube& b)
+{
+  ColorQuantizerMoment whole;
+  ColorQuantizer_volume(whole, m, a);
+
+  int cutR, cutG, cutB;
+  double maxR = ColorQuantizer_maximize(m, a, 0, a.r0 + 1, a.r1, cutR, whole);
+  double maxG = ColorQuantizer_maximize(m, a, 1, a.g0 + 1, a.g1, cutG, whole);
+  double maxB = ColorQuantizer_maximize(m, a, 2, a.b0 + 1, a.b1, cutB, whole);
+
+  b = a;
+
+  if (maxR >= maxG && maxR >= maxB)
+  {
+    if (cutR < 0)
+      return false;
+    b.r0 = a.r1 = cutR;
+  }
+  else if (maxG >= maxB)
+  {
+    b.g0 = a.g1 = cutG;
+  }
+  else
+  {
+    b.b0 = a.b1 = cutB;
+  }
+
+  return true;
+}
+
+static FOG_INLINE int ColorQuantizer_cellCount(const ColorQuantizerCube& c)
+{
+  return (c.r1 - c.r0) * (c.g1 - c.g0) * (c.b1 - c.b0);
+}
+
+//! @internal
+//!
+//! @brief Fill the table passed to @c ColorQuantizerApi::MapSpanFunc for a row
+//! @a y starting at @a x.
+static void ColorQuantizer_makeDither(uint32_t* dither, int x, int y, int spread)
+{
+  const uint8_t* matrix = DitherTable::matrix[y & DitherTable::MASK];
+
+  for (int i = 0; i < DitherTable::SIZE; i++)
+  {
+    int d = ((int)matrix[(x + i) & DitherTable::MASK] * 2 - (DitherTable::DIV - 1)) * spread / (DitherTable::DIV * 2);
+
+    dither[i                    ] = d > 0 ? (uint32_t)( d) * 0x00010101U : 0U;
+    dither[i + DitherTable::SIZE] = d < 0 ? (uint32_t)(-d) * 0x00010101U : 0U;
+  }
+}
+
+//! @internal
+//!
+//! @brief Fetch @a w pixels of @a format to opaque ARGB32 pixels.
+static void ColorQuantizer_fetchRow(uint32_t* dst, const uint8_t* src, uint32_t format, int w)
+{
+  int x;
+
+  // ${IMAGE_FORMAT:BEGIN}
+  switch (format)
+  {
+    case IMAGE_FORMAT_PRGB32:
+    case IMAGE_FORMAT_XRGB32:
+      for (x = 0; x < w; x++, src += 4)
+      {
+        uint32_t pix0p;
+
+        Acc::p32Load4a(pix0p, src);
+        dst[x] = pix0p | 0xFF000000;
+      }
+      break;
+
+    case IMAGE_FORMAT_RGB24:
+      for (x = 0; x < w; x++, src += 3)
+      {
+        uint32_t pix0p;
+
+        Acc::p32Load3b(pix0p, src);
+        dst[x] = pix0p | 0xFF000000;
+      }
+      break;
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+  // ${IMAGE_FORMAT:END}
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Construction / Destruction]
+// ============================================================================
+
+ColorQuantizer::ColorQuantizer() :
+  _hist(NULL),
+  _lut(NULL),
+  _err(NULL),
+  _errCapacity(0)
+{
+  reset();
+}
+
+ColorQuantizer::~ColorQuantizer()
+{
+  if (_hist) MemMgr::free(_hist);
+  if (_lut) MemMgr::free(_lut);
+  if (_err) MemMgr::free(_err);
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Reset]
+// ============================================================================
+
+void ColorQuantizer::reset()
+{
+  if (_hist)
+    MemOps::zero(_hist, HIST_SIZE * sizeof(Bin));
+
+  MemOps::zero(_exactKeys, sizeof(_exactKeys));
+  _exactCount = 0;
+
+  _length = 0;
+  _exact = true;
+
+  _ditherType = DITHER_TYPE_NONE;
+  _ditherSpread = 0;
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Histogram]
+// ============================================================================
+
+err_t ColorQuantizer::addRow(const uint32_t* src, uint32_t length)
+{
+  if (FOG_IS_NULL(_hist))
+  {
+    _hist = reinterpret_cast<Bin*>(MemMgr::alloc(HIST_SIZE * sizeof(Bin)));
+    if (FOG_IS_NULL(_hist))
+      return ERR_RT_OUT_OF_MEMORY;
+    MemOps::zero(_hist, HIST_SIZE * sizeof(Bin));
+  }
+
+  // Runs of the same color are common, the bin and the low bits of the last
+  // color are kept so only a new color needs to be decomposed.
+  uint32_t last = 0;
+  Bin* bin = NULL;
+
+  uint32_t lr = 0;
+  uint32_t lg = 0;
+  uint32_t lb = 0;
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    uint32_t c = src[i];
+    if ((c >> 24) == 0)
+      continue;
+
+    c |= 0xFF000000;
+    if (c != last)
+    {
+      last = c;
+
+      uint32_t r = (c >> 16) & 0xFF;
+      uint32_t g = (c >>  8) & 0xFF;
+      uint32_t b = (c      ) & 0xFF;
+
+      bin = &_hist[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+      lr = r & 7;
+      lg = g & 7;
+      lb = b & 7;
+
+      // Track exact colors until there is more than 256 of them.
+      if (_exactCount <= 256)
+      {
+        uint32_t h = ColorQuantizer_hashExact(c);
+
+        for (;;)
+        {
+          uint32_t key = _exactKeys[h];
+
+          if (key == c)
+            break;
+
+          if (key == 0)
+          {
+            if (_exactCount < 256)
+            {
+              _exactKeys[h] = c;
+              _exactIndex[h] = (uint8_t)_exactCount;
+              _exactColors[_exactCount] = c;
+            }
+
+            _exactCount++;
+            break;
+          }
+
+          h = (h + 1) & (EXACT_SIZE - 1);
+        }
+      }
+    }
+
+    bin->count++;
+    bin->r += lr;
+    bin->g += lg;
+    bin->b += lb;
+  }
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Palette]
+// ============================================================================
+
+err_t ColorQuantizer::buildPalette(uint32_t maxColors)
+{
+  if (maxColors < 1) maxColors = 1;
+  if (maxColors > 256) maxColors = 256;
+
+  _length = 0;
+  _exact = false;
+  _ditherSpread = 0;
+
+  // --------------------------------------------------------------------------
+  // [Exact]
+  // --------------------------------------------------------------------------
+
+  if (_exactCount <= maxColors)
+  {
+    for (uint32_t i = 0; i < _exactCount; i++)
+      _palette[i].setPacked32(_exactColors[i]);
+
+    _length = _exactCount;
+    _exact = true;
+    return ERR_OK;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Moments]
+  // --------------------------------------------------------------------------
+
+  if (FOG_IS_NULL(_lut))
+  {
+    _lut = reinterpret_cast<uint8_t*>(MemMgr::alloc(HIST_SIZE));
+    if (FOG_IS_NULL(_lut))
+      return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  const int MS = COLOR_QUANTIZER_MOMENT_SIZE;
+
+  ColorQuantizerMoment* m = reinterpret_cast<ColorQuantizerMoment*>(
+    MemMgr::calloc((size_t)MS * MS * MS * sizeof(ColorQuantizerMoment)));
+  if (FOG_IS_NULL(m))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  // The squared moment is calculated from the mean color of each bin, the
+  // variance inside of the bin is the same for all cuts so it's not needed.
+  {
+    ColorQuantizerMoment area[COLOR_QUANTIZER_MOMENT_SIZE];
+
+    for (int r = 1; r < MS; r++)
+    {
+      MemOps::zero(area, sizeof(area));
+
+      for (int g = 1; g < MS; g++)
+      {
+        ColorQuantizerMoment line;
+        MemOps::zero(&line, sizeof(line));
+
+        const Bin* bins = &_hist[((r - 1) << (HIST_BITS * 2)) | ((g - 1) << HIST_BITS)];
+
+        for (int b = 1; b < MS; b++)
+        {
+          const Bin& bin = bins[b - 1];
+
+          if (bin.count != 0)
+          {
+            int64_t w = bin.count;
+            int64_t sr = w * ((r - 1) << (8 - HIST_BITS)) + bin.r;
+            int64_t sg = w * ((g - 1) << (8 - HIST_BITS)) + bin.g;
+            int64_t sb = w * ((b - 1) << (8 - HIST_BITS)) + bin.b;
+
+            line.w += w;
+            line.r += sr;
+            line.g += sg;
+            line.b += sb;
+            line.q += ColorQuantizer_weightedSquare(w, sr, sg, sb);
+          }
+
+          ColorQuantizerMoment& a = area[b];
+          a.w += line.w;
+          a.r += line.r;
+          a.g += line.g;
+          a.b += line.b;
+          a.q += line.q;
+
+          const ColorQuantizerMoment& prev = m[ColorQuantizer_momentIndex(r - 1, g, b)];
+          ColorQuantizerMoment& cur = m[ColorQuantizer_momentIndex(r, g, b)];
+
+          cur.w = prev.w + a.w;
+          cur.r = prev.r + a.r;
+          cur.g = prev.g + a.g;
+          cur.b = prev.b + a.b;
+          cur.q = prev.q + a.q;
+        }
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Wu]
+  // --------------------------------------------------------------------------
+
+  ColorQuantizerCube cubes[256];
+  double variances[256];
+
+  cubes[0].r0 = 0; cubes[0].r1 = MS - 1;
+  cubes[0].g0 = 0; cubes[0].g1 = MS - 1;
+  cubes[0].b0 = 0; cubes[0].b1 = MS - 1;
+
+  uint32_t count = 1;
+  uint32_t next = 0;
+  uint32_t i;
+
+  while (count < maxColors)
+  {
+    if (ColorQuantizer_cut(m, cubes[next], cubes[count]))
+    {
+      variances[next] = ColorQuantizer_cellCount(cubes[next]) > 1 ? ColorQuantizer_variance(m, cubes[next]) : 0.0;
+      variances[count] = ColorQuantizer_cellCount(cubes[count]) > 1 ? ColorQuantizer_variance(m, cubes[count]) : 0.0;
+      count++;
+    }
+    else
+    {
+      variances[next] = 0.0;
+    }
+
+    // Cut the cube having the largest variance next, ties are resolved by the
+    // lower index to stay deterministic.
+    double best = variances[0];
+    next = 0;
+
+    for (i = 1; i < count; i++)
+    {
+      if (variances[i] > best)
+      {
+        best = variances[i];
+        next = i;
+      }
+    }
+
+    if (best <= 0.0)
+      break;
+  }
+
+  // Palette is a mean color of each cube.
+  for (i = 0; i < count; i++)
+  {
+    ColorQuantizerMoment v;
+    ColorQuantizer_volume(v, m, cubes[i]);
+
+    if (v.w == 0)
+    {
+      _palette[i].setPacked32(0xFF000000);
+      continue;
+    }
+
+    int64_t half = v.w >> 1;
+    _palette[i].setArgb32(0xFF,
+      (uint32_t)((v.r + half) / v.w),
+      (uint32_t)((v.g + half) / v.w),
+      (uint32_t)((v.b + half) / v.w));
+  }
+
+  MemMgr::free(m);
+  _length = count;
+
+  ColorQuantizer_api.buildLut(_lut, _palette, _length);
+
+  // The pattern dither amplitude is a half of the average distance between
+  // palette colors, estimated as if they formed a cube.
+  uint32_t side = 1;
+  while ((side + 1) * (side + 1) * (side + 1) <= _length)
+    side++;
+
+  _ditherSpread = (int)(128 / side);
+  if (_ditherSpread < 4) _ditherSpread = 4;
+  if (_ditherSpread > 48) _ditherSpread = 48;
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Map]
+// ============================================================================
+
+err_t ColorQuantizer::beginMap(uint32_t width, uint32_t ditherType)
+{
+  _ditherType = (_exact || ditherType >= DITHER_TYPE_COUNT) ? (uint32_t)DITHER_TYPE_NONE : ditherType;
+
+  if (_ditherType == DITHER_TYPE_DIFFUSION)
+  {
+    // Two rows, each has one border pixel at the start and at the end.
+    uint32_t capacity = width + 2;
+
+    if (capacity > _errCapacity)
+    {
+      int32_t* err = reinterpret_cast<int32_t*>(MemMgr::alloc(capacity * 6 * sizeof(int32_t)));
+      if (FOG_IS_NULL(err))
+        return ERR_RT_OUT_OF_MEMORY;
+
+      if (_err) MemMgr::free(_err);
+      _err = err;
+      _errCapacity = capacity;
+    }
+
+    MemOps::zero(_err, _errCapacity * 6 * sizeof(int32_t));
+  }
+
+  return ERR_OK;
+}
+
+void ColorQuantizer::mapRow(uint8_t* dst, const uint32_t* src, int x, int y, uint32_t length, uint32_t transparentIndex)
+{
+  uint32_t i;
+
+  // --------------------------------------------------------------------------
+  // [Exact]
+  // --------------------------------------------------------------------------
+
+  if (_exact)
+  {
+    for (i = 0; i < length; i++)
+    {
+      uint32_t c = src[i];
+
+      if ((c >> 24) == 0)
+      {
+        dst[i] = (uint8_t)transparentIndex;
+        continue;
+      }
+
+      c |= 0xFF000000;
+      uint32_t h = ColorQuantizer_hashExact(c);
+      uint32_t key;
+
+      while ((key = _exactKeys[h]) != c && key != 0)
+        h = (h + 1) & (EXACT_SIZE - 1);
+
+      if (key != 0)
+        dst[i] = _exactIndex[h];
+      else
+        dst[i] = (uint8_t)findNearest((c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF);
+    }
+    return;
+  }
+
+  switch (_ditherType)
+  {
+    // ------------------------------------------------------------------------
+    // [None]
+    // ------------------------------------------------------------------------
+
+    case DITHER_TYPE_NONE:
+    {
+      ColorQuantizer_api.mapSpan(dst, src, length, _lut, NULL, transparentIndex);
+      break;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Pattern]
+    // ------------------------------------------------------------------------
+
+    case DITHER_TYPE_PATTERN:
+    {
+      uint32_t dither[DitherTable::SIZE * 2];
+
+      ColorQuantizer_makeDither(dither, x, y, _ditherSpread);
+      ColorQuantizer_api.mapSpan(dst, src, length, _lut, dither, transparentIndex);
+      break;
+    }
+
+    // ------------------------------------------------------------------------
+    // [Diffusion]
+    // ------------------------------------------------------------------------
+
+    case DITHER_TYPE_DIFFUSION:
+    {
+      FOG_ASSERT(length + 2 <= _errCapacity);
+
+      // Errors are accumulated in 1/16 units (Floyd-Steinberg weights).
+      int32_t* cur = _err + 3;
+      int32_t* next = _err + _errCapacity * 3 + 3;
+
+      for (i = 0; i < length; i++, cur += 3, next += 3)
+      {
+        uint32_t c = src[i];
+
+        if ((c >> 24) == 0)
+        {
+          dst[i] = (uint8_t)transparentIndex;
+          continue;
+        }
+
+        int r = ColorQuantizer_clamp255((int)((c >> 16) & 0xFF) + ((cur[0] + 8) >> 4));
+        int g = ColorQuantizer_clamp255((int)((c >>  8) & 0xFF) + ((cur[1] + 8) >> 4));
+        int b = ColorQuantizer_clamp255((int)((c      ) & 0xFF) + ((cur[2] + 8) >> 4));
+
+        uint32_t index = findFast(r, g, b);
+        dst[i] = (uint8_t)index;
+
+        int er = r - (int)_palette[index].getRed();
+        int eg = g - (int)_palette[index].getGreen();
+        int eb = b - (int)_palette[index].getBlue();
+
+        cur [ 3] += er * 7; cur [ 4] += eg * 7; cur [ 5] += eb * 7;
+        next[-3] += er * 3; next[-2] += eg * 3; next[-1] += eb * 3;
+        next[ 0] += er * 5; next[ 1] += eg * 5; next[ 2] += eb * 5;
+        next[ 3] += er    ; next[ 4] += eg    ; next[ 5] += eb    ;
+      }
+
+      // The next row becomes the current one.
+      size_t rowSize = _errCapacity * 3 * sizeof(int32_t);
+      MemOps::copy(_err, _err + _errCapacity * 3, rowSize);
+      MemOps::zero(_err + _errCapacity * 3, rowSize);
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - Image]
+// ============================================================================
+
+err_t ColorQuantizer::addImage(const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int h)
+{
+  if (w <= 0 || h <= 0)
+    return ERR_OK;
+
+  uint32_t* buffer = reinterpret_cast<uint32_t*>(MemMgr::alloc((size_t)w * sizeof(uint32_t)));
+  if (FOG_IS_NULL(buffer))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  err_t err = ERR_OK;
+
+  for (int y = 0; y < h; y++, src += srcStride)
+  {
+    ColorQuantizer_fetchRow(buffer, src, format, w);
+
+    err = addRow(buffer, (uint32_t)w);
+    if (FOG_IS_ERROR(err))
+      break;
+  }
+
+  MemMgr::free(buffer);
+  return err;
+}
+
+err_t ColorQuantizer::mapImage(uint8_t* dst, ssize_t dstStride, const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int h)
+{
+  if (w <= 0 || h <= 0)
+    return ERR_OK;
+
+  Thread* threads[COLOR_QUANTIZER_MAX_THREADS - 1];
+  uint numWorkers = 1;
+
+  // The error diffusion depends on the previous row, it's always sequential.
+  if (_ditherType != DITHER_TYPE_DIFFUSION)
+  {
+    uint maxThreads = Math::min<uint>(Cpu::get()->getNumberOfProcessors(), COLOR_QUANTIZER_MAX_THREADS);
+
+    uint64_t work = (uint64_t)w * (uint64_t)h;
+    uint64_t wanted = Math::min<uint64_t>(work / COLOR_QUANTIZER_MIN_WORK_PER_THREAD, maxThreads);
+    wanted = Math::min<uint64_t>(wanted, (uint64_t)h);
+
+    // The calling thread is always used.
+    if (wanted > 1)
+      numWorkers = BandDispatcher::getThreads(threads, uint(wanted) - 1) + 1;
+  }
+
+  err_t err = ERR_OK;
+
+  {
+    ColorQuantizerWorkMgr mgr(this, threads, numWorkers);
+
+    mgr.dst = dst;
+    mgr.dstStride = dstStride;
+    mgr.src = src;
+    mgr.srcStride = srcStride;
+    mgr.format = format;
+    mgr.w = w;
+    mgr.h = h;
+
+    mgr.buffer = reinterpret_cast<uint32_t*>(MemMgr::alloc((size_t)w * numWorkers * sizeof(uint32_t)));
+    if (FOG_IS_NULL(mgr.buffer))
+      err = ERR_RT_OUT_OF_MEMORY;
+    else
+      mgr.dispatch();
+  }
+
+  if (numWorkers > 1)
+    ThreadPool::get()->releaseThreads(threads, numWorkers - 1);
+
+  return err;
+}
+
+void ColorQuantizer::mapBand(uint8_t* dst, ssize_t dstStride, const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int y0, int y1, uint32_t* buffer)
+{
+  dst += (ssize_t)y0 * dstStride;
+  src += (ssize_t)y0 * srcStride;
+
+  for (int y = y0; y < y1; y++, dst += dstStride, src += srcStride)
+  {
+    ColorQuantizer_fetchRow(buffer, src, format, w);
+    mapRow(dst, buffer, 0, y, (uint32_t)w, 0);
+  }
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - FindNearest]
+// ============================================================================
+
+uint32_t ColorQuantizer::findNearest(int r, int g, int b) const
+{
+  uint32_t best = 0;
+  uint32_t bestDistance = 0xFFFFFFFF;
+
+  for (uint32_t i = 0; i < _length; i++)
+  {
+    int dr = r - (int)_palette[i].getRed();
+    int dg = g - (int)_palette[i].getGreen();
+    int db = b - (int)_palette[i].getBlue();
+
+    uint32_t distance = (uint32_t)(dr * dr + dg * dg + db * db);
+    if (distance < bestDistance)
+    {
+      best = i;
+      bestDistance = distance;
+      if (distance == 0) break;
+    }
+  }
+
+  return best;
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - BuildLut (C)]
+// ============================================================================
+
+static void FOG_CDECL ColorQuantizer_buildLut_C(uint8_t* lut, const Argb32* palette, uint32_t length)
+{
+  const uint32_t BITS = ColorQuantizer::HIST_BITS;
+  const uint32_t MASK = (1 << BITS) - 1;
+  const int HALF = 1 << (7 - BITS);
+
+  for (uint32_t i = 0; i < ColorQuantizer::HIST_SIZE; i++)
+  {
+    int r = (int)(((i >> (BITS * 2))       ) << (8 - BITS)) + HALF;
+    int g = (int)(((i >> (BITS    )) & MASK) << (8 - BITS)) + HALF;
+    int b = (int)(((i             ) & MASK) << (8 - BITS)) + HALF;
+
+    uint32_t best = 0;
+    uint32_t bestDistance = 0xFFFFFFFF;
+
+    for (uint32_t j = 0; j < length; j++)
+    {
+      int dr = r - (int)palette[j].getRed();
+      int dg = g - (int)palette[j].getGreen();
+      int db = b - (int)palette[j].getBlue();
+
+      uint32_t distance = (uint32_t)(dr * dr + dg * dg + db * db);
+      if (distance < bestDistance)
+      {
+        best = j;
+        bestDistance = distance;
+      }
+    }
+
+    lut[i] = (uint8_t)best;
+  }
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - MapSpan (C)]
+// ============================================================================
+
+static void FOG_CDECL ColorQuantizer_mapSpan_C(uint8_t* dst, const uint32_t* src, uint32_t length,
+  const uint8_t* lut, const uint32_t* dither, uint32_t transparentIndex)
+{
+  uint32_t i;
+
+  if (dither == NULL)
+  {
+    for (i = 0; i < length; i++)
+    {
+      uint32_t c = src[i];
+
+      if ((c >> 24) == 0)
+        dst[i] = (uint8_t)transparentIndex;
+      else
+        dst[i] = lut[((c >> 9) & 0x7C00) | ((c >> 6) & 0x03E0) | ((c >> 3) & 0x001F)];
+    }
+  }
+  else
+  {
+    for (i = 0; i < length; i++)
+    {
+      uint32_t c = src[i];
+
+      if ((c >> 24) == 0)
+      {
+        dst[i] = (uint8_t)transparentIndex;
+        continue;
+      }
+
+      // One of the added and subtracted values is always zero.
+      int d = (int)(dither[ i & DitherTable::MASK                     ] & 0xFF) -
+              (int)(dither[(i & DitherTable::MASK) + DitherTable::SIZE] & 0xFF);
+
+      uint32_t r = (uint32_t)ColorQuantizer_clamp255((int)((c >> 16) & 0xFF) + d);
+      uint32_t g = (uint32_t)ColorQuantizer_clamp255((int)((c >>  8) & 0xFF) + d);
+      uint32_t b = (uint32_t)ColorQuantizer_clamp255((int)((c      ) & 0xFF) + d);
+
+      dst[i] = lut[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+    }
+  }
+}
+
+// ============================================================================
+// [Fog::ColorQuantizerWorkMgr - Construction / Destruction]
+// ============================================================================
+
+ColorQuantizerWorkMgr::ColorQuantizerWorkMgr(ColorQuantizer* quantizer, Thread** threads, uint numWorkers) :
+  quantizer(quantizer),
+  dst(NULL),
+  dstStride(0),
+  src(NULL),
+  srcStride(0),
+  format(IMAGE_FORMAT_NULL),
+  w(0),
+  h(0),
+  numWorkers(numWorkers),
+  buffer(NULL),
+  threads(threads)
+{
+  FOG_ASSERT(numWorkers >= 1);
+}
+
+ColorQuantizerWorkMgr::~ColorQuantizerWorkMgr()
+{
+  if (buffer != NULL)
+    MemMgr::free(buffer);
+}
+
+// ============================================================================
+// [Fog::ColorQuantizerWorkMgr - Dispatch]
+// ============================================================================
+
+static void FOG_CDECL ColorQuantizerWorkMgr_runWorker(void* data, uint id)
+{
+  static_cast<ColorQuantizerWorkMgr*>(data)->runWorker(id);
+}
+
+void ColorQuantizerWorkMgr::dispatch()
+{
+  dispatcher.run(threads, numWorkers, ColorQuantizerWorkMgr_runWorker, this);
+}
+
+// ============================================================================
+// [Fog::ColorQuantizerWorkMgr - Run]
+// ============================================================================
+
+void ColorQuantizerWorkMgr::runWorker(uint id)
+{
+  int y0, y1;
+  BandDispatcher::getBand(h, numWorkers, id, y0, y1);
+
+  if (y0 < y1)
+    quantizer->mapBand(dst, dstStride, src, srcStride, format, w, y0, y1, buffer + (size_t)w * id);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_CPU_DECLARE_INITIALIZER_SSE2( ColorQuantizer_init_SSE2(ColorQuantizerApi* api) )
+
+FOG_NO_EXPORT void ColorQuantizer_init(void)
+{
+  // --------------------------------------------------------------------------
+  // [Funcs]
+  // --------------------------------------------------------------------------
+
+  ColorQuantizer_api.buildLut = ColorQuantizer_buildLut_C;
+  ColorQuantizer_api.mapSpan = ColorQuantizer_mapSpan_C;
+
+  // --------------------------------------------------------------------------
+  // [CPU Based Optimizations]
+  // --------------------------------------------------------------------------
+
+  FOG_CPU_USE_INITIALIZER_SSE2( ColorQuantizer_init_SSE2(&ColorQuantizer_api) )
+}
+
+} // Fog namespace
@@ -0,0 +1,232 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Acc/AccSse2.h>
+#include <Fog/Core/Global/Global.h>
+#include <Fog/G2d/Tools/ColorQuantizer_p.h>
+#include <Fog/G2d/Tools/DitherTable_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::ColorQuantizer - Constants (SSE2)]
+// ============================================================================
+
+FOG_XMM_DECLARE_CONST_PI32_VAR(ColorQuantizerIndex0123, 3, 2, 1, 0);
+FOG_XMM_DECLARE_CONST_PI32_SET(ColorQuantizerIndex4, 4);
+FOG_XMM_DECLARE_CONST_PI32_SET(ColorQuantizerMaxDistance, 0x7FFFFFFF);
+
+FOG_XMM_DECLARE_CONST_PI32_SET(ColorQuantizerMaskR, 0x7C00);
+FOG_XMM_DECLARE_CONST_PI32_SET(ColorQuantizerMaskG, 0x03E0);
+FOG_XMM_DECLARE_CONST_PI32_SET(ColorQuantizerMaskB, 0x001F);
+
+// ============================================================================
+// [Fog::ColorQuantizer - BuildLut (SSE2)]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Fill the lookup table, 4 palette entries are compared at once.
+//!
+//! The palette is converted to 16-bit RG pairs and B values so the squared
+//! distance of each entry is calculated by two multiply-adds. Ties are resolved
+//! by the lower index, the result is the same as the C version.
+static void FOG_CDECL ColorQuantizer_buildLut_SSE2(uint8_t* lut, const Argb32* palette, uint32_t length)
+{
+  const uint32_t BITS = ColorQuantizer::HIST_BITS;
+  const uint32_t MASK = (1 << BITS) - 1;
+  const int HALF = 1 << (7 - BITS);
+
+  FOG_ASSERT(length > 0 && length <= 256);
+
+  // The last entry is repeated to fill the last group, it's never selected
+  // because its copy has a lower index.
+  FOG_ALIGNED_VAR(int16_t, pRG[256 * 2], 16);
+  FOG_ALIGNED_VAR(int16_t, pB [256 * 2], 16);
+
+  uint32_t groups = (length + 3) >> 2;
+  uint32_t i;
+
+  for (i = 0; i < groups * 4; i++)
+  {
+    const Argb32& c = palette[i < length ? i : length - 1];
+
+    pRG[i * 2 + 0] = (int16_t)c.getRed();
+    pRG[i * 2 + 1] = (int16_t)c.getGreen();
+    pB [i * 2 + 0] = (int16_t)c.getBlue();
+    pB [i * 2 + 1] = 0;
+  }
+
+  FOG_ALIGNED_VAR(uint32_t, bestDistance[4], 16);
+  FOG_ALIGNED_VAR(uint32_t, bestIndex[4], 16);
+
+  for (i = 0; i < ColorQuantizer::HIST_SIZE; i++)
+  {
+    int r = (int)(((i >> (BITS * 2))       ) << (8 - BITS)) + HALF;
+    int g = (int)(((i >> (BITS    )) & MASK) << (8 - BITS)) + HALF;
+    int b = (int)(((i             ) & MASK) << (8 - BITS)) + HALF;
+
+    __m128i xmmRG;
+    __m128i xmmB;
+
+    Acc::m128iCvtSI128FromSI(xmmRG, r | (g << 16));
+    Acc::m128iCvtSI128FromSI(xmmB, b);
+    Acc::m128iExtendPI32FromSI32(xmmRG, xmmRG);
+    Acc::m128iExtendPI32FromSI32(xmmB, xmmB);
+
+    __m128i xmmBestDistance = FOG_XMM_GET_CONST_PI(ColorQuantizerMaxDistance);
+    __m128i xmmBestIndex;
+    __m128i xmmIndex = FOG_XMM_GET_CONST_PI(ColorQuantizerIndex0123);
+
+    Acc::m128iZero(xmmBestIndex);
+
+    for (uint32_t j = 0; j < groups; j++)
+    {
+      __m128i xmm0, xmm1;
+      __m128i xmmMask;
+
+      Acc::m128iLoad16a(xmm0, pRG + j * 8);
+      Acc::m128iLoad16a(xmm1, pB + j * 8);
+
+      Acc::m128iSubPI16(xmm0, xmmRG, xmm0);
+      Acc::m128iSubPI16(xmm1, xmmB, xmm1);
+
+      Acc::m128iMAddPI16(xmm0, xmm0, xmm0);
+      Acc::m128iMAddPI16(xmm1, xmm1, xmm1);
+      Acc::m128iAddPI32(xmm0, xmm0, xmm1);
+
+      // Replace entries where the distance is strictly lower.
+      Acc::m128iCmpGtPI32(xmmMask, xmmBestDistance, xmm0);
+
+      Acc::m128iAnd(xmm0, xmm0, xmmMask);
+      Acc::m128iAndNot(xmmBestDistance, xmmMask, xmmBestDistance);
+      Acc::m128iOr(xmmBestDistance, xmmBestDistance, xmm0);
+
+      Acc::m128iAnd(xmm1, xmmIndex, xmmMask);
+      Acc::m128iAndNot(xmmBestIndex, xmmMask, xmmBestIndex);
+      Acc::m128iOr(xmmBestIndex, xmmBestIndex, xmm1);
+
+      Acc::m128iAddPI32(xmmIndex, xmmIndex, FOG_XMM_GET_CONST_PI(ColorQuantizerIndex4));
+    }
+
+    Acc::m128iStore16a(bestDistance, xmmBestDistance);
+    Acc::m128iStore16a(bestIndex, xmmBestIndex);
+
+    uint32_t best = 0;
+    for (uint32_t k = 1; k < 4; k++)
+    {
+      if (bestDistance[k] < bestDistance[best] ||
+         (bestDistance[k] == bestDistance[best] && bestIndex[k] < bestIndex[best]))
+      {
+        best = k;
+      }
+    }
+
+    lut[i] = (uint8_t)bestIndex[best];
+  }
+}
+
+// ============================================================================
+// [Fog::ColorQuantizer - MapSpan (SSE2)]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Map 4 pixels, the dither is applied by saturated additions and the
+//! bin indexes are calculated in parallel, only the table lookup is scalar.
+static FOG_INLINE void ColorQuantizer_map4_SSE2(uint8_t* dst, const uint32_t* src, uint32_t count,
+  const uint8_t* lut, const uint32_t* ditherAdd, const uint32_t* ditherSub, uint32_t transparentIndex)
+{
+  FOG_ALIGNED_VAR(uint32_t, index[4], 16);
+
+  __m128i xmm0;
+  __m128i xmmR, xmmG;
+
+  Acc::m128iLoad16u(xmm0, src);
+
+  if (ditherAdd != NULL)
+  {
+    __m128i xmmAdd, xmmSub;
+
+    Acc::m128iLoad16u(xmmAdd, ditherAdd);
+    Acc::m128iLoad16u(xmmSub, ditherSub);
+
+    Acc::m128iAddusPU8(xmm0, xmm0, xmmAdd);
+    Acc::m128iSubusPU8(xmm0, xmm0, xmmSub);
+  }
+
+  Acc::m128iRShiftPU32<9>(xmmR, xmm0);
+  Acc::m128iRShiftPU32<6>(xmmG, xmm0);
+  Acc::m128iRShiftPU32<3>(xmm0, xmm0);
+
+  Acc::m128iAnd(xmmR, xmmR, FOG_XMM_GET_CONST_PI(ColorQuantizerMaskR));
+  Acc::m128iAnd(xmmG, xmmG, FOG_XMM_GET_CONST_PI(ColorQuantizerMaskG));
+  Acc::m128iAnd(xmm0, xmm0, FOG_XMM_GET_CONST_PI(ColorQuantizerMaskB));
+
+  Acc::m128iOr(xmm0, xmm0, xmmR);
+  Acc::m128iOr(xmm0, xmm0, xmmG);
+
+  Acc::m128iStore16a(index, xmm0);
+
+  for (uint32_t k = 0; k < count; k++)
+    dst[k] = (src[k] >> 24) != 0 ? lut[index[k]] : (uint8_t)transparentIndex;
+}
+
+static void FOG_CDECL ColorQuantizer_mapSpan_SSE2(uint8_t* dst, const uint32_t* src, uint32_t length,
+  const uint8_t* lut, const uint32_t* dither, uint32_t transparentIndex)
+{
+  // The dither table period is a multiple of 4, so 4 pixels never wrap.
+  const uint32_t* ditherAdd = NULL;
+  const uint32_t* ditherSub = NULL;
+
+  uint32_t i = 0;
+
+  for (; i + 4 <= length; i += 4)
+  {
+    if (dither != NULL)
+    {
+      ditherAdd = dither + (i & DitherTable::MASK);
+      ditherSub = ditherAdd + DitherTable::SIZE;
+    }
+
+    ColorQuantizer_map4_SSE2(dst + i, src + i, 4, lut, ditherAdd, ditherSub, transparentIndex);
+  }
+
+  if (i < length)
+  {
+    // Tail is copied to a temporary buffer (the unused pixels are zero).
+    uint32_t tmp[4] = { 0, 0, 0, 0 };
+    uint32_t count = length - i;
+
+    for (uint32_t k = 0; k < count; k++)
+      tmp[k] = src[i + k];
+
+    if (dither != NULL)
+    {
+      ditherAdd = dither + (i & DitherTable::MASK);
+      ditherSub = ditherAdd + DitherTable::SIZE;
+    }
+
+    ColorQuantizer_map4_SSE2(dst + i, tmp, count, lut, ditherAdd, ditherSub, transparentIndex);
+  }
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void ColorQuantizer_init_SSE2(ColorQuantizerApi* api)
+{
+  api->buildLut = ColorQuantizer_buildLut_SSE2;
+  api->mapSpan = ColorQuantizer_mapSpan_SSE2;
+}
+
+} // Fog namespace
@@ -0,0 +1,300 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TOOLS_COLORQUANTIZER_P_H
+#define _FOG_G2D_TOOLS_COLORQUANTIZER_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Threading/BandDispatcher_p.h>
+#include <Fog/Core/Threading/Thread.h>
+#include <Fog/G2d/Source/Argb.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Tools
+//! @{
+
+// ============================================================================
+// [Fog::COLOR_QUANTIZER_CORE]
+// ============================================================================
+
+enum COLOR_QUANTIZER_CORE
+{
+  //! @brief Maximum number of threads used by @c ColorQuantizer::mapImage()
+  //! (including the calling thread).
+  COLOR_QUANTIZER_MAX_THREADS = 16,
+
+  //! @brief Minimum count of pixels mapped by one thread.
+  COLOR_QUANTIZER_MIN_WORK_PER_THREAD = 256 * 256
+};
+
+// ============================================================================
+// [Fog::ColorQuantizerApi]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Color quantizer functions optimized for the CPU.
+struct FOG_NO_EXPORT ColorQuantizerApi
+{
+  //! @brief Fill the bin to palette index lookup table (@c HIST_SIZE entries)
+  //! by the palette entry nearest to the center of each bin.
+  typedef void (FOG_CDECL* BuildLutFunc)(uint8_t* lut, const Argb32* palette, uint32_t length);
+
+  //! @brief Map @a length ARGB32 pixels through the lookup table.
+  //!
+  //! If @a dither is not @c NULL it contains @c DitherTable::SIZE packed RGB
+  //! values added to the pixels (saturated) followed by @c DitherTable::SIZE
+  //! values subtracted from them, both starting at the first pixel. Pixels
+  //! where the alpha is zero are mapped to @a transparentIndex.
+  typedef void (FOG_CDECL* MapSpanFunc)(uint8_t* dst, const uint32_t* src, uint32_t length,
+    const uint8_t* lut, const uint32_t* dither, uint32_t transparentIndex);
+
+  BuildLutFunc buildLut;
+  MapSpanFunc mapSpan;
+};
+
+extern FOG_NO_EXPORT ColorQuantizerApi ColorQuantizer_api;
+
+// ============================================================================
+// [Fog::ColorQuantizer]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Reduces colors of ARGB32 pixels to a palette of at most 256 entries.
+//!
+//! Pixels are added row by row by @c addRow(), then @c buildPalette() creates
+//! the palette and @c mapRow() translates the pixels to palette indexes. If
+//! the pixels contain at most @c maxColors unique colors the palette is exact,
+//! otherwise it's created by Wu's variance minimization of a 5:5:5 histogram
+//! and the pixels are mapped through a lookup table having one entry per bin.
+//!
+//! Pixels where the alpha is zero are not part of the histogram and are mapped
+//! to the index passed to @c mapRow(), all other pixels are treated as opaque.
+//!
+//! @c mapRow() doesn't modify the quantizer unless the error diffusion is used,
+//! so rows can be mapped by more threads, see @c mapImage().
+struct FOG_NO_EXPORT ColorQuantizer
+{
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum
+  {
+    //! @brief Bits per component used by the histogram.
+    HIST_BITS = 5,
+    //! @brief Count of histogram bins.
+    HIST_SIZE = 1 << (HIST_BITS * 3),
+
+    //! @brief Size of the exact color hash-table (must be power of 2).
+    EXACT_SIZE = 512
+  };
+
+  // --------------------------------------------------------------------------
+  // [Bin]
+  // --------------------------------------------------------------------------
+
+  //! @internal
+  //!
+  //! @brief Histogram bin.
+  //!
+  //! Only the low 3 bits of each component (these not used to index the bin)
+  //! are summed so 32-bit sums don't overflow.
+  struct Bin
+  {
+    uint32_t count;
+    uint32_t r;
+    uint32_t g;
+    uint32_t b;
+  };
+
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  ColorQuantizer();
+  ~ColorQuantizer();
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const Argb32* getPalette() const { return _palette; }
+  FOG_INLINE uint32_t getLength() const { return _length; }
+  FOG_INLINE bool isExact() const { return _exact; }
+
+  // --------------------------------------------------------------------------
+  // [Methods]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reset the histogram and the palette.
+  void reset();
+
+  //! @brief Add @a length ARGB32 pixels to the histogram.
+  err_t addRow(const uint32_t* src, uint32_t length);
+
+  //! @brief Build the palette having at most @a maxColors entries.
+  err_t buildPalette(uint32_t maxColors);
+
+  //! @brief Prepare mapping of rows having at most @a width pixels.
+  //!
+  //! @a ditherType is one of @c DITHER_TYPE values, dithering is not used if
+  //! the palette is exact.
+  err_t beginMap(uint32_t width, uint32_t ditherType);
+
+  //! @brief Map @a length ARGB32 pixels to palette indexes.
+  //!
+  //! The @a x and @a y position is used by the pattern dither, the error
+  //! diffusion expects that rows are mapped top-to-bottom.
+  void mapRow(uint8_t* dst, const uint32_t* src, int x, int y, uint32_t length, uint32_t transparentIndex);
+
+  // --------------------------------------------------------------------------
+  // [Image]
+  // --------------------------------------------------------------------------
+
+  //! @brief Add pixels of an image to the histogram.
+  //!
+  //! The @a format must be @c IMAGE_FORMAT_PRGB32, @c IMAGE_FORMAT_XRGB32 or
+  //! @c IMAGE_FORMAT_RGB24, the alpha channel is ignored (premultiplied pixels
+  //! are taken as composited over black).
+  err_t addImage(const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int h);
+
+  //! @brief Map pixels of an image to palette indexes.
+  //!
+  //! The image is split into horizontal bands mapped by pooled threads, except
+  //! when the error diffusion is used. The result doesn't depend on the count
+  //! of threads. @c beginMap() must be called before.
+  err_t mapImage(uint8_t* dst, ssize_t dstStride, const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int h);
+
+  //! @brief Map rows [@a y0, @a y1) of an image, @a buffer must have a space
+  //! for @a w pixels.
+  void mapBand(uint8_t* dst, ssize_t dstStride, const uint8_t* src, ssize_t srcStride, uint32_t format, int w, int y0, int y1, uint32_t* buffer);
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get index of the nearest palette entry to the given color.
+  uint32_t findNearest(int r, int g, int b) const;
+
+  //! @brief Get index of the nearest palette entry through the lookup table
+  //! (the palette must not be exact).
+  FOG_INLINE uint32_t findFast(int r, int g, int b) const
+  {
+    uint32_t i = ((uint32_t)(r >> (8 - HIST_BITS)) << (HIST_BITS * 2)) |
+                 ((uint32_t)(g >> (8 - HIST_BITS)) << (HIST_BITS    )) |
+                 ((uint32_t)(b >> (8 - HIST_BITS))                   ) ;
+    return _lut[i];
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+protected:
+  //! @brief Histogram (allocated on demand).
+  Bin* _hist;
+  //! @brief Bin to palette index lookup table (allocated on demand).
+  uint8_t* _lut;
+  //! @brief Error diffusion rows, 3 components per pixel including borders.
+  int32_t* _err;
+  //! @brief Capacity of the error diffusion rows (in pixels).
+  uint32_t _errCapacity;
+
+  //! @brief Exact colors in order they were found.
+  uint32_t _exactColors[256];
+  //! @brief Exact color hash-table keys, zero means empty.
+  uint32_t _exactKeys[EXACT_SIZE];
+  //! @brief Exact color hash-table values.
+  uint8_t _exactIndex[EXACT_SIZE];
+  //! @brief Count of exact colors, larger than 256 means overflow.
+  uint32_t _exactCount;
+
+  //! @brief Palette.
+  Argb32 _palette[256];
+  //! @brief Palette length.
+  uint32_t _length;
+  //! @brief Whether the palette contains all colors of the histogram.
+  bool _exact;
+
+  //! @brief Dither type used by @c mapRow().
+  uint32_t _ditherType;
+  //! @brief Amplitude of the pattern dither.
+  int _ditherSpread;
+
+private:
+  FOG_NO_COPY(ColorQuantizer)
+};
+
+// ============================================================================
+// [Fog::ColorQuantizerWorkMgr]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Color quantizer worker manager.
+//!
+//! The image is split into horizontal bands, one band per worker. The calling
+//! thread maps the first band and waits until all other workers finished.
+struct FOG_NO_EXPORT ColorQuantizerWorkMgr
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  ColorQuantizerWorkMgr(ColorQuantizer* quantizer, Thread** threads, uint numWorkers);
+  ~ColorQuantizerWorkMgr();
+
+  // --------------------------------------------------------------------------
+  // [Dispatch]
+  // --------------------------------------------------------------------------
+
+  //! @brief Run all workers and wait for them.
+  void dispatch();
+
+  //! @brief Map the band @a id.
+  void runWorker(uint id);
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The quantizer (shared, read-only).
+  ColorQuantizer* quantizer;
+
+  uint8_t* dst;
+  ssize_t dstStride;
+  const uint8_t* src;
+  ssize_t srcStride;
+  uint32_t format;
+  int w;
+  int h;
+
+  //! @brief Band dispatcher.
+  BandDispatcher dispatcher;
+
+  //! @brief Count of workers (including the calling thread).
+  uint numWorkers;
+
+  //! @brief Row buffers, @c w pixels per worker.
+  uint32_t* buffer;
+
+  //! @brief Pooled threads (numWorkers - 1).
+  Thread** threads;
+
+private:
+  FOG_NO_COPY(ColorQuantizerWorkMgr)
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TOOLS_COLORQUANTIZER_P_H